@@ -0,0 +1,485 @@
+// SSBench.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// Microbenchmarks and throughput tests for SSCore subsystems, as a companion to the functional tests in SSTest.
+// Each benchmark runs a fixed workload on fixed inputs (dates, observer location, data files from SSData), once to warm
+// up caches, then several timed runs, and reports the median, fastest, and slowest time per operation; so results are
+// repeatable from run to run, and comparable from release to release. Results are written as JSON to standard output,
+// or to a file, for tracking performance regressions.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sys/stat.h>
+
+#include "../SSCode/SSCoordinates.hpp"
+#include "../SSCode/SSPlanet.hpp"
+#include "../SSCode/SSStar.hpp"
+#include "../SSCode/SSHTM.hpp"
+#include "../SSCode/SSView.hpp"
+#include "../SSCode/SSTLE.hpp"
+#include "../SSCode/SSEvent.hpp"
+#include "../SSCode/SSJPLDEphemeris.hpp"
+#include "../SSCode/SSEphemerisPolicy.hpp"
+
+// Result of one benchmark: its name, the number of operations in each run, the bytes processed by each run
+// (zero if not a throughput benchmark), and the elapsed time of each timed run.
+
+struct SSBenchResult
+{
+    string name;
+    size_t ops;
+    size_t bytes;
+    vector<double> seconds;
+};
+
+static vector<SSBenchResult> gResults;
+static string gFilter;                  // only run benchmarks whose names begin with this; empty runs all
+static int gRuns = 5;                   // timed runs of each benchmark
+static volatile double gSink = 0.0;     // benchmarks accumulate results here, so the compiler can't discard the work
+static vector<SSEphemerisPolicy::Measurement> gMeasurements;   // ephemeris backend accuracy and speed, from BenchEphemerisPolicy()
+static double gBudget = 1.0;            // error budget for ephemeris backends chosen from gMeasurements [arcseconds]
+
+// Runs a benchmark (name) whose function (func) performs one run of its workload, and returns the number of operations
+// performed, or zero if the benchmark can't run (e.g. missing data). Throughput benchmarks also process (bytes) per run.
+
+static void bench ( const string &name, function<size_t ( void )> func, size_t bytes = 0 )
+{
+    if ( gFilter.length() > 0 && name.compare ( 0, gFilter.length(), gFilter ) != 0 )
+        return;
+
+    SSBenchResult result = { name, func(), bytes, {} };
+    if ( result.ops == 0 )
+    {
+        cerr << "Skipped " << name << endl;
+        return;
+    }
+
+    for ( int run = 0; run < gRuns; run++ )
+    {
+        auto start = chrono::steady_clock::now();
+        func();
+        result.seconds.push_back ( chrono::duration<double> ( chrono::steady_clock::now() - start ).count() );
+    }
+
+    sort ( result.seconds.begin(), result.seconds.end() );
+    cerr << format ( "%-28s %12.1f ns/op", name.c_str(), result.seconds[ result.seconds.size() / 2 ] * 1.0e9 / result.ops ) << endl;
+    gResults.push_back ( result );
+}
+
+// Returns (n) unit vectors uniformly distributed over the sphere, always the same ones.
+
+static vector<SSVector> randomDirections ( size_t n )
+{
+    mt19937 gen ( 20261015 );
+    vector<SSVector> dirs ( n );
+    for ( SSVector &dir : dirs )
+    {
+        double z = 2.0 * gen() / 4294967296.0 - 1.0;
+        double a = SSAngle::kTwoPi * gen() / 4294967296.0;
+        dir = SSVector ( sqrt ( 1.0 - z * z ) * cos ( a ), sqrt ( 1.0 - z * z ) * sin ( a ), z );
+    }
+
+    return dirs;
+}
+
+static long fileSize ( const string &path )
+{
+    FILE *file = fopen ( path.c_str(), "rb" );
+    if ( file == nullptr )
+        return 0;
+
+    fseek ( file, 0, SEEK_END );
+    long size = ftell ( file );
+    fclose ( file );
+    return size;
+}
+
+static const SSSpherical kHere = { SSAngle::fromDegrees ( -122.41942 ), SSAngle::fromDegrees ( 37.77493 ), 0.026 };
+static const double kJED = SSTime::kJ2000 + 9436.5;     // 2025 Nov 1.0 TT; every benchmark starts here
+
+// Planetary and lunar series: SSPlanet::computePositionVelocity() per call, through each built-in theory.
+
+void BenchSeries ( SSObjectVec &solsys )
+{
+    SSPlanetPtr pMars = SSGetPlanetPtr ( solsys[4] );
+    SSPlanetPtr pMoon = SSGetPlanetPtr ( solsys[10] );
+    const size_t n = 500;
+
+    auto positions = [n] ( SSPlanetPtr pObj )
+    {
+        SSVector pos, vel;
+        for ( size_t i = 0; i < n; i++ )
+        {
+            pObj->computePositionVelocity ( kJED + i * 0.1, 0.0, pos, vel );
+            gSink += pos.x;
+        }
+        return n;
+    };
+
+    SSPlanet::useVSOPELP ( true );
+    bench ( "series.vsop2013.mars", [&] { return positions ( pMars ); } );
+    bench ( "series.elpmpp02.moon", [&] { return positions ( pMoon ); } );
+
+    SSPlanet::useVSOPELP ( false );
+    bench ( "series.psephemeris.mars", [&] { return positions ( pMars ); } );
+    bench ( "series.psephemeris.moon", [&] { return positions ( pMoon ); } );
+    SSPlanet::useVSOPELP ( true );
+}
+
+// JPL DE lookup: one body, and all bodies at once, per call.
+
+void BenchJPLDE ( const string &inpath )
+{
+    if ( ! SSJPLDEphemeris::open ( inpath + "/SolarSystem/DE438/1950_2050.438" ) )
+        return;
+
+    const size_t n = 100000;
+    bench ( "jplde.mars", [n]
+    {
+        SSVector pos, vel;
+        for ( size_t i = 0; i < n; i++ )
+        {
+            SSJPLDEphemeris::compute ( 4, kJED + i * 0.01, false, pos, vel );
+            gSink += pos.x;
+        }
+        return n;
+    } );
+
+    bench ( "jplde.allbodies", [n]
+    {
+        SSVector pos[SSJPLDEReader::kNumBodies], vel[SSJPLDEReader::kNumBodies];
+        for ( size_t i = 0; i < n / 10; i++ )
+        {
+            SSJPLDEphemeris::compute ( 0x7FFu, kJED + i * 0.01, false, pos, vel );
+            gSink += pos[4].x;
+        }
+        return n / 10;
+    } );
+
+    SSJPLDEphemeris::close();
+}
+
+// Accuracy and speed of every ephemeris backend against DE438, for each body in 10-year eras from 1950 to 2050.
+// These are written to the JSON separately from the benchmarks, with the backend chosen within gBudget arcseconds.
+
+void BenchEphemerisPolicy ( const string &inpath )
+{
+    string name = "policy.ephemeris";
+    if ( gFilter.length() > 0 && name.compare ( 0, gFilter.length(), gFilter ) != 0 )
+        return;
+
+    if ( ! SSJPLDEphemeris::open ( inpath + "/SolarSystem/DE438/1950_2050.438" ) )
+        return;
+
+    double jed0 = SSTime ( SSDate ( kGregorian, 0.0, 1950, 1, 1.0, 0, 0, 0.0 ) ).getJulianEphemerisDate();
+    gMeasurements = SSEphemerisPolicy::measure ( jed0, jed0 + 100 * 365.25, 10 * 365.25, 50 );
+    cerr << format ( "%-28s %12d measurements", name.c_str(), (int) gMeasurements.size() ) << endl;
+
+    SSJPLDEphemeris::close();
+}
+
+// SGP4/SDP4 satellite propagation, per satellite per time step.
+
+void BenchSatellites ( const string &inpath )
+{
+    vector<SSTLE> tles;
+    FILE *file = fopen ( ( inpath + "/SolarSystem/Satellites/visual.txt" ).c_str(), "r" );
+    if ( file == nullptr )
+        return;
+
+    SSTLE tle;
+    while ( tle.read ( file ) == 0 )
+        tles.push_back ( tle );
+    fclose ( file );
+
+    bench ( "sgp4.satellite", [&tles]
+    {
+        SSVector pos, vel;
+        size_t ops = 0;
+        for ( int step = 0; step < 100; step++ )
+        {
+            for ( SSTLE &tle : tles )
+            {
+                tle.toPositionVelocity ( tle.jdepoch + step * 0.01, pos, vel );
+                gSink += pos.x;
+                ops++;
+            }
+        }
+        return ops;
+    } );
+}
+
+// Changing the time of an observer's coordinates: nutation, precession, sidereal time, Earth's position.
+
+void BenchCoordinates ( void )
+{
+    SSCoordinates coords ( SSTime ( kJED ), kHere );
+    const size_t n = 1000;
+    bench ( "coordinates.settime", [&coords, n]
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            coords.setTime ( SSTime ( kJED + i / 1440.0 ) );
+            gSink += coords.getLST();
+        }
+        return n;
+    } );
+}
+
+// Projecting celestial directions onto a 60-degree gnomonic field of view, per point.
+
+void BenchView ( void )
+{
+    SSView view ( kGnomonic, SSAngle::fromDegrees ( 60.0 ), 1024, 768, 512, 384 );
+    view.setCenter ( SSAngle::fromDegrees ( 90.0 ), SSAngle::fromDegrees ( 30.0 ), 0.0 );
+    vector<SSVector> dirs = randomDirections ( 100000 );
+    bench ( "view.project", [&view, &dirs]
+    {
+        for ( SSVector &dir : dirs )
+            gSink += view.project ( dir ).x;
+        return dirs.size();
+    } );
+}
+
+// HTM cone search: 10-degree circles around fixed centers, in an HTM holding the bright stars, per search.
+
+void BenchHTM ( SSObjectVec &stars )
+{
+    SSObjectVec copies;
+    for ( int i = 0; i < stars.size(); i++ )
+        copies.append ( SSCloneObject ( stars[i] ) );
+
+    SSHTM htm ( { 2.0, 4.0, 6.0, INFINITY }, "" );
+    htm.store ( copies );
+    copies.clear();
+    vector<SSVector> centers = randomDirections ( 1000 );
+    bench ( "htm.conesearch", [&htm, &centers]
+    {
+        vector<SSObjectPtr> results;
+        for ( SSVector &center : centers )
+        {
+            results.clear();
+            gSink += htm.search ( 0, center, SSAngle::fromDegrees ( 10.0 ), results );
+        }
+        return centers.size();
+    } );
+}
+
+// HTM region loading: one run loads every region of the bright stars, saved in a temporary directory, into a new HTM,
+// from CSV files and from binary catalog files; operations are stars.
+
+void BenchHTMRegions ( SSObjectVec &stars )
+{
+    const char *tmpdir = getenv ( "TMPDIR" );
+    string dir = string ( tmpdir ? tmpdir : "/tmp" ) + "/ssbench_htm";
+    mkdir ( dir.c_str(), 0755 );
+    
+    SSObjectVec copies;
+    for ( int i = 0; i < stars.size(); i++ )
+        copies.append ( SSCloneObject ( stars[i] ) );
+    
+    vector<float> magLevels = { 2.0, 4.0, 6.0, INFINITY };
+    SSHTM saved ( magLevels, dir );
+    saved.store ( copies );
+    copies.clear();
+    if ( saved.saveRegions() == 0 )
+        return;
+    
+    saved.setDataFileWriteFunc ( SSHTMWriteBinaryRegion );
+    saved.saveRegions();
+    
+    bench ( "htm.load.csv", [&magLevels, &dir]
+    {
+        SSHTM htm ( magLevels, dir );
+        htm.loadRegions();
+        return (size_t) htm.countStars();
+    } );
+    
+    bench ( "htm.load.binary", [&magLevels, &dir]
+    {
+        SSHTM htm ( magLevels, dir );
+        htm.setDataFileReadFunc ( SSHTMReadBinaryRegion );
+        htm.loadRegions();
+        return (size_t) htm.countStars();
+    } );
+}
+
+// CSV import throughput: one run imports the whole bright star file; operations are stars.
+
+void BenchImport ( const string &inpath )
+{
+    string path = inpath + "/Stars/Brightest.csv";
+    bench ( "csv.import.stars", [&path]
+    {
+        SSObjectVec stars;
+        return (size_t) SSImportObjectsFromCSV ( path, stars );
+    }, fileSize ( path ) );
+}
+
+// Event searches: Sun and Moon rising, transit, and setting for successive days; and the next four lunar phases.
+
+void BenchEvents ( SSObjectVec &solsys )
+{
+    SSCoordinates coords ( SSTime ( kJED ), kHere );
+    SSObjectPtr pSun = solsys[0], pMoon = solsys[10];
+
+    auto riseTransitSet = [&]
+    {
+        for ( int day = 0; day < 30; day++ )
+        {
+            SSTime time ( kJED + day );
+            gSink += SSEvent::riseTransitSet ( time, coords, pSun, SSEvent::kSunMoonRiseSetAlt ).transit.time;
+            gSink += SSEvent::riseTransitSet ( time, coords, pMoon, SSEvent::kSunMoonRiseSetAlt ).transit.time;
+        }
+        return (size_t) 60;
+    };
+    
+    bench ( "event.risetransitset", riseTransitSet );
+
+    auto moonPhases = [&]
+    {
+        SSTime time ( kJED );
+        for ( int phase = 0; phase < 12; phase++ )
+            gSink += SSEvent::nextMoonPhase ( time, pSun, pMoon, SSEvent::kNewMoon + ( phase % 4 ) * SSEvent::kFirstQuarterMoon );
+        return (size_t) 12;
+    };
+    
+    bench ( "event.moonphase", moonPhases );
+    
+    // The same lunar phases and rising, transit, and setting times with the Chebyshev ephemeris cache; runs after the first reuse its fits.
+    
+    SSPlanet::useEphemerisCache ( true );
+    bench ( "event.moonphase.cached", moonPhases );
+    bench ( "event.risetransitset.cached", riseTransitSet );
+    SSPlanet::useEphemerisCache ( false );
+}
+
+// Writes all results as JSON to an output stream. Times are nanoseconds per operation; throughput in megabytes per second.
+
+void WriteJSON ( ostream &out )
+{
+    const char *platform = "unknown";
+#if defined ( __EMSCRIPTEN__ )
+    platform = "emscripten";
+#elif defined ( __APPLE__ )
+    platform = "macos";
+#elif defined ( __linux__ )
+    platform = "linux";
+#elif defined ( _WIN32 )
+    platform = "windows";
+#endif
+
+    string compiler = "unknown";
+#if defined ( __VERSION__ )
+    compiler = __VERSION__;
+#elif defined ( _MSC_VER )
+    compiler = "MSVC " + to_string ( _MSC_VER );
+#endif
+
+    out << "{" << endl;
+    out << "  \"platform\": \"" << platform << "\"," << endl;
+    out << "  \"compiler\": \"" << compiler << "\"," << endl;
+    out << "  \"threads\": " << USE_THREADS << "," << endl;
+    out << "  \"date\": \"" << SSDate ( SSTime::fromSystem() ).format ( "%Y-%m-%dT%H:%M:%S" ) << "\"," << endl;
+    out << "  \"runs\": " << gRuns << "," << endl;
+    out << "  \"benchmarks\": [" << endl;
+    for ( size_t i = 0; i < gResults.size(); i++ )
+    {
+        SSBenchResult &r = gResults[i];
+        double median = r.seconds[ r.seconds.size() / 2 ];
+        out << "    { \"name\": \"" << r.name << "\", \"ops\": " << r.ops;
+        out << format ( ", \"ns_per_op\": %.3f, \"ns_per_op_min\": %.3f, \"ns_per_op_max\": %.3f", median * 1.0e9 / r.ops, r.seconds.front() * 1.0e9 / r.ops, r.seconds.back() * 1.0e9 / r.ops );
+        if ( r.bytes > 0 )
+            out << format ( ", \"bytes\": %d, \"mb_per_s\": %.3f", (int) r.bytes, r.bytes / median / 1.0e6 );
+        out << " }" << ( i + 1 < gResults.size() ? "," : "" ) << endl;
+    }
+    out << "  ]";
+
+    // Each measurement's "chosen" and "chosen_without_jplde" flags show what SSEphemerisPolicy::choose() picks.
+
+    if ( gMeasurements.size() > 0 )
+    {
+        SSEphemerisPolicy policy = SSEphemerisPolicy::choose ( gMeasurements, gBudget );
+        SSEphemerisPolicy builtin = SSEphemerisPolicy::choose ( gMeasurements, gBudget, false );
+        out << "," << endl;
+        out << "  \"ephemeris_budget_arcsec\": " << gBudget << "," << endl;
+        out << "  \"ephemeris_backends\": [" << endl;
+        for ( size_t i = 0; i < gMeasurements.size(); i++ )
+        {
+            SSEphemerisPolicy::Measurement &m = gMeasurements[i];
+            out << "    { \"body\": " << m.id << format ( ", \"jed0\": %.1f, \"jed1\": %.1f", m.jed0, m.jed1 );
+            out << ", \"backend\": \"" << SSEphemerisPolicy::backendName ( m.backend ) << "\"";
+            out << format ( ", \"max_error_arcsec\": %.4f, \"ns_per_call\": %.1f", m.maxError, m.nsPerCall );
+            out << ", \"chosen\": " << ( policy.select ( m.id, m.jed0 ) == m.backend ? "true" : "false" );
+            out << ", \"chosen_without_jplde\": " << ( builtin.select ( m.id, m.jed0 ) == m.backend ? "true" : "false" );
+            out << " }" << ( i + 1 < gMeasurements.size() ? "," : "" ) << endl;
+        }
+        out << "  ]";
+    }
+
+    out << endl << "}" << endl;
+}
+
+int main ( int argc, const char *argv[] )
+{
+    if ( argc < 2 )
+    {
+        cout << "Usage: SSBench <inpath> [outfile] [filter] [runs]" << endl;
+        cout << "inpath: path to SSData directory" << endl;
+        cout << "outfile: path to JSON output file; - or omitted writes to standard output" << endl;
+        cout << "filter: only run benchmarks whose names begin with this, e.g. series" << endl;
+        cout << "runs: number of timed runs of each benchmark (default 5)" << endl;
+        exit ( -1 );
+    }
+
+    string inpath ( argv[1] );
+    string outpath ( argc > 2 ? argv[2] : "-" );
+    gFilter = argc > 3 ? argv[3] : "";
+    gRuns = argc > 4 ? max ( 1, atoi ( argv[4] ) ) : gRuns;
+
+    SSObjectVec solsys, stars;
+    SSImportObjectsFromCSV ( inpath + "/SolarSystem/Planets.csv", solsys );
+    SSImportObjectsFromCSV ( inpath + "/SolarSystem/Moons.csv", solsys );
+    SSImportObjectsFromCSV ( inpath + "/Stars/Brightest.csv", stars );
+    if ( solsys.size() < 11 || stars.size() < 1 )
+    {
+        cout << "Failed to import solar system objects and stars from " << inpath << endl;
+        exit ( -1 );
+    }
+
+    BenchSeries ( solsys );
+    BenchJPLDE ( inpath );
+    BenchSatellites ( inpath );
+    BenchCoordinates();
+    BenchView();
+    BenchHTM ( stars );
+    BenchHTMRegions ( stars );
+    BenchImport ( inpath );
+    BenchEvents ( solsys );
+    BenchEphemerisPolicy ( inpath );
+
+    if ( outpath == "-" )
+    {
+        WriteJSON ( cout );
+    }
+    else
+    {
+        ofstream outfile ( outpath );
+        if ( ! outfile )
+        {
+            cout << "Failed to open " << outpath << endl;
+            exit ( -1 );
+        }
+        WriteJSON ( outfile );
+    }
+
+    return 0;
+}
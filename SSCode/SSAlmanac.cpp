@@ -0,0 +1,398 @@
+// SSAlmanac.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "SSAlmanac.hpp"
+
+#if USE_THREADS
+#include <thread>
+#endif
+
+static const char kMagic[8] = "SSALMN1";
+
+#pragma pack(push, 1)
+
+struct SSAlmanacHeader
+{
+    char magic[8];          // "SSALMN1" plus terminating zero
+    int32_t nlocations;     // number of locations
+    int32_t reserved;       // always zero
+    double jd0, jd1;        // start and stop Julian Dates
+};
+
+#pragma pack(pop)
+
+// Sun and Moon positions sampled at regular times (t0 + k * step), and interpolated between them
+// with 4-point Lagrange polynomials. Positions are geocentric in the equatorial frame of date, in AU.
+// Moon elongation and Sun ecliptic longitude are unwrapped, so they increase continuously.
+
+struct almanac_samples
+{
+    double t0, step;
+    vector<SSVector> sun, moon;
+    vector<double> elong, sunlon;
+
+    // Gets index of first of 4 samples around time (t), and Lagrange weights for those samples.
+
+    size_t weights ( double t, double w[4] ) const
+    {
+        double u = ( t - t0 ) / step;
+        double i = ::min ( ::max ( floor ( u ) - 1.0, 0.0 ), (double) sun.size() - 4.0 );
+        double p = u - i;
+
+        w[0] = -( p - 1.0 ) * ( p - 2.0 ) * ( p - 3.0 ) / 6.0;
+        w[1] = p * ( p - 2.0 ) * ( p - 3.0 ) / 2.0;
+        w[2] = -p * ( p - 1.0 ) * ( p - 3.0 ) / 2.0;
+        w[3] = p * ( p - 1.0 ) * ( p - 2.0 ) / 6.0;
+        return (size_t) i;
+    }
+
+    template<class T> T interpolate ( const vector<T> &values, double t ) const
+    {
+        double w[4];
+        size_t i = weights ( t, w );
+        T v0 = values[i], v1 = values[i + 1], v2 = values[i + 2], v3 = values[i + 3];
+        return v0 * w[0] + v1 * w[1] + v2 * w[2] + v3 * w[3];
+    }
+};
+
+// Finds times where an unwrapped angle sampled in (values) crosses multiples of a right angle between (jd0) and (jd1);
+// adds them to series (series) of event types (type0 + multiple mod 4). Crossings are found by bisection of the
+// interpolated angle, which changes monotonically between samples.
+
+static void find_quadrants ( const almanac_samples &samples, const vector<double> &values, double jd0, double jd1, int type0, vector<vector<double>> &series )
+{
+    for ( size_t k = 0; k + 1 < values.size(); k++ )
+    {
+        double q0 = floor ( values[k] / SSAngle::kHalfPi ), q1 = floor ( values[k + 1] / SSAngle::kHalfPi );
+        for ( double q = q0 + 1.0; q <= q1; q++ )
+        {
+            double target = q * SSAngle::kHalfPi;
+            double a = samples.t0 + k * samples.step, b = a + samples.step;
+            for ( int i = 0; i < 40; i++ )
+            {
+                double c = ( a + b ) / 2.0;
+                if ( samples.interpolate ( values, c ) < target )
+                    a = c;
+                else
+                    b = c;
+            }
+
+            double t = ( a + b ) / 2.0;
+            if ( t >= jd0 && t <= jd1 )
+                series[ type0 + ( (int) fmod ( q, 4.0 ) + 4 ) % 4 ].push_back ( t );
+        }
+    }
+}
+
+SSAlmanac::SSAlmanac ( void )
+{
+    clear();
+}
+
+void SSAlmanac::clear ( void )
+{
+    _jd0 = _jd1 = 0.0;
+    _locations.clear();
+    _series.assign ( kNumGlobalEvents + 1, 0 );
+    _times.clear();
+}
+
+int SSAlmanac::seriesIndex ( EventType type, int location )
+{
+    if ( type >= 0 && type < kNumGlobalEvents )
+        return type;
+
+    if ( type < kNumGlobalEvents + kNumLocalEvents && location >= 0 && location < _locations.size() )
+        return kNumGlobalEvents + location * kNumLocalEvents + type - kNumGlobalEvents;
+
+    return -1;
+}
+
+size_t SSAlmanac::build ( SSObjectPtr pSun, SSObjectPtr pMoon, SSTime start, SSTime stop, const vector<SSSpherical> &locations, int threads )
+{
+    clear();
+    if ( pSun == nullptr || pMoon == nullptr || ! ( stop.jd > start.jd ) )
+        return 0;
+
+    _jd0 = start.jd;
+    _jd1 = stop.jd;
+    _locations = locations;
+
+    // Sample Sun and Moon from a geocentric perspective, with a margin of two days at each end,
+    // so the searches for events on the first and last local days stay within the samples.
+    // Clones are used so the caller's objects are not modified.
+
+    almanac_samples samples;
+    samples.t0 = _jd0 - 2.0;
+    samples.step = kSampleStep;
+    size_t nsamples = (size_t) ceil ( ( _jd1 + 2.0 - samples.t0 ) / samples.step ) + 1;
+
+    SSObjectPtr pSunCopy = SSCloneObject ( pSun ), pMoonCopy = SSCloneObject ( pMoon );
+    SSCoordinates coords ( SSTime ( samples.t0 ), SSSpherical ( 0.0, 0.0, -SSCoordinates::kKmPerEarthRadii ) );
+
+    double lastElong = 0.0, lastLon = 0.0;
+    for ( size_t k = 0; k < nsamples; k++ )
+    {
+        coords.setTime ( SSTime ( samples.t0 + k * samples.step ) );
+        pSunCopy->computeEphemeris ( coords );
+        pMoonCopy->computeEphemeris ( coords );
+
+        SSVector sun = pSunCopy->getDirection(), moon = pMoonCopy->getDirection();
+        samples.sun.push_back ( coords.transform ( kFundamental, kEquatorial, sun ) * pSunCopy->getDistance() );
+        samples.moon.push_back ( coords.transform ( kFundamental, kEquatorial, moon ) * pMoonCopy->getDistance() );
+
+        double sunlon = SSSpherical ( coords.transform ( kFundamental, kEcliptic, sun ) ).lon;
+        double elong = mod2pi ( SSSpherical ( coords.transform ( kFundamental, kEcliptic, moon ) ).lon - sunlon );
+        samples.sunlon.push_back ( k == 0 ? sunlon : samples.sunlon.back() + modpi ( sunlon - lastLon ) );
+        samples.elong.push_back ( k == 0 ? elong : samples.elong.back() + modpi ( elong - lastElong ) );
+        lastLon = sunlon;
+        lastElong = elong;
+    }
+
+    delete pSunCopy;
+    delete pMoonCopy;
+
+    size_t nlocs = _locations.size();
+    vector<vector<double>> series ( kNumGlobalEvents + nlocs * kNumLocalEvents );
+    find_quadrants ( samples, samples.elong, _jd0, _jd1, kNewMoon, series );
+    find_quadrants ( samples, samples.sunlon, _jd0, _jd1, kMarchEquinox, series );
+
+    // Local events: body (0 = Sun, 1 = Moon), sign (rise or set), and horizon altitude, in event type order.
+
+    struct LocalEvent { int body; int sign; double alt; };
+    static const LocalEvent localEvents[kNumLocalEvents] =
+    {
+        { 0, SSEvent::kRise, SSEvent::kSunMoonRiseSetAlt },
+        { 0, SSEvent::kSet, SSEvent::kSunMoonRiseSetAlt },
+        { 1, SSEvent::kRise, SSEvent::kSunMoonRiseSetAlt },
+        { 1, SSEvent::kSet, SSEvent::kSunMoonRiseSetAlt },
+        { 0, SSEvent::kRise, SSEvent::kSunCivilDawnDuskAlt },
+        { 0, SSEvent::kSet, SSEvent::kSunCivilDawnDuskAlt },
+        { 0, SSEvent::kRise, SSEvent::kSunNauticalDawnDuskAlt },
+        { 0, SSEvent::kSet, SSEvent::kSunNauticalDawnDuskAlt },
+        { 0, SSEvent::kRise, SSEvent::kSunAstronomicalDawnDuskAlt },
+        { 0, SSEvent::kSet, SSEvent::kSunAstronomicalDawnDuskAlt },
+    };
+
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+#endif
+    threads = (int) min ( (size_t) max ( threads, 1 ), max ( nlocs, (size_t) 1 ) );
+
+    auto work = [&] ( int t )
+    {
+        for ( size_t j = t; j < nlocs; j += threads )
+        {
+            SSSpherical loc = _locations[j];
+
+            // Topocentric equatorial coordinates of a body at a time: its interpolated geocentric position,
+            // minus the observer's geocentric position at that time's sidereal time.
+
+            auto radec = [&] ( int body, double jd, SSAngle &ra, SSAngle &dec )
+            {
+                SSVector pos = samples.interpolate ( body ? samples.moon : samples.sun, jd );
+                SSSpherical geo ( SSTime ( jd ).getSiderealTime ( loc.lon ), loc.lat, loc.rad );
+                SSSpherical topo ( pos - SSCoordinates::toGeocentricPosition ( geo, SSCoordinates::kKmPerEarthRadii, SSCoordinates::kEarthFlattening ) / SSCoordinates::kKmPerAU );
+                ra = topo.lon;
+                dec = topo.lat;
+            };
+
+            // Same iteration as SSEvent::riseTransitSetSearch(), with interpolated positions.
+
+            auto search = [&] ( const LocalEvent &event, double time )
+            {
+                SSAngle ra, dec;
+                double lasttime = time;
+                int i = 0;
+                do
+                {
+                    lasttime = time;
+                    radec ( event.body, time, ra, dec );
+                    time = SSEvent::riseTransitSet ( SSTime ( time ), ra, dec, event.sign, loc.lon, loc.lat, event.alt ).jd;
+                    i++;
+                }
+                while ( fabs ( time - lasttime ) > 1.0 / SSTime::kSecondsPerDay && ! ::isinf ( time ) && i < 10 );
+                return time;
+            };
+
+            // Local mean solar days, as in SSEvent::riseTransitSetSearchDay().
+
+            double zone = loc.lon * SSAngle::kHourPerRad;
+            for ( double day = SSTime ( _jd0, zone ).getLocalMidnight().jd; day <= _jd1; day += 1.0 )
+            {
+                for ( int e = 0; e < kNumLocalEvents; e++ )
+                {
+                    double time = search ( localEvents[e], day + 0.5 );
+                    if ( time > day + 1.0 )
+                        time = search ( localEvents[e], day - 0.5 );
+                    else if ( time < day )
+                        time = search ( localEvents[e], day + 1.5 );
+
+                    if ( time >= day && time <= day + 1.0 && time >= _jd0 && time <= _jd1 )
+                        series[ kNumGlobalEvents + j * kNumLocalEvents + e ].push_back ( time );
+                }
+            }
+        }
+    };
+
+#if USE_THREADS
+    vector<thread> workers;
+    for ( int t = 1; t < threads; t++ )
+        workers.push_back ( thread ( work, t ) );
+
+    work ( 0 );
+
+    for ( thread &worker : workers )
+        worker.join();
+#else
+    for ( int t = 0; t < threads; t++ )
+        work ( t );
+#endif
+
+    // Pack series into one array. A local event exactly at midnight can be found on both days; keep one.
+
+    _series.clear();
+    for ( vector<double> &times : series )
+    {
+        sort ( times.begin(), times.end() );
+        times.erase ( unique ( times.begin(), times.end() ), times.end() );
+        _series.push_back ( _times.size() );
+        _times.insert ( _times.end(), times.begin(), times.end() );
+    }
+    _series.push_back ( _times.size() );
+
+    return _times.size();
+}
+
+SSTime SSAlmanac::next ( EventType type, int location, SSTime time )
+{
+    int s = seriesIndex ( type, location );
+    if ( s < 0 )
+        return SSTime ( INFINITY );
+
+    auto end = _times.begin() + _series[s + 1];
+    auto it = upper_bound ( _times.begin() + _series[s], end, time.jd );
+    return SSTime ( it == end ? INFINITY : *it );
+}
+
+SSTime SSAlmanac::previous ( EventType type, int location, SSTime time )
+{
+    int s = seriesIndex ( type, location );
+    if ( s < 0 )
+        return SSTime ( -INFINITY );
+
+    auto begin = _times.begin() + _series[s];
+    auto it = lower_bound ( begin, _times.begin() + _series[s + 1], time.jd );
+    return SSTime ( it == begin ? -INFINITY : *( it - 1 ) );
+}
+
+int SSAlmanac::find ( int location, SSTime start, SSTime stop, vector<Entry> &events )
+{
+    events.clear();
+    for ( int type = 0; type < kNumGlobalEvents + kNumLocalEvents; type++ )
+    {
+        int s = seriesIndex ( (EventType) type, location );
+        if ( s < 0 )
+            continue;
+
+        auto end = _times.begin() + _series[s + 1];
+        for ( auto it = lower_bound ( _times.begin() + _series[s], end, start.jd ); it != end && *it <= stop.jd; it++ )
+        {
+            Entry entry = { SSTime ( *it ), (EventType) type, type < kNumGlobalEvents ? -1 : location };
+            events.push_back ( entry );
+        }
+    }
+
+    stable_sort ( events.begin(), events.end(), [] ( const Entry &e1, const Entry &e2 ) { return e1.time.jd < e2.time.jd; } );
+    return (int) events.size();
+}
+
+// Writes almanac table to a binary file (filename); see header file for layout. Returns true if successful.
+
+bool SSAlmanac::save ( const string &filename )
+{
+    ofstream file ( filename, ios::binary | ios::trunc );
+    if ( ! file )
+        return false;
+
+    SSAlmanacHeader header = { { 0 }, (int32_t) _locations.size(), 0, _jd0, _jd1 };
+    memcpy ( header.magic, kMagic, sizeof ( kMagic ) );
+    file.write ( (const char *) &header, sizeof ( header ) );
+
+    for ( SSSpherical &loc : _locations )
+    {
+        double values[3] = { loc.lon, loc.lat, loc.rad };
+        file.write ( (const char *) values, sizeof ( values ) );
+    }
+
+    file.write ( (const char *) &_series[0], _series.size() * sizeof ( int64_t ) );
+    if ( _times.size() > 0 )
+        file.write ( (const char *) &_times[0], _times.size() * sizeof ( double ) );
+
+    return file.good();
+}
+
+// Reads almanac table from a binary file (filename), replacing the current table.
+// Returns true if successful, or false if the file can't be read or is not valid, leaving the table empty.
+
+bool SSAlmanac::open ( const string &filename )
+{
+    clear();
+
+    ifstream file ( filename, ios::binary | ios::ate );
+    if ( ! file )
+        return false;
+
+    int64_t size = file.tellg();
+    file.seekg ( 0 );
+
+    SSAlmanacHeader header;
+    if ( size < sizeof ( header ) || ! file.read ( (char *) &header, sizeof ( header ) ) )
+        return false;
+
+    if ( memcmp ( header.magic, kMagic, sizeof ( kMagic ) ) != 0 || header.nlocations < 0 )
+        return false;
+
+    // Validate sizes of location and series tables before reading them, then series offsets before reading times.
+
+    int64_t nseries = kNumGlobalEvents + (int64_t) header.nlocations * kNumLocalEvents;
+    int64_t offset = sizeof ( header ) + header.nlocations * 3 * sizeof ( double ) + ( nseries + 1 ) * sizeof ( int64_t );
+    if ( offset > size )
+        return false;
+
+    vector<SSSpherical> locations ( header.nlocations );
+    for ( SSSpherical &loc : locations )
+    {
+        double values[3] = { 0.0 };
+        file.read ( (char *) values, sizeof ( values ) );
+        loc = SSSpherical ( values[0], values[1], values[2] );
+    }
+
+    vector<int64_t> series ( nseries + 1 );
+    file.read ( (char *) &series[0], series.size() * sizeof ( int64_t ) );
+    if ( ! file || series[0] != 0 || offset + series[nseries] * (int64_t) sizeof ( double ) != size )
+        return false;
+
+    for ( int64_t s = 0; s < nseries; s++ )
+        if ( series[s + 1] < series[s] )
+            return false;
+
+    vector<double> times ( series[nseries] );
+    if ( times.size() > 0 && ! file.read ( (char *) &times[0], times.size() * sizeof ( double ) ) )
+        return false;
+
+    _jd0 = header.jd0;
+    _jd1 = header.jd1;
+    _locations.swap ( locations );
+    _series.swap ( series );
+    _times.swap ( times );
+    return true;
+}
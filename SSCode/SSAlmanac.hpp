@@ -0,0 +1,117 @@
+// SSAlmanac.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class precomputes a table of calendar events - moon phases, equinoxes and solstices, and Sun and Moon
+// rise, set, and twilight times at any number of locations - over a range of time, in one sweep.
+// The Sun and Moon's ephemerides are computed once, at regular sample times shared by every event and location;
+// each event is then found by interpolating those samples, instead of recomputing ephemerides iteratively as
+// SSEvent::nextMoonPhase() and SSEvent::riseTransitSetSearchDay() do. Each event type at each location is
+// stored as a sorted series of times, so the next or previous event of a type is found by binary search.
+// Tables can be saved to and read from a compact binary file, so they can be computed years ahead.
+//
+// File layout (all values in native byte order, which is little-endian on all supported platforms):
+//   Header: char magic[8] = "SSALMN1", int32 number of locations, int32 reserved, double start JD, double stop JD.
+//   Locations: for each, double longitude, latitude [radians], height [km].
+//   Series: int64 offset of first time in each series, plus total number of times at end.
+//   Times: Julian Dates (UT) of all events, double, sorted within each series.
+// Series are ordered with the global events (moon phases, equinoxes, solstices) first,
+// then the local events (kSunrise ... kAstronomicalDusk) of each location in turn.
+
+#ifndef SSAlmanac_hpp
+#define SSAlmanac_hpp
+
+#include "SSEvent.hpp"
+
+class SSAlmanac
+{
+public:
+
+    // Event types. Moon phases, equinoxes, and solstices are global; the others depend on location.
+
+    enum EventType
+    {
+        kNewMoon = 0,
+        kFirstQuarterMoon = 1,
+        kFullMoon = 2,
+        kLastQuarterMoon = 3,
+        kMarchEquinox = 4,
+        kJuneSolstice = 5,
+        kSeptemberEquinox = 6,
+        kDecemberSolstice = 7,
+        kSunrise = 8,
+        kSunset = 9,
+        kMoonrise = 10,
+        kMoonset = 11,
+        kCivilDawn = 12,
+        kCivilDusk = 13,
+        kNauticalDawn = 14,
+        kNauticalDusk = 15,
+        kAstronomicalDawn = 16,
+        kAstronomicalDusk = 17
+    };
+
+    static constexpr int kNumGlobalEvents = 8;      // number of global event types
+    static constexpr int kNumLocalEvents = 10;      // number of location-dependent event types
+    static constexpr double kSampleStep = 0.25;     // interval between Sun and Moon ephemeris samples, in days
+
+    // An event found by find(): its time (UT), type, and location index (-1 for global events).
+
+    struct Entry
+    {
+        SSTime time;
+        EventType type;
+        int location;
+    };
+
+protected:
+
+    double _jd0, _jd1;                  // start and stop Julian Dates of table
+    vector<SSSpherical> _locations;     // longitude, latitude [radians], height [km] of each location
+    vector<int64_t> _series;            // index of first time in each series in _times, plus size of _times at end
+    vector<double> _times;              // Julian Dates of events in all series, sorted within each series
+
+    int seriesIndex ( EventType type, int location );
+
+public:
+
+    SSAlmanac ( void );
+
+    // Computes all events from (start) to (stop) at geographic locations (locations: longitude, latitude in radians,
+    // height in km), using the Sun (pSun) and Moon (pMoon) objects, which are not modified. Rise, set, and twilight
+    // times are found for each local mean solar day, as SSEvent::riseTransitSetSearchDay() does. Locations are divided
+    // among threads (threads; if zero or negative, one per processor core). Replaces any events already in the table.
+    // Returns total number of events found.
+
+    size_t build ( SSObjectPtr pSun, SSObjectPtr pMoon, SSTime start, SSTime stop, const vector<SSSpherical> &locations, int threads = 1 );
+
+    // Writes table to a binary file, or reads a table from one, replacing the current table.
+    // Returns true if successful or false if the file can't be written or read or is not valid.
+
+    bool save ( const string &filename );
+    bool open ( const string &filename );
+    void clear ( void );
+
+    // Gets start and stop time, total number of events, and number and i-th geographic location of table.
+
+    SSTime getStart ( void ) { return SSTime ( _jd0 ); }
+    SSTime getStop ( void ) { return SSTime ( _jd1 ); }
+    size_t size ( void ) { return _times.size(); }
+    int numLocations ( void ) { return (int) _locations.size(); }
+    SSSpherical getLocation ( int i ) { return i >= 0 && i < _locations.size() ? _locations[i] : SSSpherical ( INFINITY, INFINITY, INFINITY ); }
+
+    // Returns the time of the first event of a type (type) at a location index (location; ignored for global events)
+    // after a time (time), or before it; returns +INFINITY or -INFINITY if there is none in the table.
+
+    SSTime next ( EventType type, int location, SSTime time );
+    SSTime previous ( EventType type, int location, SSTime time );
+
+    // Returns all events at a location (location), and global events, from (start) to (stop) in (events),
+    // in time order. Returns the number of events found.
+
+    int find ( int location, SSTime start, SSTime stop, vector<Entry> &events );
+};
+
+#endif /* SSAlmanac_hpp */
@@ -0,0 +1,137 @@
+// SSAsync.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <chrono>
+
+#include "SSAsync.hpp"
+#include "SSThreadPool.hpp"
+#include "SSPlanet.hpp"
+#include "SSJPLDEphemeris.hpp"
+
+bool SSTaskState::start ( void )
+{
+    int status = kQueued;
+    if ( _cancel )
+        return false;
+
+    return _status.compare_exchange_strong ( status, kRunning );
+}
+
+void SSTaskState::complete ( void )
+{
+    vector<function<void ( void )>> callbacks;
+    {
+#if USE_THREADS
+        lock_guard<mutex> lock ( _mutex );
+#endif
+        _status = _cancel ? kCancelled : kFinished;
+        callbacks.swap ( _callbacks );
+    }
+
+#if USE_THREADS
+    _completed.notify_all();
+#endif
+
+    for ( auto &callback : callbacks )
+        callback();
+}
+
+bool SSTaskState::wait ( double seconds )
+{
+#if USE_THREADS
+    unique_lock<mutex> lock ( _mutex );
+    if ( isinf ( seconds ) )
+        _completed.wait ( lock, [this] { return isComplete(); } );
+    else
+        _completed.wait_for ( lock, chrono::duration<double> ( max ( seconds, 0.0 ) ), [this] { return isComplete(); } );
+#endif
+    return isComplete();
+}
+
+void SSTaskState::onComplete ( function<void ( void )> callback )
+{
+    {
+#if USE_THREADS
+        lock_guard<mutex> lock ( _mutex );
+#endif
+        if ( ! isComplete() )
+        {
+            _callbacks.push_back ( callback );
+            return;
+        }
+    }
+
+    callback();
+}
+
+void SSTaskState::submit ( function<void ( void )> run )
+{
+    SSThreadPool::shared().submit ( run );
+}
+
+// Import filter used by SSImportAsync(): rejects objects once the task is cancelled, then applies the caller's filter,
+// and counts objects accepted.
+
+struct ImportFilter
+{
+    SSTaskState *pTask;
+    SSObjectFilter filter;
+    void *userData;
+};
+
+static bool importFilter ( SSObjectPtr pObject, void *userData )
+{
+    ImportFilter *pFilter = (ImportFilter *) userData;
+    if ( pFilter->pTask->isCancelled() )
+        return false;
+
+    if ( pFilter->filter != nullptr && ! pFilter->filter ( pObject, pFilter->userData ) )
+        return false;
+
+    pFilter->pTask->addProgress();
+    return true;
+}
+
+SSAsync<shared_ptr<SSObjectArray>> SSImportAsync ( SSImportFunc import, SSObjectFilter filter, void *userData, size_t expected )
+{
+    return SSRunAsync<shared_ptr<SSObjectArray>> ( [import, filter, userData, expected] ( SSTaskState &task )
+    {
+        shared_ptr<SSObjectArray> objects ( new SSObjectArray() );
+        ImportFilter importer = { &task, filter, userData };
+        task.setProgress ( 0, expected );
+        import ( *objects, importFilter, &importer );
+        return objects;
+    } );
+}
+
+SSAsync<shared_ptr<SSObjectArray>> SSImportObjectsFromCSVAsync ( const string &filename, SSObjectFilter filter, void *userData, int threads )
+{
+    return SSImportAsync ( [filename, threads] ( SSObjectVec &objects, SSObjectFilter filter, void *userData )
+    {
+        return SSImportObjectsFromCSV ( filename, objects, filter, userData, threads );
+    }, filter, userData );
+}
+
+SSAsync<shared_ptr<SSObjectArray>> SSImportSatellitesFromTLEAsync ( const string &path )
+{
+    return SSRunAsync<shared_ptr<SSObjectArray>> ( [path] ( SSTaskState &task )
+    {
+        shared_ptr<SSObjectArray> objects ( new SSObjectArray() );
+        int n = SSImportSatellitesFromTLE ( path, *objects );
+        task.setProgress ( n, n );
+        return objects;
+    } );
+}
+
+SSAsync<bool> SSOpenJPLDEphemerisAsync ( const string &filename, bool add, int priority )
+{
+    return SSRunAsync<bool> ( [filename, add, priority] ( SSTaskState &task )
+    {
+        bool ok = add ? SSJPLDEphemeris::add ( filename, priority ) : SSJPLDEphemeris::open ( filename );
+        task.setProgress ( 1, 1 );
+        return ok;
+    } );
+}
@@ -0,0 +1,177 @@
+// SSAsync.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// Runs long operations - catalog imports, HTM region loads, opening JPL ephemeris files - as tasks on the shared thread
+// pool (see SSThreadPool), so an app can start up and stay responsive while they run. Each returns a handle, SSAsync<T>,
+// with which the caller can poll or wait for the task's result, follow its progress, cancel it, and add callbacks which
+// are called when it completes. Cancellation is cooperative: a task cancelled before it starts never runs; a running
+// task stops at its next check of isCancelled() - imports after each object, region loads after each region - and
+// returns what it has done so far; operations which make no checks (e.g. opening a JPL ephemeris) run to completion.
+// Completion callbacks run on the thread which completes the task, usually a pool worker, or at once on the thread
+// adding them if the task is already complete; so they must be thread-safe, e.g. post a message to an app's UI thread.
+// A task's result must not be used until it is complete. Without threads (USE_THREADS is zero), or if the shared pool
+// has only one thread, tasks run to completion on the calling thread before their handles are returned.
+
+#ifndef SSAsync_hpp
+#define SSAsync_hpp
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "SSObject.hpp"
+
+#if USE_THREADS
+#include <condition_variable>
+#include <mutex>
+#endif
+
+// A task's state, shared by the task's handles and the thread running it. The task's work function receives it,
+// so it can report progress, and check whether it has been cancelled.
+
+class SSTaskState
+{
+public:
+
+    enum Status
+    {
+        kQueued = 0,            // waiting for a pool thread
+        kRunning = 1,           // work function running
+        kFinished = 2,          // work function returned
+        kCancelled = 3          // cancelled before it started, or before its work function returned
+    };
+
+protected:
+
+    atomic<int> _status;                    // task status, as above
+    atomic<bool> _cancel;                   // true if cancellation was requested
+    atomic<size_t> _done, _total;           // progress: units of work done, of total; total is zero if unknown
+    vector<function<void ( void )>> _callbacks; // called once when task completes; protected by mutex
+#if USE_THREADS
+    mutex _mutex;                           // protects _callbacks and completion
+    condition_variable _completed;          // signaled when task completes
+#endif
+
+public:
+
+    SSTaskState ( void ) : _status ( kQueued ), _cancel ( false ), _done ( 0 ), _total ( 0 ) {}
+    SSTaskState ( const SSTaskState &other ) = delete;
+    SSTaskState &operator = ( const SSTaskState &other ) = delete;
+    virtual ~SSTaskState ( void ) {}
+
+    // Called by the work function: reports (done) units of work done, of (total), or zero if unknown;
+    // or adds (n) units to the work done. isCancelled() returns true once the task should stop.
+
+    void setProgress ( size_t done, size_t total ) { _total = total; _done = done; }
+    void addProgress ( size_t n = 1 ) { _done += n; }
+    bool isCancelled ( void ) { return _cancel; }
+
+    // Called by anyone: gets status and progress; fraction of work done is zero if total is unknown.
+
+    Status getStatus ( void ) { return (Status) _status.load(); }
+    bool isComplete ( void ) { return _status >= kFinished; }
+    size_t getDone ( void ) { return _done; }
+    size_t getTotal ( void ) { return _total; }
+    double getFraction ( void ) { size_t total = _total; return total ? min ( 1.0, (double) _done / total ) : 0.0; }
+
+    // Requests cancellation; returns immediately. Waits up to (seconds) for the task to complete, forever if infinite;
+    // returns true if it has completed. Adds a callback called once when the task completes, at once if it has.
+
+    void cancel ( void ) { _cancel = true; }
+    bool wait ( double seconds = INFINITY );
+    void onComplete ( function<void ( void )> callback );
+
+    // Used by SSRunAsync(): marks the task running, unless it was cancelled first; then marks it complete,
+    // waking waiting threads, and calls completion callbacks. submit() runs a function on the shared thread pool.
+
+    bool start ( void );
+    void complete ( void );
+    static void submit ( function<void ( void )> run );
+};
+
+// A handle to an asynchronous task whose result has type T. Handles can be copied; copies refer to the same task.
+
+template<class T> class SSAsync
+{
+public:
+
+    struct State : public SSTaskState
+    {
+        T result = T();                     // work function's result; valid when complete
+    };
+
+protected:
+
+    shared_ptr<State> _state;
+
+public:
+
+    SSAsync ( void ) {}
+    SSAsync ( shared_ptr<State> state ) : _state ( state ) {}
+
+    bool valid ( void ) { return _state != nullptr; }
+    SSTaskState::Status getStatus ( void ) { return _state->getStatus(); }
+    bool isComplete ( void ) { return _state->isComplete(); }
+    size_t getDone ( void ) { return _state->getDone(); }
+    size_t getTotal ( void ) { return _state->getTotal(); }
+    double getFraction ( void ) { return _state->getFraction(); }
+    void cancel ( void ) { _state->cancel(); }
+    bool wait ( double seconds = INFINITY ) { return _state->wait ( seconds ); }
+
+    // Waits for the task to complete, then returns its result.
+
+    T &get ( void ) { _state->wait(); return _state->result; }
+
+    // Adds a callback (callback) called with this task's handle when it completes.
+
+    void onComplete ( function<void ( SSAsync<T> &task )> callback )
+    {
+        shared_ptr<State> state = _state;
+        _state->onComplete ( [state, callback] ( void ) { SSAsync<T> task ( state ); callback ( task ); } );
+    }
+};
+
+// Runs a work function (work) on the shared thread pool, and returns a handle to its result. The work function
+// receives the task's state, with which it can report progress and check for cancellation.
+
+template<class T> SSAsync<T> SSRunAsync ( function<T ( SSTaskState &task )> work )
+{
+    shared_ptr<typename SSAsync<T>::State> state ( new typename SSAsync<T>::State() );
+    SSTaskState::submit ( [state, work] ( void )
+    {
+        if ( state->start() )
+            state->result = work ( *state );
+        state->complete();
+    } );
+
+    return SSAsync<T> ( state );
+}
+
+// An import function, which appends objects passing a filter (filter) to (objects), e.g. a lambda calling
+// SSImportObjectsFromCSV() or SSImportHIP() with its other arguments bound, and returns the number imported.
+
+typedef function<int ( SSObjectVec &objects, SSObjectFilter filter, void *userData )> SSImportFunc;
+
+// Runs an import function (import) asynchronously into a new object array, which the result holds when complete; the
+// caller may then splice() it into its own. Progress counts objects imported, of (expected) if known, else zero.
+// Objects must pass an optional filter (filter), called with (userData) as the import function would call it, which
+// must be thread-safe if the import uses several threads. When cancelled, the import stops accepting objects.
+
+SSAsync<shared_ptr<SSObjectArray>> SSImportAsync ( SSImportFunc import, SSObjectFilter filter = nullptr, void *userData = nullptr, size_t expected = 0 );
+
+// Asynchronous versions of SSImportObjectsFromCSV() and SSImportSatellitesFromTLE(), as above.
+// The TLE import makes no progress reports, and can't be cancelled once started.
+
+SSAsync<shared_ptr<SSObjectArray>> SSImportObjectsFromCSVAsync ( const string &filename, SSObjectFilter filter = nullptr, void *userData = nullptr, int threads = 1 );
+SSAsync<shared_ptr<SSObjectArray>> SSImportSatellitesFromTLEAsync ( const string &path );
+
+// Opens a JPL ephemeris file asynchronously, as SSJPLDEphemeris::open() does, after closing any others if (add) is false,
+// or adding it to them with priority (priority) if true; result is true if successful.
+
+SSAsync<bool> SSOpenJPLDEphemerisAsync ( const string &filename, bool add = false, int priority = 0 );
+
+#endif /* SSAsync_hpp */
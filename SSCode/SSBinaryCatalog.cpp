@@ -0,0 +1,611 @@
+// SSBinaryCatalog.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <string.h>
+
+#include "SSBinaryCatalog.hpp"
+#include "SSPlanet.hpp"
+#include "SSStar.hpp"
+#include "SSFeature.hpp"
+#include "SSConstellation.hpp"
+
+// Numeric values, strings, and identifiers for one object, in the order they are stored in a binary catalog.
+
+struct SSBinaryObject
+{
+    vector<double> values;
+    vector<string> strings;
+    vector<int64_t> idents;
+};
+
+static void pack_orbit ( const SSOrbit &orbit, vector<double> &values )
+{
+    values.insert ( values.end(), { orbit.t, orbit.q, orbit.e, orbit.i, orbit.w, orbit.n, orbit.m, orbit.mm } );
+}
+
+static SSOrbit unpack_orbit ( const double *v )
+{
+    SSOrbit orbit;
+
+    orbit.t = v[0];
+    orbit.q = v[1];
+    orbit.e = v[2];
+    orbit.i = v[3];
+    orbit.w = v[4];
+    orbit.n = v[5];
+    orbit.m = v[6];
+    orbit.mm = v[7];
+
+    return orbit;
+}
+
+// Stores an object's type-specific data (pObject) in (data), after its names and description.
+// Numeric layouts for each object type are:
+// planets, moons, asteroids, comets: orbit (8), H, G, B-V, radius, mass, rotation period, albedo; taxonomy string.
+// stars: position (3), velocity (3), parallax, radial velocity, V, B; spectrum string. Then, for double stars:
+// magnitude delta, separation, position angle and year, orbit flag, orbit (8); component string. For variable stars:
+// maximum and minimum magnitude, period, epoch; variability type string. For deep sky objects: major and minor axis,
+// position angle. Features: diameter, latitude, longitude; target, feature type, and origin strings. Cities add
+// elevation, population, daylight saving, time zone offset; country, admin1 code and name, time zone name strings.
+// Constellations: direction (3), area, rank, boundary vertex count, vertices (3 each), figure count, figure stars.
+// Returns false if the object's type cannot be stored.
+
+static bool pack_object ( SSObjectPtr pObject, SSBinaryObject &data )
+{
+    SSObjectType type = pObject->getType();
+    vector<double> &v = data.values;
+
+    if ( type >= kTypePlanet && type <= kTypeComet )
+    {
+        SSPlanetPtr pPlanet = SSGetPlanetPtr ( pObject );
+        if ( pPlanet == nullptr )
+            return false;
+
+        pack_orbit ( pPlanet->getOrbit(), v );
+        v.insert ( v.end(), { pPlanet->getHMagnitude(), pPlanet->getGMagnitude(), pPlanet->getColorIndex(), pPlanet->getRadius(),
+            pPlanet->getMass(), pPlanet->getRotationPeriod(), pPlanet->getAlbedo() } );
+        data.strings.push_back ( pPlanet->getTaxonomy() );
+        data.idents.push_back ( pPlanet->getIdentifier() );
+        return true;
+    }
+
+    if ( type == kTypeFeature || type == kTypeCity )
+    {
+        SSFeaturePtr pFeature = SSGetFeaturePtr ( pObject );
+        if ( pFeature == nullptr )
+            return false;
+
+        v.insert ( v.end(), { pFeature->getDiameter(), pFeature->getLatitude(), pFeature->getLongitude() } );
+        data.strings.insert ( data.strings.end(), { pFeature->getTarget(), pFeature->getFeatureTypeCode(), pFeature->getOrigin() } );
+
+        SSCityPtr pCity = SSGetCityPtr ( pObject );
+        if ( pCity != nullptr )
+        {
+            v.insert ( v.end(), { pCity->getElevation(), (double) pCity->getPopulation(), (double) pCity->getDaylightSaving(), pCity->getTimezoneRawOffset() } );
+            data.strings.insert ( data.strings.end(), { pCity->getCountryCode(), pCity->getAdmin1Code(), pCity->getAdmin1Name(), pCity->getTimezoneName() } );
+        }
+
+        return true;
+    }
+
+    if ( type == kTypeNonexistent || ( type >= kTypeStar && type <= kTypeGalaxy ) )
+    {
+        SSStarPtr pStar = SSGetStarPtr ( pObject );
+        if ( pStar == nullptr )
+            return false;
+
+        SSVector pos = pStar->getFundamentalPosition(), vel = pStar->getFundamentalVelocity();
+        v.insert ( v.end(), { pos.x, pos.y, pos.z, vel.x, vel.y, vel.z, pStar->getParallax(), pStar->getRadVel(), pStar->getVMagnitude(), pStar->getBMagnitude() } );
+        data.strings.push_back ( pStar->getSpectralType() );
+        for ( SSIdentifier ident : pStar->getIdentifierSpan() )
+            data.idents.push_back ( ident );
+
+        SSDoubleStarPtr pDouble = SSGetDoubleStarPtr ( pObject );
+        if ( pDouble != nullptr )
+        {
+            v.insert ( v.end(), { pDouble->getMagnitudeDelta(), pDouble->getSeparation(), pDouble->getPositionAngle(), pDouble->getPositionAngleYear(), (double) pDouble->hasOrbit() } );
+            pack_orbit ( pDouble->getOrbit(), v );
+            data.strings.push_back ( pDouble->getComponents() );
+        }
+
+        SSVariableStarPtr pVariable = SSGetVariableStarPtr ( pObject );
+        if ( pVariable != nullptr )
+        {
+            v.insert ( v.end(), { pVariable->getMaximumMagnitude(), pVariable->getMinimumMagnitude(), pVariable->getPeriod(), pVariable->getEpoch() } );
+            data.strings.push_back ( pVariable->getVariableType() );
+        }
+
+        SSDeepSkyPtr pDeepSky = SSGetDeepSkyPtr ( pObject );
+        if ( pDeepSky != nullptr )
+            v.insert ( v.end(), { pDeepSky->getMajorAxis(), pDeepSky->getMinorAxis(), pDeepSky->getPositionAngle() } );
+
+        return true;
+    }
+
+    if ( type == kTypeConstellation || type == kTypeAsterism )
+    {
+        SSConstellationPtr pCon = SSGetConstellationPtr ( pObject );
+        if ( pCon == nullptr )
+            return false;
+
+        SSVector dir = pCon->getDirection();
+        const vector<SSVector> &bounds = pCon->getBoundary();
+        const vector<int> &figure = pCon->getFigure();
+
+        v.insert ( v.end(), { dir.x, dir.y, dir.z, pCon->getArea(), (double) pCon->getRank(), (double) bounds.size() } );
+        for ( const SSVector &vertex : bounds )
+            v.insert ( v.end(), { vertex.x, vertex.y, vertex.z } );
+
+        v.push_back ( figure.size() );
+        v.insert ( v.end(), figure.begin(), figure.end() );
+        return true;
+    }
+
+    return false;
+}
+
+// Creates a new object of a given type from numeric values (v), strings (s), and identifiers (ids) stored by pack_object().
+// The first (nv), (ns), and (ni) of them are valid. Names and description have already been removed from the strings.
+// Returns nullptr if there are too few values or strings for the object's type.
+
+static SSObjectPtr unpack_object ( SSObjectType type, const double *v, size_t nv, const char *const *s, size_t ns, const int64_t *ids, size_t ni )
+{
+    SSObjectPtr pObject = SSNewObject ( type );
+    if ( pObject == nullptr )
+        return nullptr;
+
+    size_t iv = 0, is = 0;
+    bool valid = true;
+    auto need = [&] ( size_t values, size_t strings )
+    {
+        valid = valid && iv + values <= nv && is + strings <= ns;
+        return valid;
+    };
+
+    if ( type >= kTypePlanet && type <= kTypeComet )
+    {
+        SSPlanetPtr pPlanet = SSGetPlanetPtr ( pObject );
+        if ( pPlanet != nullptr && need ( 15, 1 ) && ni > 0 )
+        {
+            pPlanet->setOrbit ( unpack_orbit ( v ) );
+            pPlanet->setHMagnitude ( v[8] );
+            pPlanet->setGMagnitude ( v[9] );
+            pPlanet->setColorIndex ( v[10] );
+            pPlanet->setRadius ( v[11] );
+            pPlanet->setMass ( v[12] );
+            pPlanet->setRotationPeriod ( v[13] );
+            pPlanet->setAlbedo ( v[14] );
+            pPlanet->setTaxonomy ( s[0] );
+            pPlanet->setIdentifier ( SSIdentifier ( ids[0] ) );
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+    else if ( type == kTypeFeature || type == kTypeCity )
+    {
+        SSFeaturePtr pFeature = SSGetFeaturePtr ( pObject );
+        if ( pFeature != nullptr && need ( 3, 3 ) )
+        {
+            pFeature->setDiameter ( v[0] );
+            pFeature->setLatitude ( v[1] );
+            pFeature->setLongitude ( v[2] );
+            pFeature->setTarget ( s[0] );
+            pFeature->setFeatureTypeCode ( s[1] );
+            pFeature->setOrigin ( s[2] );
+            iv = 3;
+            is = 3;
+        }
+
+        SSCityPtr pCity = SSGetCityPtr ( pObject );
+        if ( pCity != nullptr && need ( 4, 4 ) )
+        {
+            pCity->setElevation ( v[iv] );
+            pCity->setPopulation ( v[iv + 1] );
+            pCity->setDaylightSaving ( v[iv + 2] != 0.0 );
+            pCity->setTimezoneRawOffset ( v[iv + 3] );
+            pCity->setCountryCode ( s[is] );
+            pCity->setAdmin1Code ( s[is + 1] );
+            pCity->setAdmin1Name ( s[is + 2] );
+            pCity->setTimezoneName ( s[is + 3] );
+        }
+    }
+    else if ( type == kTypeNonexistent || ( type >= kTypeStar && type <= kTypeGalaxy ) )
+    {
+        SSStarPtr pStar = SSGetStarPtr ( pObject );
+        if ( pStar != nullptr && need ( 10, 1 ) )
+        {
+            pStar->setFundamentalPosition ( SSVector ( v[0], v[1], v[2] ) );
+            pStar->setFundamentalVelocity ( SSVector ( v[3], v[4], v[5] ) );
+            pStar->setParallax ( v[6] );
+            pStar->setRadVel ( v[7] );
+            pStar->setVMagnitude ( v[8] );
+            pStar->setBMagnitude ( v[9] );
+            pStar->setSpectralType ( s[0] );
+            pStar->setIdentifiers ( vector<SSIdentifier> ( ids, ids + ni ) );
+            iv = 10;
+            is = 1;
+        }
+
+        SSDoubleStarPtr pDouble = SSGetDoubleStarPtr ( pObject );
+        if ( pDouble != nullptr && need ( 13, 1 ) )
+        {
+            pDouble->setMagnitudeDelta ( v[iv] );
+            pDouble->setSeparation ( v[iv + 1] );
+            pDouble->setPositionAngle ( v[iv + 2] );
+            pDouble->setPositionAngleYear ( v[iv + 3] );
+            if ( v[iv + 4] != 0.0 )
+                pDouble->setOrbit ( unpack_orbit ( v + iv + 5 ) );
+            pDouble->setComponents ( s[is] );
+            iv += 13;
+            is += 1;
+        }
+
+        SSVariableStarPtr pVariable = SSGetVariableStarPtr ( pObject );
+        if ( pVariable != nullptr && need ( 4, 1 ) )
+        {
+            pVariable->setMaximumMagnitude ( v[iv] );
+            pVariable->setMinimumMagnitude ( v[iv + 1] );
+            pVariable->setPeriod ( v[iv + 2] );
+            pVariable->setEpoch ( v[iv + 3] );
+            pVariable->setVariableType ( s[is] );
+            iv += 4;
+            is += 1;
+        }
+
+        SSDeepSkyPtr pDeepSky = SSGetDeepSkyPtr ( pObject );
+        if ( pDeepSky != nullptr && need ( 3, 0 ) )
+        {
+            pDeepSky->setMajorAxis ( v[iv] );
+            pDeepSky->setMinorAxis ( v[iv + 1] );
+            pDeepSky->setPositionAngle ( v[iv + 2] );
+        }
+    }
+    else if ( type == kTypeConstellation || type == kTypeAsterism )
+    {
+        SSConstellationPtr pCon = SSGetConstellationPtr ( pObject );
+        if ( pCon != nullptr && need ( 7, 0 ) )
+        {
+            pCon->setDirection ( SSVector ( v[0], v[1], v[2] ) );
+            pCon->setArea ( v[3] );
+            pCon->setRank ( v[4] );
+
+            size_t nb = v[5];
+            iv = 6;
+            if ( nb <= nv && need ( nb * 3 + 1, 0 ) )
+            {
+                vector<SSVector> bounds ( nb );
+                for ( size_t i = 0; i < nb; i++, iv += 3 )
+                    bounds[i] = SSVector ( v[iv], v[iv + 1], v[iv + 2] );
+                pCon->setBoundary ( move ( bounds ) );
+
+                size_t nf = v[iv++];
+                if ( nf <= nv && need ( nf, 0 ) )
+                    pCon->setFigure ( vector<int> ( v + iv, v + iv + nf ) );
+            }
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+    else
+    {
+        valid = false;
+    }
+
+    if ( ! valid )
+    {
+        delete pObject;
+        return nullptr;
+    }
+
+    return pObject;
+}
+
+// Returns offset rounded up to a multiple of 8 bytes, so every table in the file is aligned for its values.
+
+static uint64_t align8 ( uint64_t offset )
+{
+    return ( offset + 7 ) & ~ (uint64_t) 7;
+}
+
+int SSExportObjectsToBinary ( vector<char> &bytes, SSObjectVec &objects, SSObjectFilter filter, void *userData )
+{
+    vector<SSBinaryCatalogRecord> records;
+    vector<double> values;
+    vector<int64_t> idents;
+    vector<uint32_t> strings;
+    string stringData;
+    SSBinaryObject data;
+
+    // Pack every object which passes filter into records and tables.
+
+    for ( size_t i = 0; i < objects.size(); i++ )
+    {
+        SSObjectPtr pObject = objects[i];
+        if ( pObject == nullptr || ( filter != nullptr && ! filter ( pObject, userData ) ) )
+            continue;
+
+        data.values.clear();
+        data.idents.clear();
+        data.strings = pObject->getNames();
+        data.strings.push_back ( pObject->getDescription() );
+        size_t numNames = data.strings.size() - 1;
+
+        if ( ! pack_object ( pObject, data ) || data.strings.size() > UINT16_MAX || data.idents.size() > UINT16_MAX )
+            continue;
+
+        SSBinaryCatalogRecord record = { 0 };
+        record.type = pObject->getType();
+        record.numNames = numNames;
+        record.numStrings = data.strings.size();
+        record.numIdents = data.idents.size();
+        record.firstString = (uint32_t) strings.size();
+        record.firstValue = (uint32_t) values.size();
+        record.numValues = (uint32_t) data.values.size();
+        record.firstIdent = (uint32_t) idents.size();
+        records.push_back ( record );
+
+        values.insert ( values.end(), data.values.begin(), data.values.end() );
+        idents.insert ( idents.end(), data.idents.begin(), data.idents.end() );
+        for ( string &str : data.strings )
+        {
+            strings.push_back ( (uint32_t) stringData.size() );
+            stringData.append ( str.c_str(), str.size() + 1 );
+        }
+    }
+
+    // Lay out header and tables.
+
+    SSBinaryCatalogHeader header = { { 0 } };
+    memcpy ( header.magic, kBinaryCatalogMagic, sizeof ( header.magic ) );
+    header.version = kBinaryCatalogVersion;
+    header.byteOrder = kBinaryCatalogByteOrder;
+    header.numRecords = (uint32_t) records.size();
+    header.numValues = (uint32_t) values.size();
+    header.numIdents = (uint32_t) idents.size();
+    header.numStrings = (uint32_t) strings.size();
+    header.recordOffset = align8 ( sizeof ( header ) );
+    header.valueOffset = align8 ( header.recordOffset + records.size() * sizeof ( SSBinaryCatalogRecord ) );
+    header.identOffset = align8 ( header.valueOffset + values.size() * sizeof ( double ) );
+    header.stringOffset = align8 ( header.identOffset + idents.size() * sizeof ( int64_t ) );
+    header.stringDataOffset = align8 ( header.stringOffset + strings.size() * sizeof ( uint32_t ) );
+    header.stringDataSize = stringData.size();
+
+    // Copy everything into bytes, padding between tables with zeros.
+
+    bytes.assign ( header.stringDataOffset + stringData.size(), 0 );
+    memcpy ( bytes.data(), &header, sizeof ( header ) );
+
+    // An empty vector's data() may be null, which memcpy() doesn't allow even for zero bytes, so skip empty tables.
+
+    if ( records.size() > 0 )
+        memcpy ( bytes.data() + header.recordOffset, records.data(), records.size() * sizeof ( SSBinaryCatalogRecord ) );
+    if ( values.size() > 0 )
+        memcpy ( bytes.data() + header.valueOffset, values.data(), values.size() * sizeof ( double ) );
+    if ( idents.size() > 0 )
+        memcpy ( bytes.data() + header.identOffset, idents.data(), idents.size() * sizeof ( int64_t ) );
+    if ( strings.size() > 0 )
+        memcpy ( bytes.data() + header.stringOffset, strings.data(), strings.size() * sizeof ( uint32_t ) );
+    if ( stringData.size() > 0 )
+        memcpy ( bytes.data() + header.stringDataOffset, stringData.data(), stringData.size() );
+
+    return (int) records.size();
+}
+
+int SSExportObjectsToBinary ( const string &filename, SSObjectVec &objects, SSObjectFilter filter, void *userData )
+{
+    vector<char> bytes;
+    int n = SSExportObjectsToBinary ( bytes, objects, filter, userData );
+
+    FILE *file = fopen ( filename.c_str(), "wb" );
+    if ( file == nullptr )
+        return 0;
+
+    bool ok = fwrite ( bytes.data(), 1, bytes.size(), file ) == bytes.size();
+    if ( fclose ( file ) != 0 || ! ok )
+        return 0;
+
+    return n;
+}
+
+SSBinaryCatalog::SSBinaryCatalog ( void )
+{
+    _map = nullptr;
+    _mapSize = 0;
+    _header = nullptr;
+    _records = nullptr;
+    _values = nullptr;
+    _idents = nullptr;
+    _strings = nullptr;
+    _stringData = nullptr;
+}
+
+SSBinaryCatalog::SSBinaryCatalog ( const string &path ) : SSBinaryCatalog()
+{
+    open ( path );
+}
+
+SSBinaryCatalog::~SSBinaryCatalog ( void )
+{
+    close();
+}
+
+// Opens a binary catalog file (path), memory-mapped if possible; otherwise reads the whole file into memory,
+// which on Android also reads from the application package. Any previous file is closed first.
+
+bool SSBinaryCatalog::open ( const string &path )
+{
+    close();
+
+    _map = (const char *) mapfile ( path, _mapSize );
+    if ( _map != nullptr )
+    {
+        if ( validate ( _map, _mapSize ) )
+            return true;
+
+        close();
+        return false;
+    }
+
+    FILE *file = fopen ( path.c_str(), "rb" );
+    if ( file == nullptr )
+        return false;
+
+    char block[1 << 16];
+    size_t size = 0;
+    while ( ( size = fread ( block, 1, sizeof ( block ), file ) ) > 0 )
+        _buffer.insert ( _buffer.end(), block, block + size );
+    fclose ( file );
+
+    if ( validate ( _buffer.data(), _buffer.size() ) )
+        return true;
+
+    close();
+    return false;
+}
+
+// Opens binary catalog data already in memory (data) of (size) bytes, which must be aligned to 8 bytes.
+// The catalog does not copy or free the data; it must stay valid while the catalog is open.
+// Any previous file is closed first.
+
+bool SSBinaryCatalog::open ( const char *data, size_t size )
+{
+    close();
+
+    if ( (uintptr_t) data % 8 == 0 && validate ( data, size ) )
+        return true;
+
+    close();
+    return false;
+}
+
+// Checks that binary catalog data in memory (data) of (size) bytes has a valid header, and tables and records
+// which are all inside the data; then sets pointers to its tables. Returns false if data is not valid.
+
+bool SSBinaryCatalog::validate ( const char *data, size_t size )
+{
+    if ( size < sizeof ( SSBinaryCatalogHeader ) )
+        return false;
+
+    const SSBinaryCatalogHeader *header = (const SSBinaryCatalogHeader *) data;
+    if ( memcmp ( header->magic, kBinaryCatalogMagic, sizeof ( header->magic ) ) != 0 )
+        return false;
+
+    if ( header->version != kBinaryCatalogVersion || header->byteOrder != kBinaryCatalogByteOrder )
+        return false;
+
+    auto inside = [size] ( uint64_t offset, uint64_t count, uint64_t itemSize )
+    {
+        return offset % 8 == 0 && offset <= size && count <= ( size - offset ) / itemSize;
+    };
+
+    if ( ! inside ( header->recordOffset, header->numRecords, sizeof ( SSBinaryCatalogRecord ) )
+      || ! inside ( header->valueOffset, header->numValues, sizeof ( double ) )
+      || ! inside ( header->identOffset, header->numIdents, sizeof ( int64_t ) )
+      || ! inside ( header->stringOffset, header->numStrings, sizeof ( uint32_t ) )
+      || ! inside ( header->stringDataOffset, header->stringDataSize, 1 ) )
+        return false;
+
+    // String data must end with a NUL, so every string in it, from any offset, is terminated.
+
+    const uint32_t *strings = (const uint32_t *) ( data + header->stringOffset );
+    const char *stringData = data + header->stringDataOffset;
+    if ( header->numStrings > 0 && ( header->stringDataSize == 0 || stringData[ header->stringDataSize - 1 ] != 0 ) )
+        return false;
+
+    for ( uint32_t i = 0; i < header->numStrings; i++ )
+        if ( strings[i] >= header->stringDataSize )
+            return false;
+
+    const SSBinaryCatalogRecord *records = (const SSBinaryCatalogRecord *) ( data + header->recordOffset );
+    for ( uint32_t k = 0; k < header->numRecords; k++ )
+    {
+        const SSBinaryCatalogRecord &r = records[k];
+        if ( r.numNames >= r.numStrings || (uint64_t) r.firstString + r.numStrings > header->numStrings
+          || (uint64_t) r.firstValue + r.numValues > header->numValues || (uint64_t) r.firstIdent + r.numIdents > header->numIdents )
+            return false;
+    }
+
+    _header = header;
+    _records = records;
+    _values = (const double *) ( data + header->valueOffset );
+    _idents = (const int64_t *) ( data + header->identOffset );
+    _strings = strings;
+    _stringData = stringData;
+    return true;
+}
+
+void SSBinaryCatalog::close ( void )
+{
+    if ( _map != nullptr )
+        unmapfile ( _map, _mapSize );
+
+    _map = nullptr;
+    _mapSize = 0;
+    _buffer.clear();
+    _buffer.shrink_to_fit();
+    _header = nullptr;
+    _records = nullptr;
+    _values = nullptr;
+    _idents = nullptr;
+    _strings = nullptr;
+    _stringData = nullptr;
+}
+
+SSObjectPtr SSBinaryCatalog::materialize ( size_t k )
+{
+    if ( k >= size() )
+        return nullptr;
+
+    const SSBinaryCatalogRecord &r = _records[k];
+    vector<const char *> strings ( r.numStrings );
+    for ( int i = 0; i < r.numStrings; i++ )
+        strings[i] = _stringData + _strings[ r.firstString + i ];
+
+    // Type-specific strings follow the names and the description.
+
+    SSObjectPtr pObject = unpack_object ( (SSObjectType) r.type, _values + r.firstValue, r.numValues,
+                                          strings.data() + r.numNames + 1, r.numStrings - r.numNames - 1, _idents + r.firstIdent, r.numIdents );
+    if ( pObject == nullptr )
+        return nullptr;
+
+    pObject->setNames ( vector<string> ( strings.begin(), strings.begin() + r.numNames ) );
+    pObject->setDescription ( strings[ r.numNames ] );
+    return pObject;
+}
+
+int SSBinaryCatalog::materialize ( SSObjectVec &objects, SSObjectFilter filter, void *userData )
+{
+    int n = 0;
+
+    for ( size_t k = 0; k < size(); k++ )
+    {
+        SSObjectPtr pObject = materialize ( k );
+        if ( pObject != nullptr && ( filter == nullptr || filter ( pObject, userData ) ) )
+        {
+            objects.append ( pObject );
+            n++;
+        }
+        else
+        {
+            delete pObject;
+        }
+    }
+
+    return n;
+}
+
+int SSImportObjectsFromBinary ( const string &filename, SSObjectVec &objects, SSObjectFilter filter, void *userData )
+{
+    SSBinaryCatalog catalog;
+    if ( ! catalog.open ( filename ) )
+        return 0;
+
+    return catalog.materialize ( objects, filter, userData );
+}
@@ -0,0 +1,138 @@
+// SSBinaryCatalog.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// Binary, memory-mappable storage for object catalogs, as an alternative to CSV files which must be
+// completely reparsed every time they are read. A binary catalog file contains a fixed-size record for each
+// object, stored in the same order as the SSObjectArray it was written from; a table of numeric values in a
+// fixed layout for each object type; a table of 64-bit identifiers; and a string table for names, descriptions,
+// spectral types, and other text. Every value is stored exactly, so objects read back are identical to
+// the objects written, and to the objects imported from the same catalog's CSV file.
+// An SSBinaryCatalog maps the file into memory, and creates individual objects only when they are requested.
+
+#ifndef SSBinaryCatalog_hpp
+#define SSBinaryCatalog_hpp
+
+#include "SSObject.hpp"
+
+#pragma pack ( push, 1 )
+
+// Binary catalog file header. All values are stored in the byte order of the computer which wrote the file;
+// files with a different byte order are rejected. All offsets are from the start of the file.
+
+struct SSBinaryCatalogHeader
+{
+    char     magic[8];              // kBinaryCatalogMagic
+    uint32_t version;               // kBinaryCatalogVersion
+    uint32_t byteOrder;             // kBinaryCatalogByteOrder, as written by this computer
+    uint32_t numRecords;            // number of object records
+    uint32_t numValues;             // number of numeric values (doubles) in value table
+    uint32_t numIdents;             // number of identifiers (64-bit integers) in identifier table
+    uint32_t numStrings;            // number of strings in string table
+    uint64_t recordOffset;          // offset to object records
+    uint64_t valueOffset;           // offset to value table
+    uint64_t identOffset;           // offset to identifier table
+    uint64_t stringOffset;          // offset to string offset table; one 32-bit offset into string data for each string
+    uint64_t stringDataOffset;      // offset to string data: UTF-8 text, each string followed by a NUL
+    uint64_t stringDataSize;        // size of string data in bytes
+};
+
+// Fixed-size record for one object. Its strings are its names, then its description, then type-specific strings;
+// its numeric values are in the layout for its type. Indices are into the value, identifier, and string tables.
+
+struct SSBinaryCatalogRecord
+{
+    uint8_t  type;                  // object type code (SSObjectType)
+    uint8_t  reserved;              // always zero
+    uint16_t numNames;              // number of name strings
+    uint16_t numStrings;            // total number of strings, including names
+    uint16_t numIdents;             // number of identifiers
+    uint32_t firstString;           // index of first string
+    uint32_t firstValue;            // index of first numeric value
+    uint32_t numValues;             // number of numeric values
+    uint32_t firstIdent;            // index of first identifier
+};
+
+#pragma pack ( pop )
+
+constexpr char kBinaryCatalogMagic[8] = { 'S', 'S', 'C', 'A', 'T', 'B', 'I', 'N' };
+constexpr uint32_t kBinaryCatalogVersion = 1;
+constexpr uint32_t kBinaryCatalogByteOrder = 0x01020304;
+
+// This class reads a binary catalog file, memory-mapped if possible.
+// Records, names, and identifiers are read directly from the file; objects are created only on request.
+
+class SSBinaryCatalog
+{
+protected:
+
+    const char *_map;                           // memory-mapped file, or nullptr if not mapped
+    size_t _mapSize;                            // size of memory-mapped file in bytes
+    vector<char> _buffer;                       // entire file, if it could not be memory-mapped
+    const SSBinaryCatalogHeader *_header;       // file header, or nullptr if not open
+    const SSBinaryCatalogRecord *_records;      // object records
+    const double *_values;                      // numeric value table
+    const int64_t *_idents;                     // identifier table
+    const uint32_t *_strings;                   // string offset table
+    const char *_stringData;                    // string data
+
+    bool validate ( const char *data, size_t size );
+
+public:
+
+    SSBinaryCatalog ( void );
+    SSBinaryCatalog ( const string &path );
+    SSBinaryCatalog ( const SSBinaryCatalog &other ) = delete;
+    SSBinaryCatalog &operator = ( const SSBinaryCatalog &other ) = delete;
+    ~SSBinaryCatalog ( void );
+
+    // Opens a binary catalog file (path), or catalog data in memory (data) of (size) bytes, aligned to 8 bytes,
+    // which is not copied and must stay valid while open; any previous file is closed first. Returns false
+    // if the file cannot be read, or is not a valid binary catalog written in this version and byte order.
+
+    bool open ( const string &path );
+    bool open ( const char *data, size_t size );
+    void close ( void );
+    bool isOpen ( void ) { return _header != nullptr; }
+
+    // Returns number of objects, and k-th object's type, names, and identifiers, without creating the object.
+    // Names are NUL-terminated strings in the file; they are valid until the catalog is closed.
+    // k and i must be in range.
+
+    size_t size ( void ) { return _header ? _header->numRecords : 0; }
+    SSObjectType getType ( size_t k ) { return (SSObjectType) _records[k].type; }
+    int getNumNames ( size_t k ) { return _records[k].numNames; }
+    const char *getName ( size_t k, int i ) { return _stringData + _strings[ _records[k].firstString + i ]; }
+    int getNumIdentifiers ( size_t k ) { return _records[k].numIdents; }
+    SSIdentifier getIdentifier ( size_t k, int i ) { return SSIdentifier ( _idents[ _records[k].firstIdent + i ] ); }
+
+    // Creates a new object from the k-th record. The caller owns (and must delete) the result.
+    // Returns nullptr if k is out of range, or the record is invalid.
+
+    SSObjectPtr materialize ( size_t k );
+
+    // Creates objects from all records and appends them to an object array (objects), in file order, if they pass
+    // an optional filter function (filter) as in SSImportObjectsFromCSV(). Returns number of objects appended.
+
+    int materialize ( SSObjectVec &objects, SSObjectFilter filter = nullptr, void *userData = nullptr );
+};
+
+// Writes objects in an array (objects) to a binary catalog file (filename), if they pass an optional filter (filter).
+// Planets, moons, asteroids, comets, surface features, cities, stars, deep sky objects, and constellations
+// (including boundaries and figures) are written; satellites and spacecraft, which need TLEs, are skipped.
+// Returns number of objects written, or zero if the file can't be written.
+
+int SSExportObjectsToBinary ( const string &filename, SSObjectVec &objects, SSObjectFilter filter = nullptr, void *userData = nullptr );
+
+// As above, but writes the binary catalog into a block of memory (bytes) instead of a file.
+
+int SSExportObjectsToBinary ( vector<char> &bytes, SSObjectVec &objects, SSObjectFilter filter = nullptr, void *userData = nullptr );
+
+// Reads all objects from a binary catalog file (filename), appending them to (objects) if they pass an optional
+// filter (filter). Returns number of objects imported, or zero if the file is not a valid binary catalog.
+
+int SSImportObjectsFromBinary ( const string &filename, SSObjectVec &objects, SSObjectFilter filter = nullptr, void *userData = nullptr );
+
+#endif /* SSBinaryCatalog_hpp */
@@ -0,0 +1,318 @@
+// SSCatalogBuild.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <cstdio>
+#include <set>
+
+#include "SSCatalogBuild.hpp"
+#include "SSBinaryCatalog.hpp"
+#include "SSThreadPool.hpp"
+
+static const char *kManifestName = "manifest.csv";
+
+// 64-bit FNV-1a hash of (size) bytes (data), continuing from a previous hash (hash).
+
+static uint64_t fnv1a ( const void *data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL )
+{
+    const unsigned char *bytes = (const unsigned char *) data;
+    for ( size_t i = 0; i < size; i++ )
+        hash = ( hash ^ bytes[i] ) * 0x100000001b3ULL;
+    return hash;
+}
+
+uint64_t SSCatalogBuild::hashFile ( const string &path )
+{
+    FILE *file = fopen ( path.c_str(), "rb" );
+    if ( file == nullptr )
+        return 0;
+
+    vector<char> buffer ( 1 << 20 );
+    uint64_t hash = fnv1a ( nullptr, 0 );
+    size_t n = 0;
+    while ( ( n = fread ( buffer.data(), 1, buffer.size(), file ) ) > 0 )
+        hash = fnv1a ( buffer.data(), n, hash );
+
+    bool error = ferror ( file );
+    fclose ( file );
+    return error ? 0 : hash;
+}
+
+SSCatalogBuild::SSCatalogBuild ( const string &directory )
+{
+    _directory = directory;
+    if ( ! _directory.empty() && _directory.back() != '/' && _directory.back() != '\\' )
+        _directory += '/';
+}
+
+string SSCatalogBuild::outputPath ( const Stage &stage )
+{
+    return _directory + stage.name + ".ssbin";
+}
+
+bool SSCatalogBuild::addStage ( const string &name, const vector<string> &inputs, const vector<string> &depends, Builder build, int version )
+{
+    if ( name.empty() || ! build )
+        return false;
+
+    for ( auto &pStage : _stages )
+        if ( pStage->name == name )
+            return false;
+
+    Stage *pStage = new Stage;
+    for ( const string &dep : depends )
+    {
+        size_t i = 0;
+        while ( i < _stages.size() && _stages[i]->name != dep )
+            i++;
+        if ( i == _stages.size() )
+        {
+            delete pStage;
+            return false;
+        }
+        pStage->depends.push_back ( i );
+    }
+
+    pStage->name = name;
+    pStage->inputs = inputs;
+    pStage->version = version;
+    pStage->build = build;
+    pStage->hash = 0;
+    pStage->rebuilt = pStage->loaded = false;
+    _stages.push_back ( unique_ptr<Stage> ( pStage ) );
+    return true;
+}
+
+// Reads stage hashes from the manifest, one "name,hash" line per stage built successfully.
+
+void SSCatalogBuild::readManifest ( void )
+{
+    _manifest.clear();
+    FILE *file = fopen ( ( _directory + kManifestName ).c_str(), "r" );
+    if ( file == nullptr )
+        return;
+
+    char line[1024] = { 0 };
+    while ( fgets ( line, sizeof ( line ), file ) )
+    {
+        string str = trim ( line );
+        size_t comma = str.rfind ( ',' );
+        if ( comma != string::npos && comma > 0 )
+            _manifest[ str.substr ( 0, comma ) ] = strtoull ( str.c_str() + comma + 1, nullptr, 16 );
+    }
+
+    fclose ( file );
+}
+
+// Writes the manifest to a temporary file, then replaces the old one, so an interrupted build never leaves
+// a manifest claiming stages are built which are not.
+
+bool SSCatalogBuild::writeManifest ( void )
+{
+    string path = _directory + kManifestName, temp = path + ".tmp";
+    FILE *file = fopen ( temp.c_str(), "w" );
+    if ( file == nullptr )
+        return false;
+
+    for ( auto &entry : _manifest )
+        fprintf ( file, "%s,%016llx\n", entry.first.c_str(), (unsigned long long) entry.second );
+
+    bool ok = fclose ( file ) == 0;
+    remove ( path.c_str() );
+    return ok && rename ( temp.c_str(), path.c_str() ) == 0;
+}
+
+// Reads a stage's saved objects back from its output file, if they are not already in memory.
+
+bool SSCatalogBuild::load ( Stage &stage )
+{
+    if ( stage.loaded )
+        return true;
+
+    SSBinaryCatalog catalog;
+    if ( ! catalog.open ( outputPath ( stage ) ) )
+        return false;
+
+    stage.objects.erase();
+    catalog.materialize ( stage.objects );
+    stage.loaded = true;
+    return true;
+}
+
+int SSCatalogBuild::run ( int threads )
+{
+    SSThreadPool &pool = SSThreadPool::shared();
+    if ( threads <= 0 )
+        threads = pool.size();
+
+    readManifest();
+
+    // Hash every distinct source file once, in parallel; then hash stages in order, so dependencies come first.
+
+    set<string> pathSet;
+    for ( auto &pStage : _stages )
+        pathSet.insert ( pStage->inputs.begin(), pStage->inputs.end() );
+
+    vector<string> paths ( pathSet.begin(), pathSet.end() );
+    vector<uint64_t> pathHashes ( paths.size() );
+    pool.parallelFor ( 0, paths.size(), [&] ( size_t begin, size_t end )
+    {
+        for ( size_t i = begin; i < end; i++ )
+            pathHashes[i] = hashFile ( paths[i] );
+    }, 1 );
+
+    map<string,uint64_t> fileHashes;
+    for ( size_t i = 0; i < paths.size(); i++ )
+        fileHashes[ paths[i] ] = pathHashes[i];
+
+    vector<bool> stale ( _stages.size() ), done ( _stages.size() );
+    for ( size_t i = 0; i < _stages.size(); i++ )
+    {
+        Stage &stage = *_stages[i];
+        uint64_t hash = fnv1a ( stage.name.c_str(), stage.name.size() + 1 );
+        hash = fnv1a ( &stage.version, sizeof ( stage.version ), hash );
+        for ( const string &path : stage.inputs )
+        {
+            hash = fnv1a ( path.c_str(), path.size() + 1, hash );
+            hash = fnv1a ( &fileHashes[path], sizeof ( uint64_t ), hash );
+        }
+        for ( size_t dep : stage.depends )
+            hash = fnv1a ( &_stages[dep]->hash, sizeof ( uint64_t ), hash );
+
+        auto it = _manifest.find ( stage.name );
+        stage.hash = hash;
+        stage.rebuilt = false;
+        stale[i] = it == _manifest.end() || it->second != hash || filesize ( outputPath ( stage ) ) == 0;
+        if ( stale[i] )
+        {
+            stage.objects.erase();
+            stage.loaded = false;
+        }
+    }
+
+    // Build waves of stages whose dependencies are all done. Up-to-date stages are done at once, without reading
+    // their outputs; dependencies of stale stages are read back before the wave starts.
+
+    int rebuilt = 0;
+    bool failed = false;
+    while ( ! failed )
+    {
+        vector<size_t> wave;
+        for ( size_t i = 0; i < _stages.size(); i++ )
+        {
+            if ( done[i] )
+                continue;
+
+            bool ready = true;
+            for ( size_t dep : _stages[i]->depends )
+                ready = ready && done[dep];
+            if ( ! ready )
+                continue;
+
+            if ( stale[i] )
+                wave.push_back ( i );
+            else
+                done[i] = true;
+        }
+
+        if ( wave.empty() )
+        {
+            bool remaining = false;
+            for ( size_t i = 0; i < _stages.size(); i++ )
+                remaining = remaining || ! done[i];
+            if ( remaining )
+                continue;
+            break;
+        }
+
+        for ( size_t i : wave )
+            for ( size_t dep : _stages[i]->depends )
+                if ( ! load ( *_stages[dep] ) )
+                    failed = true;
+
+        if ( failed )
+            break;
+
+        // Remove stale stages from the manifest before building them, so a failed build is never taken as current.
+
+        for ( size_t i : wave )
+            _manifest.erase ( _stages[i]->name );
+
+        vector<char> success ( wave.size() );
+        auto body = [&] ( size_t begin, size_t end )
+        {
+            for ( size_t w = begin; w < end; w++ )
+            {
+                Stage &stage = *_stages[ wave[w] ];
+                vector<SSObjectArray *> depends;
+                for ( size_t dep : stage.depends )
+                    depends.push_back ( &_stages[dep]->objects );
+
+                if ( ! stage.build ( stage.inputs, depends, stage.objects ) )
+                    continue;
+
+                vector<char> bytes;
+                SSExportObjectsToBinary ( bytes, stage.objects );
+                string path = outputPath ( stage ), temp = path + ".tmp";
+                FILE *file = fopen ( temp.c_str(), "wb" );
+                if ( file == nullptr )
+                    continue;
+
+                bool ok = fwrite ( bytes.data(), 1, bytes.size(), file ) == bytes.size();
+                ok = fclose ( file ) == 0 && ok;
+                remove ( path.c_str() );
+                success[w] = ok && rename ( temp.c_str(), path.c_str() ) == 0;
+            }
+        };
+
+        for ( size_t first = 0; first < wave.size(); first += threads )
+        {
+            size_t last = min ( first + threads, wave.size() );
+            if ( last - first > 1 )
+                pool.parallelFor ( first, last, body, 1 );
+            else
+                body ( first, last );
+        }
+
+        for ( size_t w = 0; w < wave.size(); w++ )
+        {
+            Stage &stage = *_stages[ wave[w] ];
+            if ( success[w] )
+            {
+                _manifest[ stage.name ] = stage.hash;
+                stage.rebuilt = stage.loaded = true;
+                done[ wave[w] ] = true;
+                rebuilt++;
+            }
+            else
+            {
+                stage.objects.erase();
+                failed = true;
+            }
+        }
+
+        writeManifest();
+    }
+
+    return failed ? -1 : rebuilt;
+}
+
+SSObjectArray *SSCatalogBuild::getObjects ( const string &name )
+{
+    for ( auto &pStage : _stages )
+        if ( pStage->name == name )
+            return load ( *pStage ) ? &pStage->objects : nullptr;
+
+    return nullptr;
+}
+
+bool SSCatalogBuild::wasRebuilt ( const string &name )
+{
+    for ( auto &pStage : _stages )
+        if ( pStage->name == name )
+            return pStage->rebuilt;
+
+    return false;
+}
@@ -0,0 +1,94 @@
+// SSCatalogBuild.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// An incremental, parallel build of an object database from source catalogs, e.g. HIP, TYC, SKY2000, GJ, WDS, GCVS,
+// and NGC-IC imports, cross-matched and merged, then stored in an HTM. The build is a list of stages; each stage reads
+// source files and the objects made by earlier stages it depends on, and makes objects of its own, which are saved
+// in a build directory as a binary catalog (see SSBinaryCatalog). A manifest in the same directory records a hash of
+// each stage's inputs: the contents of its source files, its version, and the hashes of the stages it depends on.
+// When the build runs again, stages whose hash is unchanged are not run; their saved objects are read back only if
+// a stage which depends on them must be rebuilt, or the caller asks for them. Stages whose dependencies are all built
+// run at the same time, on the shared thread pool. Binary catalogs omit satellites (see SSExportObjectsToBinary()),
+// so stages making satellites will lose them when their output is read back.
+
+#ifndef SSCatalogBuild_hpp
+#define SSCatalogBuild_hpp
+
+#include <functional>
+#include <map>
+#include <memory>
+
+#include "SSObject.hpp"
+
+class SSCatalogBuild
+{
+public:
+
+    // A stage's build function. It reads the stage's source files (inputs), and objects made by the stages it depends
+    // on (depends, in the order they were given), which it must not change; and appends its own objects to (objects).
+    // It may have other outputs, e.g. an HTM store. Returns false on failure, which stops the build.
+    // Stages with no dependency on each other are built on different threads at once.
+
+    typedef function<bool ( const vector<string> &inputs, const vector<SSObjectArray *> &depends, SSObjectArray &objects )> Builder;
+
+protected:
+
+    struct Stage
+    {
+        string name;                    // unique name; output is saved as <name>.ssbin
+        vector<string> inputs;          // source file paths
+        vector<size_t> depends;         // indexes of stages this stage depends on, all earlier than it
+        int version;                    // change to force rebuild, e.g. when build function changes
+        Builder build;                  // build function
+        uint64_t hash;                  // hash of inputs, version, and dependencies' hashes, from last run
+        bool rebuilt;                   // true if build function ran on last run
+        bool loaded;                    // true if objects are in memory, built or read back
+        SSObjectArray objects;          // objects made by stage
+    };
+
+    string _directory;                          // build directory, containing manifest and stage outputs
+    vector<unique_ptr<Stage>> _stages;          // stages in order added; dependencies come first
+    map<string,uint64_t> _manifest;             // input hashes of stages built successfully, by stage name
+
+    string outputPath ( const Stage &stage );
+    bool load ( Stage &stage );
+    void readManifest ( void );
+    bool writeManifest ( void );
+
+public:
+
+    // Creates a build whose manifest and stage outputs are kept in a directory (directory), which must exist.
+
+    SSCatalogBuild ( const string &directory );
+
+    // Adds a stage named (name) reading source files (inputs) and objects of stages named in (depends), which
+    // must already have been added, so stages can't depend on each other circularly; objects are made by (build).
+    // Changing the stage's (version) forces it to be rebuilt. Returns false if the name is already used,
+    // or a dependency is unknown.
+
+    bool addStage ( const string &name, const vector<string> &inputs, const vector<string> &depends, Builder build, int version = 0 );
+
+    // Runs the stages whose inputs changed since the last run, or whose outputs are missing, on up to (threads)
+    // threads at once (zero or negative means the shared thread pool's size). Returns the number of stages rebuilt,
+    // or -1 if a stage failed; stages built before the failure are kept, and not rebuilt next time.
+
+    int run ( int threads = 0 );
+
+    // Returns a stage's objects, reading them back from its saved output if it was not rebuilt;
+    // or nullptr if there is no stage named (name), or its output can't be read.
+
+    SSObjectArray *getObjects ( const string &name );
+
+    // Returns true if the stage named (name) was rebuilt on the last run.
+
+    bool wasRebuilt ( const string &name );
+
+    // Returns a 64-bit hash of a file's contents (path), or zero if it can't be read.
+
+    static uint64_t hashFile ( const string &path );
+};
+
+#endif /* SSCatalogBuild_hpp */
@@ -0,0 +1,261 @@
+// SSChebyshevCache.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <cmath>
+
+#include "SSChebyshevCache.hpp"
+#include "SSInstrument.hpp"
+
+static constexpr double kDefaultSpan = 32.0;    // initial window span for bodies without a span set, in days
+static constexpr double kMinDistance = 1.0e-3;  // distances below this (in AU) are treated as this for error testing
+
+// Constructs a cache around an ephemeris function (func), which is passed user data (userData).
+// Windows are fitted with polynomials of a given degree, to a fitting error (tolerance) relative to
+// the body's distance from the origin. Fitted windows will not use more than maxBytes of memory.
+
+SSChebyshevCache::SSChebyshevCache ( SSEphemerisFunc func, void *userData, double tolerance, size_t maxBytes, int degree )
+{
+    _func = func;
+    _userData = userData;
+    _tolerance = tolerance;
+    _maxBytes = maxBytes;
+    _degree = degree < 2 ? 2 : degree;
+    _bytes = 0;
+    _hits = _misses = 0;
+}
+
+// Computes Chebyshev coefficients (coeffs) of a given degree from function values (values)
+// sampled at the (degree + 1) Chebyshev nodes x[k] = cos ( pi * ( k + 0.5 ) / ( degree + 1 ) ).
+
+void SSChebyshevCache::chebyshevFit ( int degree, const double *values, double *coeffs )
+{
+    int n = degree + 1;
+
+    for ( int j = 0; j < n; j++ )
+    {
+        double sum = 0.0;
+        for ( int k = 0; k < n; k++ )
+            sum += values[k] * cos ( M_PI * j * ( k + 0.5 ) / n );
+        coeffs[j] = sum * ( j == 0 ? 1.0 : 2.0 ) / n;
+    }
+}
+
+// Evaluates Chebyshev polynomial of a given degree with coefficients (coeffs) at a point (x) from -1 to +1.
+// Returns polynomial value (value) and derivative with respect to x (deriv).
+
+void SSChebyshevCache::chebyshevEval ( int degree, const double *coeffs, double x, double &value, double &deriv )
+{
+    double t0 = 1.0, t1 = x, d0 = 0.0, d1 = 1.0;
+
+    value = coeffs[0] + coeffs[1] * x;
+    deriv = coeffs[1];
+
+    for ( int j = 2; j <= degree; j++ )
+    {
+        double t2 = 2.0 * x * t1 - t0;
+        double d2 = 2.0 * t1 + 2.0 * x * d1 - d0;
+
+        value += coeffs[j] * t2;
+        deriv += coeffs[j] * d2;
+        t0 = t1; t1 = t2;
+        d0 = d1; d1 = d2;
+    }
+}
+
+// Returns memory used by one fitted window, in bytes.
+
+size_t SSChebyshevCache::windowBytes ( void )
+{
+    return sizeof ( Window ) + 3 * ( _degree + 1 ) * sizeof ( double ) + sizeof ( pair<int64_t,double> ) + 64;
+}
+
+// Fits Chebyshev coefficients (coeffs) of a given degree to the position of a body (id) computed
+// by an ephemeris function (func) from jed0 to jed1. Coefficients for x, y, z are stored consecutively,
+// so coeffs must have room for 3 * ( degree + 1 ) values. On return, fits is true if the fit is within
+// tolerance (relative to distance) at points halfway between the fitting nodes, where error is largest.
+// Returns false if the ephemeris function fails.
+
+bool SSChebyshevCache::chebyshevFitWindow ( SSEphemerisFunc func, void *userData, int64_t id, double jed0, double jed1, int degree, double tolerance, double *coeffs, bool &fits )
+{
+    int n = degree + 1;
+    double mid = ( jed0 + jed1 ) / 2.0, half = ( jed1 - jed0 ) / 2.0;
+    vector<double> values ( 3 * n );
+    SSVector pos, vel;
+
+    for ( int k = 0; k < n; k++ )
+    {
+        if ( ! func ( id, mid + half * cos ( M_PI * ( k + 0.5 ) / n ), pos, vel, userData ) )
+            return false;
+
+        values[k] = pos.x;
+        values[k + n] = pos.y;
+        values[k + n + n] = pos.z;
+    }
+
+    for ( int i = 0; i < 3; i++ )
+        chebyshevFit ( degree, &values[i * n], &coeffs[i * n] );
+
+    fits = true;
+    for ( int k = 0; k < n - 1; k++ )
+    {
+        double x = cos ( M_PI * ( k + 1.0 ) / n );
+        if ( ! func ( id, mid + half * x, pos, vel, userData ) )
+            return false;
+
+        SSVector fit, dfit;
+        chebyshevEval ( degree, &coeffs[0], x, fit.x, dfit.x );
+        chebyshevEval ( degree, &coeffs[n], x, fit.y, dfit.y );
+        chebyshevEval ( degree, &coeffs[n + n], x, fit.z, dfit.z );
+
+        double error = ( fit - pos ).magnitude();
+        if ( error > tolerance * max ( pos.magnitude(), kMinDistance ) )
+        {
+            fits = false;
+            break;
+        }
+    }
+
+    return true;
+}
+
+// Removes least-recently-used windows until memory used is no more than maxBytes.
+
+void SSChebyshevCache::evictWindows ( size_t maxBytes )
+{
+    while ( _bytes > maxBytes && _lru.size() > 0 )
+    {
+        pair<int64_t,double> key = _lru.back();
+        _lru.pop_back();
+        _windows[key.first].erase ( key.second );
+        _bytes -= windowBytes();
+    }
+}
+
+// Computes position (pos) and velocity (vel) of a body (id) at a Julian Ephemeris Date (jed)
+// from a fitted window, fitting a new window if none contains the given time. Windows start
+// at multiples of the body's span; the span is halved until the fit meets the tolerance.
+// If the ephemeris function fails, returns false and does not modify pos or vel.
+
+bool SSChebyshevCache::compute ( int64_t id, double jed, SSVector &pos, SSVector &vel )
+{
+    if ( ! isfinite ( jed ) )
+        return false;
+
+    lock_guard<mutex> lock ( _mutex );
+    map<double,Window> &windows = _windows[id];
+    map<double,Window>::iterator it = windows.upper_bound ( jed );
+
+    if ( it != windows.begin() && ( --it )->second.jed1 >= jed )
+    {
+        _hits++;
+        SS_INSTRUMENT_CACHE ( kInstrumentChebyshev, true );
+        _lru.splice ( _lru.begin(), _lru, it->second.lru );
+    }
+    else
+    {
+        _misses++;
+        SS_INSTRUMENT_CACHE ( kInstrumentChebyshev, false );
+
+        map<int64_t,double>::iterator sit = _spans.find ( id );
+        if ( sit == _spans.end() )
+            sit = _spans.insert ( make_pair ( id, kDefaultSpan ) ).first;
+
+        Window win;
+        double span = sit->second, jed0 = 0.0;
+        bool fits = false;
+        while ( true )
+        {
+            jed0 = floor ( jed / span ) * span;
+            win.jed0 = jed0;
+            win.jed1 = jed0 + span;
+            win.coeffs.resize ( 3 * ( _degree + 1 ) );
+            if ( ! chebyshevFitWindow ( _func, _userData, id, win.jed0, win.jed1, _degree, _tolerance, &win.coeffs[0], fits ) )
+                return false;
+
+            // Accept the shortest span even if the fit is not within tolerance.
+
+            if ( fits || span <= kMinSpan )
+                break;
+
+            span = sit->second = span / 2.0;
+        }
+
+        // Replace any existing window which starts at the same time.
+
+        it = windows.find ( jed0 );
+        if ( it != windows.end() )
+        {
+            _lru.erase ( it->second.lru );
+            windows.erase ( it );
+            _bytes -= windowBytes();
+        }
+
+        evictWindows ( _maxBytes > windowBytes() ? _maxBytes - windowBytes() : 0 );
+        _lru.push_front ( make_pair ( id, jed0 ) );
+        win.lru = _lru.begin();
+        it = windows.insert ( make_pair ( jed0, win ) ).first;
+        _bytes += windowBytes();
+    }
+
+    Window &win = it->second;
+    int n = _degree + 1;
+    double half = ( win.jed1 - win.jed0 ) / 2.0;
+    double x = ( jed - win.jed0 ) / half - 1.0;
+
+    chebyshevEval ( _degree, &win.coeffs[0], x, pos.x, vel.x );
+    chebyshevEval ( _degree, &win.coeffs[n], x, pos.y, vel.y );
+    chebyshevEval ( _degree, &win.coeffs[n + n], x, pos.z, vel.z );
+    vel /= half;
+
+    return true;
+}
+
+// Removes all fitted windows and resets hit and miss counts; window spans are retained.
+// Call this after changing the underlying ephemeris.
+
+void SSChebyshevCache::clear ( void )
+{
+    lock_guard<mutex> lock ( _mutex );
+    _windows.clear();
+    _lru.clear();
+    _bytes = 0;
+    _hits = _misses = 0;
+}
+
+// Changes fitting tolerance; clears all fitted windows.
+
+void SSChebyshevCache::setTolerance ( double tolerance )
+{
+    clear();
+    _tolerance = tolerance;
+}
+
+// Changes memory limit; evicts least-recently-used windows if needed.
+
+void SSChebyshevCache::setMaxBytes ( size_t maxBytes )
+{
+    lock_guard<mutex> lock ( _mutex );
+    _maxBytes = maxBytes;
+    evictWindows ( _maxBytes );
+}
+
+// Sets initial window span in days for a body (id). Should be a power of two so that windows
+// of different spans nest exactly; it will be shortened automatically if fits fail.
+
+void SSChebyshevCache::setSpan ( int64_t id, double span )
+{
+    lock_guard<mutex> lock ( _mutex );
+    _spans[id] = span > kMinSpan ? span : kMinSpan;
+}
+
+// Returns current window span in days for a body (id).
+
+double SSChebyshevCache::getSpan ( int64_t id )
+{
+    lock_guard<mutex> lock ( _mutex );
+    map<int64_t,double>::iterator sit = _spans.find ( id );
+    return sit == _spans.end() ? kDefaultSpan : sit->second;
+}
@@ -0,0 +1,91 @@
+// SSChebyshevCache.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class caches positions and velocities computed by any ephemeris function
+// as Chebyshev polynomials fitted over short time windows. After a window has been
+// fitted, positions and velocities anywhere inside it are obtained by polynomial
+// evaluation, which is much faster than re-evaluating VSOP/ELP or similar series.
+
+#ifndef SSChebyshevCache_hpp
+#define SSChebyshevCache_hpp
+
+#include <map>
+#include <list>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+#include "SSVector.hpp"
+
+using namespace std;
+
+// Pointer to an ephemeris function which computes position (pos) and velocity (vel) of a body (id)
+// at a Julian Ephemeris Date (jed). Should return true if successful or false on failure.
+
+typedef bool (*SSEphemerisFunc) ( int64_t id, double jed, SSVector &pos, SSVector &vel, void *userData );
+
+class SSChebyshevCache
+{
+public:
+
+    static constexpr int kDefaultDegree = 12;                   // degree of fitted polynomials
+    static constexpr double kDefaultTolerance = 1.0e-9;         // maximum fitting error relative to distance: about 0.0002 arcsec
+    static constexpr size_t kDefaultMaxBytes = 1024 * 1024;     // default cache memory limit = 1 MB
+    static constexpr double kMinSpan = 1.0 / 16.0;              // shortest window which will be fitted, in days
+
+protected:
+
+    // One fitted time window. Coefficients for x, y, z are stored consecutively.
+
+    struct Window
+    {
+        double jed0, jed1;                          // start and end of window [JED]
+        vector<double> coeffs;                      // (degree + 1) coefficients for each of x, y, z
+        list<pair<int64_t,double>>::iterator lru;   // position in least-recently-used list
+    };
+
+    SSEphemerisFunc _func;                          // ephemeris function which computes body positions
+    void *_userData;                                // user data passed to ephemeris function
+    int _degree;                                    // degree of fitted polynomials
+    double _tolerance;                              // maximum fitting error relative to distance
+    size_t _maxBytes;                               // memory limit, in bytes
+    size_t _bytes;                                  // memory currently used by fitted windows
+    size_t _hits, _misses;                          // number of cache hits and misses
+
+    map<int64_t,map<double,Window>> _windows;       // fitted windows for each body, indexed by start JED
+    map<int64_t,double> _spans;                     // current window span for each body, in days
+    list<pair<int64_t,double>> _lru;                // body ID and start JED of each window, most recently used first
+    mutex _mutex;                                   // protects everything above
+
+    void evictWindows ( size_t maxBytes );
+    size_t windowBytes ( void );
+
+public:
+
+    SSChebyshevCache ( SSEphemerisFunc func, void *userData = nullptr, double tolerance = kDefaultTolerance, size_t maxBytes = kDefaultMaxBytes, int degree = kDefaultDegree );
+
+    bool compute ( int64_t id, double jed, SSVector &pos, SSVector &vel );
+    void clear ( void );
+
+    void setTolerance ( double tolerance );
+    double getTolerance ( void ) { return _tolerance; }
+
+    void setMaxBytes ( size_t maxBytes );
+    size_t getMaxBytes ( void ) { return _maxBytes; }
+    size_t getBytes ( void ) { return _bytes; }
+
+    void setSpan ( int64_t id, double span );
+    double getSpan ( int64_t id );
+
+    size_t getHits ( void ) { return _hits; }
+    size_t getMisses ( void ) { return _misses; }
+
+    static void chebyshevFit ( int degree, const double *values, double *coeffs );
+    static void chebyshevEval ( int degree, const double *coeffs, double x, double &value, double &deriv );
+    static bool chebyshevFitWindow ( SSEphemerisFunc func, void *userData, int64_t id, double jed0, double jed1, int degree, double tolerance, double *coeffs, bool &fits );
+};
+
+#endif /* SSChebyshevCache_hpp */
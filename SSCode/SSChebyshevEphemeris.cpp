@@ -0,0 +1,209 @@
+// SSChebyshevEphemeris.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#include "SSChebyshevEphemeris.hpp"
+
+static const char kMagic[8] = "SSCHEB1";
+
+SSChebyshevEphemeris::SSChebyshevEphemeris ( void )
+{
+    _map = nullptr;
+    _mapSize = 0;
+    _header = nullptr;
+    _bodies = nullptr;
+}
+
+SSChebyshevEphemeris::~SSChebyshevEphemeris ( void )
+{
+    close();
+}
+
+// Compiles positions of bodies (ids) computed by an ephemeris function (func), which is passed user data
+// (userData), from jed0 to jed1 into polynomials of a given degree, and writes them to a file (filename).
+// Each body's window span starts at kMaxSpan days and is halved until every window fits to a tolerance
+// relative to the body's distance, or until the span reaches SSChebyshevCache::kMinSpan.
+// Returns true if successful, or false if the ephemeris function fails or the file can't be written.
+
+bool SSChebyshevEphemeris::compile ( const string &filename, const vector<int64_t> &ids, double jed0, double jed1, double tolerance, SSEphemerisFunc func, void *userData, int degree )
+{
+    if ( ids.empty() || ! ( jed1 > jed0 ) || degree < 2 )
+        return false;
+
+    int n = degree + 1;
+    vector<Body> bodies ( ids.size() );
+    vector<vector<double>> coeffs ( ids.size() );
+    int64_t offset = sizeof ( Header ) + ids.size() * sizeof ( Body );
+
+    for ( int i = 0; i < ids.size(); i++ )
+    {
+        double span = kMaxSpan;
+        int nwindows = 0;
+        bool fits = false;
+
+        while ( ! fits )
+        {
+            nwindows = (int) ceil ( ( jed1 - jed0 ) / span );
+            coeffs[i].resize ( 3 * n * nwindows );
+            fits = true;
+            for ( int w = 0; w < nwindows && fits; w++ )
+            {
+                double start = jed0 + w * span;
+                if ( ! SSChebyshevCache::chebyshevFitWindow ( func, userData, ids[i], start, start + span, degree, tolerance, &coeffs[i][3 * n * w], fits ) )
+                    return false;
+            }
+
+            // Accept the shortest span even if some windows are not within tolerance.
+
+            if ( span <= SSChebyshevCache::kMinSpan )
+                fits = true;
+            else if ( ! fits )
+                span /= 2.0;
+        }
+
+        bodies[i].id = ids[i];
+        bodies[i].degree = degree;
+        bodies[i].nwindows = nwindows;
+        bodies[i].span = span;
+        bodies[i].offset = offset;
+        offset += coeffs[i].size() * sizeof ( double );
+    }
+
+    Header header = { { 0 }, (int32_t) ids.size(), 0, jed0, jed1 };
+    memcpy ( header.magic, kMagic, sizeof ( kMagic ) );
+
+    ofstream file ( filename, ios::binary | ios::trunc );
+    if ( ! file )
+        return false;
+
+    file.write ( (const char *) &header, sizeof ( header ) );
+    file.write ( (const char *) &bodies[0], bodies.size() * sizeof ( Body ) );
+    for ( int i = 0; i < coeffs.size(); i++ )
+        file.write ( (const char *) &coeffs[i][0], coeffs[i].size() * sizeof ( double ) );
+
+    return file.good();
+}
+
+// Opens a compiled Chebyshev ephemeris file, memory-mapped if possible; otherwise reads it into memory.
+// Closes any file already open. Returns true if successful or false if the file can't be read or is not valid.
+
+bool SSChebyshevEphemeris::open ( const string &filename )
+{
+    close();
+
+    _map = (const char *) mapfile ( filename, _mapSize );
+    if ( _map != nullptr )
+    {
+        if ( validate ( _map, _mapSize ) )
+            return true;
+
+        close();
+        return false;
+    }
+
+    ifstream file ( filename, ios::binary | ios::ate );
+    if ( ! file )
+        return false;
+
+    size_t size = file.tellg();
+    if ( size < sizeof ( Header ) || size % sizeof ( double ) != 0 )
+        return false;
+
+    _data.resize ( size / sizeof ( double ) );
+    file.seekg ( 0 );
+    if ( file.read ( (char *) &_data[0], size ) && validate ( (const char *) &_data[0], size ) )
+        return true;
+
+    close();
+    return false;
+}
+
+// Validates the header and body table of a file's contents (file) of (size) bytes, so compute() never reads
+// outside the file, and points to them if valid. Returns true if valid, or false if not.
+
+bool SSChebyshevEphemeris::validate ( const char *file, size_t size )
+{
+    if ( size < sizeof ( Header ) || size % sizeof ( double ) != 0 )
+        return false;
+
+    const Header *header = (const Header *) file;
+    if ( memcmp ( header->magic, kMagic, sizeof ( kMagic ) ) != 0 || header->nbodies < 1 )
+        return false;
+
+    if ( sizeof ( Header ) + header->nbodies * sizeof ( Body ) > size )
+        return false;
+
+    const Body *bodies = (const Body *) ( header + 1 );
+    for ( int i = 0; i < header->nbodies; i++ )
+    {
+        const Body &body = bodies[i];
+        int64_t bytes = 3 * ( body.degree + 1 ) * sizeof ( double ) * (int64_t) body.nwindows;
+        if ( body.degree < 2 || body.nwindows < 1 || ! ( body.span > 0.0 ) || body.offset % sizeof ( double ) != 0 )
+            return false;
+        if ( body.offset < sizeof ( Header ) || body.offset + bytes > size )
+            return false;
+    }
+
+    _header = header;
+    _bodies = bodies;
+    return true;
+}
+
+// Closes Chebyshev ephemeris file and releases memory.
+
+void SSChebyshevEphemeris::close ( void )
+{
+    if ( _map != nullptr )
+        unmapfile ( _map, _mapSize );
+
+    _map = nullptr;
+    _mapSize = 0;
+    _data = vector<double>();
+    _header = nullptr;
+    _bodies = nullptr;
+}
+
+// Returns pointer to body table entry for a body identifier (id), or nullptr if not found.
+// Files hold a few dozen bodies at most, so a linear search is fast enough.
+
+const SSChebyshevEphemeris::Body *SSChebyshevEphemeris::findBody ( int64_t id )
+{
+    for ( int i = 0; i < getBodyCount(); i++ )
+        if ( _bodies[i].id == id )
+            return &_bodies[i];
+
+    return nullptr;
+}
+
+// Computes position (pos) and velocity (vel) of a body (id) at a Julian Ephemeris Date (jed).
+// Returns false, and does not modify pos or vel, if the body is not in the file or JED is outside
+// the file's time range.
+
+bool SSChebyshevEphemeris::compute ( int64_t id, double jed, SSVector &pos, SSVector &vel )
+{
+    const Body *body = findBody ( id );
+    if ( body == nullptr || ! ( jed >= _header->jed0 && jed <= _header->jed1 ) )
+        return false;
+
+    int w = (int) floor ( ( jed - _header->jed0 ) / body->span );
+    if ( w >= body->nwindows )
+        w = body->nwindows - 1;
+
+    int n = body->degree + 1;
+    const double *coeffs = (const double *) ( (const char *) _header + body->offset ) + 3 * n * w;
+    double half = body->span / 2.0;
+    double x = ( jed - _header->jed0 - w * body->span ) / half - 1.0;
+
+    SSChebyshevCache::chebyshevEval ( body->degree, coeffs, x, pos.x, vel.x );
+    SSChebyshevCache::chebyshevEval ( body->degree, coeffs + n, x, pos.y, vel.y );
+    SSChebyshevCache::chebyshevEval ( body->degree, coeffs + n + n, x, pos.z, vel.z );
+    vel /= half;
+
+    return true;
+}
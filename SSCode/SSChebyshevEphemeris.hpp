@@ -0,0 +1,98 @@
+// SSChebyshevEphemeris.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class compiles positions from any ephemeris function into a compact binary file
+// of Chebyshev polynomials, like a JPL DE file, and computes positions and velocities from it.
+// Each body has its own polynomial degree and fixed window span, so the window containing any
+// time is found directly. The file is laid out with 8-byte aligned fields so it can be memory-mapped
+// (or, where that isn't possible, read straight into memory) and used without any unpacking.
+//
+// File layout (all values in native byte order, which is little-endian on all supported platforms):
+//   Header: char magic[8] = "SSCHEB1", int32 number of bodies, int32 reserved, double start JED, double stop JED.
+//   Body table, one entry per body: int64 identifier, int32 degree, int32 number of windows,
+//   double window span in days, int64 byte offset of first window's coefficients from start of file.
+//   Coefficients: for each window, ( degree + 1 ) doubles for each of x, y, z.
+// Positions are in AU and are in whatever frame the ephemeris function returns - for SSPlanet,
+// heliocentric fundamental J2000 equatorial.
+
+#ifndef SSChebyshevEphemeris_hpp
+#define SSChebyshevEphemeris_hpp
+
+#include <string>
+
+#include "SSChebyshevCache.hpp"
+
+class SSChebyshevEphemeris
+{
+public:
+
+    static constexpr int kDefaultDegree = 12;           // degree of compiled polynomials
+    static constexpr double kMaxSpan = 256.0;           // longest window span which will be compiled, in days
+
+protected:
+
+#pragma pack(push, 1)
+
+    struct Header
+    {
+        char magic[8];          // "SSCHEB1" plus terminating zero
+        int32_t nbodies;        // number of bodies in file
+        int32_t reserved;       // always zero
+        double jed0, jed1;      // start and stop JED
+    };
+
+    struct Body
+    {
+        int64_t id;             // body identifier
+        int32_t degree;         // degree of polynomials
+        int32_t nwindows;       // number of windows
+        double span;            // window span, in days
+        int64_t offset;         // offset of first window's coefficients from start of file, in bytes
+    };
+
+#pragma pack(pop)
+
+    const char *_map;           // memory-mapped file, or nullptr if not mapped
+    size_t _mapSize;            // size of memory-mapped file in bytes
+    vector<double> _data;       // file contents, if not mapped; stored as doubles to guarantee alignment
+    const Header *_header;      // points to header at start of file, or nullptr if no file is open
+    const Body *_bodies;        // points to body table following header
+
+    bool validate ( const char *file, size_t size );
+    const Body *findBody ( int64_t id );
+
+public:
+
+    SSChebyshevEphemeris ( void );
+    SSChebyshevEphemeris ( const SSChebyshevEphemeris &other ) = delete;
+    SSChebyshevEphemeris &operator = ( const SSChebyshevEphemeris &other ) = delete;
+    ~SSChebyshevEphemeris ( void );
+
+    // Compiles positions of bodies (ids) computed by an ephemeris function (func) from jed0 to jed1,
+    // to a tolerance relative to distance, and writes them to a Chebyshev ephemeris file.
+
+    static bool compile ( const string &filename, const vector<int64_t> &ids, double jed0, double jed1, double tolerance, SSEphemerisFunc func, void *userData = nullptr, int degree = kDefaultDegree );
+
+    // Opens and closes a compiled Chebyshev ephemeris file.
+
+    bool open ( const string &filename );
+    bool isOpen ( void ) { return _header != nullptr; }
+    void close ( void );
+
+    // Gets start and stop Julian Ephemeris Date, number of bodies, and i-th body identifier.
+
+    double getStartJED ( void ) { return _header ? _header->jed0 : 0.0; }
+    double getStopJED ( void ) { return _header ? _header->jed1 : 0.0; }
+    int getBodyCount ( void ) { return _header ? _header->nbodies : 0; }
+    int64_t getBodyID ( int i ) { return i >= 0 && i < getBodyCount() ? _bodies[i].id : 0; }
+    size_t getBytes ( void ) { return _map ? _mapSize : _data.size() * sizeof ( double ); }
+
+    // Computes body position and velocity at a given JED; returns false if body or JED is not in the file.
+
+    bool compute ( int64_t id, double jed, SSVector &pos, SSVector &vel );
+};
+
+#endif /* SSChebyshevEphemeris_hpp */
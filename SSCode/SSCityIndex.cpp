@@ -0,0 +1,245 @@
+// SSCityIndex.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <algorithm>
+#include <ctime>
+
+#include "SSCityIndex.hpp"
+
+static constexpr size_t kLeafSize = 8;      // k-d tree nodes with this many cities or fewer are searched linearly
+
+int SSCityIndex::build ( SSObjectArray &objects )
+{
+    _nodes.clear();
+    for ( size_t i = 0; i < objects.size(); i++ )
+    {
+        SSCityPtr pCity = SSGetCityPtr ( objects[i] );
+        if ( pCity == nullptr )
+            continue;
+
+        SSVector pos = SSSpherical ( SSAngle::fromDegrees ( pCity->getLongitude() ), SSAngle::fromDegrees ( pCity->getLatitude() ), 1.0 );
+        _nodes.push_back ( { { pos.x, pos.y, pos.z }, pCity, pCity->getPopulation() } );
+    }
+
+    buildNode ( 0, _nodes.size(), 0 );
+    return (int) _nodes.size();
+}
+
+// Builds a k-d tree node from cities (begin) up to (end), split at the median of coordinate (axis).
+
+void SSCityIndex::buildNode ( size_t begin, size_t end, int axis )
+{
+    if ( end - begin <= kLeafSize )
+        return;
+
+    size_t mid = begin + ( end - begin ) / 2;
+    nth_element ( _nodes.begin() + begin, _nodes.begin() + mid, _nodes.begin() + end,
+                  [axis] ( const Node &n1, const Node &n2 ) { return n1.pos[axis] < n2.pos[axis]; } );
+
+    buildNode ( begin, mid, ( axis + 1 ) % 3 );
+    buildNode ( mid + 1, end, ( axis + 1 ) % 3 );
+}
+
+// Squared chord distance between a node's position and a unit vector (c); increases with angular distance.
+
+static inline double chord2 ( const double pos[3], const double c[3] )
+{
+    double dx = pos[0] - c[0], dy = pos[1] - c[1], dz = pos[2] - c[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Appends squared chord distances and indices of cities in a k-d tree node, within squared chord distance (maxDist2)
+// of a unit vector (c), and with population at least (minPopulation), to (found).
+
+void SSCityIndex::searchNode ( size_t begin, size_t end, int axis, const double c[3], double maxDist2, int minPopulation, vector<pair<double,size_t>> &found )
+{
+    if ( end - begin <= kLeafSize )
+    {
+        for ( size_t i = begin; i < end; i++ )
+        {
+            double d2 = chord2 ( _nodes[i].pos, c );
+            if ( d2 <= maxDist2 && _nodes[i].population >= minPopulation )
+                found.push_back ( { d2, i } );
+        }
+        return;
+    }
+
+    size_t mid = begin + ( end - begin ) / 2;
+    const Node &n = _nodes[mid];
+    double delta = c[axis] - n.pos[axis];
+
+    if ( delta <= 0.0 || delta * delta <= maxDist2 )
+        searchNode ( begin, mid, ( axis + 1 ) % 3, c, maxDist2, minPopulation, found );
+
+    double d2 = chord2 ( n.pos, c );
+    if ( d2 <= maxDist2 && n.population >= minPopulation )
+        found.push_back ( { d2, mid } );
+
+    if ( delta >= 0.0 || delta * delta <= maxDist2 )
+        searchNode ( mid + 1, end, ( axis + 1 ) % 3, c, maxDist2, minPopulation, found );
+}
+
+// Keeps the (k) cities in a k-d tree node and (heap) nearest a unit vector (c), with population at least (minPopulation),
+// in (heap), a max-heap of squared chord distances and indices. Visits the child on the same side as (c) first,
+// and the other child only if it may hold a city nearer than the farthest one kept.
+
+void SSCityIndex::nearestNode ( size_t begin, size_t end, int axis, const double c[3], size_t k, int minPopulation, vector<pair<double,size_t>> &heap )
+{
+    auto consider = [&] ( size_t i )
+    {
+        if ( _nodes[i].population < minPopulation )
+            return;
+
+        double d2 = chord2 ( _nodes[i].pos, c );
+        if ( heap.size() < k )
+        {
+            heap.push_back ( { d2, i } );
+            push_heap ( heap.begin(), heap.end() );
+        }
+        else if ( d2 < heap.front().first )
+        {
+            pop_heap ( heap.begin(), heap.end() );
+            heap.back() = { d2, i };
+            push_heap ( heap.begin(), heap.end() );
+        }
+    };
+
+    if ( end - begin <= kLeafSize )
+    {
+        for ( size_t i = begin; i < end; i++ )
+            consider ( i );
+        return;
+    }
+
+    size_t mid = begin + ( end - begin ) / 2;
+    double delta = c[axis] - _nodes[mid].pos[axis];
+
+    if ( delta <= 0.0 )
+        nearestNode ( begin, mid, ( axis + 1 ) % 3, c, k, minPopulation, heap );
+    else
+        nearestNode ( mid + 1, end, ( axis + 1 ) % 3, c, k, minPopulation, heap );
+
+    consider ( mid );
+
+    if ( heap.size() < k || delta * delta < heap.front().first )
+    {
+        if ( delta <= 0.0 )
+            nearestNode ( mid + 1, end, ( axis + 1 ) % 3, c, k, minPopulation, heap );
+        else
+            nearestNode ( begin, mid, ( axis + 1 ) % 3, c, k, minPopulation, heap );
+    }
+}
+
+// Sorts found cities (found) by distance, and appends them to (results) with their angular distances.
+// Returns the number of cities found.
+
+int SSCityIndex::makeResults ( vector<pair<double,size_t>> &found, vector<Result> &results )
+{
+    sort ( found.begin(), found.end() );
+    for ( const pair<double,size_t> &f : found )
+        results.push_back ( { _nodes[f.second].pCity, SSAngle ( 2.0 * asin ( min ( sqrt ( f.first ) / 2.0, 1.0 ) ) ) } );
+
+    return (int) found.size();
+}
+
+int SSCityIndex::nearest ( SSAngle lon, SSAngle lat, int k, vector<Result> &results, int minPopulation )
+{
+    if ( k <= 0 || _nodes.empty() )
+        return 0;
+
+    SSVector pos = SSSpherical ( lon, lat, 1.0 );
+    double c[3] = { pos.x, pos.y, pos.z };
+    vector<pair<double,size_t>> heap;
+    heap.reserve ( k );
+    nearestNode ( 0, _nodes.size(), 0, c, k, minPopulation, heap );
+    return makeResults ( heap, results );
+}
+
+int SSCityIndex::search ( SSAngle lon, SSAngle lat, SSAngle radius, vector<Result> &results, int minPopulation )
+{
+    if ( _nodes.empty() )
+        return 0;
+
+    SSVector pos = SSSpherical ( lon, lat, 1.0 );
+    double c[3] = { pos.x, pos.y, pos.z };
+    double chord = radius < SSAngle::kPi ? 2.0 * sin ( radius / 2.0 ) : 2.0;
+    vector<pair<double,size_t>> found;
+    searchNode ( 0, _nodes.size(), 0, c, chord * chord, minPopulation, found );
+    return makeResults ( found, results );
+}
+
+// Returns whether daylight saving time is in effect at a Unix time (t) in the current process time zone.
+
+static bool localIsDST ( time_t t )
+{
+    struct tm lt = { 0 };
+#ifdef _MSC_VER
+    localtime_s ( &lt, &t );
+#else
+    localtime_r ( &t, &lt );
+#endif
+    return lt.tm_isdst;
+}
+
+// Finds the times when daylight saving time starts or ends in time zone (zone) during year (year) UTC.
+// Samples the year daily, then bisects each day where daylight saving time changed to the second.
+// Temporarily changes the process time zone, and restores it afterwards.
+
+SSCityIndex::DSTRules SSCityIndex::computeDSTRules ( const string &zone, int year )
+{
+    string savezone = get_timezonename();
+    set_timezonename ( zone );
+
+    time_t start = SSTime ( SSDate ( kGregorian, 0.0, year, 1, 1.0 ) ).toUnixTime();
+    time_t end = SSTime ( SSDate ( kGregorian, 0.0, year + 1, 1, 1.0 ) ).toUnixTime();
+    DSTRules rules = { localIsDST ( start ) };
+    bool dst = rules.dstAtStart;
+
+    for ( time_t day = start; day < end; day += 86400 )
+    {
+        time_t next = min ( day + 86400, end );
+        if ( localIsDST ( next ) == dst )
+            continue;
+
+        time_t lo = day, hi = next;
+        while ( hi - lo > 1 )
+        {
+            time_t mid = lo + ( hi - lo ) / 2;
+            if ( localIsDST ( mid ) == dst )
+                lo = mid;
+            else
+                hi = mid;
+        }
+
+        rules.changes.push_back ( hi );
+        dst = ! dst;
+    }
+
+    set_timezonename ( savezone );
+    return rules;
+}
+
+bool SSCityIndex::isDST ( const string &zone, SSTime time )
+{
+    time_t t = time.toUnixTime();
+    int year = SSDate ( SSTime ( time.jd, 0.0 ), kGregorian ).year;
+
+    lock_guard<mutex> lock ( _dstMutex );
+    pair<string,int> key ( zone, year );
+    map<pair<string,int>,DSTRules>::iterator it = _dstRules.find ( key );
+    if ( it == _dstRules.end() )
+        it = _dstRules.insert ( { key, computeDSTRules ( zone, year ) } ).first;
+
+    const DSTRules &rules = it->second;
+    size_t nchanges = upper_bound ( rules.changes.begin(), rules.changes.end(), (int64_t) t ) - rules.changes.begin();
+    return rules.dstAtStart != ( nchanges % 2 == 1 );
+}
+
+void SSCityIndex::clearDSTCache ( void )
+{
+    lock_guard<mutex> lock ( _dstMutex );
+    _dstRules.clear();
+}
@@ -0,0 +1,93 @@
+// SSCityIndex.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class indexes cities (SSCity objects) by location, so the cities nearest a position on Earth (e.g. a GPS fix),
+// or within a given distance of it, can be found without testing every city. Cities are stored in a k-d tree of unit
+// vectors toward their geodetic longitudes and latitudes, the same kind of tree SSObjectArray builds for stars.
+// Distances are great-circle angles on a spherical Earth; queries can skip cities below a minimum population.
+// The index also caches daylight saving time rules for each time zone and year, so isDST() doesn't have to change
+// the process time zone for every call. The index does not own the cities; they must outlive it.
+
+#ifndef SSCityIndex_hpp
+#define SSCityIndex_hpp
+
+#include <map>
+#include <mutex>
+
+#include "SSFeature.hpp"
+
+class SSCityIndex
+{
+public:
+
+    // A city found by a query, and its angular distance from the query position in radians.
+
+    struct Result
+    {
+        SSCityPtr pCity;
+        SSAngle distance;
+    };
+
+protected:
+
+    struct Node
+    {
+        double pos[3];          // unit vector toward city's geodetic longitude and latitude
+        SSCityPtr pCity;        // city, not owned
+        int population;         // city's population; -1 if unknown
+    };
+
+    // Times when daylight saving time starts or ends in one time zone during one year.
+
+    struct DSTRules
+    {
+        bool dstAtStart;        // whether daylight saving time is in effect at the start of the year
+        vector<int64_t> changes;    // Unix times when daylight saving time starts or ends, in ascending order
+    };
+
+    vector<Node> _nodes;                            // k-d tree of cities, in tree order
+    map<pair<string,int>,DSTRules> _dstRules;       // daylight saving time rules by time zone name and year
+    mutex _dstMutex;                                // protects daylight saving time rules
+
+    void buildNode ( size_t begin, size_t end, int axis );
+    void searchNode ( size_t begin, size_t end, int axis, const double c[3], double maxDist2, int minPopulation, vector<pair<double,size_t>> &found );
+    void nearestNode ( size_t begin, size_t end, int axis, const double c[3], size_t k, int minPopulation, vector<pair<double,size_t>> &heap );
+    int makeResults ( vector<pair<double,size_t>> &found, vector<Result> &results );
+    static DSTRules computeDSTRules ( const string &zone, int year );
+
+public:
+
+    SSCityIndex ( void ) {}
+    SSCityIndex ( SSObjectArray &objects ) { build ( objects ); }
+
+    // Indexes all cities in an object array (objects), replacing any cities indexed before; other objects are ignored.
+    // Returns the number of cities indexed.
+
+    int build ( SSObjectArray &objects );
+    size_t size ( void ) { return _nodes.size(); }
+
+    // Finds up to (k) cities nearest a position at geodetic longitude (lon) and latitude (lat) in radians, whose population
+    // is at least (minPopulation); cities of unknown population are only found if (minPopulation) is zero or less.
+    // Results are appended to (results) in order of increasing distance. Returns the number of cities found.
+
+    int nearest ( SSAngle lon, SSAngle lat, int k, vector<Result> &results, int minPopulation = 0 );
+
+    // Finds all cities within an angular distance (radius) of a position at geodetic longitude (lon) and latitude (lat),
+    // whose population is at least (minPopulation), as for nearest(); appends them to (results) in order of increasing
+    // distance, and returns the number found.
+
+    int search ( SSAngle lon, SSAngle lat, SSAngle radius, vector<Result> &results, int minPopulation = 0 );
+
+    // Returns whether daylight saving time is in effect at a time (time) in an IANA time zone (zone, e.g. "America/Los_Angeles"),
+    // or in a city's time zone. The same as SSCoordinates::isDST() with that zone set, but the zone's rules for each year are
+    // found once, by temporarily setting the process time zone, and cached; that is not safe while other threads use local time.
+
+    bool isDST ( const string &zone, SSTime time );
+    bool isDST ( SSCityPtr pCity, SSTime time ) { return isDST ( pCity->getTimezoneName(), time ); }
+    void clearDSTCache ( void );
+};
+
+#endif /* SSCityIndex_hpp */
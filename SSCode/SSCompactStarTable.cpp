@@ -0,0 +1,313 @@
+// SSCompactStarTable.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include "SSCompactStarTable.hpp"
+
+SSCompactStarTable::SSCompactStarTable ( void )
+{
+    _maxMotion = _maxParallax = -1.0;
+}
+
+void SSCompactStarTable::clear ( void )
+{
+    for ( vector<int32_t> *col : { &_px, &_py, &_pz } )
+        col->clear();
+    for ( vector<int16_t> *col : { &_vx, &_vy, &_vz, &_bmv } )
+        col->clear();
+    _plx.clear();
+    _mag.clear();
+    ident.clear();
+    _maxMotion = _maxParallax = -1.0;
+}
+
+void SSCompactStarTable::reserve ( size_t size )
+{
+    for ( vector<int32_t> *col : { &_px, &_py, &_pz } )
+        col->reserve ( size );
+    for ( vector<int16_t> *col : { &_vx, &_vy, &_vz, &_bmv } )
+        col->reserve ( size );
+    _plx.reserve ( size );
+    _mag.reserve ( size );
+    ident.reserve ( size );
+}
+
+bool SSCompactStarTable::push_back ( SSObjectPtr pObject, SSCatalog cat )
+{
+    SSStarPtr pStar = SSGetStarPtr ( pObject );
+    if ( pStar == nullptr )
+        return false;
+
+    // Unknown space velocity is stored as zero, as in SSStarTable.
+
+    SSVector pos = pStar->getFundamentalPosition().normalize();
+    SSVector vel = pStar->getFundamentalVelocity();
+    if ( vel.isinf() || vel.isnan() )
+        vel = SSVector ( 0.0, 0.0, 0.0 );
+
+    double vx = round ( vel.x / kMotionUnit ), vy = round ( vel.y / kMotionUnit ), vz = round ( vel.z / kMotionUnit );
+    if ( fabs ( vx ) > INT16_MAX || fabs ( vy ) > INT16_MAX || fabs ( vz ) > INT16_MAX )
+        return false;
+
+    float plx = pStar->getParallax() > 0.0 ? round ( pStar->getParallax() / kParallaxUnit ) : 0.0;
+    if ( ! ( plx <= UINT16_MAX ) )
+        return false;
+
+    float vmag = pStar->getVMagnitude(), bmag = pStar->getBMagnitude();
+    float mag = vmag < INFINITY ? vmag : bmag;
+    float qmag = round ( ( mag - kMagMin ) / kMagUnit );
+    if ( ! ( qmag >= 0.0 && qmag < kUnknownMag ) )
+        return false;
+
+    float bmv = vmag < INFINITY && bmag < INFINITY ? round ( ( bmag - vmag ) / kMagUnit ) : kUnknownColor;
+    bmv = min ( max ( bmv, (float) kUnknownColor ), (float) INT16_MAX );
+
+    _px.push_back ( (int32_t) round ( pos.x * kPositionScale ) );
+    _py.push_back ( (int32_t) round ( pos.y * kPositionScale ) );
+    _pz.push_back ( (int32_t) round ( pos.z * kPositionScale ) );
+    _vx.push_back ( (int16_t) vx );
+    _vy.push_back ( (int16_t) vy );
+    _vz.push_back ( (int16_t) vz );
+    _plx.push_back ( (uint16_t) plx );
+    _mag.push_back ( (uint16_t) qmag );
+    _bmv.push_back ( (int16_t) bmv );
+    ident.push_back ( cat == kCatUnknown ? pStar->getIdentifier ( 0 ) : pStar->getIdentifier ( cat ) );
+
+    _maxMotion = _maxParallax = -1.0;
+    return true;
+}
+
+int SSCompactStarTable::append ( SSObjectArray &objects, SSCatalog cat )
+{
+    int n = 0;
+
+    reserve ( size() + objects.size() );
+    for ( size_t i = 0; i < objects.size(); i++ )
+        if ( push_back ( objects[i], cat ) )
+            n++;
+
+    return n;
+}
+
+// Rearranges elements of a column (col) so the k-th element is the one formerly at index order[k].
+
+template<class T> static void reorder_column ( vector<T> &col, const vector<uint32_t> &order )
+{
+    vector<T> old;
+    old.swap ( col );
+    col.reserve ( order.size() );
+    for ( uint32_t k : order )
+        col.push_back ( old[k] );
+}
+
+void SSCompactStarTable::reorder ( const vector<uint32_t> &order )
+{
+    if ( order.size() != size() )
+        return;
+
+    for ( vector<int32_t> *col : { &_px, &_py, &_pz } )
+        reorder_column ( *col, order );
+    for ( vector<int16_t> *col : { &_vx, &_vy, &_vz, &_bmv } )
+        reorder_column ( *col, order );
+    reorder_column ( _plx, order );
+    reorder_column ( _mag, order );
+    reorder_column ( ident, order );
+}
+
+SSVector SSCompactStarTable::getFundamentalPosition ( size_t k )
+{
+    return SSVector ( _px[k] / kPositionScale, _py[k] / kPositionScale, _pz[k] / kPositionScale ).normalize();
+}
+
+SSVector SSCompactStarTable::getFundamentalVelocity ( size_t k )
+{
+    return SSVector ( _vx[k] * kMotionUnit, _vy[k] * kMotionUnit, _vz[k] * kMotionUnit );
+}
+
+// Decodes positions and applies space motion and parallax in single precision, then normalizes; the decoded
+// position is within 1.0e-9 of unit length, so magnitudes change only where motion or parallax were applied.
+
+void SSCompactStarTable::computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end, float *x, float *y, float *z, float *mags )
+{
+    end = min ( end, size() );
+    if ( begin >= end )
+        return;
+
+    size_t n = end - begin;
+    const float pscale = 1.0 / kPositionScale;
+    const int32_t *px = &_px[begin], *py = &_py[begin], *pz = &_pz[begin];
+    for ( size_t i = 0; i < n; i++ )
+    {
+        x[i] = px[i] * pscale;
+        y[i] = py[i] * pscale;
+        z[i] = pz[i] * pscale;
+    }
+
+    if ( coords.getStarMotion() )
+    {
+        float years = ( coords.getJED() - SSTime::kJ2000 ) / SSTime::kDaysPerJulianYear;
+        float vscale = years * kMotionUnit;
+        const int16_t *vx = &_vx[begin], *vy = &_vy[begin], *vz = &_vz[begin];
+        for ( size_t i = 0; i < n; i++ )
+        {
+            x[i] += vx[i] * vscale;
+            y[i] += vy[i] * vscale;
+            z[i] += vz[i] * vscale;
+        }
+    }
+
+    // Parallax of stars at or above the limit; the comparison is done on the quantized column.
+
+    if ( coords.getStarParallax() )
+    {
+        SSVector obs = coords.getObserverPosition();
+        float limit = coords.getStarParallaxLimit();
+        uint16_t qlimit = (uint16_t) min ( max ( ceil ( limit / kParallaxUnit ), 1.0f ), (float) UINT16_MAX );
+        float ox = obs.x, oy = obs.y, oz = obs.z, s = kParallaxUnit / SSCoordinates::kAUPerParsec;
+        const uint16_t *plx = &_plx[begin];
+        for ( size_t i = 0; i < n; i++ )
+        {
+            if ( plx[i] < qlimit )
+                continue;
+            x[i] -= ox * plx[i] * s;
+            y[i] -= oy * plx[i] * s;
+            z[i] -= oz * plx[i] * s;
+        }
+    }
+
+    const uint16_t *m = &_mag[begin];
+    for ( size_t i = 0; i < n; i++ )
+    {
+        float delta = sqrt ( x[i] * x[i] + y[i] * y[i] + z[i] * z[i] );
+        x[i] /= delta;
+        y[i] /= delta;
+        z[i] /= delta;
+        mags[i] = m[i] == kUnknownMag ? INFINITY : m[i] * kMagUnit + kMagMin + 5.0f * log10 ( delta );
+    }
+
+    if ( coords.getAberration() )
+        coords.applyAberration ( x, y, z, n );
+}
+
+// Returns the most any star's apparent direction can differ from its J2000 direction at the time and location
+// in (coords), as SSStarTable::cullMargin() does; or infinity if motion is too large to bound this way.
+
+double SSCompactStarTable::cullMargin ( SSCoordinates &coords )
+{
+    if ( _maxMotion < 0.0 )
+    {
+        _maxMotion = _maxParallax = 0.0;
+        for ( size_t i = 0; i < size(); i++ )
+        {
+            double vx = _vx[i], vy = _vy[i], vz = _vz[i];
+            _maxMotion = max ( _maxMotion, vx * vx + vy * vy + vz * vz );
+            _maxParallax = max ( _maxParallax, (float) _plx[i] );
+        }
+        _maxMotion = sqrt ( _maxMotion ) * kMotionUnit;
+        _maxParallax *= kParallaxUnit;
+    }
+
+    double motion = 0.0;
+    if ( coords.getStarMotion() )
+        motion = _maxMotion * fabs ( coords.getJED() - SSTime::kJ2000 ) / SSTime::kDaysPerJulianYear;
+
+    if ( motion >= 0.5 )
+        return INFINITY;
+
+    double margin = asin ( motion );
+    if ( coords.getStarParallax() )
+        margin += asin ( min ( coords.getObserverPosition().magnitude() * _maxParallax / SSCoordinates::kAUPerParsec / ( 1.0 - motion ), 1.0 ) );
+    if ( coords.getAberration() )
+        margin += asin ( min ( coords.getObserverVelocity().magnitude() / SSCoordinates::kLightAUPerDay, 1.0 ) );
+
+    return margin + kCullSlack;
+}
+
+// Tests J2000 directions of stars from (begin) up to (end) against caps in (bounds), and stores runs of stars to compute
+// in _runs, as SSStarTable::cull() does. Returns the number of stars in runs.
+
+size_t SSCompactStarTable::cull ( SSCoordinates &coords, size_t begin, size_t end, const vector<SSStarTable::Bound> &bounds )
+{
+    size_t n = end - begin;
+    const int32_t *px = &_px[begin], *py = &_py[begin], *pz = &_pz[begin];
+    double margin = cullMargin ( coords );
+
+    _keep.assign ( n, 1 );
+    uint8_t *keep = _keep.data();
+    for ( const SSStarTable::Bound &bound : bounds )
+    {
+        if ( bound.radius + margin >= SSAngle::kPi )
+            continue;
+
+        double cx = bound.center.x, cy = bound.center.y, cz = bound.center.z, cosr = cos ( bound.radius + margin ) * kPositionScale;
+        for ( size_t i = 0; i < n; i++ )
+            keep[i] &= px[i] * cx + py[i] * cy + pz[i] * cz >= cosr;
+    }
+
+    size_t computed = 0;
+    _runs.clear();
+    for ( size_t i = 0; i < n; i++ )
+    {
+        if ( ! keep[i] )
+            continue;
+        if ( _runs.empty() || begin + i - _runs.back().second > kCullGap )
+            _runs.push_back ( { begin + i, begin + i } );
+        computed += begin + i + 1 - _runs.back().second;
+        _runs.back().second = begin + i + 1;
+    }
+
+    return computed;
+}
+
+size_t SSCompactStarTable::computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end, float *x, float *y, float *z, float *mags, const vector<SSStarTable::Bound> &bounds )
+{
+    end = min ( end, size() );
+    if ( begin >= end )
+        return 0;
+
+    auto reject = [&] ( size_t from, size_t to )
+    {
+        for ( float *col : { x, y, z, mags } )
+            fill ( col + from - begin, col + to - begin, INFINITY );
+    };
+
+    size_t computed = cull ( coords, begin, end, bounds ), i = begin;
+    for ( const pair<size_t,size_t> &run : _runs )
+    {
+        size_t j = run.first - begin;
+        reject ( i, run.first );
+        computeEphemeris ( coords, run.first, run.second, x + j, y + j, z + j, mags + j );
+        i = run.second;
+    }
+    reject ( i, end );
+
+    return computed;
+}
+
+// Visual magnitude is restored from the stored magnitude, which was blue magnitude for stars without a visual one.
+
+SSStarPtr SSCompactStarTable::materialize ( size_t k )
+{
+    if ( k >= size() )
+        return nullptr;
+
+    SSStarPtr pStar = new SSStar();
+    float mag = getMagnitude ( k ), bmv = getColorIndex ( k );
+    pStar->setFundamentalPosition ( getFundamentalPosition ( k ) );
+    pStar->setFundamentalVelocity ( getFundamentalVelocity ( k ) );
+    pStar->setParallax ( getParallax ( k ) );
+    pStar->setVMagnitude ( mag );
+    pStar->setBMagnitude ( bmv < INFINITY ? mag + bmv : INFINITY );
+    if ( ident[k] )
+        pStar->addIdentifier ( ident[k] );
+
+    return pStar;
+}
+
+size_t SSCompactStarTable::memoryUsage ( void )
+{
+    return vecbytes ( _px ) + vecbytes ( _py ) + vecbytes ( _pz ) + vecbytes ( _vx ) + vecbytes ( _vy ) + vecbytes ( _vz )
+         + vecbytes ( _plx ) + vecbytes ( _mag ) + vecbytes ( _bmv ) + vecbytes ( ident ) + vecbytes ( _keep ) + vecbytes ( _runs );
+}
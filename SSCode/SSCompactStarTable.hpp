@@ -0,0 +1,106 @@
+// SSCompactStarTable.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// A columnar store for very large numbers of faint stars, e.g. the deep Tycho or Gaia levels of an SSHTM, quantized to the
+// precision a display needs, in 32 bytes per star: about a quarter of an SSStarTable row, and a fifth of an SSStar object.
+// J2000 positions are unit vectors with 32-bit fixed-point components (resolution 0.1 milliarcseconds); space velocities
+// have 16-bit components in units of 0.1 milliarcseconds per year; parallax and visual magnitude are 16-bit, and B-V
+// color index 16-bit; each star keeps one identifier, and no names or spectral types. Stars whose values don't fit -
+// proper motion over 3.2 arcseconds per year, parallax over 6.5 arcseconds, or no magnitude - are rejected, and should
+// be kept in an SSStarTable instead. Apparent directions and magnitudes are computed straight from the quantized columns
+// with the same single-precision arithmetic as SSStarTable's float computeEphemeris(), and SSStarPipeline can draw from
+// this table directly. Directions agree with SSStarTable's to about 1.0e-7 radians, and magnitudes to 0.001.
+
+#ifndef SSCompactStarTable_hpp
+#define SSCompactStarTable_hpp
+
+#include "SSStarTable.hpp"
+
+class SSCompactStarTable
+{
+public:
+
+    static constexpr double kPositionScale = 2147483647.0;          // fixed-point units per unit vector component
+    static constexpr double kMotionUnit = 1.0e-4 / SSAngle::kArcsecPerRad;  // radians per year per unit of space velocity
+    static constexpr float kParallaxUnit = 1.0e-4;                  // arcseconds per unit of parallax
+    static constexpr float kMagUnit = 0.001;                        // magnitudes per unit of magnitude and color index
+    static constexpr float kMagMin = -2.0;                          // magnitude stored as zero
+    static constexpr uint16_t kUnknownMag = 0xFFFF;                 // stored for unknown magnitude
+    static constexpr int16_t kUnknownColor = INT16_MIN;             // stored for unknown color index
+
+protected:
+
+    vector<int32_t> _px, _py, _pz;      // J2000 position unit vector components, in fixed-point units
+    vector<int16_t> _vx, _vy, _vz;      // space velocity components in units of kMotionUnit
+    vector<uint16_t> _plx;              // parallax in units of kParallaxUnit; zero if unknown
+    vector<uint16_t> _mag;              // visual magnitude (or blue if visual is unknown) minus kMagMin, in units of kMagUnit
+    vector<int16_t> _bmv;               // B-V color index in units of kMagUnit, or kUnknownColor
+
+    double _maxMotion;                  // largest space velocity in radians per year; negative until computed
+    float _maxParallax;                 // largest parallax in arcseconds; likewise
+    vector<uint8_t> _keep;              // nonzero for stars which survive culling; scratch storage for computeEphemeris()
+    vector<pair<size_t,size_t>> _runs;  // runs of stars to compute after culling; likewise
+
+    static constexpr size_t kCullGap = 16;          // runs of fewer rejected stars than this are computed anyway
+    static constexpr double kCullSlack = 1.0e-6;    // radians added to culling margin for rounding and quantization
+
+    double cullMargin ( SSCoordinates &coords );
+    size_t cull ( SSCoordinates &coords, size_t begin, size_t end, const vector<SSStarTable::Bound> &bounds );
+
+public:
+
+    vector<SSIdentifier> ident;         // one identifier per star; null if none
+
+    SSCompactStarTable ( void );
+
+    size_t size ( void ) { return ident.size(); }
+    void clear ( void );
+    void reserve ( size_t size );
+
+    // Appends a star, or any object stored as an SSStar, keeping its identifier in catalog (cat), or its first
+    // identifier if cat is kCatUnknown. Returns false (and does nothing) if the object is not an SSStar,
+    // or its values don't fit, as above.
+
+    bool push_back ( SSObjectPtr pObject, SSCatalog cat = kCatUnknown );
+
+    // Appends all stars in an object array which fit; returns number of objects appended.
+
+    int append ( SSObjectArray &objects, SSCatalog cat = kCatUnknown );
+
+    // Reorders the table so the k-th star is the one formerly at index order[k], as SSStarTable::reorder() does.
+
+    void reorder ( const vector<uint32_t> &order );
+
+    // Returns k-th star's values, decoded from their quantized form: J2000 position unit vector, space velocity in
+    // radians per year, parallax in arcseconds (zero if unknown), magnitude at J2000, and B-V color index
+    // (infinite if unknown).
+
+    SSVector getFundamentalPosition ( size_t k );
+    SSVector getFundamentalVelocity ( size_t k );
+    float getParallax ( size_t k ) { return _plx[k] * kParallaxUnit; }
+    float getMagnitude ( size_t k ) { return _mag[k] == kUnknownMag ? INFINITY : _mag[k] * kMagUnit + kMagMin; }
+    float getColorIndex ( size_t k ) { return _bmv[k] == kUnknownColor ? INFINITY : _bmv[k] * kMagUnit; }
+
+    // Computes apparent directions (x, y, z) and magnitudes (mags) of stars from (begin) up to (end), as
+    // SSStarTable's float computeEphemeris() does, applying space motion, heliocentric parallax (honoring the star
+    // parallax limit in coords), and aberration as enabled in (coords). Output arrays need room for end - begin values.
+    // The culling version rejects stars outside all caps in (bounds) first, as SSStarTable's does, setting their
+    // directions and magnitudes to infinity, and returns the number of stars computed.
+
+    void computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end, float *x, float *y, float *z, float *mags );
+    size_t computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end, float *x, float *y, float *z, float *mags, const vector<SSStarTable::Bound> &bounds );
+
+    // Creates a new star from the k-th star's decoded values, with its identifier; the caller owns (and must delete) it.
+    // Returns nullptr if k is out of range.
+
+    SSStarPtr materialize ( size_t k );
+
+    // Returns heap memory used by the table's columns, in bytes.
+
+    size_t memoryUsage ( void );
+};
+
+#endif /* SSCompactStarTable_hpp */
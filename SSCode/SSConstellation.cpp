@@ -7,9 +7,12 @@
 #include <iostream>
 #include <fstream>
 #include <map>
+#include <algorithm>
 
 #include "SSConstellation.hpp"
 #include "SSCoordinates.hpp"
+#include "SSStar.hpp"
+#include "SSStarTable.hpp"
 
 static vector<string> _convec =
 {
@@ -43,7 +46,7 @@ SSConstellation::SSConstellation ( SSObjectType type ) : SSObject ( type )
 string SSConstellation::indexToAbbreviation ( int index )
 {
     if ( index >=1 && index <= 88 )
-        return _convec[index];
+        return _convec[index - 1];
     else
         return "";
 }
@@ -68,7 +71,11 @@ int SSConstellation::abbreviationToIndex ( string abbrev )
 
 SSConstellationPtr SSGetConstellationPtr ( SSObjectPtr ptr )
 {
-    return dynamic_cast<SSConstellation *> ( ptr );
+    SSObjectFamily family = ptr ? SSGetObjectFamily ( ptr->getType() ) : kFamilyUnknown;
+    if ( family == kFamilyConstellation )
+        return static_cast<SSConstellation *> ( ptr );
+    
+    return family == kFamilyUnknown ? dynamic_cast<SSConstellation *> ( ptr ) : nullptr;
 }
 
 // Allocates a new SSConstellation and initializes it from a CSV-formatted string.
@@ -76,9 +83,17 @@ SSConstellationPtr SSGetConstellationPtr ( SSObjectPtr ptr )
 
 SSObjectPtr SSConstellation::fromCSV ( string csv )
 {
-    vector<string> fields = split ( csv, "," );
-    
-    SSObjectType type = SSObject::codeToType ( fields[0] );
+    SSCSVFields fields;
+    fields.split ( csv );
+    return fromCSV ( fields );
+}
+
+// Allocates a new SSConstellation and initializes it from a CSV-formatted string already split into fields.
+// Returns nullptr on error (invalid CSV fields, heap allocation failure, etc.)
+
+SSObjectPtr SSConstellation::fromCSV ( const SSCSVFields &fields )
+{
+    SSObjectType type = SSObject::codeToType ( fields.str ( 0 ) );
     if ( type < kTypeConstellation || type > kTypeAsterism || fields.size() < 8 )
         return nullptr;
     
@@ -94,7 +109,7 @@ SSObjectPtr SSConstellation::fromCSV ( string csv )
     pCon->setDirection ( center );
     pCon->setArea ( degtorad ( degtorad ( strtofloat64 ( fields[3] ) ) ) );
     pCon->setRank ( strtoint ( fields[4] ) );
-    pCon->setNames ( vector<string> ( &fields[5], &fields[8] ) );
+    pCon->setNames ( { fields.str ( 5 ), fields.str ( 6 ), fields.str ( 7 ) } );
 
     return pObject;
 }
@@ -127,7 +142,7 @@ int SSImportConstellations ( const string &filename, SSObjectVec &constellations
 {
     // Open file; return on failure.
 
-    FILE *file = fopen ( filename.c_str(), "rb" );
+    SSLineReader file ( filename );
     if ( ! file )
         return ( 0 );
 
@@ -136,7 +151,7 @@ int SSImportConstellations ( const string &filename, SSObjectVec &constellations
     string line = "";
     int numCons = 0;
 
-    while ( fgetline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         // Attempt to create constellation from CSV file line; continue on failure.
         
@@ -151,8 +166,6 @@ int SSImportConstellations ( const string &filename, SSObjectVec &constellations
         constellations.append ( pObject );
         numCons++;
     }
-    
-    fclose ( file );
     return numCons;
 }
 
@@ -182,7 +195,7 @@ void interpolateBoundary ( double ra0, double dec0, double ra1, double dec1, boo
     for ( int i = 0; i < nsteps; i++ )
     {
         SSVector vertex ( SSSpherical ( ra, dec, 1.0 ) );
-        static SSMatrix precess = SSCoordinates::getPrecessionMatrix ( SSTime::fromBesselianYear ( 1875.0 ) ).transpose();
+        static SSMatrix precess = SSCoordinates::getPrecessionMatrix ( SSTime::fromBesselianYear ( 1875.0 ), SSTime::kJ2000 );
         vertex = precess * vertex;
         bound.push_back ( vertex );
 
@@ -201,7 +214,7 @@ int SSImportConstellationBoundaries ( const string &filename, SSObjectVec &const
 {
     // Open file; return on failure.
 
-    FILE *file = fopen ( filename.c_str(), "rb" );
+    SSLineReader file ( filename );
     if ( ! file )
         return ( 0 );
 
@@ -216,7 +229,7 @@ int SSImportConstellationBoundaries ( const string &filename, SSObjectVec &const
     vector<SSVector> boundary ( 0 );
     SSConstellationPtr pCon = SSGetConstellationPtr ( constellations[0] );
 
-    while ( fgetline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         // Require 3 fields per line; skip if we don't have em.
         
@@ -242,7 +255,7 @@ int SSImportConstellationBoundaries ( const string &filename, SSObjectVec &const
             if ( pCon != nullptr && boundary.size() > 0 )
             {
                 interpolateBoundary ( ra0, dec0, ra00, dec00, true, 5.0, boundary );
-                pCon->setBoundary ( boundary );
+                pCon->setBoundary ( move ( boundary ) );
                 // cout << "Imported " << boundary.size() << " vertices for " << lastAbbr << endl;
                 ra0 = dec0 = 0.0;
             }
@@ -289,11 +302,10 @@ int SSImportConstellationBoundaries ( const string &filename, SSObjectVec &const
     
     if ( pCon != nullptr && boundary.size() > 0 )
     {
-        pCon->setBoundary ( boundary );
+        pCon->setBoundary ( move ( boundary ) );
         // cout << "Imported " << boundary.size() << " vertices for " << lastAbbr << endl;
     }
 
-    fclose ( file );
     return numVerts;
 }
 
@@ -307,7 +319,7 @@ int SSImportConstellationShapes ( const string &filename, SSObjectVec &constella
 {
     // Open file; return on failure.
 
-    FILE *file = fopen ( filename.c_str(), "rb" );
+    SSLineReader file ( filename );
     if ( ! file )
         return ( 0 );
 
@@ -318,7 +330,7 @@ int SSImportConstellationShapes ( const string &filename, SSObjectVec &constella
     vector<int> shape ( 0 );
     SSConstellationPtr pCon = SSGetConstellationPtr ( constellations[0] );
 
-    while ( fgetline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         // Require 3 fields per line; skip if we don't have enough.
         
@@ -341,7 +353,7 @@ int SSImportConstellationShapes ( const string &filename, SSObjectVec &constella
             
             if ( pCon != nullptr && shape.size() > 0 )
             {
-                pCon->setFigure ( shape );
+                pCon->setFigure ( move ( shape ) );
                 // cout << "Imported " << shape.size() / 2 << " shape lines for " << lastAbbr << endl;
             }
 
@@ -373,11 +385,10 @@ int SSImportConstellationShapes ( const string &filename, SSObjectVec &constella
     
     if ( pCon != nullptr && shape.size() > 0 )
     {
-        pCon->setFigure ( shape );
+        pCon->setFigure ( move ( shape ) );
         // cout << "Imported " << shape.size() / 2 << " shape lines for " << lastAbbr << endl;
     }
 
-    fclose ( file );
     return numLines;
 }
 
@@ -755,18 +766,96 @@ static CData _table[357] =
     {  0.0000, 24.0000, -90.0000, "Oct" }
 };
 
-// identifies constellation from position in B1875 equatorial cooordinates
-// (ra,dec) both in radians; returns 3-letter constellation abbreviation string.
+// Grid of cells in B1875 RA and Dec, each listing the rows of _table which may contain a point in that cell, in table order,
+// ending with the first row which contains the whole cell. Testing only those rows, in that order, finds the same row as
+// scanning the whole table. Cell bounds are widened by a small margin so rounding when finding a point's cell can't lose rows.
 
-string SSConstellation::identify ( double ra, double dec )
+static constexpr int kGridRA = 96;              // number of cells in RA; 15 minutes each
+static constexpr int kGridDec = 180;            // number of cells in Dec; 1 degree each
+static constexpr double kGridMargin = 1.0e-6;   // margin added to cell bounds [hours or degrees]
+
+struct CGrid
+{
+    vector<uint32_t> first;     // index of each cell's first row in rows; one extra entry marks the end of the last cell
+    vector<uint16_t> rows;      // rows of _table listed in each cell
+    int index[357];             // constellation index (1 ... 88) of each row of _table
+    
+    CGrid ( void );
+};
+
+CGrid::CGrid ( void )
 {
-    ra *= SSAngle::kHourPerRad;
-    dec *= SSAngle::kDegPerRad;
+    for ( int i = 0; i < 357; i++ )
+        index[i] = (int) ( find ( _convec.begin(), _convec.end(), string ( _table[i].con ) ) - _convec.begin() ) + 1;
     
+    for ( int d = 0; d < kGridDec; d++ )
+    {
+        double dec0 = d * 180.0 / kGridDec - 90.0 - kGridMargin, dec1 = ( d + 1 ) * 180.0 / kGridDec - 90.0 + kGridMargin;
+        for ( int r = 0; r < kGridRA; r++ )
+        {
+            double ra0 = r * 24.0 / kGridRA - kGridMargin, ra1 = ( r + 1 ) * 24.0 / kGridRA + kGridMargin;
+            first.push_back ( (uint32_t) rows.size() );
+            for ( int i = 0; i < 357; i++ )
+            {
+                if ( _table[i].ral < ra1 && _table[i].rau > ra0 && _table[i].decl < dec1 )
+                    rows.push_back ( i );
+                if ( _table[i].ral <= ra0 && _table[i].rau >= ra1 && _table[i].decl <= dec0 )
+                    break;
+            }
+        }
+    }
+    
+    first.push_back ( (uint32_t) rows.size() );
+}
+
+// Returns the row of _table containing B1875 (ra) in decimal hours and (dec) in decimal degrees, using the grid.
+// Positions outside the grid are found by scanning the whole table; the last row is returned if none contains them.
+
+static int findRow ( double ra, double dec, const CGrid &grid )
+{
     int i = 0;
-    while ( ra < _table[i].ral || ra >= _table[i].rau || dec < _table[i].decl )
+    
+    if ( ra >= 0.0 && ra < 24.0 && dec >= -90.0 && dec <= 90.0 )
+    {
+        int cell = min ( (int) ( ( dec + 90.0 ) * kGridDec / 180.0 ), kGridDec - 1 ) * kGridRA + min ( (int) ( ra * kGridRA / 24.0 ), kGridRA - 1 );
+        for ( uint32_t k = grid.first[cell]; k < grid.first[cell + 1]; k++ )
+        {
+            i = grid.rows[k];
+            if ( ! ( ra < _table[i].ral || ra >= _table[i].rau || dec < _table[i].decl ) )
+                return i;
+        }
+        i = 0;
+    }
+    
+    while ( i < 356 && ( ra < _table[i].ral || ra >= _table[i].rau || dec < _table[i].decl ) )
         i++;
-    return string ( _table[i].con );
+    return i;
+}
+
+// Returns the grid, building it on first use; safe if first used from several threads at once.
+
+static const CGrid &getGrid ( void )
+{
+    static CGrid grid;
+    return grid;
+}
+
+// identifies constellation from position in B1875 equatorial cooordinates
+// (ra,dec) both in radians; returns 3-letter constellation abbreviation string.
+
+string SSConstellation::identify ( double ra, double dec )
+{
+    return string ( _table[ findRow ( ra * SSAngle::kHourPerRad, dec * SSAngle::kDegPerRad, getGrid() ) ].con );
+}
+
+// Identifies constellations of (n) positions in B1875 equatorial coordinates, with right ascensions in (ra)
+// and declinations in (dec), both in radians. Returns constellation indices (1 ... 88) in (indices).
+
+void SSConstellation::identify ( size_t n, const double *ra, const double *dec, int *indices )
+{
+    const CGrid &grid = getGrid();
+    for ( size_t i = 0; i < n; i++ )
+        indices[i] = grid.index[ findRow ( ra[i] * SSAngle::kHourPerRad, dec[i] * SSAngle::kDegPerRad, grid ) ];
 }
 
 // identifies constellation from unit position vector in J2000 equatorial cooordinates.
@@ -774,7 +863,266 @@ string SSConstellation::identify ( double ra, double dec )
 
 string SSConstellation::identify ( SSVector position )
 {
-    static SSMatrix precess = SSCoordinates::getPrecessionMatrix ( SSTime::fromBesselianYear ( 1875.0 ) );
+    static SSMatrix precess = SSCoordinates::getPrecessionMatrix ( SSTime::kJ2000, SSTime::fromBesselianYear ( 1875.0 ) );
     SSSpherical coords = precess * position;
     return identify ( coords.lon, coords.lat );
 }
+
+// Identifies constellations of (n) positions in J2000 equatorial coordinates, given as separate arrays of x, y, z
+// coordinates, and returns constellation indices (1 ... 88) in (indices). Positions are precessed to B1875 in blocks,
+// in one pass per block which the compiler can vectorize; each result is the same as identify ( SSVector ).
+// Positions which are zero or not finite get index zero.
+
+void SSConstellation::identify ( size_t n, const double *x, const double *y, const double *z, int *indices )
+{
+    static SSMatrix precess = SSCoordinates::getPrecessionMatrix ( SSTime::kJ2000, SSTime::fromBesselianYear ( 1875.0 ) );
+    static constexpr size_t kBlockSize = 4096;
+    const CGrid &grid = getGrid();
+    double ra[kBlockSize], dec[kBlockSize];
+    
+    for ( size_t begin = 0; begin < n; begin += kBlockSize )
+    {
+        size_t size = min ( n - begin, kBlockSize );
+        const double *bx = x + begin, *by = y + begin, *bz = z + begin;
+        int *bindices = indices + begin;
+        
+        for ( size_t i = 0; i < size; i++ )
+        {
+            double px = precess.m00 * bx[i] + precess.m01 * by[i] + precess.m02 * bz[i];
+            double py = precess.m10 * bx[i] + precess.m11 * by[i] + precess.m12 * bz[i];
+            double pz = precess.m20 * bx[i] + precess.m21 * by[i] + precess.m22 * bz[i];
+            double r = sqrt ( px * px + py * py + pz * pz );
+            dec[i] = r > 0.0 && r < INFINITY ? asin ( pz / r ) : NAN;
+            ra[i] = mod2pi ( atan2 ( py, px ) );
+        }
+        
+        for ( size_t i = 0; i < size; i++ )
+            bindices[i] = ::isnan ( dec[i] ) ? 0 : grid.index[ findRow ( ra[i] * SSAngle::kHourPerRad, dec[i] * SSAngle::kDegPerRad, grid ) ];
+    }
+}
+
+// Identifies constellations of all objects in an array (objects), and returns their indices (1 ... 88) in (indices),
+// which is resized to match the array. Uses J2000 positions of stars, and other objects stored as SSStars;
+// uses current apparent directions of all other objects. Objects with unknown position get index zero.
+
+void SSConstellation::identify ( SSObjectArray &objects, vector<int> &indices )
+{
+    size_t n = objects.size();
+    vector<double> x ( n ), y ( n ), z ( n );
+    
+    for ( size_t i = 0; i < n; i++ )
+    {
+        SSStarPtr pStar = SSGetStarPtr ( objects[i] );
+        SSVector pos = pStar ? pStar->getFundamentalPosition() : objects[i]->getDirection();
+        x[i] = pos.x;
+        y[i] = pos.y;
+        z[i] = pos.z;
+    }
+    
+    indices.resize ( n );
+    identify ( n, x.data(), y.data(), z.data(), indices.data() );
+}
+
+// Identifies constellations of all stars in a star table (table) from their J2000 positions,
+// and returns their indices (1 ... 88) in (indices), which is resized to match the table.
+
+void SSConstellation::identify ( SSStarTable &table, vector<int> &indices )
+{
+    size_t n = table.size();
+    vector<double> x ( n ), y ( n ), z ( n );
+    
+    for ( size_t i = 0; i < n; i++ )
+    {
+        SSVector pos = table.getFundamentalPosition ( i );
+        x[i] = pos.x;
+        y[i] = pos.y;
+        z[i] = pos.z;
+    }
+    
+    indices.resize ( n );
+    identify ( n, x.data(), y.data(), z.data(), indices.data() );
+}
+
+SSConstellationLines::SSConstellationLines ( void )
+{
+    _valid = false;
+    _tolerance = kDefaultTolerance;
+}
+
+// Appends a polyline made of points (points) in constellation (constellation), if it has at least two points.
+
+void SSConstellationLines::addLine ( const vector<SSVector> &points, int constellation )
+{
+    if ( points.size() < 2 )
+        return;
+    
+    uint32_t begin = (uint32_t) _points.size();
+    _points.insert ( _points.end(), points.begin(), points.end() );
+    _lines.push_back ( { begin, (uint32_t) _points.size(), constellation } );
+}
+
+int SSConstellationLines::setBoundaries ( SSObjectVec &constellations, double res )
+{
+    static SSMatrix precess = SSCoordinates::getPrecessionMatrix ( SSTime::kJ2000, SSTime::fromBesselianYear ( 1875.0 ) );
+    SSMatrix unprecess = precess.transpose();
+
+    _points.clear();
+    _lines.clear();
+    _valid = false;
+    
+    for ( int i = 0; i < constellations.size(); i++ )
+    {
+        SSConstellationPtr pCon = SSGetConstellationPtr ( constellations[i] );
+        if ( pCon == nullptr )
+            continue;
+        
+        // Stored boundary vertices already lie along lines of constant B1875 RA or Dec,
+        // so interpolating B1875 RA and Dec between them follows the boundary exactly.
+        
+        const vector<SSVector> &bounds = pCon->getBoundary();
+        vector<SSVector> line;
+        for ( size_t k = 0; k + 1 < bounds.size(); k++ )
+        {
+            SSSpherical p0 = precess * bounds[k], p1 = precess * bounds[k + 1];
+            double dra = modpi ( p1.lon - p0.lon );
+            double ddec = p1.lat - p0.lat;
+            int nsteps = max ( 1, (int) ceil ( ( fabs ( dra ) + fabs ( ddec ) ) / res ) );
+            
+            line.push_back ( bounds[k] );
+            for ( int j = 1; j < nsteps; j++ )
+                line.push_back ( unprecess * SSVector ( SSSpherical ( p0.lon + dra * j / nsteps, p0.lat + ddec * j / nsteps, 1.0 ) ) );
+        }
+        
+        if ( bounds.size() > 0 )
+            line.push_back ( bounds.back() );
+        
+        addLine ( line, i + 1 );
+    }
+    
+    return (int) _points.size();
+}
+
+int SSConstellationLines::setFigures ( SSObjectVec &constellations, SSObjectVec &stars, double res )
+{
+    map<int64_t,SSVector> positions;
+    for ( int i = 0; i < stars.size(); i++ )
+    {
+        SSStarPtr pStar = SSGetStarPtr ( stars[i] );
+        if ( pStar != nullptr )
+        {
+            SSIdentifier hr = pStar->getIdentifier ( kCatHR );
+            if ( hr )
+                positions[hr] = pStar->getFundamentalPosition();
+        }
+    }
+
+    _points.clear();
+    _lines.clear();
+    _valid = false;
+    
+    for ( int i = 0; i < constellations.size(); i++ )
+    {
+        SSConstellationPtr pCon = SSGetConstellationPtr ( constellations[i] );
+        if ( pCon == nullptr )
+            continue;
+        
+        // Figure lines are pairs of HR numbers; a pair starting where the last one ended continues the same polyline.
+        
+        const vector<int> &figure = pCon->getFigure();
+        vector<SSVector> line;
+        int lastHR = 0;
+        for ( size_t k = 0; k + 1 < figure.size(); k += 2 )
+        {
+            auto p0 = positions.find ( SSIdentifier ( kCatHR, figure[k] ) );
+            auto p1 = positions.find ( SSIdentifier ( kCatHR, figure[k + 1] ) );
+            if ( p0 == positions.end() || p1 == positions.end() )
+                continue;
+            
+            if ( figure[k] != lastHR )
+            {
+                addLine ( line, i + 1 );
+                line.clear();
+                line.push_back ( p0->second );
+            }
+            
+            SSVector v0 = p0->second, v1 = p1->second;
+            int nsteps = max ( 1, (int) ceil ( v0.angularSeparation ( v1 ) / res ) );
+            for ( int j = 1; j < nsteps; j++ )
+                line.push_back ( ( v0 * (double) ( nsteps - j ) + v1 * (double) j ).normalize() );
+            line.push_back ( v1 );
+            lastHR = figure[k + 1];
+        }
+        
+        addLine ( line, i + 1 );
+    }
+    
+    return (int) _points.size();
+}
+
+// Returns true if a view (view) with frame matrix (frame) differs from the one in which projected lines were computed
+// by enough to move points more than the tolerance, estimated from the largest change in the combined matrix.
+
+bool SSConstellationLines::viewChanged ( SSView &view, const SSMatrix &frame )
+{
+    if ( view.getProjection() != _view.getProjection() || view.getWidth() != _view.getWidth() || view.getHeight() != _view.getHeight()
+      || view.getCenterX() != _view.getCenterX() || view.getCenterY() != _view.getCenterY()
+      || view.getScaleX() != _view.getScaleX() || view.getScaleY() != _view.getScaleY() )
+        return true;
+    
+    SSMatrix m0 = _view.getCenterMatrix() * _frame;
+    SSMatrix m1 = view.getCenterMatrix() * frame;
+    double change = max ( { fabs ( m1.m00 - m0.m00 ), fabs ( m1.m01 - m0.m01 ), fabs ( m1.m02 - m0.m02 ),
+                            fabs ( m1.m10 - m0.m10 ), fabs ( m1.m11 - m0.m11 ), fabs ( m1.m12 - m0.m12 ),
+                            fabs ( m1.m20 - m0.m20 ), fabs ( m1.m21 - m0.m21 ), fabs ( m1.m22 - m0.m22 ) } );
+    
+    return change / min ( fabs ( view.getScaleX() ), fabs ( view.getScaleY() ) ) > _tolerance;
+}
+
+size_t SSConstellationLines::project ( SSView &view, const SSMatrix &frame )
+{
+    if ( _valid && ! viewChanged ( view, frame ) )
+        return _clipped.size();
+    
+    _view = view;
+    _frame = frame;
+    _valid = true;
+    
+    SSView fview = view;
+    fview.setCenterMatrix ( view.getCenterMatrix() * frame );
+    _projected.resize ( _points.size() );
+    fview.projectBatch ( _points.data(), _projected.data(), _points.size() );
+    
+    _x.clear();
+    _y.clear();
+    _clipped.clear();
+    
+    for ( const Polyline &line : _lines )
+    {
+        bool open = false;
+        for ( uint32_t k = line.begin; k + 1 < line.end; k++ )
+        {
+            SSVector v0 = _projected[k], v1 = _projected[k + 1];
+            if ( fview.lineWrap ( v0, v1 ) || ! fview.clipLine ( v0, v1 ) )
+            {
+                open = false;
+                continue;
+            }
+            
+            // Continue the current clipped polyline if this segment starts where it ends; otherwise start a new one.
+            
+            if ( ! open || (float) v0.x != _x.back() || (float) v0.y != _y.back() )
+            {
+                _clipped.push_back ( { (uint32_t) _x.size(), (uint32_t) _x.size(), line.constellation } );
+                _x.push_back ( v0.x );
+                _y.push_back ( v0.y );
+                open = true;
+            }
+            
+            _x.push_back ( v1.x );
+            _y.push_back ( v1.y );
+            _clipped.back().end = (uint32_t) _x.size();
+        }
+    }
+    
+    return _clipped.size();
+}
@@ -12,6 +12,9 @@
 #define SSConstellation_hpp
 
 #include "SSObject.hpp"
+#include "SSView.hpp"
+
+class SSStarTable;
 
 class SSConstellation : public SSObject
 {
@@ -33,15 +36,15 @@ public:
     
     double getArea ( void ) { return _area; }
     int getRank ( void ) { return _rank; }
-    vector<SSVector> getBoundary ( void ) { return _bounds; }
-    vector<int> getFigure ( void ) { return _figures; }
+    const vector<SSVector> &getBoundary ( void ) { return _bounds; }
+    const vector<int> &getFigure ( void ) { return _figures; }
 
     // modifiers
     
     void setArea ( double area ) { _area = area; }
     void setRank ( int rank ) { _rank = rank; }
-    void setBoundary ( vector<SSVector> bounds ) { _bounds = bounds; }
-    void setFigure ( vector<int> figure ) { _figures = figure; }
+    void setBoundary ( vector<SSVector> bounds ) { _bounds = move ( bounds ); }         // pass with move() to avoid a copy
+    void setFigure ( vector<int> figure ) { _figures = move ( figure ); }
 
     // converts IAU abbreviation ("And", "Ant", ... "Vul") to index number (1, 2, ... 88) and vice-versa.
     
@@ -51,12 +54,27 @@ public:
     // imports/exports from/to CSV-format text string
     
     static SSObjectPtr fromCSV ( string csv );
+    static SSObjectPtr fromCSV ( const SSCSVFields &fields );
     string toCSV ( void );
     
+    virtual size_t sizeOf ( void ) { return sizeof ( SSConstellation ); }
+    virtual size_t heapBytes ( void ) { return SSObject::heapBytes() + vecbytes ( _bounds ) + vecbytes ( _figures ); }
+    
     // identifies constellation from equatorial cooordinates (B1875 spherical or J2000 rectangular unit vector)
     
     static string identify ( double ra, double dec );   // B1875 coordinates
     static string identify ( SSVector position );       // J2000 coordinates
+
+    // identifies constellations of (n) positions in B1875 coordinates, as indices (1 ... 88), without a string per position.
+    
+    static void identify ( size_t n, const double *ra, const double *dec, int *indices );
+    
+    // identifies constellations of many J2000 positions at once, as indices (1 ... 88): unit vectors as separate x, y, z arrays;
+    // stars' J2000 positions (or other objects' apparent directions) in an object array; or stars' positions in a star table.
+    
+    static void identify ( size_t n, const double *x, const double *y, const double *z, int *indices );
+    static void identify ( SSObjectArray &objects, vector<int> &indices );
+    static void identify ( SSStarTable &table, vector<int> &indices );
 };
 
 // convenient alias for pointer to SSConstellation
@@ -68,6 +86,80 @@ typedef SSConstellation *SSConstellationPtr;
 
 SSConstellationPtr SSGetConstellationPtr ( SSObjectPtr ptr );
 
+// Caches constellation boundaries and figures as densified polylines in the fundamental (J2000 mean equatorial)
+// frame, and their projections into a view, clipped to the view's bounding rectangle, as contiguous point buffers.
+// Polylines are built once; the projected buffers are only recomputed when the view's matrix, projection, scale,
+// or dimensions change by more than a tolerance, so a chart whose frame moves slowly (e.g. precession and nutation
+// over a night) reuses them frame after frame.
+
+class SSConstellationLines
+{
+public:
+
+    // A run of points in a point buffer, from index (begin) up to (but not including) (end), belonging to a
+    // constellation, identified by its index (from 1 = And to 88 = Vul), or zero for lines not in any constellation.
+    
+    struct Polyline
+    {
+        uint32_t begin, end;
+        int constellation;
+    };
+    
+    static constexpr double kDefaultResolution = SSAngle::kRadPerDeg;     // one degree in radians
+    static constexpr double kDefaultTolerance = 0.1;                        // pixels
+    
+protected:
+
+    vector<SSVector> _points;       // densified points in fundamental frame
+    vector<Polyline> _lines;        // polylines made of those points
+    
+    SSView _view;                   // view in which projected lines were computed
+    SSMatrix _frame;                // frame matrix with which projected lines were computed
+    bool _valid;                    // true if projected lines are valid
+    double _tolerance;              // largest change in pixels which doesn't invalidate projected lines
+    vector<SSVector> _projected;    // points projected into view; scratch storage
+    vector<float> _x, _y;           // clipped points in view
+    vector<Polyline> _clipped;      // clipped polylines in view
+    
+    void addLine ( const vector<SSVector> &points, int constellation );
+    bool viewChanged ( SSView &view, const SSMatrix &frame );
+
+public:
+
+    SSConstellationLines ( void );
+    
+    // Replaces polylines with the boundaries of constellations (constellations), densified by interpolating B1875 RA and Dec
+    // (along which the IAU boundaries run) in steps of at most (res) radians. Returns number of points.
+    
+    int setBoundaries ( SSObjectVec &constellations, double res = kDefaultResolution );
+
+    // Replaces polylines with the figures of constellations (constellations), whose stars are found by HR number in (stars),
+    // densified along great circles in steps of at most (res) radians. Lines to stars not found are skipped. Returns number of points.
+
+    int setFigures ( SSObjectVec &constellations, SSObjectVec &stars, double res = kDefaultResolution );
+    
+    // Sets largest change in pixels in the projected position of a point which doesn't invalidate projected lines.
+    
+    void setTolerance ( double pixels ) { _tolerance = pixels; _valid = false; }
+    double getTolerance ( void ) { return _tolerance; }
+    
+    // Projects polylines into a view (view) whose celestial reference frame is transformed from the fundamental frame by
+    // a matrix (frame), and clips them to the view's bounding rectangle. Returns number of clipped polylines; their points
+    // are in getX() and getY(). Segments which wrap around the edges of 360-degree projections are omitted, breaking the line there.
+    
+    size_t project ( SSView &view, const SSMatrix &frame );
+    
+    // Clipped polylines and their points, valid until next call to project() or setBoundaries()/setFigures().
+    
+    const vector<Polyline> &getPolylines ( void ) { return _clipped; }
+    const vector<float> &getX ( void ) { return _x; }
+    const vector<float> &getY ( void ) { return _y; }
+    
+    // Invalidates projected lines, so the next project() recomputes them.
+    
+    void invalidate ( void ) { _valid = false; }
+};
+
 // Imports constellations, boundaries, shapes from CSV-format text files into vector of SSObjectPtr.
 
 int SSImportConstellations ( const string &filename, SSObjectVec &constellations );
@@ -4,8 +4,12 @@
 //  Created by Tim DeBenedictis on 2/28/20.
 //  Copyright © 2020 Southern Stars. All rights reserved.
 
+#include <mutex>
+
 #include "SSCoordinates.hpp"
+#include "SSChebyshevCache.hpp"
 #include "SSFeature.hpp"
+#include "SSInstrument.hpp"
 #include "SSPlanet.hpp"
 
 #define NEW_PRECESSION 1    // 1 to use new long-term precession, 0 to use IAU 1976 precession.
@@ -19,40 +23,188 @@ SSCoordinates::SSCoordinates ( SSTime time, SSSpherical loc )
 {
     _jd0 = -INFINITY;
     _jd1 = INFINITY;
+    _slowJD = NAN;
+    _slowTolerance = 0.0;
     
     _lon = loc.lon;
     _lat = loc.lat;
     _alt = loc.rad;
     
+    _starParallax = true;
+    _starMotion = true;
+    _starParallaxLimit = 0.0;
+    _aberration = true;
+    _lighttime = true;
+    _dynamictime = true;
+    
+    _galMat = getGalacticMatrix();
+    _frameMatMask = 0;
     setTime ( time );
+}
+
+// Constructs a coordinate transformation object for a location (loc), as above, at the time of an epoch (epoch)
+// computed by another coordinate transformation object; only the location-dependent quantities are computed.
+
+SSCoordinates::SSCoordinates ( const Epoch &epoch, SSSpherical loc )
+{
+    _jd0 = -INFINITY;
+    _jd1 = INFINITY;
+    _slowTolerance = 0.0;
+    
+    _lon = loc.lon;
+    _lat = loc.lat;
+    _alt = loc.rad;
     
     _starParallax = true;
     _starMotion = true;
+    _starParallaxLimit = 0.0;
     _aberration = true;
     _lighttime = true;
     _dynamictime = true;
+    
+    _galMat = getGalacticMatrix();
+    _frameMatMask = 0;
+    setEpoch ( epoch );
+}
+
+// Returns this coordinate transformation object's time-dependent state.
+
+SSCoordinates::Epoch SSCoordinates::getEpoch ( void )
+{
+    return { _jd, _jed, _slowJD, _obq, _de, _dl, _preMat, _nutMat, _equMat, _eclMat, _earthPos, _earthVel };
+}
+
+// Adopts another coordinate transformation object's time-dependent state (epoch) instead of computing it
+// as setTime() does, then recomputes location-dependent quantities for this object's current location.
+
+void SSCoordinates::setEpoch ( const Epoch &epoch )
+{
+    _jd = epoch.jd;
+    _jed = epoch.jed;
+    _slowJD = epoch.slowJD;
+    _obq = epoch.obq;
+    _de = epoch.de;
+    _dl = epoch.dl;
+    _preMat = epoch.preMat;
+    _nutMat = epoch.nutMat;
+    _equMat = epoch.equMat;
+    _eclMat = epoch.eclMat;
+    _earthPos = epoch.earthPos;
+    _earthVel = epoch.earthVel;
+    
+    setLocation ( SSSpherical ( _lon, _lat, _alt ) );
 }
 
 // Changes this coordinate transformation object's Julian Date (time) and recomputes
 // all of its time-dependent quantites and matrices, without changing the observer's
-// longitude, latitude, or altitude.
+// longitude, latitude, or altitude. Nutation, obliquity, and precession are only
+// recomputed if the time has changed by more than the precession tolerance.
 
 void SSCoordinates::setTime ( SSTime time )
 {
+    SS_INSTRUMENT_TIME ( kInstrumentSetTime );
     _jd = SSTime ( clamp ( time.jd, _jd0, _jd1 ), time.zone );
     _jed = _dynamictime ? time.getJulianEphemerisDate() : _jd.jd;
 
-    getNutationConstants ( _jd, _de, _dl );
-    _obq = getObliquity ( _jd );
-    _lst = time.getSiderealTime ( SSAngle ( _lon + _dl * cos ( _obq + _de ) ) );
+    if ( ! ( fabs ( _jd.jd - _slowJD ) <= _slowTolerance ) )
+        updatePrecessionNutation();
+
+    SSPlanet::computeMajorPlanetPositionVelocity ( kEarth, _jed, 0.0, _earthPos, _earthVel );
+    setLocation ( SSSpherical ( _lon, _lat, _alt ) );
+}
+
+// Computes nutation in obliquity and longitude, mean obliquity, and precession matrix elements
+// at a Julian Date (jd) from series, and stores them in that order in (values).
+
+static void slow_values ( double jd, double *values )
+{
+    SSCoordinates::getNutationConstants ( jd, values[0], values[1] );
+    values[2] = SSCoordinates::getObliquity ( jd );
+    
+    SSMatrix m = SSCoordinates::getPrecessionMatrix ( jd );
+    double elements[9] = { m.m00, m.m01, m.m02, m.m10, m.m11, m.m12, m.m20, m.m21, m.m22 };
+    copy ( elements, elements + 9, values + 3 );
+}
+
+// Computes nutation, obliquity, and precession matrix elements at a Julian Date (jd) inside a finite time range
+// from the Chebyshev fit of the window containing it, fitting that window first if needed; stores them in (values)
+// in the same order as slow_values(). Returns false if jd is outside the range, or the window's fit isn't accurate enough.
+
+bool SSCoordinates::fittedPrecessionNutation ( double jd, double *values )
+{
+    if ( ! isfinite ( _jd0 ) || ! isfinite ( _jd1 ) || jd < _jd0 || jd > _jd1 )
+        return false;
+    
+    int n = kSlowFitDegree + 1;
+    int64_t index = (int64_t) floor ( ( jd - _jd0 ) / kSlowFitSpan );
+    double mid = _jd0 + ( index + 0.5 ) * kSlowFitSpan, half = kSlowFitSpan / 2.0;
+    
+    auto it = _slowFits.find ( index );
+    if ( it == _slowFits.end() )
+    {
+        // Sample values at Chebyshev nodes, and fit them.
+        
+        SlowFit fit;
+        vector<double> samples ( kSlowFitValues * n );
+        for ( int k = 0; k < n; k++ )
+        {
+            double v[kSlowFitValues];
+            slow_values ( mid + half * cos ( M_PI * ( k + 0.5 ) / n ), v );
+            for ( int i = 0; i < kSlowFitValues; i++ )
+                samples[i * n + k] = v[i];
+        }
+        
+        fit.coeffs.resize ( kSlowFitValues * n );
+        for ( int i = 0; i < kSlowFitValues; i++ )
+            SSChebyshevCache::chebyshevFit ( kSlowFitDegree, &samples[i * n], &fit.coeffs[i * n] );
+        
+        // Test fit halfway between nodes, where error is largest. Precession matrix elements are components
+        // of unit vectors, so their errors are angles in radians, like those of the other values.
+        
+        fit.fits = true;
+        for ( int k = 0; k < n - 1 && fit.fits; k++ )
+        {
+            double x = cos ( M_PI * ( k + 1.0 ) / n ), v[kSlowFitValues];
+            slow_values ( mid + half * x, v );
+            for ( int i = 0; i < kSlowFitValues && fit.fits; i++ )
+            {
+                double value = 0.0, deriv = 0.0;
+                SSChebyshevCache::chebyshevEval ( kSlowFitDegree, &fit.coeffs[i * n], x, value, deriv );
+                fit.fits = fabs ( value - v[i] ) < kSlowFitTolerance;
+            }
+        }
+        
+        it = _slowFits.insert ( { index, fit } ).first;
+    }
+    
+    if ( ! it->second.fits )
+        return false;
+    
+    double x = ( jd - mid ) / half, deriv = 0.0;
+    for ( int i = 0; i < kSlowFitValues; i++ )
+        SSChebyshevCache::chebyshevEval ( kSlowFitDegree, &it->second.coeffs[i * n], x, values[i], deriv );
+    
+    return true;
+}
+
+// Recomputes nutation, obliquity, precession, and the equatorial and ecliptic matrices from them, at the current time.
+// Inside a finite time range, these come from Chebyshev fits; see fittedPrecessionNutation().
+
+void SSCoordinates::updatePrecessionNutation ( void )
+{
+    _slowJD = _jd.jd;
     
-    _preMat = getPrecessionMatrix ( _jd );
+    double v[kSlowFitValues];
+    if ( ! fittedPrecessionNutation ( _jd.jd, v ) )
+        slow_values ( _jd.jd, v );
+    
+    _de = v[0];
+    _dl = v[1];
+    _obq = v[2];
+    _preMat = SSMatrix ( v[3], v[4], v[5], v[6], v[7], v[8], v[9], v[10], v[11] );
     _nutMat = getNutationMatrix ( _obq, _dl, _de );
     _equMat = _nutMat * ( _preMat );
     _eclMat = getEclipticMatrix ( - _obq - _de ) * _equMat;
-    _galMat = getGalacticMatrix();
-
-    setLocation ( SSSpherical ( _lon, _lat, _alt ) );
 }
 
 // Changes this coordinate transformation object's observer longitude (loc.lon), latitude (loc.lat),
@@ -68,7 +220,8 @@ void SSCoordinates::setLocation ( SSSpherical loc )
     
     _horMat = getHorizonMatrix ( _lst, _lat ).multiply ( _equMat );
 
-    SSPlanet::computeMajorPlanetPositionVelocity ( kEarth, _jed, 0.0, _obsPos, _obsVel );
+    _obsPos = _earthPos;
+    _obsVel = _earthVel;
     
     SSSpherical geo ( _lst, _lat, _alt );
     SSVector geopos = toGeocentricPosition ( geo, kKmPerEarthRadii, kEarthFlattening );
@@ -79,6 +232,23 @@ void SSCoordinates::setLocation ( SSSpherical loc )
     
     _obsPos += geopos / kKmPerAU;
     _obsVel += geovel / kKmPerAU;
+    updateAberration();
+    _frameMatMask = 0;
+}
+
+// Computes local apparent sidereal times at this location for an array of (n) Julian Dates (jd), using current nutation.
+
+void SSCoordinates::getLST ( const double *jd, double *lst, size_t n )
+{
+    SSTime::getSiderealTime ( jd, SSAngle ( _lon + _dl * cos ( _obq + _de ) ), lst, n );
+}
+
+// Precomputes the observer velocity terms used for aberration whenever observer velocity changes.
+
+void SSCoordinates::updateAberration ( void )
+{
+    _aberVel = _obsVel / kLightAUPerDay;
+    _aberBeta = sqrt ( 1.0 - _aberVel * _aberVel );
 }
 
 // Sets location to the longirude, latitude, altitude, and time zone in the specified city.
@@ -364,6 +534,40 @@ double SSCoordinates::getObliquity ( double jd )
 
 #endif
 
+SSMatrix SSCoordinates::getPrecessionMatrix ( double fromJD, double toJD )
+{
+    static map<pair<double,double>,SSMatrix> cache;
+    static mutex cacheMutex;
+
+    lock_guard<mutex> lock ( cacheMutex );
+    auto it = cache.find ( { fromJD, toJD } );
+    if ( it != cache.end() )
+        return it->second;
+
+    SSMatrix m;
+    if ( fromJD == toJD )
+        m = SSMatrix::identity();
+    else if ( fromJD == SSTime::kJ2000 )
+        m = getPrecessionMatrix ( toJD );
+    else if ( toJD == SSTime::kJ2000 )
+        m = getPrecessionMatrix ( fromJD ).transpose();
+    else
+        m = getPrecessionMatrix ( toJD ) * getPrecessionMatrix ( fromJD ).transpose();
+
+    cache[ { fromJD, toJD } ] = m;
+    return m;
+}
+
+void SSCoordinates::precess ( double fromJD, double toJD, SSVector *vecs, size_t n )
+{
+    getPrecessionMatrix ( fromJD, toJD ).multiply ( vecs, n );
+}
+
+void SSCoordinates::precess ( double fromJD, double toJD, double *x, double *y, double *z, size_t n )
+{
+    getPrecessionMatrix ( fromJD, toJD ).multiply ( x, y, z, n );
+}
+
 // Returns a rotation matrix which corrects equatorial coordinates for nutation,
 // i.e. transforming rectangular coordinates from the mean to the true equatorial frame.
 // The mean obliquity of the ecliptic is obq; the nutation in longitude and obliquity
@@ -411,29 +615,30 @@ SSMatrix SSCoordinates::getGalacticMatrix ( void )
 // Returns transformed vector; does not modify input vector.
 // Note that this also transforms spherical coordinates because we have constructors
 // which automatically convert SSVector <-> SSSpherical.  Thanks to J.B. Lekien for that tip!
+// Dispatches to the same single-frame steps as the compile-time transform<from,to>().
 
 SSVector SSCoordinates::transform ( SSFrame from, SSFrame to, SSVector vec )
 {
-    if ( from != to )
-    {
-        if ( from == kEquatorial )
-            vec = _equMat.transpose() * vec;
-        else if ( from == kEcliptic )
-            vec = _eclMat.transpose() * vec;
-        else if ( from == kGalactic )
-            vec = _galMat.transpose() * vec;
-        else if ( from == kHorizon )
-            vec = _horMat.transpose() * vec;
-        
-        if ( to == kEquatorial )
-            vec = _equMat * vec;
-        else if ( to == kEcliptic )
-            vec = _eclMat * vec;
-        else if ( to == kGalactic )
-            vec = _galMat * vec;
-        else if ( to == kHorizon )
-            vec = _horMat * vec;
-    }
+    if ( from == to )
+        return vec;
+    
+    if ( from == kEquatorial )
+        vec = fromFrame<kEquatorial> ( vec );
+    else if ( from == kEcliptic )
+        vec = fromFrame<kEcliptic> ( vec );
+    else if ( from == kGalactic )
+        vec = fromFrame<kGalactic> ( vec );
+    else if ( from == kHorizon )
+        vec = fromFrame<kHorizon> ( vec );
+    
+    if ( to == kEquatorial )
+        vec = toFrame<kEquatorial> ( vec );
+    else if ( to == kEcliptic )
+        vec = toFrame<kEcliptic> ( vec );
+    else if ( to == kGalactic )
+        vec = toFrame<kGalactic> ( vec );
+    else if ( to == kHorizon )
+        vec = toFrame<kHorizon> ( vec );
     
     return vec;
 }
@@ -446,13 +651,13 @@ SSMatrix SSCoordinates::transform ( SSFrame from, SSFrame to, SSMatrix mat )
     if ( from != to )
     {
         if ( from == kEquatorial )
-            mat = _equMat.transpose() * mat;
+            mat = _equMat.transposeMultiply ( mat );
         else if ( from == kEcliptic )
-            mat = _eclMat.transpose() * mat;
+            mat = _eclMat.transposeMultiply ( mat );
         else if ( from == kGalactic )
-            mat = _galMat.transpose() * mat;
+            mat = _galMat.transposeMultiply ( mat );
         else if ( from == kHorizon )
-            mat = _horMat.transpose() * mat;
+            mat = _horMat.transposeMultiply ( mat );
         
         if ( to == kEquatorial )
             mat = _equMat * mat;
@@ -467,6 +672,54 @@ SSMatrix SSCoordinates::transform ( SSFrame from, SSFrame to, SSMatrix mat )
     return mat;
 }
 
+// Returns the matrix which transforms vectors from one frame to another, computing it if not already cached.
+
+SSMatrix SSCoordinates::getTransformMatrix ( SSFrame from, SSFrame to )
+{
+    uint32_t bit = 1u << ( from * 5 + to );
+    if ( ! ( _frameMatMask & bit ) )
+    {
+        _frameMats[from][to] = transform ( from, to, SSMatrix::identity() );
+        _frameMatMask |= bit;
+    }
+    
+    return _frameMats[from][to];
+}
+
+// Transforms an array of (n) vectors (vecs) from one frame to another in place.
+
+void SSCoordinates::transform ( SSFrame from, SSFrame to, SSVector *vecs, size_t n )
+{
+    if ( from == to )
+        return;
+    
+    getTransformMatrix ( from, to ).multiply ( vecs, n );
+}
+
+// Transforms (n) vectors, as separate arrays of (x, y, z) components, from one frame to another in place.
+
+void SSCoordinates::transform ( SSFrame from, SSFrame to, double *x, double *y, double *z, size_t n )
+{
+    if ( from == to )
+        return;
+    
+    getTransformMatrix ( from, to ).multiply ( x, y, z, n );
+}
+
+// Transforms an array of (n) vectors (vecs) from one frame to another, and converts them to spherical coordinates (coords).
+
+void SSCoordinates::transform ( SSFrame from, SSFrame to, const SSVector *vecs, SSSpherical *coords, size_t n )
+{
+    SSMatrix m = getTransformMatrix ( from, to );
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double x = vecs[i].x, y = vecs[i].y, z = vecs[i].z;
+        coords[i] = SSSpherical ( SSVector ( m.m00 * x + m.m01 * y + m.m02 * z,
+                                             m.m10 * x + m.m11 * y + m.m12 * z,
+                                             m.m20 * x + m.m21 * y + m.m22 * z ) );
+    }
+}
+
 // Converts geocentric X,Y,Z position vector (geo) to geodetic longitude and
 // latitude in radians, and altitude in the same distance units as (a) below.
 // Geoid equatorial radius (a) and flattening (f) are as described below for
@@ -502,6 +755,33 @@ SSSpherical SSCoordinates::toGeodetic ( SSVector geo, double a, double f )
     return SSSpherical ( lon, lat, h );
 }
 
+// Converts an array of (n) geocentric position vectors (geo) to geodetic longitude, latitude, and altitude (out)
+// with Bowring's formula, iterated twice from the parametric latitude; see the single-vector version above.
+
+void SSCoordinates::toGeodetic ( const SSVector *geo, SSSpherical *out, size_t n, double a, double f )
+{
+    double e2 = 2.0 * f - f * f, b = a * ( 1.0 - f ), ep2 = e2 / ( 1.0 - e2 );
+    
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double x = geo[i].x, y = geo[i].y, z = geo[i].z;
+        double r = sqrt ( x * x + y * y );
+        double u = atan2 ( z * a, r * b );
+        double lat = 0.0;
+        
+        for ( int k = 0; k < 2; k++ )
+        {
+            double su = sin ( u ), cu = cos ( u );
+            lat = atan2 ( z + ep2 * b * su * su * su, r - e2 * a * cu * cu * cu );
+            u = atan2 ( ( 1.0 - f ) * sin ( lat ), cos ( lat ) );
+        }
+        
+        double s = sin ( lat ), c = cos ( lat );
+        double nu = a / sqrt ( 1.0 - e2 * s * s );
+        out[i] = SSSpherical ( atan2pi ( y, x ), lat, r * c + z * s - a * a / nu );
+    }
+}
+
 // Converts geodetic longitude, latitude, altitude to geocentric position vector.
 // Longitude (geo.lon) and latitude (geo.lat) are in radians; altitude above geoid
 // (geo.rad) is in same units as equatorial radius of geoid ellipse (a). Geoid
@@ -541,8 +821,8 @@ SSVector SSCoordinates::toGeocentricVelocity ( SSSpherical geo, double a, double
     c = 1.0 / sqrt ( cp * cp + f * sp * sp );
     s = f * c;
     
-    double vx = -w * ( a * c + geo.rad ) * cp * cos ( geo.lon );
-    double vy =  w * ( a * c + geo.rad ) * cp * sin ( geo.lon );
+    double vx = -w * ( a * c + geo.rad ) * cp * sin ( geo.lon );
+    double vy =  w * ( a * c + geo.rad ) * cp * cos ( geo.lon );
     double vz = 0.0;
     
     return SSVector ( vx, vy, vz );
@@ -556,9 +836,8 @@ SSVector SSCoordinates::toGeocentricVelocity ( SSSpherical geo, double a, double
 
 SSVector SSCoordinates::applyAberration ( SSVector p )
 {
-    SSVector v = _obsVel / kLightAUPerDay;
-    
-    double beta = sqrt ( 1.0 - v * v );
+    SSVector v = _aberVel;
+    double beta = _aberBeta;
     double dot = v * p;
     double s = 1.0 + dot / ( 1.0 + beta );
     double n = 1.0 + dot;
@@ -575,7 +854,110 @@ SSVector SSCoordinates::applyAberration ( SSVector p )
 
 SSVector SSCoordinates::removeAberration ( SSVector p )
 {
-    return ( p - _obsVel / kLightAUPerDay ).normalize();
+    return ( p - _aberVel ).normalize();
+}
+
+// Batch aberration and parallax for arrays of x, y, z direction components.
+
+void SSCoordinates::applyAberration ( double *x, double *y, double *z, size_t n )
+{
+    double vx = _aberVel.x, vy = _aberVel.y, vz = _aberVel.z, beta = _aberBeta;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double dot = vx * x[i] + vy * y[i] + vz * z[i];
+        double s = 1.0 + dot / ( 1.0 + beta );
+        double d = 1.0 + dot;
+        x[i] = ( x[i] * beta + vx * s ) / d;
+        y[i] = ( y[i] * beta + vy * s ) / d;
+        z[i] = ( z[i] * beta + vz * s ) / d;
+    }
+}
+
+void SSCoordinates::removeAberration ( double *x, double *y, double *z, size_t n )
+{
+    double vx = _aberVel.x, vy = _aberVel.y, vz = _aberVel.z;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double px = x[i] - vx, py = y[i] - vy, pz = z[i] - vz;
+        double r = sqrt ( px * px + py * py + pz * pz );
+        x[i] = px / r;
+        y[i] = py / r;
+        z[i] = pz / r;
+    }
+}
+
+float SSCoordinates::starParallaxLimit ( double scale )
+{
+    double dist = _obsPos.magnitude();
+    return dist > 0.0 ? SSAngle ( scale / dist ).toArcsec() : INFINITY;
+}
+
+void SSCoordinates::applyStarParallax ( double *x, double *y, double *z, const float *plx, size_t n )
+{
+    double ox = _obsPos.x, oy = _obsPos.y, oz = _obsPos.z;
+    float limit = _starParallaxLimit;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double s = plx[i] > 0.0 && plx[i] >= limit ? plx[i] / kAUPerParsec : 0.0;
+        x[i] -= ox * s;
+        y[i] -= oy * s;
+        z[i] -= oz * s;
+    }
+}
+
+void SSCoordinates::applyAberration ( float *x, float *y, float *z, size_t n )
+{
+    float vx = _aberVel.x, vy = _aberVel.y, vz = _aberVel.z, beta = _aberBeta;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        float dot = vx * x[i] + vy * y[i] + vz * z[i];
+        float s = 1.0f + dot / ( 1.0f + beta );
+        float d = 1.0f + dot;
+        x[i] = ( x[i] * beta + vx * s ) / d;
+        y[i] = ( y[i] * beta + vy * s ) / d;
+        z[i] = ( z[i] * beta + vz * s ) / d;
+    }
+}
+
+void SSCoordinates::applyStarParallax ( float *x, float *y, float *z, const float *plx, size_t n )
+{
+    float ox = _obsPos.x, oy = _obsPos.y, oz = _obsPos.z, limit = _starParallaxLimit;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        float s = plx[i] > 0.0f && plx[i] >= limit ? plx[i] / (float) kAUPerParsec : 0.0f;
+        x[i] -= ox * s;
+        y[i] -= oy * s;
+        z[i] -= oz * s;
+    }
+}
+
+// Batch aberration for arrays of direction vectors.
+
+void SSCoordinates::applyAberration ( SSVector *p, size_t n )
+{
+    double vx = _aberVel.x, vy = _aberVel.y, vz = _aberVel.z, beta = _aberBeta;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double dot = vx * p[i].x + vy * p[i].y + vz * p[i].z;
+        double s = 1.0 + dot / ( 1.0 + beta );
+        double d = 1.0 + dot;
+        p[i].x = ( p[i].x * beta + vx * s ) / d;
+        p[i].y = ( p[i].y * beta + vy * s ) / d;
+        p[i].z = ( p[i].z * beta + vz * s ) / d;
+    }
+}
+
+void SSCoordinates::removeAberration ( SSVector *p, size_t n )
+{
+    double vx = _aberVel.x, vy = _aberVel.y, vz = _aberVel.z;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double px = p[i].x - vx, py = p[i].y - vy, pz = p[i].z - vz;
+        double r = sqrt ( px * px + py * py + pz * pz );
+        p[i].x = px / r;
+        p[i].y = py / r;
+        p[i].z = pz / r;
+    }
 }
 
 // Given a positive or negative red shift (z), returns the equivalent radial velocity
@@ -636,6 +1018,80 @@ SSAngle SSCoordinates::removeRefraction ( SSAngle alt )
     return alt - SSCoordinates::refractionAngle ( alt, false );
 }
 
+// Builds refraction tables for atmospheric pressure in millibars and temperature in degrees Celsius.
+// Each table stores refraction angle and its derivative with respect to altitude at every kStep degrees,
+// computed from SSCoordinates::refractionAngle(); derivatives are central differences.
+
+SSRefractionTable::SSRefractionTable ( double pressure, double temperature )
+{
+    _pressure = pressure;
+    _temperature = temperature;
+    _scale = ( pressure / 1010.0 ) * ( 283.0 / ( 273.0 + temperature ) );
+    
+    double dh = SSAngle::fromDegrees ( 1.0e-4 );
+    
+    for ( bool a : { true, false } )
+    {
+        vector<double> &table = a ? _trueTable : _apparentTable;
+        double minAlt = a ? kMinTrueAltitude : kMinApparentAltitude;
+        int n = (int) ceil ( ( kMaxAltitude - minAlt ) / kStep ) + 1;
+        table.resize ( 2 * n );
+        for ( int i = 0; i < n; i++ )
+        {
+            SSAngle h = SSAngle::fromDegrees ( minAlt + i * kStep );
+            table[2 * i] = _scale * SSCoordinates::refractionAngle ( h, a );
+            table[2 * i + 1] = _scale * ( SSCoordinates::refractionAngle ( h + dh, a ) - SSCoordinates::refractionAngle ( h - dh, a ) ) / ( 2.0 * dh );
+        }
+    }
+}
+
+// Interpolates refraction angles at (n) altitudes (alt) from a table starting at altitude (minAlt) in degrees,
+// multiplies them by (sign), and adds them to the values in (refr), which may be the same array as (alt).
+// Altitudes outside the table are clamped to it,
+// as SSCoordinates::refractionAngle() clamps low altitudes.
+
+void SSRefractionTable::interpolate ( const vector<double> &table, double minAlt, double sign, const double *alt, double *refr, size_t n )
+{
+    double step = SSAngle::fromDegrees ( kStep ), lo = SSAngle::fromDegrees ( minAlt );
+    double last = table.size() / 2 - 1;
+    
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double x = clamp ( ( alt[i] - lo ) / step, 0.0, last );
+        double j = min ( floor ( x ), last - 1.0 );
+        double t = x - j, t2 = t * t, t3 = t2 * t;
+        const double *p = &table[ 2 * (size_t) j ];
+        refr[i] += sign * ( ( 2.0 * t3 - 3.0 * t2 + 1.0 ) * p[0] + ( t3 - 2.0 * t2 + t ) * step * p[1]
+                + ( -2.0 * t3 + 3.0 * t2 ) * p[2] + ( t3 - t2 ) * step * p[3] );
+    }
+}
+
+// Returns refraction angle at true altitude (alt) if a is true, or at apparent altitude if false.
+
+SSAngle SSRefractionTable::refractionAngle ( SSAngle alt, bool a )
+{
+    double h = alt, r = 0.0;
+    if ( a )
+        interpolate ( _trueTable, kMinTrueAltitude, 1.0, &h, &r, 1 );
+    else
+        interpolate ( _apparentTable, kMinApparentAltitude, 1.0, &h, &r, 1 );
+    return r;
+}
+
+// Converts (n) true altitudes in radians (alt) to apparent altitudes in place.
+
+void SSRefractionTable::applyRefraction ( double *alt, size_t n )
+{
+    interpolate ( _trueTable, kMinTrueAltitude, 1.0, alt, alt, n );
+}
+
+// Converts (n) apparent altitudes in radians (alt) to true altitudes in place.
+
+void SSRefractionTable::removeRefraction ( double *alt, size_t n )
+{
+    interpolate ( _apparentTable, kMinApparentAltitude, -1.0, alt, alt, n );
+}
+
 // Given a heliocentric position vector in the fundamental referene frame in units of AU,
 // returns apparent direction unit vector and distance from observer's position in AU.
 // If desired, apply aberration of light.
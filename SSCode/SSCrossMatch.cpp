@@ -0,0 +1,225 @@
+// SSCrossMatch.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <functional>
+#include <unordered_map>
+
+#include "SSCrossMatch.hpp"
+#include "SSStar.hpp"
+
+#if USE_THREADS
+#include <thread>
+#endif
+
+// Don't give a thread fewer objects than this to match; starting it would take longer than matching them.
+
+static constexpr size_t kMinObjectsPerThread = 10000;
+
+// Returns an object's catalog magnitude: a star's visual magnitude, or blue magnitude if visual is unknown;
+// otherwise the object's apparent magnitude. Infinite if unknown.
+
+static float catalog_magnitude ( SSObjectPtr pObject )
+{
+    SSStarPtr pStar = SSGetStarPtr ( pObject );
+    if ( pStar == nullptr )
+        return pObject->getMagnitude();
+
+    float mag = pStar->getVMagnitude();
+    return isinf ( mag ) ? pStar->getBMagnitude() : mag;
+}
+
+// Returns a star's fundamental position, or an infinite vector if the object is not a star.
+
+static SSVector fundamental_position ( SSObjectPtr pObject )
+{
+    SSStarPtr pStar = SSGetStarPtr ( pObject );
+    return pStar ? pStar->getFundamentalPosition() : SSVector ( INFINITY, INFINITY, INFINITY );
+}
+
+static SSCrossMatch make_match ( SSObjectPtr pObj1, SSObjectPtr pObj2, size_t index1, size_t index2, bool identified )
+{
+    SSVector pos1 = fundamental_position ( pObj1 ), pos2 = fundamental_position ( pObj2 );
+    SSAngle sep = pos1.isinf() || pos2.isinf() ? SSAngle ( INFINITY ) : pos2.angularSeparation ( pos1 );
+    return { index1, index2, identified, sep, catalog_magnitude ( pObj2 ) - catalog_magnitude ( pObj1 ) };
+}
+
+static bool compare_matches ( const SSCrossMatch &m1, const SSCrossMatch &m2 )
+{
+    return m1.index2 < m2.index2 || ( m1.index2 == m2.index2 && m1.index1 < m2.index1 );
+}
+
+// Calls a work function for ranges of (count) objects from (begin) up to (but not including) (end) on up to (threads)
+// threads, each appending matches to a table of its own; then appends those tables to (matches) in object order.
+
+typedef function<void ( size_t begin, size_t end, SSCrossMatchTable &matches )> MatchFunc;
+
+static void match_chunks ( size_t count, int threads, const MatchFunc &work, SSCrossMatchTable &matches )
+{
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+
+    threads = (int) min ( (size_t) threads, count / kMinObjectsPerThread + 1 );
+    if ( threads > 1 )
+    {
+        vector<SSCrossMatchTable> chunks ( threads );
+        vector<thread> workers;
+        for ( int t = 1; t < threads; t++ )
+            workers.push_back ( thread ( [&, t] () { work ( count * t / threads, count * ( t + 1 ) / threads, chunks[t] ); } ) );
+
+        work ( 0, count / threads, chunks[0] );
+
+        for ( thread &worker : workers )
+            worker.join();
+
+        for ( SSCrossMatchTable &chunk : chunks )
+            matches.insert ( matches.end(), chunk.begin(), chunk.end() );
+
+        return;
+    }
+#endif
+
+    work ( 0, count, matches );
+}
+
+// Hash-joins objects on their identifiers in one catalog. The hash table of the first array's identifiers
+// is built on the calling thread, then probed concurrently with the second array's identifiers.
+
+int SSCrossMatchIdentifiers ( SSObjectArray &objects1, SSObjectArray &objects2, SSCatalog cat, SSCrossMatchTable &matches, int threads )
+{
+    unordered_multimap<int64_t,size_t> hash;
+    hash.reserve ( objects1.size() );
+
+    for ( size_t index1 = 0; index1 < objects1.size(); index1++ )
+    {
+        SSObjectPtr pObj1 = objects1[index1];
+        SSIdentifier ident = pObj1 ? pObj1->getIdentifier ( cat ) : SSIdentifier();
+        if ( ident )
+            hash.insert ( { (int64_t) ident, index1 } );
+    }
+
+    size_t first = matches.size();
+    MatchFunc work = [&] ( size_t begin, size_t end, SSCrossMatchTable &results )
+    {
+        for ( size_t index2 = begin; index2 < end; index2++ )
+        {
+            SSObjectPtr pObj2 = objects2[index2];
+            SSIdentifier ident = pObj2 ? pObj2->getIdentifier ( cat ) : SSIdentifier();
+            if ( ! ident )
+                continue;
+
+            auto range = hash.equal_range ( (int64_t) ident );
+            for ( auto it = range.first; it != range.second; it++ )
+                results.push_back ( make_match ( objects1[it->second], pObj2, it->second, index2, true ) );
+        }
+    };
+
+    match_chunks ( objects2.size(), threads, work, matches );
+
+    // Equal identifiers are found in no particular order; sort them into array order.
+
+    sort ( matches.begin() + first, matches.end(), compare_matches );
+    return (int) ( matches.size() - first );
+}
+
+// Spatially joins stars by searching the first array's spatial index for each star in the second array.
+// Objects with unknown magnitudes pass any magnitude tolerance.
+
+int SSCrossMatchPositions ( SSObjectArray &objects1, SSObjectArray &objects2, SSAngle rad, float magTol, SSCrossMatchTable &matches, int threads )
+{
+    if ( ! objects1.hasIndex() )
+        objects1.buildIndex();
+
+    size_t first = matches.size();
+    MatchFunc work = [&] ( size_t begin, size_t end, SSCrossMatchTable &results )
+    {
+        vector<size_t> indexes;
+        for ( size_t index2 = begin; index2 < end; index2++ )
+        {
+            SSObjectPtr pObj2 = objects2[index2];
+            SSVector pos = pObj2 ? fundamental_position ( pObj2 ) : SSVector ( INFINITY, INFINITY, INFINITY );
+            if ( pos.isinf() || pos.isnan() )
+                continue;
+
+            indexes.clear();
+            objects1.search ( pos, rad, indexes );
+            for ( size_t index1 : indexes )
+            {
+                SSCrossMatch match = make_match ( objects1[index1], pObj2, index1, index2, false );
+                if ( isinf ( magTol ) || isinf ( match.magDiff ) || fabs ( match.magDiff ) <= magTol )
+                    results.push_back ( match );
+            }
+        }
+    };
+
+    match_chunks ( objects2.size(), threads, work, matches );
+    return (int) ( matches.size() - first );
+}
+
+int SSCrossMatchObjects ( SSObjectArray &objects1, SSObjectArray &objects2, SSCatalog cat, SSAngle rad, float magTol, SSCrossMatchTable &matches, int threads )
+{
+    SSCrossMatchTable identified, positioned;
+
+    if ( cat != kCatUnknown )
+        SSCrossMatchIdentifiers ( objects1, objects2, cat, identified, threads );
+
+    if ( rad > 0.0 )
+    {
+        vector<bool> found ( objects2.size(), false );
+        for ( const SSCrossMatch &match : identified )
+            found[ match.index2 ] = true;
+
+        SSCrossMatchPositions ( objects1, objects2, rad, magTol, positioned, threads );
+        positioned.erase ( remove_if ( positioned.begin(), positioned.end(), [&found] ( const SSCrossMatch &match ) { return found[ match.index2 ]; } ), positioned.end() );
+    }
+
+    size_t first = matches.size();
+    matches.insert ( matches.end(), identified.begin(), identified.end() );
+    matches.insert ( matches.end(), positioned.begin(), positioned.end() );
+    inplace_merge ( matches.begin() + first, matches.begin() + first + identified.size(), matches.end(), compare_matches );
+    return (int) ( matches.size() - first );
+}
+
+int SSBestCrossMatches ( SSCrossMatchTable &matches )
+{
+    size_t kept = 0;
+
+    for ( size_t i = 0; i < matches.size(); i++ )
+    {
+        const SSCrossMatch &match = matches[i];
+        if ( kept > 0 && matches[ kept - 1 ].index2 == match.index2 )
+        {
+            SSCrossMatch &best = matches[ kept - 1 ];
+            if ( ( match.identified && ! best.identified ) || ( match.identified == best.identified && match.separation < best.separation ) )
+                best = match;
+        }
+        else
+        {
+            matches[ kept++ ] = match;
+        }
+    }
+
+    matches.resize ( kept );
+    return (int) kept;
+}
+
+int SSAddCrossMatchIdentifiers ( const SSCrossMatchTable &matches, SSObjectArray &objects1, SSObjectArray &objects2 )
+{
+    int numAdded = 0;
+
+    for ( const SSCrossMatch &match : matches )
+    {
+        SSObjectPtr pObj1 = objects1[ match.index1 ], pObj2 = objects2[ match.index2 ];
+        if ( pObj1 == nullptr || pObj2 == nullptr || pObj1 == pObj2 )
+            continue;
+
+        for ( SSIdentifier ident : pObj2->getIdentifierSpan() )
+            if ( pObj1->addIdentifier ( ident ) )
+                numAdded++;
+    }
+
+    return numAdded;
+}
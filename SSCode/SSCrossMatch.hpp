@@ -0,0 +1,62 @@
+// SSCrossMatch.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// Cross-identification of objects in two catalogs, by identifier (a hash join on one catalog's identifiers),
+// by position (a spatial join within a radius, optionally within a magnitude tolerance, using the first array's
+// spatial index), or both. Matching runs on several threads, and produces a table of matching object indexes
+// which importers can reduce to best matches, and use to merge identifiers from one catalog into another.
+// To match objects in an SSHTM, pass its loaded regions' object arrays (see SSHTM::getObjects()).
+
+#ifndef SSCrossMatch_hpp
+#define SSCrossMatch_hpp
+
+#include "SSObject.hpp"
+
+// One matching pair of objects: indexes in the first and second arrays, how they were matched, their angular
+// separation (infinite if either has no position), and magnitude difference, second minus first (infinite if unknown).
+
+struct SSCrossMatch
+{
+    size_t index1;              // index of object in first array
+    size_t index2;              // index of object in second array
+    bool identified;            // true if matched by identifier, false if matched by position only
+    SSAngle separation;         // angular separation of objects' fundamental positions, in radians
+    float magDiff;              // magnitude of second object minus magnitude of first
+};
+
+typedef vector<SSCrossMatch> SSCrossMatchTable;
+
+// Finds objects in two arrays (objects1, objects2) with the same identifier in a catalog (cat).
+// Matches are appended to (matches), ordered by index in second array, then first; returns number of matches found.
+// Work is divided among (threads) threads; if zero or negative, one per processor core.
+
+int SSCrossMatchIdentifiers ( SSObjectArray &objects1, SSObjectArray &objects2, SSCatalog cat, SSCrossMatchTable &matches, int threads = 1 );
+
+// Finds stars (and other objects stored as SSStars) in two arrays (objects1, objects2) whose fundamental positions
+// are less than (rad) radians apart, and whose magnitudes differ by no more than (magTol); an infinite tolerance
+// ignores magnitudes, and objects whose magnitudes are unknown pass any tolerance.
+// Builds first array's spatial index if needed (see SSObjectArray::buildIndex()); the arrays must not change meanwhile.
+// Matches are appended to (matches), ordered by index in second array, then first; returns number of matches found.
+
+int SSCrossMatchPositions ( SSObjectArray &objects1, SSObjectArray &objects2, SSAngle rad, float magTol, SSCrossMatchTable &matches, int threads = 1 );
+
+// Matches objects by identifier in a catalog (cat), unless it's kCatUnknown; then matches objects of the second
+// array which have no identifier match by position, as above, unless radius (rad) is zero.
+// Matches are appended to (matches), ordered as above; returns number of matches found.
+
+int SSCrossMatchObjects ( SSObjectArray &objects1, SSObjectArray &objects2, SSCatalog cat, SSAngle rad, float magTol, SSCrossMatchTable &matches, int threads = 1 );
+
+// Reduces a match table (matches) ordered as above to the best match for each object in the second array:
+// identifier matches first, then the smallest separation. Returns number of matches remaining.
+
+int SSBestCrossMatches ( SSCrossMatchTable &matches );
+
+// For each match in a table, adds all identifiers of the object in the second array to the matching object in
+// the first array, if it does not already have them. Returns number of identifiers added.
+
+int SSAddCrossMatchIdentifiers ( const SSCrossMatchTable &matches, SSObjectArray &objects1, SSObjectArray &objects2 );
+
+#endif /* SSCrossMatch_hpp */
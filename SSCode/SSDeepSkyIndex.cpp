@@ -0,0 +1,129 @@
+// SSDeepSkyIndex.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <algorithm>
+
+#include "SSDeepSkyIndex.hpp"
+
+double SSDeepSkyIndex::levelRadius ( int level )
+{
+    static const double kRootRadius = acos ( 1.0 / sqrt ( 3.0 ) );     // center to corner of a root triangle, 54.7°
+
+    level = min ( max ( level, 1 ), (int) kMaxLevel );
+    return ldexp ( kRootRadius, 1 - level );
+}
+
+int SSDeepSkyIndex::build ( SSObjectArray &objects )
+{
+    for ( vector<Entry> &entries : _levels )
+        entries.clear();
+
+    int n = 0;
+    for ( size_t i = 0; i < objects.size(); i++ )
+    {
+        SSDeepSkyPtr pObject = SSGetDeepSkyPtr ( objects[i] );
+        if ( pObject == nullptr )
+            continue;
+
+        SSVector center = pObject->getFundamentalPosition();
+        if ( center.isinf() || center.isnan() )
+            continue;
+
+        // Store object at the deepest level whose radius is at least as big as the object.
+
+        float radius = pObject->getMajorAxis() / 2.0;
+        if ( ! ( radius > 0.0 && radius < INFINITY ) )
+            radius = 0.0;
+
+        int level = 1;
+        while ( level < kMaxLevel && levelRadius ( level + 1 ) >= radius )
+            level++;
+
+        _levels[level].push_back ( { _htm.vector2ID ( center, level - 1 ), center, radius, pObject } );
+        n++;
+    }
+
+    for ( vector<Entry> &entries : _levels )
+        sort ( entries.begin(), entries.end(), [] ( const Entry &e1, const Entry &e2 )
+        {
+            return e1.htmID < e2.htmID || ( e1.htmID == e2.htmID && e1.radius > e2.radius );
+        } );
+
+    return n;
+}
+
+size_t SSDeepSkyIndex::size ( void )
+{
+    size_t n = 0;
+    for ( vector<Entry> &entries : _levels )
+        n += entries.size();
+
+    return n;
+}
+
+int SSDeepSkyIndex::search ( SSVector center, SSAngle radius, SSAngle minSize, vector<SSDeepSkyPtr> &results )
+{
+    int found = 0;
+    for ( int level = 1; level <= kMaxLevel; level++ )
+    {
+        // Objects at this level, and all deeper ones, are smaller than the minimum size.
+
+        if ( minSize > 0.0 && 2.0 * levelRadius ( level ) < minSize )
+            break;
+
+        const vector<Entry> &entries = _levels[level];
+        if ( entries.empty() )
+            continue;
+
+        // Objects overlapping the circle have centers within the circle widened by the largest object radius at this level.
+        // Find the triangles covering that, or take the whole level if it covers the whole sky.
+
+        double reach = radius + levelRadius ( level );
+        vector<pair<size_t,size_t>> runs;
+        if ( reach < SSAngle::kPi )
+        {
+            SSHTM::Cover cover;
+            _htm.coverCircle ( center, reach, level, cover );
+            for ( const vector<SSHTM::IDRange> *pRanges : { &cover.full, &cover.partial } )
+                for ( const SSHTM::IDRange &range : *pRanges )
+                {
+                    auto first = lower_bound ( entries.begin(), entries.end(), range.first, [] ( const Entry &e, uint64_t id ) { return e.htmID < id; } );
+                    auto last = upper_bound ( first, entries.end(), range.last, [] ( uint64_t id, const Entry &e ) { return id < e.htmID; } );
+                    if ( first < last )
+                        runs.push_back ( { first - entries.begin(), last - entries.begin() } );
+                }
+        }
+        else
+        {
+            runs.push_back ( { 0, entries.size() } );
+        }
+
+        // Test each object's bounding cap against the circle, skipping those below the minimum size.
+
+        for ( const pair<size_t,size_t> &run : runs )
+            for ( size_t i = run.first; i < run.second; i++ )
+            {
+                const Entry &e = entries[i];
+                if ( 2.0 * e.radius < minSize )
+                    continue;
+
+                double sep = (double) radius + e.radius;
+                if ( sep >= SSAngle::kPi || center * e.center >= cos ( sep ) )
+                {
+                    results.push_back ( e.pObject );
+                    found++;
+                }
+            }
+    }
+
+    return found;
+}
+
+int SSDeepSkyIndex::search ( SSView &view, double minPixels, vector<SSDeepSkyPtr> &results )
+{
+    double scale = min ( fabs ( view.getScaleX() ), fabs ( view.getScaleY() ) );
+    return search ( view.getCenterVector(), view.getAngularDiagonal() / 2.0, minPixels * scale, results );
+}
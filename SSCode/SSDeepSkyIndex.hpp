@@ -0,0 +1,66 @@
+// SSDeepSkyIndex.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class indexes extended deep sky objects (SSDeepSky) by position and apparent size, for level-of-detail drawing.
+// Each object is stored in the HTM triangle containing its center at the mesh level whose triangles are about its size:
+// big nebulae near the root triangles, small galaxies deep in the mesh. A query for the objects overlapping a circle
+// of sky tests each object's bounding cap (a circle of half its major axis) against the circle, and can skip objects
+// smaller than a minimum size, e.g. a few pixels at the view's scale; since size bounds each mesh level, wide fields
+// skip whole levels of tiny galaxies without touching them. The index does not own the objects; they must outlive it.
+
+#ifndef SSDeepSkyIndex_hpp
+#define SSDeepSkyIndex_hpp
+
+#include "SSHTM.hpp"
+
+class SSDeepSkyIndex
+{
+public:
+
+    static constexpr int kMaxLevel = 10;    // deepest mesh level; objects smaller than its triangles, or of unknown size, are stored there
+
+protected:
+
+    struct Entry
+    {
+        uint64_t htmID;         // HTM ID of triangle containing object's center, at object's level
+        SSVector center;        // object's J2000 position, unit vector in fundamental frame
+        float radius;           // half object's major axis, in radians; zero if unknown
+        SSDeepSkyPtr pObject;   // object, not owned
+    };
+
+    SSHTM _htm;                                 // used for its mesh geometry only; holds no objects
+    vector<Entry> _levels[kMaxLevel + 1];       // objects at each mesh level, sorted by triangle, then by decreasing size
+
+public:
+
+    // Returns the largest radius, in radians, of objects stored at a mesh level (level); objects at other levels than
+    // kMaxLevel are larger than the radius for the next level. Radii halve at each level, from 54.7° for root triangles.
+
+    static double levelRadius ( int level );
+
+    SSDeepSkyIndex ( void ) {}
+    SSDeepSkyIndex ( SSObjectArray &objects ) { build ( objects ); }
+
+    // Indexes all deep sky objects in an object array (objects), replacing any objects indexed before; other objects
+    // are ignored. Returns the number of objects indexed.
+
+    int build ( SSObjectArray &objects );
+    size_t size ( void );
+
+    // Finds objects whose bounding caps overlap a circle of (radius) radians around a unit vector (center) in the fundamental
+    // frame, and whose major axis is at least (minSize) radians; objects of unknown size are only found if (minSize) is zero.
+    // Results are appended to (results) by mesh level, from the biggest objects to the smallest. Returns the number found.
+
+    int search ( SSVector center, SSAngle radius, SSAngle minSize, vector<SSDeepSkyPtr> &results );
+
+    // Finds objects overlapping a view whose center is in the fundamental frame, at least (minPixels) pixels across at the
+    // view's scale, as above.
+
+    int search ( SSView &view, double minPixels, vector<SSDeepSkyPtr> &results );
+};
+
+#endif /* SSDeepSkyIndex_hpp */
@@ -0,0 +1,517 @@
+// SSEclipse.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include "SSEclipse.hpp"
+#include "SSPlanet.hpp"
+
+static constexpr double kTimeTol = 1.0 / SSTime::kSecondsPerDay;                   // precision of greatest eclipse and contacts [days]
+static constexpr double kGreatestWindow = 0.125;                                    // greatest eclipse is searched this close to syzygy [days]
+static constexpr double kContactWindow = 0.2;                                       // contacts are searched this close to greatest eclipse [days]
+static constexpr double kSampleStep = 1.0 / 12.0;                                   // interval between Sun and Moon samples around syzygy [days]
+static constexpr int kSampleHalfCount = 5;                                          // number of samples on each side of syzygy
+static constexpr double kScreenLat = 1.6 / SSAngle::kDegPerRad;                     // largest Moon latitude from Sun or shadow at syzygy for any eclipse [radians]
+static constexpr double kDanjon = 1.01;                                             // enlargement of Earth's radius for its shadow, by Danjon's rule
+static constexpr double kPolarStretch = 1.0 / ( 1.0 - SSCoordinates::kEarthFlattening );  // scales Earth's polar radius to its equatorial radius
+
+// Geocentric apparent positions of the Sun and Moon [AU] in the equatorial frame of date,
+// and Greenwich apparent sidereal time [radians], at one instant.
+
+struct eclipse_geometry
+{
+    SSVector sun, moon;
+    double gst;
+};
+
+// Computes the Sun and Moon's ephemerides at Julian Date (jd), from the center of the Earth (coords).
+
+static eclipse_geometry compute_geometry ( SSCoordinates &coords, SSPlanetPtr pSun, SSPlanetPtr pMoon, double jd )
+{
+    eclipse_geometry g;
+
+    coords.setTime ( SSTime ( jd ) );
+    pSun->computeEphemeris ( coords );
+    pMoon->computeEphemeris ( coords );
+
+    g.sun = coords.transform ( kFundamental, kEquatorial, pSun->getDirection() ) * pSun->getDistance();
+    g.moon = coords.transform ( kFundamental, kEquatorial, pMoon->getDirection() ) * pMoon->getDistance();
+    g.gst = coords.getLST();
+    return g;
+}
+
+// Sun and Moon geometry sampled at regular intervals around a syzygy. Over a few hours the Moon's geocentric motion
+// is so smooth that 4-point Lagrange interpolation between samples two hours apart is good to well under a kilometer,
+// so greatest eclipse and contacts are found from a dozen ephemeris computations instead of several dozen.
+
+struct eclipse_samples
+{
+    double t0;
+    vector<eclipse_geometry> g;
+
+    eclipse_samples ( SSCoordinates &coords, SSPlanetPtr pSun, SSPlanetPtr pMoon, double jd );
+    eclipse_geometry at ( double t );
+};
+
+eclipse_samples::eclipse_samples ( SSCoordinates &coords, SSPlanetPtr pSun, SSPlanetPtr pMoon, double jd )
+{
+    t0 = jd - kSampleHalfCount * kSampleStep;
+    for ( int i = 0; i <= 2 * kSampleHalfCount; i++ )
+    {
+        g.push_back ( compute_geometry ( coords, pSun, pMoon, t0 + i * kSampleStep ) );
+        if ( i > 0 )
+            g[i].gst = g[i - 1].gst + mod2pi ( g[i].gst - g[i - 1].gst );
+    }
+}
+
+eclipse_geometry eclipse_samples::at ( double t )
+{
+    int n = (int) g.size();
+    double x = ( t - t0 ) / kSampleStep;
+    int k = ::min ( ::max ( (int) floor ( x ) - 1, 0 ), n - 4 );
+
+    double w[4];
+    for ( int i = 0; i < 4; i++ )
+    {
+        w[i] = 1.0;
+        for ( int j = 0; j < 4; j++ )
+            if ( j != i )
+                w[i] *= ( x - k - j ) / ( i - j );
+    }
+
+    eclipse_geometry r = { SSVector ( 0.0, 0.0, 0.0 ), SSVector ( 0.0, 0.0, 0.0 ), 0.0 };
+    for ( int i = 0; i < 4; i++ )
+    {
+        eclipse_geometry &s = g[k + i];
+        r.sun += s.sun * w[i];
+        r.moon += s.moon * w[i];
+        r.gst += s.gst * w[i];
+    }
+
+    return r;
+}
+
+// Lunar eclipse geometry: Moon's angular distance from the axis of Earth's shadow (delta), signed north/south,
+// Moon's angular radius (sm), and angular radii of Earth's umbra (ru) and penumbra (rp) at the Moon's distance,
+// as seen from Earth's center, all in radians. Moon and Sun radii (rm, rs) are in km.
+
+struct lunar_shadow
+{
+    double delta, sm, ru, rp, dist;
+};
+
+static lunar_shadow lunar_shadow_at ( eclipse_geometry g, double rm, double rs )
+{
+    lunar_shadow s;
+    double dm = 0.0, ds = 0.0;
+    SSVector moon = g.moon.normalize ( dm ), antisun = g.sun.normalize ( ds ) * -1.0;
+
+    s.delta = moon.angularSeparation ( antisun );
+    if ( moon.z < antisun.z )
+        s.delta = -s.delta;
+
+    double pm = asin ( SSCoordinates::kAUPerEarthRadii / dm );
+    double ps = asin ( SSCoordinates::kAUPerEarthRadii / ds );
+    double ss = SSPlanet::angularRadius ( rs, ds * SSCoordinates::kKmPerAU );
+
+    s.sm = SSPlanet::angularRadius ( rm, dm * SSCoordinates::kKmPerAU );
+    s.ru = kDanjon * pm + ps - ss;
+    s.rp = kDanjon * pm + ps + ss;
+    s.dist = dm;
+    return s;
+}
+
+// Solar eclipse geometry. The Moon's penumbra and umbra radii on the fundamental plane (l1, l2) are in Earth radii;
+// (l2) is negative for the antumbra. In the frame with Earth's polar axis stretched to a unit sphere, (m) is the Moon's
+// position and (u) the shadow axis direction, away from the Sun; (gamma) is the distance of Earth's center from the axis,
+// negative if south, and (t) the distance from the Moon along the axis to Earth's surface, infinite if the axis misses.
+// (l1s, l2s) are the penumbra and umbra radii there, in AU, and (axis) is the unstretched shadow axis direction.
+// The shadow cone comes from the Moon's last computed heliocentric distance, which changes negligibly within hours.
+
+struct solar_shadow
+{
+    double l1, l2, gamma, t, l1s, l2s;
+    SSVector m, u, axis;
+};
+
+static solar_shadow solar_shadow_at ( eclipse_geometry g, SSPlanetPtr pMoon )
+{
+    solar_shadow s;
+
+    s.axis = ( g.moon - g.sun ).normalize();
+    double d = - ( g.moon * s.axis );
+    s.l1 = pMoon->penumbraRadius ( d ) / SSCoordinates::kAUPerEarthRadii;
+    s.l2 = pMoon->umbraRadius ( d ) / SSCoordinates::kAUPerEarthRadii;
+
+    SSVector sun ( g.sun.x, g.sun.y, g.sun.z * kPolarStretch );
+    s.m = SSVector ( g.moon.x, g.moon.y, g.moon.z * kPolarStretch ) / SSCoordinates::kAUPerEarthRadii;
+    s.u = ( s.m - sun / SSCoordinates::kAUPerEarthRadii ).normalize();
+
+    double b = s.m * s.u;
+    SSVector p = s.m - s.u * b;
+    s.gamma = p.z < 0.0 ? -p.magnitude() : p.magnitude();
+
+    double disc = b * b - s.m * s.m + 1.0;
+    s.t = disc >= 0.0 ? -b - sqrt ( disc ) : INFINITY;
+    s.l1s = s.t < INFINITY ? pMoon->penumbraRadius ( s.t * SSCoordinates::kAUPerEarthRadii ) : INFINITY;
+    s.l2s = s.t < INFINITY ? pMoon->umbraRadius ( s.t * SSCoordinates::kAUPerEarthRadii ) : INFINITY;
+    return s;
+}
+
+// Finds the times before and after greatest eclipse (tg) at which a function of time (f) crosses zero; it is negative
+// at greatest eclipse (fg), and its values at the ends of the search window (fa, fb) are used to bracket each crossing.
+// Returns the times in (t1, t2), or infinity where there is no crossing.
+
+template<class F> static void find_contacts ( F f, double tg, double fg, double fa, double fb, SSTime &t1, SSTime &t2 )
+{
+    t1 = t2 = INFINITY;
+    if ( ! ( fg < 0.0 ) )
+        return;
+
+    double fx = fg;
+    if ( fa > 0.0 )
+        t1 = SSEvent::illinoisRoot ( f, tg - kContactWindow, tg, fa, fx, kTimeTol );
+
+    fx = fb;
+    if ( fb > 0.0 )
+        t2 = SSEvent::illinoisRoot ( f, tg, tg + kContactWindow, fg, fx, kTimeTol );
+}
+
+// Refines a possible lunar eclipse near the full moon at Julian Date (jd). Returns false if there is none.
+
+static bool lunar_eclipse ( eclipse_samples &samples, SSPlanetPtr pSun, SSPlanetPtr pMoon, double jd, SSEclipse::Global &e )
+{
+    double rs = pSun->getRadius(), rm = pMoon->getRadius();
+    auto shadow = [&] ( double t ) { return lunar_shadow_at ( samples.at ( t ), rm, rs ); };
+    auto delta = [&] ( double t ) { return fabs ( shadow ( t ).delta ); };
+
+    double fx = delta ( jd );
+    double tg = SSEvent::brentMinimum ( delta, jd - kGreatestWindow, jd + kGreatestWindow, jd, fx, kTimeTol );
+    lunar_shadow sg = shadow ( tg );
+    double dg = fabs ( sg.delta );
+    if ( dg >= sg.rp + sg.sm )
+        return false;
+
+    e.greatest = SSTime ( tg );
+    e.magnitude = ( sg.ru + sg.sm - dg ) / ( 2.0 * sg.sm );
+    e.penumbral = ( sg.rp + sg.sm - dg ) / ( 2.0 * sg.sm );
+    e.gamma = sin ( sg.delta ) * sg.dist / SSCoordinates::kAUPerEarthRadii;
+    e.type = e.magnitude >= 1.0 ? SSEclipse::kTotalLunar : e.magnitude > 0.0 ? SSEclipse::kPartialLunar : SSEclipse::kPenumbralLunar;
+
+    // Each contact is where the Moon's distance from the shadow axis equals a sum or difference of radii.
+
+    lunar_shadow sa = shadow ( tg - kContactWindow ), sb = shadow ( tg + kContactWindow );
+    auto penumbra = [] ( const lunar_shadow &s ) { return fabs ( s.delta ) - s.rp - s.sm; };
+    auto umbra1 = [] ( const lunar_shadow &s ) { return fabs ( s.delta ) - s.ru - s.sm; };
+    auto umbra2 = [] ( const lunar_shadow &s ) { return fabs ( s.delta ) - s.ru + s.sm; };
+
+    find_contacts ( [&] ( double t ) { return penumbra ( shadow ( t ) ); }, tg, penumbra ( sg ), penumbra ( sa ), penumbra ( sb ), e.p1, e.p4 );
+    find_contacts ( [&] ( double t ) { return umbra1 ( shadow ( t ) ); }, tg, umbra1 ( sg ), umbra1 ( sa ), umbra1 ( sb ), e.u1, e.u4 );
+    find_contacts ( [&] ( double t ) { return umbra2 ( shadow ( t ) ); }, tg, umbra2 ( sg ), umbra2 ( sa ), umbra2 ( sb ), e.u2, e.u3 );
+    return true;
+}
+
+// Refines a possible solar eclipse near the new moon at Julian Date (jd). Returns false if there is none.
+
+static bool solar_eclipse ( eclipse_samples &samples, SSPlanetPtr pMoon, double jd, SSEclipse::Global &e )
+{
+    auto shadow = [&] ( double t ) { return solar_shadow_at ( samples.at ( t ), pMoon ); };
+    auto gamma = [&] ( double t ) { return fabs ( shadow ( t ).gamma ); };
+
+    double fx = gamma ( jd );
+    double tg = SSEvent::brentMinimum ( gamma, jd - kGreatestWindow, jd + kGreatestWindow, jd, fx, kTimeTol );
+    solar_shadow sg = shadow ( tg );
+    double g = fabs ( sg.gamma );
+    if ( g >= 1.0 + sg.l1 )
+        return false;
+
+    e.greatest = SSTime ( tg );
+    e.gamma = sg.gamma;
+    e.penumbral = 0.0;
+
+    // Each contact is where the shadow axis' distance from Earth's center equals a sum or difference of radii.
+
+    solar_shadow sa = shadow ( tg - kContactWindow ), sb = shadow ( tg + kContactWindow );
+    auto penumbra = [] ( const solar_shadow &s ) { return fabs ( s.gamma ) - 1.0 - s.l1; };
+    auto umbra1 = [] ( const solar_shadow &s ) { return fabs ( s.gamma ) - 1.0 - fabs ( s.l2 ); };
+    auto umbra2 = [] ( const solar_shadow &s ) { return fabs ( s.gamma ) - 1.0 + fabs ( s.l2 ); };
+
+    find_contacts ( [&] ( double t ) { return penumbra ( shadow ( t ) ); }, tg, penumbra ( sg ), penumbra ( sa ), penumbra ( sb ), e.p1, e.p4 );
+    find_contacts ( [&] ( double t ) { return umbra1 ( shadow ( t ) ); }, tg, umbra1 ( sg ), umbra1 ( sa ), umbra1 ( sb ), e.u1, e.u4 );
+    find_contacts ( [&] ( double t ) { return umbra2 ( shadow ( t ) ); }, tg, umbra2 ( sg ), umbra2 ( sa ), umbra2 ( sb ), e.u2, e.u3 );
+
+    // A central eclipse is total where Earth's surface is inside the umbra; if that changes between greatest eclipse
+    // and the ends of the central line, near U2 and U3, it is hybrid. Magnitude is the Moon/Sun diameter ratio there.
+    // Otherwise, magnitude is the fraction of the Sun's diameter covered at the point on Earth nearest the shadow axis.
+
+    if ( g < 1.0 )
+    {
+        bool total = sg.l2s > 0.0, hybrid = false;
+        for ( double t : { e.u2.jd, e.u3.jd } )
+        {
+            if ( ::isinf ( t ) )
+                continue;
+
+            solar_shadow s = shadow ( t );
+            if ( s.t < INFINITY && ( s.l2s > 0.0 ) != total )
+                hybrid = true;
+        }
+
+        e.magnitude = ( sg.l1s + sg.l2s ) / ( sg.l1s - sg.l2s );
+        e.type = hybrid ? SSEclipse::kHybridSolar : total ? SSEclipse::kTotalSolar : SSEclipse::kAnnularSolar;
+    }
+    else
+    {
+        e.magnitude = ( 1.0 + sg.l1 - g ) / ( sg.l1 - sg.l2 );
+        e.type = g < 1.0 + fabs ( sg.l2 ) ? ( sg.l2 > 0.0 ? SSEclipse::kTotalSolar : SSEclipse::kAnnularSolar ) : SSEclipse::kPartialSolar;
+    }
+
+    return true;
+}
+
+// Returns the Moon's ecliptic latitude minus the Sun's (solar), or plus the Sun's (lunar), in the J2000 ecliptic frame.
+// Objects' directions must already be computed.
+
+static double syzygy_latitude ( SSMatrix &eclMat, SSPlanetPtr pSun, SSPlanetPtr pMoon, bool solar )
+{
+    double moonLat = asin ( ( eclMat * pMoon->getDirection() ).z );
+    double sunLat = asin ( ( eclMat * pSun->getDirection() ).z );
+    return solar ? moonLat - sunLat : moonLat + sunLat;
+}
+
+int SSEclipse::findEclipses ( SSObjectPtr pSun, SSObjectPtr pMoon, SSTime start, SSTime stop, bool solar, bool lunar, vector<Global> &eclipses, int maxEclipses )
+{
+    SSPlanetPtr pSunCopy = SSGetPlanetPtr ( SSCloneObject ( pSun ) );
+    SSPlanetPtr pMoonCopy = SSGetPlanetPtr ( SSCloneObject ( pMoon ) );
+    if ( pSunCopy == nullptr || pMoonCopy == nullptr )
+    {
+        delete pSunCopy;
+        delete pMoonCopy;
+        return 0;
+    }
+
+    // Work from the center of the Earth. Syzygies are screened by the Moon's latitude in the J2000 ecliptic,
+    // which is as good as the ecliptic of date for this purpose since the Sun's latitude is subtracted.
+
+    SSCoordinates coords ( start, SSSpherical ( 0.0, 0.0, -SSCoordinates::kKmPerEarthRadii ) );
+    SSMatrix eclMat = SSCoordinates::getEclipticMatrix ( -SSCoordinates::getObliquity ( SSTime::kJ2000 ) );
+
+    // Step through new moons (k = 0) and full moons (k = 1) in time order. Start half a search window early, so eclipses
+    // whose syzygy falls just before the start time are still found. nextMoonPhase() leaves the Sun and Moon computed
+    // within a minute of syzygy, so screen each one right after finding it.
+
+    double times[2] = { INFINITY, INFINITY }, lats[2] = { INFINITY, INFINITY };
+    bool wanted[2] = { solar, lunar };
+    const double phases[2] = { SSEvent::kNewMoon, SSEvent::kFullMoon };
+
+    auto next_syzygy = [&] ( int k, double jd )
+    {
+        times[k] = SSEvent::nextMoonPhase ( SSTime ( jd ), pSunCopy, pMoonCopy, phases[k] );
+        lats[k] = syzygy_latitude ( eclMat, pSunCopy, pMoonCopy, k == 0 );
+    };
+
+    for ( int k = 0; k < 2; k++ )
+        if ( wanted[k] )
+            next_syzygy ( k, start - kGreatestWindow );
+
+    int n = 0;
+    while ( n < maxEclipses )
+    {
+        int k = times[0] <= times[1] ? 0 : 1;
+        double jd = times[k];
+        if ( ! ( jd <= stop + kGreatestWindow ) )
+            break;
+
+        Global e = { kNoEclipse, jd, 0.0, 0.0, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY };
+        if ( fabs ( lats[k] ) < kScreenLat )
+        {
+            eclipse_samples samples ( coords, pSunCopy, pMoonCopy, jd );
+            bool found = k == 0 ? solar_eclipse ( samples, pMoonCopy, jd, e ) : lunar_eclipse ( samples, pSunCopy, pMoonCopy, jd, e );
+            if ( found && e.greatest >= start && e.greatest <= stop )
+            {
+                eclipses.push_back ( e );
+                n++;
+            }
+        }
+
+        next_syzygy ( k, jd + 1.0 );
+    }
+
+    delete pSunCopy;
+    delete pMoonCopy;
+    return n;
+}
+
+bool SSEclipse::localCircumstances ( SSObjectPtr pSun, SSObjectPtr pMoon, const Global &eclipse, SSSpherical location, Local &local )
+{
+    local = { INFINITY, INFINITY, eclipse.greatest, INFINITY, INFINITY, 0.0, 0.0 };
+    SSPlanetPtr pSunCopy = SSGetPlanetPtr ( SSCloneObject ( pSun ) );
+    SSPlanetPtr pMoonCopy = SSGetPlanetPtr ( SSCloneObject ( pMoon ) );
+    if ( pSunCopy == nullptr || pMoonCopy == nullptr || eclipse.type == kNoEclipse )
+    {
+        delete pSunCopy;
+        delete pMoonCopy;
+        return false;
+    }
+
+    SSCoordinates coords ( eclipse.greatest, location );
+    bool found = true;
+
+    if ( isLunar ( eclipse.type ) )
+    {
+        // Lunar eclipse contacts are the same everywhere; only the Moon's altitude depends on location.
+
+        bool penumbral = eclipse.type == kPenumbralLunar;
+        local.c1 = penumbral ? eclipse.p1 : eclipse.u1;
+        local.c2 = eclipse.u2;
+        local.c3 = eclipse.u3;
+        local.c4 = penumbral ? eclipse.p4 : eclipse.u4;
+        local.magnitude = penumbral ? eclipse.penumbral : eclipse.magnitude;
+        pMoonCopy->computeEphemeris ( coords );
+        local.altitude = SSSpherical ( coords.transform ( kFundamental, kHorizon, pMoonCopy->getDirection() ) ).lat;
+    }
+    else
+    {
+        // Topocentric separation of Sun and Moon centers, and their angular radii.
+
+        struct disks { double sep, ss, sm; };
+        auto compute = [&] ( double t )
+        {
+            coords.setTime ( SSTime ( t ) );
+            pSunCopy->computeEphemeris ( coords );
+            pMoonCopy->computeEphemeris ( coords );
+            disks d = { pSunCopy->getDirection().angularSeparation ( pMoonCopy->getDirection() ), pSunCopy->angularRadius(), pMoonCopy->angularRadius() };
+            return d;
+        };
+
+        auto outer = [] ( const disks &d ) { return d.sep - d.ss - d.sm; };
+        auto inner = [] ( const disks &d ) { return d.sep - fabs ( d.ss - d.sm ); };
+
+        // The separation has a single minimum between the global P1 and P4, when the Moon's penumbra is on Earth.
+
+        double t1 = eclipse.p1, t4 = eclipse.p4, fx = compute ( eclipse.greatest ).sep;
+        double tmax = SSEvent::brentMinimum ( [&] ( double t ) { return compute ( t ).sep; }, t1, t4, eclipse.greatest, fx, kTimeTol );
+        disks d1 = compute ( t1 ), d4 = compute ( t4 ), dmax = compute ( tmax );
+
+        local.max = SSTime ( tmax );
+        local.altitude = SSSpherical ( coords.transform ( kFundamental, kHorizon, pSunCopy->getDirection() ) ).lat;
+        local.magnitude = max ( 0.0, -outer ( dmax ) ) / ( 2.0 * dmax.ss );
+
+        found = outer ( dmax ) < 0.0;
+        if ( found )
+        {
+            double fa = outer ( d1 ), fb = outer ( d4 ), fm = outer ( dmax );
+            if ( fa > 0.0 )
+                local.c1 = SSEvent::illinoisRoot ( [&] ( double t ) { return outer ( compute ( t ) ); }, t1, tmax, fa, fm, kTimeTol );
+            else
+                local.c1 = t1;
+
+            if ( fb > 0.0 )
+                local.c4 = SSEvent::illinoisRoot ( [&] ( double t ) { return outer ( compute ( t ) ); }, tmax, t4, outer ( dmax ), fb, kTimeTol );
+            else
+                local.c4 = t4;
+
+            // Totality or annularity, between the first and last contacts.
+
+            fm = inner ( dmax );
+            if ( fm < 0.0 )
+            {
+                fa = inner ( compute ( local.c1 ) );
+                fb = inner ( compute ( local.c4 ) );
+                local.c2 = SSEvent::illinoisRoot ( [&] ( double t ) { return inner ( compute ( t ) ); }, local.c1, tmax, fa, fm, kTimeTol );
+                local.c3 = SSEvent::illinoisRoot ( [&] ( double t ) { return inner ( compute ( t ) ); }, tmax, local.c4, inner ( dmax ), fb, kTimeTol );
+            }
+        }
+    }
+
+    delete pSunCopy;
+    delete pMoonCopy;
+    return found;
+}
+
+// Converts the point where the shadow axis meets Earth's surface (s) to a central line point, at time (jd).
+
+static SSEclipse::PathPoint path_point ( double jd, eclipse_geometry g, solar_shadow s )
+{
+    SSEclipse::PathPoint p;
+
+    // Unstretch the surface point, then rotate from the equatorial frame of date to Earth-fixed coordinates.
+
+    SSVector x = ( s.m + s.u * s.t ) * SSCoordinates::kKmPerEarthRadii;
+    x.z /= kPolarStretch;
+    double cg = cos ( g.gst ), sg = sin ( g.gst );
+    SSVector xe ( x.x * cg + x.y * sg, x.y * cg - x.x * sg, x.z );
+    SSSpherical geo = SSCoordinates::toGeodetic ( xe, SSCoordinates::kKmPerEarthRadii, SSCoordinates::kEarthFlattening );
+
+    // Sun's altitude is the angle between the direction to the Sun and the local horizon plane.
+
+    SSVector up ( SSSpherical ( geo.lon + g.gst, geo.lat, 1.0 ) );
+
+    p.time = SSTime ( jd );
+    p.lon = SSAngle ( geo.lon ).modPi();
+    p.lat = geo.lat;
+    p.altitude = asin ( -( s.axis * up ) );
+    p.width = 2.0 * fabs ( s.l2s ) * SSCoordinates::kKmPerAU;
+    p.magnitude = ( s.l1s + s.l2s ) / ( s.l1s - s.l2s );
+    return p;
+}
+
+int SSEclipse::centralPath ( SSObjectPtr pSun, SSObjectPtr pMoon, const Global &eclipse, double step, vector<PathPoint> &path )
+{
+    if ( ! isSolar ( eclipse.type ) || fabs ( eclipse.gamma ) >= 1.0 || ! ( step > 0.0 ) )
+        return 0;
+
+    SSPlanetPtr pSunCopy = SSGetPlanetPtr ( SSCloneObject ( pSun ) );
+    SSPlanetPtr pMoonCopy = SSGetPlanetPtr ( SSCloneObject ( pMoon ) );
+    if ( pSunCopy == nullptr || pMoonCopy == nullptr )
+    {
+        delete pSunCopy;
+        delete pMoonCopy;
+        return 0;
+    }
+
+    SSCoordinates coords ( eclipse.greatest, SSSpherical ( 0.0, 0.0, -SSCoordinates::kKmPerEarthRadii ) );
+    auto geometry = [&] ( double t ) { return compute_geometry ( coords, pSunCopy, pMoonCopy, t ); };
+    auto central = [&] ( double t ) { return fabs ( solar_shadow_at ( geometry ( t ), pMoonCopy ).gamma ) - 1.0; };
+
+    // The central line begins and ends where the shadow axis is tangent to Earth's surface.
+
+    double tg = eclipse.greatest;
+    SSTime t1, t2;
+    find_contacts ( central, tg, central ( tg ), central ( tg - kContactWindow ), central ( tg + kContactWindow ), t1, t2 );
+    if ( ::isinf ( t1.jd ) || ::isinf ( t2.jd ) )
+    {
+        delete pSunCopy;
+        delete pMoonCopy;
+        return 0;
+    }
+
+    // Root finding leaves the ends within a second of tangency, possibly just off Earth; put them on the limb.
+
+    int n = 0;
+    for ( double t = t1; true; t += step )
+    {
+        bool last = t >= t2 - step * 0.01;
+        if ( last )
+            t = t2;
+
+        eclipse_geometry g = geometry ( t );
+        solar_shadow s = solar_shadow_at ( g, pMoonCopy );
+        if ( ::isinf ( s.t ) )
+        {
+            s.t = - ( s.m * s.u );
+            s.l1s = pMoonCopy->penumbraRadius ( s.t * SSCoordinates::kAUPerEarthRadii );
+            s.l2s = pMoonCopy->umbraRadius ( s.t * SSCoordinates::kAUPerEarthRadii );
+        }
+
+        path.push_back ( path_point ( t, g, s ) );
+        n++;
+        if ( last )
+            break;
+    }
+
+    delete pSunCopy;
+    delete pMoonCopy;
+    return n;
+}
@@ -0,0 +1,101 @@
+// SSEclipse.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class finds solar and lunar eclipses and computes their global and local circumstances.
+// Candidates are the new and full moons found by SSEvent::nextMoonPhase(); only those where the Moon is near a node
+// of its orbit - its ecliptic latitude relative to the Sun, or to Earth's shadow, is small enough for an eclipse -
+// are examined further. Greatest eclipse is refined with Brent's method and contacts with the Illinois method
+// (SSEvent::brentMinimum() and illinoisRoot()) to about one second, so each eclipse takes a few dozen Sun and Moon
+// ephemeris computations, and a century of eclipses a few thousand more to find the syzygies.
+//
+// Lunar eclipses use Earth's shadow enlarged by Danjon's rule (1% of Earth's radius), as in modern eclipse canons.
+// Solar eclipses use the Moon's shadow cone from SSPlanet::umbraRadius() and penumbraRadius() on the fundamental plane
+// through Earth's center perpendicular to the shadow axis, as in Besselian elements. Earth's flattening is handled by
+// stretching the polar axis of the equatorial frame of date until Earth's ellipsoid is a sphere; this is exact for
+// the point where the shadow axis meets the surface, and good to a few seconds for the global contacts.
+
+#ifndef SSEclipse_hpp
+#define SSEclipse_hpp
+
+#include "SSEvent.hpp"
+
+class SSEclipse
+{
+public:
+
+    enum Type
+    {
+        kNoEclipse = 0,
+        kPenumbralLunar = 1,    // Moon passes through Earth's penumbra only
+        kPartialLunar = 2,      // Moon partly enters Earth's umbra
+        kTotalLunar = 3,        // Moon entirely enters Earth's umbra
+        kPartialSolar = 4,      // only Moon's penumbra touches Earth
+        kAnnularSolar = 5,      // Moon's antumbra touches Earth
+        kTotalSolar = 6,        // Moon's umbra touches Earth
+        kHybridSolar = 7        // central eclipse which is annular at the ends of its path and total in the middle, or vice-versa
+    };
+
+    // Global circumstances of an eclipse. Lunar eclipse contacts are the Moon's limb with Earth's penumbra (P1, P4) and
+    // umbra (U1-U4; U2 and U3 begin and end totality). Solar eclipse contacts are the Moon's penumbra (P1, P4) and umbra
+    // or antumbra (U1-U4) with Earth's limb; U2 and U3 are when the umbra or antumbra is entirely on Earth. Contacts which
+    // do not occur are infinite. All times are Julian Dates (UT).
+
+    struct Global
+    {
+        Type type;              // type of eclipse
+        SSTime greatest;        // time of greatest eclipse: Moon closest to Earth's shadow axis, or shadow axis closest to Earth's center
+        double magnitude;       // umbral magnitude (lunar); fraction of Sun's diameter covered, or Moon/Sun diameter ratio if central, at greatest eclipse (solar)
+        double penumbral;       // penumbral magnitude (lunar); zero (solar)
+        double gamma;           // least distance of Moon's center from Earth's shadow axis (lunar), or shadow axis from Earth's center (solar), in Earth radii; negative if south
+        SSTime p1, u1, u2, u3, u4, p4;
+    };
+
+    // Circumstances of an eclipse at one location. For solar eclipses, (c1, c4) are the first and last contacts of the Moon's
+    // and Sun's disks; (c2, c3) begin and end totality or annularity, or are infinite if the eclipse is partial there. For lunar
+    // eclipses, which look the same everywhere the Moon is up, they are the global umbral contacts U1-U4, or P1 and P4 for a
+    // penumbral eclipse. (altitude) is the Sun's (solar) or Moon's (lunar) geometric altitude at maximum eclipse.
+
+    struct Local
+    {
+        SSTime c1, c2, max, c3, c4;
+        double magnitude;       // fraction of Sun's diameter covered at maximum eclipse (solar); umbral or penumbral magnitude (lunar)
+        SSAngle altitude;
+    };
+
+    // One point along the central line of a total, annular, or hybrid solar eclipse.
+
+    struct PathPoint
+    {
+        SSTime time;            // Julian Date (UT)
+        SSAngle lon, lat;       // geodetic longitude (east positive) and latitude where shadow axis meets Earth's surface [radians]
+        SSAngle altitude;       // Sun's geometric altitude there [radians]
+        double width;           // diameter of umbra or antumbra there, perpendicular to shadow axis [km]
+        double magnitude;       // Moon/Sun apparent diameter ratio there; greater than 1 if total
+    };
+
+    static bool isSolar ( Type type ) { return type >= kPartialSolar; }
+    static bool isLunar ( Type type ) { return type >= kPenumbralLunar && type <= kTotalLunar; }
+
+    // Finds solar eclipses (solar) and/or lunar eclipses (lunar) whose greatest eclipse is from (start) to (stop),
+    // using the Sun (pSun) and Moon (pMoon) objects, which are not modified. Eclipses are appended to (eclipses)
+    // in time order, up to (maxEclipses). Returns the number of eclipses found.
+
+    static int findEclipses ( SSObjectPtr pSun, SSObjectPtr pMoon, SSTime start, SSTime stop, bool solar, bool lunar, vector<Global> &eclipses, int maxEclipses );
+
+    // Computes local circumstances of an eclipse (eclipse) found by findEclipses() at a geographic location (location:
+    // longitude, latitude in radians, height in km). Returns true if the eclipse occurs there, whether or not the Sun
+    // or Moon is above the horizon, or false if the location is outside the Moon's penumbra.
+
+    static bool localCircumstances ( SSObjectPtr pSun, SSObjectPtr pMoon, const Global &eclipse, SSSpherical location, Local &local );
+
+    // Computes the central line of a total, annular, or hybrid solar eclipse (eclipse) from where the shadow axis first
+    // meets Earth to where it leaves, at intervals of (step) days, with both ends found by root finding. Points are appended
+    // to (path). Returns the number of points, or zero if the eclipse is not central.
+
+    static int centralPath ( SSObjectPtr pSun, SSObjectPtr pMoon, const Global &eclipse, double step, vector<PathPoint> &path );
+};
+
+#endif /* SSEclipse_hpp */
@@ -0,0 +1,60 @@
+// SSEphemerisContext.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include "SSEphemerisContext.hpp"
+#include "SSCoordinates.hpp"
+
+static thread_local SSEphemerisContext _defaultContext;
+static thread_local SSEphemerisContext *_currentContext = nullptr;
+
+SSEphemerisContext::SSEphemerisContext ( void )
+{
+    clear();
+}
+
+void SSEphemerisContext::clear ( void )
+{
+    eclMatJED = 0.0;
+    earthJED = 0.0;
+    deltaT = 0.0;
+    jupiterMoonsJED[0] = jupiterMoonsJED[1] = 0.0;
+    saturnMoonsJED[0] = saturnMoonsJED[1] = 0.0;
+
+    for ( int i = 0; i < kNumPrimaries; i++ )
+        primaryJED[i] = 0.0;
+}
+
+// Returns matrix which transforms from the ecliptic frame of date (jed) to the fundamental J2000
+// equatorial frame. Caches the matrix, since it's the same for every object computed at one time.
+
+SSMatrix SSEphemerisContext::getEclipticMatrix ( double jed )
+{
+    if ( jed != eclMatJED )
+    {
+        SSMatrix eclipticMat = SSCoordinates::getEclipticMatrix ( SSCoordinates::getObliquity ( jed ) );
+        SSMatrix preMat = SSCoordinates::getPrecessionMatrix ( jed ).transpose();
+        eclMat = preMat * eclipticMat;
+        eclMatJED = jed;
+    }
+
+    return eclMat;
+}
+
+SSEphemerisContext &SSEphemerisContext::current ( void )
+{
+    return _currentContext ? *_currentContext : _defaultContext;
+}
+
+SSEphemerisContext::Scope::Scope ( SSEphemerisContext &context )
+{
+    _previous = _currentContext;
+    _currentContext = &context;
+}
+
+SSEphemerisContext::Scope::~Scope ( void )
+{
+    _currentContext = _previous;
+}
@@ -0,0 +1,84 @@
+// SSEphemerisContext.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class holds the intermediate results which solar system ephemeris computation
+// reuses from one object to the next at the same time: primary planet positions for moons,
+// Earth's position and precession matrix for satellites, the ecliptic-of-date matrix,
+// and all moons of Jupiter and Saturn, whose theories compute a whole system at once.
+// These used to be function statics shared by every thread, guarded by mutexes.
+// Now each thread has its own default context, and each SSCoordinates object (i.e. each timeline)
+// owns another, so independent threads and timelines never share mutable state.
+// Planetary theories (VSOP2013, ELPMPP02, JPL DE files) are read-only once loaded, and stay shared.
+
+#ifndef SSEphemerisContext_hpp
+#define SSEphemerisContext_hpp
+
+#include "SSVector.hpp"
+#include "SSMatrix.hpp"
+#include "SSMoonEphemeris.hpp"
+
+class SSEphemerisContext
+{
+public:
+
+    static constexpr int kNumPrimaries = 10;    // primary planets: 0 = Sun, 1 - 9 = Mercury - Pluto
+
+    double   eclMatJED;                         // JED at which eclMat was computed; 0 if never
+    SSMatrix eclMat;                            // transforms from ecliptic of date to fundamental J2000 equatorial frame
+
+    double   primaryJED[kNumPrimaries];         // JED (antedated for light time) of primary planet position and velocity
+    SSVector primaryPos[kNumPrimaries];         // primary planet heliocentric position [AU]
+    SSVector primaryVel[kNumPrimaries];         // primary planet heliocentric velocity [AU/day]
+
+    double   earthJED;                          // JED at which Earth values for satellites were computed; 0 if never
+    double   deltaT;                            // Delta T at earthJED [days]
+    SSVector earthPos, earthVel;                // Earth's heliocentric position [AU] and velocity [AU/day]
+    SSMatrix earthMat;                          // transforms from mean equatorial frame of date to fundamental frame
+
+    // Moon systems are kept twice: [0] without light time, [1] antedated for light time,
+    // since ephemeris computation alternates between the two for each moon.
+
+    double   jupiterMoonsJED[2];                // JED of Galilean moon positions and velocities; 0 if never
+    SSVector jupiterMoonPos[2][SSMoonEphemeris::kNumJupiterMoons];  // Jupiter-centric position [AU]
+    SSVector jupiterMoonVel[2][SSMoonEphemeris::kNumJupiterMoons];  // Jupiter-centric velocity [AU/day]
+
+    double   saturnMoonsJED[2];                 // JED of Saturn's moon positions and velocities; 0 if never
+    SSVector saturnMoonPos[2][SSMoonEphemeris::kNumSaturnMoons];    // Saturn-centric position [AU]
+    SSVector saturnMoonVel[2][SSMoonEphemeris::kNumSaturnMoons];    // Saturn-centric velocity [AU/day]
+
+    SSEphemerisContext ( void );
+
+    // Forgets all intermediate results; call after changing the underlying ephemeris.
+
+    void clear ( void );
+
+    // Returns the ecliptic-of-date to fundamental frame matrix, recomputing it only if jed has changed.
+
+    SSMatrix getEclipticMatrix ( double jed );
+
+    // Returns the context used by ephemeris computation on the calling thread: the one set by
+    // the innermost Scope on this thread, or the thread's own default context if none.
+
+    static SSEphemerisContext &current ( void );
+
+    // Makes a context current on the calling thread for the lifetime of this object,
+    // then restores the previously current one.
+
+    class Scope
+    {
+        SSEphemerisContext *_previous;
+
+    public:
+
+        Scope ( SSEphemerisContext &context );
+        ~Scope ( void );
+
+        Scope ( const Scope & ) = delete;
+        Scope &operator = ( const Scope & ) = delete;
+    };
+};
+
+#endif /* SSEphemerisContext_hpp */
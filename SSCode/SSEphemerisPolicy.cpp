@@ -0,0 +1,189 @@
+// SSEphemerisPolicy.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <chrono>
+
+#include "SSEphemerisPolicy.hpp"
+#include "SSPlanet.hpp"
+#include "SSJPLDEphemeris.hpp"
+
+int SSEphemerisPolicy::bodyIndex ( int id )
+{
+    if ( id >= kSun && id <= kPluto )
+        return id;
+    else if ( id == kLuna )
+        return 10;
+    else
+        return -1;
+}
+
+void SSEphemerisPolicy::set ( int id, double jed0, double jed1, SSEphemerisBackend backend )
+{
+    int i = bodyIndex ( id );
+    if ( i >= 0 )
+        _entries[i].push_back ( { jed0, jed1, backend } );
+}
+
+SSEphemerisBackend SSEphemerisPolicy::select ( int id, double jed ) const
+{
+    int i = bodyIndex ( id );
+    if ( i < 0 )
+        return kBackendDefault;
+
+    for ( const Entry &entry : _entries[i] )
+        if ( jed >= entry.jed0 && jed < entry.jed1 )
+            return entry.backend;
+
+    return kBackendDefault;
+}
+
+bool SSEphemerisPolicy::empty ( void ) const
+{
+    for ( int i = 0; i < kNumBodies; i++ )
+        if ( ! _entries[i].empty() )
+            return false;
+
+    return true;
+}
+
+void SSEphemerisPolicy::clear ( void )
+{
+    for ( int i = 0; i < kNumBodies; i++ )
+        _entries[i].clear();
+}
+
+string SSEphemerisPolicy::backendName ( SSEphemerisBackend backend )
+{
+    if ( backend == kBackendJPLDE )
+        return "JPL DE";
+    else if ( backend == kBackendVSOPELP )
+        return "VSOP/ELP";
+    else if ( backend == kBackendPS )
+        return "PS";
+    else if ( backend == kBackendVP )
+        return "VP";
+    else
+        return "default";
+}
+
+// Computes a body's (id) geocentric position at Julian Ephemeris Date (jed) with one backend. For Earth, computes
+// the Sun's geocentric position, which measures Earth's heliocentric position. Returns false if the backend can't.
+
+static bool geocentricPosition ( SSEphemerisBackend backend, int id, double jed, SSVector &pos )
+{
+    SSVector vel, epos, evel;
+
+    if ( id == kLuna )
+        return SSPlanet::computeBackendPositionVelocity ( backend, kLuna, jed, pos, vel );
+
+    if ( ! SSPlanet::computeBackendPositionVelocity ( backend, kEarth, jed, epos, evel ) )
+        return false;
+
+    if ( id == kSun || id == kEarth )
+    {
+        pos = epos * -1.0;
+        return true;
+    }
+
+    if ( ! SSPlanet::computeBackendPositionVelocity ( backend, id, jed, pos, vel ) )
+        return false;
+
+    pos -= epos;
+    return true;
+}
+
+vector<SSEphemerisPolicy::Measurement> SSEphemerisPolicy::measure ( double jed0, double jed1, double eraDays, int samples )
+{
+    static const SSEphemerisBackend backends[] = { kBackendJPLDE, kBackendVSOPELP, kBackendPS, kBackendVP };
+    static const int ids[] = { kEarth, kMercury, kVenus, kMars, kJupiter, kSaturn, kUranus, kNeptune, kPluto, kLuna };
+    vector<Measurement> measurements;
+
+    samples = max ( samples, 1 );
+    for ( double era0 = jed0; era0 < jed1; era0 += eraDays )
+    {
+        double era1 = min ( era0 + eraDays, jed1 );
+        double step = ( era1 - era0 ) / samples;
+
+        for ( int id : ids )
+        {
+            // Reference directions come from JPL DE; skip the body if it doesn't cover the whole era.
+
+            vector<SSVector> refs ( samples );
+            bool covered = true;
+            for ( int k = 0; k < samples && covered; k++ )
+                if ( ( covered = geocentricPosition ( kBackendJPLDE, id, era0 + ( k + 0.5 ) * step, refs[k] ) ) )
+                    refs[k] = refs[k].normalize();
+
+            if ( ! covered )
+                continue;
+
+            for ( SSEphemerisBackend backend : backends )
+            {
+                Measurement m = { id, era0, era1, backend, 0.0, 0.0 };
+                SSVector pos, vel;
+                bool ok = true;
+
+                for ( int k = 0; k < samples && ok; k++ )
+                {
+                    ok = geocentricPosition ( backend, id, era0 + ( k + 0.5 ) * step, pos );
+                    if ( ok )
+                        m.maxError = max ( m.maxError, pos.normalize().angularSeparation ( refs[k] ).toArcsec() );
+                }
+
+                if ( ! ok )
+                    continue;
+
+                // Time the body's own position and velocity computations.
+
+                auto start = chrono::steady_clock::now();
+                for ( int k = 0; k < samples; k++ )
+                    SSPlanet::computeBackendPositionVelocity ( backend, id, era0 + ( k + 0.5 ) * step, pos, vel );
+                m.nsPerCall = chrono::duration<double, nano> ( chrono::steady_clock::now() - start ).count() / samples;
+                measurements.push_back ( m );
+            }
+        }
+    }
+
+    return measurements;
+}
+
+SSEphemerisPolicy SSEphemerisPolicy::choose ( const vector<Measurement> &measurements, double budget, bool useJPLDE )
+{
+    SSEphemerisPolicy policy;
+
+    for ( size_t i = 0; i < measurements.size(); )
+    {
+        // Measurements of all backends for one body and era are adjacent; find the best among them.
+
+        const Measurement *best = nullptr;
+        size_t j = i;
+        for ( ; j < measurements.size() && measurements[j].id == measurements[i].id && measurements[j].jed0 == measurements[i].jed0; j++ )
+        {
+            const Measurement &m = measurements[j];
+            if ( m.backend == kBackendJPLDE && ! useJPLDE )
+                continue;
+
+            bool mWithin = m.maxError <= budget, bestWithin = best != nullptr && best->maxError <= budget;
+            if ( best == nullptr || ( mWithin && ! bestWithin ) || ( mWithin && m.nsPerCall < best->nsPerCall ) || ( ! mWithin && ! bestWithin && m.maxError < best->maxError ) )
+                best = &m;
+        }
+
+        i = j;
+        if ( best == nullptr )
+            continue;
+
+        // Extend the body's last era if it ends where this one starts and uses the same backend.
+
+        int b = bodyIndex ( best->id );
+        vector<Entry> &entries = policy._entries[b];
+        if ( ! entries.empty() && entries.back().jed1 == best->jed0 && entries.back().backend == best->backend )
+            entries.back().jed1 = best->jed1;
+        else
+            entries.push_back ( { best->jed0, best->jed1, best->backend } );
+    }
+
+    return policy;
+}
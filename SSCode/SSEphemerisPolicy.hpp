@@ -0,0 +1,96 @@
+// SSEphemerisPolicy.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class chooses which ephemeris computes each major planet and the Moon at a given time. SSCore has four:
+// JPL DE (fast table lookup, but only where a file is open), VSOP2013 with ELPMPP02 (sub-arcsecond, slow),
+// Paul Schlyter's formulae (SSPSEphemeris; fast, arcminute-level), and Van Flandern & Pulkkinen's (SSVPEphemeris).
+// Without a policy, SSPlanet uses JPL DE where available, then VSOP/ELP, then PS, as it always has.
+// A policy overrides that choice per body and era; where its backend can't compute a position, the default applies.
+// The policy can be measured rather than guessed: measure() samples each era of a time span, compares every backend's
+// geocentric directions against the open JPL DE file, and times each one; choose() then picks the fastest backend
+// within an error budget for each body and era.
+
+#ifndef SSEphemerisPolicy_hpp
+#define SSEphemerisPolicy_hpp
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+enum SSEphemerisBackend
+{
+    kBackendDefault = 0,        // JPL DE where available, then VSOP/ELP, then PS
+    kBackendJPLDE = 1,          // JPL DE file(s) opened with SSJPLDEphemeris
+    kBackendVSOPELP = 2,        // VSOP2013 planets and ELPMPP02 Moon, at the current SSPlanet::setVSOPELPPrecision()
+    kBackendPS = 3,             // Paul Schlyter's low-precision formulae
+    kBackendVP = 4,             // Van Flandern & Pulkkinen's low-precision formulae
+};
+
+class SSEphemerisPolicy
+{
+public:
+
+    static constexpr int kNumBodies = 11;           // Sun and major planets by SSPlanetID (Sun = 0 ... Pluto = 9), and Moon (10)
+
+    // Accuracy and speed of one backend for one body during one era, from measure().
+
+    struct Measurement
+    {
+        int id;                         // body's SSPlanetID: kSun ... kPluto, or kLuna
+        double jed0, jed1;              // era start and end, as Julian Ephemeris Dates
+        SSEphemerisBackend backend;     // backend measured
+        double maxError;                // largest geocentric direction error vs. JPL DE [arcseconds]
+        double nsPerCall;               // mean time per position and velocity computation [nanoseconds]
+    };
+
+protected:
+
+    struct Entry
+    {
+        double jed0, jed1;              // era start and end, as Julian Ephemeris Dates
+        SSEphemerisBackend backend;     // backend used during era
+    };
+
+    vector<Entry> _entries[kNumBodies];     // each body's eras, in order added
+
+public:
+
+    // Returns index (0 ... 10) of a body's SSPlanetID (id), or -1 if it isn't the Sun, a major planet, or the Moon.
+
+    static int bodyIndex ( int id );
+
+    // Uses backend (backend) for a body (id) from Julian Ephemeris Date (jed0) to (jed1).
+
+    void set ( int id, double jed0, double jed1, SSEphemerisBackend backend );
+
+    // Returns backend to use for a body (id) at Julian Ephemeris Date (jed), or kBackendDefault if none was set.
+
+    SSEphemerisBackend select ( int id, double jed ) const;
+
+    bool empty ( void ) const;
+    void clear ( void );
+
+    // Measures error and speed of every backend for Earth, the other major planets, and the Moon in eras of (eraDays)
+    // from Julian Ephemeris Date (jed0) to (jed1), at (samples) evenly spaced times in each era. Errors are measured
+    // against the JPL DE file(s) open in SSJPLDEphemeris, so nothing is measured where none covers an era;
+    // JPL DE itself is measured for speed, with zero error. Returns all measurements.
+
+    static vector<Measurement> measure ( double jed0, double jed1, double eraDays, int samples );
+
+    // Returns a policy which uses the fastest measured backend within (budget) arcseconds for each body and era,
+    // or the most accurate one if none is within budget. Adjacent eras using the same backend are merged.
+    // JPL DE, where measured, is usually fastest and always most accurate; if (useJPLDE) is false, only the
+    // built-in series are chosen from, e.g. to decide what to use where no DE file will be available.
+
+    static SSEphemerisPolicy choose ( const vector<Measurement> &measurements, double budget, bool useJPLDE = true );
+
+    // Returns a backend's name, e.g. "VSOP/ELP".
+
+    static string backendName ( SSEphemerisBackend backend );
+};
+
+#endif /* SSEphemerisPolicy_hpp */
@@ -0,0 +1,183 @@
+// SSEphemerisPrefetch.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include "SSEphemerisPrefetch.hpp"
+
+SSEphemerisPrefetch::SSEphemerisPrefetch ( SSObjectArray &solsys, SSObjectArray *others, int threads ) :
+    _coords ( SSTime ( SSTime::kJ2000 ), SSSpherical ( 0.0, 0.0, 0.0 ) )
+{
+    _threads = threads;
+    _tolerance = 0.05 / SSTime::kSecondsPerDay;
+    _lastJD = INFINITY;
+    _hits = _misses = 0;
+    _back.valid = false;
+    setObjects ( solsys, others );
+}
+
+SSEphemerisPrefetch::~SSEphemerisPrefetch ( void )
+{
+    if ( _task.valid() )
+        _task.wait();
+}
+
+void SSEphemerisPrefetch::setObjects ( SSObjectArray &solsys, SSObjectArray *others )
+{
+    invalidate();
+
+    _solsys = &solsys;
+    _others = others;
+    _snapshot.setObjects ( solsys );
+
+    _clones.erase();
+    for ( size_t i = 0; i < solsys.size(); i++ )
+        _clones.append ( solsys[i] ? SSCloneObject ( solsys[i] ) : nullptr );
+    for ( size_t i = 0; others != nullptr && i < others->size(); i++ )
+        _clones.append ( others->get ( i ) ? SSCloneObject ( others->get ( i ) ) : nullptr );
+
+    _cloneSnapshot.setObjects ( _clones );
+}
+
+// Packs the coordinates' settings which change ephemerides, other than time and location, into one value.
+
+int SSEphemerisPrefetch::getSettings ( SSCoordinates &coords )
+{
+    return coords.getAberration() | coords.getLightTime() << 1 | coords.getStarParallax() << 2 | coords.getStarMotion() << 3;
+}
+
+// Computes ephemerides of objects in an array (objects) which are not in a snapshot: those which are not solar
+// system objects, and every object from index (begin) on.
+
+void SSEphemerisPrefetch::computeOthers ( SSCoordinates &coords, SSObjectArray &objects, size_t begin )
+{
+    for ( size_t i = 0; i < objects.size(); i++ )
+    {
+        SSObjectPtr pObject = objects[i];
+        if ( pObject != nullptr && ( i >= begin || SSGetPlanetPtr ( pObject ) == nullptr ) )
+            pObject->computeEphemeris ( coords );
+    }
+}
+
+// Saves ephemerides of the clones, computed with coordinates (coords), in the back buffer.
+
+void SSEphemerisPrefetch::save ( SSCoordinates &coords )
+{
+    _back.states.resize ( _clones.size() );
+    for ( size_t i = 0; i < _clones.size(); i++ )
+    {
+        SSObjectPtr pObject = _clones[i];
+        if ( pObject == nullptr )
+            continue;
+
+        State &state = _back.states[i];
+        state.direction = pObject->getDirection();
+        state.distance = pObject->getDistance();
+        state.magnitude = pObject->getMagnitude();
+
+        SSPlanet *pPlanet = SSGetPlanetPtr ( pObject );
+        if ( pPlanet != nullptr )
+        {
+            state.position = pPlanet->getPosition();
+            state.velocity = pPlanet->getVelocity();
+        }
+    }
+
+    _back.jd = coords.getTime().jd;
+    _back.location = coords.getLocation();
+    _back.settings = getSettings ( coords );
+    _back.valid = true;
+}
+
+// Copies the back buffer into the caller's objects.
+
+void SSEphemerisPrefetch::apply ( void )
+{
+    size_t nsolsys = _solsys->size();
+    for ( size_t i = 0; i < _back.states.size(); i++ )
+    {
+        SSObjectPtr pObject = i < nsolsys ? _solsys->get ( i ) : _others->get ( i - nsolsys );
+        if ( pObject == nullptr )
+            continue;
+
+        const State &state = _back.states[i];
+        pObject->setDirection ( state.direction );
+        pObject->setDistance ( state.distance );
+        pObject->setMagnitude ( state.magnitude );
+
+        SSPlanet *pPlanet = SSGetPlanetPtr ( pObject );
+        if ( pPlanet != nullptr )
+            pPlanet->setPositionVelocity ( state.position, state.velocity );
+    }
+}
+
+void SSEphemerisPrefetch::invalidate ( void )
+{
+    if ( _task.valid() )
+        _task.wait();
+
+    _task = SSAsync<bool>();
+    _back.valid = false;
+}
+
+bool SSEphemerisPrefetch::update ( SSCoordinates &coords )
+{
+    double jd = coords.getTime().jd;
+    double step = isinf ( _lastJD ) ? 0.0 : jd - _lastJD;
+    return update ( coords, jd + step );
+}
+
+bool SSEphemerisPrefetch::update ( SSCoordinates &coords, double nextJD )
+{
+    // Wait for the task computing this frame; it was started a frame ago, so it has usually finished.
+
+    if ( _task.valid() )
+        _task.wait();
+
+    // Objects can have been added or removed since copies were made, so check the counts too.
+
+    SSTime time = coords.getTime();
+    SSSpherical location = coords.getLocation();
+    size_t count = _solsys->size() + ( _others ? _others->size() : 0 );
+    bool hit = _back.valid && fabs ( _back.jd - time.jd ) <= _tolerance && _back.location.lon == location.lon
+               && _back.location.lat == location.lat && _back.location.rad == location.rad
+               && _back.settings == getSettings ( coords ) && _back.states.size() == count && _clones.size() == count;
+
+    if ( hit )
+    {
+        apply();
+        _hits++;
+    }
+    else
+    {
+        _snapshot.compute ( coords, _threads );
+        computeOthers ( coords, *_solsys, _solsys->size() );
+        if ( _others != nullptr )
+            computeOthers ( coords, *_others, 0 );
+        _misses++;
+    }
+
+    _back.valid = false;
+    _lastJD = time.jd;
+
+    // Start computing the next frame on a copy of the coordinates. The copy's time is set on the task's thread,
+    // since that recomputes nutation, precession, and other time-dependent quantities.
+
+    if ( _clones.size() != count )
+        return hit;
+
+    _coords = coords;
+    time.jd = nextJD;
+    size_t nsolsys = _solsys->size();
+    _task = SSRunAsync<bool> ( [this, time, nsolsys] ( SSTaskState &task )
+    {
+        _coords.setTime ( time );
+        _cloneSnapshot.compute ( _coords, _threads );
+        computeOthers ( _coords, _clones, nsolsys );
+        save ( _coords );
+        return true;
+    } );
+
+    return hit;
+}
@@ -0,0 +1,108 @@
+// SSEphemerisPrefetch.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// Double-buffered ephemeris computation for real-time display, where time advances predictably from frame to frame.
+// Each frame, the app calls update() with the frame's coordinates, and the time it predicts for the next frame.
+// While the app draws the frame, a task on the shared thread pool computes the next frame's ephemerides of solar system
+// objects (with an SSEphemerisSnapshot) and other objects, e.g. nearby stars, at the predicted time. It works on its own
+// copies of the coordinates and objects, and saves each object's direction, distance, magnitude, and (for solar system
+// objects) heliocentric position and velocity in a back buffer; the caller's objects are the front buffer, which the
+// app draws from. On the next update(), if the frame's time is within a tolerance of the predicted time, and location
+// and ephemeris settings are unchanged, the back buffer is copied into the caller's objects, and nothing is computed on
+// the calling thread. Otherwise - the user changed the time or location, or the task was not started - the caller's
+// objects are computed synchronously, as SSEphemerisSnapshot::compute() would. Copies are made when objects are given
+// to the constructor or setObjects(); call setObjects() again after changing the objects' orbits or TLEs.
+
+#ifndef SSEphemerisPrefetch_hpp
+#define SSEphemerisPrefetch_hpp
+
+#include "SSEphemerisSnapshot.hpp"
+#include "SSAsync.hpp"
+
+class SSEphemerisPrefetch
+{
+protected:
+
+    // One object's computed ephemeris.
+
+    struct State
+    {
+        SSVector direction;             // apparent direction in fundamental frame
+        double distance;                // distance in AU
+        float magnitude;                // visual magnitude
+        SSVector position, velocity;    // heliocentric position and velocity of solar system objects; unused otherwise
+    };
+
+    // Ephemerides of all objects, in the order of the solar system array then the other array, and what they were
+    // computed for: Julian Date, observer location, and ephemeris settings.
+
+    struct Buffer
+    {
+        bool valid;
+        double jd;
+        SSSpherical location;
+        int settings;
+        vector<State> states;
+    };
+
+    SSObjectArray *_solsys;             // caller's solar system objects; not owned
+    SSObjectArray *_others;             // caller's other objects, or nullptr if none; not owned
+    SSEphemerisSnapshot _snapshot;      // caller's solar system objects, in dependency order
+
+    SSCoordinates _coords;              // copy of coordinates for task, set to predicted time
+    SSObjectArray _clones;              // task's copies of caller's objects: solar system objects, then others
+    SSEphemerisSnapshot _cloneSnapshot; // solar system objects among clones
+    Buffer _back;                       // ephemerides computed by task; read by caller only after task completes
+    SSAsync<bool> _task;                // task computing next frame, if started
+
+    int _threads;                       // threads used to compute snapshots
+    double _tolerance;                  // largest difference between frame time and predicted time, in days
+    double _lastJD;                     // Julian Date of last frame; infinite if none
+    size_t _hits, _misses;              // frames taken from back buffer, and computed synchronously
+
+    static int getSettings ( SSCoordinates &coords );
+    static void computeOthers ( SSCoordinates &coords, SSObjectArray &objects, size_t begin );
+    void save ( SSCoordinates &coords );
+    void apply ( void );
+
+public:
+
+    // Creates a prefetcher for solar system objects (solsys) and optionally other objects (others), which must outlive it.
+    // Snapshots are computed on (threads) threads, as SSEphemerisSnapshot::compute() does.
+
+    SSEphemerisPrefetch ( SSObjectArray &solsys, SSObjectArray *others = nullptr, int threads = 1 );
+    SSEphemerisPrefetch ( const SSEphemerisPrefetch &other ) = delete;
+    SSEphemerisPrefetch &operator = ( const SSEphemerisPrefetch &other ) = delete;
+    ~SSEphemerisPrefetch ( void );
+
+    // Replaces objects, and copies them for the background task; discards any frame it computed.
+
+    void setObjects ( SSObjectArray &solsys, SSObjectArray *others = nullptr );
+
+    // Sets or returns the largest difference between a frame's time and the time predicted for it, in seconds,
+    // for which the precomputed frame is used (default 0.05 seconds).
+
+    void setTolerance ( double seconds ) { _tolerance = seconds / SSTime::kSecondsPerDay; }
+    double getTolerance ( void ) { return _tolerance * SSTime::kSecondsPerDay; }
+
+    // Brings the caller's objects up to date for a frame at the time and location of (coords): from the precomputed frame
+    // if it matches, otherwise synchronously. Then starts computing the next frame at Julian Date (nextJD), or if omitted,
+    // at this frame's time plus the time since the last frame. Returns true if the precomputed frame was used.
+
+    bool update ( SSCoordinates &coords, double nextJD );
+    bool update ( SSCoordinates &coords );
+
+    // Waits for the background task, if any, to complete; then discards the frame it computed.
+
+    void invalidate ( void );
+
+    // Returns numbers of frames taken from the precomputed frame, and computed synchronously.
+
+    size_t getHits ( void ) { return _hits; }
+    size_t getMisses ( void ) { return _misses; }
+};
+
+#endif /* SSEphemerisPrefetch_hpp */
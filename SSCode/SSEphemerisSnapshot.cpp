@@ -0,0 +1,138 @@
+// SSEphemerisSnapshot.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include "SSEphemerisSnapshot.hpp"
+
+#if USE_THREADS
+#include <thread>
+#endif
+
+// Returns position of a solar system object type in dependency order:
+// Sun first, then planets, then moons, then minor planets, then satellites last.
+
+static int dependencyRank ( SSPlanet *pPlanet )
+{
+    SSObjectType type = pPlanet->getType();
+
+    if ( type == kTypePlanet )
+        return pPlanet->isSun() ? 0 : 1;
+    else if ( type == kTypeMoon )
+        return 2;
+    else if ( type == kTypeSatellite )
+        return 4;
+    else
+        return 3;
+}
+
+SSEphemerisSnapshot::SSEphemerisSnapshot ( void )
+{
+    _numPlanets = _numSatellites = 0;
+    _primaryMask = 0;
+}
+
+SSEphemerisSnapshot::SSEphemerisSnapshot ( SSObjectArray &objects )
+{
+    setObjects ( objects );
+}
+
+void SSEphemerisSnapshot::setObjects ( SSObjectArray &objects )
+{
+    _objects.clear();
+    _numPlanets = _numSatellites = 0;
+    _primaryMask = 0;
+
+    for ( size_t i = 0; i < objects.size(); i++ )
+    {
+        SSPlanet *pPlanet = SSGetPlanetPtr ( objects[i] );
+        if ( pPlanet == nullptr )
+            continue;
+
+        // Planets need their own geometric positions; moons need their primaries' positions.
+
+        int id = (int) pPlanet->getIdentifier().identifier();
+        if ( pPlanet->getType() == kTypePlanet && id >= kSun && id <= kPluto )
+            _primaryMask |= 1u << id;
+        else if ( pPlanet->getType() == kTypeMoon && id / 100 >= kSun && id / 100 <= kPluto )
+            _primaryMask |= 1u << ( id / 100 );
+
+        _objects.push_back ( pPlanet );
+    }
+
+    // Stable sort keeps objects of the same rank in their original order.
+
+    stable_sort ( _objects.begin(), _objects.end(), [] ( SSPlanet *p1, SSPlanet *p2 ) { return dependencyRank ( p1 ) < dependencyRank ( p2 ); } );
+
+    for ( SSPlanet *pPlanet : _objects )
+    {
+        if ( pPlanet->getType() == kTypePlanet )
+            _numPlanets++;
+        else if ( pPlanet->getType() == kTypeSatellite )
+            _numSatellites++;
+    }
+}
+
+// Computes ephemeris of objects from begin to end, in steps of step.
+// Primary planets' positions must already be in the coordinates' ephemeris context.
+
+void SSEphemerisSnapshot::computeRange ( SSCoordinates &coords, size_t begin, size_t end, size_t step )
+{
+    SSEphemerisContext &context = coords.getEphemerisContext();
+
+    for ( size_t i = begin; i < end; i += step )
+    {
+        SSPlanet *pPlanet = _objects[i];
+        int id = (int) pPlanet->getIdentifier().identifier();
+
+        if ( i < _numPlanets && id >= kSun && id <= kPluto )
+            pPlanet->computeEphemeris ( coords, context.primaryPos[id], context.primaryVel[id] );
+        else
+            pPlanet->computeEphemeris ( coords );
+    }
+}
+
+// Computes all objects' ephemerides. Primary planets' geometric positions are computed once, first;
+// every planet and moon then reuses them. With multiple threads, each thread works on its own copy
+// of the coordinates (and therefore its own ephemeris context), so threads share only read-only state.
+
+void SSEphemerisSnapshot::compute ( SSCoordinates &coords, int threads )
+{
+    SSEphemerisContext &context = coords.getEphemerisContext();
+    SSEphemerisContext::Scope scope ( context );
+    double jed = coords.getJED();
+
+    for ( int p = kSun; p <= kPluto; p++ )
+    {
+        if ( ( _primaryMask & ( 1u << p ) ) && context.primaryJED[p] != jed )
+        {
+            SSPlanet::computeMajorPlanetPositionVelocity ( p, jed, 0.0, context.primaryPos[p], context.primaryVel[p] );
+            context.primaryJED[p] = jed;
+        }
+    }
+
+    size_t size = _objects.size();
+
+#if USE_THREADS
+    if ( threads > 1 && size > 1 )
+    {
+        if ( threads > (int) size )
+            threads = (int) size;
+
+        // Objects are interleaved between threads, so each gets a similar mix of planets, moons, minor planets, and satellites.
+
+        vector<SSCoordinates> threadCoords ( threads, coords );
+        vector<thread> workers;
+        for ( int t = 0; t < threads; t++ )
+            workers.push_back ( thread ( &SSEphemerisSnapshot::computeRange, this, ref ( threadCoords[t] ), t, size, threads ) );
+
+        for ( thread &worker : workers )
+            worker.join();
+
+        return;
+    }
+#endif
+
+    computeRange ( coords, 0, size, 1 );
+}
@@ -0,0 +1,54 @@
+// SSEphemerisSnapshot.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class computes the ephemeris of an entire solar system (planets, moons, asteroids,
+// comets, and satellites) at one time and observer location in a single pass.
+// Objects are kept in dependency order: Sun, then planets, then moons, then everything else.
+// Quantities shared by many objects - the primary planets' positions, the ecliptic-of-date matrix,
+// Earth's state for satellites - are computed once into the coordinates' ephemeris context,
+// and each planet's geometric position is reused rather than recomputed for light time.
+// Bodies which don't depend on each other can also be computed on several threads.
+
+#ifndef SSEphemerisSnapshot_hpp
+#define SSEphemerisSnapshot_hpp
+
+#include "SSPlanet.hpp"
+
+class SSEphemerisSnapshot
+{
+protected:
+
+    vector<SSPlanet *> _objects;        // solar system objects in dependency order; not owned by this class
+    size_t _numPlanets;                 // number of major planets at start of _objects
+    size_t _numSatellites;              // number of artificial satellites at end of _objects
+    unsigned int _primaryMask;          // bit mask of primary planets (0 = Sun ... 9 = Pluto) needed by objects
+
+    void computeRange ( SSCoordinates &coords, size_t begin, size_t end, size_t step );
+
+public:
+
+    SSEphemerisSnapshot ( void );
+    SSEphemerisSnapshot ( SSObjectArray &objects );
+
+    // Replaces the objects in this snapshot with all solar system objects in an array,
+    // sorted into dependency order. Non-solar-system objects are ignored.
+    // The array must outlive this snapshot, or setObjects() must be called again.
+
+    void setObjects ( SSObjectArray &objects );
+
+    // Gets number of objects in snapshot, and i-th object in dependency order.
+
+    size_t size ( void ) { return _objects.size(); }
+    SSPlanet *get ( size_t i ) { return i < _objects.size() ? _objects[i] : nullptr; }
+
+    // Computes every object's position, direction, distance, and magnitude at the time and location
+    // in a coordinates object (coords). If threads > 1, independent bodies are divided between
+    // that many threads; the result is identical.
+
+    void compute ( SSCoordinates &coords, int threads = 1 );
+};
+
+#endif /* SSEphemerisSnapshot_hpp */
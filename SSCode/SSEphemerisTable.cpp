@@ -0,0 +1,119 @@
+// SSEphemerisTable.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <memory>
+
+#include "SSEphemerisTable.hpp"
+#include "SSThreadPool.hpp"
+
+SSEphemerisTable::SSEphemerisTable ( SSObjectArray &objects, SSCoordinates &coords ) : _objects ( objects ), _coords ( coords )
+{
+    _refraction = true;
+}
+
+// Computes rows for times (first) to (last) into a worker's row buffer, using only the worker's own coordinates and objects.
+
+void SSEphemerisTable::computeBlock ( Worker &worker, double jd0, double step, size_t first, size_t last )
+{
+    size_t n = worker.objects.size();
+    worker.rows.clear();
+    worker.rows.reserve ( ( last - first ) * n );
+
+    for ( size_t t = first; t < last; t++ )
+    {
+        double jd = jd0 + step * t;
+        worker.coords.setTime ( SSTime ( jd ) );
+        worker.snapshot.compute ( worker.coords );
+        for ( SSObjectPtr pObj : worker.others )
+            pObj->computeEphemeris ( worker.coords );
+
+        for ( size_t i = 0; i < n; i++ )
+        {
+            SSObjectPtr pObj = worker.objects[i];
+            SSVector dir = pObj->getDirection();
+            double dist = pObj->getDistance();
+
+            Row row = { t, jd, i, _objects[i] };
+            row.equatorial = worker.coords.transform<kFundamental,kEquatorial> ( dir ).toSpherical();
+            row.horizon = worker.coords.transform<kFundamental,kHorizon> ( dir ).toSpherical();
+            row.equatorial.rad = row.horizon.rad = dist;
+            if ( _refraction )
+                row.horizon.lat = SSCoordinates::applyRefraction ( row.horizon.lat );
+            row.magnitude = pObj->getMagnitude();
+            worker.rows.push_back ( row );
+        }
+    }
+}
+
+size_t SSEphemerisTable::generate ( double jd0, double step, size_t n, const RowSink &sink, int threads )
+{
+    SSThreadPool &pool = SSThreadPool::shared();
+    if ( threads <= 0 )
+        threads = pool.size();
+
+    size_t blocks = ( n + kBlockTimes - 1 ) / kBlockTimes;
+    threads = (int) min ( (size_t) max ( threads, 1 ), max ( blocks, (size_t) 1 ) );
+
+    // Each worker gets its own copies of the objects, so threads never share an object's ephemeris.
+
+    vector<unique_ptr<Worker>> workers;
+    for ( int w = 0; w < threads; w++ )
+    {
+        Worker *pWorker = new Worker ( _coords );
+        for ( size_t i = 0; i < _objects.size(); i++ )
+        {
+            SSObjectPtr pClone = SSCloneObject ( _objects[i] );
+            pWorker->objects.append ( pClone );
+            if ( SSGetPlanetPtr ( pClone ) == nullptr )
+                pWorker->others.push_back ( pClone );
+        }
+        pWorker->snapshot.setObjects ( pWorker->objects );
+        workers.push_back ( unique_ptr<Worker> ( pWorker ) );
+    }
+
+    // Compute waves of one block per worker, then deliver each block's rows in order before starting the next wave.
+
+    size_t rows = 0;
+    for ( size_t wave = 0; wave < blocks; wave += threads )
+    {
+        size_t count = min ( (size_t) threads, blocks - wave );
+        auto body = [&] ( size_t begin, size_t end )
+        {
+            for ( size_t w = begin; w < end; w++ )
+            {
+                size_t first = ( wave + w ) * kBlockTimes;
+                computeBlock ( *workers[w], jd0, step, first, min ( first + kBlockTimes, n ) );
+            }
+        };
+
+        if ( count > 1 )
+            pool.parallelFor ( 0, count, body, 1 );
+        else
+            body ( 0, count );
+
+        for ( size_t w = 0; w < count; w++ )
+            for ( const Row &row : workers[w]->rows )
+            {
+                sink ( row );
+                rows++;
+            }
+    }
+
+    return rows;
+}
+
+size_t SSEphemerisTable::generate ( double jd0, double step, size_t n, ostream &out, int threads )
+{
+    out << "JD,Object,RA,Dec,Distance,Magnitude,Azimuth,Altitude" << endl;
+    return generate ( jd0, step, n, [&] ( const Row &row )
+    {
+        string name = row.pObject->getName ( 0 );
+        SSSpherical equ = row.equatorial, hor = row.horizon;
+        out << format ( "%.6f,%s,%.6f,%+.6f,%.9g,%.2f,%.6f,%+.6f",
+                        row.jd, name.c_str(), equ.lon.toDegrees(), equ.lat.toDegrees(), equ.rad, row.magnitude,
+                        hor.lon.toDegrees(), hor.lat.toDegrees() ) << endl;
+    }, threads );
+}
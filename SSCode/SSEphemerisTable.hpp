@@ -0,0 +1,86 @@
+// SSEphemerisTable.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class generates ephemeris tables - apparent RA/Dec, distance, magnitude, and azimuth/altitude - for many objects
+// at many evenly spaced times, and streams them row by row to a callback or output stream, without building the whole
+// table in memory. Times are the outer loop: the coordinates are set to each time once, solar system objects are computed
+// together with an SSEphemerisSnapshot (which shares primary planet positions and other per-time quantities), and then
+// stars and other objects. Blocks of consecutive times can be computed on several threads, each with its own copies of the
+// coordinates and objects; rows are still delivered in order of time, then object, on the calling thread.
+
+#ifndef SSEphemerisTable_hpp
+#define SSEphemerisTable_hpp
+
+#include <functional>
+#include <ostream>
+
+#include "SSEphemerisSnapshot.hpp"
+
+class SSEphemerisTable
+{
+public:
+
+    // One object's apparent position at one time.
+
+    struct Row
+    {
+        size_t timeIndex;           // index of time in table, from zero
+        double jd;                  // Julian Date (UT)
+        size_t objectIndex;         // index of object in object array
+        SSObjectPtr pObject;        // object in the caller's array; its own ephemeris is not changed
+        SSSpherical equatorial;     // apparent RA/Dec of date, in radians; distance is in AU, infinite if unknown
+        SSSpherical horizon;        // azimuth/altitude in radians, altitude refracted if desired; distance likewise
+        float magnitude;            // visual magnitude; infinite if unknown
+    };
+
+    typedef function<void ( const Row &row )> RowSink;
+
+    static constexpr size_t kBlockTimes = 16;   // consecutive times computed by one thread at once
+
+protected:
+
+    // A thread's copies of the coordinates and objects, and the rows computed for its block of times.
+
+    struct Worker
+    {
+        SSCoordinates coords;
+        SSObjectArray objects;              // clones of the caller's objects, in the same order
+        SSEphemerisSnapshot snapshot;       // solar system objects among the clones
+        vector<SSObjectPtr> others;         // clones which are not solar system objects
+        vector<Row> rows;                   // rows for the block of times being computed
+
+        Worker ( SSCoordinates &coords ) : coords ( coords ) {}
+    };
+
+    SSObjectArray &_objects;                // objects in table; not owned
+    SSCoordinates &_coords;                 // observer location and ephemeris settings; its time is not changed
+    bool _refraction;                       // if true, altitudes include atmospheric refraction
+
+    void computeBlock ( Worker &worker, double jd0, double step, size_t first, size_t last );
+
+public:
+
+    // Creates a table of objects in an array (objects), seen from the observer location, with the ephemeris settings
+    // (aberration, light time, etc.) of a coordinates object (coords). Both must outlive the table.
+
+    SSEphemerisTable ( SSObjectArray &objects, SSCoordinates &coords );
+
+    void setRefraction ( bool refraction ) { _refraction = refraction; }
+    bool getRefraction ( void ) { return _refraction; }
+
+    // Computes every object's row at (n) times from Julian Date (jd0) in steps of (step) days, and passes each row to (sink)
+    // in order of time, then object, on the calling thread. If (threads) is more than one (zero or negative means one per
+    // processor core), that many blocks of kBlockTimes times are computed at once on the shared thread pool, so at most that
+    // many blocks of rows are held in memory; results are identical. Returns the number of rows generated.
+
+    size_t generate ( double jd0, double step, size_t n, const RowSink &sink, int threads = 1 );
+
+    // As above, but writes rows to an output stream (out) as CSV text, after a header line.
+
+    size_t generate ( double jd0, double step, size_t n, ostream &out, int threads = 1 );
+};
+
+#endif /* SSEphemerisTable_hpp */
@@ -5,6 +5,35 @@
 // Copyright © 2020 Southern Stars. All rights reserved.
 
 #include "SSEvent.hpp"
+#include "SSPlanet.hpp"
+#include "SSStar.hpp"
+#include "SSConstellation.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+#include <mutex>
+
+#if USE_THREADS
+#include <thread>
+#endif
+
+// Event search solver settings; see useRootFinding().
+
+static bool _useRootFinding = false;
+static double _rootTimeTol = 1.0 / SSTime::kSecondsPerDay;
+static double _rootValueTol = 0.0;
+
+void SSEvent::useRootFinding ( bool use, double timeTol, double valueTol )
+{
+    _useRootFinding = use;
+    _rootTimeTol = timeTol / SSTime::kSecondsPerDay;
+    _rootValueTol = valueTol;
+}
+
+bool SSEvent::useRootFinding ( void )
+{
+    return _useRootFinding;
+}
 
 // Computes the hour angle when an object with declination (dec)
 // as seen from latitude (lat) reaches an altitude (alt) above
@@ -79,7 +108,7 @@ SSTime SSEvent::riseTransitSet ( SSTime time, SSAngle ra, SSAngle dec, int sign,
 SSTime SSEvent::riseTransitSet ( SSTime time, SSCoordinates &coords, SSObjectPtr pObj, int sign, SSAngle alt )
 {
     SSSpherical loc = coords.getLocation();
-    SSSpherical equ ( coords.transform ( kFundamental, kEquatorial, pObj->getDirection() ) );
+    SSSpherical equ ( coords.transform<kFundamental, kEquatorial> ( pObj->getDirection() ) );
     return riseTransitSet ( time, equ.lon, equ.lat, sign, loc.lon, loc.lat, alt );
 }
 
@@ -171,7 +200,7 @@ SSPass SSEvent::riseTransitSet ( SSTime today, SSCoordinates &coords, SSObjectPt
     pass.rising.time = riseTransitSetSearchDay ( today, coords, pObj, kRise, alt );
     if ( ! ::isinf ( pass.rising.time ) )
     {
-        hor = coords.transform ( kFundamental, kHorizon, pObj->getDirection() );
+        hor = coords.transform<kFundamental, kHorizon> ( pObj->getDirection() );
         pass.rising.azm = hor.lon;
         pass.rising.alt = hor.lat;
     }
@@ -179,7 +208,7 @@ SSPass SSEvent::riseTransitSet ( SSTime today, SSCoordinates &coords, SSObjectPt
     pass.transit.time = riseTransitSetSearchDay ( today, coords, pObj, kTransit, 0.0 );
     if ( ! ::isinf ( pass.transit.time ) )
     {
-        hor = coords.transform ( kFundamental, kHorizon, pObj->getDirection() );
+        hor = coords.transform<kFundamental, kHorizon> ( pObj->getDirection() );
         pass.transit.azm = hor.lon;
         pass.transit.alt = hor.lat;
     }
@@ -187,7 +216,7 @@ SSPass SSEvent::riseTransitSet ( SSTime today, SSCoordinates &coords, SSObjectPt
     pass.setting.time = riseTransitSetSearchDay ( today, coords, pObj, kSet, alt );
     if ( ! ::isinf ( pass.setting.time ) )
     {
-        hor = coords.transform ( kFundamental, kHorizon, pObj->getDirection() );
+        hor = coords.transform<kFundamental, kHorizon> ( pObj->getDirection() );
         pass.setting.azm = hor.lon;
         pass.setting.alt = hor.lat;
     }
@@ -200,6 +229,134 @@ SSPass SSEvent::riseTransitSet ( SSTime today, SSCoordinates &coords, SSObjectPt
     return pass;
 }
 
+// Returns circumstances of the overhead passes of every object in an array (objects) on a local day (today), as seen from
+// the location in (coords), as the single-object riseTransitSet() does, with rising and setting altitude (alt), except for
+// the Sun and Moon (sunMoonAlt). Passes are returned in (passes) in the same order as the objects.
+// Stars, deep sky objects, and constellations, which barely move in a day, are computed together in closed form from
+// their equatorial coordinates at local noon, with one precession-nutation matrix and sidereal time for all of them;
+// their azimuths and altitudes at each event are computed from hour angle and declination.
+// Solar system objects are searched iteratively, one at a time, as the single-object riseTransitSet() does.
+// Objects are divided among threads (threads; if zero or negative, one per processor core); each thread has its own
+// copy of the coordinates, which are not modified. Each object's ephemeris is restored to the coordinates' time.
+// Returns the number of objects which rise, transit, or set on that day.
+
+int SSEvent::riseTransitSet ( SSTime today, SSCoordinates &coords, SSObjectVec &objects, SSAngle alt, SSAngle sunMoonAlt, vector<SSPass> &passes, int threads )
+{
+    size_t n = objects.size();
+    SSPass nopass = { 0.0 };
+    passes.assign ( n, nopass );
+    if ( n == 0 )
+        return 0;
+    
+    // Objects outside the solar system are fixed for the day; all others move.
+    
+    vector<size_t> fixed, moving;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        SSObjectPtr pObj = objects.get ( i );
+        if ( SSGetStarPtr ( pObj ) || SSGetConstellationPtr ( pObj ) )
+            fixed.push_back ( i );
+        else
+            moving.push_back ( i );
+    }
+    
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+#endif
+    threads = (int) min ( (size_t) max ( threads, 1 ), n );
+    
+    SSTime start = today.getLocalMidnight();
+    SSTime noon = start + 0.5;
+    SSCoordinates noonCoords ( coords );
+    noonCoords.setTime ( noon );
+    SSMatrix equMat = noonCoords.getTransformMatrix ( kFundamental, kEquatorial );
+    
+    size_t nfixed = fixed.size();
+    vector<double> ra ( nfixed ), dec ( nfixed );
+    
+    // Fixed objects are split into contiguous runs; moving objects are interleaved, so each thread gets a similar mix.
+    
+    auto work = [&] ( int t )
+    {
+        SSCoordinates here ( coords ), atNoon ( noonCoords );
+        
+        for ( size_t k = nfixed * t / threads; k < nfixed * ( t + 1 ) / threads; k++ )
+        {
+            SSObjectPtr pObj = objects.get ( fixed[k] );
+            pObj->computeEphemeris ( atNoon );
+            SSSpherical equ ( equMat * pObj->getDirection() );
+            ra[k] = equ.lon;
+            dec[k] = equ.lat;
+            pObj->computeEphemeris ( here );
+        }
+        
+        for ( size_t k = t; k < moving.size(); k += threads )
+        {
+            SSObjectPtr pObj = objects.get ( moving[k] );
+            SSPlanetPtr pPlanet = SSGetPlanetPtr ( pObj );
+            bool sunMoon = pPlanet && ( pPlanet->isSun() || pPlanet->isLuna() );
+            passes[ moving[k] ] = riseTransitSet ( today, here, pObj, sunMoon ? sunMoonAlt : alt );
+        }
+    };
+    
+#if USE_THREADS
+    vector<thread> workers;
+    for ( int t = 1; t < threads; t++ )
+        workers.push_back ( thread ( work, t ) );
+    
+    work ( 0 );
+    
+    for ( thread &worker : workers )
+        worker.join();
+#else
+    for ( int t = 0; t < threads; t++ )
+        work ( t );
+#endif
+    
+    // Closed-form rise, transit, and set times of fixed objects: within half a sidereal day of local noon, so always on
+    // the local day. Objects which never rise or set get infinite times, as riseTransitSetSearchDay() returns for them.
+    
+    SSSpherical loc = coords.getLocation();
+    double lst = noon.getSiderealTime ( loc.lon );
+    double sinlat = sin ( loc.lat ), coslat = cos ( loc.lat ), sinalt = sin ( alt );
+    double daysPerRad = 1.0 / SSAngle::kTwoPi / SSTime::kSiderealPerSolarDays;
+    
+    for ( size_t k = 0; k < nfixed; k++ )
+    {
+        double sindec = sin ( dec[k] ), cosdec = cos ( dec[k] );
+        double cosha = ( sinalt - sindec * sinlat ) / ( cosdec * coslat );
+        double ha = acos ( ::min ( ::max ( cosha, -1.0 ), 1.0 ) );
+        double hh[3] = { -ha, 0.0, ha };
+        SSRTS *events[3] = { &passes[ fixed[k] ].rising, &passes[ fixed[k] ].transit, &passes[ fixed[k] ].setting };
+        
+        // As in the single-object version, transit is searched with a horizon altitude of zero.
+        
+        bool transits = -sindec * sinlat < cosdec * coslat;
+        
+        for ( int e = 0; e < 3; e++ )
+        {
+            if ( e == 1 ? ! transits : ha == 0.0 || ha == SSAngle::kPi )
+            {
+                events[e]->time = e == 0 ? -INFINITY : INFINITY;
+                continue;
+            }
+            
+            double h = hh[e], sinh = sin ( h ), cosh = cos ( h );
+            events[e]->time = noon + modpi ( ra[k] - lst + h ) * daysPerRad;
+            events[e]->azm = atan2pi ( -cosdec * sinh, sindec * coslat - cosdec * cosh * sinlat );
+            events[e]->alt = asin ( sinlat * sindec + coslat * cosdec * cosh );
+        }
+    }
+    
+    int count = 0;
+    for ( SSPass &pass : passes )
+        if ( ! ::isinf ( pass.rising.time ) || ! ::isinf ( pass.transit.time ) || ! ::isinf ( pass.setting.time ) )
+            count++;
+    
+    return count;
+}
+
 // Returns the Juliam Date of the next moon phase after the current time (time).
 // Objects pSun and pMoon are pointers to the SUn and Moon, respectively.
 // The angular value (phase) corresponds to the desired moon phase in radians:
@@ -226,11 +383,11 @@ SSTime SSEvent::nextMoonPhase ( SSTime time, SSObjectPtr pSun, SSObjectPtr pMoon
     {
         coords.setTime ( time );
         pSun->computeEphemeris ( coords );
-        ecl = coords.transform ( kFundamental, kEcliptic, pSun->getDirection() );
+        ecl = coords.transform<kFundamental, kEcliptic> ( pSun->getDirection() );
         sunlon = ecl.lon;
         
         pMoon->computeEphemeris ( coords );
-        ecl = coords.transform ( kFundamental, kEcliptic, pMoon->getDirection() );
+        ecl = coords.transform<kFundamental, kEcliptic> ( pMoon->getDirection() );
         moonlon = ecl.lon;
 
         // On first iteration, ensure ecliptic longitude delta is negative
@@ -274,7 +431,7 @@ double object_separation ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr
 double object_altitude ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2 )
 {
     SSVector dir = pObj1->getDirection();
-    SSSpherical hor = coords.transform ( kFundamental, kHorizon, dir );
+    SSSpherical hor = coords.transform<kFundamental, kHorizon> ( dir );
     return hor.lat;
 }
 
@@ -288,11 +445,33 @@ double object_altitude ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr p
 // The function (func) returns the value for those objects at a given time.
 // The coordinates (coords) and objects' (pObj1,pObj2) positions will be recomputed/modified by this function!
 
+// Rounding error allowed in search sample times past the stop time, in days: a few times the rounding error in a Julian Date,
+// accumulated over the 20 steps of a recursive search, but much less than a second.
+
+static constexpr double kSampleTolerance = 1.0e-8;
+
+// Computes the ephemerides of objects (pObj1, pObj2) at a time (time), then returns the value of an event function (func).
+
+static double event_value ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSEventFunc func, SSTime time )
+{
+    coords.setTime ( time );
+    
+    if ( pObj1 )
+        pObj1->computeEphemeris ( coords );
+    
+    if ( pObj2 )
+        pObj2->computeEphemeris ( coords );
+    
+    return func ( coords, pObj1, pObj2 );
+}
+
 void SSEvent::findEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, double step, bool min, double limit, SSEventFunc func, vector<SSEventTime> &events, int maxEvents )
 {
     double newVal = INFINITY, curVal = INFINITY, oldVal = INFINITY;
     
-    for ( SSTime time = start; time <= stop && events.size() < maxEvents; time += step )
+    // Allow rounding error in the accumulated time, so a recursive search always samples its end time.
+    
+    for ( SSTime time = start; time.jd <= stop.jd + kSampleTolerance && events.size() < maxEvents; time += step )
     {
         // Compute the ephemerides of the objects at the current time,
         // then the value of the event function.
@@ -324,13 +503,23 @@ void SSEvent::findEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr
         // call this method recursively to search the interval between those times
         // with a search step 10x smaller, until the step is less than 1 second.
         // When we reach that precision, save the time and value, and return.
+        // With root finding, refine the event in that interval directly instead.
 
         if ( ! ::isinf ( oldVal ) && ! ::isinf ( curVal ) && ! ::isinf ( newVal ) )
         {
             if ( ( min && ( newVal > curVal && curVal < oldVal ) && curVal <= limit )
             || ( ! min && ( newVal < curVal && curVal > oldVal ) && curVal >= limit ) )
             {
-                if ( step < 1.0 / SSTime::kSecondsPerDay )
+                if ( _useRootFinding )
+                {
+                    double sign = min ? 1.0 : -1.0;
+                    double value = sign * curVal;
+                    auto f = [&] ( double t ) { return sign * event_value ( coords, pObj1, pObj2, func, t ); };
+                    double t = brentMinimum ( f, time - step * 2.0, time, time - step, value, _rootTimeTol, _rootValueTol );
+                    SSEventTime event = { t, sign * value };
+                    events.push_back ( event );
+                }
+                else if ( step < 1.0 / SSTime::kSecondsPerDay )
                 {
                     SSEventTime event = { time - step, curVal };
                     events.push_back ( event );
@@ -356,7 +545,9 @@ void SSEvent::findEqualityEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSO
 {
     double curVal = INFINITY, oldVal = INFINITY;
     
-    for ( SSTime time = start; time <= stop && events.size() < maxEvents; time += step )
+    // Allow rounding error in the accumulated time, so a recursive search always samples its end time.
+    
+    for ( SSTime time = start; time.jd <= stop.jd + kSampleTolerance && events.size() < maxEvents; time += step )
     {
         // Compute the ephemerides of the objects at the current time,
         // then the value of the event function.
@@ -382,13 +573,22 @@ void SSEvent::findEqualityEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSO
         // call this method recursively to search the interval between those times
         // with a search step 10x smaller, until the step is less than 1 second.
         // When we reach that precision, save the time and value, and return.
+        // With root finding, refine the event in that interval directly instead.
 
         if ( ! ::isinf ( oldVal ) && ! ::isinf ( curVal ) )
         {
             if ( ( below && ( curVal >= target && oldVal < target ) )
             || ( ! below && ( curVal <= target && oldVal > target ) ) )
             {
-                if ( step < 1.0 / SSTime::kSecondsPerDay )
+                if ( _useRootFinding )
+                {
+                    double value = curVal - target;
+                    auto f = [&] ( double t ) { return event_value ( coords, pObj1, pObj2, func, t ) - target; };
+                    double t = illinoisRoot ( f, time - step, time, oldVal - target, value, _rootTimeTol, _rootValueTol );
+                    SSEventTime event = { t, value + target };
+                    events.push_back ( event );
+                }
+                else if ( step < 1.0 / SSTime::kSecondsPerDay )
                 {
                     SSEventTime event = { time, curVal };
                     events.push_back ( event );
@@ -403,89 +603,731 @@ void SSEvent::findEqualityEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSO
     }
 }
 
-void SSEvent::findConjunctions ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents )
+// Searches for events with a single-threaded search function (search) in consecutive slabs of the search steps from
+// (start) to (stop) on separate threads; see the parallel findEvents(). An event is bracketed by the samples before and
+// after (overlap) consecutive steps: two for extrema, one for equalities. Each slab searches the brackets whose last
+// sample is within its share of the steps, so with exact sample times, no bracket is searched twice.
+
+template<class F> static void find_events_parallel ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, double step, int overlap, F search, vector<SSEventTime> &events, int maxEvents, int threads )
 {
-    findEvents ( coords, pObj1, pObj2, start, stop, 1.0, true, INFINITY, object_separation, events, maxEvents );
+    // Brackets are numbered by the sample which ends them: from (overlap) to the last sample (nsteps).
+    
+    long nsteps = step > 0.0 && stop > start ? (long) floor ( ( stop - start + kSampleTolerance ) / step ) : 0;
+    long nbrackets = nsteps - overlap + 1;
+    int limit = maxEvents - (int) events.size();
+    if ( nbrackets < 1 || limit < 1 )
+        return;
+    
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+#endif
+    threads = (int) min ( (long) max ( threads, 1 ), nbrackets );
+    
+    // Brackets are split into more slabs than threads, taken in time order by whichever thread is free. Once the slabs
+    // up to some time have found (limit) events, later slabs are skipped, since none of their events would be returned.
+    
+    int nslabs = (int) min ( (long) threads * 4, nbrackets );
+    vector<vector<SSEventTime>> found ( nslabs );
+    vector<bool> done ( nslabs, false );
+    int next = 0, prefix = 0;
+    size_t prefixEvents = 0;
+    mutex slabMutex;
+    
+    auto work = [&] ( int t )
+    {
+        SSCoordinates slabCoords ( coords );
+        SSObjectPtr pSlabObj1 = SSCloneObject ( pObj1 );
+        SSObjectPtr pSlabObj2 = SSCloneObject ( pObj2 );
+        
+        while ( true )
+        {
+            int k = 0;
+            {
+                lock_guard<mutex> lock ( slabMutex );
+                if ( next >= nslabs || prefixEvents >= limit )
+                    break;
+                k = next++;
+            }
+            
+            long b0 = overlap + nbrackets * k / nslabs, b1 = overlap + nbrackets * ( k + 1 ) / nslabs;
+            SSTime slabStart = SSTime ( start.jd + ( b0 - overlap ) * step, start.zone );
+            SSTime slabStop = SSTime ( start.jd + ( b1 - 1 ) * step, start.zone );
+            search ( slabCoords, pSlabObj1, pSlabObj2, slabStart, slabStop, found[k], limit );
+            
+            lock_guard<mutex> lock ( slabMutex );
+            for ( done[k] = true; prefix < nslabs && done[prefix]; prefix++ )
+                prefixEvents += found[prefix].size();
+        }
+        
+        delete pSlabObj1;
+        delete pSlabObj2;
+    };
+    
+#if USE_THREADS
+    vector<thread> workers;
+    for ( int t = 1; t < threads; t++ )
+        workers.push_back ( thread ( work, t ) );
+    
+    work ( 0 );
+    
+    for ( thread &worker : workers )
+        worker.join();
+#else
+    for ( int t = 0; t < threads; t++ )
+        work ( t );
+#endif
+    
+    // Append slabs in time order. Rounding in slab start times could let a bracket on a boundary be found in
+    // both slabs; if the first event of a slab is within a second of the last one appended, keep one.
+    
+    size_t first = events.size();
+    for ( vector<SSEventTime> &list : found )
+        for ( size_t i = 0; i < list.size() && events.size() < maxEvents; i++ )
+        {
+            if ( i == 0 && events.size() > first && fabs ( list[i].time.jd - events.back().time.jd ) < 1.0 / SSTime::kSecondsPerDay )
+                continue;
+            events.push_back ( list[i] );
+        }
 }
 
-void SSEvent::findOppositions ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents )
+void SSEvent::findEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, double step, bool min, double limit, SSEventFunc func, vector<SSEventTime> &events, int maxEvents, int threads )
 {
-    findEvents ( coords, pObj1, pObj2, start, stop, 1.0, false, 0.0, object_separation, events, maxEvents );
+    if ( threads == 1 )
+        return findEvents ( coords, pObj1, pObj2, start, stop, step, min, limit, func, events, maxEvents );
+    
+    auto search = [&] ( SSCoordinates &c, SSObjectPtr p1, SSObjectPtr p2, SSTime t0, SSTime t1, vector<SSEventTime> &found, int n )
+    {
+        findEvents ( c, p1, p2, t0, t1, step, min, limit, func, found, n );
+    };
+    
+    find_events_parallel ( coords, pObj1, pObj2, start, stop, step, 2, search, events, maxEvents, threads );
 }
 
-void SSEvent::findNearestDistances ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents )
+void SSEvent::findEqualityEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, double step, bool below, double target, SSEventFunc func, vector<SSEventTime> &events, int maxEvents, int threads )
 {
-    findEvents ( coords, pObj1, pObj2, start, stop, 1.0, true, INFINITY, object_distance, events, maxEvents );
+    if ( threads == 1 )
+        return findEqualityEvents ( coords, pObj1, pObj2, start, stop, step, below, target, func, events, maxEvents );
+    
+    auto search = [&] ( SSCoordinates &c, SSObjectPtr p1, SSObjectPtr p2, SSTime t0, SSTime t1, vector<SSEventTime> &found, int n )
+    {
+        findEqualityEvents ( c, p1, p2, t0, t1, step, below, target, func, found, n );
+    };
+    
+    find_events_parallel ( coords, pObj1, pObj2, start, stop, step, 1, search, events, maxEvents, threads );
 }
 
-void SSEvent::findFarthestDistances ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents )
+void SSEvent::findConjunctions ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents, int threads )
 {
-    findEvents ( coords, pObj1, pObj2, start, stop, 1.0, false, 0.0, object_distance, events, maxEvents );
+    findEvents ( coords, pObj1, pObj2, start, stop, 1.0, true, INFINITY, object_separation, events, maxEvents, threads );
 }
 
-// Searches for satellite passes seen from a location (coords) between two Julian dates (start to stop).
-// Passes start when satellite's apparent altitude rises above a minimum threshold (minAlt) in radians;
-// passes end when satellite's elevation falls below that threshold.  Peak elevation and time thereof are
-// also recorded in each pass's transit struct. The method returns the total number of passes found, and
-// returns all pass circumstances in the vector of SSPass structs.  The function also stops searching when
-// it finds the maximum number of passes (maxPasses).
-// After return, both coords and pObj will be restored to their original states.
+void SSEvent::findOppositions ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents, int threads )
+{
+    findEvents ( coords, pObj1, pObj2, start, stop, 1.0, false, 0.0, object_separation, events, maxEvents, threads );
+}
 
-int SSEvent::findSatellitePasses ( SSCoordinates &coords, SSObjectPtr pSat, SSTime start, SSTime stop, double minAlt, vector<SSPass> &passes, int maxPasses )
+void SSEvent::findNearestDistances ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents, int threads )
 {
-    SSTime  savetime = coords.getTime();
+    findEvents ( coords, pObj1, pObj2, start, stop, 1.0, true, INFINITY, object_distance, events, maxEvents, threads );
+}
+
+void SSEvent::findFarthestDistances ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents, int threads )
+{
+    findEvents ( coords, pObj1, pObj2, start, stop, 1.0, false, 0.0, object_distance, events, maxEvents, threads );
+}
+
+// An object's ecliptic longitude extent in the group conjunction sweep, from (lo) to (hi) radians.
+
+struct sweep_interval
+{
+    double lo, hi;
+    int obj;
+};
+
+int SSEvent::findConjunctions ( SSCoordinates &coords, SSObjectVec &objects, SSTime start, SSTime stop, double maxSep, vector<SSObjectConjunction> &conjunctions, double step )
+{
+    static constexpr double kPolarLat = 60.0 / SSAngle::kDegPerRad;
+
+    int n = (int) objects.size();
+    int nsteps = (int) floor ( ( stop - start ) / step + 0.01 );
+    if ( n < 2 || ! ( step > 0.0 ) || nsteps < 2 )
+        return 0;
+
+    vector<bool> solsys ( n );
+    for ( int j = 0; j < n; j++ )
+        solsys[j] = SSGetPlanetPtr ( objects[j] ) != nullptr;
+
+    // Ecliptic unit vectors of all objects at the previous, current, and next search steps.
+    // Separations are the same in any frame; the ecliptic frame makes longitude sweeps efficient.
+
+    vector<SSVector> dirs[3];
+    auto sample = [&] ( int i, vector<SSVector> &dir )
+    {
+        coords.setTime ( SSTime ( start + i * step ) );
+        SSMatrix eclMat = coords.getTransformMatrix ( kFundamental, kEcliptic );
+        dir.resize ( n );
+        for ( int j = 0; j < n; j++ )
+        {
+            objects[j]->computeEphemeris ( coords );
+            dir[j] = eclMat * objects[j]->getDirection();
+        }
+    };
+
+    sample ( 0, dirs[0] );
+    sample ( 1, dirs[1] );
+
+    vector<double> reach ( n );
+    vector<sweep_interval> intervals, active;
+    vector<pair<int,int>> candidates;
+    size_t first = conjunctions.size();
+
+    for ( int i = 1; i < nsteps; i++ )
+    {
+        sample ( i + 1, dirs[2] );
+        vector<SSVector> &prev = dirs[0], &cur = dirs[1], &next = dirs[2];
+
+        // A pair can only reach (maxSep) within a step of now if it is now within (maxSep) plus the distance both objects
+        // move in a step. Since separation >= longitude difference x cos ( latitude ) for small separations, interval
+        // half-widths are divided by the cosine of the greatest latitude either object of such a pair could have.
+        // Objects too near the ecliptic poles for that to work are paired with all others instead.
+
+        double maxReach = 0.0;
+        for ( int j = 0; j < n; j++ )
+        {
+            reach[j] = cur[j].isinf() ? INFINITY : solsys[j] ? ::max ( (double) prev[j].angularSeparation ( cur[j] ), (double) cur[j].angularSeparation ( next[j] ) ) : 0.0;
+            if ( reach[j] < INFINITY )
+                maxReach = ::max ( maxReach, reach[j] );
+        }
+
+        double limit = maxSep + 2.0 * maxReach;
+        vector<int> polar;
+        intervals.clear();
+        candidates.clear();
+        for ( int j = 0; j < n; j++ )
+        {
+            if ( ::isinf ( reach[j] ) )
+                continue;
+
+            double lat = asin ( ::min ( ::max ( cur[j].z, -1.0 ), 1.0 ) );
+            if ( fabs ( lat ) + limit >= kPolarLat )
+            {
+                polar.push_back ( j );
+                continue;
+            }
+
+            double lon = mod2pi ( atan2 ( cur[j].y, cur[j].x ) );
+            double half = 1.01 * ( maxSep / 2.0 + reach[j] ) / cos ( fabs ( lat ) + limit );
+            sweep_interval in = { lon - half, lon + half, j };
+            intervals.push_back ( in );
+            if ( in.lo < 0.0 )
+                intervals.push_back ( { in.lo + SSAngle::kTwoPi, in.hi + SSAngle::kTwoPi, j } );
+            if ( in.hi > SSAngle::kTwoPi )
+                intervals.push_back ( { in.lo - SSAngle::kTwoPi, in.hi - SSAngle::kTwoPi, j } );
+        }
+
+        sort ( intervals.begin(), intervals.end(), [] ( const sweep_interval &a, const sweep_interval &b ) { return a.lo < b.lo; } );
+        active.clear();
+        for ( sweep_interval &in : intervals )
+        {
+            active.erase ( remove_if ( active.begin(), active.end(), [&] ( const sweep_interval &a ) { return a.hi < in.lo; } ), active.end() );
+            for ( sweep_interval &a : active )
+                if ( a.obj != in.obj && ( solsys[a.obj] || solsys[in.obj] ) )
+                    candidates.push_back ( { ::min ( a.obj, in.obj ), ::max ( a.obj, in.obj ) } );
+            active.push_back ( in );
+        }
+
+        for ( int j : polar )
+            for ( int k = 0; k < n; k++ )
+                if ( k != j && ! ::isinf ( reach[k] ) && ( solsys[j] || solsys[k] ) )
+                    candidates.push_back ( { ::min ( j, k ), ::max ( j, k ) } );
+
+        sort ( candidates.begin(), candidates.end() );
+        candidates.erase ( unique ( candidates.begin(), candidates.end() ), candidates.end() );
+
+        // Refine candidates whose separation has a minimum bracketed by the previous and next steps.
+
+        for ( pair<int,int> &c : candidates )
+        {
+            int j = c.first, k = c.second;
+            double sep = cur[j].angularSeparation ( cur[k] );
+            if ( sep > maxSep + reach[j] + reach[k] || ! ( sep < prev[j].angularSeparation ( prev[k] ) && sep <= next[j].angularSeparation ( next[k] ) ) )
+                continue;
+
+            SSObjectPtr pObj1 = objects[j], pObj2 = objects[k];
+            auto f = [&] ( double t ) { return event_value ( coords, pObj1, pObj2, object_separation, t ); };
+            double t = start + i * step;
+            t = brentMinimum ( f, t - step, t + step, t, sep, _rootTimeTol, _rootValueTol );
+            if ( sep <= maxSep )
+                conjunctions.push_back ( { (size_t) j, (size_t) k, SSTime ( t ), sep } );
+        }
+
+        swap ( dirs[0], dirs[1] );
+        swap ( dirs[1], dirs[2] );
+    }
+
+    sort ( conjunctions.begin() + first, conjunctions.end(), [] ( const SSObjectConjunction &a, const SSObjectConjunction &b ) { return a.time.jd < b.time.jd; } );
+    return (int) ( conjunctions.size() - first );
+}
+
+// Computes margins of a satellite's geocentric position (satPos) from the edges of Earth's penumbra and umbra,
+// given the Sun's geocentric position (sunPos), both in AU. Each margin is the angular separation (radians) between
+// the Sun's and Earth's centers, as seen from the satellite, minus the sum (penumbra) or difference (umbra) of their
+// apparent radii; so it is negative inside the penumbra or umbra. Earth is treated as a sphere with its equatorial radius.
+
+static void shadow_margins ( SSVector satPos, SSVector sunPos, double &penumbra, double &umbra )
+{
+    SSVector toSun = sunPos - satPos;
+    SSVector toEarth = satPos * -1.0;
+    double dSun = toSun.magnitude(), dEarth = toEarth.magnitude();
+    
+    double rEarth = asin ( min ( 1.0, SSCoordinates::kAUPerEarthRadii / dEarth ) );
+    double rSun = asin ( min ( 1.0, SSCoordinates::kAUPerSolarRadii / dSun ) );
+    double sep = atan2 ( toSun.crossProduct ( toEarth ).magnitude(), toSun * toEarth );
+    
+    penumbra = sep - ( rEarth + rSun );
+    umbra = sep - ( rEarth - rSun );
+}
+
+// Returns satellite's Earth shadow state (kSunlit, kPenumbra, or kUmbra) from its geocentric position (satPos)
+// and the Sun's geocentric position (sunPos), both in AU, in the same frame.
+
+int SSEvent::satelliteShadow ( SSVector satPos, SSVector sunPos )
+{
+    double penumbra = 0.0, umbra = 0.0;
     
-    while ( true )
+    shadow_margins ( satPos, sunPos, penumbra, umbra );
+    if ( umbra < 0.0 )
+        return kUmbra;
+    else if ( penumbra < 0.0 )
+        return kPenumbra;
+    else
+        return kSunlit;
+}
+
+// Computes the Sun's geocentric position in AU in the fundamental J2000 equatorial frame, once for each
+// civil Julian Date in (jds), for use by findSatelliteShadows(). Results are returned in (sunPos).
+
+void SSEvent::sunPositions ( const vector<double> &jds, vector<SSVector> &sunPos )
+{
+    sunPos.resize ( jds.size() );
+    for ( size_t i = 0; i < jds.size(); i++ )
     {
-        // First search for the next satellite rising. Save satellite horizon coords at end of search. Quit if we find none.
+        double jed = jds[i] + SSTime ( jds[i] ).getDeltaT() / SSTime::kSecondsPerDay;
+        SSVector earthPos, earthVel;
         
-        vector<SSEventTime> risings;
-        findEqualityEvents ( coords, pSat, nullptr, start, stop, 1.0 / SSTime::kMinutesPerDay, true, minAlt, object_altitude, risings, 1 );
-        SSSpherical risingCoords = coords.transform ( kFundamental, kHorizon, pSat->getDirection() );
-        if ( risings.size() == 0 )
-            break;
+        SSPlanet::computeMajorPlanetPositionVelocity ( kEarth, jed, 0.0, earthPos, earthVel );
+        sunPos[i] = earthPos * -1.0;
+    }
+}
+
+// Interpolates satellite position between samples i and i + 1 at fraction (f) of the interval (dt, days):
+// cubic Hermite interpolation if velocities are available, otherwise linear. Sun position is interpolated linearly.
+
+static void shadow_interpolate ( const vector<SSVector> &sunPos, const vector<SSVector> &satPos, const vector<SSVector> &satVel, size_t i, double dt, double f, SSVector &sat, SSVector &sun )
+{
+    SSVector p0 = satPos[i], p1 = satPos[i + 1];
+    SSVector s0 = sunPos[i], s1 = sunPos[i + 1];
+    
+    sun = s0 * ( 1.0 - f ) + s1 * f;
+    if ( satVel.size() == satPos.size() )
+    {
+        SSVector v0 = satVel[i], v1 = satVel[i + 1];
+        v0 *= dt;
+        v1 *= dt;
+        double f2 = f * f, f3 = f2 * f;
+        sat = p0 * ( 2.0 * f3 - 3.0 * f2 + 1.0 ) + v0 * ( f3 - 2.0 * f2 + f ) + p1 * ( 3.0 * f2 - 2.0 * f3 ) + v1 * ( f3 - f2 );
+    }
+    else
+    {
+        sat = p0 * ( 1.0 - f ) + p1 * f;
+    }
+}
+
+// Computes a satellite's Earth shadow state at each of a series of civil Julian Dates (jds), in increasing order,
+// from its geocentric positions (satPos, AU) and optional velocities (satVel, AU/day; may be empty) at those times,
+// and the Sun's geocentric positions (sunPos, AU) from sunPositions(), which can be shared by any number of satellites.
+// States (kSunlit, kPenumbra, kUmbra) are returned in (states). Times when the satellite enters or leaves the penumbra
+// or umbra are found by bisection on positions interpolated between samples, without further propagation, and are
+// returned in (changes) in time order; each change's value is the state the satellite enters. A shadow crossed and
+// recrossed within one sample interval is not found. Returns the number of changes.
 
-        // Now search for the next satellite setting, within 1 day after the rising time. Save satellite horizon coords at end of search. Quit if we find none.
+int SSEvent::findSatelliteShadows ( const vector<double> &jds, const vector<SSVector> &sunPos, const vector<SSVector> &satPos, const vector<SSVector> &satVel, vector<int> &states, vector<SSEventTime> &changes )
+{
+    size_t n = min ( jds.size(), min ( sunPos.size(), satPos.size() ) );
+    vector<double> penumbra ( n ), umbra ( n );
+    
+    states.resize ( n );
+    changes.clear();
+    for ( size_t i = 0; i < n; i++ )
+    {
+        shadow_margins ( satPos[i], sunPos[i], penumbra[i], umbra[i] );
+        states[i] = umbra[i] < 0.0 ? kUmbra : penumbra[i] < 0.0 ? kPenumbra : kSunlit;
+    }
+    
+    for ( size_t i = 0; i + 1 < n; i++ )
+    {
+        double dt = jds[i + 1] - jds[i];
+        SSEventTime crossings[2];
+        int ncrossings = 0;
         
-        vector<SSEventTime> settings;
-        findEqualityEvents ( coords, pSat, nullptr, risings[0].time, risings[0].time + 1.0, 1.0 / SSTime::kMinutesPerDay, false, minAlt, object_altitude, settings, 1 );
-        SSSpherical settingCoords = coords.transform ( kFundamental, kHorizon, pSat->getDirection() );
-        if ( settings.size() == 0 )
-            break;
+        // Bisect each boundary whose margin changes sign over this interval, to about 1 millisecond.
         
-        // Finally search for the next transit time after rising but before setting. Save satellite horizon coords at end of search. Quit if we find none.
+        for ( int b = 0; b < 2; b++ )
+        {
+            const vector<double> &margin = b == 0 ? penumbra : umbra;
+            if ( ( margin[i] < 0.0 ) == ( margin[i + 1] < 0.0 ) )
+                continue;
+            
+            double f0 = 0.0, f1 = 1.0;
+            while ( ( f1 - f0 ) * dt > 1.0e-3 / SSTime::kSecondsPerDay )
+            {
+                double f = ( f0 + f1 ) / 2.0, pen = 0.0, umb = 0.0;
+                SSVector sat, sun;
+                
+                shadow_interpolate ( sunPos, satPos, satVel, i, dt, f, sat, sun );
+                shadow_margins ( sat, sun, pen, umb );
+                if ( ( ( b == 0 ? pen : umb ) < 0.0 ) == ( margin[i] < 0.0 ) )
+                    f0 = f;
+                else
+                    f1 = f;
+            }
+            
+            // Entering the penumbra from sunlight, or leaving the umbra, puts the satellite in the penumbra.
+            
+            bool entering = margin[i] >= 0.0;
+            crossings[ncrossings].time = SSTime ( jds[i] + dt * ( f0 + f1 ) / 2.0 );
+            crossings[ncrossings].value = b == 0 ? ( entering ? kPenumbra : kSunlit ) : ( entering ? kUmbra : kPenumbra );
+            ncrossings++;
+        }
         
-        vector<SSEventTime> transits;
-        findEvents ( coords, pSat, nullptr, risings[0].time, settings[0].time, ( settings[0].time - risings[0].time ) / 10.0, false, minAlt, object_altitude, transits, 1 );
-        SSSpherical transitCoords = coords.transform ( kFundamental, kHorizon, pSat->getDirection() );
-        if ( transits.size() == 0.0 )
-            break;
+        if ( ncrossings == 2 && crossings[1].time < crossings[0].time )
+            swap ( crossings[0], crossings[1] );
         
-        // We found a complete pass!
+        for ( int c = 0; c < ncrossings; c++ )
+            changes.push_back ( crossings[c] );
+    }
+    
+    return (int) changes.size();
+}
+
+// Satellite positions sampled across a time interval for pass screening, independent of observer location,
+// so that one set of samples can screen passes for any number of observers.
+
+struct pass_samples
+{
+    double q, p, e;                             // perigee distance (km), semilatus rectum (km), eccentricity
+    vector<double> jd;                          // Julian Dates (civil time) of samples
+    vector<SSVector> dir;                       // unit vectors from Earth's center toward satellite, in TEME frame
+    vector<double> rad;                         // satellite distances from Earth's center (km)
+    vector<double> gst;                         // Greenwich mean sidereal times (radians)
+};
+
+static constexpr double kEarthGM = 398600.4418;                                 // km^3 / sec^2
+static constexpr double kEarthPolarRadius = 6356.752;                           // km
+static constexpr double kEarthRotation = M_2PI / SSTime::kSecondsPerDay * SSTime::kSiderealPerSolarDays;   // radians / sec
+
+// Bounds the rate of change, in radians per second, of a satellite's angle outside the visibility cone of an observer
+// whose radius from the Earth's center times the cosine of the minimum altitude is (rho) km. Its angle from the observer
+// changes no faster than the satellite's angular velocity (at most at perigee) plus the Earth's rotation;
+// the cone radius acos ( rho / r ) changes with radial velocity, at most e * sqrt ( GM / p ), fastest at perigee.
+
+static double pass_screen_rate ( const pass_samples &samples, double rho )
+{
+    double q = samples.q, e = samples.e;
+    double vperi = sqrt ( kEarthGM * ( 1.0 + e ) / q );
+    double rdot = e * sqrt ( kEarthGM / samples.p );
+    
+    return vperi / q + kEarthRotation + rho / ( q * q ) * rdot / sqrt ( 1.0 - rho * rho / ( q * q ) );
+}
+
+// Samples a satellite (pSat) from start to stop, for screening passes above a minimum altitude (minAlt).
+// Steps are as long as possible while the satellite's angle outside the visibility cone changes by at most about 10 degrees.
+// Returns false if the object is not a satellite, or its orbit can't be screened: SSSatellite switches from SGP4/SDP4
+// to Keplerian elements 30 days from the TLE epoch, and we can't bound the cone's rate of change if the perigee is too low.
+
+static bool sample_passes ( SSObjectPtr pSat, SSTime start, SSTime stop, double minAlt, pass_samples &samples )
+{
+    static constexpr double kMaxChange = 10.0 / SSAngle::kDegPerRad;
+    
+    SSSatellitePtr pSatellite = SSGetSatellitePtr ( pSat );
+    SSTLE tle = pSatellite ? pSatellite->getTLE() : SSTLE();
+    if ( pSatellite == nullptr || fabs ( start - tle.jdepoch ) >= 30.0 || fabs ( stop - tle.jdepoch ) >= 30.0 || tle.eo >= 1.0 || tle.xno <= 0.0 )
+        return false;
+    
+    double n = tle.xno * SSTime::kMinutesPerDay / SSTime::kSecondsPerDay;
+    double a = cbrt ( kEarthGM / ( n * n ) ), rho = kEarthPolarRadius * cos ( minAlt );
+    
+    samples.e = tle.eo;
+    samples.q = a * ( 1.0 - tle.eo );
+    samples.p = a * ( 1.0 - tle.eo * tle.eo );
+    if ( samples.q <= rho * 1.01 )
+        return false;
+    
+    double step = clamp ( kMaxChange / pass_screen_rate ( samples, rho ), 60.0, 3600.0 ) / SSTime::kSecondsPerDay;
+    
+    samples.jd.clear();
+    samples.dir.clear();
+    samples.rad.clear();
+    samples.gst.clear();
+    
+    tle.init();
+    for ( double jd = start.jd; ; jd = min ( jd + step, stop.jd ) )
+    {
+        SSVector pos, vel;
+        double r = 0.0;
         
-        SSPass pass;
+        tle.toPositionVelocity ( jd, pos, vel );
+        samples.jd.push_back ( jd );
+        samples.dir.push_back ( pos.normalize ( r ) );
+        samples.rad.push_back ( r );
+        samples.gst.push_back ( SSTime ( jd ).getSiderealTime ( 0.0 ) );
+        if ( jd >= stop.jd )
+            break;
+    }
+    
+    return true;
+}
+
+// Screens satellite position samples for passes above a minimum altitude (minAlt) seen from a geographic location (loc),
+// returning time windows (in time zone (zone)) when passes are possible. A satellite can only be above minAlt when its
+// angle from the observer around the Earth's center is less than the radius of the observer's visibility cone at the
+// satellite's distance. Between two samples separated by (dt) seconds with outside angles g0 and g1, the angle is at least
+// ( g0 + g1 - rate * dt ) / 2, so if that's positive, the satellite is below minAlt throughout. The cone is widened
+// by one degree for refraction, aberration, the Earth's flattening, and geodetic latitude.
+
+static void screen_passes ( pass_samples &samples, SSSpherical loc, double minAlt, double zone, vector<SSTimeRange> &windows )
+{
+    static constexpr double kMargin = 1.0 / SSAngle::kDegPerRad;
+    
+    double rho = ( kEarthPolarRadius + loc.rad ) * cos ( minAlt );
+    double rate = pass_screen_rate ( samples, rho );
+    SSSpherical obs ( loc.lon, loc.lat, 1.0 );
+    
+    auto outside = [&] ( size_t k )
+    {
+        obs.lon = SSAngle ( samples.gst[k] + loc.lon );
+        return samples.dir[k].angularSeparation ( SSVector ( obs ) ) - ( acos ( rho / samples.rad[k] ) - minAlt + kMargin );
+    };
+    
+    windows.clear();
+    bool open = false;
+    double g0 = outside ( 0 );
+    for ( size_t k = 1; k < samples.jd.size(); k++ )
+    {
+        double t0 = samples.jd[k - 1], t1 = samples.jd[k], g1 = outside ( k );
+        if ( ::isnan ( g0 ) || ::isnan ( g1 ) || g0 + g1 <= rate * ( t1 - t0 ) * SSTime::kSecondsPerDay )
+        {
+            if ( open )
+                windows.back().stop = SSTime ( t1, zone );
+            else
+                windows.push_back ( { SSTime ( t0, zone ), SSTime ( t1, zone ) } );
+            open = true;
+        }
+        else
+        {
+            open = false;
+        }
         
-        pass.rising.time = risings[0].time;
-        pass.rising.azm = risingCoords.lon;
-        pass.rising.alt = risingCoords.lat;
+        g0 = g1;
+    }
+}
+
+// Finds the intervals of time between two Julian dates (start to stop) when a satellite (pSat) might be above
+// a minimum altitude (minAlt) in radians, seen from the location in a coordinates object (coords), from orbit geometry alone.
+// The satellite is propagated in its TLE (TEME) frame, without any coordinate transformations, at steps over which
+// its angle from the observer around the Earth's center can't change by more than about 10 degrees; intervals
+// which can't reach inside the observer's visibility cone, even at the fastest possible rate of change, are left out.
+// Every pass above minAlt is inside one of the windows returned in (windows); returns the number of windows.
+// If the object is not a satellite, or its orbit can't be screened, returns a single window from start to stop.
+// Neither coords nor pSat is modified.
+
+int SSEvent::findSatellitePassWindows ( SSCoordinates &coords, SSObjectPtr pSat, SSTime start, SSTime stop, double minAlt, vector<SSTimeRange> &windows )
+{
+    pass_samples samples;
+    
+    if ( sample_passes ( pSat, start, stop, minAlt, samples ) )
+    {
+        screen_passes ( samples, coords.getLocation(), minAlt, start.zone, windows );
+    }
+    else
+    {
+        windows.clear();
+        windows.push_back ( { start, stop } );
+    }
+    
+    return (int) windows.size();
+}
+
+// Satellite and Sun circumstances saved at the end of a pass event search, for computing the pass's shadow changes
+// and visibility without propagating the satellite again.
+
+struct pass_point
+{
+    double jd;                                  // civil Julian Date
+    SSVector pos, vel;                          // satellite geocentric position (AU) and velocity (AU/day), fundamental frame
+    SSVector sun;                               // Sun geocentric position (AU), fundamental frame
+    double sunAlt;                              // Sun's altitude at observer's location (radians)
+};
+
+// Returns a satellite's (pSat) and the Sun's circumstances at the time of coordinates (coords), from the satellite's
+// ephemeris already computed there, as the end of an event search leaves it.
+
+static pass_point pass_circumstances ( SSCoordinates &coords, SSObjectPtr pSat )
+{
+    SSPlanetPtr pPlanet = SSGetPlanetPtr ( pSat );
+    SSEphemerisContext &context = coords.getEphemerisContext();
+    pass_point point;
+    
+    point.jd = coords.getTime().jd;
+    point.pos = pPlanet->getPosition() - context.earthPos;
+    point.vel = pPlanet->getVelocity() - context.earthVel;
+    point.sun = context.earthPos * -1.0;
+    point.sunAlt = SSSpherical ( coords.transform<kFundamental, kHorizon> ( point.sun.normalize() ) ).lat;
+    return point;
+}
+
+// Fills in a pass's shadow changes from circumstances at rising, transit, and setting (points).
+// Returns true if the satellite is sunlit or in the penumbra at any of those times or shadow changes
+// while the Sun is below a maximum altitude (maxSunAlt); Sun altitude is interpolated between points.
+// Every pass is visible if maxSunAlt is infinite.
+
+static bool pass_shadows ( const pass_point points[3], double zone, double maxSunAlt, SSPass &pass )
+{
+    vector<double> jds ( 3 );
+    vector<SSVector> sun ( 3 ), pos ( 3 ), vel ( 3 );
+    vector<int> states;
+    vector<SSEventTime> changes;
+    
+    for ( int i = 0; i < 3; i++ )
+    {
+        jds[i] = points[i].jd;
+        sun[i] = points[i].sun;
+        pos[i] = points[i].pos;
+        vel[i] = points[i].vel;
+    }
+    
+    SSEvent::findSatelliteShadows ( jds, sun, pos, vel, states, changes );
+    
+    bool visible = isinf ( maxSunAlt );
+    pass.shadows.clear();
+    pass.shadows.push_back ( { pass.rising.time, (double) states[0] } );
+    for ( int i = 0; i < 3; i++ )
+        if ( states[i] != SSEvent::kUmbra && points[i].sunAlt < maxSunAlt )
+            visible = true;
+    
+    for ( SSEventTime &change : changes )
+    {
+        int i = change.time.jd < jds[1] ? 0 : 1;
+        double f = ( change.time.jd - jds[i] ) / ( jds[i + 1] - jds[i] );
+        double sunAlt = points[i].sunAlt + ( points[i + 1].sunAlt - points[i].sunAlt ) * f;
+        if ( change.value != SSEvent::kUmbra && sunAlt < maxSunAlt )
+            visible = true;
         
-        pass.transit.time = transits[0].time;
-        pass.transit.azm = transitCoords.lon;
-        pass.transit.alt = transitCoords.lat;
+        change.time.zone = zone;
+        pass.shadows.push_back ( change );
+    }
+    
+    return visible;
+}
 
-        pass.setting.time = settings[0].time;
-        pass.setting.azm = settingCoords.lon;
-        pass.setting.alt = settingCoords.lat;
+// Searches for satellite passes, as findSatellitePasses() does, but only for risings inside time windows (windows)
+// between start and stop, and appends them to (passes) until it holds (maxPasses). Modifies coords and pSat.
 
-        // Save and add to pass vector.  Quit if we've saved max desired number of passes.
-        // Otherwise start search for next satellite rising when satellite sets in current pass.
+static void find_passes_in_windows ( SSCoordinates &coords, SSObjectPtr pSat, SSTime start, SSTime stop, double minAlt, double maxSunAlt, const vector<SSTimeRange> &windows, vector<SSPass> &passes, int maxPasses )
+{
+    pass_point points[3];
+    
+    for ( size_t w = 0; w < windows.size() && passes.size() < maxPasses; w++ )
+    {
+        // Start the rising search one step before the window, so the satellite is below minAlt at its first step.
         
-        passes.push_back ( pass );
-        if ( passes.size() >= maxPasses )
-            break;
+        SSTime begin ( max ( start.jd, windows[w].start.jd - 1.0 / SSTime::kMinutesPerDay ), start.zone );
+        SSTime end ( min ( stop.jd, windows[w].stop.jd + 1.0 / SSTime::kMinutesPerDay ), start.zone );
         
-        start = pass.setting.time;
+        while ( begin < end )
+        {
+            // First search for the next satellite rising. Save satellite horizon coords at end of search. Quit if we find none.
+            
+            vector<SSEventTime> risings;
+            SSEvent::findEqualityEvents ( coords, pSat, nullptr, begin, end, 1.0 / SSTime::kMinutesPerDay, true, minAlt, object_altitude, risings, 1 );
+            SSSpherical risingCoords = coords.transform<kFundamental, kHorizon> ( pSat->getDirection() );
+            points[0] = pass_circumstances ( coords, pSat );
+            if ( risings.size() == 0 )
+                break;
+
+            // Now search for the next satellite setting, within 1 day after the rising time. Save satellite horizon coords at end of search. Quit if we find none.
+            
+            vector<SSEventTime> settings;
+            SSEvent::findEqualityEvents ( coords, pSat, nullptr, risings[0].time, risings[0].time + 1.0, 1.0 / SSTime::kMinutesPerDay, false, minAlt, object_altitude, settings, 1 );
+            SSSpherical settingCoords = coords.transform<kFundamental, kHorizon> ( pSat->getDirection() );
+            points[2] = pass_circumstances ( coords, pSat );
+            if ( settings.size() == 0 )
+                break;
+            
+            // Finally search for the next transit time after rising but before setting. Save satellite horizon coords at end of search. Quit if we find none.
+            
+            vector<SSEventTime> transits;
+            SSEvent::findEvents ( coords, pSat, nullptr, risings[0].time, settings[0].time, ( settings[0].time - risings[0].time ) / 10.0, false, minAlt, object_altitude, transits, 1 );
+            SSSpherical transitCoords = coords.transform<kFundamental, kHorizon> ( pSat->getDirection() );
+            points[1] = pass_circumstances ( coords, pSat );
+            if ( transits.size() == 0.0 )
+                break;
+            
+            // We found a complete pass!
+            
+            SSPass pass;
+            
+            pass.rising.time = risings[0].time;
+            pass.rising.azm = risingCoords.lon;
+            pass.rising.alt = risingCoords.lat;
+            
+            pass.transit.time = transits[0].time;
+            pass.transit.azm = transitCoords.lon;
+            pass.transit.alt = transitCoords.lat;
+
+            pass.setting.time = settings[0].time;
+            pass.setting.azm = settingCoords.lon;
+            pass.setting.alt = settingCoords.lat;
+
+            // Save and add to pass vector, unless it is not visible.  Quit if we've saved max desired number of passes.
+            // Otherwise start search for next satellite rising when satellite sets in current pass;
+            // skip any windows which that pass covered.
+            
+            if ( pass_shadows ( points, start.zone, maxSunAlt, pass ) )
+            {
+                passes.push_back ( pass );
+                if ( passes.size() >= maxPasses )
+                    break;
+            }
+            
+            begin = pass.setting.time;
+            while ( w + 1 < windows.size() && windows[w + 1].stop <= begin )
+                w++;
+        }
     }
+}
+
+// Searches for satellite passes seen from a location (coords) between two Julian dates (start to stop).
+// Passes start when satellite's apparent altitude rises above a minimum threshold (minAlt) in radians;
+// passes end when satellite's elevation falls below that threshold.  Peak elevation and time thereof are
+// also recorded in each pass's transit struct. The method returns the total number of passes found, and
+// returns all pass circumstances in the vector of SSPass structs.  The function also stops searching when
+// it finds the maximum number of passes (maxPasses).
+// Risings are only searched for, at 1-minute steps, inside the windows from findSatellitePassWindows().
+// Each pass's changes in the satellite's Earth shadow state are recorded in its shadows vector.
+// If the Sun's maximum altitude (maxSunAlt) is not infinite, only visible passes are returned: those in which
+// the satellite is sunlit, or in the penumbra, at rising, transit, setting, or a shadow change time,
+// while the Sun is below that altitude at the observer's location.
+// After return, both coords and pObj will be restored to their original states.
+
+int SSEvent::findSatellitePasses ( SSCoordinates &coords, SSObjectPtr pSat, SSTime start, SSTime stop, double minAlt, vector<SSPass> &passes, int maxPasses, double maxSunAlt )
+{
+    SSTime  savetime = coords.getTime();
+    vector<SSTimeRange> windows;
+    
+    findSatellitePassWindows ( coords, pSat, start, stop, minAlt, windows );
+    find_passes_in_windows ( coords, pSat, start, stop, minAlt, maxSunAlt, windows, passes, maxPasses );
 
     // Reset original time and restore satellite's original ephemeris
     
@@ -494,3 +1336,333 @@ int SSEvent::findSatellitePasses ( SSCoordinates &coords, SSObjectPtr pSat, SSTi
 
     return (int) passes.size();
 }
+
+// Searches for passes of many satellites (satellites) seen from many geographic locations (locations) between two
+// Julian dates (start to stop), above a minimum altitude (minAlt), up to (maxPasses) per satellite and location.
+// The passes of satellite i seen from location j are returned in passes[ i * locations.size() + j ]; non-satellites
+// get no passes. Each satellite is sampled for pass screening only once, and those samples are shared by every location.
+// Satellites are divided among threads (threads; if zero or negative, one per processor core); each thread has its own
+// copy of the coordinates (coords) for every location, so threads share only read-only state. The coordinates object's
+// time, aberration, light time, etc. apply to all locations; it is not modified. Each satellite's ephemeris is restored
+// to the coordinates object's time on return. Passes are filtered for visibility (maxSunAlt) as in the single-
+// satellite findSatellitePasses(). Returns the total number of passes found.
+
+int SSEvent::findSatellitePasses ( SSCoordinates &coords, SSObjectVec &satellites, const vector<SSSpherical> &locations, SSTime start, SSTime stop, double minAlt, vector<vector<SSPass>> &passes, int maxPasses, int threads, double maxSunAlt )
+{
+    size_t nsats = satellites.size(), nlocs = locations.size();
+    
+    passes.clear();
+    passes.resize ( nsats * nlocs );
+    if ( nsats == 0 || nlocs == 0 )
+        return 0;
+    
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+#endif
+    threads = (int) min ( (size_t) max ( threads, 1 ), nsats );
+    
+    // Satellites are interleaved between threads, so each gets a similar mix of short and long searches.
+    
+    auto work = [&] ( int t )
+    {
+        vector<SSCoordinates> locCoords ( nlocs, coords );
+        for ( size_t j = 0; j < nlocs; j++ )
+            locCoords[j].setLocation ( locations[j] );
+        
+        SSCoordinates restore ( coords );
+        pass_samples samples;
+        vector<SSTimeRange> windows;
+        
+        for ( size_t i = t; i < nsats; i += threads )
+        {
+            SSObjectPtr pSat = satellites.get ( i );
+            if ( SSGetSatellitePtr ( pSat ) == nullptr )
+                continue;
+            
+            bool screen = sample_passes ( pSat, start, stop, minAlt, samples );
+            for ( size_t j = 0; j < nlocs; j++ )
+            {
+                if ( screen )
+                    screen_passes ( samples, locations[j], minAlt, start.zone, windows );
+                else
+                    windows.assign ( 1, { start, stop } );
+                
+                find_passes_in_windows ( locCoords[j], pSat, start, stop, minAlt, maxSunAlt, windows, passes[ i * nlocs + j ], maxPasses );
+            }
+            
+            pSat->computeEphemeris ( restore );
+        }
+    };
+    
+#if USE_THREADS
+    vector<thread> workers;
+    for ( int t = 1; t < threads; t++ )
+        workers.push_back ( thread ( work, t ) );
+    
+    work ( 0 );
+    
+    for ( thread &worker : workers )
+        worker.join();
+#else
+    for ( int t = 0; t < threads; t++ )
+        work ( t );
+#endif
+    
+    int total = 0;
+    for ( vector<SSPass> &list : passes )
+        total += (int) list.size();
+    
+    return total;
+}
+
+// Relative position and velocity (km, km/sec) of two satellites in a conjunction search, when propagated
+// with their own SSTLE copies (tle1, tle2) to civil Julian Date (jd). Returns false if either cannot be propagated.
+
+static bool conjunction_relative ( SSTLE &tle1, SSTLE &tle2, double jd, SSVector &dpos, SSVector &dvel )
+{
+    SSVector pos1, vel1, pos2, vel2;
+    
+    tle1.toPositionVelocity ( jd, pos1, vel1 );
+    tle2.toPositionVelocity ( jd, pos2, vel2 );
+    dpos = pos2 - pos1;
+    dvel = vel2 - vel1;
+    return ! ( dpos.isnan() || dvel.isnan() );
+}
+
+// Refines a candidate close approach between satellites i and j within a search interval (jd0 to jd1)
+// by bracketing the root of their range rate, using false position (Illinois variant) to about 1 millisecond.
+// The closest approach is found only if range rate changes sign from negative to positive inside the interval;
+// if found, it is returned in (conj) and the function returns true. TLE copies are kept in (cache).
+
+static bool refine_conjunction ( SSTLEArray &tles, size_t i, size_t j, double jd0, double jd1, unordered_map<size_t,SSTLE> &cache, SSConjunction &conj )
+{
+    if ( cache.find ( i ) == cache.end() )
+        cache[i] = tles.get ( i );
+    if ( cache.find ( j ) == cache.end() )
+        cache[j] = tles.get ( j );
+    
+    SSTLE &tle1 = cache[i], &tle2 = cache[j];
+    SSVector dpos, dvel;
+    
+    if ( ! conjunction_relative ( tle1, tle2, jd0, dpos, dvel ) )
+        return false;
+    double f0 = dpos * dvel;
+    
+    if ( ! conjunction_relative ( tle1, tle2, jd1, dpos, dvel ) )
+        return false;
+    double f1 = dpos * dvel;
+    
+    if ( f0 >= 0.0 || f1 < 0.0 )
+        return false;
+    
+    double jd = jd0;
+    int side = 0;
+    
+    for ( int k = 0; k < 50 && jd1 - jd0 > 1.0e-3 / SSTime::kSecondsPerDay; k++ )
+    {
+        jd = ( jd0 * f1 - jd1 * f0 ) / ( f1 - f0 );
+        if ( ! conjunction_relative ( tle1, tle2, jd, dpos, dvel ) )
+            return false;
+        
+        double f = dpos * dvel;
+        if ( f < 0.0 )
+        {
+            jd0 = jd;
+            f0 = f;
+            if ( side == -1 )
+                f1 /= 2.0;
+            side = -1;
+        }
+        else
+        {
+            jd1 = jd;
+            f1 = f;
+            if ( side == 1 )
+                f0 /= 2.0;
+            side = 1;
+        }
+    }
+    
+    conjunction_relative ( tle1, tle2, jd, dpos, dvel );
+    conj.sat1 = i;
+    conj.sat2 = j;
+    conj.time = SSTime ( jd );
+    conj.distance = dpos.magnitude();
+    conj.speed = dvel.magnitude();
+    return true;
+}
+
+// Finds close approaches between all pairs of satellites in a TLE array (tles) between two civil Julian Dates
+// (start to stop) where the satellites come within a maximum distance (maxDist, km) of each other.
+// All satellites are propagated together at coarse time steps (step, seconds). At each step, they are bucketed
+// in a spatial hash with cells large enough that any pair which can close to maxDist within half a step
+// lies in adjacent cells; pairs whose perigee and apogee distances cannot overlap are skipped. Candidate pairs
+// whose straight-line relative motion, plus a margin for gravity, comes within maxDist during the half step
+// around the sample are then refined by bracketing their root of range rate to the time of closest approach,
+// as findNearestDistances() does for other objects. The time range is split into slabs searched on separate threads
+// (threads; if zero or negative, one per processor core). Results are returned in (conjunctions), in time order;
+// each pair appears once per close approach. Returns number of conjunctions found.
+
+int SSEvent::findSatelliteConjunctions ( SSTLEArray &tles, SSTime start, SSTime stop, double maxDist, vector<SSConjunction> &conjunctions, double step, int threads )
+{
+    size_t n = tles.size();
+    double stepDays = step / SSTime::kSecondsPerDay;
+    size_t nsteps = stop > start ? (size_t) ceil ( ( stop - start ) / stepDays ) + 1 : 0;
+    
+    conjunctions.clear();
+    if ( n < 2 || nsteps == 0 || step <= 0.0 )
+        return 0;
+    
+    // Propagate once on this thread, so the array's shared initialization is done before other threads use it.
+    // Get perigee and apogee distances from the mean elements, widened to allow for perturbations,
+    // and the fastest satellite speed, which sizes the spatial hash cell.
+    
+    vector<SSVector> pos0, vel0;
+    tles.toPositionVelocity ( start.jd, pos0, vel0 );
+    
+    vector<double> perigee ( n ), apogee ( n );
+    double vmax = 0.0;
+    for ( size_t k = 0; k < n; k++ )
+    {
+        const SSTLE &tle = tles.get ( k );
+        double xno = tle.xno / 60.0;
+        double a = pow ( kEarthGM / ( xno * xno ), 1.0 / 3.0 );
+        perigee[k] = a * ( 1.0 - tle.eo ) * 0.98 - maxDist;
+        apogee[k] = a * ( 1.0 + tle.eo ) * 1.02 + maxDist;
+        double v = sqrt ( kEarthGM * ( 2.0 / max ( perigee[k] + maxDist, kEarthPolarRadius ) - 1.0 / a ) );
+        if ( isfinite ( v ) )
+            vmax = max ( vmax, v );
+    }
+    
+    double half = step / 2.0;
+    double gravity = kEarthGM / ( kEarthPolarRadius * kEarthPolarRadius );
+    double margin = maxDist + gravity * half * half;
+    double cell = margin + vmax * step;
+    
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+#endif
+    threads = (int) min ( (size_t) max ( threads, 1 ), nsteps );
+    vector<vector<SSConjunction>> found ( threads );
+    const uint64_t kCellMax = 2097151;      // largest 21-bit cell index
+    
+    auto work = [&] ( int t )
+    {
+        size_t s0 = nsteps * t / threads, s1 = nsteps * ( t + 1 ) / threads;
+        vector<SSVector> pos, vel;
+        vector<pair<uint64_t,uint32_t>> keys;
+        unordered_map<uint64_t,pair<size_t,size_t>> cells;
+        unordered_map<size_t,SSTLE> cache;
+        
+        for ( size_t s = s0; s < s1; s++ )
+        {
+            double jd = min ( start.jd + s * stepDays, stop.jd );
+            double jd0 = max ( start.jd, jd - stepDays / 2.0 ), jd1 = min ( stop.jd, jd + stepDays / 2.0 );
+            tles.toPositionVelocity ( jd, pos, vel );
+            
+            // Hash each satellite's position into a cell; cell indices are offset to be non-negative, 21 bits each.
+            
+            keys.clear();
+            for ( uint32_t k = 0; k < n; k++ )
+            {
+                if ( pos[k].isnan() )
+                    continue;
+                
+                uint64_t ix = (uint64_t) min ( max ( floor ( pos[k].x / cell ) + 1048576.0, 0.0 ), (double) kCellMax );
+                uint64_t iy = (uint64_t) min ( max ( floor ( pos[k].y / cell ) + 1048576.0, 0.0 ), (double) kCellMax );
+                uint64_t iz = (uint64_t) min ( max ( floor ( pos[k].z / cell ) + 1048576.0, 0.0 ), (double) kCellMax );
+                keys.push_back ( { ( ix << 42 ) | ( iy << 21 ) | iz, k } );
+            }
+            
+            sort ( keys.begin(), keys.end() );
+            cells.clear();
+            for ( size_t k0 = 0, k1 = 0; k0 < keys.size(); k0 = k1 )
+            {
+                for ( k1 = k0 + 1; k1 < keys.size() && keys[k1].first == keys[k0].first; k1++ )
+                    ;
+                cells[ keys[k0].first ] = { k0, k1 };
+            }
+            
+            // Each cell is paired with itself and the 13 neighbors "after" it, so each pair of cells is visited once.
+            // Neighbor keys are packed from the unpacked cell indices, skipping neighbors outside the 21-bit range.
+            
+            for ( auto &entry : cells )
+            {
+                uint64_t key = entry.first;
+                uint64_t ix = key >> 42, iy = ( key >> 21 ) & kCellMax, iz = key & kCellMax;
+                for ( int dx = 0; dx <= 1; dx++ )
+                    for ( int dy = dx ? -1 : 0; dy <= 1; dy++ )
+                        for ( int dz = dx || dy ? -1 : 0; dz <= 1; dz++ )
+                        {
+                            if ( ( dx > 0 && ix == kCellMax ) || ( dy < 0 && iy == 0 ) || ( dy > 0 && iy == kCellMax ) || ( dz < 0 && iz == 0 ) || ( dz > 0 && iz == kCellMax ) )
+                                continue;
+                            
+                            uint64_t nx = ix + dx, ny = dy < 0 ? iy - 1 : iy + dy, nz = dz < 0 ? iz - 1 : iz + dz;
+                            uint64_t other = ( nx << 42 ) | ( ny << 21 ) | nz;
+                            auto it = cells.find ( other );
+                            if ( it == cells.end() )
+                                continue;
+                            
+                            bool same = other == key;
+                            for ( size_t a = entry.second.first; a < entry.second.second; a++ )
+                                for ( size_t b = same ? a + 1 : it->second.first; b < it->second.second; b++ )
+                                {
+                                    size_t i = keys[a].second, j = keys[b].second;
+                                    if ( perigee[i] > apogee[j] || perigee[j] > apogee[i] )
+                                        continue;
+                                    
+                                    // Straight-line closest approach within the half step around this sample.
+                                    
+                                    SSVector dpos = pos[j] - pos[i], dvel = vel[j] - vel[i];
+                                    double v2 = dvel * dvel;
+                                    double tca = v2 > 0.0 ? min ( max ( -( dpos * dvel ) / v2, -half ), half ) : 0.0;
+                                    if ( ( dpos + dvel * tca ).magnitude() > margin )
+                                        continue;
+                                    
+                                    SSConjunction conj;
+                                    if ( refine_conjunction ( tles, min ( i, j ), max ( i, j ), jd0, jd1, cache, conj ) && conj.distance <= maxDist )
+                                    {
+                                        conj.time.zone = start.zone;
+                                        found[t].push_back ( conj );
+                                    }
+                                }
+                        }
+            }
+        }
+    };
+    
+#if USE_THREADS
+    vector<thread> workers;
+    for ( int t = 1; t < threads; t++ )
+        workers.push_back ( thread ( work, t ) );
+    
+    work ( 0 );
+    
+    for ( thread &worker : workers )
+        worker.join();
+#else
+    for ( int t = 0; t < threads; t++ )
+        work ( t );
+#endif
+    
+    // Merge slabs. A closest approach on the boundary between two sample intervals can be found in both; keep one.
+    
+    for ( vector<SSConjunction> &list : found )
+        conjunctions.insert ( conjunctions.end(), list.begin(), list.end() );
+    
+    sort ( conjunctions.begin(), conjunctions.end(), [] ( const SSConjunction &c1, const SSConjunction &c2 )
+    {
+        return c1.sat1 != c2.sat1 ? c1.sat1 < c2.sat1 : c1.sat2 != c2.sat2 ? c1.sat2 < c2.sat2 : c1.time.jd < c2.time.jd;
+    } );
+    
+    size_t m = 0;
+    for ( size_t k = 0; k < conjunctions.size(); k++ )
+        if ( m == 0 || conjunctions[k].sat1 != conjunctions[m - 1].sat1 || conjunctions[k].sat2 != conjunctions[m - 1].sat2 || conjunctions[k].time.jd - conjunctions[m - 1].time.jd > 1.0 / SSTime::kSecondsPerDay )
+            conjunctions[m++] = conjunctions[k];
+    conjunctions.resize ( m );
+    
+    sort ( conjunctions.begin(), conjunctions.end(), [] ( const SSConjunction &c1, const SSConjunction &c2 ) { return c1.time.jd < c2.time.jd; } );
+    return (int) m;
+}
@@ -23,6 +23,14 @@ struct SSRTS
     SSAngle alt;    // object's altitude at the time of the event [radians]
 };
 
+// Describes circumstances of a generic event: conjunction, opposition, etc.
+
+struct SSEventTime
+{
+    SSTime time;        // time of event
+    double value;       // value at time of event (angular distance in radiams, or physical distance in AU, etc.)
+};
+
 // Describes a complete overhead pass of an object across the sky; from rising, through transit, to setting.
 
 struct SSPass
@@ -30,16 +38,38 @@ struct SSPass
     SSRTS rising;       // circumstances of rising event
     SSRTS transit;      // circumstances of transit event
     SSRTS setting;      // circumstances of setting event
+    vector<SSEventTime> shadows;    // satellite's Earth shadow state at rising, then each change in it; not computed by riseTransitSet()
 };
 
-// Describes circumstances of a generic event: conjunction, opposition, etc.
+// Describes an interval of time, from start to stop.
 
-struct SSEventTime
+struct SSTimeRange
 {
-    SSTime time;        // time of event
-    double value;       // value at time of event (angular distance in radiams, or physical distance in AU, etc.)
+    SSTime start;       // start of interval
+    SSTime stop;        // end of interval
+};
+
+// Describes a close approach between two satellites in an SSTLEArray.
+
+struct SSConjunction
+{
+    size_t sat1, sat2;  // indices of the two satellites in the TLE array; sat1 < sat2
+    SSTime time;        // time of closest approach
+    double distance;    // distance between satellites at closest approach [km]
+    double speed;       // relative speed of satellites at closest approach [km/sec]
 };
 
+// Describes a close apparent approach between two objects in an SSObjectVec, found by the group conjunction search.
+
+struct SSObjectConjunction
+{
+    size_t obj1, obj2;  // indices of the two objects in the object array; obj1 < obj2
+    SSTime time;        // time of least angular separation
+    double separation;  // angular separation at that time [radians]
+};
+
+class SSTLEArray;
+
 // Pointer to generic event-finding function
 
 typedef double (*SSEventFunc) ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2 );
@@ -58,6 +88,10 @@ public:
     static constexpr double kSunNauticalDawnDuskAlt = -12.0 / SSAngle::kDegPerRad;      // geometric altitude of Sun's apparent disk center at nautical dawn/dusk [radians]
     static constexpr double kSunAstronomicalDawnDuskAlt = -18.0 / SSAngle::kDegPerRad;  // geometric altitude of Sun's apparent disk center at astronomical dawn/dusk [radians]
 
+    static const int kSunlit = 0;       // satellite Earth shadow state: in full sunlight
+    static const int kPenumbra = 1;     // satellite Earth shadow state: in Earth's penumbra, partly sunlit
+    static const int kUmbra = 2;        // satellite Earth shadow state: in Earth's umbra, eclipsed
+
     static constexpr double kNewMoon = 0.0;                                             // Moon's ecliptic longitude offset from Sun when at new moon [radians]
     static constexpr double kFirstQuarterMoon = SSAngle::kHalfPi;                       // Moon's ecliptic longitude offset from Sun when at first quarter [radians]
     static constexpr double kFullMoon = SSAngle::kPi;                                   // Moon's ecliptic longitude offset from Sun when at full moon [radians]
@@ -71,16 +105,195 @@ public:
     static SSTime riseTransitSetSearchDay ( SSTime today, SSCoordinates &coords, SSObjectPtr pObj, int sign, SSAngle alt );
 
     static SSPass riseTransitSet ( SSTime today, SSCoordinates &coords, SSObjectPtr pObj, SSAngle alt );
-    static int findSatellitePasses ( SSCoordinates &coords, SSObjectPtr pSat, SSTime start, SSTime stop, double minAlt, vector<SSPass> &passes, int maxPasses );
+    static int riseTransitSet ( SSTime today, SSCoordinates &coords, SSObjectVec &objects, SSAngle alt, SSAngle sunMoonAlt, vector<SSPass> &passes, int threads = 1 );
+    static int findSatellitePasses ( SSCoordinates &coords, SSObjectPtr pSat, SSTime start, SSTime stop, double minAlt, vector<SSPass> &passes, int maxPasses, double maxSunAlt = INFINITY );
+    static int findSatellitePassWindows ( SSCoordinates &coords, SSObjectPtr pSat, SSTime start, SSTime stop, double minAlt, vector<SSTimeRange> &windows );
+    static int findSatellitePasses ( SSCoordinates &coords, SSObjectVec &satellites, const vector<SSSpherical> &locations, SSTime start, SSTime stop, double minAlt, vector<vector<SSPass>> &passes, int maxPasses, int threads = 1, double maxSunAlt = INFINITY );
+
+    static int satelliteShadow ( SSVector satPos, SSVector sunPos );
+    static void sunPositions ( const vector<double> &jds, vector<SSVector> &sunPos );
+    static int findSatelliteShadows ( const vector<double> &jds, const vector<SSVector> &sunPos, const vector<SSVector> &satPos, const vector<SSVector> &satVel, vector<int> &states, vector<SSEventTime> &changes );
+    static int findSatelliteConjunctions ( SSTLEArray &tles, SSTime start, SSTime stop, double maxDist, vector<SSConjunction> &conjunctions, double step = 60.0, int threads = 1 );
 
     static SSTime nextMoonPhase ( SSTime time, SSObjectPtr pSun, SSObjectPtr pMoon, double phase );
     
+    // Chooses how findEvents() and findEqualityEvents() refine an event bracketed by their search step. By default they search
+    // the bracket again with a step 10 times smaller, down to one second. With root finding, they refine it with Brent's method
+    // (extrema) or the Illinois method (equalities) until the event time is known within (timeTol) seconds, or the value changes
+    // by less than (valueTol), if nonzero; this takes several times fewer ephemeris computations. Set before searching.
+    
+    static void useRootFinding ( bool use, double timeTol = 1.0, double valueTol = 0.0 );
+    static bool useRootFinding ( void );
+    
     static void findEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, double step, bool max, double limit, SSEventFunc func, vector<SSEventTime> &events, int maxEvents );
     static void findEqualityEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, double step, bool max, double value, SSEventFunc func, vector<SSEventTime> &events, int maxEvents );
-    static void findConjunctions ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents );
-    static void findOppositions ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents );
-    static void findNearestDistances ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents );
-    static void findFarthestDistances ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents );
+    
+    // Parallel versions of findEvents() and findEqualityEvents(). The search steps from (start) to (stop) are split into
+    // consecutive slabs searched on separate threads (threads; if zero or negative, one per processor core), each with its
+    // own copies of the coordinates and objects, so (coords, pObj1, pObj2) are not modified. Slabs overlap by the samples
+    // needed to bracket an event at their boundaries, and events found twice at a boundary are merged. The events appended
+    // to (events) are the same, in the same order, as the single-threaded search, up to (maxEvents). With one thread,
+    // this calls the single-threaded search directly, which modifies the coordinates and objects.
+    
+    static void findEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, double step, bool max, double limit, SSEventFunc func, vector<SSEventTime> &events, int maxEvents, int threads );
+    static void findEqualityEvents ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, double step, bool max, double value, SSEventFunc func, vector<SSEventTime> &events, int maxEvents, int threads );
+    
+    static void findConjunctions ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents, int threads = 1 );
+    static void findOppositions ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents, int threads = 1 );
+    static void findNearestDistances ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents, int threads = 1 );
+    static void findFarthestDistances ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2, SSTime start, SSTime stop, vector<SSEventTime> &events, int maxEvents, int threads = 1 );
+    
+    // Finds all conjunctions closer than (maxSep) radians between pairs of objects in an array (objects), from (start) to (stop),
+    // and appends them to (conjunctions) in time order. Each object's apparent position is computed once per search step (step,
+    // in days). Pairs which can come within (maxSep) of each other within a step are found by sweeping the objects' ecliptic
+    // longitudes, widened by how far each object moves in a step, so only those pairs are refined, by Brent's method.
+    // Pairs of objects which are not solar system objects are skipped. As with findEvents(), a minimum must be bracketed
+    // by the search steps, so (step) should be a small fraction of the shortest interval between conjunctions of a pair;
+    // one day is good for the Sun, Moon, and planets. The coordinates and objects' positions are modified!
+    // Returns the number of conjunctions found.
+    
+    static int findConjunctions ( SSCoordinates &coords, SSObjectVec &objects, SSTime start, SSTime stop, double maxSep, vector<SSObjectConjunction> &conjunctions, double step = 1.0 );
+    
+    // Root-finding helpers used by the event searches, and available to other event engines; see below.
+    
+    template<class F> static double brentMinimum ( F f, double a, double b, double x, double &fx, double tol, double vtol = 0.0 );
+    template<class F> static double illinoisRoot ( F f, double a, double b, double fa, double &fb, double tol, double vtol = 0.0 );
 };
 
+// Finds the minimum of a function (f) of time bracketed between times (a) and (b), with a time (x) between them whose
+// value (fx) is lower than at either end, by Brent's method: parabolic interpolation through the three lowest points,
+// with golden section steps when that fails to converge. Times are offsets from (a), in days, to keep full precision.
+// Stops when the minimum is within (tol) days, or the lowest value changes by less than (vtol), if nonzero.
+// Returns the time of the minimum; its value is returned in (fx).
+
+template<class F> double SSEvent::brentMinimum ( F f, double a, double b, double x, double &fx, double tol, double vtol )
+{
+    static constexpr double kGolden = 0.3819660112501051;
+    double t0 = a;
+    
+    b -= t0;
+    x -= t0;
+    a = 0.0;
+    
+    double v = x, w = x, fv = fx, fw = fx;
+    double d = 0.0, e = 0.0;
+    double tol1 = tol / 2.0, tol2 = tol;
+    
+    for ( int iter = 0; iter < 100; iter++ )
+    {
+        double xm = ( a + b ) / 2.0;
+        if ( fabs ( x - xm ) <= tol2 - ( b - a ) / 2.0 )
+            break;
+        
+        if ( fabs ( e ) > tol1 )
+        {
+            double r = ( x - w ) * ( fx - fv );
+            double q = ( x - v ) * ( fx - fw );
+            double p = ( x - v ) * q - ( x - w ) * r;
+            q = 2.0 * ( q - r );
+            if ( q > 0.0 )
+                p = -p;
+            q = fabs ( q );
+            double etemp = e;
+            e = d;
+            if ( fabs ( p ) >= fabs ( q * etemp / 2.0 ) || p <= q * ( a - x ) || p >= q * ( b - x ) )
+            {
+                e = x >= xm ? a - x : b - x;
+                d = kGolden * e;
+            }
+            else
+            {
+                d = p / q;
+                double u = x + d;
+                if ( u - a < tol2 || b - u < tol2 )
+                    d = xm - x >= 0.0 ? tol1 : -tol1;
+            }
+        }
+        else
+        {
+            e = x >= xm ? a - x : b - x;
+            d = kGolden * e;
+        }
+        
+        double u = fabs ( d ) >= tol1 ? x + d : x + ( d >= 0.0 ? tol1 : -tol1 );
+        double fu = f ( t0 + u );
+        double fbest = fx;
+        
+        if ( fu <= fx )
+        {
+            if ( u >= x )
+                a = x;
+            else
+                b = x;
+            v = w; fv = fw;
+            w = x; fw = fx;
+            x = u; fx = fu;
+        }
+        else
+        {
+            if ( u < x )
+                a = u;
+            else
+                b = u;
+            if ( fu <= fw || w == x )
+            {
+                v = w; fv = fw;
+                w = u; fw = fu;
+            }
+            else if ( fu <= fv || v == x || v == w )
+            {
+                v = u; fv = fu;
+            }
+        }
+        
+        if ( vtol > 0.0 && fabs ( fbest - fu ) < vtol )
+            break;
+    }
+    
+    return t0 + x;
+}
+
+// Finds the time where a function (f) of time reaches a target value, bracketed between times (a), where it has not yet
+// reached the target, and (b), where it has, by the Illinois variant of the secant (regula falsi) method. Values (fa, fb)
+// at those times are relative to the target. Trial times are kept at least (tol) / 2 days inside the bracket, so it shrinks
+// below (tol) days. Stops then, or when a value is within (vtol) of the target, if nonzero. Returns the earliest time
+// found where the target was reached; its value relative to the target is returned in (fb).
+
+template<class F> double SSEvent::illinoisRoot ( F f, double a, double b, double fa, double &fb, double tol, double vtol )
+{
+    double t0 = a;
+    b -= t0;
+    a = 0.0;
+    
+    int side = 0;
+    for ( int iter = 0; iter < 100 && b - a > tol; iter++ )
+    {
+        double c = fb != fa ? ( a * fb - b * fa ) / ( fb - fa ) : ( a + b ) / 2.0;
+        c = ::max ( a + tol / 2.0, ::min ( c, b - tol / 2.0 ) );
+        double fc = f ( t0 + c );
+        
+        if ( fc == 0.0 || ( fc > 0.0 ) == ( fb > 0.0 ) )
+        {
+            b = c;
+            fb = fc;
+            if ( side == 1 )
+                fa /= 2.0;
+            side = 1;
+        }
+        else
+        {
+            a = c;
+            fa = fc;
+            if ( side == -1 )
+                fb /= 2.0;
+            side = -1;
+        }
+        
+        if ( vtol > 0.0 && fabs ( fc ) < vtol && b == c )
+            break;
+    }
+    
+    return t0 + b;
+}
+
 #endif /* SSEvent_hpp */
@@ -0,0 +1,223 @@
+// SSEventCache.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <cmath>
+
+#include "SSEventCache.hpp"
+
+// Constructs a cache whose results are good to about (precision) seconds, holding up to (maxEntries) results.
+
+SSEventCache::SSEventCache ( double precision, size_t maxEntries )
+{
+    _precision = precision > 0.0 ? precision : kDefaultPrecision;
+    _cell = _precision / SSTime::kSecondsPerDay * SSAngle::kTwoPi;
+    _maxEntries = maxEntries;
+    _hits = _misses = _rejects = 0;
+}
+
+// Builds the cache key for an object (pObj) on a local day (today) at the location in (coords),
+// with rising and setting altitude (alt). Longitude cells are not narrowed toward the poles, because
+// event times shift with the angle Earth turns through, not with distance along the ground.
+
+SSEventCache::Key SSEventCache::makeKey ( SSTime today, SSCoordinates &coords, SSObjectPtr pObj, SSAngle alt )
+{
+    Key key;
+    SSSpherical loc = coords.getLocation();
+
+    key.ident = pObj->getIdentifier ( 0 );
+    key.name = key.ident ? "" : pObj->getName ( 0 );
+    key.day = llround ( today.getLocalMidnight().jd * SSTime::kSecondsPerDay );
+    key.alt = llround ( alt * SSAngle::kArcsecPerRad );
+    key.lon = (int64_t) floor ( mod2pi ( loc.lon ) / _cell );
+    key.lat = (int64_t) floor ( loc.lat / _cell );
+    return key;
+}
+
+// Computes an object's (pObj) pass on a local day (today) at the location in (coords), with rising and setting altitude
+// (alt), exactly as SSEvent::riseTransitSet() does, and also returns the object's apparent equatorial coordinates of date
+// at each event in (equ), or infinity where there is no event. After return, coords and pObj are restored.
+
+SSPass SSEventCache::compute ( SSTime today, SSCoordinates &coords, SSObjectPtr pObj, SSAngle alt, SSSpherical equ[3] )
+{
+    SSTime savetime = coords.getTime();
+    SSPass pass = { 0.0 };
+    SSRTS *events[3] = { &pass.rising, &pass.transit, &pass.setting };
+    int signs[3] = { SSEvent::kRise, SSEvent::kTransit, SSEvent::kSet };
+
+    for ( int e = 0; e < 3; e++ )
+    {
+        SSRTS &rts = *events[e];
+        equ[e] = SSSpherical ( INFINITY, INFINITY, INFINITY );
+        rts.time = SSEvent::riseTransitSetSearchDay ( today, coords, pObj, signs[e], e == 1 ? SSAngle ( 0.0 ) : alt );
+        if ( ! ::isinf ( rts.time ) )
+        {
+            SSSpherical hor = coords.transform<kFundamental, kHorizon> ( pObj->getDirection() );
+            rts.azm = hor.lon;
+            rts.alt = hor.lat;
+            equ[e] = coords.transform<kFundamental, kEquatorial> ( pObj->getDirection() );
+        }
+    }
+
+    coords.setTime ( savetime );
+    pObj->computeEphemeris ( coords );
+    return pass;
+}
+
+// Rechecks a pass cached for another location (entry) against a location (location), in closed form from the object's
+// equatorial coordinates at each cached event. Events which exist are kept if they move by no more than the precision,
+// and stay on the same local day (today); events which do not exist are kept if the object still does not rise or set
+// at transit, or does so well outside that day. Returns the rechecked times, azimuths, and altitudes in (pass), and
+// returns true if every event was kept. The object's motion in less than the precision is negligible.
+
+bool SSEventCache::recheck ( SSTime today, SSSpherical location, SSAngle alt, const Entry &entry, SSPass &pass )
+{
+    double start = today.getLocalMidnight().jd, end = start + 1.0;
+    double precision = _precision / SSTime::kSecondsPerDay;
+    double sinlat = sin ( location.lat ), coslat = cos ( location.lat );
+    const SSRTS *cached[3] = { &entry.pass.rising, &entry.pass.transit, &entry.pass.setting };
+    SSRTS *events[3] = { &pass.rising, &pass.transit, &pass.setting };
+    int signs[3] = { SSEvent::kRise, SSEvent::kTransit, SSEvent::kSet };
+
+    pass = entry.pass;
+    for ( int e = 0; e < 3; e++ )
+    {
+        SSAngle h = e == 1 ? SSAngle ( 0.0 ) : alt;
+        if ( ::isinf ( cached[e]->time ) )
+        {
+            if ( ::isinf ( entry.pass.transit.time ) )
+                return false;
+
+            SSSpherical equ = entry.equ[1];
+            SSTime time = SSEvent::riseTransitSet ( entry.pass.transit.time, equ.lon, equ.lat, signs[e], location.lon, location.lat, h );
+            if ( ::isinf ( time ) ? time.jd != cached[e]->time.jd : time.jd > start - precision && time.jd < end + precision )
+                return false;
+        }
+        else
+        {
+            SSSpherical equ = entry.equ[e];
+            SSTime time = SSEvent::riseTransitSet ( cached[e]->time, equ.lon, equ.lat, signs[e], location.lon, location.lat, h );
+            if ( ::isinf ( time ) || fabs ( time.jd - cached[e]->time.jd ) > precision || time.jd < start || time.jd > end )
+                return false;
+
+            // Azimuth and altitude from hour angle and declination, as SSEvent computes them for fixed objects.
+
+            double ha = time.getSiderealTime ( location.lon ) - equ.lon;
+            double sindec = sin ( equ.lat ), cosdec = cos ( equ.lat );
+            events[e]->time = time;
+            events[e]->azm = atan2pi ( -cosdec * sin ( ha ), sindec * coslat - cosdec * cos ( ha ) * sinlat );
+            events[e]->alt = asin ( sinlat * sindec + coslat * cosdec * cos ( ha ) );
+        }
+    }
+
+    return true;
+}
+
+// Removes least-recently-used results until no more than maxEntries remain.
+
+void SSEventCache::evictEntries ( size_t maxEntries )
+{
+    while ( _entries.size() > maxEntries && _lru.size() > 0 )
+    {
+        _entries.erase ( _lru.back() );
+        _lru.pop_back();
+    }
+}
+
+SSPass SSEventCache::riseTransitSet ( SSTime today, SSCoordinates &coords, SSObjectPtr pObj, SSAngle alt )
+{
+    Key key = makeKey ( today, coords, pObj, alt );
+    SSSpherical loc = coords.getLocation();
+    SSPass pass = { 0.0 };
+
+    {
+        lock_guard<mutex> lock ( _mutex );
+        map<Key,Entry>::iterator it = _entries.find ( key );
+        if ( it != _entries.end() )
+        {
+            _lru.splice ( _lru.begin(), _lru, it->second.lru );
+            if ( it->second.location == loc )
+            {
+                _hits++;
+                return it->second.pass;
+            }
+
+            if ( recheck ( today, loc, alt, it->second, pass ) )
+            {
+                _hits++;
+                return pass;
+            }
+
+            _rejects++;
+        }
+    }
+
+    // Compute the result outside the lock, then store it, replacing any for another location in the same cell.
+
+    Entry entry;
+    entry.pass = pass = compute ( today, coords, pObj, alt, entry.equ );
+    entry.location = loc;
+
+    lock_guard<mutex> lock ( _mutex );
+    _misses++;
+
+    map<Key,Entry>::iterator it = _entries.find ( key );
+    if ( it != _entries.end() )
+    {
+        entry.lru = it->second.lru;
+        it->second = entry;
+        _lru.splice ( _lru.begin(), _lru, entry.lru );
+    }
+    else if ( _maxEntries > 0 )
+    {
+        evictEntries ( _maxEntries - 1 );
+        _lru.push_front ( key );
+        entry.lru = _lru.begin();
+        _entries[key] = entry;
+    }
+
+    return pass;
+}
+
+// Removes all cached results and resets statistics.
+
+void SSEventCache::clear ( void )
+{
+    lock_guard<mutex> lock ( _mutex );
+    _entries.clear();
+    _lru.clear();
+    _hits = _misses = _rejects = 0;
+}
+
+// Changes event precision and cell size; clears the cache.
+
+void SSEventCache::setPrecision ( double precision )
+{
+    clear();
+    lock_guard<mutex> lock ( _mutex );
+    _precision = precision > 0.0 ? precision : kDefaultPrecision;
+    _cell = _precision / SSTime::kSecondsPerDay * SSAngle::kTwoPi;
+}
+
+// Changes maximum number of cached results; evicts least-recently-used results if needed.
+
+void SSEventCache::setMaxEntries ( size_t maxEntries )
+{
+    lock_guard<mutex> lock ( _mutex );
+    _maxEntries = maxEntries;
+    evictEntries ( _maxEntries );
+}
+
+size_t SSEventCache::size ( void )
+{
+    lock_guard<mutex> lock ( _mutex );
+    return _entries.size();
+}
+
+void SSEventCache::resetStatistics ( void )
+{
+    lock_guard<mutex> lock ( _mutex );
+    _hits = _misses = _rejects = 0;
+}
@@ -0,0 +1,108 @@
+// SSEventCache.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class caches rise, transit, and set results from SSEvent::riseTransitSet(), so requests for the same object
+// on the same local day from nearby locations don't each repeat the full iterative search. Results are keyed by the
+// object's first identifier (or its name, if it has none), the local day, the rise/set altitude, and a geodetic cell
+// containing the observer. Cells are sized so moving across one shifts an event by about the cache's precision.
+// Each cached result remembers the exact location it was computed for, and the object's equatorial coordinates at
+// each event. On a hit from another location in the same cell, every event is rechecked in closed form with
+// SSEvent::riseTransitSet() from those coordinates, without computing any ephemeris. If that moves an event by more
+// than the precision, as near the poles or for an object which only just rises, the result is recomputed in full;
+// this counts as a miss. Least recently used results are evicted when the cache is full. All cache operations are
+// serialized with a mutex, so one cache can be shared by many threads; each thread should pass its own coordinates
+// and object, as with SSEvent. All callers should use the same coordinate settings (refraction, aberration, and so on),
+// since those are not part of the key.
+
+#ifndef SSEventCache_hpp
+#define SSEventCache_hpp
+
+#include <map>
+#include <list>
+#include <mutex>
+
+#include "SSEvent.hpp"
+
+class SSEventCache
+{
+public:
+
+    static constexpr double kDefaultPrecision = 60.0;       // default event precision [seconds]
+    static constexpr size_t kDefaultMaxEntries = 4096;      // default maximum number of cached results
+
+protected:
+
+    // Cache key: object identifier (or name, if null), local midnight [seconds since JD 0],
+    // rise/set altitude [arcseconds], and observer's geodetic cell longitude and latitude indices.
+
+    struct Key
+    {
+        int64_t ident;
+        string name;
+        int64_t day;
+        int64_t alt;
+        int64_t lon, lat;
+
+        bool operator < ( const Key &other ) const
+        {
+            return tie ( ident, name, day, alt, lon, lat ) < tie ( other.ident, other.name, other.day, other.alt, other.lon, other.lat );
+        }
+    };
+
+    // One cached result, the exact location it was computed for, the object's apparent equatorial coordinates of date
+    // at each event (infinite if there is none), and its position in the least-recently-used list.
+
+    struct Entry
+    {
+        SSPass pass;
+        SSSpherical location;
+        SSSpherical equ[3];
+        list<Key>::iterator lru;
+    };
+
+    double _precision;                              // event precision [seconds]
+    double _cell;                                   // geodetic cell size [radians]
+    size_t _maxEntries;                             // maximum number of cached results
+    size_t _hits, _misses, _rejects;                // number of cache hits, misses, and hits rejected by recheck
+    map<Key,Entry> _entries;                        // cached results
+    list<Key> _lru;                                 // keys of cached results, most recently used first
+    mutex _mutex;                                   // protects everything above
+
+    Key makeKey ( SSTime today, SSCoordinates &coords, SSObjectPtr pObj, SSAngle alt );
+    bool recheck ( SSTime today, SSSpherical location, SSAngle alt, const Entry &entry, SSPass &pass );
+    SSPass compute ( SSTime today, SSCoordinates &coords, SSObjectPtr pObj, SSAngle alt, SSSpherical equ[3] );
+    void evictEntries ( size_t maxEntries );
+
+public:
+
+    SSEventCache ( double precision = kDefaultPrecision, size_t maxEntries = kDefaultMaxEntries );
+
+    // Returns the same result as SSEvent::riseTransitSet ( today, coords, pObj, alt ), from the cache if possible, with
+    // event times within about a tenth of the precision for the Moon, and less for slower objects. After return, coords
+    // and pObj are in their original states, as with SSEvent.
+
+    SSPass riseTransitSet ( SSTime today, SSCoordinates &coords, SSObjectPtr pObj, SSAngle alt );
+
+    void clear ( void );
+
+    // Sets event precision in seconds, which determines the cell size; clears the cache.
+
+    void setPrecision ( double precision );
+    double getPrecision ( void ) { return _precision; }
+
+    void setMaxEntries ( size_t maxEntries );
+    size_t getMaxEntries ( void ) { return _maxEntries; }
+    size_t size ( void );
+
+    // Cache statistics. Rejects are hits whose recheck failed and were recomputed; they are also counted as misses.
+
+    size_t getHits ( void ) { return _hits; }
+    size_t getMisses ( void ) { return _misses; }
+    size_t getRejects ( void ) { return _rejects; }
+    void resetStatistics ( void );
+};
+
+#endif /* SSEventCache_hpp */
@@ -15,7 +15,7 @@ SSFeature::SSFeature ( void ) : SSObject ( kTypeFeature )
 {
     // initialize SSObject::_names with two empty strings for UTF-8 name and ASCII/Clean name
     
-    _names = vector<string> ( { "", "" } );
+    _names = vector<SSIString> ( 2 );
     _target = "";
     _type_code = "";
     _origin = "";
@@ -46,11 +46,17 @@ SSObjectPtr SSFeature::fromCSV ( string csv )
     // split string into comma-delimited fields,
     // remove leading & trailing whitespace/line breaks from each field.
     
-    vector<string> fields = split_csv ( csv );
-    for ( int i = 0; i < fields.size(); i++ )
-        fields[i] = trim ( fields[i] );
-    
-    SSObjectType type = SSObject::codeToType ( fields[0] );
+    SSCSVFields fields;
+    fields.split ( csv );
+    return fromCSV ( fields );
+}
+
+// Allocates a new SSFeature and initializes it from a CSV-formatted string already split into fields.
+// Returns nullptr on error (invalid CSV fields, heap allocation failure, etc.)
+
+SSObjectPtr SSFeature::fromCSV ( const SSCSVFields &fields )
+{
+    SSObjectType type = SSObject::codeToType ( fields.str ( 0 ) );
     if ( type != kTypeFeature && type != kTypeCity )
         return nullptr;
     
@@ -73,17 +79,17 @@ SSObjectPtr SSFeature::fromCSV ( string csv )
     if ( pFeature == nullptr )
         return nullptr;
     
-    pFeature->setName ( fields[1] );
-    pFeature->setCleanName ( fields[2] );
+    pFeature->setName ( fields.str ( 1 ) );
+    pFeature->setCleanName ( fields.str ( 2 ) );
 
     if ( type == kTypeFeature )
     {
-        pFeature->setTarget ( fields[3] );
+        pFeature->setTarget ( fields.str ( 3 ) );
         pFeature->setDiameter ( strtofloat64 ( fields[4] ) );
         pFeature->setLatitude ( strtofloat64 ( fields[5] ) );
         pFeature->setLongitude ( strtofloat64 ( fields[6] ) );
-        pFeature->setFeatureTypeCode ( fields[7] );
-        pFeature->setOrigin ( fields[8] );
+        pFeature->setFeatureTypeCode ( fields.str ( 7 ) );
+        pFeature->setOrigin ( fields.str ( 8 ) );
     }
 
     if ( type == kTypeCity )
@@ -91,12 +97,12 @@ SSObjectPtr SSFeature::fromCSV ( string csv )
         pFeature->setTarget ( "Earth" );
         pFeature->setLatitude ( strtofloat64 ( fields[3] ) );
         pFeature->setLongitude ( strtofloat64 ( fields[4] ) );
-        pCity->setCountryCode ( fields[5] );
-        pCity->setAdmin1Code ( fields[6] );
+        pCity->setCountryCode ( fields.str ( 5 ) );
+        pCity->setAdmin1Code ( fields.str ( 6 ) );
         pCity->setPopulation ( strtoint ( fields[7] ) );
-        if ( fields[8] != "" ) pCity->setElevation ( strtofloat ( fields[8] ) );
-        pCity->setTimezoneName ( fields[9] );
-        pCity->setAdmin1Name ( fields[10] );
+        if ( fields[8].size() ) pCity->setElevation ( strtofloat ( fields[8] ) );
+        pCity->setTimezoneName ( fields.str ( 9 ) );
+        pCity->setAdmin1Name ( fields.str ( 10 ) );
         pCity->setDaylightSaving ( !!strtoint( fields[11] ) );
         pCity->setTimezoneRawOffset ( strtofloat64 ( fields[12] ) );
     }
@@ -137,6 +143,11 @@ SSCity::SSCity ( void ) : SSFeature()
     _timezone_raw_offset = INFINITY;
 }
 
+size_t SSCity::heapBytes ( void )
+{
+    return SSFeature::heapBytes() + strbytes ( _country_code ) + strbytes ( _admin1_code ) + strbytes ( _admin1_name ) + strbytes ( _timezone_name );
+}
+
 // Returns the CSV string of the SSCity object.
 // Values should match the source CSV file for easy comparison
 
@@ -181,7 +192,11 @@ string SSCity::toCSV ( void )
 
 SSFeaturePtr SSGetFeaturePtr ( SSObjectPtr ptr )
 {
-    return dynamic_cast<SSFeaturePtr> ( ptr );
+    SSObjectFamily family = ptr ? SSGetObjectFamily ( ptr->getType() ) : kFamilyUnknown;
+    if ( family == kFamilyFeature || family == kFamilyCity )
+        return static_cast<SSFeaturePtr> ( ptr );
+    
+    return family == kFamilyUnknown ? dynamic_cast<SSFeaturePtr> ( ptr ) : nullptr;
 }
 
 // Downcasts generic SSObject pointer to SSCity pointer.
@@ -189,7 +204,11 @@ SSFeaturePtr SSGetFeaturePtr ( SSObjectPtr ptr )
 
 SSCityPtr SSGetCityPtr ( SSObjectPtr ptr )
 {
-    return dynamic_cast<SSCityPtr> ( ptr );
+    SSObjectFamily family = ptr ? SSGetObjectFamily ( ptr->getType() ) : kFamilyUnknown;
+    if ( family == kFamilyCity )
+        return static_cast<SSCityPtr> ( ptr );
+    
+    return family == kFamilyUnknown ? dynamic_cast<SSCityPtr> ( ptr ) : nullptr;
 }
 
 // Given a vector of SSFeatures (features), sorts them by target planet name,
@@ -231,3 +250,60 @@ int SSMakePlanetFeatureMap ( SSObjectVec &features, SSPlanetFeatureMap &map )
     
     return (int) map.size();
 }
+
+// Computes ephemerides of all features of a planet or moon (pPlanet) in an array of features (features) indexed by
+// SSMakePlanetFeatureMap() (map), at once. The planet must already have its ephemeris computed. Results are the same
+// as calling SSFeature::computeEphemeris() for each feature, but the planet's planetographic matrix, position, radius,
+// and flattening are fetched once, and the observer's position is transformed into the planetographic frame so each
+// feature's visibility is a dot product there. If (cull) is true, features on the far side are not transformed any
+// further: their visibility state (magnitude) is set to zero, and their direction and distance to infinity.
+// Returns the number of features on the visible side of the planet.
+
+int SSComputePlanetFeatureEphemerides ( SSPlanet *pPlanet, SSObjectVec &features, const SSPlanetFeatureMap &map, bool cull )
+{
+    auto it = map.find ( pPlanet->getName ( 0 ) );
+    if ( it == map.end() )
+        return 0;
+    
+    size_t first = it->second;
+    size_t last = ++it == map.end() ? features.size() : it->second;
+    
+    SSMatrix pmatrix = pPlanet->getPlanetographicMatrix();
+    SSVector center = pPlanet->getDirection() * pPlanet->getDistance();
+    SSVector observer = pmatrix.transposeMultiply ( center );
+    double radius = pPlanet->getRadius() < INFINITY ? pPlanet->getRadius() / SSCoordinates::kKmPerAU : 0.0;
+    double polar = 1.0 - pPlanet->getFlattening();
+    
+    int visible = 0;
+    for ( size_t i = first; i < last && i < features.size(); i++ )
+    {
+        SSFeature *pFeature = SSGetFeaturePtr ( features[i] );
+        if ( pFeature == nullptr )
+            continue;
+        
+        // Point in the planetographic frame, as in SSPlanet::surfacePointDirection(). It is on the near side
+        // if the direction from the observer to it points into the surface, i.e. ( point + observer ) * point < 0.
+        
+        SSVector point = SSSpherical ( SSAngle::fromDegrees ( pFeature->getLongitude() ), SSAngle::fromDegrees ( pFeature->getLatitude() ), radius );
+        point.z *= polar;
+        
+        if ( cull && ( point + observer ) * point >= 0.0 )
+        {
+            pFeature->setDirection ( SSVector ( INFINITY, INFINITY, INFINITY ) );
+            pFeature->setDistance ( INFINITY );
+            pFeature->setMagnitude ( 0.0 );
+            continue;
+        }
+        
+        double dist = 0.0;
+        point = pmatrix * point;
+        SSVector dir = ( point + center ).normalize ( dist );
+        bool near = dir * point < 0.0;
+        pFeature->setDirection ( dir );
+        pFeature->setDistance ( dist );
+        pFeature->setMagnitude ( near );
+        visible += near;
+    }
+    
+    return visible;
+}
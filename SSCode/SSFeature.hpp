@@ -13,7 +13,9 @@
 #include "SSObject.hpp"
 #include "SSPlanet.hpp"
 
+#if SS_PACKED_OBJECTS
 #pragma pack ( push, 1 )
+#endif
 
 // This subclass of SSObject stores basic data for planetary surface features
 // from the IAU Gazetteer of Planetary Nomenclature:
@@ -60,8 +62,12 @@ public:
     // imports/exports from/to CSV-format text string
     
     static SSObjectPtr fromCSV ( string csv );
+    static SSObjectPtr fromCSV ( const SSCSVFields &fields );
     virtual string toCSV ( void );
     
+    virtual size_t sizeOf ( void ) { return sizeof ( SSFeature ); }
+    virtual size_t heapBytes ( void ) { return SSObject::heapBytes() + strbytes ( _target ) + strbytes ( _type_code ) + strbytes ( _origin ); }
+    
     // computes apparent direction and distance; planet must already have ephemeris computed.
     
     void computeEphemeris ( SSPlanet *pPlanet );
@@ -113,9 +119,14 @@ public:
     
     static SSObjectPtr fromCSV ( string csv );
     virtual string toCSV ( void );
+    
+    virtual size_t sizeOf ( void ) { return sizeof ( SSCity ); }
+    virtual size_t heapBytes ( void );
 };
 
+#if SS_PACKED_OBJECTS
 #pragma pack ( pop )
+#endif
 
 // convenient aliases for pointers to various subclasses of SSFeature
 
@@ -131,5 +142,6 @@ SSCityPtr SSGetCityPtr ( SSObjectPtr ptr );
 typedef map<string,int> SSPlanetFeatureMap;
 
 int SSMakePlanetFeatureMap ( SSObjectVec &features, SSPlanetFeatureMap &map );
+int SSComputePlanetFeatureEphemerides ( SSPlanet *pPlanet, SSObjectVec &features, const SSPlanetFeatureMap &map, bool cull = true );
 
 #endif /* SSFeature_hpp */
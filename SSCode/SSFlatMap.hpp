@@ -0,0 +1,128 @@
+// SSFlatMap.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// A map stored as a flat vector of (key, value) pairs, sorted by key, as a replacement for std::map and
+// std::multimap where a map is built once, from mostly unsorted input, and then looked up many times.
+// Insertions are appended to the vector; the first lookup after them sorts it once, instead of balancing
+// a tree on every insertion. Lookups are binary searches over contiguous memory, without pointer-chasing.
+// A multimap (Multi = true) keeps values with equal keys in insertion order, as std::multimap does;
+// a map keeps only the first value inserted with each key, as std::map::insert() does.
+
+#ifndef SSFlatMap_hpp
+#define SSFlatMap_hpp
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class K, class V, bool Multi = false> class SSFlatMap
+{
+public:
+    typedef K key_type;
+    typedef V mapped_type;
+    typedef pair<K,V> value_type;
+    typedef typename vector<value_type>::iterator iterator;
+    typedef typename vector<value_type>::const_iterator const_iterator;
+
+protected:
+    mutable vector<value_type> _entries;        // (key, value) pairs, sorted by key unless _sorted is false
+    mutable bool _sorted = true;                // false after insertions which may have unsorted the entries
+
+    static bool less_key ( const value_type &e1, const value_type &e2 ) { return e1.first < e2.first; }
+    static bool equal_key ( const value_type &e1, const value_type &e2 ) { return ! ( e1.first < e2.first ) && ! ( e2.first < e1.first ); }
+
+public:
+
+    // Sorts entries by key, keeping entries with equal keys in insertion order, and (unless this is a multimap)
+    // removes all but the first entry with each key. Every lookup does this first if needed, so a map must be
+    // sorted, or looked up once, before it is looked up concurrently from several threads.
+
+    void sort ( void ) const
+    {
+        if ( _sorted )
+            return;
+
+        stable_sort ( _entries.begin(), _entries.end(), less_key );
+        if ( ! Multi )
+            _entries.erase ( unique ( _entries.begin(), _entries.end(), equal_key ), _entries.end() );
+
+        _sorted = true;
+    }
+
+    // Inserts one entry, or a range of entries in any order.
+
+    void insert ( const value_type &entry )
+    {
+        if ( _sorted && ! _entries.empty() && ( Multi ? less_key ( entry, _entries.back() ) : ! less_key ( _entries.back(), entry ) ) )
+            _sorted = false;
+
+        _entries.push_back ( entry );
+    }
+
+    template <class InputIt> void insert ( InputIt first, InputIt last )
+    {
+        for ( InputIt it = first; it != last; it++ )
+            insert ( *it );
+    }
+
+    void reserve ( size_t n ) { _entries.reserve ( n ); }
+    void clear ( void ) { _entries.clear(); _sorted = true; }
+    size_t size ( void ) const { sort(); return _entries.size(); }
+    size_t capacity ( void ) const { return _entries.capacity(); }
+    bool empty ( void ) const { return _entries.empty(); }
+
+    iterator begin ( void ) { sort(); return _entries.begin(); }
+    iterator end ( void ) { sort(); return _entries.end(); }
+    const_iterator begin ( void ) const { sort(); return _entries.begin(); }
+    const_iterator end ( void ) const { sort(); return _entries.end(); }
+
+    // Lookups, with the same semantics as std::map and std::multimap.
+
+    iterator lower_bound ( const K &key )
+    {
+        sort();
+        return std::lower_bound ( _entries.begin(), _entries.end(), key, [] ( const value_type &e, const K &k ) { return e.first < k; } );
+    }
+
+    iterator upper_bound ( const K &key )
+    {
+        sort();
+        return std::upper_bound ( _entries.begin(), _entries.end(), key, [] ( const K &k, const value_type &e ) { return k < e.first; } );
+    }
+
+    const_iterator lower_bound ( const K &key ) const { return const_cast<SSFlatMap *> ( this )->lower_bound ( key ); }
+    const_iterator upper_bound ( const K &key ) const { return const_cast<SSFlatMap *> ( this )->upper_bound ( key ); }
+
+    pair<iterator,iterator> equal_range ( const K &key ) { return { lower_bound ( key ), upper_bound ( key ) }; }
+    pair<const_iterator,const_iterator> equal_range ( const K &key ) const { return { lower_bound ( key ), upper_bound ( key ) }; }
+
+    iterator find ( const K &key )
+    {
+        iterator it = lower_bound ( key );
+        return it != _entries.end() && ! ( key < it->first ) ? it : _entries.end();
+    }
+
+    const_iterator find ( const K &key ) const { return const_cast<SSFlatMap *> ( this )->find ( key ); }
+
+    size_t count ( const K &key ) const
+    {
+        pair<const_iterator,const_iterator> range = equal_range ( key );
+        return range.second - range.first;
+    }
+
+    // Returns the (first) value with a key, or a default-constructed value if there is none.
+    // Unlike std::map::operator[], this never inserts an entry.
+
+    V operator [] ( const K &key ) const
+    {
+        const_iterator it = find ( key );
+        return it == _entries.end() ? V() : it->second;
+    }
+};
+
+#endif /* SSFlatMap_hpp */
@@ -0,0 +1,215 @@
+// SSGroundTrack.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <map>
+
+#include "SSGroundTrack.hpp"
+#include "SSCoordinates.hpp"
+#include "SSPlanet.hpp"
+
+static const double kEarthRotation = SSAngle::kTwoPi * 1.00273781191135;    // Earth's rotation rate, radians per day
+
+SSGroundTrack::SSGroundTrack ( const vector<SSTLE> &tles )
+{
+    _tles = tles;
+    _maxAngle = SSAngle::fromDegrees ( 1.0 );
+    _minStep = 10.0 / SSTime::kSecondsPerDay;
+    _maxStep = 1.0 / 24.0;
+}
+
+SSGroundTrack::SSGroundTrack ( SSObjectArray &objects ) : SSGroundTrack ( vector<SSTLE>() )
+{
+    for ( size_t i = 0; i < objects.size(); i++ )
+    {
+        SSSatellitePtr pSat = SSGetSatellitePtr ( objects.get ( i ) );
+        if ( pSat )
+            _tles.push_back ( pSat->getTLE() );
+    }
+}
+
+// The sub-satellite point moves fastest at perigee, where the orbit's angular rate is n (1 + e)^2 / (1 - e^2)^1.5;
+// adding the Earth's rotation bounds its motion over the ground. The step keeping that under the maximum angle
+// is rounded down to a power-of-two multiple of the minimum step, so satellites share a few time grids.
+
+double SSGroundTrack::getStep ( size_t i )
+{
+    const SSTLE &tle = _tles[i];
+    double e = min ( max ( tle.eo, 0.0 ), 0.999 );
+    double rate = fabs ( tle.xno ) * SSTime::kMinutesPerDay * ( 1.0 + e ) * ( 1.0 + e ) / pow ( 1.0 - e * e, 1.5 ) + kEarthRotation;
+    double step = _minStep;
+    while ( step * 2.0 <= _maxStep && step * 2.0 * rate <= _maxAngle )
+        step *= 2.0;
+    return step;
+}
+
+// Rotates satellite positions (pos) from the TEME frame at Julian Date (jd) to the Earth-fixed frame by Greenwich
+// mean sidereal time, then converts them to geodetic coordinates (geo) on the WGS84 ellipsoid in one batch.
+// Longitudes are returned from -pi to +pi.
+
+void SSGroundTrack::toGeodetic ( double jd, const vector<SSVector> &pos, vector<SSSpherical> &geo )
+{
+    double gmst = SSTime ( jd ).getSiderealTime ( 0.0 );
+    double c = cos ( gmst ), s = sin ( gmst );
+    vector<SSVector> ecef ( pos.size() );
+    for ( size_t i = 0; i < pos.size(); i++ )
+        ecef[i] = SSVector ( pos[i].x * c + pos[i].y * s, pos[i].y * c - pos[i].x * s, pos[i].z );
+
+    geo.resize ( pos.size() );
+    SSCoordinates::toGeodetic ( ecef.data(), geo.data(), ecef.size(), SSCoordinates::kKmPerEarthRadii, SSCoordinates::kEarthFlattening );
+    for ( SSSpherical &g : geo )
+        if ( g.lon > SSAngle::kPi )
+            g.lon -= SSAngle::kTwoPi;
+}
+
+// Appends a point (point) to the last segment of (segments), or starts a new segment if (connect) is false.
+// If the line from the last point crosses the antimeridian, ends the last segment where it crosses, interpolated
+// linearly in latitude, time, and altitude; and starts a new segment from the same place on the other side.
+
+void SSGroundTrack::append ( vector<Segment> &segments, const Point &point, bool connect )
+{
+    if ( ! connect || segments.empty() || segments.back().empty() )
+    {
+        if ( segments.empty() || ! segments.back().empty() )
+            segments.push_back ( Segment() );
+        segments.back().push_back ( point );
+        return;
+    }
+
+    Point last = segments.back().back();
+    double dlon = point.lon - last.lon;
+    if ( fabs ( dlon ) > SSAngle::kPi )
+    {
+        double edge = dlon < 0.0 ? SSAngle::kPi : -SSAngle::kPi;
+        dlon += dlon < 0.0 ? SSAngle::kTwoPi : -SSAngle::kTwoPi;
+        double t = dlon == 0.0 ? 0.0 : ( edge - last.lon ) / dlon;
+        Point cross = { last.jd + t * ( point.jd - last.jd ), edge, last.lat + t * ( point.lat - last.lat ), last.alt + t * ( point.alt - last.alt ) };
+        segments.back().push_back ( cross );
+        cross.lon = -edge;
+        segments.push_back ( Segment ( 1, cross ) );
+    }
+
+    segments.back().push_back ( point );
+}
+
+size_t SSGroundTrack::generate ( double jd0, double jd1, vector<Track> &tracks, int threads )
+{
+    tracks.clear();
+    tracks.resize ( _tles.size() );
+    if ( jd1 < jd0 )
+        return 0;
+
+    // Group satellites by time step, and propagate each group on its own time grid.
+
+    map<double,vector<size_t>> groups;
+    for ( size_t i = 0; i < _tles.size(); i++ )
+    {
+        double step = getStep ( i );
+        tracks[i].index = i;
+        tracks[i].step = step;
+        groups[step].push_back ( i );
+    }
+
+    size_t points = 0;
+    vector<SSVector> pos, vel;
+    vector<SSSpherical> geo;
+    for ( auto &group : groups )
+    {
+        double step = group.first;
+        const vector<size_t> &members = group.second;
+        SSTLEArray array;
+        array.reserve ( members.size() );
+        for ( size_t i : members )
+            array.push_back ( _tles[i] );
+
+        size_t nsteps = (size_t) ceil ( ( jd1 - jd0 ) / step - 1.0e-9 );
+        for ( size_t k = 0; k <= nsteps; k++ )
+        {
+            double jd = k < nsteps ? jd0 + k * step : jd1;
+            array.toPositionVelocity ( jd, pos, vel, threads );
+            toGeodetic ( jd, pos, geo );
+            for ( size_t m = 0; m < members.size(); m++ )
+            {
+                // Decayed satellites and failed propagations (non-finite or underground positions) end a segment.
+
+                Track &track = tracks[ members[m] ];
+                bool valid = isfinite ( geo[m].lon ) && isfinite ( geo[m].lat ) && isfinite ( geo[m].rad ) && geo[m].rad >= 0.0;
+                if ( ! valid )
+                {
+                    if ( ! track.segments.empty() && ! track.segments.back().empty() )
+                        track.segments.push_back ( Segment() );
+                    continue;
+                }
+
+                Point point = { jd, geo[m].lon, geo[m].lat, geo[m].rad };
+                append ( track.segments, point, true );
+                points++;
+            }
+        }
+    }
+
+    for ( Track &track : tracks )
+        if ( ! track.segments.empty() && track.segments.back().empty() )
+            track.segments.pop_back();
+
+    return points;
+}
+
+// Footprint edge points lie at a constant angle (radius) from the sub-satellite point, in all azimuths,
+// from the spherical-trigonometry destination formulae. Where the edge crosses the antimeridian twice, the
+// segments before the first crossing and after the last join when the edge closes, so they are merged.
+
+size_t SSGroundTrack::footprints ( double jd, vector<Footprint> &footprints, int points, int threads )
+{
+    footprints.clear();
+    SSTLEArray array;
+    array.reserve ( _tles.size() );
+    for ( const SSTLE &tle : _tles )
+        array.push_back ( tle );
+
+    vector<SSVector> pos, vel;
+    vector<SSSpherical> geo;
+    array.toPositionVelocity ( jd, pos, vel, threads );
+    toGeodetic ( jd, pos, geo );
+
+    points = max ( points, 3 );
+    double re = SSCoordinates::kKmPerEarthRadii;
+    for ( size_t i = 0; i < _tles.size(); i++ )
+    {
+        double r = pos[i].magnitude();
+        if ( ! isfinite ( r ) || ! isfinite ( geo[i].lat ) || ! isfinite ( geo[i].lon ) || r <= re )
+            continue;
+
+        Footprint fp;
+        fp.index = i;
+        fp.center = { jd, geo[i].lon, geo[i].lat, geo[i].rad };
+        fp.radius = atan2 ( SSPlanet::horizonDistance ( re, r ), re );
+        fp.pole = fabs ( fp.center.lat ) + fp.radius > SSAngle::kHalfPi ? ( fp.center.lat > 0.0 ? 1 : -1 ) : 0;
+
+        double sinlat0 = sin ( fp.center.lat ), coslat0 = cos ( fp.center.lat );
+        double sinrad = sin ( fp.radius ), cosrad = cos ( fp.radius );
+        for ( int k = 0; k <= points; k++ )
+        {
+            double az = SSAngle::kTwoPi * ( k % points ) / points;
+            double sinlat = sinlat0 * cosrad + coslat0 * sinrad * cos ( az );
+            double lat = asin ( min ( max ( sinlat, -1.0 ), 1.0 ) );
+            double lon = fp.center.lon + atan2 ( sin ( az ) * sinrad * coslat0, cosrad - sinlat0 * sinlat );
+            lon = SSAngle ( lon ).modPi();
+            Point point = { jd, lon, lat, 0.0 };
+            append ( fp.segments, point, true );
+        }
+
+        if ( fp.segments.size() > 1 && fp.pole == 0 )
+        {
+            Segment &last = fp.segments.back();
+            last.insert ( last.end(), fp.segments.front().begin() + 1, fp.segments.front().end() );
+            fp.segments.erase ( fp.segments.begin() );
+        }
+
+        footprints.push_back ( fp );
+    }
+
+    return footprints.size();
+}
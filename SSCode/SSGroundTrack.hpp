@@ -0,0 +1,96 @@
+// SSGroundTrack.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// Generates ground tracks (geodetic longitude, latitude, and altitude of the sub-satellite point over time) and visibility
+// footprints (the circle on the Earth within which a satellite is above the horizon) for many Earth satellites at once,
+// for drawing on maps. Satellites are propagated with the batch SGP4/SDP4 propagator (SSTLEArray) and converted to
+// geodetic coordinates with the batch version of SSCoordinates::toGeodetic(). Time steps adapt to each satellite's orbit:
+// each gets the longest step in which its sub-satellite point moves no more than a maximum angle at perigee, rounded down
+// to a power-of-two multiple of the minimum step, and satellites with the same step are propagated together.
+// Tracks and footprints are split into segments where they cross the antimeridian (longitude 180°), while they are made,
+// so each segment can be drawn as one polyline on a map with longitudes from -180° to +180°.
+
+#ifndef SSGroundTrack_hpp
+#define SSGroundTrack_hpp
+
+#include "SSTLE.hpp"
+#include "SSObject.hpp"
+
+class SSGroundTrack
+{
+public:
+
+    // A point on a ground track or footprint: Julian Date (UTC), geodetic longitude from -pi to +pi and latitude
+    // in radians, and altitude above the WGS84 ellipsoid in km (zero for footprints).
+
+    struct Point
+    {
+        double jd;
+        SSAngle lon, lat;
+        double alt;
+    };
+
+    typedef vector<Point> Segment;          // points drawn as one polyline, which does not cross the antimeridian
+
+    struct Track
+    {
+        size_t index;                       // index of satellite in the satellites given to the constructor
+        double step;                        // time step in days
+        vector<Segment> segments;           // track segments in order of time; also split where propagation fails
+    };
+
+    struct Footprint
+    {
+        size_t index;                       // index of satellite, as above
+        Point center;                       // sub-satellite point, with satellite's altitude
+        SSAngle radius;                     // angle at the Earth's center from sub-satellite point to footprint's edge
+        int pole;                           // +1 or -1 if footprint contains the north or south pole, else zero
+        vector<Segment> segments;           // footprint's edge, in order of azimuth from north through east
+    };
+
+protected:
+
+    vector<SSTLE> _tles;                    // satellites' TLEs, in order given
+    SSAngle _maxAngle;                      // maximum motion of sub-satellite point per time step
+    double _minStep, _maxStep;              // minimum and maximum time step in days
+
+    static void append ( vector<Segment> &segments, const Point &point, bool connect );
+    static void toGeodetic ( double jd, const vector<SSVector> &pos, vector<SSSpherical> &geo );
+
+public:
+
+    // Constructs from TLEs (tles), or from the satellites in an object array (objects), skipping other objects;
+    // satellites are then indexed in the order they appear in the array, counting only satellites.
+
+    SSGroundTrack ( const vector<SSTLE> &tles );
+    SSGroundTrack ( SSObjectArray &objects );
+
+    size_t size ( void ) { return _tles.size(); }
+
+    // Sets maximum motion of a sub-satellite point per time step (default 1 degree), and minimum and maximum
+    // time steps in days (default 10 seconds and 1 hour).
+
+    void setMaxAngle ( SSAngle maxAngle ) { _maxAngle = maxAngle; }
+    void setStepLimits ( double minStep, double maxStep ) { _minStep = minStep; _maxStep = max ( minStep, maxStep ); }
+
+    // Returns the time step in days used for the satellite at index (i).
+
+    double getStep ( size_t i );
+
+    // Generates ground tracks of all satellites from Julian Date (jd0) to (jd1) in UTC, in steps chosen as above,
+    // plus a last point at (jd1); satellites are propagated on (threads) threads as SSTLEArray::toPositionVelocity()
+    // does. Tracks are stored in (tracks) in the order of the satellites. Returns the total number of points.
+
+    size_t generate ( double jd0, double jd1, vector<Track> &tracks, int threads = 1 );
+
+    // Generates footprints of all satellites at Julian Date (jd) in UTC, each with (points) points around its edge
+    // (plus one to close it) on a spherical Earth of equatorial radius; radius is from SSPlanet::horizonDistance().
+    // Footprints are stored in (footprints) in the order of the satellites; returns the number generated.
+
+    size_t footprints ( double jd, vector<Footprint> &footprints, int points = 72, int threads = 1 );
+};
+
+#endif /* SSGroundTrack_hpp */
@@ -0,0 +1,671 @@
+// SSGzip.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#include "SSGzip.hpp"
+#include "SSUtilities.hpp"
+
+// CRC-32 (IEEE 802.3) lookup table, as used in the gzip trailer.
+
+static const uint32_t *crcTable ( void )
+{
+    static uint32_t table[256];
+    static bool init = [] ()
+    {
+        for ( uint32_t n = 0; n < 256; n++ )
+        {
+            uint32_t c = n;
+            for ( int k = 0; k < 8; k++ )
+                c = c & 1 ? 0xedb88320 ^ ( c >> 1 ) : c >> 1;
+            table[n] = c;
+        }
+        return true;
+    } ();
+
+    (void) init;
+    return table;
+}
+
+static uint32_t crc32 ( uint32_t crc, const uint8_t *data, size_t size )
+{
+    const uint32_t *table = crcTable();
+    crc = ~crc;
+    for ( size_t i = 0; i < size; i++ )
+        crc = table[ ( crc ^ data[i] ) & 0xff ] ^ ( crc >> 8 );
+    return ~crc;
+}
+
+// Compressed input, from a file read in large blocks or from memory, consumed through a 64-bit bit buffer,
+// least significant bit first. Past the end of the input, zero bytes are supplied and counted as padding,
+// so decoding never reads out of bounds; consuming any padding means the input was truncated.
+
+struct GzipInput
+{
+    static constexpr size_t kMaxPad = 16;
+
+    FILE *file;
+    const uint8_t *data;
+    size_t size, pos;
+    vector<uint8_t> buffer;
+    uint64_t bits;
+    int count;
+    size_t pad;
+
+    GzipInput ( FILE *file, const void *data, size_t size )
+    {
+        this->file = file;
+        this->data = (const uint8_t *) data;
+        this->size = data ? size : 0;
+        pos = 0;
+        bits = 0;
+        count = 0;
+        pad = 0;
+    }
+
+    bool more ( void )
+    {
+        if ( file == nullptr )
+            return false;
+
+        buffer.resize ( SSGzipReader::kBlockSize );
+        size = fread ( buffer.data(), 1, buffer.size(), file );
+        data = buffer.data();
+        pos = 0;
+        return size > 0;
+    }
+
+    void refill ( void )
+    {
+        while ( count <= 56 )
+        {
+            if ( pos == size && ! more() )
+            {
+                pad++;
+                count += 8;
+                continue;
+            }
+
+            bits |= (uint64_t) data[pos++] << count;
+            count += 8;
+        }
+    }
+
+    uint32_t peek ( int n )
+    {
+        if ( count < n )
+            refill();
+        return (uint32_t) ( bits & ( ( (uint64_t) 1 << n ) - 1 ) );
+    }
+
+    void drop ( int n ) { bits >>= n; count -= n; }
+    uint32_t get ( int n ) { uint32_t v = peek ( n ); drop ( n ); return v; }
+    void align ( void ) { drop ( count & 7 ); }
+    bool overrun ( void ) { return pad > kMaxPad; }
+    bool truncated ( void ) { return (size_t) count < pad * 8; }
+};
+
+// Decompressed output, accumulated in a window which keeps the last 32 KB for back-references,
+// and delivered to a sink function in blocks. The CRC and size of each gzip member are checked at its end.
+
+struct GzipOutput
+{
+    static constexpr size_t kWindow = 1 << 15;
+
+    vector<uint8_t> window;
+    size_t pos, start, crcPos;
+    uint32_t crc, memberSize;
+    function<bool ( const char *, size_t )> sink;
+
+    GzipOutput ( const function<bool ( const char *, size_t )> &sink ) : sink ( sink )
+    {
+        window.resize ( kWindow + SSGzipReader::kBlockSize );
+        pos = start = crcPos = 0;
+        crc = memberSize = 0;
+    }
+
+    void check ( void )
+    {
+        crc = crc32 ( crc, window.data() + crcPos, pos - crcPos );
+        memberSize += (uint32_t) ( pos - crcPos );
+        crcPos = pos;
+    }
+
+    bool flush ( void )
+    {
+        check();
+        if ( pos > start && ! sink ( (const char *) window.data() + start, pos - start ) )
+            return false;
+
+        size_t keep = pos < kWindow ? pos : kWindow;
+        memmove ( window.data(), window.data() + pos - keep, keep );
+        pos = start = crcPos = keep;
+        return true;
+    }
+
+    bool put ( uint8_t c )
+    {
+        if ( pos == window.size() && ! flush() )
+            return false;
+        window[pos++] = c;
+        return true;
+    }
+
+    bool copy ( size_t dist, size_t len )
+    {
+        if ( dist == 0 || dist > pos )
+            return false;
+        if ( pos + len > window.size() && ! flush() )
+            return false;
+
+        uint8_t *d = window.data() + pos, *s = d - dist;
+        if ( dist >= len )
+            memcpy ( d, s, len );
+        else
+            for ( size_t i = 0; i < len; i++ )
+                d[i] = s[i];
+
+        pos += len;
+        return true;
+    }
+};
+
+// Canonical Huffman code. Codes up to kFastBits long are decoded with one table lookup;
+// longer ones, which are rare, bit by bit from the code length counts.
+
+static constexpr int kFastBits = 10;
+static constexpr int kMaxBits = 15;
+
+struct Huffman
+{
+    uint16_t fast[1 << kFastBits];      // ( symbol << 4 ) | code length, indexed by bit-reversed code; zero if longer
+    uint16_t count[kMaxBits + 1];       // number of codes of each length
+    uint16_t symbol[288];               // symbols ordered by code
+
+    bool build ( const uint8_t *lengths, int n );
+    int decode ( GzipInput &in ) const;
+};
+
+bool Huffman::build ( const uint8_t *lengths, int n )
+{
+    memset ( count, 0, sizeof ( count ) );
+    for ( int i = 0; i < n; i++ )
+        count[ lengths[i] ]++;
+    count[0] = 0;
+
+    // Reject over-subscribed codes. Incomplete codes are allowed, e.g. a distance code with one symbol.
+
+    int left = 1;
+    for ( int len = 1; len <= kMaxBits; len++ )
+    {
+        left = ( left << 1 ) - count[len];
+        if ( left < 0 )
+            return false;
+    }
+
+    uint16_t offs[kMaxBits + 2] = { 0 };
+    for ( int len = 1; len <= kMaxBits; len++ )
+        offs[len + 1] = offs[len] + count[len];
+    for ( int i = 0; i < n; i++ )
+        if ( lengths[i] )
+            symbol[ offs[ lengths[i] ]++ ] = i;
+
+    memset ( fast, 0, sizeof ( fast ) );
+    int code = 0, k = 0;
+    for ( int len = 1; len <= kMaxBits; len++, code <<= 1 )
+        for ( int i = 0; i < count[len]; i++, k++, code++ )
+        {
+            if ( len > kFastBits )
+                continue;
+
+            int rev = 0;
+            for ( int b = 0; b < len; b++ )
+                rev |= ( ( code >> b ) & 1 ) << ( len - 1 - b );
+            for ( int j = rev; j < ( 1 << kFastBits ); j += 1 << len )
+                fast[j] = ( symbol[k] << 4 ) | len;
+        }
+
+    return true;
+}
+
+int Huffman::decode ( GzipInput &in ) const
+{
+    if ( in.count < kMaxBits )
+        in.refill();
+
+    uint16_t e = fast[ in.bits & ( ( 1 << kFastBits ) - 1 ) ];
+    if ( e )
+    {
+        in.drop ( e & 15 );
+        return e >> 4;
+    }
+
+    uint64_t bits = in.bits;
+    int code = 0, first = 0, index = 0;
+    for ( int len = 1; len <= kMaxBits; len++ )
+    {
+        code |= bits & 1;
+        bits >>= 1;
+        if ( code - first < count[len] )
+        {
+            in.drop ( len );
+            return symbol[ index + code - first ];
+        }
+        index += count[len];
+        first = ( first + count[len] ) << 1;
+        code <<= 1;
+    }
+
+    return -1;
+}
+
+static const uint16_t kLenBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t kLenExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t kDistBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const uint8_t kDistExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+// Decodes literals and length/distance pairs of a compressed block until its end-of-block symbol.
+
+static bool inflateCodes ( GzipInput &in, GzipOutput &out, const Huffman &lencode, const Huffman &distcode )
+{
+    while ( true )
+    {
+        int sym = lencode.decode ( in );
+        if ( sym < 0 || in.overrun() )
+            return false;
+
+        if ( sym < 256 )
+        {
+            if ( ! out.put ( sym ) )
+                return false;
+        }
+        else if ( sym == 256 )
+        {
+            return true;
+        }
+        else
+        {
+            sym -= 257;
+            if ( sym >= 29 )
+                return false;
+            size_t len = kLenBase[sym] + in.get ( kLenExtra[sym] );
+
+            int dsym = distcode.decode ( in );
+            if ( dsym < 0 || dsym >= 30 )
+                return false;
+            size_t dist = kDistBase[dsym] + in.get ( kDistExtra[dsym] );
+
+            if ( ! out.copy ( dist, len ) )
+                return false;
+        }
+    }
+}
+
+static bool inflateStored ( GzipInput &in, GzipOutput &out )
+{
+    in.align();
+    uint32_t len = in.get ( 16 ), nlen = in.get ( 16 );
+    if ( len != ( ~nlen & 0xffff ) )
+        return false;
+
+    for ( uint32_t i = 0; i < len; i++ )
+        if ( ! out.put ( in.get ( 8 ) ) || in.overrun() )
+            return false;
+
+    return true;
+}
+
+static bool inflateFixed ( GzipInput &in, GzipOutput &out )
+{
+    static Huffman lencode, distcode;
+    static bool built = [] ()
+    {
+        uint8_t lengths[288];
+        for ( int i = 0; i < 288; i++ )
+            lengths[i] = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+        lencode.build ( lengths, 288 );
+
+        for ( int i = 0; i < 30; i++ )
+            lengths[i] = 5;
+        distcode.build ( lengths, 30 );
+        return true;
+    } ();
+
+    (void) built;
+    return inflateCodes ( in, out, lencode, distcode );
+}
+
+static bool inflateDynamic ( GzipInput &in, GzipOutput &out )
+{
+    static const uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    int nlen = in.get ( 5 ) + 257, ndist = in.get ( 5 ) + 1, ncode = in.get ( 4 ) + 4;
+    if ( nlen > 286 || ndist > 30 )
+        return false;
+
+    uint8_t lengths[286 + 30] = { 0 };
+    for ( int i = 0; i < ncode; i++ )
+        lengths[ order[i] ] = in.get ( 3 );
+
+    Huffman lencode, distcode;
+    if ( ! lencode.build ( lengths, 19 ) )
+        return false;
+
+    // Read literal/length and distance code lengths, run-length encoded with the code length code.
+
+    int i = 0;
+    while ( i < nlen + ndist )
+    {
+        int sym = lencode.decode ( in );
+        if ( sym < 0 || in.overrun() )
+            return false;
+
+        if ( sym < 16 )
+        {
+            lengths[i++] = sym;
+            continue;
+        }
+
+        int len = 0, rep = 0;
+        if ( sym == 16 )
+        {
+            if ( i == 0 )
+                return false;
+            len = lengths[i - 1];
+            rep = 3 + in.get ( 2 );
+        }
+        else if ( sym == 17 )
+        {
+            rep = 3 + in.get ( 3 );
+        }
+        else
+        {
+            rep = 11 + in.get ( 7 );
+        }
+
+        if ( i + rep > nlen + ndist )
+            return false;
+        while ( rep-- )
+            lengths[i++] = len;
+    }
+
+    if ( lengths[256] == 0 )
+        return false;
+
+    if ( ! lencode.build ( lengths, nlen ) || ! distcode.build ( lengths + nlen, ndist ) )
+        return false;
+
+    return inflateCodes ( in, out, lencode, distcode );
+}
+
+// Decompresses one gzip member: header, DEFLATE blocks, and trailer with CRC and size.
+
+static bool inflateMember ( GzipInput &in, GzipOutput &out )
+{
+    if ( in.get ( 8 ) != 0x1f || in.get ( 8 ) != 0x8b || in.get ( 8 ) != 8 )
+        return false;
+
+    uint32_t flags = in.get ( 8 );
+    in.get ( 32 );      // modification time
+    in.get ( 16 );      // extra flags, operating system
+
+    if ( flags & 4 )    // extra field
+    {
+        uint32_t xlen = in.get ( 16 );
+        for ( uint32_t i = 0; i < xlen && ! in.overrun(); i++ )
+            in.get ( 8 );
+    }
+
+    for ( uint32_t flag : { 8u, 16u } )     // file name, comment: zero-terminated
+        if ( flags & flag )
+            while ( in.get ( 8 ) != 0 && ! in.overrun() )
+                continue;
+
+    if ( flags & 2 )    // header CRC
+        in.get ( 16 );
+
+    out.crc = out.memberSize = 0;
+    out.crcPos = out.pos;
+
+    bool last = false;
+    while ( ! last )
+    {
+        last = in.get ( 1 );
+        uint32_t type = in.get ( 2 );
+        bool ok = type == 0 ? inflateStored ( in, out ) : type == 1 ? inflateFixed ( in, out ) : type == 2 ? inflateDynamic ( in, out ) : false;
+        if ( ! ok || in.truncated() )
+            return false;
+    }
+
+    in.align();
+    uint32_t crc = in.get ( 32 ), size = in.get ( 32 );
+    out.check();
+    return ! in.truncated() && crc == out.crc && size == out.memberSize;
+}
+
+// Decompresses gzip members until the end of the input, or anything after a member which isn't another member.
+
+static bool inflateGzip ( GzipInput &in, GzipOutput &out )
+{
+    do
+    {
+        if ( ! inflateMember ( in, out ) )
+            return false;
+        in.refill();
+    }
+    while ( (size_t) in.count > in.pad * 8 && in.peek ( 16 ) == 0x8b1f );
+
+    return out.flush();
+}
+
+SSGzipReader::SSGzipReader ( void )
+{
+    _file = nullptr;
+    _ownFile = false;
+    _data = nullptr;
+    _size = _blockPos = 0;
+    _started = _done = _error = false;
+#if USE_THREADS
+    _closing = false;
+#endif
+}
+
+SSGzipReader::~SSGzipReader ( void )
+{
+    close();
+}
+
+bool SSGzipReader::isGzip ( const void *data, size_t size )
+{
+    const uint8_t *bytes = (const uint8_t *) data;
+    return data != nullptr && size >= 2 && bytes[0] == 0x1f && bytes[1] == 0x8b;
+}
+
+bool SSGzipReader::isGzip ( const string &path )
+{
+    FILE *file = fopen ( path.c_str(), "rb" );
+    if ( file == nullptr )
+        return false;
+
+    uint8_t magic[2] = { 0 };
+    size_t size = fread ( magic, 1, 2, file );
+    fclose ( file );
+    return isGzip ( magic, size );
+}
+
+bool SSGzipReader::open ( const string &path )
+{
+    FILE *file = fopen ( path.c_str(), "rb" );
+    if ( ! open ( file ) )
+        return false;
+
+    _ownFile = true;
+    return true;
+}
+
+bool SSGzipReader::open ( FILE *file )
+{
+    close();
+    _file = file;
+    return file != nullptr;
+}
+
+bool SSGzipReader::open ( const char *data, size_t size )
+{
+    close();
+    _data = data;
+    _size = size;
+    return data != nullptr;
+}
+
+void SSGzipReader::close ( void )
+{
+#if USE_THREADS
+    if ( _thread.joinable() )
+    {
+        {
+            lock_guard<mutex> lock ( _mutex );
+            _closing = true;
+        }
+        _changed.notify_all();
+        _thread.join();
+    }
+    _closing = false;
+#endif
+
+    if ( _file != nullptr && _ownFile )
+        fclose ( _file );
+
+    _file = nullptr;
+    _ownFile = false;
+    _data = nullptr;
+    _size = _blockPos = 0;
+    _started = _done = _error = false;
+    _blocks.clear();
+    _block.clear();
+}
+
+// Called by the decoder with each decompressed block. With threads, waits while the reader is kMaxBlocks behind;
+// returns false to stop decompression if the reader is closing.
+
+bool SSGzipReader::deliver ( const char *data, size_t size )
+{
+#if USE_THREADS
+    unique_lock<mutex> lock ( _mutex );
+    _changed.wait ( lock, [this] () { return _blocks.size() < kMaxBlocks || _closing; } );
+    if ( _closing )
+        return false;
+    _blocks.push_back ( vector<char> ( data, data + size ) );
+    lock.unlock();
+    _changed.notify_all();
+#else
+    _blocks.push_back ( vector<char> ( data, data + size ) );
+#endif
+    return true;
+}
+
+void SSGzipReader::decompress ( void )
+{
+    GzipInput in ( _file, _data, _size );
+    GzipOutput out ( [this] ( const char *data, size_t size ) { return deliver ( data, size ); } );
+    bool ok = inflateGzip ( in, out );
+
+#if USE_THREADS
+    {
+        lock_guard<mutex> lock ( _mutex );
+        _error = ! ok && ! _closing;
+        _done = true;
+    }
+    _changed.notify_all();
+#else
+    _error = ! ok;
+    _done = true;
+#endif
+}
+
+void SSGzipReader::start ( void )
+{
+    _started = true;
+#if USE_THREADS
+    _thread = thread ( &SSGzipReader::decompress, this );
+#else
+    decompress();
+#endif
+}
+
+size_t SSGzipReader::read ( char *buffer, size_t size )
+{
+    if ( ! isOpen() )
+        return 0;
+
+    if ( ! _started )
+        start();
+
+    size_t copied = 0;
+    while ( copied < size )
+    {
+        // Take the next decompressed block when this one has been read; stop when there are no more.
+
+        if ( _blockPos == _block.size() )
+        {
+#if USE_THREADS
+            unique_lock<mutex> lock ( _mutex );
+            _changed.wait ( lock, [this] () { return ! _blocks.empty() || _done; } );
+#endif
+            if ( _blocks.empty() )
+                break;
+
+            _block = std::move ( _blocks.front() );
+            _blocks.pop_front();
+            _blockPos = 0;
+#if USE_THREADS
+            lock.unlock();
+            _changed.notify_all();
+#endif
+        }
+
+        size_t n = min ( size - copied, _block.size() - _blockPos );
+        memcpy ( buffer + copied, _block.data() + _blockPos, n );
+        _blockPos += n;
+        copied += n;
+    }
+
+    return copied;
+}
+
+bool SSGzipReader::error ( void )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _mutex );
+#endif
+    return _error;
+}
+
+bool SSGzipReader::gunzip ( const void *data, size_t size, vector<char> &bytes )
+{
+    bytes.clear();
+    GzipInput in ( nullptr, data, size );
+    GzipOutput out ( [&bytes] ( const char *data, size_t size ) { bytes.insert ( bytes.end(), data, data + size ); return true; } );
+    return inflateGzip ( in, out );
+}
+
+bool SSGzipReader::readFile ( const string &path, vector<char> &bytes )
+{
+    if ( ! fetchfile ( path, bytes ) )
+        return false;
+
+    if ( ! isGzip ( bytes.data(), bytes.size() ) )
+        return true;
+
+    vector<char> text;
+    if ( ! gunzip ( bytes.data(), bytes.size(), text ) )
+        return false;
+
+    bytes.swap ( text );
+    return true;
+}
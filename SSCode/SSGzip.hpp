@@ -0,0 +1,107 @@
+// SSGzip.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// Reads gzip-compressed files (RFC 1952), e.g. MPCORB.DAT.gz or catalog files as distributed by CDS, so importers
+// can read them without decompressing them to disk first. The DEFLATE decoder (RFC 1951) is self-contained, with no
+// dependence on zlib; it reads the compressed file in large blocks, and decodes Huffman codes with lookup tables.
+// With threads, decompression runs on a thread of its own, a few blocks ahead of the reader, so it overlaps parsing;
+// without threads (USE_THREADS is zero), the whole file is decompressed into memory when first read.
+// SSLineReader recognizes gzip files and reads them through this class, so line-based importers need no changes.
+// Concatenated gzip members are read as one stream. Other compression formats (e.g. zstd) are not supported.
+
+#ifndef SSGzip_hpp
+#define SSGzip_hpp
+
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "SSUtilities.hpp"
+
+#if USE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+using namespace std;
+
+class SSGzipReader
+{
+public:
+
+    static constexpr size_t kBlockSize = 1 << 20;   // bytes of compressed input read, and decompressed output delivered, at once
+    static constexpr size_t kMaxBlocks = 4;         // decompressed blocks held ahead of the reader
+
+protected:
+
+    FILE *_file;                    // compressed file, or nullptr if reading from memory or not open
+    bool _ownFile;                  // true if this reader opened the file, and must close it
+    const char *_data;              // compressed data in memory, not owned; or nullptr
+    size_t _size;                   // size of compressed data in memory
+    bool _started, _done, _error;   // decompression started; all output delivered to _blocks; decompression failed
+
+    deque<vector<char>> _blocks;    // decompressed blocks not yet read
+    vector<char> _block;            // block being read
+    size_t _blockPos;               // offset of unread data in _block
+
+#if USE_THREADS
+    thread _thread;                 // decompression thread
+    mutex _mutex;                   // protects _blocks, _done, _error, _closing
+    condition_variable _changed;    // signaled when a block is added or removed, or decompression ends
+    bool _closing;                  // true when reader is closing, so decompression thread must stop
+#endif
+
+    bool deliver ( const char *data, size_t size );
+    void decompress ( void );
+    void start ( void );
+
+public:
+
+    SSGzipReader ( void );
+    SSGzipReader ( const SSGzipReader &other ) = delete;
+    SSGzipReader &operator = ( const SSGzipReader &other ) = delete;
+    ~SSGzipReader ( void );
+
+    // Returns true if (size) bytes of data (data) start with the gzip signature.
+
+    static bool isGzip ( const void *data, size_t size );
+
+    // Returns true if a file (path) starts with the gzip signature.
+
+    static bool isGzip ( const string &path );
+
+    // Opens a gzip file (path), or reads from a gzip file already opened for reading in binary mode (file), which
+    // this reader does not close, or from gzip data in memory (data) of (size) bytes, which must stay valid while the
+    // reader is open. Returns true if successful. Decompression starts with the first read().
+
+    bool open ( const string &path );
+    bool open ( FILE *file );
+    bool open ( const char *data, size_t size );
+    void close ( void );
+
+    bool isOpen ( void ) { return _file != nullptr || _data != nullptr; }
+
+    // Copies up to (size) bytes of decompressed data into a buffer (buffer). Returns the number of bytes copied,
+    // which is less than (size) only at the end of the data, or if the data is corrupt or truncated.
+
+    size_t read ( char *buffer, size_t size );
+
+    // Returns true if the compressed data was corrupt or truncated.
+
+    bool error ( void );
+
+    // Decompresses (size) bytes of gzip data in memory (data) into (bytes). Returns false if the data is corrupt.
+
+    static bool gunzip ( const void *data, size_t size, vector<char> &bytes );
+
+    // Reads an entire file (path) into (bytes), decompressing it if it is gzip-compressed. Returns false on failure.
+
+    static bool readFile ( const string &path, vector<char> &bytes );
+};
+
+#endif /* SSGzip_hpp */
@@ -6,9 +6,13 @@
 
 #include <iostream>
 #include <fstream>
+#include <functional>
+#include <sstream>
 #include <string.h>
 
 #include "SSHTM.hpp"
+#include "SSBinaryCatalog.hpp"
+#include "SSInstrument.hpp"
 
 uint64_t cc_vector2ID ( double x, double y, double z, int depth );
 int cc_IDlevel ( uint64_t htmid );
@@ -16,6 +20,7 @@ int cc_isinside ( const double *p, const double *v1, const double *v2, const dou
 int cc_ID2name ( char *name, uint64_t id );
 uint64_t cc_name2ID ( const char *name );
 int cc_name2Triangle ( const char *name, double *v0, double *v1, double *v2 );
+int cc_ID2Triangle ( uint64_t id, double *v0, double *v1, double *v2 );
 
 // If not NULL, this function is called after a region is loaded asynchronously.
 
@@ -31,10 +36,93 @@ SSHTM::RegionLoadCallback SSHTMGetRegionLoadCallback ( void )
     return _callback;
 }
 
+// If not NULL, this function is called before an evicted region's objects are deleted.
+
+static SSHTM::RegionEvictCallback _evictCallback = nullptr;
+
+void SSHTMSetRegionEvictCallback ( SSHTM::RegionEvictCallback pCallback )
+{
+    _evictCallback = pCallback;
+}
+
+SSHTM::RegionEvictCallback SSHTMGetRegionEvictCallback ( void )
+{
+    return _evictCallback;
+}
+
+// An open HTM archive: its memory-mapped file or bytes in memory, or if neither, the file opened for reading,
+// and copies of its region and map tables. Reading from an unmapped file is serialized by a mutex.
+
+struct SSHTM::Archive
+{
+    const char *map = nullptr;                  // memory-mapped archive file or bytes, or nullptr if not mapped
+    size_t mapSize = 0;                         // size of memory-mapped file in bytes
+    vector<char> bytes;                         // entire archive, if opened from memory
+    FILE *file = nullptr;                       // archive file, if not mapped
+#if USE_THREADS
+    mutex fileMutex;                            // serializes seeking and reading file
+#endif
+    vector<float> magLevels;                    // magnitude levels
+    vector<SSHTMArchiveEntry> regions;          // region table
+    vector<SSHTMArchiveEntry> maps;             // map table
+    
+    ~Archive ( void )
+    {
+        if ( map != nullptr && bytes.empty() )
+            unmapfile ( map, mapSize );
+        if ( file != nullptr )
+            fclose ( file );
+    }
+    
+    // Finds the entry with a key in a table (entries), and returns its data (data) of (size) bytes: a slice of the
+    // mapped file, or read into a buffer (buffer). Returns false if the table has no such entry, or it can't be read.
+    
+    bool read ( const vector<SSHTMArchiveEntry> &entries, uint64_t key, vector<char> &buffer, const char *&data, uint64_t &size )
+    {
+        auto it = lower_bound ( entries.begin(), entries.end(), key, [] ( const SSHTMArchiveEntry &entry, uint64_t key ) { return entry.key < key; } );
+        if ( it == entries.end() || it->key != key )
+            return false;
+        
+        size = it->size;
+        if ( map != nullptr )
+        {
+            data = map + it->offset;
+            return true;
+        }
+        
+#if USE_THREADS
+        lock_guard<mutex> lock ( fileMutex );
+#endif
+        buffer.resize ( size );
+        if ( fseek ( file, (long) it->offset, SEEK_SET ) != 0 || fread ( buffer.data(), 1, size, file ) != size )
+            return false;
+        
+        data = buffer.data();
+        return true;
+    }
+};
+
+// Reads a region's objects from a binary catalog file in the HTM's root directory.
+// Returns number of objects read, or zero if the file is missing or invalid.
+
+int SSHTMReadBinaryRegion ( SSHTM *pHTM, uint64_t htmID, SSObjectArray *objects, void *userData )
+{
+    return SSImportObjectsFromBinary ( pHTM->rootPath() + pHTM->ID2name ( htmID ) + ".bin", *objects );
+}
+
+// Writes a region's objects to a binary catalog file in the HTM's root directory.
+// Returns number of objects written, or zero if the file can't be written.
+
+int SSHTMWriteBinaryRegion ( SSHTM *pHTM, uint64_t htmID, SSObjectArray *objects, void *userData )
+{
+    return SSExportObjectsToBinary ( pHTM->rootPath() + pHTM->ID2name ( htmID ) + ".bin", *objects );
+}
+
 // Default constructor: empty array of magnitude limits, root path string,
 // empty map of HTM region IDs to object arrays.
 
-SSHTM::SSHTM ( void )
+SSHTM::SSHTM ( void ) : _regions ( new RegionMap() ), _useClock ( 0 ), _stats ( new StatsMap() ), _trixels ( new TrixelMap() ),
+    _nameIndex ( new NameMap() ), _foldedNameIndex ( new FoldedNameMap() ), _identIndex ( new IdentIndex() )
 {
 
 }
@@ -42,19 +130,34 @@ SSHTM::SSHTM ( void )
 // Constructor specifies array of magnitude limits for each HTM level,
 // and root path to directory containing region data files in CSV format.
 
-SSHTM::SSHTM ( const vector<float> &magLevels, const string &rootpath )
+SSHTM::SSHTM ( const vector<float> &magLevels, const string &rootpath ) : SSHTM()
+{
+    reset ( magLevels, rootpath );
+}
+
+// Deletes all regions, then sets magnitude limits for each HTM level
+// and root path to directory containing region data files.
+
+void SSHTM::reset ( const vector<float> &magLevels, const string &rootpath )
 {
+    dumpRegions();
     _magLevels = magLevels;
     
     _rootpath = rootpath;
-    if ( _rootpath[ _rootpath.length() - 1 ] != '/' )
+    if ( _rootpath.length() > 0 && _rootpath[ _rootpath.length() - 1 ] != '/' )
         _rootpath += '/';
+    
+    if ( ! loadStats() )
+        atomic_store ( &_stats, shared_ptr<const StatsMap> ( new StatsMap() ) );
 }
 
 // Destructor frees memory for all loaded regions and all objects therein.
 
 SSHTM::~SSHTM ( void )
 {
+#if USE_THREADS
+    stopLoadThreads();
+#endif
     dumpRegions();
 }
 
@@ -103,10 +206,10 @@ bool SSHTM::magLimits ( uint64_t htmID, float &min, float &max )
     return true;
 }
 
-// Stores a pointer to a star or deep sky object in this HTM, creating an HTM region to store it in, if needed.
-// Returns true if successful or false if the star cannot be stored.
+// Computes the ID of the region where a star or deep sky object (pStar) would be stored in this HTM.
+// Returns false if the object can't be stored.
 
-bool SSHTM::store ( SSStar *pStar )
+bool SSHTM::storeRegionID ( SSStar *pStar, uint64_t &htmID )
 {
     float mag = pStar->getVMagnitude();
     if ( isinf ( mag ) )
@@ -120,50 +223,196 @@ bool SSHTM::store ( SSStar *pStar )
     if ( level < 0 )
         return false;
     
-    uint64_t htmID = 0;
+    htmID = 0;
     if ( level > 0 )
         htmID = SSHTM::vector2ID ( pos, level - 1 );
 
-    if ( _regions.count ( htmID ) == 0 )
-        _regions[htmID] = new SSObjectVec();
-    
-    _regions[htmID]->append ( pStar );
     return true;
 }
 
+// Returns pointer to region with the specified HTM ID; if it doesn't exist,
+// creates an empty region and publishes a new region map containing it.
+
+SSHTM::Region *SSHTM::addRegion ( uint64_t htmID )
+{
+    Region *pRegion = getRegion ( htmID );
+    if ( pRegion == nullptr )
+    {
+#if USE_THREADS
+        lock_guard<mutex> lock ( _regionMutex );
+#endif
+        shared_ptr<Region> region ( new Region ( new SSObjectVec() ) );
+        shared_ptr<RegionMap> regions ( new RegionMap ( *getRegionMap() ) );
+        (*regions)[htmID] = region;
+        atomic_store ( &_regions, shared_ptr<const RegionMap> ( regions ) );
+        pRegion = region.get();
+    }
+    
+    return pRegion;
+}
+
+// Stores a pointer to a star or deep sky object in this HTM, creating an HTM region to store it in, if needed.
+// Returns true if successful or false if the star cannot be stored.
+
+bool SSHTM::store ( SSStar *pStar )
+{
+    uint64_t htmID = 0;
+    if ( ! storeRegionID ( pStar, htmID ) )
+        return false;
+    
+    return addRegion ( htmID )->objects->append ( pStar );
+}
+
+// Calls a work function for ranges of (count) items from (begin) up to (but not including) (end)
+// on up to (threads) threads, or one per processor core if (threads) is zero or negative.
+
+static void run_chunks ( size_t count, int threads, const function<void ( size_t begin, size_t end )> &work )
+{
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+
+    threads = (int) min ( (size_t) threads, count );
+    if ( threads > 1 )
+    {
+        vector<thread> workers;
+        for ( int t = 1; t < threads; t++ )
+            workers.push_back ( thread ( [&, t] () { work ( count * t / threads, count * ( t + 1 ) / threads ); } ) );
+
+        work ( 0, count / threads );
+
+        for ( thread &worker : workers )
+            worker.join();
+
+        return;
+    }
+#endif
+
+    work ( 0, count );
+}
+
 // Stores all stars and deep sky objects in an array of object pointers (objects)
 // into this HTM, and returns the total number of pointers stored.
+// On more than one thread, region IDs are computed in parallel; then objects are bucketed by region ID,
+// keeping their order in the array; then each region's bucket is appended to it, with regions in parallel.
 
-int SSHTM::store ( SSObjectVec &objects )
+int SSHTM::store ( SSObjectVec &objects, int threads )
 {
     int n = 0;
     
-    for ( int i = 0; i < objects.size(); i++ )
+    if ( threads == 1 )
+    {
+        for ( int i = 0; i < objects.size(); i++ )
+        {
+            SSStar *pStar = SSGetStarPtr ( objects[i] );
+            if ( pStar == nullptr )
+                continue;
+            
+            if ( store ( pStar ) )
+                n++;
+        }
+        
+        return n;
+    }
+    
+    // Compute region IDs; objects which can't be stored get an invalid ID.
+    
+    const uint64_t kNoRegion = UINT64_MAX;
+    vector<uint64_t> ids ( objects.size(), kNoRegion );
+    run_chunks ( objects.size(), threads, [&] ( size_t begin, size_t end )
+    {
+        for ( size_t i = begin; i < end; i++ )
+        {
+            SSStar *pStar = SSGetStarPtr ( objects[i] );
+            if ( pStar != nullptr && ! storeRegionID ( pStar, ids[i] ) )
+                ids[i] = kNoRegion;
+        }
+    } );
+    
+    // Partition object indexes into buckets by region ID, in array order.
+    
+    unordered_map<uint64_t,size_t> bucketIndex;
+    vector<pair<uint64_t,vector<size_t>>> buckets;
+    for ( size_t i = 0; i < ids.size(); i++ )
     {
-        SSStar *pStar = SSGetStarPtr ( objects[i] );
-        if ( pStar == nullptr )
+        if ( ids[i] == kNoRegion )
             continue;
         
-        if ( store ( pStar ) )
-            n++;
+        auto it = bucketIndex.find ( ids[i] );
+        if ( it == bucketIndex.end() )
+        {
+            it = bucketIndex.insert ( { ids[i], buckets.size() } ).first;
+            buckets.push_back ( { ids[i], vector<size_t>() } );
+        }
+        
+        buckets[it->second].second.push_back ( i );
     }
     
-    return n;
+    // Create all new regions first, publishing one new region map; then fill regions in parallel.
+    
+    {
+#if USE_THREADS
+        lock_guard<mutex> lock ( _regionMutex );
+#endif
+        shared_ptr<RegionMap> regions ( new RegionMap ( *getRegionMap() ) );
+        for ( auto &bucket : buckets )
+            if ( regions->count ( bucket.first ) == 0 )
+                (*regions)[bucket.first] = shared_ptr<Region> ( new Region ( new SSObjectVec() ) );
+        
+        atomic_store ( &_regions, shared_ptr<const RegionMap> ( regions ) );
+    }
+    
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    atomic<int> stored ( 0 );
+    run_chunks ( buckets.size(), threads, [&] ( size_t begin, size_t end )
+    {
+        int count = 0;
+        for ( size_t b = begin; b < end; b++ )
+        {
+            SSObjectVec *pObjects = regions->at ( buckets[b].first )->objects;
+            for ( size_t i : buckets[b].second )
+                if ( pObjects->append ( objects[i] ) )
+                    count++;
+        }
+        
+        stored += count;
+    } );
+    
+    return stored;
 }
 
 // Saves all regions of this HTM as CSV-formatted files in its root directory.
 // Root directory must already exist, and root path must end with a '/' character.
 // CSV files within directory will be named for individual HTM regions and will overwrite
-// any existing files with the same names.
+// any existing files with the same names. Regions are saved on up to (threads) threads,
+// or one per processor core if zero or negative; a custom write function must then be thread-safe.
 // Returns the total number of objects written to the file(s).
 
-int SSHTM::saveRegions ( void *userData )
+int SSHTM::saveRegions ( void *userData, int threads )
 {
-    int n = 0;
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    vector<uint64_t> ids;
+    for ( auto it = regions->begin(); it != regions->end(); it++ )
+        ids.push_back ( it->first );
     
-    for ( auto it = _regions.begin(); it != _regions.end(); it++ )
-        saveRegion ( it->first, userData );
+    // Each region's statistics are computed on the thread which saved it, then published together and written to the index.
+    
+    vector<pair<uint64_t,RegionStats>> stats ( ids.size() );
+    atomic<int> n ( 0 );
+    run_chunks ( ids.size(), threads, [&] ( size_t begin, size_t end )
+    {
+        int count = 0;
+        for ( size_t i = begin; i < end; i++ )
+        {
+            count += _saveRegion ( ids[i], userData );
+            stats[i] = make_pair ( ids[i], makeStats ( ids[i], *regions->at ( ids[i] ) ) );
+        }
+        
+        n += count;
+    } );
     
+    updateStats ( stats );
+    saveStats();
     return n;
 }
 
@@ -173,15 +422,28 @@ int SSHTM::saveRegions ( void *userData )
 // Returns the total number of objects written to the file.
 
 int SSHTM::saveRegion ( uint64_t htmID, void *userData )
+{
+    int n = _saveRegion ( htmID, userData );
+    Region *pRegion = getRegion ( htmID );
+    if ( pRegion != nullptr )
+        updateStats ( { make_pair ( htmID, makeStats ( htmID, *pRegion ) ) } );
+    
+    return n;
+}
+
+// Private implementation of saveRegion(), without updating statistics.
+
+int SSHTM::_saveRegion ( uint64_t htmID, void *userData )
 {
     int n = 0;
     
-    if ( _regions.count ( htmID ) )
+    Region *pRegion = getRegion ( htmID );
+    if ( pRegion != nullptr )
     {
         if ( _writeFunc != nullptr )
-            n = _writeFunc ( this, htmID, _regions[htmID], userData );
+            n = _writeFunc ( this, htmID, pRegion->objects, userData );
         else
-            n = SSExportObjectsToCSV ( _rootpath + ID2name ( htmID ) + ".csv", *_regions[htmID] );
+            n = SSExportObjectsToCSV ( _rootpath + ID2name ( htmID ) + ".csv", *pRegion->objects );
     }
     
     return n;
@@ -206,53 +468,99 @@ int SSHTM::loadRegions ( uint64_t htmID, bool sync, void *userData )
     return n;
 }
 
+SSAsync<int> SSHTM::loadRegionsAsync ( uint64_t htmID, void *userData )
+{
+    return SSRunAsync<int> ( [this, htmID, userData] ( SSTaskState &task )
+    {
+        vector<uint64_t> ids = { htmID };
+        for ( size_t i = 0; i < ids.size(); i++ )
+        {
+            vector<uint64_t> subIDs = subRegionIDs ( ids[i] );
+            ids.insert ( ids.end(), subIDs.begin(), subIDs.end() );
+        }
+        
+        int n = 0;
+        task.setProgress ( 0, ids.size() );
+        for ( size_t i = 0; i < ids.size() && ! task.isCancelled(); i++ )
+        {
+            if ( requestRegion ( ids[i], true, userData ) )
+                n++;
+            task.addProgress();
+        }
+        
+        return n;
+    } );
+}
+
 // Loads star data for a single region in this HTM from a file in the HTM directory.
 // If sync is true, loads the region synchronously on the current thread, and
 // returns pointer to loaded object vector if sucessful, or nullptr on failure.
-// If sync is false, loads the region asynchronously on a background thread, and
+// If sync is false, queues the region for loading on a background worker thread, and
 // returns nullptr; when finished loading region, calls notification callback
 // installed by SSHTMSetRegionLoadCallback() above, and subsequent calls to
 // loadRegion() or getObjects() return a pointer to the region's object vector.
+// A region already queued or being loaded is not loaded again; a synchronous load
+// takes it out of the queue, or waits for its worker thread to finish loading it.
 // If USE_THREADS is 0, this function always loads synchronously.
+// Afterwards, evicts least recently used regions other than this one if over memory budget.
 
 SSObjectVec *SSHTM::loadRegion ( uint64_t htmID, bool sync, void *userData )
 {
-    // If region is loaded, delete thread associated with loading it,
-    // then return pointer to that region's objects.
+    SSObjectVec *pObjects = requestRegion ( htmID, sync, userData );
+    _evictRegions ( htmID );
+    return pObjects;
+}
 
-    if ( regionLoaded ( htmID ) )
-    {
-#if USE_THREADS
-        if ( _loadThreads.count ( htmID ) != 0 )
-        {
-            if ( _loadThreads[htmID]->joinable() )
-                _loadThreads[htmID]->join();
-            delete _loadThreads[htmID];
-            _loadThreads.erase ( htmID );
-        }
-#endif
-        return getObjects ( htmID );
-    }
+// Private implementation of loadRegion(), without eviction.
+
+SSObjectVec *SSHTM::requestRegion ( uint64_t htmID, bool sync, void *userData )
+{
+    SSObjectVec *pObjects = getObjects ( htmID );
+    SS_INSTRUMENT_CACHE ( kInstrumentHTMRegion, pObjects != nullptr );
+    if ( pObjects != nullptr )
+        return pObjects;
     
 #if USE_THREADS
-    if ( !sync )
     {
-        // Load in a background thread
-
-        if ( _loadThreads.count ( htmID ) == 0 )
+        unique_lock<mutex> lock ( _loadMutex );
+        
+        if ( !sync )
+        {
+            // Queue region for loading in a background thread, unless already queued or loading.
+            // Start worker threads if they're not running.
+            
+            if ( _queuedLoads.count ( htmID ) == 0 && _loadingRegions.count ( htmID ) == 0 )
+            {
+                _queuedLoads[htmID] = _loadQueue.insert ( { loadPriority ( htmID ), { htmID, userData } } );
+                _loadQueued.notify_one();
+            }
+            
+            while ( _loadThreads.size() < _loadThreadCount )
+                _loadThreads.push_back ( thread ( &SSHTM::loadWorker, this ) );
+            
+            return nullptr;
+        }
+        
+        // To load synchronously, take region out of the queue, or wait for a worker thread to finish loading it.
+        
+        auto it = _queuedLoads.find ( htmID );
+        if ( it != _queuedLoads.end() )
         {
-            _loadThreads[htmID] = new thread ( &SSHTM::_loadRegion, this, htmID, _callback, userData );
-            _loadThreads[htmID]->detach();
+            _loadQueue.erase ( it->second );
+            _queuedLoads.erase ( it );
+        }
+        
+        if ( _loadingRegions.count ( htmID ) )
+        {
+            waitForLoad ( lock, htmID );
+            return getObjects ( htmID );
         }
-
-        return nullptr;
     }
 #endif
     
     // Load region synchronously.
 
-    _loadRegion ( htmID, nullptr, userData );
-    return _regions[htmID];
+    return _loadRegion ( htmID, nullptr, userData );
 }
 
 // Private method to load region, possibly from a background thread.
@@ -260,18 +568,67 @@ SSObjectVec *SSHTM::loadRegion ( uint64_t htmID, bool sync, void *userData )
 
 SSObjectVec *SSHTM::_loadRegion ( uint64_t htmID, RegionLoadCallback callback, void *userData )
 {
+    SS_INSTRUMENT_TIME ( kInstrumentHTMLoad );
     int n = 0;
-    SSObjectVec *objects = new SSObjectVec();
+    SSObjectVec *objects = _arenaSlabSize ? new SSObjectVec ( _arenaSlabSize ) : new SSObjectVec();
     
-    if ( _readFunc != nullptr )
+    shared_ptr<Archive> archive = atomic_load ( &_archive );
+    if ( archive != nullptr )
+    {
+        vector<char> buffer;
+        const char *data = nullptr;
+        uint64_t size = 0;
+        SSBinaryCatalog catalog;
+        
+        SSObjectArena::Scope scope ( objects->getArena() );
+        if ( archive->read ( archive->regions, htmID, buffer, data, size ) && catalog.open ( data, size ) )
+            n = catalog.materialize ( *objects );
+    }
+    else if ( _readFunc != nullptr )
+    {
+        SSObjectArena::Scope scope ( objects->getArena() );
         n = _readFunc ( this, htmID, objects, userData );
+    }
     else
         n = SSImportObjectsFromCSV ( _rootpath + ID2name ( htmID ) + ".csv", *objects );
     
+    // Publish a new region map containing the loaded region, replacing any existing region with the same ID,
+    // and add its objects and memory to the totals.
+    
     if ( n > 0 )
-        _regions[htmID] = objects;
+    {
+        shared_ptr<Region> region ( new Region ( objects ) );
+        region->loaded = true;
+        region->numObjects = objects->size();
+        region->bytes = objects->memoryUsage();
+        region->lastUse = ++_useClock;
+        
+#if USE_THREADS
+        lock_guard<mutex> lock ( _regionMutex );
+#endif
+        shared_ptr<RegionMap> regions ( new RegionMap ( *getRegionMap() ) );
+        shared_ptr<Region> &entry = (*regions)[htmID];
+        if ( entry && entry->loaded )
+        {
+            _loadedObjects -= entry->numObjects;
+            _loadedBytes -= entry->bytes;
+        }
+        
+        entry = region;
+        _loadedObjects += region->numObjects;
+        _loadedBytes += region->bytes;
+        atomic_store ( &_regions, shared_ptr<const RegionMap> ( regions ) );
+    }
     else
+    {
         delete objects;
+        objects = nullptr;
+        
+#if USE_THREADS
+        lock_guard<mutex> lock ( _regionMutex );
+#endif
+        _emptyRegions.insert ( htmID );
+    }
     
     if ( callback != nullptr )
         callback ( this, htmID );
@@ -279,766 +636,2279 @@ SSObjectVec *SSHTM::_loadRegion ( uint64_t htmID, RegionLoadCallback callback, v
     return objects;
 }
 
-// Tests whether star data for a specific region in this HTM has been
-// loaded into memory, i.e. if that region exists in this HTM.
-
-bool SSHTM::regionLoaded ( uint64_t htmID )
-{
-    return _regions[htmID] != nullptr;
-}
+#if USE_THREADS
 
-// Returns pointer to array of objects stored in the region
-// with the specified HTM triangle ID. If region is not present
-// in this HTM or objects have not been loaded, returns nullptr.
+// Returns priority of loading a region in the background: its mesh level, so brighter levels load first,
+// plus a fraction for the angular distance of its triangle from the view center, if known, so nearer regions load first.
 
-SSObjectVec *SSHTM::getObjects ( uint64_t htmID )
+double SSHTM::loadPriority ( uint64_t htmID )
 {
-    return _regions[htmID];
+    double priority = IDlevel ( htmID );
+    if ( htmID > 0 && ! _loadCenter.isinf() )
+    {
+        TrixelLookup lookup;
+        const Trixel &t = getTrixel ( htmID, lookup );
+        priority += max ( 0.0, (double) _loadCenter.angularSeparation ( t.center ) - t.radius ) / ( 2.0 * SSAngle::kPi );
+    }
+    
+    return priority;
 }
 
-// Deletes all star data for a specific region in this HTM from memory.
+// Worker thread: loads regions from the front of the queue until told to stop.
 
-void SSHTM::dumpRegion ( uint64_t htmID )
+void SSHTM::loadWorker ( void )
 {
-#if USE_THREADS
-    // If still loading this region asynchronously, wait for load to complete
-    
-    if ( _loadThreads.count ( htmID ) != 0 )
-    {
-        if ( _loadThreads[htmID]->joinable() )
-            _loadThreads[htmID]->join();
-        delete _loadThreads[htmID];
-        _loadThreads.erase ( htmID );
-    }
-#endif
-
-    // Now delete object vector (and its objects) associated with this region.
+    unique_lock<mutex> lock ( _loadMutex );
     
-    if ( _regions.count ( htmID ) )
+    while ( true )
     {
-        if ( _regions[htmID] != nullptr )
-            delete _regions[htmID];
-        _regions.erase ( htmID );
+        _loadQueued.wait ( lock, [this] { return _stopLoading || ! _loadQueue.empty(); } );
+        if ( _stopLoading )
+            break;
+        
+        LoadRequest request = _loadQueue.begin()->second;
+        _loadQueue.erase ( _loadQueue.begin() );
+        _queuedLoads.erase ( request.htmID );
+        _loadingRegions.insert ( request.htmID );
+        
+        lock.unlock();
+        _loadRegion ( request.htmID, _callback, request.userData );
+        lock.lock();
+        
+        _loadingRegions.erase ( request.htmID );
+        _loadFinished.notify_all();
     }
 }
 
-// Deletes all star data for all regions in this HTM from memory.
+// Stops worker threads after they finish loading their current regions; regions still queued stay queued.
 
-void SSHTM::dumpRegions ( void )
+void SSHTM::stopLoadThreads ( void )
 {
-#if USE_THREADS
-    // Let all load threads run to completion, and delete them before destroying regions!
-    
-    for ( auto it = _loadThreads.begin(); it != _loadThreads.end(); it++ )
     {
-        if ( it->second != nullptr )
-        {
-            if ( it->second->joinable() )
-                it->second->join();
-            delete it->second;
-        }
+        lock_guard<mutex> lock ( _loadMutex );
+        _stopLoading = true;
+        _loadQueued.notify_all();
     }
-#endif
     
-    // Now delete object vectors (and their objects) for all loaded regions.
+    for ( thread &worker : _loadThreads )
+        worker.join();
     
-    for ( auto it = _regions.begin(); it != _regions.end(); it++ )
-    {
-        if ( it->second != nullptr )
-            delete it->second;
-    }
-
-#if USE_THREADS
     _loadThreads.clear();
-#endif
-    _regions.clear();
+    _stopLoading = false;
 }
 
-// Counts total number of stars stored in all regions in this HTM.
+// Waits, with load mutex locked, until a worker thread is no longer loading a region (htmID).
 
-int SSHTM::countStars ( void )
+void SSHTM::waitForLoad ( unique_lock<mutex> &lock, uint64_t htmID )
 {
-    int count = 0;
-    
-    for ( auto it = _regions.begin(); it != _regions.end(); it++ )
-        if ( it->second != nullptr )
-            count += it->second->size();
-    
-    return count;
+    _loadFinished.wait ( lock, [this, htmID] { return _loadingRegions.count ( htmID ) == 0; } );
 }
 
-// Counts number of stars stored in a single region in this HTM.
+#endif
 
-int SSHTM::countStars ( uint64_t htmID )
+// Sets number of background worker threads for loading regions; one per processor core if zero or negative.
+// Running workers finish loading their current regions first; queued regions are loaded by the new workers.
+
+void SSHTM::setLoadThreadCount ( int threads )
 {
-    int count = 0;
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
     
-    if ( _regions.count ( htmID ) && _regions[htmID] != nullptr )
-        count = (int) _regions[htmID]->size();
-
-    return count;
+    stopLoadThreads();
+    
+    lock_guard<mutex> lock ( _loadMutex );
+    _loadThreadCount = threads;
+    if ( ! _loadQueue.empty() )
+        while ( _loadThreads.size() < _loadThreadCount )
+            _loadThreads.push_back ( thread ( &SSHTM::loadWorker, this ) );
+#endif
 }
 
-// Given a unit vector to a point on the celestial sphere, returns the HTM ID
-// of the triangle containing that vector at a specific HTM depth level.
+// Sets view center unit vector used to prioritize background region loading, and reorders regions already queued.
 
-uint64_t SSHTM::vector2ID ( const SSVector &vector, int depth )
+void SSHTM::setLoadCenter ( SSVector center )
 {
-    return cc_vector2ID ( vector.x, vector.y, vector.z, depth );
+#if USE_THREADS
+    lock_guard<mutex> lock ( _loadMutex );
+    _loadCenter = center.normalize();
+    
+    LoadQueue queue;
+    for ( auto &entry : _loadQueue )
+        _queuedLoads[entry.second.htmID] = queue.insert ( { loadPriority ( entry.second.htmID ), entry.second } );
+    
+    _loadQueue.swap ( queue );
+#endif
 }
 
-// Given an HTM triangle name, returns the HTM ID of that triangle,
-// or zero if the name is not a valid HTM name.
+// Cancels loading a region in the background, if it has not started yet. Returns true if cancelled.
 
-uint64_t SSHTM::name2ID ( const string &name )
+bool SSHTM::cancelLoad ( uint64_t htmID )
 {
-    if ( name.compare ( "O0" ) == 0 )
-        return 0;
-    
-    return cc_name2ID ( name.c_str() );
+#if USE_THREADS
+    lock_guard<mutex> lock ( _loadMutex );
+    auto it = _queuedLoads.find ( htmID );
+    if ( it != _queuedLoads.end() )
+    {
+        _loadQueue.erase ( it->second );
+        _queuedLoads.erase ( it );
+        return true;
+    }
+#endif
+    return false;
 }
 
-// Given an HTM triangle ID, returns the depth level of that triangle.
-// The whole celestrial sphere is level zero; the eight level 1 triangles
-// are N0 - N3 and S0 - S3; level 2 triangles are N00 - N33 and S00 - S33.
+// Cancels loading regions in the background whose triangles lie entirely outside a circle of (rad) radians
+// around a unit vector (center), if they have not started yet. Returns number of regions cancelled.
 
-int SSHTM::IDlevel ( uint64_t id )
+int SSHTM::cancelLoads ( SSVector center, SSAngle rad )
 {
-    return id == 0 ? 0 : cc_IDlevel ( id ) + 1;
+    int n = 0;
+#if USE_THREADS
+    lock_guard<mutex> lock ( _loadMutex );
+    center = center.normalize();
+    TrixelLookup lookup;
+    
+    for ( auto it = _loadQueue.begin(); it != _loadQueue.end(); )
+    {
+        uint64_t htmID = it->second.htmID;
+        if ( htmID > 0 )
+        {
+            const Trixel &t = getTrixel ( htmID, lookup );
+            if ( center.angularSeparation ( t.center ) > t.radius + rad )
+            {
+                _queuedLoads.erase ( htmID );
+                it = _loadQueue.erase ( it );
+                n++;
+                continue;
+            }
+        }
+        it++;
+    }
+    
+    publishTrixels ( lookup );
+#endif
+    return n;
 }
 
-// Given an HTM triangle ID, returns the triangle's HTM name string,
-// or an empty string if the ID is not a valid HTM ID.
+// Cancels loading all regions in the background which have not started yet. Returns number of regions cancelled.
 
-string SSHTM::ID2name ( uint64_t id )
+int SSHTM::cancelLoads ( void )
 {
-    if ( id == 0 )
-        return string ( "O0" );
-    
-    char name[64] = { 0 };
-    cc_ID2name ( name, id );
-    return string ( name );
+    int n = 0;
+#if USE_THREADS
+    lock_guard<mutex> lock ( _loadMutex );
+    n = (int) _loadQueue.size();
+    _loadQueue.clear();
+    _queuedLoads.clear();
+#endif
+    return n;
 }
 
-// Given an HTM triangle name, computes unit vectors to the triangle's three vertices
-// on the unit sphere (v0, v1, v2).  Returns true if the name is valid, or false otherwise.
+// Queues background loads of regions a view will probably show in the next few frames; see header for details.
+// The prefetch circle surrounds the view's current and predicted fields: it is centered midway between
+// the current and predicted view centers, with a radius of half the view diagonal plus half the distance between them.
 
-bool SSHTM::name2Triangle ( const string &name, SSVector &v0, SSVector &v1, SSVector &v2 )
+int SSHTM::prefetch ( SSView &view, SSVector motion, int frames, float magLimit, void *userData )
 {
-    return cc_name2Triangle ( name.c_str(), &v0.x, &v1.x, &v2.x ) == 0;
+    SSVector center = view.getCenterVector();
+    SSVector future = ( center + motion * (double) max ( frames, 0 ) ).normalize();
+    SSVector middle = ( center + future ).normalize();
+    if ( middle.isinf() || middle.isnan() )
+        middle = center;
+    
+    SSAngle rad = view.getAngularDiagonal() / 2.0 + center.angularSeparation ( future ) / 2.0;
+    
+    int maxLevel = magLevel ( magLimit );
+    if ( maxLevel < 0 )
+        maxLevel = (int) _magLevels.size() - 1;
+    
+    setLoadCenter ( center );
+    cancelLoads ( middle, rad );
+    
+    // Collect regions in the cover of the prefetch circle at each level, skipping those loaded or known to be empty.
+    
+    vector<uint64_t> ids ( 1, 0 );
+    for ( int level = 1; level <= maxLevel; level++ )
+    {
+        Cover cover;
+        coverCircle ( middle, rad, level, cover );
+        for ( const vector<IDRange> *ranges : { &cover.full, &cover.partial } )
+            for ( const IDRange &range : *ranges )
+                for ( uint64_t id = range.first; id <= range.last; id++ )
+                    ids.push_back ( id );
+    }
+    
+    {
+#if USE_THREADS
+        lock_guard<mutex> lock ( _regionMutex );
+#endif
+        shared_ptr<const RegionMap> regions = getRegionMap();
+        ids.erase ( remove_if ( ids.begin(), ids.end(), [this, &regions] ( uint64_t id ) { return regions->count ( id ) || _emptyRegions.count ( id ); } ), ids.end() );
+    }
+    
+    for ( uint64_t id : ids )
+        loadRegion ( id, false, userData );
+    
+    return (int) ids.size();
 }
 
-// Given a unit vector to a point on the celestial sphere (p), determines if p is inside
-// the triangle on the celestial sphere whose vertices are the unit vectors (v0, v1, v2).
+// Returns number of regions queued for loading in the background, or being loaded now.
 
-bool SSHTM::isinside ( const SSVector &p, const SSVector &v0, SSVector &v1, SSVector &v2 )
+int SSHTM::pendingLoads ( void )
 {
-    return cc_isinside ( &p.x, &v0.x, &v1.x, &v2.x );
+#if USE_THREADS
+    lock_guard<mutex> lock ( _loadMutex );
+    return (int) ( _loadQueue.size() + _loadingRegions.size() );
+#else
+    return 0;
+#endif
 }
 
-// Original C HTM implementation from Johns Hopkins in cc_aux.c was downloaded from:
-// http://www.skyserver.org/htm/implementation.aspx#download
-// This is a cleaned-up version of that code.
+// Returns offset rounded up to a multiple of 8 bytes.
 
-#define IDSIZE 64
-#define IDHIGHBIT  0x8000000000000000LL
-#define IDHIGHBIT2 0x4000000000000000LL
+static uint64_t align8 ( uint64_t offset )
+{
+    return ( offset + 7 ) & ~7ULL;
+}
 
-#define HTM_INVALID_ID 0
-#define HTMNAMEMAX     32
+// Saves all regions in memory, and all object maps, to an archive file (path).
+// Returns number of regions written, or zero on failure.
 
-static const double gEpsilon = 1.0E-15;
+int SSHTM::saveArchive ( const string &path )
+{
+    // Serialize regions as binary catalogs, and object maps as CSV text.
+    
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    vector<vector<char>> regionData;
+    vector<string> mapData;
+    vector<SSHTMArchiveEntry> regionTable, mapTable;
+    
+    for ( auto it = regions->begin(); it != regions->end(); it++ )
+    {
+        regionData.push_back ( vector<char>() );
+        SSExportObjectsToBinary ( regionData.back(), *it->second->objects );
+        regionTable.push_back ( { it->first, 0, regionData.back().size() } );
+    }
+    
+    set<SSCatalog> cats;
+    if ( getNameIndex()->size() > 0 )
+        cats.insert ( kCatUnknown );
+    for ( auto &index : *getIdentIndex() )
+        if ( index.first != kCatUnknown && index.second->size() > 0 )
+            cats.insert ( index.first );
+    
+    for ( SSCatalog cat : cats )
+    {
+        ostringstream stream;
+        writeObjectMap ( cat, stream );
+        mapData.push_back ( stream.str() );
+        mapTable.push_back ( { (uint64_t) cat, 0, mapData.back().size() } );
+    }
+    
+    // Lay out header, levels, and tables, followed by region and map data.
+    
+    SSHTMArchiveHeader header = { { 0 } };
+    memcpy ( header.magic, kHTMArchiveMagic, sizeof ( header.magic ) );
+    header.version = kHTMArchiveVersion;
+    header.byteOrder = kBinaryCatalogByteOrder;
+    header.numLevels = (uint32_t) _magLevels.size();
+    header.numRegions = (uint32_t) regionTable.size();
+    header.numMaps = (uint32_t) mapTable.size();
+    header.levelOffset = align8 ( sizeof ( header ) );
+    header.regionOffset = align8 ( header.levelOffset + _magLevels.size() * sizeof ( float ) );
+    header.mapOffset = align8 ( header.regionOffset + regionTable.size() * sizeof ( SSHTMArchiveEntry ) );
+    
+    uint64_t offset = header.mapOffset + mapTable.size() * sizeof ( SSHTMArchiveEntry );
+    for ( size_t i = 0; i < regionTable.size(); i++ )
+        offset = ( regionTable[i].offset = align8 ( offset ) ) + regionTable[i].size;
+    for ( size_t i = 0; i < mapTable.size(); i++ )
+        offset = ( mapTable[i].offset = align8 ( offset ) ) + mapTable[i].size;
+    
+    // Write everything to file, padding with zeros.
+    
+    FILE *file = fopen ( path.c_str(), "wb" );
+    if ( file == nullptr )
+        return 0;
+    
+    offset = 0;
+    auto write = [&] ( uint64_t start, const void *bytes, size_t size )
+    {
+        static const char zeros[8] = { 0 };
+        bool ok = fwrite ( zeros, 1, start - offset, file ) == start - offset && fwrite ( bytes, 1, size, file ) == size;
+        offset = start + size;
+        return ok;
+    };
+    
+    bool ok = write ( 0, &header, sizeof ( header ) )
+           && write ( header.levelOffset, _magLevels.data(), _magLevels.size() * sizeof ( float ) )
+           && write ( header.regionOffset, regionTable.data(), regionTable.size() * sizeof ( SSHTMArchiveEntry ) )
+           && write ( header.mapOffset, mapTable.data(), mapTable.size() * sizeof ( SSHTMArchiveEntry ) );
+    
+    for ( size_t i = 0; ok && i < regionTable.size(); i++ )
+        ok = write ( regionTable[i].offset, regionData[i].data(), regionData[i].size() );
+    for ( size_t i = 0; ok && i < mapTable.size(); i++ )
+        ok = write ( mapTable[i].offset, mapData[i].data(), mapData[i].size() );
+    
+    if ( fclose ( file ) != 0 || ! ok )
+        return 0;
+    
+    return (int) regionTable.size();
+}
 
-double anchor[][3] = {
-  {0.0L,  0.0L,  1.0L}, // 0
-  {1.0L,  0.0L,  0.0L}, // 1
-  {0.0L,  1.0L,  0.0L}, // 2
-  {-1.0L,  0.0L,  0.0L}, // 3
-  {0.0L, -1.0L,  0.0L}, // 4
-  {0.0L,  0.0L, -1.0L}  // 5
-};
+// Opens an archive file (path), memory-mapped if possible; otherwise keeps the file open to read regions from it.
+// Any previous archive is closed first. Sets magnitude levels from the archive. Returns false if the file can't be
+// read, or is not a valid archive written in this version and byte order; then no archive is open.
 
-struct _bases {
-    const char *name;
-    int ID;
-    int v1, v2, v3;
-} bases[] = {
-    {"S2", 10, 3, 5, 4},
-    {"N1", 13, 4, 0, 3},
-    {"S1", 9, 2, 5, 3},
-    {"N2", 14, 3, 0, 2},
-    {"S3", 11, 4,5,1},
-    {"N0", 12, 1, 0, 4},
-    {"S0", 8, 1, 5, 2},
-    {"N3", 15, 2, 0, 1}
-};
+bool SSHTM::openArchive ( const string &path )
+{
+    closeArchive();
+    
+    shared_ptr<Archive> archive ( new Archive() );
+    archive->map = (const char *) mapfile ( path, archive->mapSize );
+    if ( archive->map == nullptr )
+    {
+        archive->file = fopen ( path.c_str(), "rb" );
+        if ( archive->file == nullptr )
+            return false;
+    }
+    
+    return installArchive ( archive );
+}
 
-int S_indexes[][3] = {
-  {1, 5, 2}, //S0
-  {2, 5, 3}, //S1
-  {3, 5, 4}, //S2
-  {4, 5, 1} //S3
-};
-int N_indexes[][3] = {
-  {1, 0, 4}, //N0
-  {4, 0, 3}, //N1
-  {3, 0, 2}, //N2
-  {2, 0, 1} //N3
-};
+// Opens an archive from its entire contents in memory (bytes), which this HTM takes.
 
-int cc_startpane(
-         double *v1, double *v2, double *v3,
-         double xin, double yin, double zin, char *name)
+bool SSHTM::openArchive ( vector<char> &&bytes )
 {
-  int ix = (xin > 0 ? 4 : 0) + (yin > 0 ? 2 : 0) + (zin > 0 ? 1 : 0);
-  double *tvec;
-  const char *s;
-  int baseID;
+    closeArchive();
+    
+    shared_ptr<Archive> archive ( new Archive() );
+    archive->bytes = move ( bytes );
+    archive->map = archive->bytes.data();
+    archive->mapSize = archive->bytes.size();
+    return archive->mapSize > 0 && installArchive ( archive );
+}
 
-  // printf("Startpane %f %f %f, (%d)\n", xin, yin, zin, ix);
+// Private method validates an archive's header, reads its magnitude levels, region and map tables,
+// and makes it this HTM's open archive. Returns false if the archive is invalid.
 
-  baseID = bases[ix].ID;
+bool SSHTM::installArchive ( shared_ptr<Archive> archive )
+{
+    SSHTMArchiveHeader header = { { 0 } };
+    uint64_t size = 0;
     
-  tvec = anchor[bases[ix].v1];
-  v1[0] = tvec[0];
-  v1[1] = tvec[1];
-  v1[2] = tvec[2];
+    if ( archive->map != nullptr )
+    {
+        size = archive->mapSize;
+        if ( size >= sizeof ( header ) )
+            memcpy ( &header, archive->map, sizeof ( header ) );
+    }
+    else
+    {
+        if ( fread ( &header, sizeof ( header ), 1, archive->file ) != 1 || fseek ( archive->file, 0, SEEK_END ) != 0 )
+            return false;
+        size = ftell ( archive->file );
+    }
+    
+    if ( memcmp ( header.magic, kHTMArchiveMagic, sizeof ( header.magic ) ) != 0 || header.version != kHTMArchiveVersion || header.byteOrder != kBinaryCatalogByteOrder )
+        return false;
+    
+    // Read magnitude levels, region and map tables; check that all tables and data are inside the file.
+    
+    auto inside = [size] ( uint64_t offset, uint64_t count, uint64_t itemSize )
+    {
+        return offset % 8 == 0 && offset <= size && count <= ( size - offset ) / itemSize;
+    };
+    
+    auto readTable = [&] ( uint64_t offset, uint64_t count, size_t itemSize, void *table )
+    {
+        if ( ! inside ( offset, count, itemSize ) )
+            return false;
+        
+        if ( archive->map != nullptr )
+        {
+            memcpy ( table, archive->map + offset, count * itemSize );
+            return true;
+        }
+        
+        return fseek ( archive->file, (long) offset, SEEK_SET ) == 0 && fread ( table, itemSize, count, archive->file ) == count;
+    };
+    
+    archive->magLevels.resize ( header.numLevels );
+    archive->regions.resize ( header.numRegions );
+    archive->maps.resize ( header.numMaps );
+    if ( ! readTable ( header.levelOffset, header.numLevels, sizeof ( float ), archive->magLevels.data() )
+      || ! readTable ( header.regionOffset, header.numRegions, sizeof ( SSHTMArchiveEntry ), archive->regions.data() )
+      || ! readTable ( header.mapOffset, header.numMaps, sizeof ( SSHTMArchiveEntry ), archive->maps.data() ) )
+        return false;
+    
+    for ( const vector<SSHTMArchiveEntry> *table : { &archive->regions, &archive->maps } )
+        for ( const SSHTMArchiveEntry &entry : *table )
+            if ( ! inside ( entry.offset, entry.size, 1 ) )
+                return false;
+    
+    _magLevels = archive->magLevels;
+    atomic_store ( &_archive, archive );
+    return true;
+}
 
-  tvec = anchor[bases[ix].v2];
-  v2[0] = tvec[0];
-  v2[1] = tvec[1];
-  v2[2] = tvec[2];
+// Closes the open archive, if any. Region loads in progress finish reading from it first.
 
-  tvec = anchor[bases[ix].v3];
-  v3[0] = tvec[0];
-  v3[1] = tvec[1];
-  v3[2] = tvec[2];
+void SSHTM::closeArchive ( void )
+{
+    atomic_store ( &_archive, shared_ptr<Archive>() );
+}
 
-  s = bases[ix].name;
-  name[0] = *s++;
-  name[1] = *s++;
-  name[2] = '\0';
-  return baseID;
+// Tests whether star data for a specific region in this HTM has been
+// loaded into memory, i.e. if that region exists in this HTM.
+
+bool SSHTM::regionLoaded ( uint64_t htmID )
+{
+    return getObjects ( htmID ) != nullptr;
 }
 
-double cc_Epsilon = 1.0E-15;
-double cc_sqrt3    = 1.7320508075688772935;
+// Returns pointer to array of objects stored in the region
+// with the specified HTM triangle ID. If region is not present
+// in this HTM or objects have not been loaded, returns nullptr.
 
-#define m4_midpoint(v1, v2, w, tmp){\
-    w[0] = v1[0] + v2[0]; w[1] = v1[1] + v2[1]; w[2] = v1[2] + v2[2]; \
-    tmp = sqrt(w[0] * w[0] + w[1] * w[1] + w[2]*w[2]);\
-    w[0] /= tmp; w[1] /= tmp; w[2] /= tmp;}
+SSObjectVec *SSHTM::getObjects ( uint64_t htmID )
+{
+    Region *pRegion = getRegion ( htmID );
+    return pRegion ? pRegion->objects : nullptr;
+}
 
-#define copy_vec(d, s) { d[0] = s[0]; d[1] = s[1]; d[2] = s[2]; }
+// Private method returns pointer to region with the specified HTM triangle ID, and marks it as most recently used;
+// or returns nullptr if region is not present in this HTM.
 
-uint64_t cc_vector2ID(double x, double y, double z, int depth)
+SSHTM::Region *SSHTM::getRegion ( uint64_t htmID )
 {
-  uint64_t rstat = 0;
-  int startID;
-  char name[80];
-  int len = 0;
+    return findRegion ( *getRegionMap(), htmID );
+}
 
-  double v1[3], v2[3], v0[3];
-  double w1[3], w2[3], w0[3];
-  double p[3];
-  double dtmp;
+// Private method returns pointer to region in a snapshot of the region map (regions) with the specified HTM triangle ID,
+// and marks it as most recently used; or returns nullptr if region is not present in the snapshot.
 
-  p[0] = x;
-  p[1] = y;
-  p[2] = z;
+SSHTM::Region *SSHTM::findRegion ( const RegionMap &regions, uint64_t htmID )
+{
+    auto it = regions.find ( htmID );
+    if ( it == regions.end() )
+        return nullptr;
+    
+    it->second->lastUse.store ( ++_useClock, memory_order_relaxed );
+    return it->second.get();
+}
 
-  // Get the ID of the level0 triangle, and its starting vertices
+// Returns total number of objects in regions loaded from data files.
 
-  startID = cc_startpane(v0, v1, v2, x, y, z, name);
-  len = 2;
+size_t SSHTM::getLoadedObjects ( void )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _regionMutex );
+#endif
+    return _loadedObjects;
+}
 
-  // Start searching for the children
+// Returns total memory used by regions loaded from data files, in bytes.
 
-  while(depth-- > 0){
-    m4_midpoint(v0, v1, w2, dtmp);
-    m4_midpoint(v1, v2, w0, dtmp);
-    m4_midpoint(v2, v0, w1, dtmp);
+size_t SSHTM::getLoadedBytes ( void )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _regionMutex );
+#endif
+    return _loadedBytes;
+}
 
-    if (cc_isinside(p, v0, w2, w1)) {
-      name[len++] = '0';
-      copy_vec(v1, w2);
-      copy_vec(v2, w1);
-    }
-    else if (cc_isinside(p, v1, w0, w2)) {
-      name[len++] = '1';
-      copy_vec(v0, v1);
-      copy_vec(v1, w0);
-      copy_vec(v2, w2);
-    }
-    else if (cc_isinside(p, v2, w1, w0)) {
-      name[len++] = '2';
-      copy_vec(v0, v2);
-      copy_vec(v1, w1);
-      copy_vec(v2, w0);
+// Returns memory currently used by the objects in a region (htmID), in bytes, or zero if the region isn't in memory.
+// Unlike Region::bytes, this includes changes made to the region's objects since it was loaded.
+
+size_t SSHTM::getRegionBytes ( uint64_t htmID )
+{
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    auto it = regions->find ( htmID );
+    return it == regions->end() ? 0 : it->second->objects->memoryUsage();
+}
+
+// Returns memory currently used by all regions in memory at each mesh level, in bytes, indexed by level;
+// the vector has one element per magnitude level.
+
+vector<size_t> SSHTM::getLevelBytes ( void )
+{
+    vector<size_t> bytes ( _magLevels.size(), 0 );
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    
+    for ( auto &region : *regions )
+    {
+        size_t level = IDlevel ( region.first );
+        if ( level >= bytes.size() )
+            bytes.resize ( level + 1, 0 );
+        bytes[level] += region.second->objects->memoryUsage();
     }
-    else if (cc_isinside(p, w0, w1, w2)) {
-      name[len++] ='3';
-      copy_vec(v0, w0);
-      copy_vec(v1, w1);
-      copy_vec(v2, w2);
-    }
-    else {
-      return HTM_INVALID_ID;
-    }
-  }
-  name[len] = '\0';
-  rstat = cc_name2ID(name);
-  return rstat;
+    
+    return bytes;
 }
 
-int cc_isinside ( const double *p, const double *v1, const double *v2, const double *v3 )
-{
-  double crossp[3];
-  // if (v1 X v2) . p < epsilon then false
-  // same for v2 X v3 and v3 X v1.
-  // else return true..
-  crossp[0] = v1[1] * v2[2] - v2[1] * v1[2];
-  crossp[1] = v1[2] * v2[0] - v2[2] * v1[0];
-  crossp[2] = v1[0] * v2[1] - v2[0] * v1[1];
-  if (p[0] * crossp[0] + p[1] * crossp[1] + p[2] * crossp[2] < -gEpsilon)
-    return 0;
+// Returns memory used by the name, identifier, and case-folded name indexes, in bytes, including the tree nodes
+// of the per-catalog maps. Interned name strings belong to their string pool, and aren't counted here.
 
-  crossp[0] = v2[1] * v3[2] - v3[1] * v2[2];
-  crossp[1] = v2[2] * v3[0] - v3[2] * v2[0];
-  crossp[2] = v2[0] * v3[1] - v3[0] * v2[1];
-  if (p[0] * crossp[0] + p[1] * crossp[1] + p[2] * crossp[2] < -gEpsilon)
-    return 0;
+size_t SSHTM::getIndexBytes ( void )
+{
+    size_t node = sizeof ( void * ) * 3 + sizeof ( int );    // red-black tree node links and color
+    size_t bytes = 0;
+    
+    shared_ptr<const NameMap> nameIndex = getNameIndex();
+    bytes += heapbytes ( sizeof ( NameMap ) ) + heapbytes ( nameIndex->capacity() * sizeof ( NameMap::value_type ) );
+    
+    shared_ptr<const IdentIndex> identIndex = getIdentIndex();
+    bytes += heapbytes ( sizeof ( IdentIndex ) );
+    for ( auto &index : *identIndex )
+        bytes += heapbytes ( node + sizeof ( index ) ) + heapbytes ( sizeof ( IdentMap ) ) + heapbytes ( index.second->capacity() * sizeof ( IdentMap::value_type ) );
+    
+    shared_ptr<const FoldedNameMap> foldedIndex = getFoldedNameIndex();
+    bytes += heapbytes ( sizeof ( FoldedNameMap ) ) + heapbytes ( foldedIndex->capacity() * sizeof ( FoldedNameMap::value_type ) );
+    for ( auto &entry : *foldedIndex )
+        bytes += strbytes ( entry.first );
+    
+    return bytes;
+}
 
-  crossp[0] = v3[1] * v1[2] - v1[1] * v3[2];
-  crossp[1] = v3[2] * v1[0] - v1[2] * v3[0];
-  crossp[2] = v3[0] * v1[1] - v1[0] * v3[1];
-  if (p[0] * crossp[0] + p[1] * crossp[1] + p[2] * crossp[2] < -gEpsilon)
-    return 0;
+// Deletes least recently used regions loaded from data files until within memory budget.
+// Regions at pinned levels are never evicted. Returns number of regions evicted.
 
-  return 1;
+int SSHTM::evictRegions ( void )
+{
+    return _evictRegions ( UINT64_MAX );
 }
 
-uint64_t cc_name2ID(const char *name)
-{
-  uint64_t out=0, i;
-  size_t siz = 0;
+// Private implementation of evictRegions() which never evicts a particular region (keepID).
+// Publishes a region map without the evicted regions, then calls the eviction callback
+// for each of them; their objects are deleted when no other thread is searching them.
 
-  if(name == 0)              // null pointer-name
-    return 0;
-  if(name[0] != 'N' && name[0] != 'S')  // invalid name
-    return 0;
+int SSHTM::_evictRegions ( uint64_t keepID )
+{
+    vector<pair<uint64_t,shared_ptr<Region>>> evicted;
+    
+    {
+#if USE_THREADS
+        lock_guard<mutex> lock ( _regionMutex );
+#endif
+        if ( ( _maxObjects == 0 || _loadedObjects <= _maxObjects ) && ( _maxBytes == 0 || _loadedBytes <= _maxBytes ) )
+            return 0;
+        
+        // Sort evictable regions from least to most recently used; remove them until within budget.
+        
+        shared_ptr<RegionMap> regions ( new RegionMap ( *getRegionMap() ) );
+        for ( auto it = regions->begin(); it != regions->end(); it++ )
+            if ( it->second->loaded && it->first != keepID && IDlevel ( it->first ) >= _pinLevels )
+                evicted.push_back ( *it );
+        
+        sort ( evicted.begin(), evicted.end(), [] ( const pair<uint64_t,shared_ptr<Region>> &r1, const pair<uint64_t,shared_ptr<Region>> &r2 )
+        {
+            return r1.second->lastUse.load ( memory_order_relaxed ) < r2.second->lastUse.load ( memory_order_relaxed );
+        } );
+        
+        size_t n = 0;
+        while ( n < evicted.size() && ( ( _maxObjects && _loadedObjects > _maxObjects ) || ( _maxBytes && _loadedBytes > _maxBytes ) ) )
+        {
+            _loadedObjects -= evicted[n].second->numObjects;
+            _loadedBytes -= evicted[n].second->bytes;
+            regions->erase ( evicted[n].first );
+            n++;
+        }
+        
+        evicted.resize ( n );
+        atomic_store ( &_regions, shared_ptr<const RegionMap> ( regions ) );
+    }
+    
+    if ( _evictCallback != nullptr )
+        for ( auto &region : evicted )
+            _evictCallback ( this, region.first );
+    
+    return (int) evicted.size();
+}
 
-  siz = strlen(name);       // determine string length
-  // at least size-2 required, don't exceed max
-  if(siz < 2)
-    return 0;
-  if(siz > HTMNAMEMAX)
-    return 0;
+// Deletes all star data for a specific region in this HTM from memory.
 
-  for(i = siz-1; i > 0; i--) {// set bits starting from the end
-    if(name[i] > '3' || name[i] < '0') {// invalid name
-      return 0;
+void SSHTM::dumpRegion ( uint64_t htmID )
+{
+#if USE_THREADS
+    // If still queued for loading, cancel that; if loading this region asynchronously now, wait for load to complete.
+    
+    cancelLoad ( htmID );
+    {
+        unique_lock<mutex> lock ( _loadMutex );
+        waitForLoad ( lock, htmID );
     }
-    out += ( (uint64_t)(name[i]-'0')) << 2*(siz - i -1);
-  }
+    
+    lock_guard<mutex> lock ( _regionMutex );
+#endif
 
-  i = 2;                     // set first pair of bits, first bit always set
-  if(name[0]=='N') i++;      // for north set second bit too
-  out += (i << (2*siz - 2) );
-  return out;
+    // Now publish a region map without this region; its objects are deleted with the old map.
+    
+    shared_ptr<const RegionMap> oldRegions = getRegionMap();
+    auto it = oldRegions->find ( htmID );
+    if ( it != oldRegions->end() )
+    {
+        if ( it->second->loaded )
+        {
+            _loadedObjects -= it->second->numObjects;
+            _loadedBytes -= it->second->bytes;
+        }
+        
+        shared_ptr<RegionMap> regions ( new RegionMap ( *oldRegions ) );
+        regions->erase ( htmID );
+        atomic_store ( &_regions, shared_ptr<const RegionMap> ( regions ) );
+    }
 }
 
-int cc_IDlevel(uint64_t htmid)
-{
-  uint32_t size=0, i;
-
-  // determine index of first set bit
-  for(i = 0; i < IDSIZE; i+=2) {
-    if ( (htmid << i) & IDHIGHBIT ) break;
-    if ( (htmid << i) & IDHIGHBIT2 )  // invalid id
-      return HTM_INVALID_ID;
-  }
-  if(htmid == 0)
-    return HTM_INVALID_ID;
+// Deletes all star data for all regions in this HTM from memory.
 
-  size=(IDSIZE-i) >> 1;
-  /* Size is the length of the string representing the name of the
-     trixel, the level is size - 2
-  */
-  return size-2;
+void SSHTM::dumpRegions ( void )
+{
+#if USE_THREADS
+    // Cancel queued loads, and let all loads in progress run to completion before destroying regions!
+    
+    cancelLoads();
+    {
+        unique_lock<mutex> lock ( _loadMutex );
+        _loadFinished.wait ( lock, [this] { return _loadingRegions.empty(); } );
+    }
+    
+    lock_guard<mutex> lock ( _regionMutex );
+#endif
+    
+    // Now publish an empty region map; objects in all regions are deleted with the old map.
+    
+    atomic_store ( &_regions, shared_ptr<const RegionMap> ( new RegionMap() ) );
+    _loadedObjects = _loadedBytes = 0;
+    _emptyRegions.clear();
 }
 
-int cc_ID2name(char *name, uint64_t id)
-{
-  uint32_t size=0, i;
-  int c; // a spare character;
+// Counts total number of stars stored in all regions in this HTM.
 
-  // determine index of first set bit
-  for(i = 0; i < IDSIZE; i+=2) {
-    if ( (id << i) & IDHIGHBIT ) break;
-    if ( (id << i) & IDHIGHBIT2 )  // invalid id
-      return HTM_INVALID_ID;
-  }
-  if(id == 0)
-    return HTM_INVALID_ID;
+int SSHTM::countStars ( void )
+{
+    int count = 0;
+    
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    for ( auto it = regions->begin(); it != regions->end(); it++ )
+        count += it->second->objects->size();
+    
+    return count;
+}
 
-  size=(IDSIZE-i) >> 1;
+// Counts number of stars stored in a single region in this HTM.
 
-  // fill characters starting with the last one
-  for(i = 0; i < size-1; i++) {
-    c =  '0' + (int) ((id >> i*2) & (uint32_t) 3);
-    name[size-i-1] = (char ) c;
-  }
+int SSHTM::countStars ( uint64_t htmID )
+{
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    auto it = regions->find ( htmID );
+    return it == regions->end() ? 0 : (int) it->second->objects->size();
+}
 
-  // put in first character
-  if( (id >> (size*2-2)) & 1 ) {
-    name[0] = 'N';
-  } else {
-    name[0] = 'S';
-  }
-  name[size] = 0; // end string
+// Computes statistics of a region's objects (see RegionStats) when it is saved.
 
-  return 0;
+SSHTM::RegionStats SSHTM::makeStats ( uint64_t htmID, Region &region )
+{
+    RegionStats stats;
+    SSObjectVec &objects = *region.objects;
+    
+    stats.count = objects.size();
+    stats.bytes = objects.memoryUsage();
+    stats.fileBytes = _writeFunc == nullptr ? filesize ( _rootpath + ID2name ( htmID ) + ".csv" ) : 0;
+    for ( size_t i = 0; i < objects.size(); i++ )
+    {
+        float mag = objects[i]->getMagnitude();
+        int bin = kStatsMagBins - 1;
+        if ( ! isinf ( mag ) && ! isnan ( mag ) )
+        {
+            stats.minMag = min ( stats.minMag, mag );
+            stats.maxMag = max ( stats.maxMag, mag );
+            bin = clamp ( (int) floor ( mag - kStatsMagMin ), 0, kStatsMagBins - 1 );
+        }
+        stats.magCounts[bin]++;
+    }
+    
+    return stats;
 }
 
-int cc_name2Triangle(const char *name, double *v0, double *v1, double *v2)
-{
-  int rstat = 0;
-  const char *s;
-  double w1[3], w2[3], w0[3];
-  double dtmp;
+// Replaces statistics of regions (stats) in a copy of the statistics map, then publishes the copy.
 
-  // Get the top level hemi-demi-semi space
+void SSHTM::updateStats ( const vector<pair<uint64_t,RegionStats>> &stats )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _statsMutex );
+#endif
+    StatsMap *pMap = new StatsMap ( *atomic_load ( &_stats ) );
+    for ( auto &it : stats )
+        ( *pMap )[ it.first ] = it.second;
+    atomic_store ( &_stats, shared_ptr<const StatsMap> ( pMap ) );
+}
 
-  int k;
-  int anchor_offsets[3];
-  k = (int) name[1] - '0';
+// Saves region statistics as CSV text, one region per line: region name, object count, memory bytes, file bytes,
+// brightest and faintest magnitudes, then the magnitude histogram's counts.
 
-  if (name[0] == 'S') {
-    anchor_offsets[0] = S_indexes[k][0];
-    anchor_offsets[1] = S_indexes[k][1];
-    anchor_offsets[2] = S_indexes[k][2];
-  } else {
-    anchor_offsets[0] = N_indexes[k][0];
-    anchor_offsets[1] = N_indexes[k][1];
-    anchor_offsets[2] = N_indexes[k][2];
-  }
+bool SSHTM::saveStats ( void )
+{
+    ofstream file ( _rootpath + "Stats.csv", ios::trunc );
+    if ( ! file )
+        return false;
+    
+    shared_ptr<const StatsMap> stats = atomic_load ( &_stats );
+    for ( auto &it : *stats )
+    {
+        const RegionStats &s = it.second;
+        file << ID2name ( it.first ) << "," << s.count << "," << s.bytes << "," << s.fileBytes << ","
+             << ( isinf ( s.minMag ) ? string() : format ( "%.2f", s.minMag ) ) << ","
+             << ( isinf ( s.maxMag ) ? string() : format ( "%.2f", s.maxMag ) );
+        for ( int i = 0; i < kStatsMagBins; i++ )
+            file << "," << s.magCounts[i];
+        file << endl;
+    }
+    
+    return (bool) file;
+}
 
-  s = name+2;
-  copy_vec(v0, anchor[anchor_offsets[0]]);
-  copy_vec(v1, anchor[anchor_offsets[1]]);
-  copy_vec(v2, anchor[anchor_offsets[2]]);
+// Loads region statistics from CSV text written by saveStats(), replacing any in memory.
 
-  while(*s){
-    m4_midpoint(v0, v1, w2, dtmp);
-    m4_midpoint(v1, v2, w0, dtmp);
-    m4_midpoint(v2, v0, w1, dtmp);
-    switch(*s) {
-    case '0':
-      copy_vec(v1, w2);
-      copy_vec(v2, w1);
-      break;
-    case '1':
-      copy_vec(v0, v1);
-      copy_vec(v1, w0);
-      copy_vec(v2, w2);
-      break;
-    case '2':
-      copy_vec(v0, v2);
-      copy_vec(v1, w1);
-      copy_vec(v2, w0);
-      break;
-    case '3':
-      copy_vec(v0, w0);
-      copy_vec(v1, w1);
-      copy_vec(v2, w2);
-      break;
+bool SSHTM::loadStats ( void )
+{
+    SSLineReader file ( _rootpath + "Stats.csv" );
+    if ( ! file )
+        return false;
+    
+    StatsMap *pMap = new StatsMap();
+    string line;
+    while ( file.getline ( line ) )
+    {
+        vector<string> fields = split_csv ( line );
+        if ( fields.size() < 6 + kStatsMagBins )
+            continue;
+        
+        RegionStats s;
+        s.count = strtoint64 ( fields[1] );
+        s.bytes = strtoint64 ( fields[2] );
+        s.fileBytes = strtoint64 ( fields[3] );
+        s.minMag = fields[4].empty() ? INFINITY : strtofloat ( fields[4] );
+        s.maxMag = fields[5].empty() ? -INFINITY : strtofloat ( fields[5] );
+        for ( int i = 0; i < kStatsMagBins; i++ )
+            s.magCounts[i] = (uint32_t) strtoint64 ( fields[6 + i] );
+        ( *pMap )[ name2ID ( fields[0] ) ] = s;
     }
-    s++;
-  }
-  return rstat;
+    
+#if USE_THREADS
+    lock_guard<mutex> lock ( _statsMutex );
+#endif
+    atomic_store ( &_stats, shared_ptr<const StatsMap> ( pMap ) );
+    return true;
 }
 
-// Creates a map of objects in this HTM with identifiers in the specific catalog (cat).
-// Assumes entire HTM, including all regions and objects therein, is loaded into memory!
-// Returns number of index entries generated.
+// Gets statistics for a region (htmID), whether loaded or not; returns false if it has none.
 
-size_t SSHTM::makeObjectMap ( SSCatalog cat )
+bool SSHTM::getStats ( uint64_t htmID, RegionStats &stats )
 {
-    NameMap  nameMap;
-    IdentMap identMap;
-
-    for ( auto it = _regions.begin(); it != _regions.end(); it++ )
-        makeObjectMap ( cat, it->first, nameMap, identMap );
+    shared_ptr<const StatsMap> map = atomic_load ( &_stats );
+    auto it = map->find ( htmID );
+    if ( it == map->end() )
+        return false;
     
-    if ( cat == kCatUnknown && nameMap.size() > 0 )
-        _nameIndex.insert ( { cat, nameMap } );
-    if ( cat != kCatUnknown && identMap.size() > 0 )
-        _identIndex.insert ( { cat, identMap } );
+    stats = it->second;
+    return true;
+}
+
+// Returns true if a region (id) is a region (htmID) or one of its sub-regions. Every region is inside the origin (0);
+// below it, a region's ID is its parent's ID times 4 plus 0 to 3.
+
+static bool insideRegion ( uint64_t id, int idLevel, uint64_t htmID, int htmLevel )
+{
+    if ( htmID == 0 )
+        return true;
+    
+    return id != 0 && idLevel >= htmLevel && ( id >> ( 2 * ( idLevel - htmLevel ) ) ) == htmID;
+}
+
+size_t SSHTM::estimateStars ( uint64_t htmID, float magLimit )
+{
+    shared_ptr<const StatsMap> map = atomic_load ( &_stats );
+    int level = IDlevel ( htmID );
+    size_t count = 0;
+    
+    for ( auto &it : *map )
+    {
+        const RegionStats &s = it.second;
+        if ( ! insideRegion ( it.first, IDlevel ( it.first ), htmID, level ) )
+            continue;
+        
+        if ( magLimit > s.maxMag && s.magCounts[kStatsMagBins - 1] == 0 )
+            count += s.count;
+        else if ( magLimit > s.minMag )
+            for ( int i = 0; i < kStatsMagBins - 1 && magLimit > i + kStatsMagMin; i++ )
+                count += s.magCounts[i];
+    }
+    
+    return count;
+}
+
+size_t SSHTM::estimateBytes ( uint64_t htmID )
+{
+    shared_ptr<const StatsMap> map = atomic_load ( &_stats );
+    int level = IDlevel ( htmID );
+    size_t bytes = 0;
+    
+    for ( auto &it : *map )
+        if ( insideRegion ( it.first, IDlevel ( it.first ), htmID, level ) )
+            bytes += it.second.bytes;
+    
+    return bytes;
+}
+
+// Given a unit vector to a point on the celestial sphere, returns the HTM ID
+// of the triangle containing that vector at a specific HTM depth level.
+
+uint64_t SSHTM::vector2ID ( const SSVector &vector, int depth )
+{
+    return cc_vector2ID ( vector.x, vector.y, vector.z, depth );
+}
+
+// Given an HTM triangle name, returns the HTM ID of that triangle,
+// or zero if the name is not a valid HTM name.
+
+uint64_t SSHTM::name2ID ( const string &name )
+{
+    if ( name.compare ( "O0" ) == 0 )
+        return 0;
+    
+    return cc_name2ID ( name.c_str() );
+}
+
+// Given an HTM triangle ID, returns the depth level of that triangle.
+// The whole celestrial sphere is level zero; the eight level 1 triangles
+// are N0 - N3 and S0 - S3; level 2 triangles are N00 - N33 and S00 - S33.
+
+int SSHTM::IDlevel ( uint64_t id )
+{
+    return id == 0 ? 0 : cc_IDlevel ( id ) + 1;
+}
+
+// Given an HTM triangle ID, returns the triangle's HTM name string,
+// or an empty string if the ID is not a valid HTM ID.
+
+string SSHTM::ID2name ( uint64_t id )
+{
+    if ( id == 0 )
+        return string ( "O0" );
+    
+    char name[64] = { 0 };
+    cc_ID2name ( name, id );
+    return string ( name );
+}
+
+// Given an HTM triangle name, computes unit vectors to the triangle's three vertices
+// on the unit sphere (v0, v1, v2).  Returns true if the name is valid, or false otherwise.
+
+bool SSHTM::name2Triangle ( const string &name, SSVector &v0, SSVector &v1, SSVector &v2 )
+{
+    return cc_name2Triangle ( name.c_str(), &v0.x, &v1.x, &v2.x ) == 0;
+}
+
+// Given an HTM triangle ID, computes unit vectors to the triangle's three vertices directly from the ID's bits,
+// without converting the ID to a name; the vertices are identical to name2Triangle ( ID2name ( id ) ).
+// Returns true if the ID is a valid HTM triangle ID (not the origin region), or false otherwise.
+
+bool SSHTM::ID2Triangle ( uint64_t id, SSVector &v0, SSVector &v1, SSVector &v2 )
+{
+    return cc_ID2Triangle ( id, &v0.x, &v1.x, &v2.x ) == 0;
+}
+
+// Dot product of two vectors which, unlike SSVector::operator * (), may be const.
+
+static inline double dot_product ( const SSVector &a, const SSVector &b )
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+// Returns cached geometry of an HTM triangle (htmID), computing it on first use.
+
+const SSHTM::Trixel &SSHTM::getTrixel ( uint64_t htmID, TrixelLookup &lookup )
+{
+    if ( ! lookup.cached )
+        lookup.cached = atomic_load ( &_trixels );
+    
+    auto it = lookup.cached->find ( htmID );
+    if ( it != lookup.cached->end() )
+        return it->second;
+    
+    it = lookup.computed.find ( htmID );
+    if ( it != lookup.computed.end() )
+        return it->second;
+    
+    Trixel t;
+    ID2Triangle ( htmID, t.v0, t.v1, t.v2 );
+    t.center = ( t.v0 + t.v1 + t.v2 ).normalize();
+    t.radius = max ( max ( t.center.angularSeparation ( t.v0 ), t.center.angularSeparation ( t.v1 ) ), t.center.angularSeparation ( t.v2 ) );
+    t.cosRadius = cos ( t.radius );
+    t.sinRadius = sin ( t.radius );
+    return lookup.computed.insert ( { htmID, t } ).first->second;
+}
+
+// Merges trixels computed during a lookup into the trixel cache, and publishes it.
+
+void SSHTM::publishTrixels ( TrixelLookup &lookup )
+{
+    if ( lookup.computed.empty() )
+        return;
+    
+#if USE_THREADS
+    lock_guard<mutex> lock ( _trixelMutex );
+#endif
+    shared_ptr<TrixelMap> trixels ( new TrixelMap ( *atomic_load ( &_trixels ) ) );
+    trixels->insert ( lookup.computed.begin(), lookup.computed.end() );
+    atomic_store ( &_trixels, shared_ptr<const TrixelMap> ( trixels ) );
+}
+
+// Given a unit vector to a point on the celestial sphere (p), determines if p is inside
+// the triangle on the celestial sphere whose vertices are the unit vectors (v0, v1, v2).
+
+bool SSHTM::isinside ( const SSVector &p, const SSVector &v0, SSVector &v1, SSVector &v2 )
+{
+    return cc_isinside ( &p.x, &v0.x, &v1.x, &v2.x );
+}
+
+// Original C HTM implementation from Johns Hopkins in cc_aux.c was downloaded from:
+// http://www.skyserver.org/htm/implementation.aspx#download
+// This is a cleaned-up version of that code.
+
+#define IDSIZE 64
+#define IDHIGHBIT  0x8000000000000000LL
+#define IDHIGHBIT2 0x4000000000000000LL
+
+#define HTM_INVALID_ID 0
+#define HTMNAMEMAX     32
+
+static const double gEpsilon = 1.0E-15;
+
+double anchor[][3] = {
+  {0.0L,  0.0L,  1.0L}, // 0
+  {1.0L,  0.0L,  0.0L}, // 1
+  {0.0L,  1.0L,  0.0L}, // 2
+  {-1.0L,  0.0L,  0.0L}, // 3
+  {0.0L, -1.0L,  0.0L}, // 4
+  {0.0L,  0.0L, -1.0L}  // 5
+};
+
+struct _bases {
+    const char *name;
+    int ID;
+    int v1, v2, v3;
+} bases[] = {
+    {"S2", 10, 3, 5, 4},
+    {"N1", 13, 4, 0, 3},
+    {"S1", 9, 2, 5, 3},
+    {"N2", 14, 3, 0, 2},
+    {"S3", 11, 4,5,1},
+    {"N0", 12, 1, 0, 4},
+    {"S0", 8, 1, 5, 2},
+    {"N3", 15, 2, 0, 1}
+};
+
+int S_indexes[][3] = {
+  {1, 5, 2}, //S0
+  {2, 5, 3}, //S1
+  {3, 5, 4}, //S2
+  {4, 5, 1} //S3
+};
+int N_indexes[][3] = {
+  {1, 0, 4}, //N0
+  {4, 0, 3}, //N1
+  {3, 0, 2}, //N2
+  {2, 0, 1} //N3
+};
+
+int cc_startpane(
+         double *v1, double *v2, double *v3,
+         double xin, double yin, double zin, char *name)
+{
+  int ix = (xin > 0 ? 4 : 0) + (yin > 0 ? 2 : 0) + (zin > 0 ? 1 : 0);
+  double *tvec;
+  const char *s;
+  int baseID;
+
+  // printf("Startpane %f %f %f, (%d)\n", xin, yin, zin, ix);
+
+  baseID = bases[ix].ID;
+    
+  tvec = anchor[bases[ix].v1];
+  v1[0] = tvec[0];
+  v1[1] = tvec[1];
+  v1[2] = tvec[2];
+
+  tvec = anchor[bases[ix].v2];
+  v2[0] = tvec[0];
+  v2[1] = tvec[1];
+  v2[2] = tvec[2];
+
+  tvec = anchor[bases[ix].v3];
+  v3[0] = tvec[0];
+  v3[1] = tvec[1];
+  v3[2] = tvec[2];
+
+  s = bases[ix].name;
+  name[0] = *s++;
+  name[1] = *s++;
+  name[2] = '\0';
+  return baseID;
+}
+
+double cc_Epsilon = 1.0E-15;
+double cc_sqrt3    = 1.7320508075688772935;
+
+#define m4_midpoint(v1, v2, w, tmp){\
+    w[0] = v1[0] + v2[0]; w[1] = v1[1] + v2[1]; w[2] = v1[2] + v2[2]; \
+    tmp = sqrt(w[0] * w[0] + w[1] * w[1] + w[2]*w[2]);\
+    w[0] /= tmp; w[1] /= tmp; w[2] /= tmp;}
+
+#define copy_vec(d, s) { d[0] = s[0]; d[1] = s[1]; d[2] = s[2]; }
+
+uint64_t cc_vector2ID(double x, double y, double z, int depth)
+{
+  uint64_t rstat = 0;
+  int startID;
+  char name[80];
+  int len = 0;
+
+  double v1[3], v2[3], v0[3];
+  double w1[3], w2[3], w0[3];
+  double p[3];
+  double dtmp;
+
+  p[0] = x;
+  p[1] = y;
+  p[2] = z;
+
+  // Get the ID of the level0 triangle, and its starting vertices
+
+  startID = cc_startpane(v0, v1, v2, x, y, z, name);
+  len = 2;
+
+  // Start searching for the children
+
+  while(depth-- > 0){
+    m4_midpoint(v0, v1, w2, dtmp);
+    m4_midpoint(v1, v2, w0, dtmp);
+    m4_midpoint(v2, v0, w1, dtmp);
+
+    if (cc_isinside(p, v0, w2, w1)) {
+      name[len++] = '0';
+      copy_vec(v1, w2);
+      copy_vec(v2, w1);
+    }
+    else if (cc_isinside(p, v1, w0, w2)) {
+      name[len++] = '1';
+      copy_vec(v0, v1);
+      copy_vec(v1, w0);
+      copy_vec(v2, w2);
+    }
+    else if (cc_isinside(p, v2, w1, w0)) {
+      name[len++] = '2';
+      copy_vec(v0, v2);
+      copy_vec(v1, w1);
+      copy_vec(v2, w0);
+    }
+    else if (cc_isinside(p, w0, w1, w2)) {
+      name[len++] ='3';
+      copy_vec(v0, w0);
+      copy_vec(v1, w1);
+      copy_vec(v2, w2);
+    }
+    else {
+      return HTM_INVALID_ID;
+    }
+  }
+  name[len] = '\0';
+  rstat = cc_name2ID(name);
+  return rstat;
+}
+
+int cc_isinside ( const double *p, const double *v1, const double *v2, const double *v3 )
+{
+  double crossp[3];
+  // if (v1 X v2) . p < epsilon then false
+  // same for v2 X v3 and v3 X v1.
+  // else return true..
+  crossp[0] = v1[1] * v2[2] - v2[1] * v1[2];
+  crossp[1] = v1[2] * v2[0] - v2[2] * v1[0];
+  crossp[2] = v1[0] * v2[1] - v2[0] * v1[1];
+  if (p[0] * crossp[0] + p[1] * crossp[1] + p[2] * crossp[2] < -gEpsilon)
+    return 0;
+
+  crossp[0] = v2[1] * v3[2] - v3[1] * v2[2];
+  crossp[1] = v2[2] * v3[0] - v3[2] * v2[0];
+  crossp[2] = v2[0] * v3[1] - v3[0] * v2[1];
+  if (p[0] * crossp[0] + p[1] * crossp[1] + p[2] * crossp[2] < -gEpsilon)
+    return 0;
+
+  crossp[0] = v3[1] * v1[2] - v1[1] * v3[2];
+  crossp[1] = v3[2] * v1[0] - v1[2] * v3[0];
+  crossp[2] = v3[0] * v1[1] - v1[0] * v3[1];
+  if (p[0] * crossp[0] + p[1] * crossp[1] + p[2] * crossp[2] < -gEpsilon)
+    return 0;
+
+  return 1;
+}
+
+uint64_t cc_name2ID(const char *name)
+{
+  uint64_t out=0, i;
+  size_t siz = 0;
+
+  if(name == 0)              // null pointer-name
+    return 0;
+  if(name[0] != 'N' && name[0] != 'S')  // invalid name
+    return 0;
+
+  siz = strlen(name);       // determine string length
+  // at least size-2 required, don't exceed max
+  if(siz < 2)
+    return 0;
+  if(siz > HTMNAMEMAX)
+    return 0;
+
+  for(i = siz-1; i > 0; i--) {// set bits starting from the end
+    if(name[i] > '3' || name[i] < '0') {// invalid name
+      return 0;
+    }
+    out += ( (uint64_t)(name[i]-'0')) << 2*(siz - i -1);
+  }
+
+  i = 2;                     // set first pair of bits, first bit always set
+  if(name[0]=='N') i++;      // for north set second bit too
+  out += (i << (2*siz - 2) );
+  return out;
+}
+
+int cc_IDlevel(uint64_t htmid)
+{
+  uint32_t size=0, i;
+
+  // determine index of first set bit
+  for(i = 0; i < IDSIZE; i+=2) {
+    if ( (htmid << i) & IDHIGHBIT ) break;
+    if ( (htmid << i) & IDHIGHBIT2 )  // invalid id
+      return HTM_INVALID_ID;
+  }
+  if(htmid == 0)
+    return HTM_INVALID_ID;
+
+  size=(IDSIZE-i) >> 1;
+  /* Size is the length of the string representing the name of the
+     trixel, the level is size - 2
+  */
+  return size-2;
+}
+
+int cc_ID2name(char *name, uint64_t id)
+{
+  uint32_t size=0, i;
+  int c; // a spare character;
+
+  // determine index of first set bit
+  for(i = 0; i < IDSIZE; i+=2) {
+    if ( (id << i) & IDHIGHBIT ) break;
+    if ( (id << i) & IDHIGHBIT2 )  // invalid id
+      return HTM_INVALID_ID;
+  }
+  if(id == 0)
+    return HTM_INVALID_ID;
+
+  size=(IDSIZE-i) >> 1;
+
+  // fill characters starting with the last one
+  for(i = 0; i < size-1; i++) {
+    c =  '0' + (int) ((id >> i*2) & (uint32_t) 3);
+    name[size-i-1] = (char ) c;
+  }
+
+  // put in first character
+  if( (id >> (size*2-2)) & 1 ) {
+    name[0] = 'N';
+  } else {
+    name[0] = 'S';
+  }
+  name[size] = 0; // end string
+
+  return 0;
+}
+
+// Same as cc_name2Triangle(), but takes the triangle's subdivision digits from the bits of its ID.
+
+int cc_ID2Triangle(uint64_t id, double *v0, double *v1, double *v2)
+{
+  double w1[3], w2[3], w0[3];
+  double dtmp;
+  int size, i;
+  const int *anchor_offsets;
+
+  // The highest set bit is the first bit of the first pair; size is the length of the name.
+
+  for (size = 0; size < IDSIZE / 2 && (id >> (2 * size)) != 0; size++)
+    ;
+  if (size < 2 || ((id >> (2 * size - 1)) & 1) == 0)
+    return 1;
+
+  anchor_offsets = (id >> (2 * size - 2)) & 1 ? N_indexes[(id >> (2 * size - 4)) & 3] : S_indexes[(id >> (2 * size - 4)) & 3];
+  copy_vec(v0, anchor[anchor_offsets[0]]);
+  copy_vec(v1, anchor[anchor_offsets[1]]);
+  copy_vec(v2, anchor[anchor_offsets[2]]);
+
+  for (i = size - 3; i >= 0; i--) {
+    m4_midpoint(v0, v1, w2, dtmp);
+    m4_midpoint(v1, v2, w0, dtmp);
+    m4_midpoint(v2, v0, w1, dtmp);
+    switch((id >> (2 * i)) & 3) {
+    case 0:
+      copy_vec(v1, w2);
+      copy_vec(v2, w1);
+      break;
+    case 1:
+      copy_vec(v0, v1);
+      copy_vec(v1, w0);
+      copy_vec(v2, w2);
+      break;
+    case 2:
+      copy_vec(v0, v2);
+      copy_vec(v1, w1);
+      copy_vec(v2, w0);
+      break;
+    case 3:
+      copy_vec(v0, w0);
+      copy_vec(v1, w1);
+      copy_vec(v2, w2);
+      break;
+    }
+  }
+  return 0;
+}
+
+int cc_name2Triangle(const char *name, double *v0, double *v1, double *v2)
+{
+  int rstat = 0;
+  const char *s;
+  double w1[3], w2[3], w0[3];
+  double dtmp;
+
+  // Get the top level hemi-demi-semi space
+
+  int k;
+  int anchor_offsets[3];
+  k = (int) name[1] - '0';
+
+  if (name[0] == 'S') {
+    anchor_offsets[0] = S_indexes[k][0];
+    anchor_offsets[1] = S_indexes[k][1];
+    anchor_offsets[2] = S_indexes[k][2];
+  } else {
+    anchor_offsets[0] = N_indexes[k][0];
+    anchor_offsets[1] = N_indexes[k][1];
+    anchor_offsets[2] = N_indexes[k][2];
+  }
+
+  s = name+2;
+  copy_vec(v0, anchor[anchor_offsets[0]]);
+  copy_vec(v1, anchor[anchor_offsets[1]]);
+  copy_vec(v2, anchor[anchor_offsets[2]]);
+
+  while(*s){
+    m4_midpoint(v0, v1, w2, dtmp);
+    m4_midpoint(v1, v2, w0, dtmp);
+    m4_midpoint(v2, v0, w1, dtmp);
+    switch(*s) {
+    case '0':
+      copy_vec(v1, w2);
+      copy_vec(v2, w1);
+      break;
+    case '1':
+      copy_vec(v0, v1);
+      copy_vec(v1, w0);
+      copy_vec(v2, w2);
+      break;
+    case '2':
+      copy_vec(v0, v2);
+      copy_vec(v1, w1);
+      copy_vec(v2, w0);
+      break;
+    case '3':
+      copy_vec(v0, w0);
+      copy_vec(v1, w1);
+      copy_vec(v2, w2);
+      break;
+    }
+    s++;
+  }
+  return rstat;
+}
+
+// Creates a map of objects in this HTM with identifiers in the specific catalog (cat).
+// Assumes entire HTM, including all regions and objects therein, is loaded into memory!
+// Returns number of index entries generated.
+
+size_t SSHTM::makeObjectMap ( SSCatalog cat )
+{
+    NameMap  nameMap;
+    IdentMap identMap;
+
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    for ( auto it = regions->begin(); it != regions->end(); it++ )
+        makeObjectMap ( cat, it->first, nameMap, identMap );
+    
+    size_t n = cat == kCatUnknown ? nameMap.size() : identMap.size();
+    if ( cat == kCatUnknown && n > 0 )
+        publishNameIndex ( nameMap );
+    if ( cat != kCatUnknown && n > 0 )
+        publishIdentMap ( cat, identMap );
+    
+    return n;
+}
+
+// Returns the published identifier index of a catalog (cat), or nullptr if it has none.
+
+shared_ptr<const SSHTM::IdentMap> SSHTM::getIdentMap ( SSCatalog cat ) const
+{
+    shared_ptr<const IdentIndex> index = getIdentIndex();
+    auto it = index->find ( cat );
+    return it == index->end() ? nullptr : it->second;
+}
+
+// Returns number of entries in the name index if catalog (cat) is not specified, otherwise in that catalog's identifier index.
+
+size_t SSHTM::objectMapSize ( SSCatalog cat )
+{
+    if ( cat == kCatUnknown )
+        return getNameIndex()->size();
+    
+    shared_ptr<const IdentMap> pMap = getIdentMap ( cat );
+    return pMap ? pMap->size() : 0;
+}
+
+void SSHTM::publishNameIndex ( NameMap &nameMap, FoldedNameMap *pFolded )
+{
+    nameMap.sort();
+    shared_ptr<const NameMap> pNames ( new NameMap ( move ( nameMap ) ) );
+    
+    FoldedNameMap *pNewFolded = pFolded ? new FoldedNameMap ( move ( *pFolded ) ) : new FoldedNameMap();
+    if ( pFolded == nullptr )
+    {
+        pNewFolded->reserve ( pNames->size() );
+        for ( auto it = pNames->begin(); it != pNames->end(); it++ )
+        {
+            string folded = it->first;
+            toLower ( folded );
+            pNewFolded->insert ( { folded, { it->first, it->second } } );
+        }
+    }
+    
+    pNewFolded->sort();
+    shared_ptr<const FoldedNameMap> pFoldedNames ( pNewFolded );
+    
+#if USE_THREADS
+    lock_guard<mutex> lock ( _indexMutex );
+#endif
+    atomic_store ( &_foldedNameIndex, pFoldedNames );
+    atomic_store ( &_nameIndex, pNames );
+}
+
+void SSHTM::publishIdentMap ( SSCatalog cat, IdentMap &identMap )
+{
+    identMap.sort();
+    shared_ptr<const IdentMap> pMap ( new IdentMap ( move ( identMap ) ) );
+    
+#if USE_THREADS
+    lock_guard<mutex> lock ( _indexMutex );
+#endif
+    IdentIndex *pIndex = new IdentIndex ( *getIdentIndex() );
+    (*pIndex)[cat] = pMap;
+    atomic_store ( &_identIndex, shared_ptr<const IdentIndex> ( pIndex ) );
+}
+
+// Adds index entries for objects with identifiers in the specifid catalog (cat)
+// contained in the HTM region (regionID).
+// Index entries are appended to the provided ObjectIndex (index).
+// The function returns the number of index entries added.
+
+size_t SSHTM::makeObjectMap ( SSCatalog cat, uint64_t regionID, NameMap &nameMap, IdentMap &identMap )
+{
+    size_t n = cat == kCatUnknown ? nameMap.size() : identMap.size();
+    
+    SSObjectVec *pObjects = getObjects ( regionID );
+    size_t nObjects = pObjects ? pObjects->size() : 0;
+    for ( size_t offset = 0; offset < nObjects; offset++ )
+    {
+        SSObjectPtr pObject = pObjects->get ( offset );
+
+        if ( cat == kCatUnknown )
+        {
+            for ( const SSIString &name : pObject->getInternedNames() )
+               nameMap.insert ( { name, { regionID, offset } } );
+        }
+        else
+        {
+            for ( SSIdentifier ident : pObject->getIdentifierSpan() )
+                if ( ident.catalog() == cat )
+                    identMap.insert ( { ident, { regionID, offset } } );
+        }
+    }
+    
+    return ( cat == kCatUnknown ? nameMap.size() : identMap.size() ) - n;
+}
+
+// Saves this HTM's object map for the specified catalog (cat) to a file.
+// Writes objects with user-definded function (saveFunc) and data (userData);
+// if these are nullptr, writes map in CSV format to HTM's "index" subdirectory.
+// Returns number of map entries written to file.
+
+size_t SSHTM::saveObjectMap ( SSCatalog cat, IdentMapFunc saveFunc, void *userData )
+{
+    int n = 0;
+    
+    if ( saveFunc != nullptr && cat != kCatUnknown )
+    {
+        shared_ptr<const IdentMap> pMap = getIdentMap ( cat );
+        IdentMap identMap = pMap ? *pMap : IdentMap();
+        n = saveFunc ( this, cat, &identMap, userData );
+        return n;
+    }
+
+    // Open file; return on failure.
+    
+    string catname = cat == kCatUnknown ? string ( "Name" ) : catalog_to_string ( cat );
+    string filepath ( _rootpath + "index/" + catname + ".csv" );
+    ofstream file ( filepath, ios::trunc );
+    if ( ! file )
+        return n;
+    
+    return writeObjectMap ( cat, file );
+}
+
+// Writes name map if catalog (cat) is not specified, otherwise identifier map, as CSV text to a stream.
+// Returns number of map entries written.
+
+size_t SSHTM::writeObjectMap ( SSCatalog cat, ostream &file )
+{
+    size_t n = 0;
+    
+    if ( cat == kCatUnknown )
+    {
+        shared_ptr<const NameMap> nameMap = getNameIndex();
+        for ( auto it = nameMap->begin(); it != nameMap->end(); it++ )
+        {
+            string name = it->first;
+            ObjectLoc loc = it->second;
+            string htmIDstr = ID2name ( loc.region );
+            file << name << "," << htmIDstr << "," << to_string ( loc.offset ) << endl;
+            n++;
+        }
+    }
+    else
+    {
+        shared_ptr<const IdentMap> identMap = getIdentMap ( cat );
+        if ( identMap == nullptr )
+            return n;
+        
+        for ( auto it = identMap->begin(); it != identMap->end(); it++ )
+        {
+            SSIdentifier ident = it->first;
+            ObjectLoc loc = it->second;
+            string identstr = ident.toString();
+            string htmIDstr = ID2name ( loc.region );
+            file << identstr << "," << htmIDstr << "," << to_string ( loc.offset ) << endl;
+            n++;
+        }
+    }
+    
+    return n;
+}
+
+// Loads an object map for the specified catalog (cat) into this HTM's object indexes.
+// Writes objects with user-definded function (saveFunc) and data (userData);
+// if these are nullptr, reads map in CSV format from HTM's "index" subdirectory.
+// Returns number of map entries read from file.
+
+size_t SSHTM::loadObjectMap ( SSCatalog cat, IdentMapFunc loadFunc, void *userData )
+{
+    int n = 0;
+    NameMap nameMap;
+    IdentMap identMap;
+
+    if ( loadFunc != nullptr && cat != kCatUnknown )
+    {
+        n = loadFunc ( this, cat, &identMap, userData );
+    }
+    else
+    {
+        // Open map in archive if present, otherwise file; return on failure.
+
+        vector<char> buffer;
+        const char *data = nullptr;
+        uint64_t size = 0;
+        shared_ptr<Archive> archive = atomic_load ( &_archive );
+        
+        SSLineReader file;
+        if ( archive != nullptr )
+        {
+            if ( archive->read ( archive->maps, cat, buffer, data, size ) )
+                file.open ( data, size );
+        }
+        else
+        {
+            string catname = cat == kCatUnknown ? string ( "Name" ) : catalog_to_string ( cat );
+            file.open ( _rootpath + "index/" + catname + ".csv" );
+        }
+        
+        if ( ! file )
+            return n;
+
+        // Read file line-by-line until we reach end-of-file
+
+        string line = "";
+        while ( file.getline ( line ) )
+        {
+            vector<string> fields = split_csv ( line );
+            if ( fields.size() < 3 )
+                continue;
+
+            // Read name map if catalog is not specified; otherwise read identifier map.
+            
+            if ( cat == kCatUnknown )
+            {
+                string name = fields[0];
+                if ( ! name.empty() )
+                {
+                    uint64_t htmID = name2ID ( fields[1] );
+                    size_t offset = strtoint64 ( fields[2] );
+                    nameMap.insert ( { name, { htmID, offset } } );
+                    n++;
+                }
+            }
+            else
+            {
+                SSIdentifier ident = SSIdentifier::fromString ( fields[0], kTypeNonexistent, true );
+                if ( ident != 0 )
+                {
+                    uint64_t htmID = name2ID ( fields[1] );
+                    size_t offset = strtoint64 ( fields[2] );
+                    identMap.insert ( { ident, { htmID, offset } } );
+                    n++;
+                }
+            }
+        }
+    }
+    
+    // If we read anything, save the name map or ident map we just read.
+    
+    if ( n > 0 )
+    {
+        if ( cat == kCatUnknown )
+            publishNameIndex ( nameMap );
+        else
+            publishIdentMap ( cat, identMap );
+    }
+
+    return n;
+}
+
+// Given an identifier, uses this HTM's identifier index to find all objects matching
+// the identifier. Object locations are appended to the vector (results).
+// Returns number of object locations found, or -1 if there is no object map
+// for the catalog to which the identifier belongs.
+
+int SSHTM::findObjectLocs ( SSIdentifier ident, vector<SSHTM::ObjectLoc> &results )
+{
+    shared_ptr<const IdentMap> pMap = getIdentMap ( ident.catalog() );
+    if ( pMap == nullptr || pMap->size() == 0 )
+        return -1;
+    
+    auto it0 = pMap->lower_bound ( ident );
+    auto it1 = pMap->upper_bound ( ident );
+    
+    int n = (int) results.size();
+    for ( auto it = it0; it != it1; it++ )
+        results.push_back ( it->second );
+    return (int) results.size() - n;
+}
+
+// Given a name string (name), uses this HTM's name index to find all objects matching the name string.
+// Pass true for (casesens) for Case-Sensitive string matching; pass false for case-insensitive matching.
+// Pass true for (begins) for "begins-with" string matching; pass false for whole-string matching.
+// Object locations are appended to the vector (results); returns number of object locations found.
+// If (maxLocs) is nonzero, no more than that many are found: for case-insensitive or begins-with matching,
+// those with the alphabetically first case-folded names, so exact matches come before longer names.
+
+int SSHTM::findObjectLocs ( const string &name, vector<SSHTM::ObjectLoc> &results, bool casesens, bool begins, size_t maxLocs )
+{
+    shared_ptr<const NameMap> pMap = getNameIndex();
+    if ( pMap->size() == 0 )
+        return -1;
+    
+    int n = (int) results.size();
+    
+    if ( casesens == true && begins == false )
+    {
+        // Names in the map are interned, so a name which was never interned can't match anything;
+        // otherwise comparisons with the interned name start with a pointer compare.
+        
+        const string *pName = SSStringPool::global().find ( name );
+        if ( pName == nullptr )
+            return 0;
+        
+        auto range = pMap->equal_range ( SSIString ( pName ) );
+        for ( auto it = range.first; it != range.second && ( maxLocs == 0 || results.size() - n < maxLocs ); it++ )
+            results.push_back ( it->second );
+    }
+    else
+    {
+        // Names matching case-insensitively, or beginning with the name string, have case-folded names
+        // beginning with the case-folded string, so they are in one range of the case-folded name index,
+        // starting with exact matches. Case-sensitive begins-with matches are also checked with compare().
+        
+        shared_ptr<const FoldedNameMap> pFolded = getFoldedNameIndex();
+        string folded = name;
+        toLower ( folded );
+        
+        for ( auto it = pFolded->lower_bound ( folded ); it != pFolded->end(); it++ )
+        {
+            if ( it->first.compare ( 0, folded.length(), folded ) != 0 )
+                break;
+            
+            if ( ! begins && it->first.length() > folded.length() )
+                break;
+            
+            if ( casesens && compare ( it->second.name, name, name.length(), true ) != 0 )
+                continue;
+            
+            results.push_back ( it->second.loc );
+            if ( maxLocs > 0 && results.size() - n >= maxLocs )
+                break;
+        }
+    }
+    
+    return (int) results.size() - n;
+}
+
+// Given an object location in this HTM, synchronously loads the region containing the object
+// (if not already loaded) and returns a pointer to the object, or nullptr on failure.
+
+SSObjectPtr SSHTM::loadObject ( const ObjectLoc &loc )
+{
+    SSObjectVec *pObjects = loadRegion ( loc.region, true );
+    if ( pObjects )
+        return pObjects->get ( loc.offset );
+    
+    return nullptr;
+}
+
+// Searches an HTM region and all of its sub-regions, recursively, for objects within a circle
+// centered on the celestial sphere at unit direction vector (center) in the fundamental frame,
+// of (radius) radians. Only searches regions pre-loaded into memory; does not load regions.
+// Results are appended to vector (results). Returns number of objects found within circle.
+
+int SSHTM::search ( uint64_t htmID, SSVector center, SSAngle rad, vector<SSObjectPtr> &results )
+{
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    TrixelLookup lookup;
+    
+    int n = _search ( htmID, IDlevel ( htmID ), center.normalize(), rad, cos ( rad ), sin ( rad ), *regions, lookup, results );
+    publishTrixels ( lookup );
+    return n;
+}
+
+// Recursive implementation of search(), given the region's level, the search radius cosine and sine,
+// a snapshot of the region map, and trixel cache lookup.
+
+int SSHTM::_search ( uint64_t htmID, int level, const SSVector &center, SSAngle rad, double cosRad, double sinRad, const RegionMap &regions, TrixelLookup &lookup, vector<SSObjectPtr> &results )
+{
+    // Unless this is the root region, get region center and angular radius. Always search root!
+    // If non-root region's bounding circle does not intersect search circle, don't search it:
+    // that is, if the angle between their centers, whose cosine is their dot product, exceeds the sum of their radii.
+    // If it lies entirely inside the search circle, so do all its objects, and its sub-regions' objects.
+    // A circle of up to 90 degrees is convex, so contains the triangle if it contains its three vertices.
+    
+    if ( htmID > 0 )
+    {
+        const Trixel &t = getTrixel ( htmID, lookup );
+        if ( t.radius + rad < SSAngle::kPi && dot_product ( center, t.center ) < t.cosRadius * cosRad - t.sinRadius * sinRad - 1.0e-12 )
+            return 0;
+        
+        double cosInside = cosRad + 1.0e-12;
+        if ( rad <= SSAngle::kHalfPi && dot_product ( center, t.v0 ) > cosInside && dot_product ( center, t.v1 ) > cosInside && dot_product ( center, t.v2 ) > cosInside )
+            return _searchAll ( htmID, level, regions, results );
+    }
+    
+    // Search this region's objects if they're loaded into memory.
+    // Then recursively search this region's sub-regions.
+    
+    SSObjectVec *pObjects = findObjects ( regions, htmID );
+    int n = pObjects ? pObjects->search ( center, rad, results ) : 0;
+    
+    if ( level >= (int) _magLevels.size() - 1 )
+        return n;
+    
+    if ( level == 0 )
+    {
+        for ( uint64_t subID = 8; subID < 16; subID++ )
+            n += _search ( subID, 1, center, rad, cosRad, sinRad, regions, lookup, results );
+    }
+    else
+    {
+        for ( uint64_t subID = htmID * 4; subID < htmID * 4 + 4; subID++ )
+            n += _search ( subID, level + 1, center, rad, cosRad, sinRad, regions, lookup, results );
+    }
+
+    return n;
+}
+
+// Appends all stars with known positions in a region (htmID) at a level of the mesh, and its sub-regions, to (results),
+// without testing their positions; returns number of stars appended.
+
+int SSHTM::_searchAll ( uint64_t htmID, int level, const RegionMap &regions, vector<SSObjectPtr> &results )
+{
+    int n = 0;
+    SSObjectVec *pObjects = findObjects ( regions, htmID );
+    
+    for ( size_t i = 0; pObjects && i < pObjects->size(); i++ )
+    {
+        SSStar *pStar = SSGetStarPtr ( (*pObjects)[i] );
+        if ( pStar && ! pStar->getFundamentalPosition().isinf() )
+        {
+            results.push_back ( (*pObjects)[i] );
+            n++;
+        }
+    }
+    
+    if ( level < (int) _magLevels.size() - 1 )
+        for ( uint64_t subID = htmID * 4; subID < htmID * 4 + 4; subID++ )
+            n += _searchAll ( subID, level + 1, regions, results );
+    
+    return n;
+}
+
+// Returns true if a unit vector (p) is inside every half-space of a convex polygon.
+
+static bool in_polygon ( const SSHTM::Polygon &polygon, const SSVector &p )
+{
+    for ( const SSHTM::Halfspace &h : polygon )
+        if ( dot_product ( h.normal, p ) < h.offset )
+            return false;
+    
+    return true;
+}
+
+// Returns a convex polygon containing the part of the sky shown in a view; see header for details.
+
+SSHTM::Polygon SSHTM::viewPolygon ( SSView &view, int edgePoints )
+{
+    // Unproject points around the view's bounding rectangle, clockwise from top left corner, (edgePoints) per side.
+    
+    int n = max ( edgePoints, 1 );
+    double left = view.getLeft(), top = view.getTop(), right = view.getRight(), bottom = view.getBottom();
+    SSVector center = view.getCenterVector();
+    vector<SSVector> points;
+    bool onSky = true;
+    
+    for ( int side = 0; side < 4 && onSky; side++ )
+    {
+        for ( int i = 0; i < n; i++ )
+        {
+            double f = (double) i / n, x = 0.0, y = 0.0;
+            if ( side == 0 )
+                x = left + f * ( right - left ), y = top;
+            else if ( side == 1 )
+                x = right, y = top + f * ( bottom - top );
+            else if ( side == 2 )
+                x = right - f * ( right - left ), y = bottom;
+            else
+                x = left, y = bottom - f * ( bottom - top );
+            
+            SSVector p = view.unproject ( SSVector ( x, y, 0.0 ) );
+            onSky = ! p.isinf() && ! p.isnan();
+            if ( ! onSky )
+                break;
+            
+            points.push_back ( p );
+        }
+    }
+    
+    // Each side's edge is the great circle through its corners, facing the view center, moved outward
+    // past any of the side's points which are outside it. The polygon must contain the center and all points.
+    
+    Polygon polygon;
+    bool convex = onSky;
+    
+    for ( int side = 0; convex && side < 4; side++ )
+    {
+        SSVector normal = points[side * n].crossProduct ( points[ ( side + 1 ) * n % points.size() ] );
+        convex = normal.magnitude() > 1.0e-12;
+        if ( ! convex )
+            break;
+        
+        normal = normal.normalize();
+        if ( dot_product ( normal, center ) < 0.0 )
+            normal = normal * -1.0;
+        
+        double offset = 0.0;
+        for ( int i = 1; i < n; i++ )
+            offset = min ( offset, dot_product ( normal, points[side * n + i] ) );
+        
+        polygon.push_back ( { normal, offset - 1.0e-9 } );
+        convex = dot_product ( normal, center ) > polygon.back().offset;
+    }
+    
+    for ( size_t i = 0; convex && i < points.size(); i++ )
+        convex = in_polygon ( polygon, points[i] );
+    
+    if ( convex )
+        return polygon;
+    
+    // Otherwise fall back to a circle around the view center, through its farthest corner or edge point.
+    
+    polygon.clear();
+    SSAngle rad = view.getAngularDiagonal() / 2.0;
+    for ( SSVector &p : points )
+        rad = max ( rad, center.angularSeparation ( p ) );
+    
+    if ( onSky && rad < SSAngle::kPi )
+        polygon.push_back ( { center, cos ( rad ) } );
+    
+    return polygon;
+}
+
+// Returns the half-space above a horizon with unit vector (zenith), extended (depression) radians below it.
+
+SSHTM::Halfspace SSHTM::horizonHalfspace ( SSVector zenith, SSAngle depression )
+{
+    return { zenith.normalize(), -sin ( depression ) };
+}
+
+// Searches an HTM region and its sub-regions for objects inside a convex polygon, level by level.
+// Only searches regions pre-loaded into memory; does not load regions. Results are appended to vector (results),
+// stopping at (maxResults) if not zero. Returns number of objects found.
+
+int SSHTM::search ( uint64_t htmID, const Polygon &polygon, vector<SSObjectPtr> &results, size_t maxResults )
+{
+    Query query;
+    startQuery ( query, htmID, polygon );
+    return continueQuery ( query, results, maxResults );
+}
+
+// Starts a progressive search of a region (htmID) and its sub-regions for objects inside a polygon.
+
+void SSHTM::startQuery ( Query &query, uint64_t htmID, const Polygon &polygon )
+{
+    query = Query();
+    query.polygon = polygon;
+    for ( const Halfspace &h : polygon )
+    {
+        query.radii.push_back ( acos ( clamp ( h.offset, -1.0, 1.0 ) ) );
+        query.sinRadii.push_back ( sin ( query.radii.back() ) );
+    }
     
-    return cat == kCatUnknown ? nameMap.size() : identMap.size();
+    query.level = IDlevel ( htmID );
+    query.regions.push_back ( { htmID, false } );
 }
 
-// Adds index entries for objects with identifiers in the specifid catalog (cat)
-// contained in the HTM region (regionID).
-// Index entries are appended to the provided ObjectIndex (index).
-// The function returns the number of index entries added.
+// Continues a progressive search until (maxResults) more objects are found or (maxSeconds) elapse, if not zero,
+// or the search is finished. Objects found are appended to (results); returns number of objects found.
 
-size_t SSHTM::makeObjectMap ( SSCatalog cat, uint64_t regionID, NameMap &nameMap, IdentMap &identMap )
+int SSHTM::continueQuery ( Query &query, vector<SSObjectPtr> &results, size_t maxResults, double maxSeconds )
 {
-    size_t n = cat == kCatUnknown ? nameMap.size() : identMap.size();
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    TrixelLookup lookup;
+    size_t limit = maxResults > 0 ? maxResults : SIZE_MAX, n = 0, searched = 0;
+    double start = maxSeconds > 0.0 ? clocksec() : 0.0;
+    const Polygon &polygon = query.polygon;
     
-    SSObjectVec *pObjects = getObjects ( regionID );
-    size_t nObjects = pObjects ? pObjects->size() : 0;
-    for ( size_t offset = 0; offset < nObjects; offset++ )
+    // Returns -1 if a triangle is outside the polygon, 1 if it's inside, or 0 if it may be partly inside.
+    // It's outside a half-space if its bounding circle is; inside one whose radius is up to 90 degrees
+    // if its three vertices are (a hemisphere or smaller circle is convex), or inside a larger one if its bounding circle is.
+    
+    auto classify = [&] ( const Trixel &t )
     {
-        SSObjectPtr pObject = pObjects->get ( offset );
-
-        if ( cat == kCatUnknown )
+        int where = 1;
+        for ( size_t i = 0; i < polygon.size(); i++ )
         {
-            vector<string> names = pObject->getNames();
-            for ( string name : names )
-               nameMap.insert ( { name, { regionID, offset } } );
+            const Halfspace &h = polygon[i];
+            double d = dot_product ( h.normal, t.center );
+            if ( t.radius + query.radii[i] < SSAngle::kPi && d < h.offset * t.cosRadius - query.sinRadii[i] * t.sinRadius - 1.0e-12 )
+                return -1;
+            
+            bool inside = false;
+            if ( h.offset >= 0.0 )
+                inside = dot_product ( h.normal, t.v0 ) > h.offset + 1.0e-12 && dot_product ( h.normal, t.v1 ) > h.offset + 1.0e-12 && dot_product ( h.normal, t.v2 ) > h.offset + 1.0e-12;
+            else
+                inside = t.radius < query.radii[i] && d > h.offset * t.cosRadius + query.sinRadii[i] * t.sinRadius + 1.0e-12;
+            
+            if ( ! inside )
+                where = 0;
         }
-        else
+        
+        return where;
+    };
+    
+    // Each region to search is paired with true if it's entirely inside the polygon, so its objects
+    // and sub-regions need no testing. When all regions at a level have been searched, go to the next level.
+    
+    while ( n < limit )
+    {
+        if ( query.next >= query.regions.size() )
         {
-            vector<SSIdentifier> idents = pObject->getIdentifiers();
-            for ( SSIdentifier ident : idents )
-                if ( ident.catalog() == cat )
-                    identMap.insert ( { ident, { regionID, offset } } );
+            if ( query.subRegions.empty() )
+                break;
+            
+            query.regions.swap ( query.subRegions );
+            query.subRegions.clear();
+            query.next = 0;
+            query.level++;
+        }
+        
+        // Stop when out of time, but always search at least one region, so each call makes progress.
+        
+        if ( maxSeconds > 0.0 && searched > 0 && clocksec() - start > maxSeconds )
+            break;
+        
+        searched++;
+        uint64_t id = query.regions[query.next].first;
+        bool inside = query.regions[query.next].second || polygon.empty();
+        if ( ! inside && id > 0 && query.object == 0 )
+        {
+            int where = classify ( getTrixel ( id, lookup ) );
+            if ( where < 0 )
+            {
+                query.next++;
+                continue;
+            }
+            
+            inside = query.regions[query.next].second = where > 0;
+        }
+        
+        SSObjectVec *pObjects = findObjects ( *regions, id );
+        size_t size = pObjects ? pObjects->size() : 0;
+        for ( ; query.object < size && n < limit; query.object++ )
+        {
+            SSStar *pStar = SSGetStarPtr ( (*pObjects)[query.object] );
+            if ( pStar == nullptr )
+                continue;
+            
+            SSVector pos = pStar->getFundamentalPosition();
+            if ( ! pos.isinf() && ( inside || in_polygon ( polygon, pos ) ) )
+            {
+                results.push_back ( (*pObjects)[query.object] );
+                n++;
+            }
+        }
+        
+        if ( query.object < size )
+            break;
+        
+        if ( query.level < (int) _magLevels.size() - 1 )
+        {
+            uint64_t first = id == 0 ? 8 : id * 4, last = id == 0 ? 15 : id * 4 + 3;
+            for ( uint64_t subID = first; subID <= last; subID++ )
+                query.subRegions.push_back ( { subID, inside } );
         }
+        
+        query.next++;
+        query.object = 0;
     }
     
-    return ( cat == kCatUnknown ? nameMap.size() : identMap.size() ) - n;
+    publishTrixels ( lookup );
+    query.found += n;
+    return (int) n;
 }
 
-// Saves this HTM's object map for the specified catalog (cat) to a file.
-// Writes objects with user-definded function (saveFunc) and data (userData);
-// if these are nullptr, writes map in CSV format to HTM's "index" subdirectory.
-// Returns number of map entries written to file.
+// Returns the faintest magnitude down to which a progressive search has found all objects.
 
-size_t SSHTM::saveObjectMap ( SSCatalog cat, IdentMapFunc saveFunc, void *userData )
+float SSHTM::queryMagLimit ( const Query &query )
 {
-    int n = 0;
+    int level = queryFinished ( query ) ? query.level : query.level - 1;
+    if ( level < 0 || query.regions.empty() )
+        return -INFINITY;
     
-    if ( saveFunc != nullptr && cat != kCatUnknown )
-    {
-        n = saveFunc ( this, cat, &_identIndex[cat], userData );
-        return n;
-    }
+    return _magLevels[ min ( level, (int) _magLevels.size() - 1 ) ];
+}
 
-    // Open file; return on failure.
+// Computes aggregated light of regions at mesh level (minLevel) or deeper from stars in loaded regions.
+// Returns number of aggregates computed.
+
+int SSHTM::makeAggregates ( int minLevel )
+{
+    // Flux relative to magnitude zero, and flux-weighted sums of position and color, of a region's stars.
     
-    string catname = cat == kCatUnknown ? string ( "Name" ) : catalog_to_string ( cat );
-    string filepath ( _rootpath + "index/" + catname + ".csv" );
-    ofstream file ( filepath, ios::trunc );
-    if ( ! file )
-        return n;
+    struct Sum
+    {
+        size_t count = 0;
+        double flux = 0.0;
+        SSVector pos;
+        double red = 0.0, green = 0.0, blue = 0.0;
+    };
     
-    // Write name map if catalog is not specified; otherwise write identifier map.
+    map<uint64_t,Sum> sums;
+    shared_ptr<const RegionMap> regions = getRegionMap();
+    minLevel = max ( minLevel, 0 );
     
-    if ( cat == kCatUnknown )
+    for ( auto it = regions->begin(); it != regions->end(); it++ )
     {
-        NameMap &nameMap = _nameIndex[cat];
-        for ( auto it = nameMap.begin(); it != nameMap.end(); it++ )
+        int level = IDlevel ( it->first );
+        if ( level < minLevel )
+            continue;
+        
+        Sum sum;
+        SSObjectVec *pObjects = it->second->objects;
+        for ( size_t i = 0; pObjects && i < pObjects->size(); i++ )
         {
-            string name = it->first;
-            ObjectLoc loc = it->second;
-            string htmIDstr = ID2name ( loc.region );
-            file << name << "," << htmIDstr << "," << to_string ( loc.offset ) << endl;
-            n++;
+            SSStar *pStar = SSGetStarPtr ( (*pObjects)[i] );
+            if ( pStar == nullptr )
+                continue;
+            
+            SSVector pos = pStar->getFundamentalPosition();
+            float vmag = pStar->getVMagnitude(), bmag = pStar->getBMagnitude();
+            float mag = isinf ( vmag ) ? bmag : vmag;
+            if ( pos.isinf() || isinf ( mag ) )
+                continue;
+            
+            // Stars without both magnitudes are white.
+            
+            float r = 1.0, g = 1.0, b = 1.0;
+            if ( ! isinf ( vmag ) && ! isinf ( bmag ) )
+                SSStar::bmv2rgb ( bmag - vmag, r, g, b );
+            
+            double flux = pow ( 10.0, -0.4 * mag );
+            sum.count++;
+            sum.flux += flux;
+            sum.pos = sum.pos + pos * flux;
+            sum.red += r * flux;
+            sum.green += g * flux;
+            sum.blue += b * flux;
         }
-    }
-    else
-    {
-        IdentMap &identMap = _identIndex[cat];
-        for ( auto it = identMap.begin(); it != identMap.end(); it++ )
+        
+        if ( sum.count == 0 )
+            continue;
+        
+        // Add region's sum to its own and its ancestors' sums, up to the minimum level.
+        
+        for ( uint64_t id = it->first; level >= minLevel; level-- )
         {
-            SSIdentifier ident = it->first;
-            ObjectLoc loc = it->second;
-            string identstr = ident.toString();
-            string htmIDstr = ID2name ( loc.region );
-            file << identstr << "," << htmIDstr << "," << to_string ( loc.offset ) << endl;
-            n++;
+            Sum &total = sums[id];
+            total.count += sum.count;
+            total.flux += sum.flux;
+            total.pos = total.pos + sum.pos;
+            total.red += sum.red;
+            total.green += sum.green;
+            total.blue += sum.blue;
+            id = level > 1 ? id >> 2 : 0;
         }
     }
     
-    return n;
+    _aggregates.clear();
+    for ( auto &it : sums )
+    {
+        const Sum &sum = it.second;
+        Aggregate &agg = _aggregates[it.first];
+        agg.htmID = it.first;
+        agg.count = sum.count;
+        agg.mag = -2.5 * log10 ( sum.flux );
+        agg.centroid = SSVector ( sum.pos ).normalize();
+        agg.red = sum.red / sum.flux;
+        agg.green = sum.green / sum.flux;
+        agg.blue = sum.blue / sum.flux;
+    }
+    
+    return (int) _aggregates.size();
 }
 
-// Loads an object map for the specified catalog (cat) into this HTM's object indexes.
-// Writes objects with user-definded function (saveFunc) and data (userData);
-// if these are nullptr, reads map in CSV format from HTM's "index" subdirectory.
-// Returns number of map entries read from file.
+// Saves aggregates as CSV text, one per line: region name, star count, magnitude,
+// centroid RA and Dec in degrees, and red, green, blue color components.
+// Returns number of aggregates written.
 
-size_t SSHTM::loadObjectMap ( SSCatalog cat, IdentMapFunc loadFunc, void *userData )
+int SSHTM::saveAggregates ( void )
 {
+    ofstream file ( _rootpath + "Aggregates.csv", ios::trunc );
+    if ( ! file )
+        return 0;
+    
     int n = 0;
-    NameMap nameMap;
-    IdentMap identMap;
-
-    if ( loadFunc != nullptr && cat != kCatUnknown )
+    for ( auto &it : _aggregates )
     {
-        n = loadFunc ( this, cat, &identMap, userData );
+        const Aggregate &agg = it.second;
+        SSSpherical coords ( agg.centroid );
+        file << ID2name ( agg.htmID ) << "," << agg.count << ","
+             << format ( "%.3f,%.6f,%+.6f,%.4f,%.4f,%.4f", agg.mag, coords.lon.toDegrees(), coords.lat.toDegrees(), agg.red, agg.green, agg.blue ) << endl;
+        n++;
     }
-    else
-    {
-        // Open file; return on failure.
-
-        string catname = cat == kCatUnknown ? string ( "Name" ) : catalog_to_string ( cat );
-        string filepath ( _rootpath + "index/" + catname + ".csv" );
-        FILE *file = fopen ( filepath.c_str(), "rb" );
-        if ( ! file )
-            return n;
-
-        // Read file line-by-line until we reach end-of-file
+    
+    return n;
+}
 
-        string line = "";
-        while ( fgetline ( file, line ) )
-        {
-            vector<string> fields = split_csv ( line );
-            if ( fields.size() < 3 )
-                continue;
+// Loads aggregates from CSV text written by saveAggregates(), replacing any in memory.
+// Returns number of aggregates read.
 
-            // Read name map if catalog is not specified; otherwise read identifier map.
-            
-            if ( cat == kCatUnknown )
-            {
-                string name = fields[0];
-                if ( ! name.empty() )
-                {
-                    uint64_t htmID = name2ID ( fields[1] );
-                    size_t offset = strtoint64 ( fields[2] );
-                    nameMap.insert ( { name, { htmID, offset } } );
-                    n++;
-                }
-            }
-            else
-            {
-                SSIdentifier ident = SSIdentifier::fromString ( fields[0], kTypeNonexistent, true );
-                if ( ident != 0 )
-                {
-                    uint64_t htmID = name2ID ( fields[1] );
-                    size_t offset = strtoint64 ( fields[2] );
-                    identMap.insert ( { ident, { htmID, offset } } );
-                    n++;
-                }
-            }
-        }
-        
-        fclose ( file );
-    }
-    
-    // If we read anything, save the name map or ident map we just read.
+int SSHTM::loadAggregates ( void )
+{
+    SSLineReader file ( _rootpath + "Aggregates.csv" );
+    if ( ! file )
+        return 0;
     
-    if ( n > 0 )
+    _aggregates.clear();
+    string line;
+    while ( file.getline ( line ) )
     {
-        if ( cat == kCatUnknown )
-            _nameIndex.insert ( { cat, nameMap } );
-        else
-            _identIndex.insert ( { cat, identMap } );
+        vector<string> fields = split_csv ( line );
+        if ( fields.size() < 8 )
+            continue;
+        
+        Aggregate agg;
+        agg.htmID = name2ID ( fields[0] );
+        agg.count = strtoint64 ( fields[1] );
+        agg.mag = strtofloat ( fields[2] );
+        agg.centroid = SSVector ( SSSpherical ( SSAngle::fromDegrees ( strtofloat64 ( fields[3] ) ), SSAngle::fromDegrees ( strtofloat64 ( fields[4] ) ) ) );
+        agg.red = strtofloat ( fields[5] );
+        agg.green = strtofloat ( fields[6] );
+        agg.blue = strtofloat ( fields[7] );
+        _aggregates[agg.htmID] = agg;
     }
-
-    return n;
+    
+    return (int) _aggregates.size();
 }
 
-// Given an identifier, uses this HTM's identifier index to find all objects matching
-// the identifier. Object locations are appended to the vector (results).
-// Returns number of object locations found, or -1 if there is no object map
-// for the catalog to which the identifier belongs.
+// Gets the aggregate for a region (htmID); returns false if it has none.
 
-int SSHTM::findObjectLocs ( SSIdentifier ident, vector<SSHTM::ObjectLoc> &results )
+bool SSHTM::getAggregate ( uint64_t htmID, Aggregate &aggregate )
 {
-    SSCatalog cat = ident.catalog();
-    if ( objectMapSize ( cat ) == 0 )
-        return -1;
-    
-    IdentMap &map = _identIndex[cat];
-    auto it0 = map.lower_bound ( ident );
-    auto it1 = map.upper_bound ( ident );
+    auto it = _aggregates.find ( htmID );
+    if ( it == _aggregates.end() )
+        return false;
     
-    int n = (int) results.size();
-    for ( auto it = it0; it != it1; it++ )
-        results.push_back ( it->second );
-    return (int) results.size() - n;
+    aggregate = it->second;
+    return true;
 }
 
-// Given a name string (name), uses this HTM's name index to find all objects matching the name string.
-// Pass true for (casesens) for Case-Sensitive string matching; pass false for case-insensitive matching.
-// Pass true for (begins) for "begins-with" string matching; pass false for whole-string matching.
-// Object locations are appended to the vector (results); returns number of object locations found.
+// Appends aggregates of regions at a mesh level whose centroids are inside a polygon to (results).
+// Regions at level 1 and deeper have consecutive IDs from 8 x 4^(level - 1) up to 16 x 4^(level - 1).
+// Returns number of aggregates found.
 
-int SSHTM::findObjectLocs ( const string &name, vector<SSHTM::ObjectLoc> &results, bool casesens, bool begins )
+int SSHTM::searchAggregates ( int level, const Polygon &polygon, vector<Aggregate> &results )
 {
-    if ( objectMapSize ( kCatUnknown ) == 0 )
-        return -1;
+    if ( level < 0 || level > 31 )
+        return 0;
     
-    NameMap &map = _nameIndex[kCatUnknown];
-    int n = (int) results.size();
+    uint64_t first = level == 0 ? 0 : 8ULL << ( 2 * ( level - 1 ) );
+    uint64_t last = level == 0 ? 0 : ( 16ULL << ( 2 * ( level - 1 ) ) ) - 1;
     
-    if ( casesens == true && begins == false )
+    int n = 0;
+    for ( auto it = _aggregates.lower_bound ( first ); it != _aggregates.end() && it->first <= last; it++ )
     {
-        auto it0 = map.lower_bound ( name );
-        auto it1 = map.upper_bound ( name );
-        for ( auto it = it0; it != it1; it++ )
+        if ( in_polygon ( polygon, it->second.centroid ) )
+        {
             results.push_back ( it->second );
-    }
-    else
-    {
-        // We have to brute-force-search the name map for entries matching the name string.
-        // But since the map only contains a few hundred entries, this should still be fast.
-        
-        auto it0 = map.begin();
-        auto it1 = map.end();
-        for ( auto it = it0; it != it1; it++ )
-            if ( compare ( it->first, name, begins ? name.length() : 0, casesens ) == 0 )
-                results.push_back ( it->second );
+            n++;
+        }
     }
     
-    return (int) results.size() - n;
+    return n;
 }
 
-// Given an object location in this HTM, synchronously loads the region containing the object
-// (if not already loaded) and returns a pointer to the object, or nullptr on failure.
+// Appends a range of IDs to a vector of sorted ID ranges, merging it with the last range if they are adjacent.
 
-SSObjectPtr SSHTM::loadObject ( const ObjectLoc &loc )
+static void append_range ( vector<SSHTM::IDRange> &ranges, uint64_t first, uint64_t last )
 {
-    SSObjectVec *pObjects = loadRegion ( loc.region, true );
-    if ( pObjects )
-        return pObjects->get ( loc.offset );
-    
-    return nullptr;
+    if ( ! ranges.empty() && ranges.back().last + 1 == first )
+        ranges.back().last = last;
+    else
+        ranges.push_back ( { first, last } );
 }
 
-// Searches an HTM region and all of its sub-regions, recursively, for objects within a circle
-// centered on the celestial sphere at unit direction vector (center) in the fundamental frame,
-// of (radius) radians. Only searches regions pre-loaded into memory; does not load regions.
-// Results are appended to vector (results). Returns number of objects found within circle.
-
-int SSHTM::search ( uint64_t htmID, SSVector center, SSAngle rad, vector<SSObjectPtr> &results )
+int SSHTM::coverCircle ( SSVector center, SSAngle rad, int level, Cover &cover )
 {
-    // Unless this is the root region, get region center and angular radius. Always search root!
-    // If non-root region's bounding circle does not intersect search circle, don't search it.
+    if ( level < 1 || level > 30 )
+        return -1;
     
-    if ( htmID > 0 )
+    cover.level = level;
+    cover.full.clear();
+    cover.partial.clear();
+    if ( rad < 0.0 )
+        return 0;
+    
+    if ( rad >= SSAngle::kPi )
     {
-        SSVector v0, v1, v2;
-        name2Triangle ( ID2name ( htmID ), v0, v1, v2 );
-        SSVector vC = ( v0 + v1 + v2 ) / 3.0;
-        SSAngle r = vC.angularSeparation ( v0 );
-        if ( center.angularSeparation ( vC ) > r + rad )
-            return 0;
+        append_range ( cover.full, 8ULL << 2 * ( level - 1 ), ( 16ULL << 2 * ( level - 1 ) ) - 1 );
+        return 1;
     }
     
-    // Search this region's objects if they're loaded into memory.
-    // Then recursively search this region's sub-regions.
+    center = center.normalize();
+    double cosRad = cos ( rad ), sinRad = sin ( rad );
     
-    SSObjectVec *pObjects = getObjects ( htmID );
-    int n = pObjects ? pObjects->search ( center, rad, results ) : 0;
+    // Triangles still to be classified, with their levels and vertices, on an explicit stack instead of
+    // recursing. Children are pushed in reverse order, so triangles come off the stack in ascending ID order.
     
-    vector<uint64_t> subIDs = subRegionIDs ( htmID );
-    for ( int i = 0; i < subIDs.size(); i++ )
-       n += search ( subIDs[i], center, rad, results );
-
-    return n;
+    struct Node
+    {
+        uint64_t id;
+        int level;
+        SSVector v0, v1, v2;
+    };
+    
+    vector<Node> stack;
+    for ( uint64_t id = 15; id >= 8; id-- )
+    {
+        Node node = { id, 1 };
+        ID2Triangle ( id, node.v0, node.v1, node.v2 );
+        stack.push_back ( node );
+    }
+    
+    while ( ! stack.empty() )
+    {
+        Node node = stack.back();
+        stack.pop_back();
+        
+        // Bounding circle of triangle: if it does not intersect the search circle, neither does the triangle.
+        
+        SSVector tc = ( node.v0 + node.v1 + node.v2 ).normalize();
+        double cosR = min ( min ( tc * node.v0, tc * node.v1 ), tc * node.v2 );
+        double sinR = sqrt ( max ( 0.0, 1.0 - cosR * cosR ) );
+        double cosSep = center * tc;
+        if ( acos ( cosR ) + rad < SSAngle::kPi && cosSep < cosR * cosRad - sinR * sinRad - 1.0e-12 )
+            continue;
+        
+        // A circle of up to 90 degrees contains the triangle if it contains the three vertices;
+        // a larger circle (which is not convex) contains it if it contains its bounding circle.
+        
+        bool full = false;
+        if ( rad <= SSAngle::kHalfPi )
+            full = center * node.v0 > cosRad && center * node.v1 > cosRad && center * node.v2 > cosRad;
+        else
+            full = acos ( cosR ) <= rad && cosSep > cosRad * cosR + sinRad * sinR;
+        
+        if ( full )
+        {
+            int shift = 2 * ( level - node.level );
+            append_range ( cover.full, node.id << shift, ( ( node.id + 1 ) << shift ) - 1 );
+        }
+        else if ( node.level == level )
+        {
+            append_range ( cover.partial, node.id, node.id );
+        }
+        else
+        {
+            // Subdivide triangle as cc_ID2Triangle() does, pushing children 3, 2, 1, 0.
+            
+            SSVector w2 = ( node.v0 + node.v1 ).normalize();
+            SSVector w0 = ( node.v1 + node.v2 ).normalize();
+            SSVector w1 = ( node.v2 + node.v0 ).normalize();
+            uint64_t id = node.id * 4;
+            int l = node.level + 1;
+            
+            stack.push_back ( { id + 3, l, w0, w1, w2 } );
+            stack.push_back ( { id + 2, l, node.v2, w1, w0 } );
+            stack.push_back ( { id + 1, l, node.v1, w0, w2 } );
+            stack.push_back ( { id, l, node.v0, w2, w1 } );
+        }
+    }
+    
+    return (int) ( cover.full.size() + cover.partial.size() );
 }
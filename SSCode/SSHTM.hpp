@@ -7,21 +7,22 @@
 #ifndef SSHTM_HPP
 #define SSHTM_HPP
 
-#ifndef USE_THREADS
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
-#define USE_THREADS 0
-#else
-#define USE_THREADS 1
-#endif
-#endif
+#include <set>
 
-#if USE_THREADS
-#include <thread>
-#endif
+#include <atomic>
+#include <unordered_map>
 
 #include "SSObject.hpp"
 #include "SSStar.hpp"
+#include "SSAsync.hpp"
 #include "SSVector.hpp"
+#include "SSView.hpp"
+
+#if USE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 
 // No, not Hypertext Markup Language!
 // This class implements the Heirarchial Triangle Mesh, a method for subdividing the celestial sphere
@@ -33,6 +34,47 @@
 // named S00, S01, S02, S02, etc. with HTM ID numbers 32, 33, 34, 35 etc., and so on down the mesh tree.
 // This class also contains methods for loading, saving, and storing objects in the regions to files.
 // Regions can be loaded synchronously on the current thread, or asynchronously on a background thread.
+// Any number of threads may call getObjects(), regionLoaded(), and search() while regions are being loaded;
+// they never lock, and loading locks only briefly to publish each region. Objects from a region stay valid
+// until it is dumped or evicted. Storing objects, saving, dumping, and building object maps are not thread-safe.
+
+// An HTM archive packs all of an HTM's regions, at all magnitude levels, and its object name and identifier maps,
+// into a single file, so reading a region takes one seek and one read, or one slice of a memory-mapped file,
+// instead of opening a file per region. All values are stored in the byte order of the computer which wrote it;
+// archives with a different byte order are rejected. All offsets are from the start of the file, aligned to 8 bytes.
+// The archive header is followed by magnitude levels (one float per level), the region table, and the map table.
+// Each region is a binary catalog (see SSBinaryCatalog); each map is the CSV text saveObjectMap() writes to a file.
+
+#pragma pack ( push, 1 )
+
+struct SSHTMArchiveHeader
+{
+    char     magic[8];              // kHTMArchiveMagic
+    uint32_t version;               // kHTMArchiveVersion
+    uint32_t byteOrder;             // kBinaryCatalogByteOrder, as written by this computer
+    uint32_t numLevels;             // number of magnitude levels
+    uint32_t numRegions;            // number of entries in region table
+    uint32_t numMaps;               // number of entries in map table
+    uint32_t reserved;              // always zero
+    uint64_t levelOffset;           // offset to magnitude levels
+    uint64_t regionOffset;          // offset to region table
+    uint64_t mapOffset;             // offset to map table
+};
+
+// Region or map table entry: location of a region's binary catalog, or an object map's text, in the archive.
+// Region tables are sorted by HTM ID, and map tables by catalog (kCatUnknown for the name map).
+
+struct SSHTMArchiveEntry
+{
+    uint64_t key;                   // HTM region ID, or catalog (SSCatalog) of object map
+    uint64_t offset;                // offset to region or map data
+    uint64_t size;                  // size of region or map data in bytes
+};
+
+#pragma pack ( pop )
+
+constexpr char kHTMArchiveMagic[8] = { 'S', 'S', 'H', 'T', 'M', 'A', 'R', 'C' };
+constexpr uint32_t kHTMArchiveVersion = 1;
 
 // Callback function to notify external HTM user when regions are loaded asynchronously.
 
@@ -41,18 +83,170 @@ class SSHTM
 public:
     typedef void (* RegionLoadCallback) ( SSHTM *pHTM, uint64_t htmID );
     typedef int (* DataFileFunc) ( SSHTM *pHTM, uint64_t htmID, SSObjectArray *objects, void *userData );
+    typedef void (* RegionEvictCallback) ( SSHTM *pHTM, uint64_t htmID );
+
+    // Total light of the stars in a region and all of its sub-regions, which a renderer can draw in place of those stars
+    // when they are too faint and crowded to draw individually, e.g. at wide fields of view.
+    
+    struct Aggregate
+    {
+        uint64_t htmID = 0;                     // region ID
+        size_t count = 0;                       // number of stars aggregated
+        float mag = INFINITY;                   // visual magnitude of stars' total flux
+        SSVector centroid;                      // flux-weighted mean of stars' positions, as unit vector in fundamental frame
+        float red = 0.0, green = 0.0, blue = 0.0;   // flux-weighted mean of stars' colors from B-V, each from 0 to 1
+    };
+
+    // Statistics of a region's objects, written to the file "Stats.csv" in the root directory when regions are saved,
+    // and read back when the root directory is set, so they are known for regions which have not been loaded.
+
+    static constexpr int kStatsMagMin = -2;             // magnitude histogram bin i counts objects from kStatsMagMin + i to kStatsMagMin + i + 1;
+    static constexpr int kStatsMagBins = 32;            // brighter objects are in the first bin, fainter or unknown in the last
+
+    struct RegionStats
+    {
+        size_t count = 0;                       // number of objects
+        size_t bytes = 0;                       // memory used by objects, as measured by SSObjectArray::memoryUsage()
+        size_t fileBytes = 0;                   // size of region's CSV data file; zero if written by a custom function
+        float minMag = INFINITY;                // magnitude of brightest object with known magnitude
+        float maxMag = -INFINITY;               // magnitude of faintest object with known magnitude
+        uint32_t magCounts[kStatsMagBins] = { 0 };  // magnitude histogram
+    };
 
 protected:
     DataFileFunc                _readFunc = nullptr;    // custom function for reading region data files
     DataFileFunc                _writeFunc = nullptr;   // custom function for writing region data files
-    map<uint64_t,SSObjectVec *> _regions;               // arrays of objects loaded into memory, indexed by HTM region ID
     vector<float>               _magLevels;             // faintest magnitude of objects at each HTM level; vector size is depth of mesh tree
     string                      _rootpath;              // directory containing object data files on filesystem.
+    size_t                      _arenaSlabSize = 0;     // if nonzero, loaded regions' objects are allocated in arenas with this slab size
+    
+    // A region's objects, and its memory usage if loaded from a data file. Regions created by store() are not counted
+    // toward the memory budget, and never evicted. The region's objects are deleted with it.
+    
+    struct Region
+    {
+        SSObjectVec *objects = nullptr;     // array of region's objects
+        bool loaded = false;                // true if loaded from data file
+        size_t numObjects = 0;              // number of objects when loaded
+        size_t bytes = 0;                   // memory used by objects when loaded, in bytes
+        atomic<uint64_t> lastUse;           // value of use clock when region was last loaded, searched, or accessed
+        
+        Region ( SSObjectVec *objs ) : objects ( objs ), lastUse ( 0 ) {}
+        ~Region ( void ) { delete objects; }
+    };
+    
+    typedef map<uint64_t,shared_ptr<Region>> RegionMap;
+    
+    // The region map is never modified once published. Readers take a snapshot of it with atomic_load(), without locking,
+    // and keep using it while regions are installed or removed. Writers copy it, change the copy, and publish that
+    // with atomic_store(), one at a time. A region removed from the map is deleted when no snapshot refers to it.
+    
+    shared_ptr<const RegionMap> _regions;               // regions in memory, indexed by HTM region ID
+    atomic<uint64_t>            _useClock;              // incremented whenever a region is used
+#if USE_THREADS
+    mutex                       _regionMutex;           // serializes changes to region map, and memory budget totals
+#endif
+    
+    shared_ptr<const RegionMap> getRegionMap ( void ) const { return atomic_load ( &_regions ); }
+    Region *getRegion ( uint64_t htmID );
+    Region *addRegion ( uint64_t htmID );
+    bool storeRegionID ( SSStar *pStar, uint64_t &htmID );
+    Region *findRegion ( const RegionMap &regions, uint64_t htmID );
+    SSObjectVec *findObjects ( const RegionMap &regions, uint64_t htmID ) { Region *pRegion = findRegion ( regions, htmID ); return pRegion ? pRegion->objects : nullptr; }
+    
+    // Memory budget for regions loaded from data files, which are evicted in least-recently-used order.
+    
+    size_t                      _loadedObjects = 0;     // total objects in loaded regions
+    size_t                      _loadedBytes = 0;       // total estimated bytes used by loaded regions
+    size_t                      _maxObjects = 0;        // object budget for loaded regions; zero if unlimited
+    size_t                      _maxBytes = 0;          // memory budget for loaded regions in bytes; zero if unlimited
+    int                         _pinLevels = 0;         // loaded regions at mesh levels below this are never evicted
+    
+    int _evictRegions ( uint64_t keepID );
+    
+    set<uint64_t>               _emptyRegions;          // regions which have no data file, or no objects in it; protected by region mutex
+
+    typedef map<uint64_t,RegionStats> StatsMap;
+    
+    shared_ptr<const StatsMap>  _stats;                 // region statistics by region ID; published like the region map
+#if USE_THREADS
+    mutex                       _statsMutex;            // serializes changes to region statistics
+#endif
+    
+    RegionStats makeStats ( uint64_t htmID, Region &region );
+    int _saveRegion ( uint64_t htmID, void *userData );
+    void updateStats ( const vector<pair<uint64_t,RegionStats>> &stats );
     
 #if USE_THREADS
-    map<uint64_t,thread *>      _loadThreads;           // background threads currently loading region objects from data files, indexed by HTM region ID
+    // Asynchronous region loading: a fixed pool of worker threads takes load requests from a queue ordered by priority
+    // (lowest first). Requests are indexed by region ID so each region is queued, or loaded, at most once at a time.
+    
+    struct LoadRequest
+    {
+        uint64_t htmID;     // HTM ID of region to load
+        void *userData;     // user data passed to data file reading function
+    };
+    
+    typedef multimap<double,LoadRequest> LoadQueue;
+    
+    int                         _loadThreadCount = 4;   // maximum number of worker threads loading regions in the background
+    vector<thread>              _loadThreads;           // worker threads, started when the first region is loaded asynchronously
+    LoadQueue                   _loadQueue;             // regions waiting to be loaded, in priority order
+    map<uint64_t,LoadQueue::iterator> _queuedLoads;     // regions waiting to be loaded, indexed by HTM region ID
+    set<uint64_t>               _loadingRegions;        // regions being loaded by worker threads now
+    SSVector                    _loadCenter = SSVector ( INFINITY, INFINITY, INFINITY );   // view center, unit vector; infinite if unknown
+    bool                        _stopLoading = false;   // tells worker threads to exit
+    mutex                       _loadMutex;             // protects all of the above
+    condition_variable          _loadQueued;            // signalled when a region is queued, or worker threads must exit
+    condition_variable          _loadFinished;          // signalled when a worker thread finishes loading a region
+    
+    double loadPriority ( uint64_t htmID );
+    void loadWorker ( void );
+    void stopLoadThreads ( void );
+    void waitForLoad ( unique_lock<mutex> &lock, uint64_t htmID );
 #endif
+    // An open archive, defined in SSHTM.cpp. Like the region map, it is replaced atomically; a region load in progress
+    // keeps using the archive it started with, which is closed when no load refers to it.
+    
+    struct Archive;
+    shared_ptr<Archive>         _archive;               // archive regions and object maps are read from, if open
+    bool installArchive ( shared_ptr<Archive> archive );
+    
     SSObjectVec *_loadRegion ( uint64_t htmID, RegionLoadCallback callback, void *userData );    // private method to load object data file for a given HTM region ID
+    SSObjectVec *requestRegion ( uint64_t htmID, bool sync, void *userData );
+
+    // Geometry of an HTM triangle, cached by getTrixel() for regions visited by search().
+    
+    struct Trixel
+    {
+        SSVector v0, v1, v2;                // unit vectors to triangle's vertices
+        SSVector center;                    // unit vector to triangle's center
+        double radius;                      // angular radius in radians of circle around center bounding triangle
+        double cosRadius, sinRadius;        // cosine and sine of bounding circle radius
+    };
+    
+    typedef unordered_map<uint64_t,Trixel> TrixelMap;
+    
+    // Like the region map, the trixel cache is published read-only. Each search looks up trixels in a snapshot of it,
+    // and computes missing trixels into its own map, which it merges into a new cache when finished.
+    
+    struct TrixelLookup
+    {
+        shared_ptr<const TrixelMap> cached;     // snapshot of trixel cache
+        TrixelMap computed;                     // trixels computed during this lookup, missing from snapshot
+    };
+    
+    shared_ptr<const TrixelMap> _trixels;       // cached triangle geometry, indexed by HTM region ID
+#if USE_THREADS
+    mutex                       _trixelMutex;   // serializes changes to trixel cache
+#endif
+    
+    const Trixel &getTrixel ( uint64_t htmID, TrixelLookup &lookup );
+    void publishTrixels ( TrixelLookup &lookup );
+    int _search ( uint64_t htmID, int level, const SSVector &center, SSAngle rad, double cosRad, double sinRad, const RegionMap &regions, TrixelLookup &lookup, vector<SSObjectPtr> &results );
+    int _searchAll ( uint64_t htmID, int level, const RegionMap &regions, vector<SSObjectPtr> &results );
+    
+    map<uint64_t,Aggregate>     _aggregates;    // aggregated light of regions, indexed by HTM region ID
     
 public:
     
@@ -62,6 +256,10 @@ public:
     SSHTM ( const vector<float> &magLevels, const string &rootpath );
     virtual ~SSHTM ( void );
     
+    // Deletes all regions, then sets new magnitude limits for each HTM level and root path to region data files.
+    
+    void reset ( const vector<float> &magLevels, const string &rootpath );
+    
     // return path to directory containing region data files
     
     string rootPath ( void ) { return _rootpath; }
@@ -72,31 +270,114 @@ public:
     bool magLimits ( uint64_t id, float &min, float &max );
     int magLevel ( float mag );
 
-    // store an individual object or an antire array of objects in this HTM
+    // store an individual object or an antire array of objects in this HTM. With more than one thread (zero or negative
+    // means one per processor core), an array's region IDs are computed in parallel, objects are partitioned by region,
+    // and each region's objects are appended in parallel; each region gets the same objects in the same order as with one.
 
     virtual bool store ( SSStar *pStar );
-    virtual int store ( SSObjectVec &objects );
+    virtual int store ( SSObjectVec &objects, int threads = 1 );
  
     // Count number of regions and objects in HTM or in a region therein.
     
-    int countRegions ( void ) { return (int) _regions.size(); }
+    int countRegions ( void ) { return (int) getRegionMap()->size(); }
     int countStars ( void );
     int countStars ( uint64_t htmID );
+
+    // Region statistics from "Stats.csv" (see RegionStats), for regions whether loaded or not, so planners can decide
+    // what to load without reading region data files. saveRegions() writes the file; saveRegion() only updates
+    // statistics in memory, so call saveStats() afterwards. It is read when the root path is set; loadStats()
+    // reads it again. Both return false if the file can't be read or written. getStats() returns false if a region has
+    // no statistics. estimateStars() sums objects brighter than (magLimit) in a region and all its sub-regions (the
+    // whole mesh if htmID is zero) from their histograms, counting all of a histogram bin which (magLimit) falls in;
+    // estimateBytes() likewise sums their memory use.
+
+    bool loadStats ( void );
+    bool saveStats ( void );
+    bool getStats ( uint64_t htmID, RegionStats &stats );
+    size_t estimateStars ( uint64_t htmID, float magLimit = INFINITY );
+    size_t estimateBytes ( uint64_t htmID );
+    
+    // Loads regions into arena-backed object arrays (see SSObjectArray) with the given slab size in bytes, so each region's
+    // objects are allocated in a few slabs and released together when it is dumped; zero (the default) uses the heap.
+    
+    void setArenaSlabSize ( size_t slabSize ) { _arenaSlabSize = slabSize; }
+    size_t getArenaSlabSize ( void ) { return _arenaSlabSize; }
+
+    // Limits memory used by regions loaded from data files to (maxObjects) objects and (maxBytes) bytes, measured
+    // with SSObjectArray::memoryUsage() when each region is loaded; zero means unlimited. When over budget, the least recently loaded, searched,
+    // or accessed with getObjects() regions are evicted, except those at mesh levels below (pinLevels), so the
+    // brightest objects stay in memory. Eviction happens only on the thread calling loadRegion(), loadRegions(),
+    // or evictRegions() - never on a background loading thread - so object pointers stay valid until then.
+    // The callback installed with SSHTMSetRegionEvictCallback() is called before each evicted region is deleted.
+    // Object names and spectral types are interned in the global SSStringPool, which never releases them, so evicting
+    // a region does not reclaim their memory, and getLoadedBytes() does not count it; it grows with distinct strings loaded.
     
+    void setMemoryBudget ( size_t maxObjects, size_t maxBytes ) { _maxObjects = maxObjects; _maxBytes = maxBytes; }
+    void setPinnedLevels ( int pinLevels ) { _pinLevels = pinLevels; }
+    int getPinnedLevels ( void ) { return _pinLevels; }
+    size_t getLoadedObjects ( void );
+    size_t getLoadedBytes ( void );
+    int evictRegions ( void );
+
+    // Memory accounting: live bytes used by one region's objects, or zero if not in memory; by all regions in memory
+    // at each mesh level, i.e. each magnitude level, whether loaded or stored; and by the name and identifier indexes.
+
+    size_t getRegionBytes ( uint64_t htmID );
+    vector<size_t> getLevelBytes ( void );
+    size_t getIndexBytes ( void );
+
     // save region objects to file(s), load them from file(s), dump them from memory.
     
-    int saveRegions ( void *userData = nullptr );
+    int saveRegions ( void *userData = nullptr, int threads = 1 );
     int saveRegion ( uint64_t id, void *userData = nullptr );
     int loadRegions ( uint64_t htmID = 0, bool sync = true, void *userData = nullptr );
     SSObjectVec *loadRegion ( uint64_t htmID, bool sync = true, void *userData = nullptr );
     void dumpRegions ( void );
     void dumpRegion ( uint64_t htmID );
     
+    // Loads a region and all its sub-regions as a task on the shared thread pool (see SSAsync), brightest levels first.
+    // Progress counts regions, and cancellation stops before the next region; the result is the number of regions
+    // in memory afterwards, as loadRegions() returns. Nothing is evicted by the task, only by the next call to
+    // loadRegion(), loadRegions(), or evictRegions() on the caller's thread. This HTM must outlive the task.
+    
+    SSAsync<int> loadRegionsAsync ( uint64_t htmID = 0, void *userData = nullptr );
+    
+    // Saves all regions in memory, and all object maps made or loaded, to a single archive file (path), replacing it.
+    // Returns number of regions written, or zero on failure. Opening an archive sets magnitude levels from it;
+    // while open, regions and object maps are read from it instead of region data files and map files.
+    // An archive can also be opened from memory (bytes), e.g. downloaded with fetchfile(); the HTM takes the bytes.
+    
+    int saveArchive ( const string &path );
+    bool openArchive ( const string &path );
+    bool openArchive ( vector<char> &&bytes );
+    void closeArchive ( void );
+    bool archiveOpen ( void ) { return atomic_load ( &_archive ) != nullptr; }
+
     // test whether region objects are loaded into memory, get array of pointers to loaded region objects
     
     bool regionLoaded ( uint64_t id );
     SSObjectVec *getObjects ( uint64_t id );
     
+    // Asynchronous loading: set the number of worker threads (at least one; zero or negative means one per processor core)
+    // and the view center, a unit vector, which orders queued regions with brighter magnitude levels first, then those
+    // nearest the view center. Queued (not yet started) loads can be cancelled individually, outside a circle of (rad)
+    // radians around a unit vector (center) when the view moves away, or all at once. Call these from one thread only.
+    
+    void setLoadThreadCount ( int threads );
+    void setLoadCenter ( SSVector center );
+    bool cancelLoad ( uint64_t htmID );
+    int cancelLoads ( SSVector center, SSAngle rad );
+    int cancelLoads ( void );
+    int pendingLoads ( void );
+    
+    // Prefetches regions which a view (whose center is in the HTM's fundamental frame) will probably show within the
+    // next (frames) frames, while its center moves by (motion) radians per frame, a vector tangent to the sphere.
+    // Queues background loads of regions at levels down to magnitude (magLimit), whose triangles touch a circle around
+    // the view's current and predicted fields, nearest the view center first; cancels queued loads outside that circle.
+    // Skips regions already loaded, and regions with no data file. Returns number of regions queued.
+    
+    int prefetch ( SSView &view, SSVector motion, int frames, float magLimit, void *userData = nullptr );
+    
     // Get child HTM region IDs of a particular region; gets empty vector if region has no children.
     
     virtual vector<uint64_t> subRegionIDs ( uint64_t id );
@@ -108,6 +389,7 @@ public:
     virtual int IDlevel ( uint64_t id );
     virtual string ID2name ( uint64_t id );
     virtual bool name2Triangle ( const string &name, SSVector &v0, SSVector &v1, SSVector &v2 );
+    virtual bool ID2Triangle ( uint64_t id, SSVector &v0, SSVector &v1, SSVector &v2 );
     virtual bool isinside ( const SSVector &p, const SSVector &v0, SSVector &v1, SSVector &v2 );
     
     // Describes the location of particular object inside an HTM
@@ -118,23 +400,57 @@ public:
         size_t   offset;    // Position of object within region's object vector, counting from zero.
     };
     
-    typedef multimap<string,ObjectLoc>       NameMap;
-    typedef multimap<SSIdentifier,ObjectLoc> IdentMap;
+    typedef SSFlatMap<SSIString,ObjectLoc,true>    NameMap;
+    typedef SSFlatMap<SSIdentifier,ObjectLoc,true> IdentMap;
+    typedef map<SSCatalog,shared_ptr<const IdentMap>> IdentIndex;
+
+    // Name index keyed by case-folded (lower-case) names, for case-insensitive and begins-with name searches.
+    // It is built from the name index whenever that is published.
+
+    struct FoldedName
+    {
+        SSIString name;     // name as it appears in name index
+        ObjectLoc loc;      // location of object with name
+    };
+
+    typedef SSFlatMap<string,FoldedName,true> FoldedNameMap;
+    
+    // Object indexes are published like the region map: each is sorted, then never modified once published.
+    // Readers take snapshots with atomic_load(), without locking, so findObjectLocs() never writes shared state.
+    // Makers and loaders build new maps, and publish them with atomic_store(), one at a time; the identifier index
+    // of all catalogs is copied and republished with each catalog's map, which is shared between copies.
+    
+    shared_ptr<const NameMap>       _nameIndex;         // name index; empty if not made or loaded
+    shared_ptr<const FoldedNameMap> _foldedNameIndex;   // case-folded name index, built from name index
+    shared_ptr<const IdentIndex>    _identIndex;        // identifier index of each catalog which has one
+#if USE_THREADS
+    mutex                           _indexMutex;        // serializes publishing object indexes
+#endif
+    
+    shared_ptr<const NameMap> getNameIndex ( void ) const { return atomic_load ( &_nameIndex ); }
+    shared_ptr<const FoldedNameMap> getFoldedNameIndex ( void ) const { return atomic_load ( &_foldedNameIndex ); }
+    shared_ptr<const IdentIndex> getIdentIndex ( void ) const { return atomic_load ( &_identIndex ); }
+    shared_ptr<const IdentMap> getIdentMap ( SSCatalog cat ) const;
+    
+    // Sorts and publishes a name index, with its case-folded name index (pFolded) if already built, or else builds
+    // that; or sorts and publishes one catalog's identifier index, replacing any it had before.
     
-    map<SSCatalog,NameMap>  _nameIndex;
-    map<SSCatalog,IdentMap> _identIndex;
+    void publishNameIndex ( NameMap &nameMap, FoldedNameMap *pFolded = nullptr );
+    void publishIdentMap ( SSCatalog cat, IdentMap &identMap );
 
     typedef int (* IdentMapFunc) ( SSHTM *pHTM, SSCatalog cat, IdentMap *pMap, void *userData );
 
+    size_t writeObjectMap ( SSCatalog cat, ostream &stream );
+
     size_t loadObjectMap ( SSCatalog cat, IdentMapFunc loadFunc = nullptr, void *userData = nullptr );
     size_t saveObjectMap ( SSCatalog cat, IdentMapFunc saveFunc = nullptr, void *userData = nullptr );
 
     size_t makeObjectMap ( SSCatalog cat );
     size_t makeObjectMap ( SSCatalog cat, uint64_t regionID, NameMap &nameMap, IdentMap &identMap );
     
-    size_t objectMapSize ( SSCatalog cat ) { return cat == kCatUnknown ? _nameIndex[cat].size() : _identIndex[cat].size(); }
+    size_t objectMapSize ( SSCatalog cat );
     
-    int findObjectLocs ( const string &name, vector<ObjectLoc> &locs, bool casesens = true, bool begins = false );
+    int findObjectLocs ( const string &name, vector<ObjectLoc> &locs, bool casesens = true, bool begins = false, size_t maxLocs = 0 );
     int findObjectLocs ( SSIdentifier ident, vector<ObjectLoc> &locs );
     
     SSObjectPtr loadObject ( const ObjectLoc &loc );
@@ -146,6 +462,115 @@ public:
     DataFileFunc getDataFileWriteFunc ( void ) { return _writeFunc; }
 
     int search ( uint64_t htmID, SSVector center, SSAngle rad, vector<SSObjectPtr> &results );
+
+    // A half-space of the celestial sphere: all unit vectors p for which normal * p >= offset, where normal is a unit vector.
+    // Its boundary is a great circle if offset is zero, or a small circle if not; offset is the cosine of its angular radius.
+    
+    struct Halfspace
+    {
+        SSVector normal;
+        double offset;
+    };
+    
+    // A convex spherical polygon: the intersection of half-spaces. An empty polygon contains the whole sky.
+    
+    typedef vector<Halfspace> Polygon;
+    
+    // Returns a convex polygon containing the part of the sky shown in a view (whose center is in the HTM's fundamental frame).
+    // Each edge is the great circle through two corners of the view's bounding rectangle, moved outward past the (edgePoints)
+    // points unprojected along that side, to contain the curved edges of non-gnomonic projections. If that polygon doesn't
+    // contain every point, or a point is off the sky, returns a circle around the view center through its farthest point,
+    // or the whole sky if that circle is 180 degrees or larger.
+    
+    static Polygon viewPolygon ( SSView &view, int edgePoints = 8 );
+    
+    // Returns the half-space above the horizon whose zenith is a unit vector (zenith) in the HTM's fundamental frame,
+    // extended (depression) radians below the horizon; append it to a view polygon to exclude objects below the horizon.
+    
+    static Halfspace horizonHalfspace ( SSVector zenith, SSAngle depression = 0.0 );
+    
+    // Searches an HTM region and its sub-regions for objects inside a convex polygon. Only searches regions pre-loaded into memory.
+    // Results are appended to (results) one mesh level at a time, so brighter magnitude levels come before fainter ones;
+    // if (maxResults) is not zero, stops when that many objects have been found. Returns number of objects found.
+    
+    int search ( uint64_t htmID, const Polygon &polygon, vector<SSObjectPtr> &results, size_t maxResults = 0 );
+    
+    // A progressive search for objects inside a convex polygon (a circle is a polygon with one half-space), which visits
+    // the mesh one level at a time, from bright magnitude levels to faint, and can be continued from where it stopped.
+    
+    struct Query
+    {
+        Polygon polygon;                            // region of sky being searched
+        vector<double> radii, sinRadii;             // angular radius of each half-space, and its sine
+        int level = 0;                              // mesh level being searched
+        vector<pair<uint64_t,bool>> regions;        // regions to search at this level, with true if entirely inside polygon
+        vector<pair<uint64_t,bool>> subRegions;     // regions to search at next level
+        size_t next = 0;                            // index in regions of region being searched
+        size_t object = 0;                          // index of next object to test in region being searched
+        size_t found = 0;                           // total number of objects found
+    };
+    
+    // Starts a progressive search of a region (htmID) and its sub-regions for objects inside a polygon.
+    // Then continueQuery() appends objects found to (results) until (maxResults) more objects have been found,
+    // or (maxSeconds) have elapsed, if either is not zero, or the search is finished; and returns the number found.
+    // Call it again, e.g. on the next frame, to find more, fainter objects. Only searches regions pre-loaded into memory.
+    
+    void startQuery ( Query &query, uint64_t htmID, const Polygon &polygon );
+    int continueQuery ( Query &query, vector<SSObjectPtr> &results, size_t maxResults = 0, double maxSeconds = 0.0 );
+    
+    // Returns true if a progressive search has finished searching all levels of the mesh.
+    
+    bool queryFinished ( const Query &query ) { return query.next >= query.regions.size() && query.subRegions.empty(); }
+    
+    // Returns the faintest magnitude down to which a progressive search has found all objects, i.e. the limit of the
+    // faintest level completely searched; or -INFINITY if no level has been completed yet.
+    
+    float queryMagLimit ( const Query &query );
+    
+    // Computes aggregated light of every region at mesh level (minLevel) or deeper from stars in regions loaded into memory,
+    // replacing any previous aggregates. Each region's aggregate includes its own stars and all its sub-regions' stars;
+    // so to draw a view, draw individual stars from levels above some level, then aggregates of regions at that level.
+    // Returns number of aggregates computed. Not safe to call while other threads use aggregates.
+    
+    int makeAggregates ( int minLevel = 1 );
+    
+    // Saves aggregates to, or loads them from, the file "Aggregates.csv" in the HTM's root directory, beside the region files.
+    // Returns number of aggregates saved or loaded.
+    
+    int saveAggregates ( void );
+    int loadAggregates ( void );
+    
+    // Gets the aggregate for a region (htmID); returns false if it has none.
+    
+    bool getAggregate ( uint64_t htmID, Aggregate &aggregate );
+    
+    // Appends aggregates of regions at a mesh level (level) whose centroids are inside a polygon to (results).
+    // Returns number of aggregates found.
+    
+    int searchAggregates ( int level, const Polygon &polygon, vector<Aggregate> &results );
+
+    // A range of consecutive HTM IDs at one level of the mesh, from first to last inclusive.
+    
+    struct IDRange
+    {
+        uint64_t first, last;
+    };
+    
+    // The HTM triangles at one level of the mesh which cover a region of the sky, as sorted, non-overlapping ID ranges:
+    // triangles entirely inside the region (full), and triangles which may be partly inside it (partial).
+    
+    struct Cover
+    {
+        int level = 0;
+        vector<IDRange> full;
+        vector<IDRange> partial;
+    };
+    
+    // Computes triangles at a mesh level (1 for root triangles S0 ... N3, up to 30) which cover a circle of (rad) radians
+    // around a unit vector (center). Triangles inside the circle are found at the coarsest level possible
+    // and expanded into ranges of their descendants. Returns total number of ranges, or -1 if level is invalid.
+    
+    int coverCircle ( SSVector center, SSAngle rad, int level, Cover &cover );
 };
 
 // Callback function to notify external HTM user when regions are loaded asynchronously.
@@ -153,4 +578,17 @@ public:
 void SSHTMSetRegionLoadCallback ( SSHTM::RegionLoadCallback pCallback );
 SSHTM::RegionLoadCallback SSHTMGetRegionLoadCallback ( void );
 
+// Data file functions which read and write regions as memory-mapped binary catalog files (see SSBinaryCatalog),
+// named for their HTM regions with the extension ".bin", instead of CSV files. Install them with setDataFileReadFunc()
+// and setDataFileWriteFunc(); to convert an HTM, load its CSV regions, then install the write function and save them.
+// Objects are created directly from the file's fixed-size records, without parsing text.
+
+int SSHTMReadBinaryRegion ( SSHTM *pHTM, uint64_t htmID, SSObjectArray *objects, void *userData );
+int SSHTMWriteBinaryRegion ( SSHTM *pHTM, uint64_t htmID, SSObjectArray *objects, void *userData );
+
+// Callback function to notify external HTM user before regions' objects are deleted to stay within a memory budget.
+
+void SSHTMSetRegionEvictCallback ( SSHTM::RegionEvictCallback pCallback );
+SSHTM::RegionEvictCallback SSHTMGetRegionEvictCallback ( void );
+
 #endif /* SSHTM_HPP */
@@ -79,12 +79,14 @@ static map<string,SSCatalog> _nameCatMap =
 
 string catalog_to_string ( SSCatalog cat )
 {
-    return _catNameMap[cat];
+    auto it = _catNameMap.find ( cat );
+    return it == _catNameMap.end() ? "" : it->second;
 }
 
 SSCatalog string_to_catalog ( string str )
 {
-    return _nameCatMap[str];
+    auto it = _nameCatMap.find ( str );
+    return it == _nameCatMap.end() ? kCatUnknown : it->second;
 }
 
 static vector<string> _bayvec =
@@ -130,18 +132,31 @@ static vector<string> _convec =
     "TrA", "Tuc", "UMa", "UMi", "Vel", "Vir", "Vol", "Vul"
 };
 
-static map<string,int> _conmap;
-static map<string,int> _baymap;
+// Map from constellation abbreviations to their indices, starting at 1.
+// Built once at static initialization time (after the vectors above) so lookups are thread-safe.
 
-static void mapinit ( void )
+static map<string,int> makeIndexMap ( const vector<string> &vec )
 {
-    for ( int i = 0; i < _bayvec.size(); i++ )
-        _baymap.insert ( { _bayvec[i], i + 1 } );
+    map<string,int> index;
+    for ( int i = 0; i < vec.size(); i++ )
+        index.insert ( { vec[i], i + 1 } );
+    return index;
+}
+
+static const map<string,int> _conmap = makeIndexMap ( _convec );
+
+// Index of lower-case constellation abbreviations, for case-insensitive lookup.
 
-    for ( int i = 0; i < _convec.size(); i++ )
-        _conmap.insert ( { _convec[i], i + 1 } );
+static vector<string> makeLowerCase ( const vector<string> &vec )
+{
+    vector<string> lower = vec;
+    for ( string &str : lower )
+        toLower ( str );
+    return lower;
 }
 
+static const map<string,int> _conmapLower = makeIndexMap ( makeLowerCase ( _convec ) );
+
 string con_to_string ( int con )
 {
     return con > 0 && con < _convec.size() ? _convec[con - 1] : "";
@@ -149,17 +164,16 @@ string con_to_string ( int con )
 
 static int string_to_con ( const string &str, bool casesens = true )
 {
-    if ( _conmap.size() == 0 )
-        mapinit();
-    
     if ( casesens )
-        return _conmap[ str ];
-    
-    for ( int i = 0; i < _convec.size(); i++ )
-        if ( compare ( _convec[i], str, 0, casesens ) == 0 )
-            return i + 1;
+    {
+        auto it = _conmap.find ( str );
+        return it == _conmap.end() ? 0 : it->second;
+    }
     
-    return 0;
+    string lower = str;
+    toLower ( lower );
+    auto it = _conmapLower.find ( lower );
+    return it == _conmapLower.end() ? 0 : it->second;
 }
 
 static int string_to_bayer ( const string &str, bool casesens = true )
@@ -552,226 +566,259 @@ int64_t SSIdentifier::identifier ( void )
 
 SSIdentifier SSIdentifier::fromString ( const string &str, SSObjectType type, bool casesens )
 {
-    if ( _conmap.size() == 0 || _baymap.size() == 0 )
-        mapinit();
-
     size_t len = str.length();
 
-    // if string begins with "M", attempt to parse a Messier number
+    // Dispatch on the first character of the string to the parsers for catalogs whose prefixes begin with it,
+    // so other catalogs' prefixes are never compared. Parsers are tried in the same order as always; a case
+    // may fall through to the next one, whose prefixes its strings can't match, to reach a shared parser.
     
-    if ( compare ( str, "M", 1, casesens ) == 0 && len > 1 )
+    switch ( casesens ? str[0] : toupper ( (unsigned char) str[0] ) )
     {
-        int64_t m = strtoint ( str.substr ( 1, len - 1 ) );
-        if ( m > 0 && m <= 110 )
-            return SSIdentifier ( kCatMessier, m );
-    }
+        case 'M':
+            // if string begins with "M", attempt to parse a Messier number
 
-    // if string begins with "C", attempt to parse a Caldwell number
-    
-    if ( compare ( str, "C", 1, casesens ) == 0 && len > 1 )
-    {
-        int64_t c = strtoint ( str.substr ( 1, len - 1 ) );
-        if ( c > 0 && c <= 109 )
-            return SSIdentifier ( kCatCaldwell, c );
-    }
+            if ( compare ( str, "M", 1, casesens ) == 0 && len > 1 )
+            {
+                int64_t m = strtoint ( str.substr ( 1, len - 1 ) );
+                if ( m > 0 && m <= 110 )
+                    return SSIdentifier ( kCatMessier, m );
+            }
 
-    // if string begins with "NGC", attempt to parse a New General Catalog identifier
-    
-    if ( compare ( str, "NGC", 3, casesens ) == 0 && len > 3 )
-    {
-        int64_t ngc = string_to_ngcic ( str.substr ( 3, len - 3 ) );
-        if ( ngc )
-            return SSIdentifier ( kCatNGC, ngc );
-    }
+            // if string begins with "Mel", attempt to parse a Melotte open cluster identifier
 
-    // if string begins with "IC", attempt to parse an Index Catalog identifier
-    
-    if ( compare ( str, "IC", 2, casesens ) == 0 && len > 2 )
-    {
-        int64_t ic = string_to_ngcic ( str.substr ( 2, len - 2 ) );
-        if ( ic )
-            return SSIdentifier ( kCatIC, ic );
-    }
+            if ( compare ( str, "Mel", 3, casesens ) == 0 && len > 3 )
+            {
+                size_t mel = strtoint ( str.substr ( 3, len - 2 ) );
+                if ( mel > 0 )
+                    return SSIdentifier ( kCatMel, mel );
+            }
+            break;
 
-    // if string begins with "Mel", attempt to parse a Melotte open cluster identifier
-    
-    if ( compare ( str, "Mel", 3, casesens ) == 0 && len > 3 )
-    {
-        size_t mel = strtoint ( str.substr ( 3, len - 2 ) );
-        if ( mel > 0 )
-            return SSIdentifier ( kCatMel, mel );
-    }
+        case 'C':
+            // if string begins with "C", attempt to parse a Caldwell number
 
-    // if string begins with "Sh2", attempt to parse a Sharpless bright nebula identifier
-    
-    if ( compare ( str, "Sh2", 3, casesens ) == 0 && len > 3 )
-    {
-        int64_t sh2 = strtoint ( str.substr ( 3, len - 2 ) );
-        if ( sh2 > 0 )
-            return SSIdentifier ( kCatSh2, sh2 );
-    }
+            if ( compare ( str, "C", 1, casesens ) == 0 && len > 1 )
+            {
+                int64_t c = strtoint ( str.substr ( 1, len - 1 ) );
+                if ( c > 0 && c <= 109 )
+                    return SSIdentifier ( kCatCaldwell, c );
+            }
 
-    // if string begins with "LBN", attempt to parse a Lynds Bright Nebula identifier
-    
-    if ( compare ( str, "LBN", 3, casesens ) == 0 && len > 3 )
-    {
-        int64_t lbn = strtoint ( str.substr ( 3, len - 2 ) );
-        if ( lbn > 0 )
-            return SSIdentifier ( kCatLBN, lbn );
-    }
+            // if string begins with "CD", attempt to parse a Bonner Durchmusterung catalog identifier
 
-    // if string begins with "LDN", attempt to parse a Lynds Dark Nebula identifier
-    
-    if ( compare ( str, "LDN", 3, casesens ) == 0 && len > 3 )
-    {
-        int64_t ldn = strtoint ( str.substr ( 3, len - 2 ) );
-        if ( ldn > 0 )
-            return SSIdentifier ( kCatLDN, ldn );
-    }
+            if ( compare ( str, "CD", 2, casesens ) == 0 )
+            {
+                size_t pos = str.find_first_of ( "+-" );
+                if ( pos != string::npos )
+                    return SSIdentifier ( kCatCD, string_to_dm ( str.substr ( pos, len - pos ) ) );
+            }
 
-    // if string begins with "PNG", attempt to parse a Galactic Planetary Nebula number
-    
-    if ( compare ( str, "PNG", 3, casesens ) == 0 && len > 3 )
-    {
-        int64_t png = string_to_pngpk ( str.substr ( 3, len - 3 ) );
-        if ( png )
-            return SSIdentifier ( kCatPNG, png );
-    }
+            // if string begins with "CP", attempt to parse a Bonner Durchmusterung catalog identifier
 
-    // if string begins with "PK", attempt to parse a Perek-Kohoutek planetary nebula number
-    
-    if ( compare ( str, "PK", 2, casesens ) == 0 && len > 2 )
-    {
-        int64_t pk = string_to_pngpk ( str.substr ( 2, len - 2 ) );
-        if ( pk )
-            return SSIdentifier ( kCatPK, pk );
-    }
+            if ( compare ( str, "CP", 2, casesens ) == 0 )
+            {
+                size_t pos = str.find_first_of ( "+-" );
+                if ( pos != string::npos )
+                    return SSIdentifier ( kCatCP, string_to_dm ( str.substr ( pos, len - pos ) ) );
+            }
+            break;
 
-    // if string begins with "PGC", attempt to parse a Principal Galaxy Catalog identifier
-    
-    if ( compare ( str, "PGC", 3, casesens ) == 0 && len > 3 )
-    {
-        int64_t pgc = strtoint ( str.substr ( 3, len - 3 ) );
-        if ( pgc )
-            return SSIdentifier ( kCatPGC, pgc );
-    }
+        case 'I':
+            // if string begins with "IC", attempt to parse an Index Catalog identifier
 
-    // if string begins with "UGCA", attempt to parse a Uppsala Galaxy Catalog Appendix identifier
-    
-    if ( compare ( str, "UGCA", 4, casesens ) == 0 && len > 4 )
-    {
-        int64_t ugca = strtoint ( str.substr ( 4, len - 4 ) );
-        if ( ugca )
-            return SSIdentifier ( kCatUGCA, ugca );
-    }
-    
-    // if string begins with "UGC", attempt to parse a Uppsala Galaxy Catalog identifier
-    
-    if ( compare ( str, "UGC", 3, casesens ) == 0 && len > 3 )
-    {
-        int64_t ugc = strtoint ( str.substr ( 3, len - 3 ) );
-        if ( ugc )
-            return SSIdentifier ( kCatUGC, ugc );
-    }
+            if ( compare ( str, "IC", 2, casesens ) == 0 && len > 2 )
+            {
+                int64_t ic = string_to_ngcic ( str.substr ( 2, len - 2 ) );
+                if ( ic )
+                    return SSIdentifier ( kCatIC, ic );
+            }
+            break;
 
-    // if string begins with "HR", attempt to parse a Harvard Revised (Bright Star) catalog identifier
-    
-    if ( compare ( str, "HR", 2, casesens ) == 0 )
-    {
-        size_t pos = str.find_first_of ( "0123456789" );
-        if ( pos != string::npos )
-            return SSIdentifier ( kCatHR, stoi ( str.substr ( pos, len - pos ) ) );
-    }
-    
-    // if string begins with "HD", attempt to parse a Henry Draper catalog identifier
-    
-    if ( compare ( str, "HD", 2, casesens ) == 0 )
-    {
-        size_t pos = str.find_first_of ( "0123456789" );
-        if ( pos != string::npos )
-            return SSIdentifier ( kCatHD, stoi ( str.substr ( pos, len - pos ) ) );
-    }
+        case 'L':
+            // if string begins with "LBN", attempt to parse a Lynds Bright Nebula identifier
 
-    // if string begins with "SAO", attempt to parse a Smithsonian Astrophyiscal Observatory catalog identifier
-    
-    if ( compare ( str, "SAO", 3, casesens ) == 0 )
-    {
-        size_t pos = str.find_first_of ( "0123456789" );
-        if ( pos != string::npos )
-            return SSIdentifier ( kCatSAO, stoi ( str.substr ( pos, len - pos ) ) );
-    }
+            if ( compare ( str, "LBN", 3, casesens ) == 0 && len > 3 )
+            {
+                int64_t lbn = strtoint ( str.substr ( 3, len - 2 ) );
+                if ( lbn > 0 )
+                    return SSIdentifier ( kCatLBN, lbn );
+            }
 
-    // if string begins with "HIP", attempt to parse a Hipparcos catalog identifier
-    
-    if ( compare ( str, "HIP", 3, casesens ) == 0 )
-    {
-        size_t pos = str.find_first_of ( "0123456789" );
-        if ( pos != string::npos )
-            return SSIdentifier ( kCatHIP, stoi ( str.substr ( pos, len - pos ) ) );
-    }
+            // if string begins with "LDN", attempt to parse a Lynds Dark Nebula identifier
 
-    // if string begins with "TYC", attempt to parse a Tycho catalog identifier
-    
-    if ( compare ( str, "TYC", 3, casesens ) == 0 )
-    {
-        size_t pos = str.find_first_of ( "0123456789" );
-        if ( pos != string::npos )
-            return SSIdentifier ( kCatTYC, string_to_tyc ( str.substr ( pos, len - pos ) ) );
-    }
+            if ( compare ( str, "LDN", 3, casesens ) == 0 && len > 3 )
+            {
+                int64_t ldn = strtoint ( str.substr ( 3, len - 2 ) );
+                if ( ldn > 0 )
+                    return SSIdentifier ( kCatLDN, ldn );
+            }
+            break;
 
-    // if string begins with "GAIA", attempt to parse a GAIA catalog identifier
-    
-    if ( compare ( str, "GAIA", 4, casesens ) == 0 )
-    {
-        size_t pos = str.find_first_of ( "0123456789" );
-        if ( pos != string::npos )
-            return SSIdentifier ( kCatGAIA, stoll ( str.substr ( pos, len - pos ) ) );
-    }
+        case 'P':
+            // if string begins with "PNG", attempt to parse a Galactic Planetary Nebula number
 
-    // if string begins with "BD" or "SD", attempt to parse a Bonner Durchmusterung catalog identifier
-    // Note: "SD" is abbrevieation for Southern Durchmusterung, found in SKY2000 Master Star Catalog.
-    
-    if ( compare ( str, "BD", 2, casesens ) == 0 || compare ( str, "SD", 2, casesens ) == 0 )
-    {
-        size_t pos = str.find_first_of ( "+-" );
-        if ( pos != string::npos )
-            return SSIdentifier ( kCatBD, string_to_dm ( str.substr ( pos, len - pos ) ) );
-    }
+            if ( compare ( str, "PNG", 3, casesens ) == 0 && len > 3 )
+            {
+                int64_t png = string_to_pngpk ( str.substr ( 3, len - 3 ) );
+                if ( png )
+                    return SSIdentifier ( kCatPNG, png );
+            }
 
-    // if string begins with "CD", attempt to parse a Bonner Durchmusterung catalog identifier
-    
-    if ( compare ( str, "CD", 2, casesens ) == 0 )
-    {
-        size_t pos = str.find_first_of ( "+-" );
-        if ( pos != string::npos )
-            return SSIdentifier ( kCatCD, string_to_dm ( str.substr ( pos, len - pos ) ) );
-    }
+            // if string begins with "PK", attempt to parse a Perek-Kohoutek planetary nebula number
 
-    // if string begins with "CP", attempt to parse a Bonner Durchmusterung catalog identifier
-    
-    if ( compare ( str, "CP", 2, casesens ) == 0 )
-    {
-        size_t pos = str.find_first_of ( "+-" );
-        if ( pos != string::npos )
-            return SSIdentifier ( kCatCP, string_to_dm ( str.substr ( pos, len - pos ) ) );
-    }
+            if ( compare ( str, "PK", 2, casesens ) == 0 && len > 2 )
+            {
+                int64_t pk = string_to_pngpk ( str.substr ( 2, len - 2 ) );
+                if ( pk )
+                    return SSIdentifier ( kCatPK, pk );
+            }
 
-    // if string begins with "WDS", attempt to parse a Washington Double Star catalog identifier
-    
-    if ( compare ( str, "WDS", 3, casesens ) == 0 && len > 3 )
-    {
-        int64_t wds = string_to_wds ( str.substr ( 3, len - 3 ) );
-        if ( wds )
-            return SSIdentifier ( kCatWDS, wds );
-    }
-    
-    // if string begins with "GJ", "Gl", "Wo", or "NN", attempt to parse a Gliese-Jahreiss Nearby Star Catalog identifier
-    
-    if ( ( compare ( str, "GJ", 2, casesens ) == 0 || compare ( str, "Gl", 2, casesens ) == 0 || compare ( str, "NN", 2, casesens ) == 0 || compare ( str, "Wo", 2, casesens ) == 0 ) && len > 2 )
-    {
-        int64_t gj = string_to_gj ( str.substr ( 2, len - 2 ) );
-        if ( gj )
-            return SSIdentifier ( kCatGJ, gj );
+            // if string begins with "PGC", attempt to parse a Principal Galaxy Catalog identifier
+
+            if ( compare ( str, "PGC", 3, casesens ) == 0 && len > 3 )
+            {
+                int64_t pgc = strtoint ( str.substr ( 3, len - 3 ) );
+                if ( pgc )
+                    return SSIdentifier ( kCatPGC, pgc );
+            }
+            break;
+
+        case 'U':
+            // if string begins with "UGCA", attempt to parse a Uppsala Galaxy Catalog Appendix identifier
+
+            if ( compare ( str, "UGCA", 4, casesens ) == 0 && len > 4 )
+            {
+                int64_t ugca = strtoint ( str.substr ( 4, len - 4 ) );
+                if ( ugca )
+                    return SSIdentifier ( kCatUGCA, ugca );
+            }
+
+            // if string begins with "UGC", attempt to parse a Uppsala Galaxy Catalog identifier
+
+            if ( compare ( str, "UGC", 3, casesens ) == 0 && len > 3 )
+            {
+                int64_t ugc = strtoint ( str.substr ( 3, len - 3 ) );
+                if ( ugc )
+                    return SSIdentifier ( kCatUGC, ugc );
+            }
+            break;
+
+        case 'H':
+            // if string begins with "HR", attempt to parse a Harvard Revised (Bright Star) catalog identifier
+
+            if ( compare ( str, "HR", 2, casesens ) == 0 )
+            {
+                size_t pos = str.find_first_of ( "0123456789" );
+                if ( pos != string::npos )
+                    return SSIdentifier ( kCatHR, stoi ( str.substr ( pos, len - pos ) ) );
+            }
+
+            // if string begins with "HD", attempt to parse a Henry Draper catalog identifier
+
+            if ( compare ( str, "HD", 2, casesens ) == 0 )
+            {
+                size_t pos = str.find_first_of ( "0123456789" );
+                if ( pos != string::npos )
+                    return SSIdentifier ( kCatHD, stoi ( str.substr ( pos, len - pos ) ) );
+            }
+
+            // if string begins with "HIP", attempt to parse a Hipparcos catalog identifier
+
+            if ( compare ( str, "HIP", 3, casesens ) == 0 )
+            {
+                size_t pos = str.find_first_of ( "0123456789" );
+                if ( pos != string::npos )
+                    return SSIdentifier ( kCatHIP, stoi ( str.substr ( pos, len - pos ) ) );
+            }
+            break;
+
+        case 'T':
+            // if string begins with "TYC", attempt to parse a Tycho catalog identifier
+
+            if ( compare ( str, "TYC", 3, casesens ) == 0 )
+            {
+                size_t pos = str.find_first_of ( "0123456789" );
+                if ( pos != string::npos )
+                    return SSIdentifier ( kCatTYC, string_to_tyc ( str.substr ( pos, len - pos ) ) );
+            }
+            break;
+
+        case 'S':
+            // if string begins with "Sh2", attempt to parse a Sharpless bright nebula identifier
+
+            if ( compare ( str, "Sh2", 3, casesens ) == 0 && len > 3 )
+            {
+                int64_t sh2 = strtoint ( str.substr ( 3, len - 2 ) );
+                if ( sh2 > 0 )
+                    return SSIdentifier ( kCatSh2, sh2 );
+            }
+
+            // if string begins with "SAO", attempt to parse a Smithsonian Astrophyiscal Observatory catalog identifier
+
+            if ( compare ( str, "SAO", 3, casesens ) == 0 )
+            {
+                size_t pos = str.find_first_of ( "0123456789" );
+                if ( pos != string::npos )
+                    return SSIdentifier ( kCatSAO, stoi ( str.substr ( pos, len - pos ) ) );
+            }
+
+            // "SD" is parsed with "BD"
+            // fall through
+        case 'B':
+            // if string begins with "BD" or "SD", attempt to parse a Bonner Durchmusterung catalog identifier
+            // Note: "SD" is abbrevieation for Southern Durchmusterung, found in SKY2000 Master Star Catalog.
+
+            if ( compare ( str, "BD", 2, casesens ) == 0 || compare ( str, "SD", 2, casesens ) == 0 )
+            {
+                size_t pos = str.find_first_of ( "+-" );
+                if ( pos != string::npos )
+                    return SSIdentifier ( kCatBD, string_to_dm ( str.substr ( pos, len - pos ) ) );
+            }
+            break;
+
+        case 'W':
+            // if string begins with "WDS", attempt to parse a Washington Double Star catalog identifier
+
+            if ( compare ( str, "WDS", 3, casesens ) == 0 && len > 3 )
+            {
+                int64_t wds = string_to_wds ( str.substr ( 3, len - 3 ) );
+                if ( wds )
+                    return SSIdentifier ( kCatWDS, wds );
+            }
+
+            // "Wo" is parsed with "GJ"
+            // fall through
+        case 'G':
+            // if string begins with "GAIA", attempt to parse a GAIA catalog identifier
+
+            if ( compare ( str, "GAIA", 4, casesens ) == 0 )
+            {
+                size_t pos = str.find_first_of ( "0123456789" );
+                if ( pos != string::npos )
+                    return SSIdentifier ( kCatGAIA, stoll ( str.substr ( pos, len - pos ) ) );
+            }
+
+            // "Gl" is parsed with "GJ"
+            // fall through
+        case 'N':
+            // if string begins with "NGC", attempt to parse a New General Catalog identifier
+
+            if ( compare ( str, "NGC", 3, casesens ) == 0 && len > 3 )
+            {
+                int64_t ngc = string_to_ngcic ( str.substr ( 3, len - 3 ) );
+                if ( ngc )
+                    return SSIdentifier ( kCatNGC, ngc );
+            }
+
+            // if string begins with "GJ", "Gl", "Wo", or "NN", attempt to parse a Gliese-Jahreiss Nearby Star Catalog identifier
+
+            if ( ( compare ( str, "GJ", 2, casesens ) == 0 || compare ( str, "Gl", 2, casesens ) == 0 || compare ( str, "NN", 2, casesens ) == 0 || compare ( str, "Wo", 2, casesens ) == 0 ) && len > 2 )
+            {
+                int64_t gj = string_to_gj ( str.substr ( 2, len - 2 ) );
+                if ( gj )
+                    return SSIdentifier ( kCatGJ, gj );
+            }
+            break;
     }
 
     // Tokenize string into words separated by whitespace.
@@ -867,9 +914,6 @@ SSIdentifier SSIdentifier::fromString ( const string &str, SSObjectType type, bo
 
 string SSIdentifier::toString ( void )
 {
-    if ( _conmap.size() == 0 || _baymap.size() == 0 )
-        mapinit();
-
     SSCatalog cat = catalog();
     int64_t id = identifier();
     string str = "";
@@ -1065,7 +1109,7 @@ int SSImportIdentifierNameMap ( const string &filename, SSIdentifierNameMap &nam
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -1074,7 +1118,7 @@ int SSImportIdentifierNameMap ( const string &filename, SSIdentifierNameMap &nam
     string line = "";
     int paircount = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         // Split line into tokens separated by commas.
         // Require at least 2 tokens.  First token is name.
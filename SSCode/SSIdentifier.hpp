@@ -14,6 +14,9 @@
 #include <string>
 #include <map>
 
+#include "SSStringPool.hpp"
+#include "SSFlatMap.hpp"
+
 using namespace std;
 
 // Recognized astronomical object types
@@ -126,8 +129,8 @@ public:
 };
 
 typedef vector<SSIdentifier> SSIdentifierVec;
-typedef multimap<SSIdentifier,SSIdentifier> SSIdentifierMap;
-typedef multimap<SSIdentifier,string> SSIdentifierNameMap;
+typedef SSFlatMap<SSIdentifier,SSIdentifier,true> SSIdentifierMap;
+typedef SSFlatMap<SSIdentifier,SSIString,true> SSIdentifierNameMap;
 
 int SSImportIdentifierNameMap ( const string &filename, SSIdentifierNameMap &nameMap );
 vector<string> SSIdentifiersToNames ( SSIdentifierVec &idents, SSIdentifierNameMap &nameMap );
@@ -66,7 +66,7 @@ int SSImportGCVSCrossIdentifiers ( const string &filename, SSIdentifierMap &iden
 {
     // Open file; return on failure.
     
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
     
@@ -75,7 +75,7 @@ int SSImportGCVSCrossIdentifiers ( const string &filename, SSIdentifierMap &iden
     string line ( "" );
     int count = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         if ( line.length() < 47 )
             continue;
@@ -134,7 +134,7 @@ int SSImportGCVS ( const string &filename, SSIdentifierMap &identmap, SSObjectAr
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -143,7 +143,7 @@ int SSImportGCVS ( const string &filename, SSIdentifierMap &identmap, SSObjectAr
     string line = "";
     int numStars = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         if ( line.length() < 236 )
             continue;
@@ -79,20 +79,20 @@ int SSImportGJCNS3 ( const string &filename, SSIdentifierNameMap &nameMap, SSObj
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return ( 0 );
 
     // Set up matrix for precessing B1950 coordinates and proper motion to J2000
     
-    SSMatrix precession = SSCoordinates::getPrecessionMatrix ( SSTime::kB1950 ).transpose();
+    SSMatrix precession = SSCoordinates::getPrecessionMatrix ( SSTime::kB1950, SSTime::kJ2000 );
     
     // Read file line-by-line until we reach end-of-file
 
     string line = "";
     int numStars = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         size_t len = line.length();
         if ( line.length() < 119 )
@@ -299,7 +299,7 @@ int SSImportGJAC ( const string &filename, SSObjectVec &hipStars, SSObjectVec &s
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return ( 0 );
 
@@ -312,7 +312,7 @@ int SSImportGJAC ( const string &filename, SSObjectVec &hipStars, SSObjectVec &s
     string line = "";
     int numStars = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         if ( line.length() < 124 )
             continue;
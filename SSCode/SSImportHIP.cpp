@@ -56,7 +56,7 @@ int SSImportHIPNames ( const string &filename, SSIdentifierNameMap &nameMap )
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -65,7 +65,7 @@ int SSImportHIPNames ( const string &filename, SSIdentifierNameMap &nameMap )
     string line = "";
     int nameCount = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         string strHIP = trim ( line.substr ( 17, 6 ) );
         string strName = trim ( line.substr ( 0, 16 ) );
@@ -130,7 +130,7 @@ int SSImportHIC ( const string &filename, SSObjectVec &stars )
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
     
@@ -139,7 +139,7 @@ int SSImportHIC ( const string &filename, SSObjectVec &stars )
     string line = "";
     int numStars = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         string strHIP = trim ( line.substr ( 0, 6 ) );
         string strRA = trim ( line.substr ( 13, 12 ) );
@@ -243,7 +243,7 @@ int SSImportHIP2 ( const string &filename, SSObjectVec &stars )
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -252,7 +252,7 @@ int SSImportHIP2 ( const string &filename, SSObjectVec &stars )
     string line = "";
     int numStars = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         string strHIP = trim ( line.substr ( 0, 6 ) );
         string strRA = trim ( line.substr ( 15, 13 ) );
@@ -360,7 +360,7 @@ int SSImportHIP ( const string &filename, SSIdentifierMap &hrMap, SSIdentifierMa
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -375,7 +375,7 @@ int SSImportHIP ( const string &filename, SSIdentifierMap &hrMap, SSIdentifierMa
     string line = "";
     int numStars = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         string strHIP = trim ( line.substr ( 8, 6 ) );
         string strRA = trim ( line.substr ( 51, 12 ) );
@@ -536,7 +536,7 @@ int SSImportHIPHRIdentifiers ( const string &filename, SSIdentifierMap &map )
 {
     // Open file; return on failure.
     
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
     
@@ -545,7 +545,7 @@ int SSImportHIPHRIdentifiers ( const string &filename, SSIdentifierMap &map )
     string line ( "" );
     int count = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         string strHR = trim ( line.substr ( 0, 6 ) );
         string strHIP = trim ( line.substr ( 7, 6 ) );
@@ -573,7 +573,7 @@ int SSImportHIPBayerIdentifiers ( const string &filename, SSIdentifierMap &map )
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
     
@@ -582,7 +582,7 @@ int SSImportHIPBayerIdentifiers ( const string &filename, SSIdentifierMap &map )
     string line = "";
     int count = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         string strBF = trim ( line.substr ( 0, 11 ) );
         string strHIP = trim ( line.substr ( 12, 6 ) );
@@ -611,7 +611,7 @@ int SSImportHIPGCVSIdentifiers ( const string &filename, SSIdentifierMap &map )
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
     
@@ -620,7 +620,7 @@ int SSImportHIPGCVSIdentifiers ( const string &filename, SSIdentifierMap &map )
     string line = "";
     int count = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         string strVar = trim ( line.substr ( 0, 11 ) );
         string strHIP = trim ( line.substr ( 12, 6 ) );
@@ -7,6 +7,7 @@
 //
 
 #include "SSImportJPL.hpp"
+#include "SSImportMPC.hpp"
 
 // Converts one line of a JPL DASTCOM export CSV file to an SSPlanet of kTypeAsteroid
 // or kTypeComet (type); all other object types fail to create an SSPlanet.
@@ -18,14 +19,25 @@
 
 SSPlanetPtr SSImportJPLAstCom ( const string &line, SSObjectType type )
 {
+    SSPlanet astcom ( type );
+    return SSImportJPLAstCom ( line, astcom ) ? new SSPlanet ( astcom ) : nullptr;
+}
+
+// As above, but stores the object's orbit and other properties in an existing, newly constructed SSPlanet
+// (astcom) whose type must be kTypeAsteroid or kTypeComet, without allocating it.
+// Returns true if successful or false on failure.
+
+bool SSImportJPLAstCom ( const string &line, SSPlanet &astcom )
+{
+    SSObjectType type = astcom.getType();
     if ( type < kTypeAsteroid || type > kTypeComet )
-        return nullptr;
+        return false;
     
     // split string into comma-delimited fields; require at least 14
 
     vector<string> fields = split_csv ( line );
     if ( fields.size() < 17 )
-        return nullptr;
+        return false;
     
     // remove leading & trailing whitespace/line breaks from each field.
 
@@ -45,7 +57,7 @@ SSPlanetPtr SSImportJPLAstCom ( const string &line, SSObjectType type )
     // reject invalid orbits
     
     if ( orbit.q <= 0.0 || orbit.t <= 0.0 )
-        return nullptr;
+        return false;
     
     // For asteroids, compute perihelion from semimajor axis and eccentricity
     
@@ -118,28 +130,22 @@ SSPlanetPtr SSImportJPLAstCom ( const string &line, SSObjectType type )
         }
     }
     
-    // Allocate new object; return nullptr on failure
-    
-    SSPlanetPtr pAstCom = new SSPlanet ( type );
-    if ( pAstCom == nullptr )
-        return nullptr;
-    
-    pAstCom->setNames ( names );
+    astcom.setNames ( names );
     if ( number )
-        pAstCom->setIdentifier ( SSIdentifier ( type == kTypeAsteroid ? kCatAstNum : kCatComNum, number ) );
+        astcom.setIdentifier ( SSIdentifier ( type == kTypeAsteroid ? kCatAstNum : kCatComNum, number ) );
 
-    pAstCom->setOrbit ( orbit );
-    pAstCom->setHMagnitude ( h );
-    pAstCom->setGMagnitude ( type == kTypeComet ? g / 2.5 : g );
-    pAstCom->setColorIndex ( c );
-    pAstCom->setRadius ( d / 2.0 );
-    pAstCom->setMass ( m / SSCoordinates::kKgPerEarthMass );
-    pAstCom->setRotationPeriod ( p );
-    pAstCom->setAlbedo ( a );
-    pAstCom->setTaxonomy ( fields[16] );
+    astcom.setOrbit ( orbit );
+    astcom.setHMagnitude ( h );
+    astcom.setGMagnitude ( type == kTypeComet ? g / 2.5 : g );
+    astcom.setColorIndex ( c );
+    astcom.setRadius ( d / 2.0 );
+    astcom.setMass ( m / SSCoordinates::kKgPerEarthMass );
+    astcom.setRotationPeriod ( p );
+    astcom.setAlbedo ( a );
+    astcom.setTaxonomy ( fields[16] );
 
-    // cout << pAstCom->toCSV() << endl;
-    return pAstCom;
+    // cout << astcom.toCSV() << endl;
+    return true;
 }
 
 // Read asteroid or comet data from a JPL DASTCOM export file in CSV format for objects
@@ -147,37 +153,15 @@ SSPlanetPtr SSImportJPLAstCom ( const string &line, SSObjectType type )
 // Imported data is appended to the input vector of SSObjects (objects).
 // If a non-null filter function (filter) is provided, objects are imported
 // only if they pass the filter; optional data pointer (userData) is passed
-// to the filter but not used otherwise.
+// to the filter but not used otherwise. The file is parsed on (threads) threads;
+// see SSImportPlanetsFromLines().
 // Returns number of objects successfully imported.
 
-int SSImportJPLDASTCOM ( const string &filename, SSObjectType type, SSObjectVec &objects, SSObjectFilter filter, void *userData )
+int SSImportJPLDASTCOM ( const string &filename, SSObjectType type, SSObjectVec &objects, SSObjectFilter filter, void *userData, int threads )
 {
     if ( type < kTypeAsteroid || type > kTypeComet )
         return 0;
     
-    // Open file; return on failure.
-
-    ifstream file ( filename );
-    if ( ! file )
-        return ( 0 );
-
-    // Read file line-by-line until we reach end-of-file
-
-    string line = "";
-    int numLines = 0, numAstCom = 0;
-    while ( getline ( file, line ) )
-    {
-        numLines++;
-        SSPlanetPtr pAstCom = SSImportJPLAstCom ( line, type );
-        if ( pAstCom )
-        {
-            if ( filter == nullptr || filter ( pAstCom, userData ) )
-            {
-                objects.append ( pAstCom );
-                numAstCom++;
-            }
-        }
-    }
-    
-    return numAstCom;
+    auto parser = [] ( const string &line, SSPlanet &astcom ) { return SSImportJPLAstCom ( line, astcom ); };
+    return SSImportPlanetsFromLines ( filename, type, parser, objects, filter, userData, threads );
 }
@@ -11,6 +11,7 @@
 #include "SSPlanet.hpp"
 
 SSPlanetPtr SSImportJPLAstCom ( const string &line, SSObjectType type );
-int SSImportJPLDASTCOM ( const string &filename, SSObjectType type, SSObjectVec &objects, SSObjectFilter filter = nullptr, void *userData = nullptr );
+bool SSImportJPLAstCom ( const string &line, SSPlanet &astcom );
+int SSImportJPLDASTCOM ( const string &filename, SSObjectType type, SSObjectVec &objects, SSObjectFilter filter = nullptr, void *userData = nullptr, int threads = 1 );
 
 #endif /* SSImportJPL_hpp */
@@ -9,15 +9,29 @@
 
 #include "SSTime.hpp"
 #include "SSImportMPC.hpp"
+#include "SSGzip.hpp"
+
+#if USE_THREADS
+#include <thread>
+#endif
 
 // Converts one line of a Minor Planet Center comet orbit export file to an SSPlanet.
 // Returns pointer to newly-allocated SSPlanet if successful or nullptr on failure.
 // MPC comets file is at https://www.minorplanetcenter.net/iau/MPCORB/CometEls.txt
 
 SSPlanetPtr SSImportMPCComet ( const string &line )
+{
+    SSPlanet comet ( kTypeComet );
+    return SSImportMPCComet ( line, comet ) ? new SSPlanet ( comet ) : nullptr;
+}
+
+// As above, but stores the comet's orbit, identifier, names, and magnitudes in an existing SSPlanet (comet),
+// which should be newly constructed, without allocating anything. Returns true if successful or false on failure.
+
+bool SSImportMPCComet ( const string &line, SSPlanet &comet )
 {
     if ( line.length() < 160 )
-        return nullptr;
+        return false;
     
     // col 1-4: periodic or interstellar comet number, denoted with 'P' or 'I' in column 5.
     // col 6-12: provisional designation. Both currently unused.
@@ -32,7 +46,7 @@ SSPlanetPtr SSImportMPCComet ( const string &line )
     double day = strtofloat64 ( line.substr ( 22, 7 ) );
     double peridate = year && month && day ? SSTime ( SSDate ( kGregorianJulian, 0.0, year, month, day, 0, 0, 0 ) ).jd : 0.0;
     if ( peridate == 0.0 )
-        return nullptr;
+        return false;
             
     // col 31-39: perihelion distance (AU)
     
@@ -119,12 +133,6 @@ SSPlanetPtr SSImportMPCComet ( const string &line )
         }
     }
 
-    // Allocate new comet object with default values
-    
-    SSPlanetPtr pComet = new SSPlanet ( kTypeComet );
-    if ( pComet == nullptr )
-        return nullptr;
-    
     // Compute mean motion from semimajor axis.
     // If we have an epoch, compute mean anomaly at epoch.
     // Otherwise, use perihelion date as epoch and set mean anomaly to zero.
@@ -135,15 +143,15 @@ SSPlanetPtr SSImportMPCComet ( const string &line )
     SSOrbit orbit ( t, q, e, i, w, n, m, mdm );
     
     if ( number )
-        pComet->setIdentifier ( number );
+        comet.setIdentifier ( number );
 
-    pComet->setNames ( names );
-    pComet->setOrbit ( orbit );
-    pComet->setHMagnitude ( hmag );
-    pComet->setGMagnitude ( gmag );
+    comet.setNames ( names );
+    comet.setOrbit ( orbit );
+    comet.setHMagnitude ( hmag );
+    comet.setGMagnitude ( gmag );
     
-    // cout << pComet->toCSV() << endl;
-    return pComet;
+    // cout << comet.toCSV() << endl;
+    return true;
 }
 
 // Converts one line of a Minor Planet Center asteroid orbit export file to an SSPlanet.
@@ -151,9 +159,18 @@ SSPlanetPtr SSImportMPCComet ( const string &line )
 // MPC asteroids file is at https://www.minorplanetcenter.net/iau/MPCORB/MPCORB.DAT
 
 SSPlanetPtr SSImportMPCAsteroid ( const string &line )
+{
+    SSPlanet asteroid ( kTypeAsteroid );
+    return SSImportMPCAsteroid ( line, asteroid ) ? new SSPlanet ( asteroid ) : nullptr;
+}
+
+// As above, but stores the asteroid's orbit, identifier, names, and magnitudes in an existing SSPlanet (asteroid),
+// which should be newly constructed, without allocating anything. Returns true if successful or false on failure.
+
+bool SSImportMPCAsteroid ( const string &line, SSPlanet &asteroid )
 {
     if ( line.length() < 167 )
-        return nullptr;
+        return false;
 
     // col 9-13: absolute magnitude
     
@@ -177,7 +194,7 @@ SSPlanetPtr SSImportMPCAsteroid ( const string &line )
     else if ( toupper( field[3] ) >= 'A' && toupper( field[3] ) <= 'C' )
         month = 10 + toupper ( field[3] ) - 'A';
     else
-        return nullptr;
+        return false;
     
     double day = 0.0;
     if ( field[4] >= '1' && field[4] <= '9' )
@@ -185,7 +202,7 @@ SSPlanetPtr SSImportMPCAsteroid ( const string &line )
     else if ( toupper ( field[4] ) >= 'A' && toupper ( field[4] ) <= 'V' )
         day = 10 + toupper ( field[4] ) - 'A';
     else
-        return nullptr;
+        return false;
     
     double epoch = year && month && day ? SSTime ( SSDate ( kGregorianJulian, 0.0, year, month, day, 0, 0, 0 ) ).jd : 0.0;
     
@@ -244,86 +261,159 @@ SSPlanetPtr SSImportMPCAsteroid ( const string &line )
     if ( ! field.empty() )
         names.push_back ( field );
     
-    // Allocate new asteroid object with default values
-    
-    SSPlanetPtr pAsteroid = new SSPlanet ( kTypeAsteroid );
-    if ( pAsteroid == nullptr )
-        return nullptr;
-    
     SSOrbit orbit ( epoch, a * ( 1.0 - e ), e, i, w, n, m, mm );
 
     if ( number )
-        pAsteroid->setIdentifier ( number );
+        asteroid.setIdentifier ( number );
     
-    pAsteroid->setNames ( names );
-    pAsteroid->setOrbit ( orbit );
-    pAsteroid->setHMagnitude ( hmag );
-    pAsteroid->setGMagnitude ( gmag );
+    asteroid.setNames ( names );
+    asteroid.setOrbit ( orbit );
+    asteroid.setHMagnitude ( hmag );
+    asteroid.setGMagnitude ( gmag );
 
-    // cout << pAsteroid->toCSV() << endl;
-    return pAsteroid;
+    // cout << asteroid.toCSV() << endl;
+    return true;
 }
 
-// Reads comet data from a Minor Planet Center comet orbit export file:
-// https://www.minorplanetcenter.net/iau/MPCORB/CometEls.txt
-// Imported data is appended to the input vector of SSObjects (comets).
-// Returns number of comets successfully imported.
+// Parses the lines from (begin) up to (end) of a text file in memory into new SSPlanets of the given type,
+// appended to a vector of SSObject pointers (objects). Each line is parsed into an SSPlanet on the stack;
+// only lines which the parser accepts and which pass the filter (if not null) are copied to the heap.
 
-int SSImportMPCComets ( const string &filename, SSObjectVec &comets )
+static void importLineRange ( const char *begin, const char *end, SSObjectType type, SSPlanetLineParser parser, SSObjectFilter filter, void *userData, vector<SSObjectPtr> &objects )
 {
-    // Open file; return on failure.
-
-    ifstream file ( filename );
-    if ( ! file )
-        return ( 0 );
-
-    // Read file line-by-line until we reach end-of-file
-
     string line = "";
-    int numLines = 0, numComets = 0;
+    
+    while ( begin < end )
+    {
+        const char *eol = (const char *) memchr ( begin, '\n', end - begin );
+        if ( eol == nullptr )
+            eol = end;
+        
+        line.assign ( begin, eol );
+        begin = eol + 1;
+        
+        SSPlanet planet ( type );
+        if ( parser ( line, planet ) && ( filter == nullptr || filter ( &planet, userData ) ) )
+            objects.push_back ( new SSPlanet ( planet ) );
+    }
+}
+
+// Reads solar system objects of a given type from a text file with one object per line,
+// using a parser function (parser) to convert each line to an SSPlanet. The file is memory-mapped
+// (or read into memory in one piece if mapping fails), split into chunks on line boundaries,
+// and the chunks are parsed on separate threads (threads; if zero or negative, one per processor core).
+// Imported objects are appended to the input vector of SSObjects (objects) in the same order as in the file.
+// If a non-null filter function (filter) is provided, objects are imported only if they pass
+// the filter; objects which don't pass are never allocated. The filter sees a temporary SSPlanet
+// which it must not keep; with multiple threads, it may be called from several threads at once.
+// Returns number of objects successfully imported.
 
-    while ( getline ( file, line ) )
+int SSImportPlanetsFromLines ( const string &filename, SSObjectType type, SSPlanetLineParser parser, SSObjectVec &objects, SSObjectFilter filter, void *userData, int threads )
+{
+    // Map file into memory. If that fails, read it in the old-fashioned way.
+    // A gzip-compressed file (e.g. MPCORB.DAT.gz) is decompressed into memory.
+    
+    size_t size = 0;
+    const char *data = (const char *) mapfile ( filename, size );
+    vector<char> buffer;
+    bool mapped = data != nullptr;
+    
+    if ( mapped && SSGzipReader::isGzip ( data, size ) )
     {
-        numLines++;
-        SSPlanetPtr pComet = SSImportMPCComet ( line );
-        if ( pComet )
-        {
-            comets.append ( pComet );
-            numComets++;
-        }
+        bool ok = SSGzipReader::gunzip ( data, size, buffer );
+        unmapfile ( data, size );
+        if ( ! ok )
+            return 0;
+        
+        mapped = false;
+        data = buffer.data();
+        size = buffer.size();
+    }
+    else if ( ! mapped )
+    {
+        if ( ! SSGzipReader::readFile ( filename, buffer ) )
+            return 0;
+        
+        data = buffer.data();
+        size = buffer.size();
+    }
+    
+    // Split file into chunks of at least 1 MB, one per thread, ending on line boundaries.
+    
+    static constexpr size_t kMinChunkSize = 1 << 20;
+    
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+#endif
+    size_t chunks = max ( (size_t) 1, min ( (size_t) max ( threads, 1 ), size / kMinChunkSize ) );
+    
+    vector<const char *> bounds ( chunks + 1, data + size );
+    bounds[0] = data;
+    for ( size_t c = 1; c < chunks; c++ )
+    {
+        const char *start = max ( bounds[c - 1], data + c * ( size / chunks ) );
+        const char *eol = (const char *) memchr ( start, '\n', data + size - start );
+        bounds[c] = eol ? eol + 1 : data + size;
+    }
+    
+    // Parse chunks after the first on their own threads, and the first on this thread.
+    
+    vector<vector<SSObjectPtr>> results ( chunks );
+    
+#if USE_THREADS
+    vector<thread> workers;
+    for ( size_t c = 1; c < chunks; c++ )
+        workers.push_back ( thread ( importLineRange, bounds[c], bounds[c + 1], type, parser, filter, userData, ref ( results[c] ) ) );
+    
+    importLineRange ( bounds[0], bounds[1], type, parser, filter, userData, results[0] );
+    
+    for ( thread &worker : workers )
+        worker.join();
+#else
+    for ( size_t c = 0; c < chunks; c++ )
+        importLineRange ( bounds[c], bounds[c + 1], type, parser, filter, userData, results[c] );
+#endif
+    
+    if ( mapped )
+        unmapfile ( data, size );
+    
+    // Merge results in file order.
+    
+    int numObjects = 0;
+    for ( vector<SSObjectPtr> &result : results )
+    {
+        for ( SSObjectPtr pObject : result )
+            objects.append ( pObject );
+        numObjects += (int) result.size();
     }
     
-    return numComets;
+    return numObjects;
+}
+
+// Reads comet data from a Minor Planet Center comet orbit export file:
+// https://www.minorplanetcenter.net/iau/MPCORB/CometEls.txt
+// Imported data is appended to the input vector of SSObjects (comets).
+// If a non-null filter function (filter) is provided, comets are imported
+// only if they pass the filter; optional data pointer (userData) is passed
+// to the filter but not used otherwise. The file is parsed on (threads) threads;
+// see SSImportPlanetsFromLines().
+// Returns number of comets successfully imported.
+
+int SSImportMPCComets ( const string &filename, SSObjectVec &comets, SSObjectFilter filter, void *userData, int threads )
+{
+    auto parser = [] ( const string &line, SSPlanet &comet ) { return SSImportMPCComet ( line, comet ); };
+    return SSImportPlanetsFromLines ( filename, kTypeComet, parser, comets, filter, userData, threads );
 }
 
 // Read asteroid data from a Minor Planet Center asteroid orbit export file:
 // https://www.minorplanetcenter.net/iau/MPCORB/MPCORB.DAT
 // Imported data is appended to the input vector of SSObjects (asteroids).
+// Filter, user data, and threads are as for SSImportMPCComets().
 // Returns number of asteroids successfully imported.
 
-int SSImportMPCAsteroids ( const string &filename, SSObjectVec &asteroids )
+int SSImportMPCAsteroids ( const string &filename, SSObjectVec &asteroids, SSObjectFilter filter, void *userData, int threads )
 {
-    // Open file; return on failure.
-
-    ifstream file ( filename );
-    if ( ! file )
-        return ( 0 );
-
-    // Read file line-by-line until we reach end-of-file
-
-    string line = "";
-    int numLines = 0, numAsteroids = 0;
-
-    while ( getline ( file, line ) )
-    {
-        numLines++;
-        SSPlanetPtr pAsteroid = SSImportMPCAsteroid ( line );
-        if ( pAsteroid )
-        {
-            asteroids.append ( pAsteroid );
-            numAsteroids++;
-        }
-    }
-    
-    return numAsteroids;
+    auto parser = [] ( const string &line, SSPlanet &asteroid ) { return SSImportMPCAsteroid ( line, asteroid ); };
+    return SSImportPlanetsFromLines ( filename, kTypeAsteroid, parser, asteroids, filter, userData, threads );
 }
@@ -13,7 +13,16 @@
 SSPlanetPtr SSImportMPCComet ( const string &line );
 SSPlanetPtr SSImportMPCAsteroid ( const string &line );
 
-int SSImportMPCComets ( const string &filename, SSObjectVec &comets );
-int SSImportMPCAsteroids ( const string &filename, SSObjectVec &comets );
+bool SSImportMPCComet ( const string &line, SSPlanet &comet );
+bool SSImportMPCAsteroid ( const string &line, SSPlanet &asteroid );
+
+// Converts one line of text to an existing SSPlanet (planet); returns true if successful.
+
+typedef bool (*SSPlanetLineParser) ( const string &line, SSPlanet &planet );
+
+int SSImportPlanetsFromLines ( const string &filename, SSObjectType type, SSPlanetLineParser parser, SSObjectVec &objects, SSObjectFilter filter = nullptr, void *userData = nullptr, int threads = 1 );
+
+int SSImportMPCComets ( const string &filename, SSObjectVec &comets, SSObjectFilter filter = nullptr, void *userData = nullptr, int threads = 1 );
+int SSImportMPCAsteroids ( const string &filename, SSObjectVec &asteroids, SSObjectFilter filter = nullptr, void *userData = nullptr, int threads = 1 );
 
 #endif /* SSImportMPC_hpp */
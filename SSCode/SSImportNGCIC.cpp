@@ -478,7 +478,7 @@ int SSImportNGCIC ( const string &filename, SSIdentifierNameMap &nameMap, SSObje
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return ( 0 );
 
@@ -487,7 +487,7 @@ int SSImportNGCIC ( const string &filename, SSIdentifierNameMap &nameMap, SSObje
     string line = "";
     int numObjects = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         // Split line into tokens separated by tabs.
         // Require at least 27 tokens.
@@ -653,7 +653,7 @@ int SSImportDAML02 ( const string &filename, SSIdentifierNameMap &nameMap, SSObj
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return ( 0 );
 
@@ -662,7 +662,7 @@ int SSImportDAML02 ( const string &filename, SSIdentifierNameMap &nameMap, SSObj
     string line = "";
     int numClusters = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         // Get R.A. and Dec; convert to radians
         
@@ -758,7 +758,7 @@ int SSImportMWGC ( const string &filename, SSIdentifierNameMap &nameMap, SSObjec
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return ( 0 );
 
@@ -767,7 +767,7 @@ int SSImportMWGC ( const string &filename, SSIdentifierNameMap &nameMap, SSObjec
     string line = "";
     int numClusters = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         // Get R.A. and Dec; convert to radians
         
@@ -875,7 +875,7 @@ int SSImportPNG ( const string &main_filename, const string &dist_filename, cons
     // First open distance distance file.
     // If successful create mapping of PNG identifiers to distances.
     
-    ifstream file ( dist_filename );
+    SSLineReader file ( dist_filename );
     if ( file )
     {
         int n = 0;
@@ -883,7 +883,7 @@ int SSImportPNG ( const string &main_filename, const string &dist_filename, cons
         
         // Read file line-by-line until we reach end-of-file
         
-        while ( getline ( file, line ) )
+        while ( file.getline ( line ) )
         {
             if ( line.length() < 28 )
                 continue;
@@ -929,7 +929,7 @@ int SSImportPNG ( const string &main_filename, const string &dist_filename, cons
     {
         // Read file line-by-line until we reach end-of-file
         
-        while ( getline ( file, line ) )
+        while ( file.getline ( line ) )
         {
             if ( line.length() < 18 )
                 continue;
@@ -960,7 +960,7 @@ int SSImportPNG ( const string &main_filename, const string &dist_filename, cons
     {
         // Read file line-by-line until we reach end-of-file
         
-        while ( getline ( file, line ) )
+        while ( file.getline ( line ) )
         {
             if ( line.length() < 18 )
                 continue;
@@ -992,10 +992,10 @@ int SSImportPNG ( const string &main_filename, const string &dist_filename, cons
     // Set up matrix for precessing B1950 coordinates and proper motion to J2000.
     // Read file line-by-line until we reach end-of-file.
 
-    SSMatrix precession = SSCoordinates::getPrecessionMatrix ( SSTime::kB1950 ).transpose();
+    SSMatrix precession = SSCoordinates::getPrecessionMatrix ( SSTime::kB1950, SSTime::kJ2000 );
     int numNebulae = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         if ( line.length() < 58 )
             continue;
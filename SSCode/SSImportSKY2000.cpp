@@ -112,8 +112,8 @@ void addSKY2000StarData ( SSObjectVec &stars, SSObjectMap &map, SSStarPtr pSkySt
 
     // If the SKY2000 star has no proper names, but does have a GJ identifier, add the GJ star's proper names.
     
-    if ( ! pSkyStar->getNames().size() && gjIdent && pStar->getNames().size() )
-        pSkyStar->setNames ( pStar->getNames() );
+    if ( ! pSkyStar->getNumNames() && gjIdent && pStar->getNumNames() )
+        pSkyStar->setInternedNames ( pStar->getInternedNames() );
 }
 
 // Imports IAU official star name table from Working Group on Star Names
@@ -125,7 +125,7 @@ int SSImportIAUStarNames ( const string &filename, SSIdentifierNameMap &nameMap
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -134,7 +134,7 @@ int SSImportIAUStarNames ( const string &filename, SSIdentifierNameMap &nameMap
     string line = "";
     int count = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         if ( line.length() < 96 )
             continue;
@@ -266,7 +266,7 @@ int SSImportSKY2000 ( const string &filename, SSIdentifierNameMap &nameMap, SSOb
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -281,7 +281,7 @@ int SSImportSKY2000 ( const string &filename, SSIdentifierNameMap &nameMap, SSOb
     string line = "";
     int numStars = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         if ( line.length() < 521 )
             continue;
@@ -28,7 +28,7 @@ int SSImportTYC ( const string &filename, TYC2HDMap &tyc2hdmap, SSObjectVec &sta
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
     
@@ -37,7 +37,7 @@ int SSImportTYC ( const string &filename, TYC2HDMap &tyc2hdmap, SSObjectVec &sta
     string line = "";
     int numStars = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         string strTYC = trim ( line.substr ( 2, 12 ) );
         string strRA = trim ( line.substr ( 51, 12 ) );
@@ -171,7 +171,7 @@ int SSImportTYC2 ( const string &filename, TYC2HDMap &tyc2hdmap, SSObjectVec &st
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
     
@@ -180,7 +180,7 @@ int SSImportTYC2 ( const string &filename, TYC2HDMap &tyc2hdmap, SSObjectVec &st
     string line = "";
     int numStars = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         string strTYC = trim ( line.substr ( 0, 12 ) );
         string strRA = trim ( line.substr ( 15, 12 ) );
@@ -290,7 +290,7 @@ int SSImportTYC2HD ( const string &filename, TYC2HDMap &tyc2hdmap )
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
     
@@ -299,7 +299,7 @@ int SSImportTYC2HD ( const string &filename, TYC2HDMap &tyc2hdmap )
     string line = "";
     int numStars = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         string strTYC = trim ( line.substr ( 0, 12 ) );
         string strHD = trim ( line.substr ( 14, 6 ) );
@@ -20,7 +20,7 @@ int SSImportORB6 ( const string &filename, SSObjectArray &stars )
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -29,7 +29,7 @@ int SSImportORB6 ( const string &filename, SSObjectArray &stars )
     string line = "";
     int numStars = 0, numLines = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         // Skip first 8 lines of header information
         
@@ -179,7 +179,7 @@ int SSImportWDSBFCrossIndex ( const string &filename, SSIdentifierMap &identmap
 {
     // Open file; return on failure.
     
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
     
@@ -188,7 +188,7 @@ int SSImportWDSBFCrossIndex ( const string &filename, SSIdentifierMap &identmap
     string line ( "" );
     int count = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         if ( line.length() < 55 )
             continue;
@@ -232,7 +232,7 @@ int SSImportWDSHIPCrossIndex ( const string &filename, SSIdentifierMap &identmap
 {
     // Open file; return on failure.
     
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
     
@@ -241,7 +241,7 @@ int SSImportWDSHIPCrossIndex ( const string &filename, SSIdentifierMap &identmap
     string line ( "" );
     int count = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         if ( line.length() < 29 )
             continue;
@@ -274,7 +274,7 @@ int SSImportWDS ( const string &filename, const SSIdentifierMap &identmap, SSObj
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -283,7 +283,7 @@ int SSImportWDS ( const string &filename, const SSIdentifierMap &identmap, SSObj
     string line = "";
     int numStars = 0;
     
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         if ( line.length() < 130 )
             continue;
@@ -420,7 +420,7 @@ int SSImportORB6toHTM ( const string &filename, SSHTM &htm )
     if ( n > 0 )
     {
         vector<float> magLevels = { INFINITY };
-        htm = SSHTM ( magLevels, "" );
+        htm.reset ( magLevels, "" );
         n = htm.store ( stars );
         if ( n > 0 )
         {
@@ -442,7 +442,7 @@ int SSImportWDStoHTM ( const string &filename, const SSIdentifierMap &identmap,
     if ( n > 0 )
     {
         vector<float> magLevels = { 6.0, 7.2, 8.4, INFINITY };
-        htm = SSHTM ( magLevels, "" );
+        htm.reset ( magLevels, "" );
         n = htm.store ( stars );
         if ( n > 0 )
         {
@@ -0,0 +1,100 @@
+// SSInstrument.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <atomic>
+
+#include "SSInstrument.hpp"
+
+// Statistics of one subsystem, accumulated with atomic operations so any thread may record without locking.
+// Times are kept in integer nanoseconds, since atomic<double> can't be added to atomically in C++11.
+
+struct SSInstrumentCounters
+{
+    atomic<uint64_t> calls, nanos, maxNanos, hits, misses;
+    atomic<uint64_t> histogram[SSInstrumentStats::kNumBuckets];
+};
+
+static SSInstrumentCounters _counters[kNumInstruments];
+
+static const char *_names[kNumInstruments] =
+{
+    "htm.load", "htm.region", "coordinates.settime", "series.vsop2013", "series.elpmpp02", "view.project", "jplde.record", "chebyshev.cache"
+};
+
+void SSInstrument::time ( SSInstrumentID id, double seconds, uint64_t n )
+{
+    if ( id < 0 || id >= kNumInstruments || n == 0 )
+        return;
+
+    SSInstrumentCounters &c = _counters[id];
+    uint64_t nanos = seconds > 0.0 ? seconds * 1.0e9 : 0;
+    c.calls += n;
+    c.nanos += nanos;
+
+    // Batches go in the bucket of their mean time per call; the maximum is the whole batch.
+
+    uint64_t prev = c.maxNanos;
+    while ( nanos > prev && ! c.maxNanos.compare_exchange_weak ( prev, nanos ) )
+        ;
+
+    int bucket = 0;
+    for ( uint64_t limit = 1000; bucket < SSInstrumentStats::kNumBuckets - 1 && nanos / n >= limit; limit *= 10 )
+        bucket++;
+
+    c.histogram[bucket] += n;
+}
+
+void SSInstrument::cache ( SSInstrumentID id, bool hit )
+{
+    if ( id < 0 || id >= kNumInstruments )
+        return;
+
+    if ( hit )
+        _counters[id].hits++;
+    else
+        _counters[id].misses++;
+}
+
+string SSInstrument::name ( SSInstrumentID id )
+{
+    return id >= 0 && id < kNumInstruments ? _names[id] : "";
+}
+
+SSInstrumentStats SSInstrument::snapshot ( SSInstrumentID id )
+{
+    SSInstrumentStats stats = { name ( id ), 0, 0.0, 0.0, { 0 }, 0, 0 };
+    if ( id < 0 || id >= kNumInstruments )
+        return stats;
+
+    SSInstrumentCounters &c = _counters[id];
+    stats.calls = c.calls;
+    stats.seconds = c.nanos / 1.0e9;
+    stats.maxSeconds = c.maxNanos / 1.0e9;
+    for ( int i = 0; i < SSInstrumentStats::kNumBuckets; i++ )
+        stats.histogram[i] = c.histogram[i];
+    stats.hits = c.hits;
+    stats.misses = c.misses;
+    return stats;
+}
+
+vector<SSInstrumentStats> SSInstrument::snapshot ( void )
+{
+    vector<SSInstrumentStats> stats;
+    for ( int id = 0; id < kNumInstruments; id++ )
+        stats.push_back ( snapshot ( (SSInstrumentID) id ) );
+
+    return stats;
+}
+
+void SSInstrument::reset ( void )
+{
+    for ( SSInstrumentCounters &c : _counters )
+    {
+        c.calls = c.nanos = c.maxNanos = c.hits = c.misses = 0;
+        for ( atomic<uint64_t> &h : c.histogram )
+            h = 0;
+    }
+}
@@ -0,0 +1,118 @@
+// SSInstrument.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// Runtime instrumentation of SSCore's hot paths: call counts, cumulative and histogrammed timings, and cache
+// hit rates for each instrumented subsystem, so frame-time spikes can be traced to HTM region loading,
+// SSCoordinates::setTime(), series evaluation, or projection in a production build.
+// Instrumentation is compiled into SSCore only when USE_INSTRUMENTS is #defined as 1 for every source file,
+// e.g. with -DUSE_INSTRUMENTS=1; otherwise the SS_INSTRUMENT_xxx macros below compile to nothing, and
+// snapshots are all zeros. The snapshot and reset API is always present, so callers needn't check.
+
+#ifndef SSInstrument_hpp
+#define SSInstrument_hpp
+
+#ifndef USE_INSTRUMENTS
+#define USE_INSTRUMENTS 0
+#endif
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "SSUtilities.hpp"
+
+using namespace std;
+
+// Instrumented subsystems. Timed ones count calls and time them; cache ones count hits and misses.
+
+enum SSInstrumentID
+{
+    kInstrumentHTMLoad = 0,         // SSHTM region loads from CSV, archive, or read function (timed)
+    kInstrumentHTMRegion = 1,       // SSHTM region requests: hit if already loaded (cache)
+    kInstrumentSetTime = 2,         // SSCoordinates::setTime() (timed)
+    kInstrumentVSOP = 3,            // VSOP2013 planet position and velocity (timed)
+    kInstrumentELP = 4,             // ELPMPP02 Moon position and velocity (timed)
+    kInstrumentProject = 5,         // SSView::project() and projectBatch() (timed; batches count each vector)
+    kInstrumentJPLDERecord = 6,     // JPL DE record lookups: hit if mapped, loaded, or already in the thread's buffer (cache)
+    kInstrumentChebyshev = 7,       // SSChebyshevCache lookups: hit if a fitted window covers the time (cache)
+    kNumInstruments = 8
+};
+
+// Statistics of one instrumented subsystem since the last reset.
+
+struct SSInstrumentStats
+{
+    static constexpr int kNumBuckets = 7;   // timing histogram buckets: < 1 us, < 10 us, < 100 us, < 1 ms, < 10 ms, < 100 ms, >= 100 ms
+
+    string name;                            // subsystem name, e.g. "htm.load"
+    uint64_t calls;                         // number of timed calls
+    double seconds;                         // cumulative time of all calls [seconds]
+    double maxSeconds;                      // time of slowest call [seconds]
+    uint64_t histogram[kNumBuckets];        // number of calls in each timing bucket
+    uint64_t hits, misses;                  // cache hits and misses
+
+    double meanSeconds ( void ) const { return calls ? seconds / calls : 0.0; }
+    double hitRate ( void ) const { return hits + misses ? hits / double ( hits + misses ) : 0.0; }
+};
+
+class SSInstrument
+{
+public:
+
+    // Returns true if instrumentation is compiled in.
+
+    static constexpr bool enabled ( void ) { return USE_INSTRUMENTS != 0; }
+
+    // Records (n) calls to a timed subsystem (id) which together took (seconds).
+
+    static void time ( SSInstrumentID id, double seconds, uint64_t n = 1 );
+
+    // Records a cache hit, or a miss if (hit) is false, in a cache subsystem (id).
+
+    static void cache ( SSInstrumentID id, bool hit );
+
+    // Returns subsystem's name, or an empty string if (id) is invalid.
+
+    static string name ( SSInstrumentID id );
+
+    // Returns current statistics of one subsystem, or of all of them, without resetting them.
+    // Statistics are updated atomically but independently, so a snapshot taken while other threads
+    // are running may count a call in one field but not yet in another.
+
+    static SSInstrumentStats snapshot ( SSInstrumentID id );
+    static vector<SSInstrumentStats> snapshot ( void );
+
+    // Zeroes statistics of all subsystems.
+
+    static void reset ( void );
+};
+
+// Times the lifetime of a scope and records it as one call to a timed subsystem. Instead of using directly,
+// use SS_INSTRUMENT_TIME(), which compiles to nothing when instrumentation is disabled.
+
+class SSInstrumentTimer
+{
+    SSInstrumentID _id;
+    uint64_t _n;
+    double _start;
+
+public:
+
+    SSInstrumentTimer ( SSInstrumentID id, uint64_t n = 1 ) : _id ( id ), _n ( n ), _start ( clocksec() ) { }
+    ~SSInstrumentTimer ( void ) { SSInstrument::time ( _id, clocksec() - _start, _n ); }
+};
+
+#if USE_INSTRUMENTS
+#define SS_INSTRUMENT_TIME(id) SSInstrumentTimer _ssInstrumentTimer ( id )
+#define SS_INSTRUMENT_TIME_N(id,n) SSInstrumentTimer _ssInstrumentTimer ( id, n )
+#define SS_INSTRUMENT_CACHE(id,hit) SSInstrument::cache ( id, hit )
+#else
+#define SS_INSTRUMENT_TIME(id)
+#define SS_INSTRUMENT_TIME_N(id,n)
+#define SS_INSTRUMENT_CACHE(id,hit)
+#endif
+
+#endif /* SSInstrument_hpp */
@@ -12,43 +12,168 @@
 
 #include <iostream>
 #include <fstream>
+#include <vector>
+#include <mutex>
+#include <memory>
 
 #include "SSTime.hpp"
 #include "SSAngle.hpp"
 #include "SSVector.hpp"
 
-// CAUTION: This class is a thin C++ wrapper around original C code from:
+// This class reads one JPL DE binary ephemeris file. Based on original C code from:
 // https://apollo.astro.amu.edu.pl/PAD/index.php?n=Dybol.JPLEph
-// This is a singleton class; you should only ever instantiate one of these!
-// It should be thread safe, and is hard-coded to read only the DE43x series
-// in little-endian (Intel) binary format.  It will not read the ASCII format
-// of any ephemeris files, nor the DE43xt series which include time data.
+// After the file is opened, its header and constants never change, so any number of threads
+// may compute positions from one reader simultaneously, as long as each thread passes its own
+// Scratch object: the record buffer and Chebyshev polynomial values live there, not in the reader.
+// By default the file is memory-mapped, so records are used in place without copying and threads
+// never wait for each other; or it can be read into memory entirely, or one record at a time.
+// It reads DE200 and DE40x/DE43x/DE44x series files in little-endian (Intel) binary format,
+// with record size determined from the header. It will not read the ASCII format of any
+// ephemeris files, nor the DE43xt series which include time data.
+
+class SSJPLDEReader
+{
+public:
+
+    // Ways of accessing ephemeris records. If the file can't be mapped, it is loaded;
+    // if it can't be loaded, records are read individually.
+
+    enum Access
+    {
+        kAccessRead = 0,                // seek and read each record into scratch buffer when needed
+        kAccessLoad = 1,                // read entire file into memory when opened
+        kAccessMap = 2,                 // memory-map entire file when opened
+    };
+
+    static constexpr int kNumBodies = 11;       // number of bodies: 0 = Sun, 1 - 9 = Mercury - Pluto, 10 = Moon
+    static constexpr int kNumChebyshev = 4;     // number of Chebyshev polynomial sets kept in scratch space
+
+    // Chebyshev polynomial values and derivatives at one normalized time, for bodies
+    // whose records are divided into a particular number of sub-intervals.
+
+    struct Chebyshev
+    {
+        int na;                         // number of sub-intervals; zero if unused
+        double tc;                      // normalized Chebyshev time of pc[] and vc[]
+        int np, nv;                     // number of valid values in pc[] and vc[]
+        double pc[18], vc[18];          // Chebyshev polynomial values and derivatives at tc
+    };
+
+    // Per-thread state: the most recently read record, and Chebyshev polynomial values for the
+    // most recently used sub-interval counts. Must not be shared between simultaneous threads.
+
+    struct Scratch
+    {
+        const SSJPLDEReader *reader;    // reader whose record is in buf, or nullptr if none (only used with kAccessRead)
+        uint64_t serial;                // serial number of file opened by that reader when buf was read
+        int nr;                         // record number in buf
+        vector<double> buf;             // coefficients of record nr
+        Chebyshev cheb[kNumChebyshev];  // polynomial values for different sub-interval counts
+        int next;                       // index of next polynomial set to replace
+
+        Scratch ( void ) : reader ( nullptr ), serial ( 0 ), nr ( -1 ), next ( 0 ) { for ( Chebyshev &c : cheb ) c.na = 0; }
+    };
+
+protected:
+
+    FILE *_file;                    // ephemeris file, if records are read individually; otherwise NULL
+    mutable mutex _fileMutex;       // serializes seeking and reading records from _file
+    Access _access;                 // how records are accessed
+    const double *_data;            // start of mapped or loaded file, or nullptr if records are read individually
+    size_t _mapSize;                // size of mapped file in bytes; zero if not mapped
+    vector<double> _loaded;         // contents of loaded file
+    uint64_t _serial;               // unique serial number of currently-open file; 0 if none
+    double _ss[3];                  // start JED, stop JED, record span in days
+    double _au;                     // astronomical unit in km
+    double _emrat;                  // Earth-Moon mass ratio
+    int _numde;                     // DE number
+    int _ipt[13][3];                // coefficient offset (1-based), count, and number of sub-intervals for each body
+    int _ncoeff;                    // number of coefficients per record
+    int _nrecs;                     // number of data records in file
+    vector<string> _names;          // names of constants
+    vector<double> _values;         // values of constants
+
+    const double *getRecord ( int nr, Scratch &scratch ) const;
+    void interpolate ( const double *rec, int body, int ncm, double t, Scratch &scratch, double pv[6] ) const;
+
+public:
+
+    SSJPLDEReader ( void );
+    ~SSJPLDEReader ( void );
+
+    // Opens and closes ephemeris file. Don't close while other threads are computing from the file!
+
+    bool open ( const string &filename, Access access = kAccessMap );
+    bool isOpen ( void ) const { return _serial != 0; }
+    void close ( void );
+    Access getAccess ( void ) const { return _access; }
+
+    // Gets number of contants, name and value of i-th constant.
+
+    int getConstantNumber ( void ) const { return (int) _values.size(); }
+    string getConstantName ( int i ) const;
+    double getConstantValue ( int i ) const;
+
+    // Gets DE number, start and stop Julian Ephemeris Date, and time step in days
+
+    int getDENumber ( void ) const { return _numde; }
+    double getStartJED ( void ) const { return _ss[0]; }
+    double getStopJED ( void ) const { return _ss[1]; }
+    double getStep ( void ) const { return _ss[2]; }
+
+    // Computes object position and velocity at a given JED, using caller's scratch space.
+
+    bool compute ( int id, double jed, bool bary, SSVector &position, SSVector &velocity, Scratch &scratch ) const;
+
+    // Computes positions and velocities of all bodies in a bit mask at a given JED from one record.
+
+    bool compute ( unsigned int mask, double jed, bool bary, SSVector positions[kNumBodies], SSVector velocities[kNumBodies], Scratch &scratch ) const;
+};
+
+// This class is a static, thread-safe registry of any number of open SSJPLDEReaders.
+// Each request is served by the highest-priority open file which covers the requested time, so
+// a short high-accuracy ephemeris (e.g. DE440) can be combined with long-span files (e.g. both
+// parts of DE441), which are stitched together automatically. Files may be added or closed while
+// other threads are computing: a file is only released when no thread is still using it.
+// Each thread automatically uses its own scratch space.
 
 class SSJPLDEphemeris
 {
 public:
     
-    // Opens and closes ephemeris file
+    // Opens an ephemeris file after closing all others; or adds one to the files already open.
+    // Higher-priority files are preferred where they overlap; equal priorities are used in order added.
     
-    static bool open ( const string &filename );
+    static bool open ( const string &filename, SSJPLDEReader::Access access = SSJPLDEReader::kAccessMap );
+    static bool add ( const string &filename, int priority = 0, SSJPLDEReader::Access access = SSJPLDEReader::kAccessMap );
     static bool isOpen ( void );
     static void close ( void );
+    static void close ( const shared_ptr<SSJPLDEReader> &reader );
 
-    // Gets number of contants, name and value of i-th constant.
+    // Gets number of open files, i-th reader in order of decreasing priority (or nullptr),
+    // and the reader which computes a given JED (or nullptr if no open file covers it).
+
+    static int getFileCount ( void );
+    static shared_ptr<SSJPLDEReader> getReader ( int i = 0 );
+    static shared_ptr<SSJPLDEReader> findReader ( double jed );
+
+    // Gets number of contants, name and value of i-th constant, from the highest-priority file.
     
     static int getConstantNumber ( void );
     static string getConstantName ( int i );
     static double getConstantValue ( int i );
     
-    // Gets start and stop Julian Ephemeris Date, and time step in days
+    // Gets earliest start and latest stop Julian Ephemeris Date of all open files,
+    // and time step in days of the highest-priority file.
     
     static double getStartJED ( void );
     static double getStopJED ( void );
     static double getStep ( void );
 
-    // Computes object position and velocity at a given JED.
+    // Computes object position and velocity at a given JED from the best file covering it.
     
     static bool compute ( int id, double jde, bool bary, SSVector &position, SSVector &velocity );
+    static bool compute ( unsigned int mask, double jde, bool bary, SSVector positions[SSJPLDEReader::kNumBodies], SSVector velocities[SSJPLDEReader::kNumBodies] );
 };
 
 #endif /* SSJPLEphemeris_hpp */
@@ -0,0 +1,235 @@
+// SSKeyframeEphemeris.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <algorithm>
+
+#include "SSKeyframeEphemeris.hpp"
+
+SSKeyframeEphemeris::SSKeyframeEphemeris ( double tolerance ) : _coords ( SSTime ( SSTime::kJ2000 ), SSSpherical ( 0.0, 0.0, 0.0 ) )
+{
+    _tolerance = tolerance;
+    _keyframes = _checks = 0;
+    invalidate();
+}
+
+SSKeyframeEphemeris::SSKeyframeEphemeris ( SSObjectArray &objects, double tolerance ) : SSKeyframeEphemeris ( tolerance )
+{
+    setObjects ( objects );
+}
+
+void SSKeyframeEphemeris::setObjects ( SSObjectArray &objects )
+{
+    _tracks.clear();
+    for ( size_t i = 0; i < objects.size(); i++ )
+    {
+        SSPlanetPtr pObj = SSGetPlanetPtr ( objects[i] );
+        if ( pObj != nullptr )
+            _tracks.push_back ( { pObj, vector<Keyframe>(), 0.0, 0.0 } );
+    }
+
+    invalidate();
+}
+
+void SSKeyframeEphemeris::invalidate ( void )
+{
+    for ( Track &track : _tracks )
+    {
+        track.keys.clear();
+        track.error = 0.0;
+    }
+
+    _location = SSSpherical ( NAN, NAN, NAN );
+}
+
+// Returns true if the observer location or any setting affecting apparent directions in (coords) has changed
+// since the last update, and records the new ones.
+
+bool SSKeyframeEphemeris::settingsChanged ( SSCoordinates &coords )
+{
+    SSSpherical location = coords.getLocation();
+    bool flags[4] = { coords.getStarParallax(), coords.getStarMotion(), coords.getAberration(), coords.getLightTime() };
+    bool changed = ! ( location == _location ) || ! equal ( flags, flags + 4, _flags );
+
+    _location = location;
+    copy ( flags, flags + 4, _flags );
+    return changed;
+}
+
+double SSKeyframeEphemeris::getMaxErrorBound ( void )
+{
+    double error = 0.0;
+    for ( Track &track : _tracks )
+        error = max ( error, track.error );
+
+    return error;
+}
+
+// Computes an object's (pObj) exact apparent direction and distance at Julian date (jd), and returns the time actually used.
+
+double SSKeyframeEphemeris::computeAt ( SSPlanetPtr pObj, double jd )
+{
+    if ( _coords.getTime().jd != jd )
+        _coords.setTime ( SSTime ( jd ) );
+
+    pObj->computeEphemeris ( _coords );
+    return _coords.getTime().jd;
+}
+
+// Computes an object's (pObj) exact ephemeris at Julian date (jd) and returns it as a keyframe. The rates of change of
+// direction and distance are central differences over a few seconds, rather than from the object's velocity: they then
+// include the changing aberration, and agree with the positions of ephemerides whose velocities are only approximate
+// (like the low-precision lunar theory), which a Hermite interval's midpoint check can't detect.
+
+SSKeyframeEphemeris::Keyframe SSKeyframeEphemeris::computeKeyframe ( SSPlanetPtr pObj, double jd )
+{
+    double jd0 = computeAt ( pObj, jd - kRateStep );
+    SSVector dir0 = pObj->getDirection();
+    double dist0 = pObj->getDistance();
+
+    double jd1 = computeAt ( pObj, jd + kRateStep );
+    SSVector dir1 = pObj->getDirection();
+    double dist1 = pObj->getDistance();
+
+    computeAt ( pObj, jd );
+    _keyframes++;
+
+    Keyframe key;
+    key.jd = jd;
+    key.dir = pObj->getDirection();
+    key.dist = pObj->getDistance();
+    key.mag = pObj->getMagnitude();
+    key.dirRate = ( dir1 - dir0 ) / ( jd1 - jd0 );
+    key.distRate = ( dist1 - dist0 ) / ( jd1 - jd0 );
+    key.error = 0.0;
+    return key;
+}
+
+SSKeyframeEphemeris::Keyframe SSKeyframeEphemeris::interpolate ( Keyframe k0, Keyframe k1, double jd )
+{
+    double h = k1.jd - k0.jd;
+    double s = h > 0.0 ? ( jd - k0.jd ) / h : 0.0;
+    double s2 = s * s, s3 = s2 * s;
+
+    // Cubic Hermite basis functions for values (h00, h01) and derivatives (h10, h11) at start and end.
+
+    double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+    double h10 = s3 - 2.0 * s2 + s;
+    double h01 = 3.0 * s2 - 2.0 * s3;
+    double h11 = s3 - s2;
+
+    Keyframe key;
+    key.jd = jd;
+    key.dir = ( k0.dir * h00 + k0.dirRate * ( h10 * h ) + k1.dir * h01 + k1.dirRate * ( h11 * h ) ).normalize();
+    key.dist = k0.dist * h00 + k0.distRate * h10 * h + k1.dist * h01 + k1.distRate * h11 * h;
+    key.dirRate = k0.dirRate * ( 1.0 - s ) + k1.dirRate * s;
+    key.distRate = k0.distRate * ( 1.0 - s ) + k1.distRate * s;
+    key.mag = k0.mag + ( k1.mag - k0.mag ) * s;
+    key.error = k0.error;
+    return key;
+}
+
+// Measures the interpolation error of a track's interval from keyframe (k) to the next at its midpoint, where Hermite
+// error is greatest. If that exceeds the tolerance, inserts the midpoint as a keyframe and refines both halves, up to
+// the shortest interval allowed. Returns with the errors of all new intervals recorded in their starting keyframes.
+
+void SSKeyframeEphemeris::refine ( Track &track, size_t k, int depth )
+{
+    const Keyframe &k0 = track.keys[k], &k1 = track.keys[k + 1];
+    double jd = ( k0.jd + k1.jd ) / 2.0;
+    Keyframe guess = interpolate ( k0, k1, jd );
+    Keyframe exact = computeKeyframe ( track.pObj, jd );
+    double error = guess.dir.angularSeparation ( exact.dir );
+    _checks++;
+
+    if ( error <= _tolerance || k1.jd - k0.jd <= kMinStep * 2.0 || depth >= 16 )
+    {
+        track.keys[k].error = error;
+        return;
+    }
+
+    track.keys.insert ( track.keys.begin() + k + 1, exact );
+    refine ( track, k + 1, depth + 1 );
+    refine ( track, k, depth + 1 );
+}
+
+// Adds keyframes to a track until they bracket Julian date (jd). A time far outside the existing keyframes starts the
+// track over, with one keyframe there. The interval for new keyframes halves when an interval needed refining, and
+// doubles when its error was well within tolerance; Hermite error goes as the fourth power of interval length.
+
+void SSKeyframeEphemeris::cover ( Track &track, double jd )
+{
+    if ( track.keys.empty() || jd < track.keys.front().jd - track.step * 8.0 || jd > track.keys.back().jd + track.step * 8.0 )
+    {
+        track.keys.clear();
+        track.keys.push_back ( computeKeyframe ( track.pObj, jd ) );
+        if ( track.step <= 0.0 )
+            track.step = 1.0 / 16.0;
+    }
+
+    while ( jd > track.keys.back().jd || jd < track.keys.front().jd )
+    {
+        bool forward = jd > track.keys.back().jd;
+        size_t size = track.keys.size();
+        if ( forward )
+        {
+            track.keys.push_back ( computeKeyframe ( track.pObj, track.keys.back().jd + track.step ) );
+            refine ( track, size - 1, 0 );
+        }
+        else
+        {
+            track.keys.insert ( track.keys.begin(), computeKeyframe ( track.pObj, track.keys.front().jd - track.step ) );
+            refine ( track, 0, 0 );
+        }
+
+        size_t added = track.keys.size() - size;
+        double error = forward ? track.keys[size - 1].error : track.keys[0].error;
+        if ( added > 1 )
+            track.step = max ( (double) kMinStep, track.step / 2.0 );
+        else if ( error < _tolerance / 16.0 )
+            track.step = min ( (double) kMaxStep, track.step * 2.0 );
+    }
+
+    // Discard the keyframes farthest from the current time, if there are too many.
+
+    if ( track.keys.size() > kMaxKeyframes )
+    {
+        size_t excess = track.keys.size() - kMaxKeyframes;
+        if ( jd - track.keys.front().jd > track.keys.back().jd - jd )
+            track.keys.erase ( track.keys.begin(), track.keys.begin() + excess );
+        else
+            track.keys.erase ( track.keys.end() - excess, track.keys.end() );
+    }
+}
+
+void SSKeyframeEphemeris::update ( SSCoordinates &coords )
+{
+    if ( settingsChanged ( coords ) )
+    {
+        invalidate();
+        settingsChanged ( coords );
+        _coords = coords;
+    }
+
+    double jd = coords.getTime().jd;
+    for ( Track &track : _tracks )
+    {
+        cover ( track, jd );
+
+        auto it = upper_bound ( track.keys.begin(), track.keys.end(), jd, [] ( double t, const Keyframe &key ) { return t < key.jd; } );
+        size_t k = it == track.keys.begin() ? 0 : it - track.keys.begin() - 1;
+
+        Keyframe key = track.keys[k];
+        if ( key.jd != jd && k + 1 < track.keys.size() )
+            key = interpolate ( track.keys[k], track.keys[k + 1], jd );
+        else
+            key.error = 0.0;
+
+        track.error = key.error;
+        track.pObj->setDirection ( key.dir );
+        track.pObj->setDistance ( key.dist );
+        track.pObj->setMagnitude ( key.mag );
+    }
+}
@@ -0,0 +1,109 @@
+// SSKeyframeEphemeris.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class animates solar system objects by computing their exact ephemerides only at keyframes, and interpolating
+// in between. Each keyframe stores an object's apparent direction and distance, their rates of change, and its magnitude.
+// Between two keyframes, direction and distance are cubic Hermite interpolated, and magnitude is linearly interpolated,
+// so animation cost depends on how fast objects move, not on the number of frames drawn. Keyframes are spaced separately
+// for each object: each new interval is checked against an exact computation at its midpoint, and bisected until that
+// error is within the tolerance angle (or the interval is as short as allowed). Since Hermite error grows with the change
+// in apparent angular acceleration, the Moon gets keyframes every hour or two, while outer planets get one every few days.
+// The measured midpoint error of each object's current interval is exposed as its error bound. Interpolation happens in
+// the observer's frame, so all keyframes are discarded when the observer location or any coordinate setting that changes
+// apparent directions changes; call invalidate() after changing objects in any other way. Only objects' directions,
+// distances, and magnitudes are interpolated; other ephemeris quantities (positions, velocities) are left as computed
+// at some keyframe.
+
+#ifndef SSKeyframeEphemeris_hpp
+#define SSKeyframeEphemeris_hpp
+
+#include "SSPlanet.hpp"
+
+class SSKeyframeEphemeris
+{
+public:
+
+    static constexpr double kDefaultTolerance = SSAngle::kRadPerArcsec;     // default tolerance angle = 1 arcsecond [radians]
+    static constexpr double kMinStep = 1.0 / SSTime::kMinutesPerDay;        // shortest interval between keyframes = 1 minute [days]
+    static constexpr double kMaxStep = 8.0;                                 // longest interval between keyframes [days]
+    static constexpr size_t kMaxKeyframes = 64;                             // most keyframes kept per object
+    static constexpr double kRateStep = 10.0 / SSTime::kSecondsPerDay;      // half-interval for keyframe rates of change = 10 seconds [days]
+
+    struct Keyframe
+    {
+        double jd;                      // civil Julian date of keyframe
+        SSVector dir, dirRate;          // apparent unit direction vector, and its rate of change [per day]
+        double dist, distRate;          // distance [AU] and its rate of change [AU per day]
+        float mag;                      // visual magnitude
+        double error;                   // measured interpolation error of interval from this keyframe to next [radians]
+    };
+
+protected:
+
+    struct Track
+    {
+        SSPlanetPtr pObj;               // object; not owned by this class
+        vector<Keyframe> keys;          // keyframes in increasing time order
+        double step;                    // current interval for adding new keyframes [days]
+        double error;                   // error bound of interval containing most recent time [radians]
+    };
+
+    vector<Track> _tracks;              // one per solar system object
+    SSCoordinates _coords;              // working coordinates for computing keyframes
+    double _tolerance;                  // largest interpolation error allowed [radians]
+    SSSpherical _location;              // observer location of last update
+    bool _flags[4];                     // parallax, space motion, aberration, and light time settings of last update
+    size_t _keyframes, _checks;         // number of keyframes and midpoint checks computed since statistics were reset
+
+    bool settingsChanged ( SSCoordinates &coords );
+    double computeAt ( SSPlanetPtr pObj, double jd );
+    Keyframe computeKeyframe ( SSPlanetPtr pObj, double jd );
+    void refine ( Track &track, size_t k, int depth );
+    void cover ( Track &track, double jd );
+
+public:
+
+    SSKeyframeEphemeris ( double tolerance = kDefaultTolerance );
+    SSKeyframeEphemeris ( SSObjectArray &objects, double tolerance = kDefaultTolerance );
+
+    // Replaces the objects animated with all solar system objects in an array; other objects are ignored.
+    // The array must outlive this class, or setObjects() must be called again.
+
+    void setObjects ( SSObjectArray &objects );
+
+    // Gets number of objects animated, and i-th object.
+
+    size_t size ( void ) { return _tracks.size(); }
+    SSPlanetPtr get ( size_t i ) { return i < _tracks.size() ? _tracks[i].pObj : nullptr; }
+
+    // Sets every object's direction, distance, and magnitude at the time and observer location in (coords),
+    // interpolated between keyframes. Keyframes are computed as needed to bracket the time.
+
+    void update ( SSCoordinates &coords );
+
+    // Interpolates between two keyframes (k0) and (k1) at Julian date (jd).
+
+    static Keyframe interpolate ( Keyframe k0, Keyframe k1, double jd );
+
+    // Returns the error bound of the i-th object's direction after the last update(), or the largest of any object [radians].
+    // This is zero for an object whose time fell exactly on a keyframe.
+
+    double getErrorBound ( size_t i ) { return i < _tracks.size() ? _tracks[i].error : 0.0; }
+    double getMaxErrorBound ( void );
+
+    // Discards all keyframes, so they are recomputed at the next update().
+
+    void invalidate ( void );
+
+    void setTolerance ( double tolerance ) { _tolerance = tolerance; invalidate(); }
+    double getTolerance ( void ) { return _tolerance; }
+
+    size_t getKeyframes ( void ) { return _keyframes; }
+    size_t getChecks ( void ) { return _checks; }
+    void resetStatistics ( void ) { _keyframes = _checks = 0; }
+};
+
+#endif /* SSKeyframeEphemeris_hpp */
@@ -0,0 +1,126 @@
+// SSLazyEphemeris.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include "SSLazyEphemeris.hpp"
+#include "SSPlanet.hpp"
+#include "SSStar.hpp"
+
+SSLazyEphemeris::SSLazyEphemeris ( double tolerance, double maxDays )
+{
+    _tolerance = tolerance;
+    _maxDays = maxDays;
+    _computed = _skipped = 0;
+    invalidate();
+}
+
+void SSLazyEphemeris::invalidate ( void )
+{
+    fill ( _jed.begin(), _jed.end(), NAN );
+    _location = SSSpherical ( NAN, NAN, NAN );
+}
+
+// Returns true if the observer location or any setting affecting apparent directions in (coords) has changed
+// since the last update, and records the new ones.
+
+bool SSLazyEphemeris::settingsChanged ( SSCoordinates &coords )
+{
+    SSSpherical location = coords.getLocation();
+    bool flags[4] = { coords.getStarParallax(), coords.getStarMotion(), coords.getAberration(), coords.getLightTime() };
+    bool changed = ! ( location == _location ) || ! equal ( flags, flags + 4, _flags );
+
+    _location = location;
+    copy ( flags, flags + 4, _flags );
+    return changed;
+}
+
+// Returns how many days an object's (pObj) ephemeris, just computed with (coords), stays within the tolerance angle,
+// given a bound on the rate of change of aberration (aberRate) in radians per day. Returns zero if the object's apparent
+// motion is unknown, so it is recomputed at every update.
+
+double SSLazyEphemeris::validDays ( SSObjectPtr pObj, SSCoordinates &coords, double aberRate )
+{
+    SSObjectFamily family = SSGetObjectFamily ( pObj->getType() );
+    SSSpherical dir ( pObj->getDirection() );
+    double rate = 0.0;
+
+    if ( family == kFamilyPlanet )
+    {
+        // Planet apparent motion is in radians per day, and includes the observer's motion. Radial motion is included
+        // as if it were angular, since it turns into angular motion as an object's path curves, e.g. a moon at elongation.
+
+        SSSpherical motion = pObj->computeApparentMotion ( coords );
+        double radial = motion.rad / pObj->getDistance();
+        rate = sqrt ( motion.lon * motion.lon * cos ( dir.lat ) * cos ( dir.lat ) + motion.lat * motion.lat + radial * radial );
+    }
+    else if ( family == kFamilyStar || family == kFamilyDeepSky )
+    {
+        // Star proper motion is in radians per year, and unknown if the star has no space motion;
+        // annual parallax moves a star by up to its parallax, through a full circle in a year.
+
+        SSStarPtr pStar = SSGetStarPtr ( pObj );
+        SSSpherical motion = pObj->computeApparentMotion ( coords );
+        if ( coords.getStarMotion() && ! ::isinf ( motion.lon ) && ! ::isinf ( motion.lat ) )
+            rate = sqrt ( motion.lon * motion.lon * cos ( dir.lat ) * cos ( dir.lat ) + motion.lat * motion.lat ) / 365.25;
+        if ( coords.getStarParallax() && pStar != nullptr && pStar->getParallax() > 0.0 )
+            rate += SSAngle::fromArcsec ( pStar->getParallax() ) * SSAngle::kTwoPi / 365.25;
+    }
+    else if ( family == kFamilyFeature || family == kFamilyCity || family == kFamilyConstellation )
+    {
+        // These don't compute anything from coordinates; surface features are computed on their planets instead.
+        
+        return _maxDays;
+    }
+    else
+    {
+        return 0.0;
+    }
+
+    rate += aberRate;
+    if ( ::isnan ( rate ) || ::isinf ( rate ) )
+        return 0.0;
+
+    return rate > 0.0 ? min ( _maxDays, _tolerance / rate ) : _maxDays;
+}
+
+size_t SSLazyEphemeris::update ( SSObjectArray &objects, SSCoordinates &coords )
+{
+    if ( settingsChanged ( coords ) || _jed.size() != objects.size() )
+    {
+        _jed.assign ( objects.size(), NAN );
+        _valid.assign ( objects.size(), 0.0 );
+    }
+
+    // Aberration changes as the observer's velocity turns: once a year around the Sun, and once a sidereal day
+    // around Earth's axis, where Earth's equatorial rotation speed is 0.4651 km/sec.
+
+    double aberRate = 0.0;
+    if ( coords.getAberration() )
+    {
+        double orbital = coords.getObserverVelocity().magnitude() * SSAngle::kTwoPi / 365.25;
+        double diurnal = 0.4651 * SSTime::kSecondsPerDay / SSCoordinates::kKmPerAU * SSAngle::kTwoPi * SSTime::kSiderealPerSolarDays;
+        aberRate = ( orbital + diurnal ) / SSCoordinates::kLightAUPerDay;
+    }
+
+    double jed = coords.getJED();
+    size_t computed = 0;
+    for ( size_t k = 0; k < objects.size(); k++ )
+    {
+        if ( fabs ( jed - _jed[k] ) <= _valid[k] )
+        {
+            _skipped++;
+            continue;
+        }
+
+        SSObjectPtr pObj = objects[k];
+        pObj->computeEphemeris ( coords );
+        _jed[k] = jed;
+        _valid[k] = validDays ( pObj, coords, aberRate );
+        computed++;
+    }
+
+    _computed += computed;
+    return computed;
+}
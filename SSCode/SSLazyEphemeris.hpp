@@ -0,0 +1,67 @@
+// SSLazyEphemeris.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class recomputes the ephemerides of objects in an array only when they may have moved by more than a tolerance
+// angle since they were last computed. For each object it records the Julian Ephemeris Date of its last computation,
+// and how many days it can stay valid: the tolerance divided by a bound on its apparent angular rate, from its
+// computeApparentMotion(), parallax, and the change in aberration as the observer moves around the Sun and Earth's axis.
+// Distant galaxies, and stars without proper motion, are then only recomputed every few days of simulated time, and
+// planets every few minutes, instead of every frame. Everything is recomputed when the observer location or any
+// coordinate setting that changes apparent directions (parallax, space motion, aberration, light time) changes, or when
+// the array changes size; call invalidate() after changing objects in any other way. Magnitudes and distances are
+// recomputed along with directions, so they may be stale by the same interval.
+
+#ifndef SSLazyEphemeris_hpp
+#define SSLazyEphemeris_hpp
+
+#include "SSObject.hpp"
+
+class SSLazyEphemeris
+{
+public:
+
+    static constexpr double kDefaultTolerance = SSAngle::kRadPerArcsec;     // default tolerance angle = 1 arcsecond [radians]
+    static constexpr double kDefaultMaxDays = 1.0;                          // default longest interval between computations [days]
+
+protected:
+
+    double _tolerance;                  // largest apparent motion allowed before an object is recomputed [radians]
+    double _maxDays;                    // longest interval between computations of any object [days]
+    vector<double> _jed;                // JED at which each object was last computed; NaN if never
+    vector<double> _valid;              // days each object's last computation stays within tolerance
+    SSSpherical _location;              // observer location of last update
+    bool _flags[4];                     // parallax, space motion, aberration, and light time settings of last update
+    size_t _computed, _skipped;         // number of objects computed and skipped since statistics were reset
+
+    bool settingsChanged ( SSCoordinates &coords );
+    double validDays ( SSObjectPtr pObj, SSCoordinates &coords, double aberRate );
+
+public:
+
+    SSLazyEphemeris ( double tolerance = kDefaultTolerance, double maxDays = kDefaultMaxDays );
+
+    // Computes the ephemeris of every object in an array (objects) at the time and observer location in (coords) whose last
+    // computation may be off by more than the tolerance angle, or which has never been computed. Other objects are unchanged.
+    // Returns the number of objects computed. Use the same tracker with the same array every time.
+
+    size_t update ( SSObjectArray &objects, SSCoordinates &coords );
+
+    // Forces all objects, or the object at index (k), to be recomputed at the next update().
+
+    void invalidate ( void );
+    void invalidate ( size_t k ) { if ( k < _jed.size() ) _jed[k] = NAN; }
+
+    void setTolerance ( double tolerance ) { _tolerance = tolerance; invalidate(); }
+    double getTolerance ( void ) { return _tolerance; }
+    void setMaxDays ( double maxDays ) { _maxDays = maxDays; invalidate(); }
+    double getMaxDays ( void ) { return _maxDays; }
+
+    size_t getComputed ( void ) { return _computed; }
+    size_t getSkipped ( void ) { return _skipped; }
+    void resetStatistics ( void ) { _computed = _skipped = 0; }
+};
+
+#endif /* SSLazyEphemeris_hpp */
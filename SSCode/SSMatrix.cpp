@@ -9,24 +9,6 @@
 #include <stdarg.h>
 #include "SSMatrix.hpp"
 
-// Constructs a 3x3 matrix whose elements are all initialized to zero.
-
-SSMatrix::SSMatrix ( void )
-{
-    m00 = 0.0;  m01 = 0.0; m02 = 0.0;
-    m10 = 0.0;  m11 = 0.0; m12 = 0.0;
-    m20 = 0.0;  m21 = 0.0; m22 = 0.0;
-}
-
-// Constructs a 3x3 matrix whose elements are specified individually by row.
-
-SSMatrix::SSMatrix ( double m00, double m01, double m02, double m10, double m11, double m12, double m20, double m21, double m22 )
-{
-    this->m00 = m00; this->m01 = m01; this->m02 = m02;
-    this->m10 = m10; this->m11 = m11; this->m12 = m12;
-    this->m20 = m20; this->m21 = m21; this->m22 = m22;
-}
-
 // Returns a 3x3 identity matrix.
 
 SSMatrix SSMatrix::identity ( void )
@@ -36,17 +18,6 @@ SSMatrix SSMatrix::identity ( void )
                       0.0, 0.0, 1.0 );
 }
 
-// Returns a 3x3 matrix which is the transpose of this matrix.
-// Does not transpose this matrix in place!
-// For a rotation matrix, its transpose is also its inverse.
-
-SSMatrix SSMatrix::transpose ( void )
-{
-    return SSMatrix ( m00, m10, m20,
-                      m01, m11, m21,
-                      m02, m12, m22 );
-}
-
 // Returns a 3x3 matrix which is the inverse of this matrix.
 // Does not invert this matrix in place!
 // For a rotation matrix, its transpose is also its inverse.
@@ -85,40 +56,30 @@ double SSMatrix::determinant ( void )
     return ( det );
 }
 
-// Returns the product of this matrix and a 3-element vector
-// as another vector.  Does not modify the input vector (vec)!
+// Multiplies an array of (n) vectors (vecs) by this matrix, in place.
 
-SSVector SSMatrix::multiply ( SSVector vec )
+void SSMatrix::multiply ( SSVector *vecs, size_t n ) const
 {
-    double x = m00 * vec.x + m01 * vec.y + m02 * vec.z;
-    double y = m10 * vec.x + m11 * vec.y + m12 * vec.z;
-    double z = m20 * vec.x + m21 * vec.y + m22 * vec.z;
-    
-    return SSVector ( x, y, z );
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double x = vecs[i].x, y = vecs[i].y, z = vecs[i].z;
+        vecs[i].x = m00 * x + m01 * y + m02 * z;
+        vecs[i].y = m10 * x + m11 * y + m12 * z;
+        vecs[i].z = m20 * x + m21 * y + m22 * z;
+    }
 }
 
-// Returns the product of this matrix and another 3x3 matrix
-// as another matrix.  Does not modify the input matrix (mat)!
-// Note: matrix multiplication is NOT commutative; in other words,
-// this.multiply(that) and that.multiply(this) return different matrices!
+// Multiplies (n) vectors given as separate arrays of x, y, z components by this matrix, in place.
 
-SSMatrix SSMatrix::multiply ( SSMatrix mat )
+void SSMatrix::multiply ( double *x, double *y, double *z, size_t n ) const
 {
-    double x0 = m00 * mat.m00 + m01 * mat.m10 + m02 * mat.m20;
-    double x1 = m10 * mat.m00 + m11 * mat.m10 + m12 * mat.m20;
-    double x2 = m20 * mat.m00 + m21 * mat.m10 + m22 * mat.m20;
-
-    double y0 = m00 * mat.m01 + m01 * mat.m11 + m02 * mat.m21;
-    double y1 = m10 * mat.m01 + m11 * mat.m11 + m12 * mat.m21;
-    double y2 = m20 * mat.m01 + m21 * mat.m11 + m22 * mat.m21;
-
-    double z0 = m00 * mat.m02 + m01 * mat.m12 + m02 * mat.m22;
-    double z1 = m10 * mat.m02 + m11 * mat.m12 + m12 * mat.m22;
-    double z2 = m20 * mat.m02 + m21 * mat.m12 + m22 * mat.m22;
-    
-    return SSMatrix ( x0, y0, z0,
-                      x1, y1, z1,
-                      x2, y2, z2 );
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double vx = x[i], vy = y[i], vz = z[i];
+        x[i] = m00 * vx + m01 * vy + m02 * vz;
+        y[i] = m10 * vx + m11 * vy + m12 * vz;
+        z[i] = m20 * vx + m21 * vy + m22 * vz;
+    }
 }
 
 // Returns a matrix which represents this matrix rotated around
@@ -5,6 +5,9 @@
 // Copyright © 2020 Southern Stars. All rights reserved.
 //
 // Represents a 3x3 matrix, with routines for performing simple matrix and vector-matrix arithmetic.
+// Products with vectors and other matrices are inline and constexpr; transposeMultiply() multiplies by this matrix's
+// transpose without forming it. The array versions of multiply() are plain loops which the compiler can vectorize,
+// and are the base for batch transformations elsewhere, e.g. SSCoordinates::transform() and precess().
 
 #ifndef SSMatrix_hpp
 #define SSMatrix_hpp
@@ -17,10 +20,11 @@ struct SSMatrix
     double m10, m11, m12;
     double m20, m21, m22;
     
-    SSMatrix ( void );
-    SSMatrix ( double m00, double m01, double m02, double m10, double m11, double m12, double m20, double m21, double m22 );
+    constexpr SSMatrix ( void ) : m00 ( 0.0 ), m01 ( 0.0 ), m02 ( 0.0 ), m10 ( 0.0 ), m11 ( 0.0 ), m12 ( 0.0 ), m20 ( 0.0 ), m21 ( 0.0 ), m22 ( 0.0 ) {}
+    constexpr SSMatrix ( double m00, double m01, double m02, double m10, double m11, double m12, double m20, double m21, double m22 ) :
+        m00 ( m00 ), m01 ( m01 ), m02 ( m02 ), m10 ( m10 ), m11 ( m11 ), m12 ( m12 ), m20 ( m20 ), m21 ( m21 ), m22 ( m22 ) {}
     
-    SSMatrix transpose ( void );
+    constexpr SSMatrix transpose ( void ) const { return SSMatrix ( m00, m10, m20, m01, m11, m21, m02, m12, m22 ); }
     SSMatrix inverse ( void );
     double  determinant ( void );
     
@@ -30,12 +34,36 @@ struct SSMatrix
     SSMatrix negateMiddleRow ( void );
     SSMatrix negateMiddleCol ( void );
 
-    SSVector multiply ( SSVector vec );
-    SSMatrix multiply ( SSMatrix mat );
+    // Product of this matrix and a vector or another matrix (mat); matrix multiplication is NOT commutative!
+
+    constexpr SSVector multiply ( SSVector vec ) const
+    {
+        return SSVector ( m00 * vec.x + m01 * vec.y + m02 * vec.z,
+                          m10 * vec.x + m11 * vec.y + m12 * vec.z,
+                          m20 * vec.x + m21 * vec.y + m22 * vec.z );
+    }
+
+    constexpr SSMatrix multiply ( SSMatrix mat ) const
+    {
+        return SSMatrix ( m00 * mat.m00 + m01 * mat.m10 + m02 * mat.m20, m00 * mat.m01 + m01 * mat.m11 + m02 * mat.m21, m00 * mat.m02 + m01 * mat.m12 + m02 * mat.m22,
+                          m10 * mat.m00 + m11 * mat.m10 + m12 * mat.m20, m10 * mat.m01 + m11 * mat.m11 + m12 * mat.m21, m10 * mat.m02 + m11 * mat.m12 + m12 * mat.m22,
+                          m20 * mat.m00 + m21 * mat.m10 + m22 * mat.m20, m20 * mat.m01 + m21 * mat.m11 + m22 * mat.m21, m20 * mat.m02 + m21 * mat.m12 + m22 * mat.m22 );
+    }
+
+    // Same as transpose().multiply(), e.g. to invert a rotation; results are identical.
+
+    constexpr SSVector transposeMultiply ( SSVector vec ) const { return transpose().multiply ( vec ); }
+    constexpr SSMatrix transposeMultiply ( SSMatrix mat ) const { return transpose().multiply ( mat ); }
+
+    // Multiplies (n) vectors in place, either as an array of vectors (vecs) or as separate arrays of x, y, z components.
+
+    void multiply ( SSVector *vecs, size_t n ) const;
+    void multiply ( double *x, double *y, double *z, size_t n ) const;
+
     SSMatrix rotate ( int axis, double angle );
     
-    SSVector operator * ( SSVector other ) { return multiply ( other ); }
-    SSMatrix operator * ( SSMatrix other ) { return multiply ( other ); }
+    constexpr SSVector operator * ( SSVector other ) const { return multiply ( other ); }
+    constexpr SSMatrix operator * ( SSMatrix other ) const { return multiply ( other ); }
 };
 
 #endif /* SSMatrix_hpp */
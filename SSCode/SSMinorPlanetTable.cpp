@@ -0,0 +1,458 @@
+// SSMinorPlanetTable.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include "SSMinorPlanetTable.hpp"
+
+// Orbital elements are referred to the J2000 ecliptic; computeEphemeris() rotates them into the J2000 equatorial frame once,
+// the same way SSPlanet::computeMinorPlanetPositionVelocity() does for each object at every call.
+
+static SSMatrix eclipticMatrix ( void )
+{
+    static SSMatrix matrix = SSCoordinates::getEclipticMatrix ( SSCoordinates::getObliquity ( SSTime::kJ2000 ) );
+    return matrix;
+}
+
+SSMinorPlanetTable::SSMinorPlanetTable ( void )
+{
+    _prepared = false;
+    _magLimit = INFINITY;
+    _boundInterval = kDefaultBoundInterval;
+    _boundJED = INFINITY;
+    _boundObsSlack = 0.0;
+}
+
+void SSMinorPlanetTable::clear ( void )
+{
+    _orbits.clear();
+    _prepared = false;
+    _jedlt.clear();
+    _pos.clear();
+    _vel.clear();
+
+    _boundJED = INFINITY;
+    _magBound.clear();
+    _candidates.clear();
+    _candidateIndex.clear();
+
+    type.clear();
+    ident.clear();
+    names.clear();
+    hmag.clear();
+    gmag.clear();
+
+    position.clear();
+    velocity.clear();
+    direction.clear();
+    distance.clear();
+    magnitude.clear();
+}
+
+void SSMinorPlanetTable::reserve ( size_t size )
+{
+    _orbits.reserve ( size );
+    type.reserve ( size );
+    ident.reserve ( size );
+    names.reserve ( size );
+    hmag.reserve ( size );
+    gmag.reserve ( size );
+}
+
+bool SSMinorPlanetTable::push_back ( SSObjectPtr pObject )
+{
+    SSPlanetPtr pPlanet = SSGetPlanetPtr ( pObject );
+    if ( pPlanet == nullptr || ( pPlanet->getType() != kTypeAsteroid && pPlanet->getType() != kTypeComet ) )
+        return false;
+
+    _orbits.push_back ( pPlanet->getOrbit() );
+    _prepared = false;
+    _boundJED = INFINITY;
+
+    type.push_back ( pPlanet->getType() );
+    ident.push_back ( pPlanet->getIdentifier() );
+    names.push_back ( pPlanet->getNames() );
+    hmag.push_back ( pPlanet->getHMagnitude() );
+    gmag.push_back ( pPlanet->getGMagnitude() );
+    return true;
+}
+
+int SSMinorPlanetTable::append ( SSObjectArray &objects )
+{
+    int n = 0;
+    for ( size_t i = 0; i < objects.size(); i++ )
+        if ( push_back ( objects[i] ) )
+            n++;
+
+    return n;
+}
+
+void SSMinorPlanetTable::setOrbit ( size_t k, const SSOrbit &orbit )
+{
+    if ( k >= size() )
+        return;
+
+    _orbits.t[k] = orbit.t;
+    _orbits.q[k] = orbit.q;
+    _orbits.e[k] = orbit.e;
+    _orbits.i[k] = orbit.i;
+    _orbits.w[k] = orbit.w;
+    _orbits.n[k] = orbit.n;
+    _orbits.m[k] = orbit.m;
+    _orbits.mm[k] = orbit.mm;
+    _prepared = false;
+    _boundJED = INFINITY;
+}
+
+void SSMinorPlanetTable::setMagnitudeLimit ( float limit )
+{
+    if ( limit != _magLimit )
+        _boundJED = INFINITY;
+    _magLimit = limit;
+}
+
+void SSMinorPlanetTable::setMagnitudeBoundInterval ( double days )
+{
+    if ( days != _boundInterval )
+        _boundJED = INFINITY;
+    _boundInterval = days;
+}
+
+// Recomputes every object's brightest possible magnitude over the bound interval around the time in the
+// coordinates object (coords), and the orbits of the candidate objects which might reach the magnitude limit.
+// Over that interval, an object moves no faster than at perihelion, so its distances from the Sun (r)
+// and observer (d) change by at most that speed times the interval (plus light time). The observer may
+// move by _boundObsSlack. Neither phase function exceeds 1, so an asteroid is never brighter than
+// H + 5 log ( r d ), and a comet never brighter than H + 5 log ( d ) + 2.5 K log ( r ), at the least
+// (or, for K < 0, greatest) possible r and least possible d.
+
+void SSMinorPlanetTable::updateMagnitudeBounds ( SSCoordinates &coords )
+{
+    double jed = coords.getJED();
+    SSVector obsPos = coords.getObserverPosition();
+    double obsRad = obsPos.magnitude();
+
+    // Observer's speed is nearly constant over a month or so; allow 5% extra, plus 100 km for topocentric motion.
+
+    _boundJED = jed;
+    _boundObsPos = obsPos;
+    _boundObsSlack = 1.05 * coords.getObserverVelocity().magnitude() * _boundInterval + 100.0 / SSCoordinates::kKmPerAU;
+
+    size_t n = size();
+    _orbits.toPositionVelocity ( jed, _pos, _vel );
+    _magBound.resize ( n );
+    _candidates.clear();
+    _candidateIndex.clear();
+
+    for ( size_t k = 0; k < n; k++ )
+    {
+        double q = _orbits.q[k], e = fabs ( _orbits.e[k] );
+        double r = _pos[k].magnitude(), d = _pos[k].distance ( obsPos );
+        double dr = SSOrbit::kGaussGravHelio * sqrt ( ( 1.0 + e ) / q ) * ( _boundInterval + d / SSCoordinates::kLightAUPerDay );
+        double rmin = max ( q, r - dr ), rmax = r + dr;
+        double dmin = max ( rmin - obsRad, d - dr ) - _boundObsSlack;
+        float bound = -INFINITY;
+
+        if ( ::isinf ( hmag[k] ) )
+            bound = INFINITY;
+        else if ( ::isnan ( r ) || ! ( dmin > 0.0 ) )
+            bound = -INFINITY;
+        else if ( type[k] == kTypeComet )
+            bound = ::isinf ( gmag[k] ) ? -INFINITY : hmag[k] + 5.0 * log10 ( dmin ) + 2.5 * gmag[k] * log10 ( gmag[k] < 0.0 ? rmax : rmin );
+        else if ( gmag[k] >= 0.0 && gmag[k] <= 1.0 )
+            bound = hmag[k] + 5.0 * log10 ( rmin * dmin );
+
+        _magBound[k] = bound;
+        if ( bound <= _magLimit )
+        {
+            _candidates.push_back ( _orbits.get ( k ) );
+            _candidateIndex.push_back ( k );
+        }
+    }
+
+    _candidates.prepare ( eclipticMatrix() );
+}
+
+void SSMinorPlanetTable::computeEphemeris ( SSCoordinates &coords )
+{
+    if ( ! _prepared )
+    {
+        _orbits.prepare ( eclipticMatrix() );
+        _prepared = true;
+    }
+
+    // If we have a magnitude limit, only compute candidate orbits which might reach it;
+    // first recompute the candidates if time or observer have moved too far since last time.
+
+    double jed = coords.getJED();
+    SSVector obsPos = coords.getObserverPosition();
+    size_t n = size();
+
+    bool limited = _magLimit != INFINITY;
+    if ( limited && ( ! ( fabs ( jed - _boundJED ) <= _boundInterval ) || obsPos.distance ( _boundObsPos ) > _boundObsSlack ) )
+        updateMagnitudeBounds ( coords );
+
+    SSOrbitArray &orbits = limited ? _candidates : _orbits;
+    size_t nc = orbits.size();
+    auto index = [&] ( size_t j ) { return limited ? _candidateIndex[j] : j; };
+
+    // Compute all geometric positions at current JED. If desired, compute each object's light time from them,
+    // then recompute all positions antedated for their light times in a second batch.
+
+    orbits.toPositionVelocity ( jed, _pos, _vel );
+
+    if ( coords.getLightTime() )
+    {
+        _jedlt.resize ( nc );
+        for ( size_t j = 0; j < nc; j++ )
+            _jedlt[j] = jed - ( _pos[j] - obsPos ).magnitude() / SSCoordinates::kLightAUPerDay;
+
+        orbits.toPositionVelocity ( _jedlt, _pos, _vel );
+    }
+
+    // Objects which were skipped have infinite position, velocity, direction, distance, and magnitude.
+
+    SSVector inf ( INFINITY, INFINITY, INFINITY );
+    position.assign ( n, inf );
+    velocity.assign ( n, inf );
+    direction.assign ( n, inf );
+    distance.assign ( n, INFINITY );
+    magnitude.assign ( n, INFINITY );
+
+    // Compute apparent direction, distance, phase angle, and visual magnitude of each computed object.
+
+    for ( size_t j = 0; j < nc; j++ )
+    {
+        size_t k = index ( j );
+        position[k] = _pos[j];
+        velocity[k] = _vel[j];
+        if ( _pos[j].isnan() )
+            continue;
+
+        direction[k] = coords.apparentDirection ( position[k], distance[k] );
+        double rad = position[k].magnitude();
+        double phase = SSPlanet::phaseAngle ( position[k], direction[k] );
+
+        if ( type[k] == kTypeComet )
+            magnitude[k] = SSPlanet::computeCometMagnitude ( rad, distance[k], hmag[k], gmag[k] );
+        else
+            magnitude[k] = SSPlanet::computeAsteroidMagnitude ( rad, distance[k], phase, hmag[k], gmag[k] );
+    }
+}
+
+void SSMinorPlanetTable::computeEphemeris ( SSCoordinates &coords, size_t k )
+{
+    size_t n = size();
+    if ( k >= n )
+        return;
+
+    if ( magnitude.size() != n )
+    {
+        SSVector inf ( INFINITY, INFINITY, INFINITY );
+        position.assign ( n, inf );
+        velocity.assign ( n, inf );
+        direction.assign ( n, inf );
+        distance.assign ( n, INFINITY );
+        magnitude.assign ( n, INFINITY );
+    }
+
+    SSMatrix matrix = eclipticMatrix();
+    SSOrbit orbit = _orbits.get ( k );
+    double jed = coords.getJED();
+    SSVector pos, vel;
+
+    orbit.toPositionVelocity ( jed, pos, vel );
+    if ( coords.getLightTime() )
+        orbit.toPositionVelocity ( jed - ( matrix * pos - coords.getObserverPosition() ).magnitude() / SSCoordinates::kLightAUPerDay, pos, vel );
+
+    position[k] = matrix * pos;
+    velocity[k] = matrix * vel;
+    if ( position[k].isnan() )
+    {
+        direction[k] = SSVector ( INFINITY, INFINITY, INFINITY );
+        distance[k] = magnitude[k] = INFINITY;
+        return;
+    }
+
+    direction[k] = coords.apparentDirection ( position[k], distance[k] );
+    double rad = position[k].magnitude();
+    double phase = SSPlanet::phaseAngle ( position[k], direction[k] );
+
+    if ( type[k] == kTypeComet )
+        magnitude[k] = SSPlanet::computeCometMagnitude ( rad, distance[k], hmag[k], gmag[k] );
+    else
+        magnitude[k] = SSPlanet::computeAsteroidMagnitude ( rad, distance[k], phase, hmag[k], gmag[k] );
+}
+
+SSPlanetPtr SSMinorPlanetTable::materialize ( size_t k )
+{
+    if ( k >= size() )
+        return nullptr;
+
+    SSPlanetPtr pPlanet = new SSPlanet ( type[k] );
+
+    pPlanet->setIdentifier ( ident[k] );
+    pPlanet->setNames ( names[k] );
+    pPlanet->setOrbit ( _orbits.get ( k ) );
+    pPlanet->setHMagnitude ( hmag[k] );
+    pPlanet->setGMagnitude ( gmag[k] );
+
+    if ( k < magnitude.size() )
+    {
+        pPlanet->setDirection ( direction[k] );
+        pPlanet->setDistance ( distance[k] );
+        pPlanet->setMagnitude ( magnitude[k] );
+    }
+
+    return pPlanet;
+}
+
+SSMinorPlanetPathIndex::SSMinorPlanetPathIndex ( void )
+{
+    _pTable = nullptr;
+    _jd0 = 0.0;
+    _bucketDays = 1.0;
+    _depth = 0;
+}
+
+// Computes center and bounding circle radius of every HTM trixel from depth 0 to _depth.
+
+void SSMinorPlanetPathIndex::initTrixels ( void )
+{
+    SSHTM htm;
+
+    _centers.resize ( _depth + 1 );
+    _radii.resize ( _depth + 1 );
+
+    for ( int d = 0; d <= _depth; d++ )
+    {
+        uint64_t id0 = 8ULL << ( 2 * d ), n = id0;
+        _centers[d].resize ( n );
+        _radii[d].resize ( n );
+
+        for ( uint64_t id = id0; id < id0 + n; id++ )
+        {
+            SSVector v0, v1, v2;
+            htm.ID2Triangle ( id, v0, v1, v2 );
+            SSVector vc = ( v0 + v1 + v2 ).normalize();
+            _centers[d][id - id0] = vc;
+            _radii[d][id - id0] = max ( { vc.angularSeparation ( v0 ), vc.angularSeparation ( v1 ), vc.angularSeparation ( v2 ) } );
+        }
+    }
+}
+
+// Appends IDs of all trixels at depth _depth, below the trixel with the given ID at the given depth,
+// whose bounding circles overlap a circle of angular radius (rad) in radians around a unit vector (center).
+
+void SSMinorPlanetPathIndex::capTrixels ( int depth, uint64_t id, const SSVector &center, double rad, vector<uint64_t> &ids )
+{
+    uint64_t i = id - ( 8ULL << ( 2 * depth ) );
+    if ( _centers[depth][i].angularSeparation ( center ) > _radii[depth][i] + rad )
+        return;
+
+    if ( depth == _depth )
+        ids.push_back ( id );
+    else
+        for ( uint64_t child = id * 4; child < id * 4 + 4; child++ )
+            capTrixels ( depth + 1, child, center, rad, ids );
+}
+
+// Each object's apparent path during a bucket is covered by a circle around the midpoint of its directions at the
+// start and end of the bucket, with radius the full separation between them (double the chord, to allow for a
+// curved path), plus twice its horizontal parallax (for the observer's diurnal motion), plus a fixed margin.
+
+size_t SSMinorPlanetPathIndex::build ( SSMinorPlanetTable &table, SSCoordinates coords, double jd0, double jd1, double bucketDays, int depth )
+{
+    static constexpr double kMargin = 0.005;     // radians, about 17 arcminutes
+
+    clear();
+    if ( ! ( jd1 > jd0 ) || ! ( bucketDays > 0.0 ) || depth < 0 )
+        return 0;
+
+    if ( depth != _depth || _centers.empty() )
+    {
+        _depth = depth;
+        initTrixels();
+    }
+
+    _pTable = &table;
+    _jd0 = jd0;
+    _bucketDays = bucketDays;
+    _buckets.resize ( (size_t) ceil ( ( jd1 - jd0 ) / bucketDays ) );
+
+    size_t n = table.size(), entries = 0;
+    vector<SSVector> dir0 ( n );
+    vector<double> dist0 ( n );
+    vector<uint64_t> ids;
+
+    for ( size_t b = 0; b <= _buckets.size(); b++ )
+    {
+        coords.setTime ( SSTime ( jd0 + b * bucketDays ) );
+        table.computeEphemeris ( coords );
+
+        for ( size_t k = 0; b > 0 && k < n; k++ )
+        {
+            SSVector dir1 = table.direction[k];
+            double dist = min ( dist0[k], table.distance[k] );
+            if ( ::isinf ( dist ) || dir0[k].isnan() || dir1.isnan() )
+                continue;
+
+            double rad = dir0[k].angularSeparation ( dir1 ) + 2.0 * asin ( min ( 1.0, SSCoordinates::kAUPerEarthRadii / dist ) ) + kMargin;
+            ids.clear();
+            for ( uint64_t root = 8; root < 16; root++ )
+                capTrixels ( 0, root, ( dir0[k] + dir1 ).normalize(), rad, ids );
+
+            for ( uint64_t id : ids )
+                _buckets[b - 1][id].push_back ( (uint32_t) k );
+            entries += ids.size();
+        }
+
+        dir0 = table.direction;
+        dist0 = table.distance;
+    }
+
+    return entries;
+}
+
+int SSMinorPlanetPathIndex::search ( SSCoordinates &coords, SSVector center, SSAngle rad, vector<size_t> &results, size_t *candidates )
+{
+    results.clear();
+    if ( candidates )
+        *candidates = 0;
+
+    double t = ( coords.getTime().jd - _jd0 ) / _bucketDays;
+    if ( _pTable == nullptr || ! ( t >= 0.0 && t <= _buckets.size() ) )
+        return -1;
+
+    // Gather candidate objects from every trixel in the current bucket near the search circle.
+
+    size_t b = min ( (size_t) t, _buckets.size() - 1 );
+    vector<uint64_t> ids;
+    for ( uint64_t root = 8; root < 16; root++ )
+        capTrixels ( 0, root, center, rad, ids );
+
+    vector<size_t> objects;
+    for ( uint64_t id : ids )
+    {
+        auto it = _buckets[b].find ( id );
+        if ( it != _buckets[b].end() )
+            objects.insert ( objects.end(), it->second.begin(), it->second.end() );
+    }
+
+    sort ( objects.begin(), objects.end() );
+    objects.erase ( unique ( objects.begin(), objects.end() ), objects.end() );
+    if ( candidates )
+        *candidates = objects.size();
+
+    // Refine candidates with their full ephemeris.
+
+    for ( size_t k : objects )
+    {
+        _pTable->computeEphemeris ( coords, k );
+        if ( center.angularSeparation ( _pTable->direction[k] ) <= rad )
+            results.push_back ( k );
+    }
+
+    return (int) results.size();
+}
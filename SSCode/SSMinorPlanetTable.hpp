@@ -0,0 +1,161 @@
+// SSMinorPlanetTable.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class stores asteroids and comets in columns - contiguous orbital elements, H/G magnitude
+// parameters, identifiers, and names - instead of as individual SSPlanet objects, so that the
+// ephemeris of hundreds of thousands of minor planets can be computed in a single call with the
+// batch Kepler solver in SSOrbitArray, including each object's light time correction.
+// Individual SSPlanet objects can still be created on demand, e.g. for display in a user interface.
+
+#ifndef SSMinorPlanetTable_hpp
+#define SSMinorPlanetTable_hpp
+
+#include <unordered_map>
+
+#include "SSPlanet.hpp"
+#include "SSHTM.hpp"
+
+class SSMinorPlanetTable
+{
+protected:
+
+    SSOrbitArray _orbits;               // orbital elements, prepared in the fundamental J2000 equatorial frame
+    bool _prepared;                     // true if orbit orientations are current; false after any orbit changes
+    vector<double> _jedlt;              // per-object dates antedated for light time; scratch storage for computeEphemeris()
+    vector<SSVector> _pos, _vel;        // candidate objects' positions and velocities; scratch storage for computeEphemeris()
+
+    float _magLimit;                    // faintest magnitude computed by computeEphemeris(); infinite to compute all objects
+    double _boundInterval;              // magnitude bounds are valid this many days before and after _boundJED
+    double _boundJED;                   // Julian Ephemeris Date when magnitude bounds were computed; infinite if never
+    SSVector _boundObsPos;              // observer position when magnitude bounds were computed
+    double _boundObsSlack;              // magnitude bounds are valid while observer is within this many AU of _boundObsPos
+    vector<float> _magBound;            // brightest magnitude each object can reach within bound interval; -infinity if unbounded
+    SSOrbitArray _candidates;           // orbits of objects whose magnitude bounds are at or brighter than _magLimit
+    vector<size_t> _candidateIndex;     // indices of those objects in this table
+
+    void updateMagnitudeBounds ( SSCoordinates &coords );
+
+public:
+
+    vector<SSObjectType>   type;        // object type: kTypeAsteroid or kTypeComet
+    vector<SSIdentifier>   ident;       // primary identifier (asteroid number or comet designation)
+    vector<vector<string>> names;       // name string(s)
+    vector<float>          hmag;        // absolute magnitude; infinite if unknown
+    vector<float>          gmag;        // asteroid magnitude slope parameter G, or comet magnitude parameter K; infinite if unknown
+
+    // Results of computeEphemeris(); empty until then.
+
+    vector<SSVector>       position;    // heliocentric position in fundamental J2000 equatorial frame in AU, antedated for light time
+    vector<SSVector>       velocity;    // heliocentric velocity in fundamental J2000 equatorial frame in AU per day
+    vector<SSVector>       direction;   // apparent direction from observer as unit vector in fundamental frame
+    vector<double>         distance;    // distance from observer in AU
+    vector<float>          magnitude;   // visual magnitude; infinite if unknown
+
+    SSMinorPlanetTable ( void );
+
+    size_t size ( void ) { return ident.size(); }
+    void clear ( void );
+    void reserve ( size_t size );
+
+    // Appends an asteroid or comet to the table, copying its orbit, identifier, names, and magnitude parameters.
+    // Returns false (and does nothing) if the object is not an asteroid or comet.
+
+    bool push_back ( SSObjectPtr pObject );
+
+    // Appends all asteroids and comets in an object array to the table; returns number of objects appended.
+
+    int append ( SSObjectArray &objects );
+
+    // Returns orbit of k-th object. After changing any orbits with setOrbit(), call computeEphemeris() again.
+
+    SSOrbit getOrbit ( size_t k ) { return _orbits.get ( k ); }
+    void setOrbit ( size_t k, const SSOrbit &orbit );
+
+    // Computes every object's heliocentric position and velocity, and apparent direction, distance, and magnitude,
+    // at the time and observer location in a coordinates object (coords). If coords has light time enabled,
+    // each object is antedated by its own light time, once, exactly as SSPlanet::computeEphemeris() does.
+    // Positions come from the Keplerian orbits only; compiled Chebyshev ephemeris files are not consulted.
+
+    void computeEphemeris ( SSCoordinates &coords );
+
+    // Computes only the k-th object's position, velocity, direction, distance, and magnitude, the same way,
+    // without the magnitude limit; other objects' results are unchanged (or infinite, if never computed).
+
+    void computeEphemeris ( SSCoordinates &coords, size_t k );
+
+    // Sets or returns faintest magnitude (limit) of interest to computeEphemeris(), which then skips objects that
+    // cannot possibly be that bright: their position, velocity, direction, distance, and magnitude are all infinite.
+    // Each object's brightest possible magnitude is a conservative bound from its perihelion distance, H and G
+    // (or K), and its distance from the Sun and observer at a reference time; see getMagnitudeBound().
+    // Bounds are valid for an interval (days) before and after that time, and are recomputed, with one extra
+    // pass over all orbits, only when the time or observer moves outside it. The default limit is infinite
+    // (compute every object); the default interval is kDefaultBoundInterval.
+
+    static constexpr double kDefaultBoundInterval = 30.0;
+
+    void setMagnitudeLimit ( float limit );
+    float getMagnitudeLimit ( void ) { return _magLimit; }
+    void setMagnitudeBoundInterval ( double days );
+    double getMagnitudeBoundInterval ( void ) { return _boundInterval; }
+
+    // Returns k-th object's current brightest possible magnitude bound, or -infinity if not computed
+    // or not bounded. Returns number of objects which computeEphemeris() currently computes.
+
+    float getMagnitudeBound ( size_t k ) { return k < _magBound.size() ? _magBound[k] : -INFINITY; }
+    size_t getNumCandidates ( void ) { return _magLimit == INFINITY ? size() : _candidateIndex.size(); }
+
+    // Creates a new SSPlanet for the k-th object, with its orbit and other properties, and its direction,
+    // distance, and magnitude from the last computeEphemeris(). The caller owns (and must delete) the result.
+    // Returns nullptr if k is out of range.
+
+    SSPlanetPtr materialize ( size_t k );
+};
+
+// This class indexes the coarse sky tracks of all objects in an SSMinorPlanetTable over a range of time:
+// for each time bucket, it stores the objects whose apparent paths during that bucket cross each HTM trixel.
+// A cone search at any time in the range (e.g. a telescope field, or a star to be occulted) then looks up
+// only the trixels near the cone in the current bucket, and refines those candidates with their full
+// SSOrbit ephemeris, instead of computing the ephemeris of every object in the table.
+
+class SSMinorPlanetPathIndex
+{
+protected:
+
+    SSMinorPlanetTable *_pTable;        // indexed table; not owned by this class
+    double _jd0, _bucketDays;           // Julian Date (civil time) of start of first bucket, and bucket length in days
+    int _depth;                         // HTM depth of indexed trixels; 0 = eight root triangles
+    vector<unordered_map<uint64_t,vector<uint32_t>>> _buckets;    // object indices in each trixel, for each time bucket
+    vector<vector<SSVector>> _centers;  // center of each trixel, at each depth from 0 to _depth
+    vector<vector<double>> _radii;      // angular radius in radians of circle around each trixel's vertices, at each depth
+
+    void initTrixels ( void );
+    void capTrixels ( int depth, uint64_t id, const SSVector &center, double rad, vector<uint64_t> &ids );
+
+public:
+
+    SSMinorPlanetPathIndex ( void );
+
+    // Builds index of objects in a minor planet table (table) from civil Julian Date jd0 to jd1 in buckets of (bucketDays),
+    // at HTM depth (depth; the default, 6, has trixels about 1.4 degrees across), as seen from the observer location in a
+    // coordinates object (coords). Objects skipped by the table's magnitude limit at both ends of a bucket are not indexed
+    // in that bucket. The table's ephemeris results are overwritten. Returns number of object-trixel entries in the index.
+    // The table must not be changed while the index is in use; rebuild the index after changing the table.
+
+    size_t build ( SSMinorPlanetTable &table, SSCoordinates coords, double jd0, double jd1, double bucketDays = 1.0, int depth = 6 );
+
+    void clear ( void ) { _pTable = nullptr; _buckets.clear(); }
+    size_t numBuckets ( void ) { return _buckets.size(); }
+
+    // Finds objects within angular radius (rad) of a unit vector (center) in the fundamental frame, at the time and
+    // observer location in a coordinates object (coords), which must be inside the index time range.
+    // Indices of matching objects in the table are returned in (results), in increasing order; the table's ephemeris
+    // results for those objects are computed. Returns number of objects found, or -1 if time is outside the index range.
+    // If (candidates) is not null, it returns the number of objects which were refined.
+
+    int search ( SSCoordinates &coords, SSVector center, SSAngle rad, vector<size_t> &results, size_t *candidates = nullptr );
+};
+
+#endif /* SSMinorPlanetTable_hpp */
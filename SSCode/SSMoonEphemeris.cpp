@@ -268,7 +268,7 @@ int  calc_jsat_loc( const double jd, double *jsats,
                -  45.e-7 * sin( lon[3] - psi - 2. * PER)
                +  37.e-7 * sin( lon[3] + psi - twice_per_plus_g)
                +  30.e-7 * sin( 2. * l2 - 3. * lon[3] + 4.03 * del3 + ome2)
-               -  21.e-7 * sin( 2. * l2 - 3. * lon[2] + 4.03 * del3 + ome3);
+               -  21.e-7 * sin( 2. * l2 - 3. * lon[3] + 4.03 * del3 + ome3);
           
       rad[3] = -14388.e-7 * cos( l3 - pi3)
                 -7919.e-7 * cos( l3 - pi4)
@@ -948,14 +948,14 @@ and velocities with one relatively simple function.
 
 #define DEGREES_TO_RADIANS (PI/180.)
 
-static double an[5], ae[5], ai[5];         // satellite position data
+static thread_local double an[5], ae[5], ai[5];    // satellite position data, kept separately for each thread
 
 //   OrbitalPosition
 //   Compute basic orbital position data for the satellites.
 
 static void gust86_mean_parameters( const double jde )
 {
-   static double curr_jde_set = -1.;
+   static thread_local double curr_jde_set = -1.;
 
    if( jde != curr_jde_set)
       {
@@ -1825,18 +1825,7 @@ bool jupiterMoonPosition ( int id, double jed, SSVector &pos )
     
     // transform from ecliptic frame of date to J2000 equatorial frame.
     
-    static double matrixJED = 0.0;
-    static SSMatrix matrix;
-    
-    if ( jed != matrixJED )
-    {
-        SSMatrix eclMat = SSCoordinates::getEclipticMatrix ( SSCoordinates::getObliquity ( jed ) );
-        SSMatrix preMat = SSCoordinates::getPrecessionMatrix ( jed ).transpose();
-        matrix = preMat * eclMat;
-        matrixJED = jed;
-    }
-
-    pos = matrix * pos;
+    pos = SSEphemerisContext::current().getEclipticMatrix ( jed ) * pos;
     return true;
 }
 
@@ -1927,6 +1916,92 @@ bool SSMoonEphemeris::saturnMoonPositionVelocity ( int id, double jed, SSVector
     return true;
 }
 
+// Computes all four Galilean moons' Jupiter-centric positions (pos) and velocities (vel), in AU and AU/day,
+// in the fundamental J2000 mean equatorial frame, on a specified Julian Ephemeris Date (jed); in order Io, Europa,
+// Ganymede, Callisto. The theory's arguments are evaluated once for all four, at JED and one minute before;
+// results are identical to jupiterMoonPositionVelocity() for each moon, at less than half the cost.
+
+bool SSMoonEphemeris::jupiterMoonsPositionVelocity ( double jed, SSVector pos[kNumJupiterMoons], SSVector vel[kNumJupiterMoons] )
+{
+    double jsats[15] = { 0 }, jsats0[15] = { 0 };
+    double jed0 = jed - 1.0 / 1440.0;
+    
+    calc_jsat_loc ( jed, jsats, 15, 0 );
+    calc_jsat_loc ( jed0, jsats0, 15, 0 );
+    
+    SSEphemerisContext &context = SSEphemerisContext::current();
+    SSMatrix matrix = context.getEclipticMatrix ( jed );
+    SSMatrix matrix0 = context.getEclipticMatrix ( jed0 );
+    
+    for ( int i = 0; i < kNumJupiterMoons; i++ )
+    {
+        pos[i] = SSVector ( jsats[i * 3], jsats[i * 3 + 1], jsats[i * 3 + 2] );
+        vel[i] = SSVector ( jsats0[i * 3], jsats0[i * 3 + 1], jsats0[i * 3 + 2] );
+        
+        pos[i] *= 71420.0 / SSCoordinates::kKmPerAU;
+        vel[i] *= 71420.0 / SSCoordinates::kKmPerAU;
+        
+        pos[i] = matrix * pos[i];
+        vel[i] = ( pos[i] - matrix0 * vel[i] ) * 1440.0;
+    }
+    
+    return true;
+}
+
+// Returns matrix which transforms Saturn's inner moons' positions from Saturn's equatorial frame (inner = true),
+// or other moons' positions from the B1950 ecliptic (inner = false), to the fundamental J2000 equatorial frame.
+
+static SSMatrix saturnMoonMatrix ( bool inner )
+{
+    double m[3][3] = { { 0 } };
+    for ( int j = 0; j < 3; j++ )
+    {
+        double v[3] = { j == 0 ? 1.0 : 0.0, j == 1 ? 1.0 : 0.0, j == 2 ? 1.0 : 0.0 };
+        if ( inner )
+        {
+            rotate_vector ( v, INCL0, 0 );
+            rotate_vector ( v, ASC_NODE0, 2 );
+        }
+        rotate_vector ( v, OBLIQUITY_1950, 0 );
+        for ( int i = 0; i < 3; i++ )
+            m[i][j] = v[i];
+    }
+
+    SSMatrix rotate ( m[0][0], m[0][1], m[0][2], m[1][0], m[1][1], m[1][2], m[2][0], m[2][1], m[2][2] );
+    return SSCoordinates::getPrecessionMatrix ( SSTime::kB1950 ).transpose() * rotate;
+}
+
+// Computes all nine of Saturn's major moons' Saturn-centric positions (pos) and velocities (vel), in AU and AU/day,
+// in the fundamental J2000 mean equatorial frame, on a specified Julian Ephemeris Date (jed); in order Mimas, Enceladus,
+// Tethys, Dione, Rhea, Titan, Hyperion, Iapetus, Phoebe. Velocities come from each moon's osculating orbit.
+// The rotations from Saturn's equator to the B1950 ecliptic, to B1950 equatorial, and precession to J2000
+// are combined into one matrix for the inner four moons and another for the rest, computed only once.
+
+bool SSMoonEphemeris::saturnMoonsPositionVelocity ( double jed, SSVector pos[kNumSaturnMoons], SSVector vel[kNumSaturnMoons] )
+{
+    static SSMatrix innerMatrix = saturnMoonMatrix ( true );
+    static SSMatrix outerMatrix = saturnMoonMatrix ( false );
+
+    for ( int sat = MIMAS; sat <= PHOEBE; sat++ )
+    {
+        SAT_ELEMS elems = { 0 };
+        SSOrbit orbit;
+
+        elems.sat_no = sat;
+        elems.jd = jed;
+        set_ssat_elems ( &elems, &orbit );
+        orbit.toPositionVelocity ( jed, pos[sat], vel[sat] );
+
+        // inner 4 satellites are returned in Saturnic coords; the rest in B1950 ecliptic coords.
+        
+        SSMatrix &matrix = sat <= DIONE ? innerMatrix : outerMatrix;
+        pos[sat] = matrix * pos[sat];
+        vel[sat] = matrix * vel[sat];
+    }
+    
+    return true;
+}
+
 // Computes Uranus's major moons' Uranocentric position and velocity vectors, in units of AU and AU/day,
 // in the fundamental J2000 mean equatorial frame, on a specified Julian Ephemeris Date (jed).
 // The moon ID (id) is 701 = Ariel, 702 = Umbriel; 703 = Titania; 704 = Oberon; 705 = Miranda.
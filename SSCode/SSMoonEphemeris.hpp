@@ -15,9 +15,18 @@
 class SSMoonEphemeris
 {
 public:
+    static constexpr int kNumJupiterMoons = 4;      // Galilean moons: Io, Europa, Ganymede, Callisto
+    static constexpr int kNumSaturnMoons = 9;       // Mimas, Enceladus, Tethys, Dione, Rhea, Titan, Hyperion, Iapetus, Phoebe
+
     static bool marsMoonPositionVelocity ( int id, double jed, SSVector &pos, SSVector &vel );
     static bool jupiterMoonPositionVelocity ( int id, double jed, SSVector &pos, SSVector &vel );
     static bool saturnMoonPositionVelocity ( int id, double jed, SSVector &pos, SSVector &vel );
+
+    // Compute all moons of Jupiter or Saturn at once, sharing the work common to every moon of the system.
+    
+    static bool jupiterMoonsPositionVelocity ( double jed, SSVector pos[kNumJupiterMoons], SSVector vel[kNumJupiterMoons] );
+    static bool saturnMoonsPositionVelocity ( double jed, SSVector pos[kNumSaturnMoons], SSVector vel[kNumSaturnMoons] );
+
     static bool uranusMoonPositionVelocity ( int id, double jed, SSVector &pos, SSVector &vel );
     static bool neptuneMoonPositionVelocity ( int id, double jed, SSVector &pos, SSVector &vel );
     static bool plutoMoonPositionVelocity ( int id, double jed, SSVector &pos, SSVector &vel );
@@ -17,6 +17,15 @@
 #include "SSStar.hpp"
 #include "SSFeature.hpp"
 #include "SSConstellation.hpp"
+#include "SSThreadPool.hpp"
+#include "SSGzip.hpp"
+
+#include <atomic>
+
+#if USE_THREADS
+#include <mutex>
+#include <thread>
+#endif
 
 typedef map<SSObjectType,string> SSTypeStringMap;
 typedef map<string,SSObjectType> SSStringTypeMap;
@@ -98,17 +107,20 @@ static SSStringTypeMap _stringTypes =
 
 string SSObject::typeToName ( SSObjectType type )
 {
-    return _typeNames[ type ];
+    auto it = _typeNames.find ( type );
+    return it == _typeNames.end() ? "" : it->second;
 }
 
 string SSObject::typeToCode ( SSObjectType type )
 {
-    return _typeStrings[ type ];
+    auto it = _typeStrings.find ( type );
+    return it == _typeStrings.end() ? "" : it->second;
 }
 
 SSObjectType SSObject::codeToType ( string code )
 {
-    return _stringTypes[ code ];
+    auto it = _stringTypes.find ( code );
+    return it == _stringTypes.end() ? kTypeNonexistent : it->second;
 }
 
 SSObject::SSObject ( void ) : SSObject ( kTypeNonexistent )
@@ -119,7 +131,7 @@ SSObject::SSObject ( void ) : SSObject ( kTypeNonexistent )
 SSObject::SSObject ( SSObjectType type )
 {
     _type = type;
-    _names = vector<string> ( 0 );
+    _names = vector<SSIString> ( 0 );
     _description = "";
     _direction = SSVector ( INFINITY, INFINITY, INFINITY );
     _distance = INFINITY;
@@ -165,6 +177,11 @@ vector<SSIdentifier> SSObject::getIdentifiers ( void )
     return vector<SSIdentifier> ( 0 );
 }
 
+SSSpan<SSIdentifier> SSObject::getIdentifierSpan ( void )
+{
+    return SSSpan<SSIdentifier>();
+}
+
 // Default implementation of toCSV; overridden by subclasses.
 
 string SSObject::toCSV ( void )
@@ -172,6 +189,13 @@ string SSObject::toCSV ( void )
     return "";
 }
 
+// Default implementation of appendCSV appends toCSV(); overridden by subclasses which can append directly.
+
+void SSObject::appendCSV ( string &csv )
+{
+    csv += toCSV();
+}
+
 // Default implementation of computing object's apparent motion in a reference frame
 // returns unknown motion. Overridden by sublcasses SSStar and SSPlanet!
 
@@ -180,72 +204,331 @@ SSSpherical SSObject::computeApparentMotion ( SSCoordinates &coords, SSFrame fra
     return SSSpherical ( INFINITY, INFINITY, INFINITY );
 }
 
+thread_local SSObjectArena *SSObjectArena::_current = nullptr;
+
+// Objects carry no record of where they were allocated. Instead, the address range of every arena slab is kept here,
+// keyed by slab start address, so the arena which owns an object is found from the object's address. Slabs are added
+// and removed by the thread using their arena, but any thread may look them up to delete an object, so lookups lock.
+// The lowest and highest slab addresses are also kept atomically: an address outside them (including any address
+// while no slabs exist) belongs to no slab, so deleting most heap objects skips the lock and lookup entirely.
+
+struct slab_range
+{
+    uintptr_t end;                  // address following last byte of slab
+    SSObjectArena *arena;           // arena which owns slab
+};
+
+static atomic<uintptr_t> _slabsStart ( UINTPTR_MAX );     // start of lowest slab, or UINTPTR_MAX if none
+static atomic<uintptr_t> _slabsEnd ( 0 );                 // end of highest slab, or zero if none
+
+#if USE_THREADS
+static mutex _slabMutex;
+#endif
+
+// The slab map is created on first use and never destroyed, so arenas may still be released during static destruction.
+
+static map<uintptr_t,slab_range> &slab_ranges ( void )
+{
+    static map<uintptr_t,slab_range> *ranges = new map<uintptr_t,slab_range>;
+    return *ranges;
+}
+
+// Updates the lowest and highest slab addresses after slabs are added or removed. Slabs never overlap,
+// so the highest slab address is the end of the slab with the highest start address.
+
+static void update_slab_bounds ( void )
+{
+    map<uintptr_t,slab_range> &ranges = slab_ranges();
+    _slabsStart = ranges.empty() ? UINTPTR_MAX : ranges.begin()->first;
+    _slabsEnd = ranges.empty() ? 0 : ranges.rbegin()->second.end;
+}
+
+static void add_slab ( const char *slab, size_t size, SSObjectArena *arena )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _slabMutex );
+#endif
+    slab_ranges()[ (uintptr_t) slab ] = { (uintptr_t) slab + size, arena };
+    update_slab_bounds();
+}
+
+static void remove_slab ( const char *slab )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _slabMutex );
+#endif
+    slab_ranges().erase ( (uintptr_t) slab );
+    update_slab_bounds();
+}
+
+// Returns the arena whose slab contains an address (ptr), or nullptr if none does.
+
+static SSObjectArena *slab_owner ( const void *ptr )
+{
+    if ( (uintptr_t) ptr < _slabsStart || (uintptr_t) ptr >= _slabsEnd )
+        return nullptr;
+    
+#if USE_THREADS
+    lock_guard<mutex> lock ( _slabMutex );
+#endif
+    map<uintptr_t,slab_range> &ranges = slab_ranges();
+    auto it = ranges.upper_bound ( (uintptr_t) ptr );
+    if ( it == ranges.begin() )
+        return nullptr;
+    
+    --it;
+    return (uintptr_t) ptr < it->second.end ? it->second.arena : nullptr;
+}
+
+SSObjectArena::SSObjectArena ( size_t slabSize )
+{
+    _slabSize = max ( slabSize, (size_t) 1024 );
+    _used = 0;
+    _bytes = 0;
+}
+
+// Returns memory for an object of (size) bytes, aligned to 16 bytes, from this arena's last slab;
+// a new slab is allocated (and larger objects get one of their own) when the last one is full.
+
+void *SSObjectArena::allocate ( size_t size )
+{
+    size = ( size + 15 ) & ~ (size_t) 15;
+    if ( _slabs.empty() || _used + size > _slabSize )
+    {
+        size_t slabSize = max ( size, _slabSize );
+        char *slab = (char *) ::operator new ( slabSize );
+        _bytes += heapbytes ( slabSize );
+        add_slab ( slab, slabSize, this );
+        if ( slabSize > _slabSize && ! _slabs.empty() )
+        {
+            _slabs.insert ( _slabs.end() - 1, slab );
+            return slab;
+        }
+
+        _slabs.push_back ( slab );
+        _used = 0;
+    }
+    
+    void *ptr = _slabs.back() + _used;
+    _used += size;
+    return ptr;
+}
+
+// Releases all of this arena's memory. All objects allocated in it must already have been deleted.
+
+void SSObjectArena::reset ( void )
+{
+    for ( char *slab : _slabs )
+    {
+        remove_slab ( slab );
+        ::operator delete ( slab );
+    }
+    
+    _slabs.clear();
+    _used = 0;
+    _bytes = 0;
+}
+
+// With virtual inheritance (e.g. SSDoubleVariableStar) the SSObject part may not be at the start of the
+// allocated object, but it is still inside the same slab.
+
+SSObjectArena *SSObjectArena::getOwner ( const SSObject *pObject )
+{
+    return pObject ? slab_owner ( pObject ) : nullptr;
+}
+
+void *SSObject::operator new ( size_t size )
+{
+    SSObjectArena *arena = SSObjectArena::getCurrent();
+    return arena ? arena->allocate ( size ) : ::operator new ( size );
+}
+
+void SSObject::operator delete ( void *ptr )
+{
+    if ( ptr != nullptr && slab_owner ( ptr ) == nullptr )
+        ::operator delete ( ptr );
+}
+
+// Objects owned by an arena can only be added to the array which owns that arena.
+
+bool SSObjectArray::canAdd ( SSObjectPtr pObj )
+{
+    SSObjectArena *arena = SSObjectArena::getOwner ( pObj );
+    if ( arena == nullptr )
+        return true;
+    
+    for ( unique_ptr<SSObjectArena> &owned : _arenas )
+        if ( owned.get() == arena )
+            return true;
+    
+    return false;
+}
+
+// Deletes all objects, then releases all memory in this array's arenas, keeping only the first (empty) arena.
+
+void SSObjectArray::erase ( void )
+{
+    for ( SSObjectPtr pObj : _objects )
+        delete pObj;
+    
+    clear();
+    if ( _arenas.size() > 1 )
+        _arenas.resize ( 1 );
+    
+    if ( ! _arenas.empty() )
+        _arenas[0]->reset();
+}
+
+size_t SSObjectArray::memoryUsage ( void )
+{
+    size_t bytes = sizeof ( SSObjectArray ) + vecbytes ( _objects ) + vecbytes ( _arenas ) + vecbytes ( _index );
+    bytes += heapbytes ( _identIndex.capacity() * sizeof ( pair<SSIdentifier,size_t> ) );
+    
+    for ( unique_ptr<SSObjectArena> &arena : _arenas )
+        bytes += heapbytes ( sizeof ( SSObjectArena ) ) + arena->memoryUsage();
+    
+    for ( SSObjectPtr pObj : _objects )
+    {
+        bytes += pObj->heapBytes();
+        if ( SSObjectArena::getOwner ( pObj ) == nullptr )
+            bytes += heapbytes ( pObj->sizeOf() );
+    }
+    
+    return bytes;
+}
+
+// Appends an object, adding its identifiers to identifier columns if they're up to date; see setIdentifierCatalogs().
+// Returns false, and does not change the array, if the object can't be added.
+
+bool SSObjectArray::append ( SSObjectPtr pObj )
+{
+    if ( ! canAdd ( pObj ) )
+        return false;
+    
+    _objects.push_back ( pObj );
+    _index.clear();
+    _indexed = false;
+    if ( _identIndexed )
+        indexIdentifiers ( _objects.size() - 1 );
+    
+    return true;
+}
+
+void SSObjectArray::splice ( SSObjectArray &other )
+{
+    size_t begin = _objects.size();
+    _objects.insert ( _objects.end(), other._objects.begin(), other._objects.end() );
+    other._objects.clear();
+    
+    for ( unique_ptr<SSObjectArena> &arena : other._arenas )
+        _arenas.push_back ( move ( arena ) );
+    
+    other._arenas.clear();
+    other.clearIndex();
+    
+    _index.clear();
+    _indexed = false;
+    if ( _identIndexed )
+        indexIdentifiers ( begin );
+}
+
+// Replaces the object at (index) with a new object (pNew), and returns the old object, which is not deleted.
+// Returns nullptr, and does not change the array, if the index is out of range or the new object can't be added.
+
 SSObjectPtr SSObjectArray::set ( size_t index, SSObjectPtr pNew )
 {
-    if ( index >= 0 && index < size() )
+    if ( index >= 0 && index < size() && canAdd ( pNew ) )
     {
         SSObjectPtr pOld = _objects[index];
         _objects[index] = pNew;
+        clearIndex();
         return pOld;
     }
 
     return nullptr;
 }
 
-// Binary-searches SSObjectArray for objects matching a specific object (key)
-// using a caller-supplied comparison function (cmpfunc) that returns true if
-// the first object (p1) is less than the second (p2), and false if p1 >= p2.
-// SSObjectArray must be sorted prior to search, using same comparison function!!!
-// See SSObjectArray::sort() and https://en.cppreference.com/w/cpp/algorithm/sort.
-// Results are appended to vector (results); returns number of objects found.
+// Items per chunk below which sorting or filtering in parallel isn't worth dividing the work further.
 
-int SSObjectArray::search ( const SSObjectPtr &pKey, bool (cmpfunc) ( const SSObjectPtr &p1, const SSObjectPtr &p2 ), vector<SSObjectPtr> &results )
+static constexpr size_t kMinChunkSize = 16384;
+
+size_t SSObjectArray::chunkCount ( size_t n, int threads )
 {
-    int nfound = 0;
+    if ( threads <= 0 )
+        threads = SSThreadPool::shared().size();
+    size_t chunks = n / kMinChunkSize;
+    return max ( min ( chunks, (size_t) threads ), (size_t) 1 );
+}
 
-    auto range = equal_range ( _objects.begin(), _objects.end(), pKey, cmpfunc );
-    for ( auto it = range.first; it < range.second; it++ )
+void SSObjectArray::forChunks ( size_t n, size_t chunks, const function<void ( size_t chunk, size_t begin, size_t end )> &body )
+{
+    if ( chunks <= 1 )
     {
-        nfound++;
-        results.push_back ( *it );
+        body ( 0, 0, n );
+        return;
     }
 
-    return nfound;
+    SSThreadPool::shared().parallelFor ( 0, chunks, [&] ( size_t first, size_t last )
+    {
+        for ( size_t c = first; c < last; c++ )
+            body ( c, n * c / chunks, n * ( c + 1 ) / chunks );
+    }, 1 );
 }
 
-// Searches SSObjectArray for objects passing a caller-supplied test function (testfunc)
-// which returns true if the object passes, and false if the object does not.
-// SSObjectArray does not need to be sorted prior to search; this search() tests all objects.
-// Results are appended to vector (results); returns number of objects found.
+// Returns cosine of a cone search radius (radius); an object is inside the cone if the dot product of its
+// position unit vector and the cone's center unit vector exceeds this. Every position is inside a radius
+// of pi or more; none is inside a negative radius.
 
-int SSObjectArray::search ( bool (*testfunc) ( const SSObjectPtr &pObject ), vector<SSObjectPtr> &results )
+static double coneCosine ( SSAngle radius )
 {
-    int nfound = 0;
-    
-    for ( const SSObjectPtr &pObject : _objects )
-    {
-        if ( testfunc ( pObject ) )
-        {
-            nfound++;
-            results.push_back ( pObject );
-        }
-    }
-    
-    return nfound;
+    return radius < 0.0 ? INFINITY : radius < SSAngle::kPi ? cos ( radius ) : -INFINITY;
+}
+
+// Returns true if a star's fundamental position is inside a cone with center unit vector (c) and radius cosine (cosRad).
+
+static bool inCone ( SSStar *pStar, SSVector &c, double cosRad )
+{
+    SSVector pos = pStar->getFundamentalPosition();
+    return pos * c > cosRad && ! pos.isinf();
 }
 
 // Searches SSObjectArray for objects appearing within a circle of (radius) radians,
 // centered on the celestial sphere at unit direction vector (center) in the fundamental frame.
-// Indexes of found objects are appended to vector (results); returns number of objects found.
+// Indexes of found objects are appended to vector (results) in ascending order; returns number of objects found.
+// Uses the spatial index, if it has been built; see buildIndex().
 
 int SSObjectArray::search ( SSVector center, SSAngle radius, vector<size_t> &results )
 {
     int nfound = 0;
+    double cosRad = coneCosine ( radius );
+    center = center.normalize();
+    
+    if ( _indexed )
+    {
+        if ( cosRad == INFINITY || _index.empty() )
+            return 0;
+        
+        // Find the range of each coordinate of positions inside the cone, padded against rounding,
+        // to prune the k-d tree; then sort results into array order, as from a linear search.
+        
+        double c[3] = { center.x, center.y, center.z }, lo[3], hi[3];
+        for ( int axis = 0; axis < 3; axis++ )
+        {
+            double theta = acos ( min ( 1.0, max ( -1.0, c[axis] ) ) );
+            lo[axis] = cos ( min ( (double) SSAngle::kPi, theta + radius ) ) - 1.0e-9;
+            hi[axis] = cos ( max ( 0.0, theta - radius ) ) + 1.0e-9;
+        }
+        
+        size_t first = results.size();
+        searchIndexNode ( 0, _index.size(), 0, lo, hi, c, cosRad, results );
+        std::sort ( results.begin() + first, results.end() );
+        return (int) ( results.size() - first );
+    }
     
     for ( size_t index = 0; index < _objects.size(); index++ )
     {
         SSStar *pStar = SSGetStarPtr ( _objects[index] );
-        if ( pStar && center.angularSeparation ( pStar->getFundamentalPosition() ) < radius )
+        if ( pStar && inCone ( pStar, center, cosRad ) )
         {
             nfound++;
             results.push_back ( index );
@@ -255,43 +538,238 @@ int SSObjectArray::search ( SSVector center, SSAngle radius, vector<size_t> &res
     return nfound;
 }
 
-// Deletes objects in this SSObjectArray appearing within a circle of (radius) radians,
-// centered on the celestial sphere at unit direction vector (center) in the fundamental frame.
-// Returns number of objects deleted.
+// Spatial index k-d tree nodes with this many entries or fewer are searched linearly.
 
-int SSObjectArray::erase ( SSVector center, SSAngle radius )
+static constexpr size_t kIndexLeafSize = 8;
+
+// Builds spatial index. Each node of the k-d tree is a range of index entries from (begin) up to (but not including)
+// (end), whose middle entry splits the others on one coordinate axis (axis); children split on the next axis.
+
+void SSObjectArray::buildIndex ( void )
 {
-    int nfound = 0;
-    
+    _index.clear();
     for ( size_t index = 0; index < _objects.size(); index++ )
     {
         SSStar *pStar = SSGetStarPtr ( _objects[index] );
-        if ( pStar && center.angularSeparation ( pStar->getFundamentalPosition() ) < radius )
+        if ( pStar == nullptr )
+            continue;
+        
+        SSVector pos = pStar->getFundamentalPosition();
+        if ( ! pos.isinf() && ! pos.isnan() )
+            _index.push_back ( { { pos.x, pos.y, pos.z }, index } );
+    }
+    
+    buildIndexNode ( 0, _index.size(), 0 );
+    _indexed = true;
+}
+
+void SSObjectArray::buildIndexNode ( size_t begin, size_t end, int axis )
+{
+    if ( end - begin <= kIndexLeafSize )
+        return;
+    
+    size_t mid = begin + ( end - begin ) / 2;
+    nth_element ( _index.begin() + begin, _index.begin() + mid, _index.begin() + end,
+                  [axis] ( const IndexEntry &e1, const IndexEntry &e2 ) { return e1.pos[axis] < e2.pos[axis]; } );
+    
+    buildIndexNode ( begin, mid, ( axis + 1 ) % 3 );
+    buildIndexNode ( mid + 1, end, ( axis + 1 ) % 3 );
+}
+
+// Searches a k-d tree node for positions inside a cone with center unit vector (c) and radius cosine (cosRad),
+// visiting only children which may contain positions with coordinates from (lo) to (hi) on each axis.
+
+void SSObjectArray::searchIndexNode ( size_t begin, size_t end, int axis, const double lo[3], const double hi[3], const double c[3], double cosRad, vector<size_t> &results )
+{
+    if ( end - begin <= kIndexLeafSize )
+    {
+        for ( size_t i = begin; i < end; i++ )
         {
-            nfound++;
-            // cout << _objects[index]->toCSV() << endl;
-            delete _objects[index];
-            _objects.erase ( _objects.begin() + index );
+            const IndexEntry &e = _index[i];
+            if ( e.pos[0] * c[0] + e.pos[1] * c[1] + e.pos[2] * c[2] > cosRad )
+                results.push_back ( e.index );
         }
+        return;
     }
     
-    return nfound;
+    size_t mid = begin + ( end - begin ) / 2;
+    const IndexEntry &e = _index[mid];
+    
+    if ( lo[axis] <= e.pos[axis] )
+        searchIndexNode ( begin, mid, ( axis + 1 ) % 3, lo, hi, c, cosRad, results );
+    
+    if ( e.pos[0] * c[0] + e.pos[1] * c[1] + e.pos[2] * c[2] > cosRad )
+        results.push_back ( e.index );
+    
+    if ( hi[axis] >= e.pos[axis] )
+        searchIndexNode ( mid + 1, end, ( axis + 1 ) % 3, lo, hi, c, cosRad, results );
+}
+
+void SSObjectArray::computeEphemeris ( SSCoordinates &coords, const SSEphemerisOptions &options )
+{
+    vector<size_t> solar, fixed, secondaries, features;
+    map<string,SSPlanetPtr> planets;
+    
+    for ( size_t i = 0; i < _objects.size(); i++ )
+    {
+        SSObjectFamily family = SSGetObjectFamily ( _objects[i]->getType() );
+        if ( family == kFamilyPlanet )
+        {
+            solar.push_back ( i );
+            planets.insert ( { _objects[i]->getName ( 0 ), SSGetPlanetPtr ( _objects[i] ) } );
+        }
+        else if ( family == kFamilyFeature )
+        {
+            features.push_back ( i );
+        }
+        else if ( family == kFamilyStar || family == kFamilyDeepSky )
+        {
+            SSDoubleStarPtr pDouble = SSGetDoubleStarPtr ( _objects[i] );
+            if ( pDouble && pDouble->getPrimary() && pDouble->getPrimary() != pDouble )
+                secondaries.push_back ( i );
+            else
+                fixed.push_back ( i );
+        }
+        else if ( family != kFamilyCity )
+        {
+            fixed.push_back ( i );
+        }
+    }
+    
+    SSThreadPool &pool = options.pool ? *options.pool : SSThreadPool::shared();
+    auto compute = [this, &coords, &options, &pool] ( const vector<size_t> &indices )
+    {
+        if ( ! options.parallel )
+        {
+            for ( size_t i : indices )
+                _objects[i]->computeEphemeris ( coords );
+            return;
+        }
+        
+        pool.parallelFor ( 0, indices.size(), [this, &coords, &indices] ( size_t begin, size_t end )
+        {
+            SSCoordinates local = coords;
+            for ( size_t k = begin; k < end; k++ )
+                _objects[ indices[k] ]->computeEphemeris ( local );
+        } );
+    };
+    
+    compute ( solar );
+    compute ( fixed );
+    for ( size_t i : secondaries )
+        _objects[i]->computeEphemeris ( coords );
+    
+    if ( ! options.features )
+        return;
+    
+    auto computeFeatures = [this, &features, &planets] ( size_t begin, size_t end )
+    {
+        for ( size_t k = begin; k < end; k++ )
+        {
+            SSFeaturePtr pFeature = SSGetFeaturePtr ( _objects[ features[k] ] );
+            map<string,SSPlanetPtr>::iterator it = planets.find ( pFeature->getTarget() );
+            if ( it != planets.end() && it->second != nullptr )
+                pFeature->computeEphemeris ( it->second );
+        }
+    };
+    
+    if ( options.parallel )
+        pool.parallelFor ( 0, features.size(), computeFeatures );
+    else
+        computeFeatures ( 0, features.size() );
+}
+
+// Deletes objects at indexes in a vector (indexes), which must be in ascending order, in a single pass
+// over the array; repeated and out-of-range indexes are ignored. Returns number of objects deleted.
+
+int SSObjectArray::erase ( const vector<size_t> &indexes )
+{
+    size_t next = 0, kept = 0;
+    
+    for ( size_t index = 0; index < _objects.size(); index++ )
+    {
+        while ( next < indexes.size() && indexes[next] < index )
+            next++;
+        
+        if ( next < indexes.size() && indexes[next] == index )
+            delete _objects[index];
+        else
+            _objects[kept++] = _objects[index];
+    }
+    
+    int ndeleted = (int) ( _objects.size() - kept );
+    if ( ndeleted > 0 )
+    {
+        _objects.resize ( kept );
+        clearIndex();
+    }
+    
+    return ndeleted;
+}
+
+// Deletes objects in this SSObjectArray appearing within a circle of (radius) radians,
+// centered on the celestial sphere at unit direction vector (center) in the fundamental frame.
+// Returns number of objects deleted.
+
+int SSObjectArray::erase ( SSVector center, SSAngle radius )
+{
+    vector<size_t> indexes;
+    search ( center, radius, indexes );
+    return erase ( indexes );
 }
 
 // Deletes objects in this SSObjectArray appearing within a circle of (radius) radians,
-// centered on any star in another SSObjectArray (stars).
+// centered on any star in another SSObjectArray (stars), using crossMatch().
 // Returns number of objects deleted.
 
 int SSObjectArray::erase ( SSObjectVec &stars, SSAngle radius )
 {
-    int n = 0;
-    for ( SSObjectPtr pObject : stars._objects )
+    vector<Match> matches;
+    crossMatch ( stars, radius, matches );
+    
+    vector<size_t> indexes;
+    indexes.reserve ( matches.size() );
+    for ( const Match &match : matches )
+        indexes.push_back ( match.index );
+    
+    std::sort ( indexes.begin(), indexes.end() );
+    return erase ( indexes );
+}
+
+// Finds all pairs of stars in this array and another array (other) whose fundamental positions are less
+// than (radius) radians apart, using this array's spatial index, which is built if needed.
+// Matches are appended to vector (matches), ordered by index in other array, then index in this one;
+// returns number of matches found. Matching an array with itself includes each star paired with itself.
+
+int SSObjectArray::crossMatch ( SSObjectArray &other, SSAngle radius, vector<Match> &matches )
+{
+    if ( ! _indexed )
+        buildIndex();
+    
+    int nfound = 0;
+    vector<size_t> indexes;
+    
+    for ( size_t otherIndex = 0; otherIndex < other._objects.size(); otherIndex++ )
     {
-        SSStarPtr pStar = SSGetStarPtr ( pObject );
-        if ( pStar )
-            n += erase ( pStar->getFundamentalPosition(), radius );
+        SSStarPtr pOther = SSGetStarPtr ( other._objects[otherIndex] );
+        if ( pOther == nullptr )
+            continue;
+        
+        SSVector pos = pOther->getFundamentalPosition();
+        if ( pos.isinf() || pos.isnan() )
+            continue;
+        
+        indexes.clear();
+        search ( pos, radius, indexes );
+        for ( size_t index : indexes )
+        {
+            SSStarPtr pStar = static_cast<SSStarPtr> ( _objects[index] );    // only stars are indexed
+            matches.push_back ( { index, otherIndex, pos.angularSeparation ( pStar->getFundamentalPosition() ) } );
+            nfound++;
+        }
     }
-    return n;
+    
+    return nfound;
 }
 
 // Searches SSObjectArray for objects appearing within a circle of (radius) radians,
@@ -307,6 +785,99 @@ int SSObjectArray::search ( SSVector center, SSAngle radius, vector<SSObjectPtr>
     return nfound;
 }
 
+// Adds identifiers of objects from index (begin) to the end of the array to the identifier columns of their catalogs.
+// Objects are added in index order, so entries with equal identifiers stay in index order when the columns are sorted.
+
+void SSObjectArray::indexIdentifiers ( size_t begin )
+{
+    if ( _identCatalogs == 0 )
+        return;
+    
+    for ( size_t index = begin; index < _objects.size(); index++ )
+    {
+        SSObjectPtr pObj = _objects[index];
+        if ( pObj == nullptr )
+            continue;
+        
+        for ( SSIdentifier ident : pObj->getIdentifierSpan() )
+            if ( hasIdentifierColumn ( ident.catalog() ) )
+                _identIndex.insert ( { ident, index } );
+    }
+}
+
+void SSObjectArray::setIdentifierCatalogs ( const vector<SSCatalog> &cats )
+{
+    _identCatalogs = 0;
+    for ( SSCatalog cat : cats )
+        if ( cat > kCatUnknown && cat < 64 )
+            _identCatalogs |= (uint64_t) 1 << cat;
+    
+    _identIndex.clear();
+    indexIdentifiers ( 0 );
+    _identIndex.sort();
+    _identIndexed = true;
+}
+
+vector<SSCatalog> SSObjectArray::getIdentifierCatalogs ( void )
+{
+    vector<SSCatalog> cats;
+    for ( int cat = 1; cat < 64; cat++ )
+        if ( _identCatalogs >> cat & 1 )
+            cats.push_back ( static_cast<SSCatalog> ( cat ) );
+    
+    return cats;
+}
+
+// Searches for objects with an identifier (ident), rebuilding identifier columns first if the array has changed.
+// Indexes of found objects are appended to vector (results) in ascending order; returns number of objects found.
+
+int SSObjectArray::find ( SSIdentifier ident, vector<size_t> &results )
+{
+    size_t first = results.size();
+    
+    if ( hasIdentifierColumn ( ident.catalog() ) )
+    {
+        if ( ! _identIndexed )
+            setIdentifierCatalogs ( getIdentifierCatalogs() );
+        
+        auto range = _identIndex.equal_range ( ident );
+        for ( auto it = range.first; it != range.second; it++ )
+            if ( results.size() == first || results.back() != it->second )
+                results.push_back ( it->second );
+        
+        return (int) ( results.size() - first );
+    }
+    
+    for ( size_t index = 0; index < _objects.size(); index++ )
+    {
+        if ( _objects[index] == nullptr )
+            continue;
+        
+        for ( SSIdentifier other : _objects[index]->getIdentifierSpan() )
+        {
+            if ( other == ident )
+            {
+                results.push_back ( index );
+                break;
+            }
+        }
+    }
+    
+    return (int) ( results.size() - first );
+}
+
+SSObjectPtr SSObjectArray::find ( SSIdentifier ident )
+{
+    vector<size_t> indexes;
+    return find ( ident, indexes ) > 0 ? _objects[ indexes[0] ] : nullptr;
+}
+
+SSIdentifier SSObjectArray::crossIdentify ( SSIdentifier ident, SSCatalog cat )
+{
+    SSObjectPtr pObj = find ( ident );
+    return pObj ? pObj->getIdentifier ( cat ) : SSIdentifier();
+}
+
 // Given a vector of smart pointers to SSObject, creates a mapping of SSIdentifiers
 // in a particular catalog (cat) to index number within the vector.
 // Useful for fast object retrieval by identifier (see SSIdentifierToObject()).
@@ -380,18 +951,34 @@ SSObjectPtr SSNewObject ( SSObjectType type )
 
 SSObjectPtr SSCloneObject ( SSObject *pObj )
 {
-    if ( pObj )
-    {
-        SSObjectPtr pNewObj = SSNewObject ( pObj->getType() );
-        *pNewObj = *pObj;
-        
-        if ( SSGetDoubleStarPtr ( pNewObj ) )
-            SSGetDoubleStarPtr ( pNewObj )->cloneOrbit();
-        
-        return pNewObj;
-    }
+    if ( pObj == nullptr )
+        return nullptr;
     
-    return nullptr;
+    // Copy-construct the object's own class, most derived first, so derived class fields
+    // (orbits, TLEs, etc.) are copied too. Double stars' copy constructors clone their orbits.
+    
+    if ( SSDoubleVariableStar *p = dynamic_cast<SSDoubleVariableStar *> ( pObj ) )
+        return new SSDoubleVariableStar ( *p );
+    else if ( SSDoubleStar *p = dynamic_cast<SSDoubleStar *> ( pObj ) )
+        return new SSDoubleStar ( *p );
+    else if ( SSVariableStar *p = dynamic_cast<SSVariableStar *> ( pObj ) )
+        return new SSVariableStar ( *p );
+    else if ( SSDeepSky *p = dynamic_cast<SSDeepSky *> ( pObj ) )
+        return new SSDeepSky ( *p );
+    else if ( SSStar *p = dynamic_cast<SSStar *> ( pObj ) )
+        return new SSStar ( *p );
+    else if ( SSSatellite *p = dynamic_cast<SSSatellite *> ( pObj ) )
+        return new SSSatellite ( *p );
+    else if ( SSPlanet *p = dynamic_cast<SSPlanet *> ( pObj ) )
+        return new SSPlanet ( *p );
+    else if ( SSCity *p = dynamic_cast<SSCity *> ( pObj ) )
+        return new SSCity ( *p );
+    else if ( SSFeature *p = dynamic_cast<SSFeature *> ( pObj ) )
+        return new SSFeature ( *p );
+    else if ( SSConstellation *p = dynamic_cast<SSConstellation *> ( pObj ) )
+        return new SSConstellation ( *p );
+    else
+        return new SSObject ( *pObj );
 }
 
 // Exports a vector of objects to a CSV-formatted text file.
@@ -403,72 +990,137 @@ SSObjectPtr SSCloneObject ( SSObject *pObj )
 
 int SSExportObjectsToCSV ( const string &filename, SSObjectVec &objects, SSObjectFilter filter, void *userData )
 {
-    int i = 0;
-    
-    // If filename is empty, just stream everything to stdout
-    
-    if ( filename.empty() )
-    {
-        for ( i = 0; i < objects.size(); i++ )
-            cout << objects[i]->toCSV() << endl;
-        
-        return i;
-    }
-
+    // If filename is empty, just stream everything to stdout.
     // Otherwise open file, overwriting existing content; return on failure.
 
-    ofstream file ( filename, ios::trunc );
-    if ( ! file )
-        return 0;
+    FILE *file = stdout;
+    if ( ! filename.empty() )
+    {
+        file = fopen ( filename.c_str(), "w" );
+        if ( file == nullptr )
+            return 0;
+    }
+    else
+    {
+        cout.flush();
+    }
+    
+    // Append lines for objects which pass filter function to one reused buffer,
+    // and write it to the file whenever it holds a megabyte or more.
     
-    // Stream objects which pass filter function to CSV file.
+    const size_t kBlockSize = 1 << 20;
+    string buffer;
+    buffer.reserve ( kBlockSize + 4096 );
     
     int n = 0;
-    for ( i = 0; i < objects.size(); i++ )
+    for ( size_t i = 0; i < objects.size(); i++ )
     {
         if ( filter == nullptr || filter ( objects[i], userData ) )
         {
-            file << objects[i]->toCSV() << endl;
+            objects[i]->appendCSV ( buffer );
+            buffer += '\n';
             n++;
         }
+        
+        if ( buffer.size() >= kBlockSize )
+        {
+            fwrite ( buffer.data(), 1, buffer.size(), file );
+            buffer.clear();
+        }
     }
     
-    // Return exported object count; file will close automatically.
+    fwrite ( buffer.data(), 1, buffer.size(), file );
+    
+    // Return exported object count.
+    
+    if ( file == stdout )
+        fflush ( file );
+    else
+        fclose ( file );
     
     return n;
 }
 
-// Imports objects from CSV-formatted text file (filename).
-// Imported objects are appended to the input vector of SSObjects (objects).
-// If a non-null filter function (filter) is provided, objects are imported
-// only if they pass the filter; optional data pointer (userData) is passed
-// to the filter but not used otherwise.
-// Function returns number of objects successfully imported.
+// Returns table of CSV importers keyed by type code, with built-in importers registered on first use.
+// Function-local so that importers can be registered safely from other files' static initializers.
 
-int SSImportObjectsFromCSV ( const string &filename, SSObjectVec &objects, SSObjectFilter filter, void *userData )
+typedef map<string,SSCSVImporter> SSCSVImporterMap;
+
+static SSCSVImporterMap &csv_importers ( void )
 {
-    // Open file; return on failure.
+    static SSCSVImporterMap importers =
+    {
+        { "NO", SSStar::fromCSV },
+        { "PL", SSPlanet::fromCSV },
+        { "MN", SSPlanet::fromCSV },
+        { "AS", SSPlanet::fromCSV },
+        { "CM", SSPlanet::fromCSV },
+        { "FT", SSFeature::fromCSV },
+        { "CT", SSFeature::fromCSV },
+        { "SS", SSStar::fromCSV },
+        { "DS", SSStar::fromCSV },
+        { "VS", SSStar::fromCSV },
+        { "DV", SSStar::fromCSV },
+        { "OC", SSStar::fromCSV },
+        { "GC", SSStar::fromCSV },
+        { "BN", SSStar::fromCSV },
+        { "DN", SSStar::fromCSV },
+        { "PN", SSStar::fromCSV },
+        { "GX", SSStar::fromCSV },
+        { "CN", SSConstellation::fromCSV },
+        { "AM", SSConstellation::fromCSV }
+    };
+    
+    return importers;
+}
 
-    FILE *file = fopen ( filename.c_str(), "rb" );
-    if ( ! file )
-        return 0;
+void SSRegisterCSVImporter ( const string &code, SSCSVImporter importer )
+{
+    if ( importer == nullptr )
+        csv_importers().erase ( code );
+    else
+        csv_importers()[ code ] = importer;
+}
+
+SSCSVImporter SSGetCSVImporter ( const string &code )
+{
+    SSCSVImporterMap &importers = csv_importers();
+    auto it = importers.find ( code );
+    if ( it == importers.end() )
+        it = importers.find ( "NO" );
+    
+    return it == importers.end() ? nullptr : it->second;
+}
 
-    // Read file line-by-line until we reach end-of-file
+// Imports objects from lines of CSV text read from (file), and appends them to (objects)
+// if they pass (filter). Returns number of objects imported.
 
-    string line = "";
+static int import_csv_lines ( SSLineReader &file, SSObjectVec &objects, SSObjectFilter filter, void *userData )
+{
+    // Read file line-by-line until we reach end-of-file.
+    // Each line is split into fields once; the field buffers are reused for every line.
+    // Consecutive lines usually have the same type code, so the last importer is cached.
+
+    SSSpan<char> line;
+    SSCSVFields fields;
+    string code, lastCode;
+    SSCSVImporter importer = nullptr;
     int numObjects = 0;
+    SSObjectArena::Scope scope ( objects.getArena() );
 
-    while ( fgetline ( file, line ) )
+    while ( file.getline ( line ) )
     {
-        // Attempt to create object from CSV file line
+        // Look up importer for this line's type code, then attempt to create object from it
         
-        SSObjectPtr pObject = SSPlanet::fromCSV ( line );
-        if ( pObject == nullptr )
-            pObject = SSStar::fromCSV ( line );
-        if ( pObject == nullptr )
-            pObject = SSFeature::fromCSV ( line );
-        if ( pObject == nullptr )
-            pObject = SSConstellation::fromCSV ( line );
+        fields.split ( line );
+        code = fields.str ( 0 );
+        if ( importer == nullptr || code != lastCode )
+        {
+            importer = SSGetCSVImporter ( code );
+            lastCode = code;
+        }
+        
+        SSObjectPtr pObject = importer ? importer ( fields ) : nullptr;
 
         // if successful, and object passes filter, add it to object vector.
             
@@ -477,10 +1129,126 @@ int SSImportObjectsFromCSV ( const string &filename, SSObjectVec &objects, SSObj
             objects.append ( pObject );
             numObjects++;
         }
+        else
+        {
+            delete pObject;
+        }
     }
     
-    // Close file. Return number of objects added to object vector.
+    return numObjects;
+}
 
-    fclose ( file );
+#if USE_THREADS
+
+// Imports objects from memory-mapped CSV text (data) of (size) bytes, split into (threads) chunks
+// which end on line boundaries, parsed concurrently. Objects are appended to (objects) in file order.
+
+static int import_csv_chunks ( const char *data, size_t size, SSObjectVec &objects, SSObjectFilter filter, void *userData, int threads )
+{
+    vector<size_t> bounds ( threads + 1 );
+    bounds[0] = 0;
+    bounds[threads] = size;
+    for ( int t = 1; t < threads; t++ )
+    {
+        size_t pos = max ( bounds[t - 1], size / threads * t );
+        const char *lf = (const char *) memchr ( data + pos, '\n', size - pos );
+        bounds[t] = lf ? lf - data + 1 : size;
+    }
+    
+    // If the output array has an arena, give each chunk an arena of its own, since arenas can't be shared by threads.
+    
+    SSObjectArena *arena = objects.getArena();
+    vector<unique_ptr<SSObjectArray>> chunks;
+    for ( int t = 0; t < threads; t++ )
+        chunks.push_back ( unique_ptr<SSObjectArray> ( arena ? new SSObjectArray ( arena->getSlabSize() ) : new SSObjectArray() ) );
+    
+    auto work = [&] ( int t )
+    {
+        SSLineReader reader;
+        reader.open ( data + bounds[t], bounds[t + 1] - bounds[t] );
+        import_csv_lines ( reader, *chunks[t], filter, userData );
+    };
+    
+    vector<thread> workers;
+    for ( int t = 1; t < threads; t++ )
+        workers.push_back ( thread ( work, t ) );
+    
+    work ( 0 );
+    
+    for ( thread &worker : workers )
+        worker.join();
+    
+    // Splice each chunk's objects (and arenas) onto the output in file order; chunks then no longer own them.
+    
+    int numObjects = 0;
+    for ( unique_ptr<SSObjectArray> &chunk : chunks )
+    {
+        numObjects += (int) chunk->size();
+        objects.splice ( *chunk );
+    }
+    
     return numObjects;
 }
+
+#endif
+
+// Imports objects from CSV-formatted text file (filename).
+// Imported objects are appended to the input vector of SSObjects (objects).
+// If a non-null filter function (filter) is provided, objects are imported
+// only if they pass the filter; optional data pointer (userData) is passed
+// to the filter but not used otherwise.
+// If (threads) is not 1, a memory-mapped file is divided into chunks on line boundaries, parsed on up to that many
+// threads (if zero or negative, one per processor core), and objects are appended in file order, as with one thread.
+// The filter is then called concurrently from several threads, each with objects from a different part of the file,
+// so it must be thread-safe, e.g. by only reading the object and (userData). CSV importers must not be registered
+// or removed during the import. Files which cannot be memory-mapped, or are small, are read on the calling thread.
+// Function returns number of objects successfully imported.
+
+int SSImportObjectsFromCSV ( const string &filename, SSObjectVec &objects, SSObjectFilter filter, void *userData, int threads )
+{
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+    
+    if ( threads > 1 )
+    {
+        size_t size = 0;
+        const char *data = (const char *) mapfile ( filename, size );
+        if ( data != nullptr )
+        {
+            // Decompress a gzip-compressed file into memory, then parse it in chunks like an uncompressed one.
+            // Don't divide the file into chunks smaller than a megabyte; starting threads would take longer than parsing.
+            
+            vector<char> text;
+            const char *mapped = data;
+            if ( SSGzipReader::isGzip ( mapped, size ) )
+            {
+                bool ok = SSGzipReader::gunzip ( mapped, size, text );
+                unmapfile ( mapped, size );
+                if ( ! ok )
+                    return 0;
+                
+                mapped = nullptr;
+                data = text.data();
+                size = text.size();
+            }
+            
+            threads = (int) min ( (size_t) threads, size / ( 1 << 20 ) + 1 );
+            int numObjects = import_csv_chunks ( data, size, objects, filter, userData, threads );
+            if ( mapped != nullptr )
+                unmapfile ( mapped, size );
+            return numObjects;
+        }
+    }
+#endif
+    
+    // Open file; return on failure.
+
+    SSLineReader file ( filename );
+    if ( ! file )
+        return 0;
+
+    // Return number of objects added to object vector. File will close automatically.
+
+    return import_csv_lines ( file, objects, filter, userData );
+}
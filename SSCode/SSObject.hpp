@@ -14,6 +14,7 @@
 #include <math.h>
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -22,10 +23,74 @@
 
 #include "SSCoordinates.hpp"
 #include "SSIdentifier.hpp"
+#include "SSStringPool.hpp"
+
+// Object classes are naturally aligned, with the fields used when scanning many objects (type, magnitude,
+// direction, and distance) together at the front. Define SS_PACKED_OBJECTS as 1 to restore the older
+// byte-packed layout and field order of SSObject, SSStar, and SSFeature, for code which depends on it.
+
+#ifndef SS_PACKED_OBJECTS
+#define SS_PACKED_OBJECTS 0
+#endif
 
 using namespace std;
 
+#if SS_PACKED_OBJECTS
 #pragma pack ( push, 1 )
+#endif
+
+// This class allocates memory for objects in large slabs, so that catalogs of many objects can be created and
+// released without one heap allocation per object. While an arena is current on a thread (see Scope), new objects
+// created on that thread are placed in it. Deleting an object still runs its destructor, but its memory is only
+// released when the arena is reset or destroyed, which must not happen until all of its objects are deleted.
+// An arena must only be used by one thread at a time. Usually arenas are owned by an SSObjectArray.
+// Deleting any object, and getOwner(), must find which arena's slab holds it under one global lock. Objects whose
+// addresses lie outside all slabs skip that lock, but heap objects allocated between slabs don't, so threads deleting
+// many objects while arenas exist can contend on it.
+
+class SSObjectArena
+{
+protected:
+    vector<char *> _slabs;          // memory slabs, in allocation order
+    size_t _slabSize;               // size of each slab in bytes
+    size_t _used;                   // bytes used in last slab
+    size_t _bytes;                  // heap memory taken by all slabs, including allocator overhead
+    
+    static thread_local SSObjectArena *_current;
+
+public:
+    static constexpr size_t kDefaultSlabSize = 1 << 20;
+    
+    SSObjectArena ( size_t slabSize = kDefaultSlabSize );
+    SSObjectArena ( const SSObjectArena &other ) = delete;
+    SSObjectArena &operator = ( const SSObjectArena &other ) = delete;
+    ~SSObjectArena ( void ) { reset(); }
+    
+    void *allocate ( size_t size );
+    void reset ( void );
+    size_t getSlabSize ( void ) { return _slabSize; }
+    size_t getNumSlabs ( void ) { return _slabs.size(); }
+    size_t memoryUsage ( void ) { return _bytes + vecbytes ( _slabs ); }
+
+    // Returns or sets the current arena for this thread; nullptr means objects are allocated on the heap.
+    // setCurrent() returns the previous current arena.
+    
+    static SSObjectArena *getCurrent ( void ) { return _current; }
+    static SSObjectArena *setCurrent ( SSObjectArena *arena ) { SSObjectArena *prev = _current; _current = arena; return prev; }
+    
+    // Returns the arena which owns an object, or nullptr if the object was allocated on the heap.
+    
+    static SSObjectArena *getOwner ( const class SSObject *pObject );
+    
+    // Makes an arena current on this thread until the scope object is destroyed.
+    
+    struct Scope
+    {
+        SSObjectArena *prev;
+        Scope ( SSObjectArena *arena ) { prev = setCurrent ( arena ); }
+        ~Scope ( void ) { setCurrent ( prev ); }
+    };
+};
 
 // This is the base class for all astronomical objects (planets, stars, deep sky objects, constellations, etc.)
 
@@ -33,12 +98,21 @@ class SSObject
 {
 protected:
     
+#if SS_PACKED_OBJECTS
     SSObjectType    _type;          // object type code
-    vector<string>  _names;         // vector of name string(s)
+    vector<SSIString> _names;       // vector of name string(s), interned in global string pool
     string          _description;   // plain-text object description (may be empty)
     SSVector        _direction;     // apparent direction to object as unit vector in fundamental reference frame; infinite if unknown
     double          _distance;      // distance to object in AU; infinite if unknown
     float           _magnitude;     // visual magnitude; infinite if unknown
+#else
+    SSObjectType    _type;          // object type code
+    float           _magnitude;     // visual magnitude; infinite if unknown
+    SSVector        _direction;     // apparent direction to object as unit vector in fundamental reference frame; infinite if unknown
+    double          _distance;      // distance to object in AU; infinite if unknown
+    vector<SSIString> _names;       // vector of name string(s), interned in global string pool
+    string          _description;   // plain-text object description (may be empty)
+#endif
     
 public:
 
@@ -48,10 +122,17 @@ public:
     SSObject ( SSObjectType type );
     virtual ~SSObject ( void ) {}   // test code: { cout << "~SSObject" << endl; }
 
+    // Objects are allocated in the current SSObjectArena, if any, or on the heap.
+    
+    static void *operator new ( size_t size );
+    static void operator delete ( void *ptr );
+
     // accessors
     
     SSObjectType getType ( void ) { return _type; }
-    vector<string> getNames ( void ) { return _names; }
+    vector<string> getNames ( void ) { return vector<string> ( _names.begin(), _names.end() ); }
+    const vector<SSIString> &getInternedNames ( void ) { return _names; }
+    int getNumNames ( void ) { return (int) _names.size(); }
     string getDescription ( void ) { return _description; }
     SSVector getDirection ( void ) { return _direction; }
     double getDistance ( void ) { return _distance; }
@@ -60,7 +141,9 @@ public:
     // modifiers. setType() with caution; _type is used to determine object class.
     
     void setType ( SSObjectType type ) { _type = type; }
-    void setNames ( const vector<string> &names ) { _names = names; }
+    void setNames ( const vector<string> &names ) { _names.assign ( names.begin(), names.end() ); }
+    void setInternedNames ( const vector<SSIString> &names ) { _names = names; }
+    void setInternedNames ( vector<SSIString> &&names ) { _names = move ( names ); }
     void setDescription ( const string &desc ) { _description = desc; }
     void setDirection ( SSVector dir ) { _direction = dir; }
     void setDistance ( double dist ) { _distance = dist; }
@@ -78,6 +161,7 @@ public:
     virtual SSIdentifier getIdentifier ( SSCatalog cat );       // returns identifier in the specified catalog, or null identifier if object has none in that catalog.
     virtual bool addIdentifier ( SSIdentifier ident );          // adds the specified identifier to the object, only if the ident is valid and not already present.
     virtual vector<SSIdentifier> getIdentifiers ( void );       // returns vector of all object identifiers
+    virtual SSSpan<SSIdentifier> getIdentifierSpan ( void );    // returns view of all object identifiers without copying them; valid until identifiers change
     SSAngle angularSeparation ( SSObject &other ) { return _direction.angularSeparation ( other._direction ); }
     
     // Convenience methods for testing whether an object is the Sun/Moon/Earth; overridden by subclass SSPlanet
@@ -92,40 +176,279 @@ public:
     virtual void computePositionVelocity ( SSCoordinates &coords, SSVector &pos, SSVector &vel ) {};    // computes heliocentric position and velocity at the time in the given coordinates object.
     virtual SSSpherical computeApparentMotion ( SSCoordinates &coords, SSFrame frame = kFundamental );  // computes object's apparent motion in the specified reference frame.
     
+    // Returns object data as a line of CSV text, or appends it to a string (csv) without constructing a temporary string.
+    
     virtual string toCSV ( void );
+    virtual void appendCSV ( string &csv );
+    
+    // Memory accounting: sizeOf() returns the size of the object's most-derived class, so every subclass overrides it.
+    // heapBytes() returns heap memory owned by the object - its name vector, description, identifier vector, etc. -
+    // including allocator overhead. Interned strings are shared, so they're counted by their SSStringPool, not here.
+    
+    virtual size_t sizeOf ( void ) { return sizeof ( SSObject ); }
+    virtual size_t heapBytes ( void ) { return vecbytes ( _names ) + strbytes ( _description ); }
 };
 
 typedef SSObject *SSObjectPtr;
 
+// Class families of object types. An object's type determines its class (see SSNewObject()), so downcasts
+// like SSGetStarPtr() check the family of the object's type instead of using RTTI. Where the class can still vary
+// within a type - nonexistent objects, satellites (which may be plain SSPlanets), double and variable stars -
+// downcasts fall back to dynamic_cast, but only after the type check.
+
+enum SSObjectFamily
+{
+    kFamilyUnknown = 0,         // nonexistent or unrecognized type; class is not known from type
+    kFamilyPlanet = 1,          // SSPlanet or subclass
+    kFamilyFeature = 2,         // SSFeature
+    kFamilyCity = 3,            // SSCity
+    kFamilyStar = 4,            // SSStar or subclass other than SSDeepSky
+    kFamilyDeepSky = 5,         // SSDeepSky
+    kFamilyConstellation = 6    // SSConstellation
+};
+
+constexpr SSObjectFamily kObjectTypeFamilies[32] =
+{
+    kFamilyUnknown, kFamilyPlanet, kFamilyPlanet, kFamilyPlanet, kFamilyPlanet, kFamilyPlanet, kFamilyPlanet, kFamilyFeature,             // 0-7
+    kFamilyCity, kFamilyUnknown, kFamilyStar, kFamilyUnknown, kFamilyStar, kFamilyStar, kFamilyStar, kFamilyUnknown,                      // 8-15
+    kFamilyUnknown, kFamilyUnknown, kFamilyUnknown, kFamilyUnknown, kFamilyDeepSky, kFamilyDeepSky, kFamilyDeepSky, kFamilyDeepSky,       // 16-23
+    kFamilyDeepSky, kFamilyDeepSky, kFamilyUnknown, kFamilyUnknown, kFamilyUnknown, kFamilyUnknown, kFamilyConstellation, kFamilyConstellation  // 24-31
+};
+
+constexpr SSObjectFamily SSGetObjectFamily ( SSObjectType type ) { return type >= 0 && type < 32 ? kObjectTypeFamilies[type] : kFamilyUnknown; }
+
+class SSThreadPool;
+
+// Options for SSObjectArray::computeEphemeris(): whether to compute objects in parallel, on which thread pool
+// (nullptr for the shared pool), and whether to compute surface features on planets in the same array.
+
+struct SSEphemerisOptions
+{
+    bool parallel = true;
+    SSThreadPool *pool = nullptr;
+    bool features = true;
+};
+
 // This class stores a vector of pointers to SSObject, and deletes them when class instance is destroyed.
+// An array constructed with an arena slab size owns an SSObjectArena; objects imported into it with
+// SSImportObjectsFromCSV(), or created while its arena is current, are placed in that arena's slabs,
+// and all of their memory is released at once when the array is erased or destroyed. Objects owned by
+// another array's arena can't be added to an array (set, append, and insert refuse them); copy them
+// with SSCloneObject() instead, or move all of another array's objects and arenas with splice().
+// An array can also build a spatial index of its objects' positions, to speed up cone searches; see buildIndex().
+// It can also keep identifier columns for some catalogs, to look objects up by identifier; see setIdentifierCatalogs().
 
 class SSObjectArray
 {
 protected:
+    struct IndexEntry
+    {
+        double pos[3];                              // object's fundamental position unit vector
+        size_t index;                               // object's index in array
+    };
+
     vector<SSObjectPtr> _objects;
+    vector<unique_ptr<SSObjectArena>> _arenas;    // arenas owning this array's objects; first is used for new objects
+    vector<IndexEntry> _index;                      // spatial index: k-d tree of object positions, in tree order
+    bool _indexed = false;                          // true if spatial index was built and array has not changed since
+    uint64_t _identCatalogs = 0;                    // bit mask of catalogs with identifier columns; zero if none
+    SSFlatMap<SSIdentifier,size_t,true> _identIndex;    // identifier columns: (identifier, index) pairs in those catalogs
+    bool _identIndexed = true;                      // true if identifier columns are up to date with array
+
+    bool canAdd ( SSObjectPtr pObj );
+    void indexIdentifiers ( size_t begin );
+    bool hasIdentifierColumn ( SSCatalog cat ) { return cat > kCatUnknown && cat < 64 && ( _identCatalogs >> cat & 1 ); }
+
+    // Returns the number of chunks to divide (n) items among for (threads) threads; at least one, and fewer for small (n).
+    // forChunks() calls (body) with each chunk's index, first item, and one past its last, in parallel on the shared pool.
+
+    static size_t chunkCount ( size_t n, int threads );
+    static void forChunks ( size_t n, size_t chunks, const function<void ( size_t chunk, size_t begin, size_t end )> &body );
+
+    // Sorts a vector (v) with comparison function (cmp) in (threads) chunks, then merges chunks in pairs, all in parallel.
+
+    template<class T, class Compare> static void sortVector ( vector<T> &v, Compare cmp, int threads )
+    {
+        size_t n = v.size(), chunks = chunkCount ( n, threads );
+        forChunks ( n, chunks, [&] ( size_t chunk, size_t begin, size_t end )
+        {
+            std::sort ( v.begin() + begin, v.begin() + end, cmp );
+        } );
+
+        for ( size_t width = 1; width < chunks; width *= 2 )
+        {
+            size_t merges = ( chunks + 2 * width - 1 ) / ( 2 * width );
+            forChunks ( merges, merges, [&] ( size_t m, size_t, size_t )
+            {
+                size_t lo = 2 * m * width, mid = min ( lo + width, chunks ), hi = min ( lo + 2 * width, chunks );
+                std::inplace_merge ( v.begin() + n * lo / chunks, v.begin() + n * mid / chunks, v.begin() + n * hi / chunks, cmp );
+            } );
+        }
+    }
+    void buildIndexNode ( size_t begin, size_t end, int axis );
+    void searchIndexNode ( size_t begin, size_t end, int axis, const double lo[3], const double hi[3], const double c[3], double cosRad, vector<size_t> &results );
 
 public:
+    SSObjectArray ( void ) {}
+    SSObjectArray ( size_t arenaSlabSize ) { _arenas.push_back ( unique_ptr<SSObjectArena> ( new SSObjectArena ( arenaSlabSize ) ) ); }
     ~SSObjectArray ( void ) { for ( SSObjectPtr pObj : _objects ) delete pObj; }
     SSObjectPtr get ( size_t index ) { return index >= 0 && index < size() ? _objects.at ( index ) : nullptr; }
     SSObjectPtr set ( size_t index, SSObjectPtr pObj );
     SSObjectPtr operator [] ( size_t index ) { return get ( index ); }
-    void append ( SSObjectPtr pObj ) { _objects.push_back ( pObj ); }
-    void insert ( SSObjectPtr pObj, size_t index ) { _objects.insert ( _objects.begin() + index, pObj ); }
-    void remove ( size_t index ) { _objects.erase ( _objects.begin() + index ); }   // DOES NOT actually delete object!!!
+    bool append ( SSObjectPtr pObj );
+    bool insert ( SSObjectPtr pObj, size_t index ) { if ( ! canAdd ( pObj ) ) return false; _objects.insert ( _objects.begin() + index, pObj ); clearIndex(); return true; }
+    void remove ( size_t index ) { _objects.erase ( _objects.begin() + index ); clearIndex(); }   // DOES NOT actually delete object!!!
     size_t size ( void ) { return _objects.size(); }
-    void clear ( void ) { _objects.clear(); }   // empties object vector but DOES NOT delete individual objects!!!
-    void erase ( void ) { for ( SSObjectPtr pObj : _objects ) delete pObj; clear(); }   // deletes all objects AND clears vector.
-    void sort ( bool (*cmpfunc) ( const SSObjectPtr &p1, const SSObjectPtr &p2 ) ) { std::sort ( _objects.begin(), _objects.end(), cmpfunc ); }
-    int search ( const SSObjectPtr &pKey, bool (*cmpfunc) ( const SSObjectPtr &p1, const SSObjectPtr &p2 ), vector<SSObjectPtr> &results );
-    int search ( bool (*testfunc) ( const SSObjectPtr &pObject ), vector<SSObjectPtr> &results );
+    void clear ( void ) { _objects.clear(); clearIndex(); }   // empties object vector but DOES NOT delete individual objects!!!
+    void erase ( void );                        // deletes all objects AND clears vector, and releases arena memory.
+    void splice ( SSObjectArray &other );       // moves all objects and arenas from other array to the end of this one.
+    SSObjectArena *getArena ( void ) { return _arenas.empty() ? nullptr : _arenas.front().get(); }
+    
+    // Returns live memory used by this array in bytes: the array itself, its object pointer vector, spatial index,
+    // arenas' slabs, and every object with the heap blocks it owns, including allocator and container overhead.
+    // Objects in arenas are counted in their slabs; objects on the heap are counted individually.
+    
+    size_t memoryUsage ( void );
+
+    // Sorts this array with a comparison function (cmp), which may be any callable - a function pointer, or a lambda
+    // with captures - returning true if its first object is less than its second; comparisons are inlined when possible.
+
+    template<class Compare> void sort ( Compare cmp ) { std::sort ( _objects.begin(), _objects.end(), cmp ); clearIndex(); }
+
+    // As above, but sorts on (threads) threads of the shared thread pool (zero or negative means one per processor core):
+    // each thread sorts a chunk of the array, then chunks are merged in pairs, also in parallel. Objects which compare
+    // equal may end up in a different order than sort() leaves them.
+
+    template<class Compare> void parallelSort ( Compare cmp, int threads = 0 ) { sortVector ( _objects, cmp, threads ); clearIndex(); }
+
+    // Sorts this array in ascending order of a key (key) extracted from each object by a callable, e.g. a lambda
+    // returning its magnitude. Keys are extracted once per object, in parallel on (threads) threads as above, and
+    // (key, index) pairs are sorted, so comparisons never dereference objects. The key type must have operator <.
+    // Objects with equal keys keep their original order, so results are the same for any number of threads.
+
+    template<class Key> void sortByKey ( Key key, int threads = 1 )
+    {
+        typedef typename decay<decltype ( key ( _objects[0] ) )>::type KeyType;
+        size_t n = _objects.size();
+        vector<pair<KeyType,size_t>> keys ( n );
+        forChunks ( n, chunkCount ( n, threads ), [&] ( size_t chunk, size_t begin, size_t end )
+        {
+            for ( size_t i = begin; i < end; i++ )
+                keys[i] = make_pair ( key ( _objects[i] ), i );
+        } );
+
+        sortVector ( keys, less<pair<KeyType,size_t>>(), threads );
+        vector<SSObjectPtr> sorted ( n );
+        for ( size_t i = 0; i < n; i++ )
+            sorted[i] = _objects[ keys[i].second ];
+        _objects.swap ( sorted );
+        clearIndex();
+    }
+
+    // Binary-searches this array for objects matching (pKey) using comparison function (cmp), which must be the one
+    // the array was sorted with. Results are appended to (results); returns number of objects found.
+
+    template<class Compare> int search ( const SSObjectPtr &pKey, Compare cmp, vector<SSObjectPtr> &results )
+    {
+        auto range = equal_range ( _objects.begin(), _objects.end(), pKey, cmp );
+        results.insert ( results.end(), range.first, range.second );
+        return (int) ( range.second - range.first );
+    }
+
+    // Tests every object with a callable (test) which returns true if the object passes; the array need not be sorted.
+    // Objects which pass are appended to (results) in array order; returns number of objects found.
+
+    template<class Test> int search ( Test test, vector<SSObjectPtr> &results )
+    {
+        size_t first = results.size();
+        for ( const SSObjectPtr &pObject : _objects )
+            if ( test ( pObject ) )
+                results.push_back ( pObject );
+        return (int) ( results.size() - first );
+    }
+
+    // As above, but tests chunks of the array on (threads) threads of the shared thread pool (zero or negative means
+    // one per processor core), each into its own result vector; these are appended to (results) in array order,
+    // so results are the same as search(). The test must be safe to call concurrently.
+
+    template<class Test> int filter ( Test test, vector<SSObjectPtr> &results, int threads = 0 )
+    {
+        size_t n = _objects.size(), chunks = chunkCount ( n, threads );
+        vector<vector<SSObjectPtr>> chunkResults ( chunks );
+        forChunks ( n, chunks, [&] ( size_t chunk, size_t begin, size_t end )
+        {
+            for ( size_t i = begin; i < end; i++ )
+                if ( test ( _objects[i] ) )
+                    chunkResults[chunk].push_back ( _objects[i] );
+        } );
+
+        size_t first = results.size();
+        for ( vector<SSObjectPtr> &chunk : chunkResults )
+            results.insert ( results.end(), chunk.begin(), chunk.end() );
+        return (int) ( results.size() - first );
+    }
+
     int search ( SSVector center, SSAngle rad, vector<SSObjectPtr> &results );
     int search ( SSVector center, SSAngle rad, vector<size_t> &results );
     int erase ( SSVector center, SSAngle rad );
     int erase ( SSObjectArray &stars, SSAngle rad );
+    int erase ( const vector<size_t> &indexes );
+
+    // A pair of stars found by crossMatch(): indexes in this array and the other array, and their angular separation.
+
+    struct Match
+    {
+        size_t index;           // index of star in this array
+        size_t otherIndex;      // index of star in other array
+        SSAngle separation;     // angular separation of stars' fundamental positions, in radians
+    };
+
+    int crossMatch ( SSObjectArray &other, SSAngle rad, vector<Match> &matches );
+
+    // Builds a spatial index of the fundamental positions of all stars (and other objects stored as SSStars)
+    // in this array, so that cone searches with search ( center, rad, results ) take O(log N + k) time instead of
+    // testing every object. Results are the same, in the same order. Any change to the array through its own methods
+    // discards the index; so does clearIndex(). Changing an indexed object's position does not, so rebuild it then.
+
+    void buildIndex ( void );
+    void clearIndex ( void ) { _index.clear(); _indexed = false; _identIndex.clear(); _identIndexed = _objects.empty(); }
+    bool hasIndex ( void ) { return _indexed; }
+
+    // Keeps identifier columns for catalogs (cats) - by default, the star catalogs most often looked up by number - so
+    // find() and crossIdentify() are binary searches instead of scanning every object's identifiers. The columns hold
+    // (identifier, index) pairs for all of the objects' identifiers in those catalogs, sorted by identifier. Call this
+    // before loading objects: append() and splice() add new objects to the columns as they're loaded. Any other change
+    // to the array through its own methods, or clearIndex(), discards the columns, and the next lookup rebuilds them;
+    // so look one up once before looking up concurrently from several threads, as with SSFlatMap. Changing an object's
+    // identifiers does not discard them, so call this again then. An empty vector removes all identifier columns.
+
+    void setIdentifierCatalogs ( const vector<SSCatalog> &cats = { kCatHIP, kCatHD, kCatHR, kCatSAO, kCatTYC, kCatGCVS } );
+    vector<SSCatalog> getIdentifierCatalogs ( void );
+
+    // Returns the first object in this array with identifier (ident), or nullptr if none. The second version appends
+    // indexes of all objects with that identifier to (results) in ascending order, and returns how many it found.
+    // Both use the identifier column of ident's catalog, if kept; otherwise they test every object.
+
+    SSObjectPtr find ( SSIdentifier ident );
+    int find ( SSIdentifier ident, vector<size_t> &results );
+
+    // Returns the identifier in catalog (cat) of the first object with identifier (ident), e.g. the HD number
+    // of HIP 32349; or a null identifier if there is no such object, or it has no identifier in that catalog.
+
+    SSIdentifier crossIdentify ( SSIdentifier ident, SSCatalog cat );
+
+    // Computes apparent direction, distance, and magnitude of every object in this array at the time and observer location
+    // in (coords), with bit-identical results whether or not computed in parallel (options). Solar system objects, then stars
+    // and deep sky objects, are each divided among threads, every chunk with its own copy of (coords); double stars with a
+    // primary, which also compute their primary, are computed afterwards on the calling thread. Finally, surface features are
+    // computed on planets in this array whose name matches their target, if (options) says so; otherwise they are unchanged.
+    // The caller's (coords) is used as is, not copied, when not computing in parallel.
+
+    void computeEphemeris ( SSCoordinates &coords, const SSEphemerisOptions &options = SSEphemerisOptions() );
 };
 
 typedef SSObjectArray SSObjectVec;          // legacy declaration was typedef vector<SSObjectPtr> SSObjectVec; now we use SSObjectArray class
-typedef map<SSIdentifier,int> SSObjectMap;
+typedef SSFlatMap<SSIdentifier,int> SSObjectMap;
 
 SSObjectPtr SSNewObject ( SSObjectType type );
 SSObjectPtr SSCloneObject ( SSObject *pObj );
@@ -133,9 +456,22 @@ SSObjectMap SSMakeObjectMap ( SSObjectVec &objects, SSCatalog cat );
 SSObjectPtr SSIdentifierToObject ( SSIdentifier ident, SSObjectMap &map, SSObjectVec &objects );
 
 typedef bool (*SSObjectFilter) ( SSObjectPtr pObject, void *userData );
-int SSImportObjectsFromCSV ( const string &filename, SSObjectVec &objects, SSObjectFilter filter = nullptr, void *userData = nullptr );
+int SSImportObjectsFromCSV ( const string &filename, SSObjectVec &objects, SSObjectFilter filter = nullptr, void *userData = nullptr, int threads = 1 );
+
+// Creates an object from a line of CSV text already split into fields; returns nullptr if the fields are invalid.
+// SSImportObjectsFromCSV() looks up the importer for each line by its type code (the first field) and calls only that one.
+// Built-in importers are registered for all type codes in SSObject::typeToCode(). Applications can register importers
+// for their own type codes, or replace built-in ones; registering nullptr removes a code's importer.
+// Lines whose code has no importer are passed to the importer for "NO" (nonexistent objects), if any.
+
+typedef SSObjectPtr (*SSCSVImporter) ( const SSCSVFields &fields );
+void SSRegisterCSVImporter ( const string &code, SSCSVImporter importer );
+SSCSVImporter SSGetCSVImporter ( const string &code );
+
 int SSExportObjectsToCSV ( const string &filename, SSObjectVec &objects, SSObjectFilter filter = nullptr, void *userData = nullptr );
 
+#if SS_PACKED_OBJECTS
 #pragma pack ( pop )
+#endif
 
 #endif /* SSObject_hpp */
@@ -0,0 +1,398 @@
+// SSOccultation.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <algorithm>
+#include <functional>
+#include <set>
+
+#include "SSOccultation.hpp"
+#include "SSPlanet.hpp"
+
+#if USE_THREADS
+#include <thread>
+#endif
+
+static constexpr double kTimeTol = 1.0 / SSTime::kSecondsPerDay;                   // precision of occultation time and contacts [days]
+static constexpr double kContactLimit = 1.0;                                        // contacts are searched this far from occultation time [days]
+static constexpr double kSearchMargin = 1.0 / SSAngle::kArcminPerRad;               // allows for aberration and proper motion in screening stars by fundamental position [radians]
+static constexpr double kPolarStretch = 1.0 / ( 1.0 - SSCoordinates::kEarthFlattening );  // scales Earth's polar radius to its equatorial radius
+
+// Geocentric apparent direction of the occulting body in the fundamental frame, its distance [AU],
+// and the angular radius around it in which a star may be occulted somewhere on Earth, at one sample time.
+
+struct occult_sample
+{
+    double jd;
+    SSVector dir;
+    double dist, rad;
+};
+
+// Computes the body's (pBody) ephemeris at Julian Date (jd) from the center of the Earth (coords).
+// Returns the body's position [AU] in the fundamental frame.
+
+static SSVector body_position ( SSCoordinates &coords, SSPlanetPtr pBody, double jd )
+{
+    coords.setTime ( SSTime ( jd ) );
+    pBody->computeEphemeris ( coords );
+    return pBody->getDirection() * pBody->getDistance();
+}
+
+// Returns a star's visual magnitude, or its blue magnitude if that is unknown, as SSHTM sorts stars by.
+
+static float star_magnitude ( SSStarPtr pStar )
+{
+    float mag = pStar->getVMagnitude();
+    return ::isinf ( mag ) ? pStar->getBMagnitude() : mag;
+}
+
+// Distance of the shadow axis from Earth's center [Earth radii], for a body at (pos) [AU] and star in direction (star).
+// The shadow is cast away from the star, so a body farther than the star's direction, not toward it, casts none on Earth.
+
+static double shadow_distance ( SSVector pos, SSVector star )
+{
+    double b = pos * star;
+    if ( b <= 0.0 )
+        return INFINITY;
+
+    return ( pos - star * b ).magnitude() / SSCoordinates::kAUPerEarthRadii;
+}
+
+// The geometry of an occultation at one time, in the equatorial frame of date with Earth's polar axis stretched to a unit
+// sphere, as SSEclipse does for the Moon's shadow: (m) is the body's position and (u) the shadow axis direction, away from
+// the star; (gamma) is the axis' distance from Earth's center, and (t) the distance from the body along the axis to Earth's
+// surface, infinite if the axis misses. (star) is the star's unstretched direction, and (gst) Greenwich sidereal time.
+
+struct occult_shadow
+{
+    SSVector m, u, star;
+    double gamma, t, gst;
+};
+
+static occult_shadow shadow_at ( SSCoordinates &coords, SSPlanetPtr pBody, SSStarPtr pStar, double jd )
+{
+    occult_shadow s;
+
+    SSVector pos = coords.transform ( kFundamental, kEquatorial, body_position ( coords, pBody, jd ) );
+    pStar->computeEphemeris ( coords );
+    s.star = coords.transform ( kFundamental, kEquatorial, pStar->getDirection() );
+    s.gst = coords.getLST();
+
+    s.m = SSVector ( pos.x, pos.y, pos.z * kPolarStretch ) / SSCoordinates::kAUPerEarthRadii;
+    s.u = SSVector ( -s.star.x, -s.star.y, -s.star.z * kPolarStretch ).normalize();
+
+    double b = s.m * s.u;
+    s.gamma = ( s.m - s.u * b ).magnitude();
+
+    double disc = b * b - s.m * s.m + 1.0;
+    s.t = disc >= 0.0 ? -b - sqrt ( disc ) : INFINITY;
+    return s;
+}
+
+// Refines an occultation of a star (pStar) by a body (pBody), whose geocentric separation was least at sample (i) of
+// (samples). Returns true and the occultation in (event) if its shadow touches Earth from (jd0) up to (jd1).
+
+static bool refine_occultation ( SSCoordinates &coords, SSPlanetPtr pBody, SSStarPtr pStar, const vector<occult_sample> &samples, int i, double jd0, double jd1, SSOccultation::Event &event )
+{
+    auto gamma = [&] ( double t )
+    {
+        SSVector pos = body_position ( coords, pBody, t );
+        pStar->computeEphemeris ( coords );
+        return shadow_distance ( pos, pStar->getDirection() );
+    };
+
+    double fx = gamma ( samples[i].jd );
+    double tg = SSEvent::brentMinimum ( gamma, samples[i - 1].jd, samples[i + 1].jd, samples[i].jd, fx, kTimeTol );
+    double limit = 1.0 + pBody->getRadius() / SSCoordinates::kKmPerEarthRadii;
+    if ( ! ( fx < limit ) || tg < jd0 || tg >= jd1 )
+        return false;
+
+    event.time = SSTime ( tg );
+    event.radius = limit - 1.0;
+    event.gamma = fx;
+
+    // Sign gamma by which side of Earth's equator the shadow axis passes.
+
+    SSVector pos = body_position ( coords, pBody, tg );
+    pStar->computeEphemeris ( coords );
+    SSVector star = pStar->getDirection();
+    if ( coords.transform ( kFundamental, kEquatorial, pos - star * ( pos * star ) ).z < 0.0 )
+        event.gamma = -fx;
+
+    // Step away from the occultation time until the shadow is off Earth, then find the contacts between.
+
+    auto contact = [&] ( double t ) { return gamma ( t ) - limit; };
+    double fg = fx - limit;
+    event.start = event.stop = INFINITY;
+    for ( int dir = -1; dir <= 1; dir += 2 )
+    {
+        double t = tg, ft = fg;
+        while ( ft < 0.0 && fabs ( t - tg ) < kContactLimit )
+        {
+            t += dir * SSOccultation::kSampleStep;
+            ft = contact ( t );
+        }
+
+        if ( ft < 0.0 )
+            continue;
+
+        double fb = fg;
+        if ( dir < 0 )
+            event.start = SSEvent::illinoisRoot ( contact, t, tg, ft, fb, kTimeTol );
+        else
+            event.stop = SSEvent::illinoisRoot ( contact, tg, t, fg, ft, kTimeTol );
+    }
+
+    return true;
+}
+
+int SSOccultation::findOccultations ( SSHTM &htm, SSObjectPtr pBody, SSTime start, SSTime stop, float magLimit, vector<Event> &events, int threads )
+{
+    SSPlanetPtr pPlanet = SSGetPlanetPtr ( pBody );
+    if ( pPlanet == nullptr || ! ( stop > start ) )
+        return 0;
+
+    // Deepest HTM level which may hold stars as bright as the magnitude limit.
+
+    int depth = 0;
+    float minMag = 0.0, maxMag = 0.0;
+    while ( htm.magLimits ( 8ULL << 2 * depth, minMag, maxMag ) && minMag <= magLimit )
+        depth++;
+
+    double bodyRadius = pPlanet->getRadius() / SSCoordinates::kKmPerAU;
+    int nwindows = (int) ceil ( ( stop.jd - start.jd ) / kWindow );
+    int nsamples = (int) round ( kWindow / kSampleStep ) + 3;
+
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+#endif
+    threads = min ( max ( threads, 1 ), nwindows );
+
+    // Each thread gets its own copy of the body and geocentric coordinates.
+
+    vector<SSPlanetPtr> bodies ( threads );
+    vector<SSCoordinates> coords ( threads, SSCoordinates ( start, SSSpherical ( 0.0, 0.0, -SSCoordinates::kKmPerEarthRadii ) ) );
+    for ( int t = 0; t < threads; t++ )
+        bodies[t] = SSGetPlanetPtr ( SSCloneObject ( pBody ) );
+
+    auto parallel = [&] ( int count, function<void ( int, int )> work )
+    {
+#if USE_THREADS
+        vector<thread> workers;
+        for ( int t = 1; t < threads; t++ )
+            workers.push_back ( thread ( [&, t] ( void ) { for ( int w = t; w < count; w += threads ) work ( t, w ); } ) );
+
+        for ( int w = 0; w < count; w += threads )
+            work ( 0, w );
+
+        for ( thread &worker : workers )
+            worker.join();
+#else
+        for ( int w = 0; w < count; w++ )
+            work ( 0, w );
+#endif
+    };
+
+    // Windows are processed in batches. Each batch's body tracks and covering regions are computed in parallel; the regions
+    // are loaded on this thread, since loading may evict others; then the batch's windows are searched in parallel.
+
+    size_t first = events.size();
+    int batchSize = threads * 4;
+    vector<vector<occult_sample>> samples ( batchSize );
+    vector<set<uint64_t>> regions ( batchSize );
+    vector<vector<Event>> found ( batchSize );
+
+    for ( int w0 = 0; w0 < nwindows; w0 += batchSize )
+    {
+        int count = min ( batchSize, nwindows - w0 );
+
+        parallel ( count, [&] ( int t, int w )
+        {
+            double jd0 = start.jd + ( w0 + w ) * kWindow;
+            vector<occult_sample> &track = samples[w];
+            set<uint64_t> &ids = regions[w];
+            track.resize ( nsamples );
+            ids.clear();
+
+            // Sample the body's track from one step before the window to one step after.
+
+            for ( int i = 0; i < nsamples; i++ )
+            {
+                occult_sample &s = track[i];
+                s.jd = jd0 + ( i - 1 ) * kSampleStep;
+                SSVector pos = body_position ( coords[t], bodies[t], s.jd );
+                s.dir = pos.normalize ( s.dist );
+                s.rad = asin ( min ( 1.0, ( SSCoordinates::kAUPerEarthRadii + bodyRadius ) / s.dist ) );
+            }
+
+            // A star can be occulted if it is within the body's radius plus parallax of the track between samples.
+
+            for ( int i = 0; i < nsamples; i++ )
+            {
+                double motion = 0.0;
+                if ( i > 0 )
+                    motion = max ( motion, (double) track[i].dir.angularSeparation ( track[i - 1].dir ) );
+                if ( i < nsamples - 1 )
+                    motion = max ( motion, (double) track[i].dir.angularSeparation ( track[i + 1].dir ) );
+                track[i].rad += motion / 2.0 + kSearchMargin;
+            }
+
+            // Cover the track at the deepest level; regions at shallower levels are the ancestors of those triangles.
+
+            ids.insert ( 0 );
+            for ( int i = 0; i < nsamples && depth > 0; i++ )
+            {
+                SSHTM::Cover cover;
+                htm.coverCircle ( track[i].dir, track[i].rad, depth, cover );
+                for ( vector<SSHTM::IDRange> *ranges : { &cover.full, &cover.partial } )
+                    for ( SSHTM::IDRange &range : *ranges )
+                        for ( uint64_t id = range.first; id <= range.last; id++ )
+                            for ( int l = depth; l > 0; l-- )
+                                if ( ! ids.insert ( id >> 2 * ( depth - l ) ).second )
+                                    break;
+            }
+        } );
+
+        for ( int w = 0; w < count; w++ )
+            for ( uint64_t id : regions[w] )
+                htm.loadRegion ( id, true );
+
+        parallel ( count, [&] ( int t, int w )
+        {
+            double jd0 = start.jd + ( w0 + w ) * kWindow;
+            double jd1 = min ( jd0 + kWindow, stop.jd );
+            vector<occult_sample> &track = samples[w];
+            found[w].clear();
+
+            for ( uint64_t id : regions[w] )
+            {
+                SSObjectVec *pObjects = htm.getObjects ( id );
+                if ( pObjects == nullptr )
+                    continue;
+
+                for ( size_t k = 0; k < pObjects->size(); k++ )
+                {
+                    SSStarPtr pStar = SSGetStarPtr ( pObjects->get ( k ) );
+                    if ( pStar == nullptr || ! ( star_magnitude ( pStar ) <= magLimit ) )
+                        continue;
+
+                    // Find the sample nearest the star, and whether the star is close enough to the track there.
+                    // Closest approach at either end sample belongs to the previous or next window.
+
+                    SSVector dir = pStar->getFundamentalPosition().normalize();
+                    int nearest = -1;
+                    double maxcos = -1.0;
+                    bool close = false;
+                    for ( int i = 0; i < nsamples; i++ )
+                    {
+                        double c = track[i].dir * dir;
+                        if ( c > maxcos )
+                        {
+                            maxcos = c;
+                            nearest = i;
+                        }
+                        if ( c > cos ( track[i].rad ) )
+                            close = true;
+                    }
+
+                    if ( ! close || nearest < 1 || nearest > nsamples - 2 )
+                        continue;
+
+                    SSStarPtr pCopy = SSGetStarPtr ( SSCloneObject ( pStar ) );
+                    Event event;
+                    if ( refine_occultation ( coords[t], bodies[t], pCopy, track, nearest, max ( jd0, start.jd ), jd1, event ) )
+                    {
+                        event.pStar = pStar;
+                        event.magnitude = star_magnitude ( pStar );
+                        found[w].push_back ( event );
+                    }
+                    delete pCopy;
+                }
+            }
+        } );
+
+        for ( int w = 0; w < count; w++ )
+            events.insert ( events.end(), found[w].begin(), found[w].end() );
+    }
+
+    for ( int t = 0; t < threads; t++ )
+        delete bodies[t];
+
+    // Each window's events were found region by region; sort them all by time.
+
+    sort ( events.begin() + first, events.end(), [] ( const Event &a, const Event &b ) { return a.time.jd < b.time.jd; } );
+    return (int) ( events.size() - first );
+}
+
+int SSOccultation::groundTrack ( SSObjectPtr pBody, const Event &event, double step, vector<TrackPoint> &track )
+{
+    if ( fabs ( event.gamma ) >= 1.0 || ::isinf ( event.start.jd ) || ::isinf ( event.stop.jd ) || ! ( step > 0.0 ) )
+        return 0;
+
+    SSPlanetPtr pBodyCopy = SSGetPlanetPtr ( SSCloneObject ( pBody ) );
+    SSStarPtr pStarCopy = SSGetStarPtr ( SSCloneObject ( event.pStar ) );
+    if ( pBodyCopy == nullptr || pStarCopy == nullptr )
+    {
+        delete pBodyCopy;
+        delete pStarCopy;
+        return 0;
+    }
+
+    SSCoordinates coords ( event.time, SSSpherical ( 0.0, 0.0, -SSCoordinates::kKmPerEarthRadii ) );
+    auto shadow = [&] ( double t ) { return shadow_at ( coords, pBodyCopy, pStarCopy, t ); };
+    auto central = [&] ( double t ) { return shadow ( t ).gamma - 1.0; };
+
+    // The track begins and ends where the shadow axis is tangent to Earth's surface, between the global contacts.
+
+    double tg = event.time, fg = central ( tg ), fa = central ( event.start ), fb = central ( event.stop );
+    if ( ! ( fg < 0.0 && fa > 0.0 && fb > 0.0 ) )
+    {
+        delete pBodyCopy;
+        delete pStarCopy;
+        return 0;
+    }
+
+    double fx = fg;
+    double t1 = SSEvent::illinoisRoot ( central, event.start, tg, fa, fx, kTimeTol );
+    double t2 = SSEvent::illinoisRoot ( central, tg, event.stop, fg, fb, kTimeTol );
+
+    // Root finding leaves the ends within a second of tangency, possibly just off Earth; put them on the limb.
+
+    int n = 0;
+    for ( double t = t1; true; t += step )
+    {
+        bool last = t >= t2 - step * 0.01;
+        if ( last )
+            t = t2;
+
+        occult_shadow s = shadow ( t );
+        if ( ::isinf ( s.t ) )
+            s.t = - ( s.m * s.u );
+
+        // Unstretch the surface point, then rotate from the equatorial frame of date to Earth-fixed coordinates.
+
+        SSVector x = ( s.m + s.u * s.t ) * SSCoordinates::kKmPerEarthRadii;
+        x.z /= kPolarStretch;
+        double cg = cos ( s.gst ), sg = sin ( s.gst );
+        SSVector xe ( x.x * cg + x.y * sg, x.y * cg - x.x * sg, x.z );
+        SSSpherical geo = SSCoordinates::toGeodetic ( xe, SSCoordinates::kKmPerEarthRadii, SSCoordinates::kEarthFlattening );
+        SSVector up ( SSSpherical ( geo.lon + s.gst, geo.lat, 1.0 ) );
+
+        TrackPoint p;
+        p.time = SSTime ( t );
+        p.lon = SSAngle ( geo.lon ).modPi();
+        p.lat = geo.lat;
+        p.altitude = asin ( s.star * up );
+        track.push_back ( p );
+        n++;
+        if ( last )
+            break;
+    }
+
+    delete pBodyCopy;
+    delete pStarCopy;
+    return n;
+}
@@ -0,0 +1,65 @@
+// SSOccultation.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class predicts occultations of stars by the Moon, or by an asteroid or other solar system object,
+// using stars stored in an SSHTM. Instead of testing every star against the body, the body's geocentric track is
+// sampled over windows of time and covered with HTM triangles at every mesh level down to the level holding the
+// faintest stars wanted; only stars in those regions, which are loaded as needed, are examined. An occultation is
+// visible somewhere on Earth if the star's shadow of the body - a cylinder of the body's radius, parallel to the
+// star's direction - touches Earth, so each star within the body's radius plus its horizontal parallax of the track
+// is refined to the time the shadow axis passes closest to Earth's center, with the global contacts when the shadow
+// first and last touches Earth. Windows are divided among threads.
+
+#ifndef SSOccultation_hpp
+#define SSOccultation_hpp
+
+#include "SSEvent.hpp"
+#include "SSHTM.hpp"
+
+class SSOccultation
+{
+public:
+
+    static constexpr double kWindow = 1.0;              // length of time window searched by each thread task [days]
+    static constexpr double kSampleStep = 1.0 / 24.0;   // interval between samples of occulting body's track [days]
+
+    // An occultation of a star (pStar) by a body. (pStar) points into the HTM region holding the star, so it remains valid
+    // until that region is dumped or evicted. Times are Julian Dates (UT); contacts are infinite if not found within a day.
+
+    struct Event
+    {
+        SSObjectPtr pStar;      // occulted star, owned by HTM
+        float magnitude;        // star's visual (or if unknown, blue) magnitude
+        SSTime time;            // time when shadow axis passes closest to Earth's center
+        double gamma;           // least distance of shadow axis from Earth's center, in Earth radii; negative if south
+        double radius;          // radius of body's shadow, in Earth radii
+        SSTime start, stop;     // times when shadow first touches, and last leaves, Earth
+    };
+
+    // One point along the ground track of an occultation, where the shadow axis meets Earth's surface.
+
+    struct TrackPoint
+    {
+        SSTime time;            // Julian Date (UT)
+        SSAngle lon, lat;       // geodetic longitude (east positive) and latitude [radians]
+        SSAngle altitude;       // star's geometric altitude there [radians]
+    };
+
+    // Finds occultations of stars in an HTM (htm) brighter than a magnitude limit (magLimit) by a body (pBody), which is not
+    // modified, from (start) to (stop). HTM regions which may hold candidate stars are loaded synchronously as needed.
+    // Time windows are divided among threads (threads; if zero or negative, one per processor core).
+    // Occultations are appended to (events) in time order. Returns the number of occultations found.
+
+    static int findOccultations ( SSHTM &htm, SSObjectPtr pBody, SSTime start, SSTime stop, float magLimit, vector<Event> &events, int threads = 1 );
+
+    // Computes the ground track of the center of an occultation's shadow (event) by a body (pBody) from where the shadow
+    // axis first meets Earth to where it leaves, at intervals of (step) days. The shadow's width is the body's diameter
+    // everywhere along the track. Points are appended to (track). Returns the number of points, or zero if the axis misses Earth.
+
+    static int groundTrack ( SSObjectPtr pBody, const Event &event, double step, vector<TrackPoint> &track );
+};
+
+#endif /* SSOccultation_hpp */
@@ -458,6 +458,148 @@ void SSOrbit::computePoints ( double nu0, int npoints, vector<SSVector> &points
     }
 }
 
+double SSOrbit::computePoints ( double nu0, const SSVector &observer, double tolerance, vector<SSVector> &points, int maxPoints )
+{
+    double cosi = cos ( i );
+    double sini = sin ( i );
+    double cosn = cos ( n );
+    double sinn = sin ( n );
+    double minDist = INFINITY;
+    
+    // Computes orbit point at true anomaly (nu), as computePoints() does.
+    
+    auto point = [&] ( double nu )
+    {
+        double r = q * ( 1.0 + e ) / ( 1.0 + e * cos ( nu ) );
+        double cosu = cos ( nu + w );
+        double sinu = sin ( nu + w );
+        SSVector p ( r * ( cosu * cosn - sinu * cosi * sinn ), r * ( cosu * sinn + sinu * cosi * cosn ), r * ( sinu * sini ) );
+        minDist = min ( minDist, p.distance ( observer ) );
+        return p;
+    };
+    
+    // A span of the orbit between true anomalies (nu0, nu1) and their points (p0, p1), split at most (depth) more times.
+    
+    struct Span
+    {
+        double nu0, nu1;
+        SSVector p0, p1;
+        int depth;
+    };
+    
+    static constexpr int kInitialSpans = 8, kMaxDepth = 16;
+    int budget = maxPoints;
+    
+    // Appends points from true anomaly (start) to (stop), excluding the end point. Spans are split on an explicit stack,
+    // right half pushed first, so they come off the stack in order of true anomaly. Ellipses, parabolas, and hyperbolas
+    // are convex, so a span's midpoint is the point farthest from its chord (in true anomaly, nearly so).
+    
+    auto sample = [&] ( double start, double stop )
+    {
+        vector<Span> stack;
+        for ( int k = kInitialSpans - 1; k >= 0; k-- )
+        {
+            double a = start + ( stop - start ) * k / kInitialSpans;
+            double b = start + ( stop - start ) * ( k + 1 ) / kInitialSpans;
+            stack.push_back ( { a, b, point ( a ), point ( b ), kMaxDepth } );
+        }
+        
+        budget -= kInitialSpans;
+        while ( ! stack.empty() )
+        {
+            Span s = stack.back();
+            stack.pop_back();
+            
+            double mid = ( s.nu0 + s.nu1 ) / 2.0;
+            SSVector pm = point ( mid );
+            double dist = pm.distance ( observer );
+            double error = dist > 0.0 ? pm.distance ( ( s.p0 + s.p1 ) / 2.0 ) / dist : INFINITY;
+            if ( error > tolerance && s.depth > 0 && budget > 0 )
+            {
+                budget--;
+                stack.push_back ( { mid, s.nu1, pm, s.p1, s.depth - 1 } );
+                stack.push_back ( { s.nu0, mid, s.p0, pm, s.depth - 1 } );
+            }
+            else
+            {
+                points.push_back ( s.p0 );
+            }
+        }
+    };
+    
+    points.clear();
+    if ( e < 1.0 )
+    {
+        sample ( nu0, nu0 + M_2PI );
+        points.push_back ( point ( nu0 ) );
+    }
+    else
+    {
+        double numax = 0.99 * acos ( -1.0 / e );
+        nu0 = max ( -numax, min ( modpi ( nu0 ), numax ) );
+        sample ( nu0, numax );
+        points.push_back ( point ( numax ) );
+        points.push_back ( SSVector ( INFINITY, INFINITY, INFINITY ) );
+        sample ( -numax, nu0 );
+        points.push_back ( point ( nu0 ) );
+    }
+    
+    return minDist;
+}
+
+const vector<SSVector> &SSOrbitPathCache::getPoints ( const SSOrbit &orbit, const SSVector &observer, double tolerance )
+{
+    Entry &entry = _entries[ Key ( orbit.q, orbit.e, orbit.i, orbit.w, orbit.n ) ];
+    entry.lastUse = ++_useCount;
+    
+    bool valid = ! entry.points.empty() && tolerance >= entry.tolerance / 2.0 && tolerance <= entry.tolerance * 4.0
+                 && entry.observer.distance ( observer ) <= entry.minDistance / 4.0;
+    if ( ! valid )
+    {
+        SSOrbit o = orbit;
+        entry.tolerance = tolerance;
+        entry.observer = observer;
+        entry.minDistance = o.computePoints ( 0.0, observer, tolerance, entry.points );
+        _computed++;
+    }
+    
+    return entry.points;
+}
+
+const vector<SSVector> &SSOrbitPathCache::getPoints ( const SSOrbit &orbit, const SSVector &observer, SSView &view, double pixels )
+{
+    return getPoints ( orbit, observer, pixels * min ( fabs ( view.getScaleX() ), fabs ( view.getScaleY() ) ) );
+}
+
+size_t SSOrbitPathCache::prune ( size_t maxEntries )
+{
+    if ( _entries.size() <= maxEntries )
+        return 0;
+    
+    vector<uint64_t> uses;
+    for ( auto &pair : _entries )
+        uses.push_back ( pair.second.lastUse );
+    
+    nth_element ( uses.begin(), uses.end() - maxEntries, uses.end() );
+    uint64_t oldest = maxEntries > 0 ? *( uses.end() - maxEntries ) : UINT64_MAX;
+    
+    size_t removed = 0;
+    for ( auto it = _entries.begin(); it != _entries.end(); )
+    {
+        if ( it->second.lastUse < oldest )
+        {
+            it = _entries.erase ( it );
+            removed++;
+        }
+        else
+        {
+            it++;
+        }
+    }
+    
+    return removed;
+}
+
 // Constructs Venus's orbital elements at a specific Julian Ephemeris Date (jde)
 // referred to the J2000 ecliptic.  See comments for getMercuryOrbit regarding
 // validity range, accuracy, and source.
@@ -809,3 +951,225 @@ SSOrbit SSOrbit::getPlutoOrbit ( double jde )
                      SSAngle::fromDegrees ( l - p ).mod2Pi(),
                      SSAngle::fromDegrees ( mm / 36525.0 ) );
 }
+
+void SSOrbitArray::clear ( void )
+{
+    for ( vector<double> *col : { &t, &q, &e, &i, &w, &n, &m, &mm, &_px, &_py, &_pz, &_qx, &_qy, &_qz } )
+        col->clear();
+    
+    _elliptic.clear();
+    _parabolic.clear();
+    _hyperbolic.clear();
+}
+
+void SSOrbitArray::reserve ( size_t size )
+{
+    for ( vector<double> *col : { &t, &q, &e, &i, &w, &n, &m, &mm } )
+        col->reserve ( size );
+}
+
+void SSOrbitArray::push_back ( const SSOrbit &orbit )
+{
+    t.push_back ( orbit.t );
+    q.push_back ( orbit.q );
+    e.push_back ( orbit.e );
+    i.push_back ( orbit.i );
+    w.push_back ( orbit.w );
+    n.push_back ( orbit.n );
+    m.push_back ( orbit.m );
+    mm.push_back ( orbit.mm );
+}
+
+SSOrbit SSOrbitArray::get ( size_t k )
+{
+    return SSOrbit ( t[k], q[k], e[k], i[k], w[k], n[k], m[k], mm[k] );
+}
+
+// Precomputes each orbit's periapse and perpendicular unit vectors, rotated into an output frame (frame),
+// and sorts orbits into elliptic, parabolic, and hyperbolic index lists.
+
+void SSOrbitArray::prepare ( const SSMatrix &frame )
+{
+    size_t size = t.size();
+    
+    for ( vector<double> *col : { &_px, &_py, &_pz, &_qx, &_qy, &_qz } )
+        col->resize ( size );
+    
+    _elliptic.clear();
+    _parabolic.clear();
+    _hyperbolic.clear();
+    
+    for ( size_t k = 0; k < size; k++ )
+    {
+        double cw = cos ( w[k] ), sw = sin ( w[k] );
+        double ci = cos ( i[k] ), si = sin ( i[k] );
+        double cn = cos ( n[k] ), sn = sin ( n[k] );
+        
+        double px = cw * cn - sw * ci * sn, py = cw * sn + sw * ci * cn, pz = sw * si;
+        double qx = -sw * cn - cw * ci * sn, qy = -sw * sn + cw * ci * cn, qz = cw * si;
+        
+        _px[k] = frame.m00 * px + frame.m01 * py + frame.m02 * pz;
+        _py[k] = frame.m10 * px + frame.m11 * py + frame.m12 * pz;
+        _pz[k] = frame.m20 * px + frame.m21 * py + frame.m22 * pz;
+        _qx[k] = frame.m00 * qx + frame.m01 * qy + frame.m02 * qz;
+        _qy[k] = frame.m10 * qx + frame.m11 * qy + frame.m12 * qz;
+        _qz[k] = frame.m20 * qx + frame.m21 * qy + frame.m22 * qz;
+        
+        double ek = fabs ( e[k] );
+        if ( ek < 1.0 )
+            _elliptic.push_back ( k );
+        else if ( ek == 1.0 )
+            _parabolic.push_back ( k );
+        else
+            _hyperbolic.push_back ( k );
+    }
+}
+
+// Markley's starting value for the solution of Kepler's equation E - e sin E = M for an elliptic orbit
+// (e < 1) and absolute value of mean anomaly (mabs) from 0 to pi, without iteration or branches. From
+// F. L. Markley, "Kepler Equation Solver", Celestial Mechanics and Dynamical Astronomy 63, 101 (1995).
+
+static inline double keplerStarterMarkley ( double e, double mabs )
+{
+    static constexpr double kPi2 = M_PI * M_PI;
+    
+    double alpha = ( 3.0 * kPi2 + 1.6 * M_PI * ( M_PI - mabs ) / ( 1.0 + e ) ) / ( kPi2 - 6.0 );
+    double d = 3.0 * ( 1.0 - e ) + alpha * e;
+    double q = 2.0 * alpha * d * ( 1.0 - e ) - mabs * mabs;
+    double r = 3.0 * alpha * d * ( d - 1.0 + e ) * mabs + mabs * mabs * mabs;
+    double w = cbrt ( fabs ( r ) + sqrt ( q * q * q + r * r ) );
+    
+    w *= w;
+    return ( 2.0 * r * w / ( w * w + w * q + q * q ) + mabs ) / d;
+}
+
+// Applies Markley's fifth-order correction to a starting eccentric anomaly (ea) with sine (se) and cosine (ce),
+// for eccentricity (e) and absolute mean anomaly (mabs). Returns corrected eccentric anomaly, and rotates se and ce
+// by the small correction using Taylor series, which saves a second sin() and cos() evaluation.
+
+static inline double keplerCorrectMarkley ( double e, double mabs, double ea, double &se, double &ce )
+{
+    double f2 = e * se, f3 = e * ce;
+    double f0 = ea - f2 - mabs, f1 = 1.0 - f3;
+    double d3 = -f0 / ( f1 - 0.5 * f0 * f2 / f1 );
+    double d4 = -f0 / ( f1 + 0.5 * d3 * f2 + d3 * d3 * f3 / 6.0 );
+    double d5 = -f0 / ( f1 + 0.5 * d4 * f2 + d4 * d4 * f3 / 6.0 - d4 * d4 * d4 * f2 / 24.0 );
+    
+    double d2 = d5 * d5;
+    double sd = d5 * ( 1.0 - d2 / 6.0 * ( 1.0 - d2 / 20.0 ) );
+    double cd = 1.0 - d2 / 2.0 * ( 1.0 - d2 / 12.0 * ( 1.0 - d2 / 30.0 ) );
+    double s1 = se * cd + ce * sd;
+    
+    ce = ce * cd - se * sd;
+    se = s1;
+    return ea + d5;
+}
+
+void SSOrbitArray::toPositionVelocity ( double jde, vector<SSVector> &pos, vector<SSVector> &vel )
+{
+    toPositionVelocity ( jde, nullptr, pos, vel );
+}
+
+void SSOrbitArray::toPositionVelocity ( const vector<double> &jdes, vector<SSVector> &pos, vector<SSVector> &vel )
+{
+    if ( jdes.size() < size() )
+    {
+        pos.clear();
+        vel.clear();
+        return;
+    }
+    
+    toPositionVelocity ( 0.0, jdes.data(), pos, vel );
+}
+
+// Common implementation of both methods above: if per-orbit dates (jdes) are given, orbit k
+// is computed at jdes[k]; otherwise every orbit is computed at the same date (jde).
+
+void SSOrbitArray::toPositionVelocity ( double jde, const double *jdes, vector<SSVector> &pos, vector<SSVector> &vel )
+{
+    if ( ! prepared() )
+        prepare ( SSMatrix::identity() );
+    
+    size_t size = t.size();
+    pos.resize ( size );
+    vel.resize ( size );
+    
+    // Perifocal position (x,y) and velocity (vx,vy) are rotated into the output frame by the precomputed unit vectors.
+    
+    auto store = [&] ( size_t k, double x, double y, double vx, double vy )
+    {
+        pos[k] = SSVector ( x * _px[k] + y * _qx[k], x * _py[k] + y * _qy[k], x * _pz[k] + y * _qz[k] );
+        vel[k] = SSVector ( vx * _px[k] + vy * _qx[k], vx * _py[k] + vy * _qy[k], vx * _pz[k] + vy * _qz[k] );
+    };
+    
+    // Elliptic orbits are solved in blocks, one stage at a time, so each stage is a short loop
+    // without branches or dependencies between orbits, which overlaps well (and can vectorize).
+    
+    static constexpr size_t kBlock = 64;
+    for ( size_t b = 0; b < _elliptic.size(); b += kBlock )
+    {
+        size_t nb = min ( kBlock, _elliptic.size() - b );
+        double ek[kBlock], ma[kBlock], ea[kBlock], se[kBlock], ce[kBlock];
+        
+        for ( size_t j = 0; j < nb; j++ )
+        {
+            size_t k = _elliptic[b + j];
+            ek[j] = fabs ( e[k] );
+            ma[j] = m[k] + mm[k] * ( ( jdes ? jdes[k] : jde ) - t[k] );
+            ma[j] -= 2.0 * M_PI * floor ( ma[j] / ( 2.0 * M_PI ) + 0.5 );
+            ea[j] = keplerStarterMarkley ( ek[j], fabs ( ma[j] ) );
+        }
+        
+        for ( size_t j = 0; j < nb; j++ )
+        {
+            se[j] = sin ( ea[j] );
+            ce[j] = cos ( ea[j] );
+        }
+        
+        for ( size_t j = 0; j < nb; j++ )
+        {
+            keplerCorrectMarkley ( ek[j], fabs ( ma[j] ), ea[j], se[j], ce[j] );
+            se[j] = copysign ( se[j], ma[j] );
+        }
+        
+        for ( size_t j = 0; j < nb; j++ )
+        {
+            size_t k = _elliptic[b + j];
+            double a = q[k] / ( 1.0 - ek[j] ), bb = a * sqrt ( 1.0 - ek[j] * ek[j] );
+            double dea = mm[k] / ( 1.0 - ek[j] * ce[j] );
+            store ( k, a * ( ce[j] - ek[j] ), bb * se[j], -a * se[j] * dea, bb * ce[j] * dea );
+        }
+    }
+    
+    // Parabolic orbits: Barker's equation s^3 + 3s = M, where s = tan ( nu / 2 ), has a closed-form solution.
+    
+    for ( size_t k : _parabolic )
+    {
+        double ma = m[k] + mm[k] * ( ( jdes ? jdes[k] : jde ) - t[k] );
+        double y = cbrt ( 0.5 * ma + sqrt ( 0.25 * ma * ma + 1.0 ) );
+        double s = y - 1.0 / y;
+        double ds = mm[k] / ( 3.0 * ( 1.0 + s * s ) );
+        store ( k, q[k] * ( 1.0 - s * s ), 2.0 * q[k] * s, -2.0 * q[k] * s * ds, 2.0 * q[k] * ds );
+    }
+    
+    // Hyperbolic orbits: Newton's method on e sinh H - H = M.
+    
+    for ( size_t k : _hyperbolic )
+    {
+        double ek = fabs ( e[k] ), a = q[k] / ( ek - 1.0 ), b = a * sqrt ( ek * ek - 1.0 );
+        double ma = m[k] + mm[k] * ( ( jdes ? jdes[k] : jde ) - t[k] );
+        double ha = asinh ( ma / ek ), delta = 0.0;
+        int iter = 0;
+        
+        do
+        {
+            delta = ( ek * sinh ( ha ) - ha - ma ) / ( ek * cosh ( ha ) - 1.0 );
+            ha -= delta;
+        }
+        while ( fabs ( delta ) > 1.0e-15 * max ( 1.0, fabs ( ha ) ) && ++iter < kMaxIterations );
+        
+        double sh = sinh ( ha ), ch = cosh ( ha );
+        double dha = mm[k] / ( ek * ch - 1.0 );
+        store ( k, a * ( ek - ch ), b * sh, -a * sh * dha, b * ch * dha );
+    }
+}
@@ -10,7 +10,12 @@
 #define SSOrbit_hpp
 
 #include <math.h>
-#include "SSMatrix.hpp"
+#include <vector>
+#include <map>
+#include <tuple>
+#include "SSView.hpp"
+
+using namespace std;
 
 // Stores Keplerian orbital elements, solves Kepler's equation, and computes position/velocity
 // at a given time; also computes orbit from position & velocity.
@@ -44,6 +49,16 @@ struct SSOrbit
     void toPositionSeparation ( double jde, SSAngle &pa, double &r, double &sep );
     SSOrbit transform ( SSMatrix &m );
     void computePoints ( double nu0, int npoints, vector<SSVector> &points );
+    
+    // Computes points outlining the orbit like computePoints(), but sampled adaptively instead of at uniform steps of
+    // true anomaly: a span of the orbit is split until the orbit strays from the straight line between its ends by no more
+    // than (tolerance) radians as seen from an observer (observer) whose position is relative to the primary in the orbit's
+    // reference frame. So few points are spent where the orbit is far from the observer or nearly straight, and many around
+    // a sharp periapse. Open orbits are drawn out to 99% of their limiting true anomaly, with an infinite point where they
+    // are open. At most (maxPoints) points are computed. Returns the smallest distance from the observer to any point.
+
+    static constexpr int kMaxAdaptivePoints = 10000;
+    double computePoints ( double nu0, const SSVector &observer, double tolerance, vector<SSVector> &points, int maxPoints = kMaxAdaptivePoints );
 
     double semiMajorAxis ( void ) { return e == 1.0 ? INFINITY : q / ( 1.0 - e ); }
     double apoapse ( void ) { return e >= 1.0 ? INFINITY : semiMajorAxis() * ( 1.0 + e ); }
@@ -60,4 +75,89 @@ struct SSOrbit
     static SSOrbit getPlutoOrbit ( double jde );
 };
 
+// Stores many Keplerian orbits as separate arrays of each element (structure-of-arrays), for computing
+// positions and velocities of large populations like the MPC asteroid list at once. Each orbit's orientation
+// is precomputed by prepare(), and Kepler's equation is solved without iteration: elliptic orbits use Markley's
+// starter with a fifth-order correction, parabolic orbits Barker's equation in closed form. Only hyperbolic
+// orbits iterate. Elements have the same meanings and units as in SSOrbit.
+
+class SSOrbitArray
+{
+protected:
+    vector<double> _px, _py, _pz;           // unit vector toward periapse, in output frame
+    vector<double> _qx, _qy, _qz;           // unit vector 90 degrees ahead of periapse in orbital plane, in output frame
+    vector<size_t> _elliptic, _parabolic, _hyperbolic;  // indices of orbits of each type
+    
+    void toPositionVelocity ( double jde, const double *jdes, vector<SSVector> &pos, vector<SSVector> &vel );
+    
+public:
+    vector<double> t, q, e, i, w, n, m, mm; // orbital elements; see SSOrbit
+    
+    size_t size ( void ) { return t.size(); }
+    void clear ( void );
+    void reserve ( size_t size );
+    void push_back ( const SSOrbit &orbit );
+    SSOrbit get ( size_t k );
+    
+    // Precomputes orbit orientations, rotated into an output frame by a matrix; usually the ecliptic
+    // to fundamental (J2000 equatorial) frame matrix. Call after changing any orbits' elements.
+    // If never called, toPositionVelocity() prepares the orbits in their own reference frame.
+    
+    void prepare ( const SSMatrix &frame );
+    bool prepared ( void ) { return _px.size() == size(); }
+    
+    // Computes positions and velocities of all orbits at a Julian Ephemeris Date (jde), in the prepared frame.
+    // Results agree with SSOrbit::toPositionVelocity() to a relative difference of about 1.0e-8, since both
+    // solve Kepler's equation only to a tolerance of about 1.0e-9, and eccentric orbits magnify that difference.
+    
+    void toPositionVelocity ( double jde, vector<SSVector> &pos, vector<SSVector> &vel );
+    
+    // As above, but computes each orbit at its own Julian Ephemeris Date (jdes), which must have one date per orbit.
+    // Useful for antedating every orbit for its own light time.
+    
+    void toPositionVelocity ( const vector<double> &jdes, vector<SSVector> &pos, vector<SSVector> &vel );
+};
+
+// Caches adaptively sampled orbit outlines (see SSOrbit::computePoints()), keyed by orbital element set, so orbits
+// which haven't changed aren't recomputed every frame. An orbit is recomputed when its elements change, when the view
+// zooms in so the tolerance is less than half the one it was sampled with (or out, to more than four times), or when the
+// observer has moved more than a quarter of the orbit's closest distance. Outlines start at periapse.
+
+class SSOrbitPathCache
+{
+protected:
+
+    struct Entry
+    {
+        double tolerance;           // angular tolerance in radians with which points were computed
+        SSVector observer;          // observer position for which points were computed
+        double minDistance;         // smallest distance from observer to any point
+        uint64_t lastUse;           // value of use counter when entry was last used
+        vector<SSVector> points;    // points outlining orbit
+    };
+    
+    typedef tuple<double,double,double,double,double> Key;      // q, e, i, w, n
+    
+    map<Key,Entry> _entries;        // cached orbit outlines, indexed by element set
+    uint64_t _useCount = 0;         // incremented on every call to getPoints()
+    size_t _computed = 0;           // number of outlines computed, for profiling
+
+public:
+
+    // Returns points outlining an orbit (orbit) as seen from an observer (observer) relative to the orbit's primary,
+    // in its reference frame, with angular tolerance (tolerance) in radians; or with a tolerance of (pixels) at the
+    // center of a view (view). Points are valid until the next call, or until the cache is pruned or cleared.
+    
+    const vector<SSVector> &getPoints ( const SSOrbit &orbit, const SSVector &observer, double tolerance );
+    const vector<SSVector> &getPoints ( const SSOrbit &orbit, const SSVector &observer, SSView &view, double pixels = 0.5 );
+    
+    // Removes all but the (maxEntries) most recently used outlines. Returns number removed.
+    
+    size_t prune ( size_t maxEntries );
+    
+    void clear ( void ) { _entries.clear(); }
+    size_t size ( void ) { return _entries.size(); }
+    size_t computed ( void ) { return _computed; }
+};
+
 #endif /* SSOrbit_hpp */
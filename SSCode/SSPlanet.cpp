@@ -4,24 +4,26 @@
 // Created by Tim DeBenedictis on 3/15/20.
 // Copyright © 2020 Southern Stars. All rights reserved.
 
-#include <mutex>
-
 #include "SSPlanet.hpp"
 #include "SSPSEphemeris.hpp"
 #include "SSJPLDEphemeris.hpp"
 #include "SSMoonEphemeris.hpp"
 #include "SSTLE.hpp"
 
+#if USE_THREADS
+#include <mutex>
+#endif
+
 // This uses the 1979 Van Flandern - Pulkinnen low-precision planetary ephemeris when JPL DE is unavailable.
 // After investigation, Paul Schlyter's formulae seem more accurate (esp. for Pluto and the Moon) and are
 // much simpler/faster, so there's no need for the original VP version.  But it's here for safekeeping!
 
+// It can still be chosen at runtime with an ephemeris policy, e.g. for comparison.
+
 #ifndef USE_VPEPHEMERIS
 #define USE_VPEPHEMERIS 0
 #endif
-#if USE_VPEPHEMERIS
 #include "SSVPEphemeris.hpp"
-#endif
 
 // This uses the VSOP013 planetary and ELPMPP02 ephemeris when JPL DE is unavailable.
 // These provide sub-arcsecond accuracy over a timespan from years -4000 to +8000,
@@ -38,6 +40,31 @@ static VSOP2013 _vsop;
 static ELPMPP02 _elp;
 #endif
 
+// Policy choosing major planet and Moon ephemeris backends; empty by default.
+
+static SSEphemerisPolicy _ephemerisPolicy;
+
+// Whether to use Chebyshev cache for major planet and Moon positions; off by default.
+
+static bool _useEphemerisCache = false;
+
+// Compiled Chebyshev ephemeris file; lookups are suspended while compiling a new one.
+
+static SSChebyshevEphemeris _ephemerisFile;
+static bool _compilingEphemerisFile = false;
+
+// Light time correction tolerance in radians; zero always re-evaluates ephemerides antedated for light time.
+
+static double _lightTimeTolerance = 0.0;
+
+// Per-object light time correction statistics, counted only while enabled.
+
+static bool _countLightTime = false;
+static map<SSPlanet *, SSPlanet::LightTimeStats> _lightTimeStats;
+#if USE_THREADS
+static mutex _lightTimeMutex;
+#endif
+
 SSPlanet::SSPlanet ( SSObjectType type ) : SSObject ( type )
 {
     _id = SSIdentifier();
@@ -50,6 +77,7 @@ SSPlanet::SSPlanet ( SSObjectType type ) : SSObject ( type )
     _albedo = INFINITY;
     _taxonomy = "";
     _position = _velocity = SSVector ( INFINITY, INFINITY, INFINITY );
+    _pmatrixJED = NAN;
 }
 
 SSPlanet::SSPlanet ( SSObjectType type, SSPlanetID id ) : SSPlanet ( type )
@@ -106,12 +134,12 @@ string SSPlanet::getNumberName ( void )
     
     if ( _type == kTypeSatellite )
     {
-        string name = _names.empty() ? "" : _names[0];
+        string name = _names.empty() ? "" : _names[0].str();
         name += " (" + _id.toString() + ")";
         return name;
     }
     
-    return _names.empty() ? _id.toString() : _names[0];
+    return _names.empty() ? _id.toString() : _names[0].str();
 }
 
 // Overrides SSObject::getIdentifier ( SSCatalog cat )
@@ -133,6 +161,10 @@ SSIdentifier SSPlanet::getIdentifier ( SSCatalog cat )
 
 void SSPlanet::computePositionVelocity ( double jed, double lt, SSVector &pos, SSVector &vel )
 {
+    if ( _type != kTypePlanet && _type != kTypeSatellite && _ephemerisFile.isOpen() && ! _compilingEphemerisFile )
+        if ( _ephemerisFile.compute ( _id, jed - lt, pos, vel ) )
+            return;
+    
     if ( _type == kTypePlanet )
         computeMajorPlanetPositionVelocity ( (int) _id.identifier(), jed, lt, pos, vel );
     else if ( _type == kTypeMoon )
@@ -141,7 +173,7 @@ void SSPlanet::computePositionVelocity ( double jed, double lt, SSVector &pos, S
         computeMinorPlanetPositionVelocity ( jed, lt, pos, vel );
     else if ( _type == kTypeSatellite )
     {
-        SSSatellite *pSat = dynamic_cast<SSSatellite *> ( this );
+        SSSatellite *pSat = SSGetSatellitePtr ( this );
         if ( pSat )
             pSat->computePositionVelocity ( jed, lt, pos, vel );
     }
@@ -152,16 +184,21 @@ void SSPlanet::computePositionVelocity ( double jed, double lt, SSVector &pos, S
 
 void SSPlanet::computePositionVelocity  ( SSCoordinates &coords, SSVector &pos, SSVector &vel )
 {
+    SSEphemerisContext::Scope scope ( coords.getEphemerisContext() );
     computePositionVelocity ( coords.getJED(), 0.0, pos, vel );
 }
 
-// Computes major planet's heliocentric position and velocity vectors in AU and AU/day.
-// Current time (jed) is Julian Ephemeris Date in dynamic time (TDT), not civil time (UTC).
-// Light travel time to planet (lt) is in days; may be zero for first approximation.
-// Returned position (pos) and velocity (vel) vectors are both in fundamental J2000 equatorial frame.
+// Computes major planet's heliocentric position and velocity without using the ephemeris cache;
+// see computeMajorPlanetPositionVelocity() below.
 
-void SSPlanet::computeMajorPlanetPositionVelocity ( int id, double jed, double lt, SSVector &pos, SSVector &vel )
+void SSPlanet::computeUncachedPositionVelocity ( int id, double jed, double lt, SSVector &pos, SSVector &vel )
 {
+    // An ephemeris policy may choose another backend for this planet and time; if that can't compute it, use the default.
+    
+    SSEphemerisBackend backend = _ephemerisPolicy.select ( id, jed - lt );
+    if ( backend != kBackendDefault && computeBackendPositionVelocity ( backend, id, jed - lt, pos, vel ) )
+        return;
+    
     // When planets or the Moon are more than 1 light day away, don't use JPL DE 408; VSOP/ELP is much faster in this case.
 
     if ( lt < 1.0 && SSJPLDEphemeris::compute ( id, jed - lt, false, pos, vel ) )
@@ -197,19 +234,26 @@ void SSPlanet::computeMajorPlanetPositionVelocity ( int id, double jed, double l
 #endif
 }
 
-void SSPlanet::computePSPlanetMoonPositionVelocity ( int id, double jed, double lt, SSVector &pos, SSVector &vel )
+// Computes major planet's heliocentric position and velocity vectors in AU and AU/day.
+// Current time (jed) is Julian Ephemeris Date in dynamic time (TDT), not civil time (UTC).
+// Light travel time to planet (lt) is in days; may be zero for first approximation.
+// Returned position (pos) and velocity (vel) vectors are both in fundamental J2000 equatorial frame.
+
+void SSPlanet::computeMajorPlanetPositionVelocity ( int id, double jed, double lt, SSVector &pos, SSVector &vel )
 {
-    static double orbMatJED = 0.0;
-    static SSMatrix orbMat;
+    if ( _ephemerisFile.isOpen() && ! _compilingEphemerisFile )
+        if ( _ephemerisFile.compute ( SSIdentifier ( kCatJPLanet, id ), jed - lt, pos, vel ) )
+            return;
     
-    if ( jed != orbMatJED )
-    {
-        SSMatrix eclMat = SSCoordinates::getEclipticMatrix ( SSCoordinates::getObliquity ( jed ) );
-        SSMatrix preMat = SSCoordinates::getPrecessionMatrix ( jed ).transpose();
-        orbMat = preMat * eclMat;
-        orbMatJED = jed;
-    }
+    if ( _useEphemerisCache && id > kSun && id <= kPluto && getEphemerisCache().compute ( id, jed - lt, pos, vel ) )
+        return;
+    
+    computeUncachedPositionVelocity ( id, jed, lt, pos, vel );
+}
 
+void SSPlanet::computePSPlanetMoonPositionVelocity ( int id, double jed, double lt, SSVector &pos, SSVector &vel )
+{
+    SSMatrix orbMat = SSEphemerisContext::current().getEclipticMatrix ( jed );
     SSSpherical ecl;
     
     if ( id == kSun )
@@ -264,18 +308,58 @@ void SSPlanet::computeMinorPlanetPositionVelocity ( double jed, double lt, SSVec
     vel = matrix.multiply ( vel );
 }
 
+// Computes a moon (m) of Jupiter or Saturn relative to its primary at JED (jed) antedated for light time (lt),
+// from all moons of its system computed at once and kept in the current thread's ephemeris context.
+// The system is computed at JED minus light time rounded down to a whole minute, so every moon whose light
+// time falls within that minute shares one computation; then each moon is moved back to its own light time
+// by its velocity, which is good to a few kilometers (about a milliarcsecond), even for Io.
+// Returns false for moons the system theories don't include.
+
+static bool computeMoonSystemPositionVelocity ( int m, double jed, double lt, SSVector &pos, SSVector &vel )
+{
+    SSEphemerisContext &context = SSEphemerisContext::current();
+    double lt0 = floor ( lt * SSTime::kMinutesPerDay ) / SSTime::kMinutesPerDay;
+    double jed0 = jed - lt0;
+    int i = m % 100 - 1, k = lt > 0.0 ? 1 : 0;
+
+    if ( m / 100 == kJupiter && i >= 0 && i < SSMoonEphemeris::kNumJupiterMoons )
+    {
+        if ( context.jupiterMoonsJED[k] != jed0 )
+        {
+            if ( ! SSMoonEphemeris::jupiterMoonsPositionVelocity ( jed0, context.jupiterMoonPos[k], context.jupiterMoonVel[k] ) )
+                return false;
+            context.jupiterMoonsJED[k] = jed0;
+        }
+        pos = context.jupiterMoonPos[k][i];
+        vel = context.jupiterMoonVel[k][i];
+    }
+    else if ( m / 100 == kSaturn && i >= 0 && i < SSMoonEphemeris::kNumSaturnMoons )
+    {
+        if ( context.saturnMoonsJED[k] != jed0 )
+        {
+            if ( ! SSMoonEphemeris::saturnMoonsPositionVelocity ( jed0, context.saturnMoonPos[k], context.saturnMoonVel[k] ) )
+                return false;
+            context.saturnMoonsJED[k] = jed0;
+        }
+        pos = context.saturnMoonPos[k][i];
+        vel = context.saturnMoonVel[k][i];
+    }
+    else
+    {
+        return false;
+    }
+
+    pos -= vel * ( lt - lt0 );
+    return true;
+}
+
 // Computes moon's heliocentric position and velocity vectors in AU and AU/day.
 // Current time (jed) is Julian Ephemeris Date in dynamic time (TDT), not civil time (UTC).
 // Light travel time to moon (lt) is in days; may be zero for first approximation.
 // Returned position (pos) and velocity (vel) vectors are both in fundamental J2000 equatorial frame.
 
-mutex moon_mutex;
-
 void SSPlanet::computeMoonPositionVelocity ( double jed, double lt, SSVector &pos, SSVector &vel )
 {
-    static SSVector primaryPos[10], primaryVel[10];
-    static double primaryJED[10] = { 0.0 };
-
     // Get moon and primary planet identifier.
     
     int m = (int) _id.identifier();
@@ -288,26 +372,38 @@ void SSPlanet::computeMoonPositionVelocity ( double jed, double lt, SSVector &po
     
     if ( _id.identifier() == kLuna )
     {
-        // When planets or the Moon are more than 1 light day away, don't use JPL DE 408; VSOP/ELP is much faster in this case.
+        // If cached, the Moon's heliocentric position and velocity come straight from the cache.
         
-        if ( lt < 1.0 && SSJPLDEphemeris::compute ( 10, jed - lt, false, pos, vel ) )
+        if ( _useEphemerisCache && getEphemerisCache().compute ( kLuna, jed - lt, pos, vel ) )
             return;
+        
+        // If an ephemeris policy chooses a backend for the Moon, that computes its geocentric position;
+        // Earth's is added below. If it can't, or there's no policy, use the default.
+        
+        SSEphemerisBackend backend = _ephemerisPolicy.select ( kLuna, jed - lt );
+        if ( backend == kBackendDefault || ! computeBackendPositionVelocity ( backend, kLuna, jed - lt, pos, vel ) )
+        {
+            // When planets or the Moon are more than 1 light day away, don't use JPL DE 408; VSOP/ELP is much faster in this case.
+            
+            if ( lt < 1.0 && SSJPLDEphemeris::compute ( 10, jed - lt, false, pos, vel ) )
+                return;
 
-        // ELPMPP02 is valid within 3000 years of J2000; use PS Ephemeris if outside that range.
+            // ELPMPP02 is valid within 3000 years of J2000; use PS Ephemeris if outside that range.
 
 #if USE_VSOP_ELP
-        double y = fabs ( jed - lt - SSTime::kJ2000 ) / 365.25;
-        if ( _useVSOPELP && y < 3000.0 )
-            _elp.computePositionVelocity ( jed - lt, pos, vel );
-        else
-            computePSPlanetMoonPositionVelocity ( kLuna, jed, lt, pos, vel );
+            double y = fabs ( jed - lt - SSTime::kJ2000 ) / 365.25;
+            if ( _useVSOPELP && y < 3000.0 )
+                _elp.computePositionVelocity ( jed - lt, pos, vel );
+            else
+                computePSPlanetMoonPositionVelocity ( kLuna, jed, lt, pos, vel );
 #elif USE_VPEPHEMERIS
-        SSVPEphemeris::fundamentalPositionVelocity ( 10, jed - lt, pos, vel );
-        pos *= SSCoordinates::kKmPerEarthRadii / SSCoordinates::kKmPerAU;
-        vel *= SSCoordinates::kKmPerEarthRadii / SSCoordinates::kKmPerAU;
+            SSVPEphemeris::fundamentalPositionVelocity ( 10, jed - lt, pos, vel );
+            pos *= SSCoordinates::kKmPerEarthRadii / SSCoordinates::kKmPerAU;
+            vel *= SSCoordinates::kKmPerEarthRadii / SSCoordinates::kKmPerAU;
 #else
-        computePSPlanetMoonPositionVelocity ( kLuna, jed, lt, pos, vel );
+            computePSPlanetMoonPositionVelocity ( kLuna, jed, lt, pos, vel );
 #endif
+        }
     }
     else
     {
@@ -317,10 +413,8 @@ void SSPlanet::computeMoonPositionVelocity ( double jed, double lt, SSVector &po
         
         if ( p == kMars )
             result = SSMoonEphemeris::marsMoonPositionVelocity ( m, jed - lt, pos, vel );
-        else if ( p == kJupiter )
-            result = SSMoonEphemeris::jupiterMoonPositionVelocity ( m, jed - lt, pos, vel );
-        else if ( p == kSaturn )
-            result = SSMoonEphemeris::saturnMoonPositionVelocity ( m, jed - lt, pos, vel );
+        else if ( p == kJupiter || p == kSaturn )
+            result = computeMoonSystemPositionVelocity ( m, jed, lt, pos, vel );
         else if ( p == kUranus )
             result = SSMoonEphemeris::uranusMoonPositionVelocity ( m, jed - lt, pos, vel );
         else if ( p == kNeptune )
@@ -337,9 +431,12 @@ void SSPlanet::computeMoonPositionVelocity ( double jed, double lt, SSVector &po
     // If JED has changed since last time we computed primary's position and velocity, recompute them.
     // Add primary's position (antedated for light time) and velocity to moon's position and velocity.
     // If light time is less than 1 day, assume primary's velocity is constant over light time duration.
-    // Mutex lock prevents multiple threads from modifying these shared resources simultaneously.
+    // These are kept in the current thread's ephemeris context, so no other thread can modify them.
+    
+    SSEphemerisContext &context = SSEphemerisContext::current();
+    double *primaryJED = context.primaryJED;
+    SSVector *primaryPos = context.primaryPos, *primaryVel = context.primaryVel;
     
-    moon_mutex.lock();
     if ( lt < 1.0 )
     {
         if ( primaryJED[p] != jed )
@@ -360,7 +457,45 @@ void SSPlanet::computeMoonPositionVelocity ( double jed, double lt, SSVector &po
         pos += primaryPos[p];
         vel += primaryVel[p];
     }
-    moon_mutex.unlock();
+}
+
+// Ephemeris function behind the Chebyshev cache. Computes heliocentric position and velocity
+// of a major planet (id = kMercury ... kPluto) or the Moon (id = kLuna) at a specific JED,
+// using whatever uncached ephemeris is currently selected.
+
+bool SSPlanet::ephemerisCacheFunc ( int64_t id, double jed, SSVector &pos, SSVector &vel, void *userData )
+{
+    if ( id != kLuna )
+    {
+        computeUncachedPositionVelocity ( (int) id, jed, 0.0, pos, vel );
+        return true;
+    }
+    
+    SSEphemerisBackend backend = _ephemerisPolicy.select ( kLuna, jed );
+    if ( backend == kBackendDefault || ! computeBackendPositionVelocity ( backend, kLuna, jed, pos, vel ) )
+    {
+        if ( SSJPLDEphemeris::compute ( 10, jed, false, pos, vel ) )
+            return true;
+        
+#if USE_VSOP_ELP
+        if ( _useVSOPELP && fabs ( jed - SSTime::kJ2000 ) / 365.25 < 3000.0 )
+            _elp.computePositionVelocity ( jed, pos, vel );
+        else
+            computePSPlanetMoonPositionVelocity ( kLuna, jed, 0.0, pos, vel );
+#elif USE_VPEPHEMERIS
+        SSVPEphemeris::fundamentalPositionVelocity ( 10, jed, pos, vel );
+        pos *= SSCoordinates::kKmPerEarthRadii / SSCoordinates::kKmPerAU;
+        vel *= SSCoordinates::kKmPerEarthRadii / SSCoordinates::kKmPerAU;
+#else
+        computePSPlanetMoonPositionVelocity ( kLuna, jed, 0.0, pos, vel );
+#endif
+    }
+    
+    SSVector epos, evel;
+    computeUncachedPositionVelocity ( kEarth, jed, 0.0, epos, evel );
+    pos += epos;
+    vel += evel;
+    return true;
 }
 
 // Given a point at planetographic longituade (lon) and latitude (lat) in radians,
@@ -559,20 +694,58 @@ float SSPlanet::computeCometMagnitude ( double rad, double dist, double h, doubl
 
 void SSPlanet::computeEphemeris ( SSCoordinates &coords )
 {
+    SSEphemerisContext::Scope scope ( coords.getEphemerisContext() );
+    
     // Compute planet's heliocentric position and velocity at current JED.
+    
+    SSVector pos, vel;
+    computePositionVelocity ( coords.getJED(), 0.0, pos, vel );
+    computeEphemeris ( coords, pos, vel );
+}
+
+// Computes this solar system object's position, direction, distance, and magnitude, given its
+// geometric heliocentric position (pos) and velocity (vel) at the JED in the SSCoordinates object (coords),
+// i.e. not antedated for light time. Use this when the position is already known, to avoid recomputing it.
+
+void SSPlanet::computeEphemeris ( SSCoordinates &coords, SSVector pos, SSVector vel )
+{
+    SSEphemerisContext::Scope scope ( coords.getEphemerisContext() );
+    
     // Compute distance and light time to planet.
     
     double lt = 0.0;
     double jed = coords.getJED();
-    computePositionVelocity ( jed, lt, _position, _velocity );
+    _position = pos;
+    _velocity = vel;
 
     // If desired, recompute planet's position and velocity antedated for light time.
     // In theory we should iterate but in practice this gets us sub-arcsecond precision!
     
     if ( coords.getLightTime() )
     {
-        lt = ( _position - coords.getObserverPosition() ).magnitude() / coords.kLightAUPerDay;
-        computePositionVelocity ( jed, lt, _position, _velocity );
+        SSVector obsPos = coords.getObserverPosition();
+        lt = ( _position - obsPos ).magnitude() / coords.kLightAUPerDay;
+        bool evaluate = true;
+
+        // With a light time tolerance, refine light time once from the position antedated by velocity alone.
+        // That position is off by at most half the object's acceleration times light time squared;
+        // only re-evaluate the ephemeris if this could be more than the tolerance as seen by the observer.
+        
+        if ( _lightTimeTolerance > 0.0 )
+        {
+            double dist = ( _position - _velocity * lt - obsPos ).magnitude();
+            lt = dist / coords.kLightAUPerDay;
+            double error = accelerationBound() * lt * lt / 2.0 / dist;
+            evaluate = ! ( error <= _lightTimeTolerance );
+        }
+        
+        if ( evaluate )
+            computePositionVelocity ( jed, lt, _position, _velocity );
+        else
+            _position -= _velocity * lt;
+        
+        if ( _countLightTime )
+            recordLightTime ( evaluate );
     }
 
     // We may fail to compute satellite position if TLE is significantly out of date.
@@ -601,6 +774,32 @@ void SSPlanet::computeEphemeris ( SSCoordinates &coords )
         _pmatrix = setPlanetographicMatrix ( jed - lt );
 }
 
+// Returns an upper bound on this object's heliocentric acceleration in AU per day squared, for bounding the error of
+// a first-order light time correction: the Sun's attraction at its current distance, plus for moons, their primary's
+// attraction at periapse; or Earth's surface gravity for artificial satellites. Infinite or NaN if unknown.
+
+double SSPlanet::accelerationBound ( void )
+{
+    static constexpr double kGMSun = SSOrbit::kGaussGravHelio * SSOrbit::kGaussGravHelio;
+    static constexpr double kSurfaceGravity = 9.80665e-3 * SSTime::kSecondsPerDay * SSTime::kSecondsPerDay / SSCoordinates::kKmPerAU;
+
+    if ( _type == kTypeSatellite )
+        return kSurfaceGravity;
+
+    double r = _position.magnitude();
+    if ( r == 0.0 )
+        return 0.0;
+
+    double accel = kGMSun / ( r * r );
+    if ( _type == kTypeMoon )
+    {
+        double g = SSOrbit::gravityConstant ( _orbit.e, _orbit.q, _orbit.mm );
+        accel += _orbit.q > 0.0 ? g * g / ( _orbit.q * _orbit.q ) : INFINITY;
+    }
+
+    return accel;
+}
+
 // Returns this solar system object's apparent motion in the specified
 // coordinate system (frame) as seen from the observer time and location
 // that is stored in the provided SSCoordinates object (coords).
@@ -631,7 +830,11 @@ SSSpherical SSPlanet::computeApparentMotion ( SSCoordinates &coords, SSFrame fra
 
 SSPlanetPtr SSGetPlanetPtr ( SSObjectPtr ptr )
 {
-    return dynamic_cast<SSPlanet *> ( ptr );
+    SSObjectFamily family = ptr ? SSGetObjectFamily ( ptr->getType() ) : kFamilyUnknown;
+    if ( family == kFamilyPlanet )
+        return static_cast<SSPlanet *> ( ptr );
+    
+    return family == kFamilyUnknown ? dynamic_cast<SSPlanet *> ( ptr ) : nullptr;
 }
 
 // Downcasts generic SSObject pointer to SSSatellite pointer.
@@ -639,42 +842,55 @@ SSPlanetPtr SSGetPlanetPtr ( SSObjectPtr ptr )
 
 SSSatellitePtr SSGetSatellitePtr ( SSObjectPtr ptr )
 {
-    return dynamic_cast<SSSatellite *> ( ptr );
+    SSObjectType type = ptr ? ptr->getType() : kTypeNonexistent;
+    if ( type == kTypeSatellite || SSGetObjectFamily ( type ) == kFamilyUnknown )
+        return dynamic_cast<SSSatellite *> ( ptr );
+    
+    return nullptr;
 }
 
 // Returns CSV string from planet data, including identifier and names.
 
 string SSPlanet::toCSV ( void )
 {
-    string csv = SSObject::typeToCode ( _type ) + ",";
+    string csv;
+    appendCSV ( csv );
+    return csv;
+}
+
+// Appends CSV fields from planet data, including identifier and names, to a string (csv).
+
+void SSPlanet::appendCSV ( string &csv )
+{
+    csv += SSObject::typeToCode ( _type ) + ",";
     
     if ( _type == kTypeMoon )
-        csv += ::isinf ( _orbit.q ) ? "," : format ( "%.0f,", _orbit.q * SSCoordinates::kKmPerAU );
+        append_csv_fixed ( csv, _orbit.q * SSCoordinates::kKmPerAU, 0 );
     else
-        csv += ::isinf ( _orbit.q ) ? "," : format ( "%.8f,", _orbit.q );
-
-    csv += ::isinf ( _orbit.e ) ? "," : format ( "%.8f,", _orbit.e );
-    csv += ::isinf ( _orbit.i ) ? "," : format ( "%.8f,", _orbit.i * SSAngle::kDegPerRad );
-    csv += ::isinf ( _orbit.w ) ? "," : format ( "%.8f,", _orbit.w * SSAngle::kDegPerRad );
-    csv += ::isinf ( _orbit.n ) ? "," : format ( "%.8f,", _orbit.n * SSAngle::kDegPerRad );
-    csv += ::isinf ( _orbit.m ) ? "," : format ( "%.8f,", _orbit.m * SSAngle::kDegPerRad );
-    csv += ::isinf ( _orbit.mm ) ? "," : format ( "%.8f,", _orbit.mm * SSAngle::kDegPerRad );
-    csv += ::isinf ( _orbit.t ) ? "," : format ( "%.4f,", _orbit.t );
-    
-    csv += ::isinf ( _Hmag ) ? "," : format ( "%+.2f,", _Hmag );
-    csv += ::isinf ( _Gmag ) ? "," : format ( "%+.2f,", _Gmag );
-    csv += ::isinf ( _radius ) ? "," : format ( "%.1f,", _radius );
-    csv += ::isinf ( _mass ) ? "," : format ( "%.6E,", _mass * SSCoordinates::kKgPerEarthMass );
-    csv += ::isinf ( _rotper ) ? "," : format ( "%.5f,", _rotper );
-    csv += ::isinf ( _albedo ) ? "," : format ( "%.3f,", _albedo );
+        append_csv_fixed ( csv, _orbit.q, 8 );
+
+    append_csv_fixed ( csv, _orbit.e, 8 );
+    append_csv_fixed ( csv, _orbit.i * SSAngle::kDegPerRad, 8 );
+    append_csv_fixed ( csv, _orbit.w * SSAngle::kDegPerRad, 8 );
+    append_csv_fixed ( csv, _orbit.n * SSAngle::kDegPerRad, 8 );
+    append_csv_fixed ( csv, _orbit.m * SSAngle::kDegPerRad, 8 );
+    append_csv_fixed ( csv, _orbit.mm * SSAngle::kDegPerRad, 8 );
+    append_csv_fixed ( csv, _orbit.t, 4 );
+    
+    append_csv_fixed ( csv, _Hmag, 2, true );
+    append_csv_fixed ( csv, _Gmag, 2, true );
+    append_csv_fixed ( csv, _radius, 1 );
+    if ( ! ::isinf ( _mass ) )
+        appendf ( csv, "%.6E", _mass * SSCoordinates::kKgPerEarthMass );
+    csv += ",";
+    append_csv_fixed ( csv, _rotper, 5 );
+    append_csv_fixed ( csv, _albedo, 3 );
 
     // Never print identifier for comets, since this is always duplicated in the first name.
     
     csv += _id && _type != kTypeComet ? _id.toString() + "," : ",";
     for ( int i = 0; i < _names.size(); i++ )
         csv += _names[i] + ",";
-
-    return csv;
 }
 
 // Allocates a new SSPlanet and initializes it from a CSV-formatted string.
@@ -682,9 +898,17 @@ string SSPlanet::toCSV ( void )
 
 SSObjectPtr SSPlanet::fromCSV ( string csv )
 {
-    vector<string> fields = split ( csv, "," );
-    
-    SSObjectType type = SSObject::codeToType ( fields[0] );
+    SSCSVFields fields;
+    fields.split ( csv );
+    return fromCSV ( fields );
+}
+
+// Allocates a new SSPlanet and initializes it from a CSV-formatted string already split into fields.
+// Returns nullptr on error (invalid CSV fields, heap allocation failure, etc.)
+
+SSObjectPtr SSPlanet::fromCSV ( const SSCSVFields &fields )
+{
+    SSObjectType type = SSObject::codeToType ( fields.str ( 0 ) );
     if ( type < kTypePlanet || type > kTypeComet || fields.size() < 17 )
         return nullptr;
     
@@ -713,11 +937,11 @@ SSObjectPtr SSPlanet::fromCSV ( string csv )
     if ( type == kTypePlanet || type == kTypeMoon )
         ident = SSIdentifier ( kCatJPLanet, strtoint ( fields[15] ) );
     else
-        ident = SSIdentifier::fromString ( fields[15] );
+        ident = SSIdentifier::fromString ( fields.str ( 15 ) );
 
     vector<string> names;
     for ( int i = 16; i < fields.size(); i++ )
-        names.push_back ( trim ( fields[i] ) );
+        names.push_back ( fields.str ( i ) );
     
 	SSObjectPtr pObject = SSNewObject ( type );
     SSPlanetPtr pPlanet = SSGetPlanetPtr ( pObject );
@@ -740,20 +964,37 @@ SSObjectPtr SSPlanet::fromCSV ( string csv )
 // Constructs a satellite object from an input Two-Line Element descriptor (tle).
 
 SSSatellite::SSSatellite ( SSTLE &tle ) : SSPlanet ( kTypeSatellite )
+{
+    _names.resize ( 2 );
+    setTLE ( tle );
+    
+    _launchDate = INFINITY;
+    _launchSite = _sourceCountry = "";
+}
+
+// Replaces satellite's TLE (tle), and updates its name, designation, identifier, and Keplerian orbit from it.
+// SGP4/SDP4 arguments depending on the old elements are discarded, as are the position, velocity, direction,
+// distance, and magnitude from the last ephemeris computation; other properties are unchanged.
+
+void SSSatellite::setTLE ( const SSTLE &tle )
 {
     _tle = tle;
 
-    _names.push_back ( tle.name );
-    _names.push_back ( tle.desig );
+    if ( _names.size() < 2 )
+        _names.resize ( 2 );
+    
+    _names[0] = tle.name;
+    _names[1] = tle.desig;
     
     _id = SSIdentifier ( kCatNORADSat, tle.norad );
     
-    _orbit = tle.toOrbit ( 0.0 );
+    _orbit = _tle.toOrbit ( 0.0 );
     _orbit.q *= SSCoordinates::kKmPerEarthRadii / SSCoordinates::kKmPerAU;
     _orbit.mm *= SSTime::kMinutesPerDay;
     
-    _launchDate = INFINITY;
-    _launchSite = _sourceCountry = "";
+    _position = _velocity = SSVector ( INFINITY, INFINITY, INFINITY );
+    _direction = SSVector ( INFINITY, INFINITY, INFINITY );
+    _distance = _magnitude = INFINITY;
 }
 
 // Computes satellite visual magnitude.
@@ -772,6 +1013,17 @@ float SSSatellite::computeSatelliteMagnitude ( double dist, double phase, double
     return mag;
 }
 
+// Returns heap memory owned by this satellite, including its radio frequency data strings.
+
+size_t SSSatellite::heapBytes ( void )
+{
+    size_t bytes = SSPlanet::heapBytes() + strbytes ( _sourceCountry ) + strbytes ( _launchSite ) + vecbytes ( _freqData );
+    for ( FreqData &freq : _freqData )
+        bytes += strbytes ( freq.name ) + strbytes ( freq.uplink ) + strbytes ( freq.downlink ) + strbytes ( freq.beacon ) + strbytes ( freq.mode ) + strbytes ( freq.callsign ) + strbytes ( freq.status );
+    
+    return bytes;
+}
+
 // Computes this satellite's magnitude using above formula.
 // Satellite's distance from sun (rad) and from observer (dist) are both in AU.
 // Satellite's phase angle (phase) is in radians.
@@ -789,27 +1041,24 @@ float SSSatellite::computeMagnitude ( double rad, double dist, double phase )
 // Also computes satellite's "planetographic" orientation matrix, which describes how the
 // satellite is oriented relative to the Earth's J2000 mean equatorial (fundamental) frame.
 
-mutex sat_mutex;
-
 void SSSatellite::computePositionVelocity ( double jed, double lt, SSVector &pos, SSVector &vel )
 {
-    static SSVector earthPos, earthVel;
-    static SSMatrix earthMat;
-    static double earthJED = 0.0, deltaT = 0.0;
-    
     // Recompute Earth's position and velocity relative to Sun if JED has changed.
     // Asssume Earth's velocity is constant over light time duration.
-    // Sat mutex prevents multiple threads from modifying these shared resources simultaneously.
+    // These are kept in the current thread's ephemeris context, so no other thread can modify them.
     
-    sat_mutex.lock();
-    if ( jed != earthJED )
+    SSEphemerisContext &context = SSEphemerisContext::current();
+    if ( jed != context.earthJED )
     {
-        computeMajorPlanetPositionVelocity ( kEarth, jed, 0.0, earthPos, earthVel );
-        earthJED = jed;
-        deltaT = SSTime ( jed ).getDeltaT() / SSTime::kSecondsPerDay;
-        earthMat = SSCoordinates::getPrecessionMatrix ( jed ).transpose();
+        computeMajorPlanetPositionVelocity ( kEarth, jed, 0.0, context.earthPos, context.earthVel );
+        context.earthJED = jed;
+        context.deltaT = SSTime ( jed ).getDeltaT() / SSTime::kSecondsPerDay;
+        context.earthMat = SSCoordinates::getPrecessionMatrix ( jed ).transpose();
     }
-    sat_mutex.unlock();
+    
+    double deltaT = context.deltaT;
+    SSVector &earthPos = context.earthPos, &earthVel = context.earthVel;
+    SSMatrix &earthMat = context.earthMat;
     
     // Compute satellite position & velocity relative to Earth, antedated for light time.
     // Satellite's orbit epoch is Julian Date, not JED, so subtract Delta T.
@@ -861,6 +1110,7 @@ void SSSatellite::computePositionVelocity ( double jed, double lt, SSVector &pos
     _pmatrix.m02 = zaxis.x;
     _pmatrix.m12 = zaxis.y;
     _pmatrix.m22 = zaxis.z;
+    _pmatrixJED = NAN;
     
     // Add Earth's position (antedated for light time) and velocity to satellite position and velocity.
     
@@ -868,6 +1118,19 @@ void SSSatellite::computePositionVelocity ( double jed, double lt, SSVector &pos
     vel += earthVel;
 }
 
+// Reads the next TLE record from a line reader (file) into (tle). Its first two lines are copied into strings (line0, line1),
+// since reading a line invalidates the view of the line before; the third is parsed in place.
+// Returns 0 if successful or a negative number on failure, the same as SSTLE::read().
+
+static int read_tle ( SSLineReader &file, SSTLE &tle, string &line0, string &line1 )
+{
+    SSSpan<char> line2;
+    if ( ! file.getline ( line0 ) || ! file.getline ( line1 ) || ! file.getline ( line2 ) )
+        return -1;
+    
+    return tle.parse ( SSSpan<char> ( line0.data(), line0.size() ), SSSpan<char> ( line1.data(), line1.size() ), line2 );
+}
+
 // Imports satellites from TLE-formatted text file (filename).
 // Imported satellites are appended to the input vector of SSObjects (satellites).
 // Returns number of satellites successfully imported.
@@ -876,17 +1139,17 @@ int SSImportSatellitesFromTLE ( const string &filename, SSObjectVec &satellites
 {
     // Open file; return on failure.
 
-    FILE *file = fopen ( filename.c_str(), "rb" );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
-    // Read file line-by-line until we reach end-of-file
+    // Parse three lines at a time until we reach end-of-file or an invalid TLE.
 
-    string line = "";
     int numSats = 0;
     SSTLE tle;
     
-    while ( tle.read ( file ) == 0 )
+    string line0, line1;
+    while ( read_tle ( file, tle, line0, line1 ) == 0 )
     {
         // Attempt to create solar system object from TLE; if successful add to object vector.
         
@@ -898,12 +1161,102 @@ int SSImportSatellitesFromTLE ( const string &filename, SSObjectVec &satellites
         }
     }
     
-    // Close file. Return number of objects added to object vector.
+    // Return number of objects added to object vector.
 
-    fclose ( file );
     return numSats;
 }
 
+// Returns true if two TLEs have the same name, designation, epoch, and mean elements.
+
+static bool same_tle ( const SSTLE &tle1, const SSTLE &tle2 )
+{
+    return tle1.jdepoch == tle2.jdepoch && tle1.xno == tle2.xno && tle1.eo == tle2.eo && tle1.xincl == tle2.xincl
+        && tle1.xnodeo == tle2.xnodeo && tle1.omegao == tle2.omegao && tle1.xmo == tle2.xmo && tle1.bstar == tle2.bstar
+        && tle1.xndt2o == tle2.xndt2o && tle1.xndd6o == tle2.xndd6o && tle1.name == tle2.name && tle1.desig == tle2.desig;
+}
+
+// Updates the satellites in an object vector (satellites), which may contain any solar system objects,
+// from a TLE file (filename), matching them by NORAD number. Satellites whose TLE changed (epoch, elements,
+// name or designation) get the new TLE with SSSatellite::setTLE(), which resets only their own cached
+// propagator state and ephemeris; unchanged satellites are not touched at all. Satellites not yet in the
+// vector are appended, in file order. Satellites missing from the file are deleted and removed from the vector
+// only if (removeMissing) is true. NORAD numbers of added, changed, and missing satellites are returned in (update).
+// Returns number of TLEs read from the file, or 0 if the file cannot be opened.
+
+int SSUpdateSatellitesFromTLE ( const string &filename, SSObjectVec &satellites, SSTLEUpdate &update, bool removeMissing )
+{
+    update.added.clear();
+    update.changed.clear();
+    update.removed.clear();
+    update.unchanged = 0;
+    
+    SSLineReader file ( filename );
+    if ( ! file )
+        return 0;
+    
+    // Index loaded satellites by NORAD number. If a number appears more than once, the first one is updated.
+    
+    unordered_map<int,SSSatellitePtr> loaded;
+    for ( size_t i = 0; i < satellites.size(); i++ )
+    {
+        SSSatellitePtr pSat = SSGetSatellitePtr ( satellites[i] );
+        if ( pSat )
+            loaded.insert ( { pSat->getTLE().norad, pSat } );
+    }
+    
+    unordered_map<int,bool> seen;
+    int numTLEs = 0;
+    SSTLE tle;
+    
+    string line0, line1;
+    while ( read_tle ( file, tle, line0, line1 ) == 0 )
+    {
+        numTLEs++;
+        if ( ! seen.insert ( { tle.norad, true } ).second )
+            continue;
+        
+        auto it = loaded.find ( tle.norad );
+        if ( it == loaded.end() )
+        {
+            satellites.append ( new SSSatellite ( tle ) );
+            update.added.push_back ( tle.norad );
+        }
+        else if ( ! same_tle ( it->second->getTLE(), tle ) )
+        {
+            it->second->setTLE ( tle );
+            update.changed.push_back ( tle.norad );
+        }
+        else
+        {
+            update.unchanged++;
+        }
+    }
+    
+    // Find satellites which were not in the file, and delete them if desired, keeping order of remaining objects.
+    
+    size_t n = 0;
+    for ( size_t i = 0; i < satellites.size(); i++ )
+    {
+        SSObjectPtr pObj = satellites[i];
+        SSSatellitePtr pSat = SSGetSatellitePtr ( pObj );
+        if ( pSat && seen.find ( pSat->getTLE().norad ) == seen.end() )
+        {
+            update.removed.push_back ( pSat->getTLE().norad );
+            if ( removeMissing )
+            {
+                delete pObj;
+                continue;
+            }
+        }
+        
+        satellites.set ( n++, pObj );
+    }
+    
+    while ( satellites.size() > n )
+        satellites.remove ( satellites.size() - 1 );
+    
+    return numTLEs;
+}
 
 // Imports a Mike McCants satellite names file, here:
 // https://www.prismnet.com/~mmccants/tles/mcnames.zip
@@ -914,7 +1267,7 @@ int SSImportMcNames ( const string &filename, McNameMap &mcnames )
 {
     // Open file; return on failure.
 
-    FILE *file = fopen ( filename.c_str(), "rb" );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -923,7 +1276,7 @@ int SSImportMcNames ( const string &filename, McNameMap &mcnames )
     string line = "";
     int nMcNames = 0;
     
-    while ( fgetline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         McName mcname = { 0, "", 0.0, 0.0, 0.0, 0.0 };
         
@@ -950,9 +1303,8 @@ int SSImportMcNames ( const string &filename, McNameMap &mcnames )
         nMcNames++;
     }
     
-    // Close file. Return number of objects added to object vector.
+    // Return number of objects added to object vector. File will close automatically.
 
-    fclose ( file );
     return nMcNames;
 }
 
@@ -988,10 +1340,10 @@ int SSImportMcNames ( const string &filename, SSObjectVec &objects )
         // Get satellite's NORAD number. Look for McName record with same number.
         // If we find one, copy McName magnitude and size into satellite.
         
-        int norad = pSat->getTLE().norad;
-        McName mcname = mcnamemap[norad];
-        if ( mcname.norad == norad )
+        auto it = mcnamemap.find ( pSat->getTLE().norad );
+        if ( it != mcnamemap.end() )
         {
+            const McName &mcname = it->second;
             pSat->setHMagnitude ( mcname.mag );
             pSat->setRadius ( mcname.len / 2000.0 );
             n++;
@@ -1012,7 +1364,7 @@ int SSImportSatelliteFrequencyData ( const string &filename, SatFreqMap &freqmap
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -1022,7 +1374,7 @@ int SSImportSatelliteFrequencyData ( const string &filename, SatFreqMap &freqmap
     int nFreqs = 0;
     vector<SSSatellite::FreqData> freqvec;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         vector<string> fields = split ( line, ";" );
         if ( fields.size() < 8 )
@@ -1056,6 +1408,11 @@ int SSImportSatelliteFrequencyData ( const string &filename, SatFreqMap &freqmap
         freqvec.push_back ( freq );
     }
     
+    // Insert the last satellite's frequencies, which no following record did.
+    
+    if ( freqvec.size() > 0 )
+        freqmap.insert ( { freqvec[0].norad, freqvec } );
+    
     // Return number of frequencies read from file.  File will close automatically.
 
     return nFreqs;
@@ -1091,12 +1448,11 @@ int SSImportSatelliteFrequencyData ( const string &filename, SSObjectVec &object
         // Get satellite's NORAD number. Look for satellite frequency vector with same number.
         // If we find one, copy satellite frequency vector into satellite.
         
-        int norad = pSat->getTLE().norad;
-        vector<SSSatellite::FreqData> freqvec = freqmap[norad];
-        if ( freqvec.size() > 0 && freqvec[0].norad == norad )
+        auto it = freqmap.find ( pSat->getTLE().norad );
+        if ( it != freqmap.end() && it->second.size() > 0 )
         {
-            pSat->setRadioFrequencies ( freqvec );
-            n += freqvec.size();
+            pSat->setRadioFrequencies ( it->second );
+            n += it->second.size();
         }
     }
     
@@ -1114,7 +1470,7 @@ int SSImportN2Data ( const string &filename, N2DataMap &datamap )
 {
     // Open file; return on failure.
 
-    ifstream file ( filename );
+    SSLineReader file ( filename );
     if ( ! file )
         return 0;
 
@@ -1123,7 +1479,7 @@ int SSImportN2Data ( const string &filename, N2DataMap &datamap )
     string line = "";
     int n = 0;
 
-    while ( getline ( file, line ) )
+    while ( file.getline ( line ) )
     {
         vector<string> fields = split_csv ( line );
         if ( fields.size() < 8 )
@@ -1137,8 +1493,11 @@ int SSImportN2Data ( const string &filename, N2DataMap &datamap )
         data.source = fields[3];
         data.description = fields[4];
         data.launch_site = fields[5];
-        data.launch_date = SSTime ( SSDate ( "%Y-%m-%d", fields[6] ) );
-        data.decay_date = SSTime ( SSDate ( "%Y-%m-%d", fields[7] ) );
+        SSDate launch ( kGregorian, 0.0, 0, 0, 0, 0, 0, 0.0 ), decay = launch;
+        launch.parseISO ( fields[6] );
+        decay.parseISO ( fields[7] );
+        data.launch_date = SSTime ( launch );
+        data.decay_date = SSTime ( decay );
         if ( data.decay_date < SSTime::kB1950 )
             data.decay_date = INFINITY;
         
@@ -1182,10 +1541,10 @@ int SSImportN2Data ( const string &filename, SSObjectVec &satellites )
         // Get satellite's NORAD number. Look for McName record with same number.
         // If we find one, copy McName magnitude and size into satellite.
         
-        int norad = pSat->getTLE().norad;
-        N2Data data = datamap[norad];
-        if ( data.norad == norad )
+        auto it = datamap.find ( pSat->getTLE().norad );
+        if ( it != datamap.end() )
         {
+            const N2Data &data = it->second;
             pSat->setTaxonomy ( data.type );
             pSat->setDescription ( data.description );
             pSat->setSourceCountry ( data.source );
@@ -1205,6 +1564,7 @@ int SSImportN2Data ( const string &filename, SSObjectVec &satellites )
 void SSPlanet::useVSOPELP ( bool use )
 {
     _useVSOPELP = use;
+    getEphemerisCache().clear();
 }
 
 bool SSPlanet::useVSOPELP ( void )
@@ -1212,6 +1572,18 @@ bool SSPlanet::useVSOPELP ( void )
     return _useVSOPELP;
 }
 
+void SSPlanet::setVSOPELPPrecision ( double prec )
+{
+    VSOP2013::setPrecision ( prec );
+    ELPMPP02::setPrecision ( prec );
+    getEphemerisCache().clear();
+}
+
+double SSPlanet::getVSOPELPPrecision ( void )
+{
+    return VSOP2013::getPrecision();
+}
+
 #else
 
 void SSPlanet::useVSOPELP ( bool use )
@@ -1223,7 +1595,254 @@ bool SSPlanet::useVSOPELP ( void )
     return false;
 }
 
+void SSPlanet::setVSOPELPPrecision ( double prec )
+{
+}
+
+double SSPlanet::getVSOPELPPrecision ( void )
+{
+    return 0.0;
+}
+
+#endif
+
+void SSPlanet::setEphemerisPolicy ( const SSEphemerisPolicy &policy )
+{
+    _ephemerisPolicy = policy;
+    getEphemerisCache().clear();
+}
+
+SSEphemerisPolicy SSPlanet::getEphemerisPolicy ( void )
+{
+    return _ephemerisPolicy;
+}
+
+bool SSPlanet::computeBackendPositionVelocity ( SSEphemerisBackend backend, int id, double jed, SSVector &pos, SSVector &vel )
+{
+    if ( SSEphemerisPolicy::bodyIndex ( id ) < 0 )
+        return false;
+    
+    if ( id == kSun && backend != kBackendDefault )
+    {
+        pos = vel = SSVector ( 0.0, 0.0, 0.0 );
+        return true;
+    }
+    
+    if ( backend == kBackendJPLDE )
+    {
+        // JPL DE computes the Moon heliocentric; subtract Earth, computed at the same time.
+        
+        if ( id != kLuna )
+            return SSJPLDEphemeris::compute ( id, jed, false, pos, vel );
+        
+        SSVector positions[SSJPLDEReader::kNumBodies], velocities[SSJPLDEReader::kNumBodies];
+        if ( ! SSJPLDEphemeris::compute ( ( 1u << kEarth ) | ( 1u << 10 ), jed, false, positions, velocities ) )
+            return false;
+        
+        pos = positions[10] - positions[kEarth];
+        vel = velocities[10] - velocities[kEarth];
+        return true;
+    }
+    
+    if ( backend == kBackendVSOPELP )
+    {
+#if USE_VSOP_ELP
+        // VSOP2013 is valid from years -4000 to +8000, ELPMPP02 within 3000 years of J2000;
+        // Earth's position is corrected from Earth-Moon barycenter within that range.
+        
+        double y = fabs ( jed - SSTime::kJ2000 ) / 365.25;
+        if ( id == kLuna )
+        {
+            if ( y >= 3000.0 )
+                return false;
+            
+            _elp.computePositionVelocity ( jed, pos, vel );
+            return true;
+        }
+        
+        if ( y >= 6000.0 )
+            return false;
+        
+        _vsop.computePositionVelocity ( id, jed, pos, vel );
+        if ( id == kEarth && y < 3000.0 )
+        {
+            SSVector mpos, mvel;
+            _elp.computePositionVelocity ( jed, mpos, mvel );
+            pos -= mpos * _elp.kMoonEarthMassRatio;
+            vel -= mvel * _elp.kMoonEarthMassRatio;
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+    
+    if ( backend == kBackendPS )
+    {
+        computePSPlanetMoonPositionVelocity ( id, jed, 0.0, pos, vel );
+        return true;
+    }
+    
+    if ( backend == kBackendVP )
+    {
+        SSVPEphemeris::fundamentalPositionVelocity ( id == kLuna ? 10 : id, jed, pos, vel );
+        if ( id == kLuna )
+        {
+            pos *= SSCoordinates::kKmPerEarthRadii / SSCoordinates::kKmPerAU;
+            vel *= SSCoordinates::kKmPerEarthRadii / SSCoordinates::kKmPerAU;
+        }
+        return true;
+    }
+    
+    return false;
+}
+
+// Turns Chebyshev caching of major planet and Moon positions on or off. Window spans
+// are reset to defaults which suit the default cache tolerance and polynomial degree.
+
+void SSPlanet::useEphemerisCache ( bool use )
+{
+    static const double spans[10] = { 0.0, 8.0, 16.0, 16.0, 32.0, 64.0, 128.0, 128.0, 128.0, 128.0 };
+    
+    if ( use && ! _useEphemerisCache )
+    {
+        for ( int id = kMercury; id <= kPluto; id++ )
+            getEphemerisCache().setSpan ( id, spans[id] );
+        getEphemerisCache().setSpan ( kLuna, 2.0 );
+    }
+    
+    _useEphemerisCache = use;
+    getEphemerisCache().clear();
+}
+
+bool SSPlanet::useEphemerisCache ( void )
+{
+    return _useEphemerisCache;
+}
+
+// Returns the Chebyshev cache used for major planet and Moon positions.
+// It is constructed on first use, with default tolerance and memory limit.
+
+SSChebyshevCache &SSPlanet::getEphemerisCache ( void )
+{
+    static SSChebyshevCache cache ( ephemerisCacheFunc );
+    return cache;
+}
+
+void SSPlanet::setLightTimeTolerance ( double tol )
+{
+    _lightTimeTolerance = tol;
+}
+
+double SSPlanet::getLightTimeTolerance ( void )
+{
+    return _lightTimeTolerance;
+}
+
+void SSPlanet::countLightTime ( bool count )
+{
+    _countLightTime = count;
+}
+
+bool SSPlanet::countLightTime ( void )
+{
+    return _countLightTime;
+}
+
+void SSPlanet::recordLightTime ( bool evaluated )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _lightTimeMutex );
+#endif
+    LightTimeStats &stats = _lightTimeStats[ this ];
+    if ( evaluated )
+        stats.evaluations++;
+    else
+        stats.firstOrder++;
+}
+
+map<SSPlanet *, SSPlanet::LightTimeStats> SSPlanet::getLightTimeStats ( void )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _lightTimeMutex );
+#endif
+    return _lightTimeStats;
+}
+
+void SSPlanet::resetLightTimeStats ( void )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _lightTimeMutex );
 #endif
+    _lightTimeStats.clear();
+}
+
+// Ephemeris function used to compile Chebyshev ephemeris files. User data points to a map
+// of identifiers to objects; computes an object's position without light time.
+
+bool SSPlanet::ephemerisFileFunc ( int64_t id, double jed, SSVector &pos, SSVector &vel, void *userData )
+{
+    map<int64_t,SSPlanet *> *objmap = (map<int64_t,SSPlanet *> *) userData;
+    map<int64_t,SSPlanet *>::iterator it = objmap->find ( id );
+    if ( it == objmap->end() )
+        return false;
+    
+    it->second->computePositionVelocity ( jed, 0.0, pos, vel );
+    return true;
+}
+
+// Compiles heliocentric positions of objects (planets, moons, asteroids, comets) from jed0 to jed1
+// into a Chebyshev ephemeris file (filename), to a tolerance relative to each object's distance.
+// Satellites and objects with duplicate identifiers are skipped. Any ephemeris file already open
+// is ignored while compiling, so positions come from the underlying ephemerides.
+// Returns true if successful or false on failure.
+
+bool SSPlanet::compileEphemerisFile ( const string &filename, vector<SSPlanet *> &objects, double jed0, double jed1, double tolerance )
+{
+    map<int64_t,SSPlanet *> objmap;
+    vector<int64_t> ids;
+    
+    for ( SSPlanet *pPlanet : objects )
+    {
+        if ( pPlanet == nullptr || pPlanet->getType() == kTypeSatellite )
+            continue;
+        
+        int64_t id = pPlanet->getIdentifier();
+        if ( objmap.insert ( make_pair ( id, pPlanet ) ).second )
+            ids.push_back ( id );
+    }
+    
+    _compilingEphemerisFile = true;
+    bool result = SSChebyshevEphemeris::compile ( filename, ids, jed0, jed1, tolerance, ephemerisFileFunc, &objmap );
+    _compilingEphemerisFile = false;
+    
+    return result;
+}
+
+// Opens a compiled Chebyshev ephemeris file; closes any file already open.
+// Clears the ephemeris cache, since positions may now come from the file.
+
+bool SSPlanet::openEphemerisFile ( const string &filename )
+{
+    bool result = _ephemerisFile.open ( filename );
+    getEphemerisCache().clear();
+    return result;
+}
+
+// Closes compiled Chebyshev ephemeris file, if open.
+
+void SSPlanet::closeEphemerisFile ( void )
+{
+    _ephemerisFile.close();
+    getEphemerisCache().clear();
+}
+
+// Returns the compiled Chebyshev ephemeris file used for planet, moon, and minor planet positions.
+
+SSChebyshevEphemeris &SSPlanet::getEphemerisFile ( void )
+{
+    return _ephemerisFile;
+}
 
 // Calculates planet's rotational elements at the specified Julian Ephemeris Date (jed).
 // Returns J2000 right ascension (a0) and declination (d0) of planet's north pole in radians;
@@ -1635,14 +2254,20 @@ void SSPlanet::rotationElements ( double jed, double &a0, double &d0, double &w,
 }
 
 // Computes matrix which transforms coordinates from planetographic
-// frame to J2000 equatorial frame.
+// frame to J2000 equatorial frame. The rotation elements are only recomputed
+// if the Julian Ephemeris Date (jed) differs from the last one this was called with,
+// so repeated ephemeris computations of the same object at the same time reuse the matrix.
 
 SSMatrix SSPlanet::setPlanetographicMatrix ( double jed )
 {
+    if ( jed == _pmatrixJED )
+        return _pmatrix;
+    
     double a0, d0, w, dw;
     
     rotationElements ( jed, a0, d0, w, dw );
     _pmatrix = SSMatrix::rotation ( 3, 2, w, 0, SSAngle::kHalfPi - d0, 2, a0 + SSAngle::kHalfPi );
+    _pmatrixJED = jed;
     
     return _pmatrix;
 }
@@ -1683,7 +2308,7 @@ double SSPlanet::getFlattening ( void )
 SSSpherical SSPlanet::centralCoordinates ( void )
 {
     SSVector direction = getDirection() * -1.0;
-    SSSpherical coords = _pmatrix.transpose() * direction;
+    SSSpherical coords = _pmatrix.transposeMultiply ( direction );
     return coords;
 }
 
@@ -1693,7 +2318,7 @@ SSSpherical SSPlanet::centralCoordinates ( void )
 SSSpherical SSPlanet::subsolarCoordinates ( void )
 {
     SSVector position = getPosition().normalize() * -1.0;
-    SSSpherical coords = _pmatrix.transpose() * position;
+    SSSpherical coords = _pmatrix.transposeMultiply ( position );
     return coords;
 }
 
@@ -1780,6 +2405,85 @@ bool SSPlanet::rayIntersect ( SSVector p, SSVector r, double &d, SSVector &q, fl
     return true;
 }
 
+// Batch version of rayIntersect() for (n) rays from the same external point (p), e.g. the observer's position for every
+// pixel of a planet's disk. The rays' unit direction vectors are given as separate arrays of x, y, z coordinates (ux, uy, uz),
+// all in the fundamental J2000 mean equatorial frame, and the planet's radius is multiplied by a scale factor (s).
+// For each ray, sets hit mask (hit) to 1 if the ray intersects the planet's ellipsoid or 0 if not, distance (d) from (p)
+// to the nearest intersection, and its planetographic longitude and latitude (lon, lat) in radians, defined so that
+// surfacePointDirection() maps them back to the intersection point. Distances, longitudes, and latitudes are NaN on a miss;
+// (lon) and (lat) may be null if not wanted. Returns the number of rays which intersect the planet.
+
+size_t SSPlanet::rayIntersect ( SSVector p, size_t n, const double *ux, const double *uy, const double *uz, uint8_t *hit, double *d, double *lon, double *lat, float s )
+{
+    // Quantities which depend only on the external point and the planet, as in the single-ray version,
+    // with the point relative to the planet's center in the planetographic frame.
+    
+    SSMatrix tmatrix = _pmatrix.transpose();
+    SSVector c = tmatrix * ( p - _position );
+    double re = _radius < INFINITY ? _radius * s / SSCoordinates::kKmPerAU : 0.0;
+    double f = getFlattening();
+    double x = c.x, y = c.y, z = c.z;
+    double a2 = re * re, b2 = a2 * ( 1.0 - f ) * ( 1.0 - f );
+    double k = b2 * ( x * x + y * y - a2 ) + a2 * z * z;
+    double m00 = tmatrix.m00, m01 = tmatrix.m01, m02 = tmatrix.m02;
+    double m10 = tmatrix.m10, m11 = tmatrix.m11, m12 = tmatrix.m12;
+    double m20 = tmatrix.m20, m21 = tmatrix.m21, m22 = tmatrix.m22;
+    
+    if ( re == 0.0 )
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            hit[i] = 0;
+            d[i] = NAN;
+            if ( lon && lat )
+                lon[i] = lat[i] = NAN;
+        }
+        return 0;
+    }
+    
+    // Intersect each ray without branches or function calls other than sqrt, so compilers can vectorize the loop.
+    // A ray misses if it points away from the planet's center, or its quadratic has no real solution.
+    
+    size_t hits = 0;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double u = m00 * ux[i] + m01 * uy[i] + m02 * uz[i];
+        double v = m10 * ux[i] + m11 * uy[i] + m12 * uz[i];
+        double w = m20 * ux[i] + m21 * uy[i] + m22 * uz[i];
+        double qa = b2 * ( u * u + v * v ) + a2 * w * w;
+        double qb = b2 * ( u * x + v * y ) + a2 * w * z;
+        double disc = qb * qb - qa * k;
+        bool h = disc >= 0.0 && u * x + v * y + w * z <= 0.0;
+        double t = - ( qb + sqrt ( disc > 0.0 ? disc : 0.0 ) ) / qa;
+        hit[i] = h;
+        d[i] = h ? t : NAN;
+        hits += h;
+    }
+    
+    // Planetographic coordinates of intersection points, with the polar axis stretched by the flattening, as undone by surfacePointDirection().
+
+    if ( lon && lat )
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            if ( ! hit[i] )
+            {
+                lon[i] = lat[i] = NAN;
+                continue;
+            }
+            
+            double t = d[i];
+            double qx = x + t * ( m00 * ux[i] + m01 * uy[i] + m02 * uz[i] );
+            double qy = y + t * ( m10 * ux[i] + m11 * uy[i] + m12 * uz[i] );
+            double qz = z + t * ( m20 * ux[i] + m21 * uy[i] + m22 * uz[i] );
+            lon[i] = mod2pi ( atan2 ( qy, qx ) );
+            lat[i] = atan2 ( qz / ( 1.0 - f ), sqrt ( qx * qx + qy * qy ) );
+        }
+    }
+    
+    return hits;
+}
+
 // Returns length of this solar system object's umbral shadow cone, in AU,
 // with the object's physical radius multipled by a scale factor (s).
 // Uses hard-coded Sun radius of 695500 km.
@@ -11,10 +11,15 @@
 #ifndef SSPlanet_hpp
 #define SSPlanet_hpp
 
+#include <unordered_map>
+
 #include "SSObject.hpp"
 #include "SSOrbit.hpp"
 #include "SSCoordinates.hpp"
 #include "SSTLE.hpp"
+#include "SSChebyshevCache.hpp"
+#include "SSChebyshevEphemeris.hpp"
+#include "SSEphemerisPolicy.hpp"
 
 enum SSPlanetID
 {
@@ -82,13 +87,16 @@ protected:
     SSVector    _position;      // current heliocentric position in fundamental frame in AU
     SSVector    _velocity;      // current heliocentric velocity in fundamental frame in AU per day
     SSMatrix    _pmatrix;       // transforms from planetographic to fundamental J2000 mean equatorial frame.
+    double      _pmatrixJED;    // Julian Ephemeris Date for which setPlanetographicMatrix() last computed _pmatrix; NaN if none.
     
     void computeMinorPlanetPositionVelocity ( double jed, double lt, SSVector &pos, SSVector &vel );
     void computeMoonPositionVelocity ( double jed, double lt, SSVector &pos, SSVector &vel );
     static void computePSPlanetMoonPositionVelocity ( int id, double jed, double lt, SSVector &pos, SSVector &vel );
-
-    float computeAsteroidMagnitude ( double rad, double dist, double phase, double hmag, double gmag );
-    float computeCometMagnitude ( double rad, double dist, double hmag, double kmag );
+    static void computeUncachedPositionVelocity ( int id, double jed, double lt, SSVector &pos, SSVector &vel );
+    static bool ephemerisCacheFunc ( int64_t id, double jed, SSVector &pos, SSVector &vel, void *userData );
+    static bool ephemerisFileFunc ( int64_t id, double jed, SSVector &pos, SSVector &vel, void *userData );
+    double accelerationBound ( void );
+    void recordLightTime ( bool evaluated );
 
 public:
     
@@ -111,7 +119,7 @@ public:
     SSPlanet ( SSObjectType type );
     SSPlanet ( SSObjectType type, SSPlanetID id );
     
-    void setIdentifier ( SSIdentifier ident ) { _id = ident; }
+    void setIdentifier ( SSIdentifier ident ) { _id = ident; _pmatrixJED = NAN; }
     void setOrbit ( SSOrbit orbit ) { _orbit = orbit; }
     void setHMagnitude ( float hmag ) { _Hmag = hmag; }
     void setGMagnitude ( float gmag ) { _Gmag = gmag; }
@@ -128,7 +136,8 @@ public:
     SSIdentifier getIdentifier ( int i ) { return i == 0 ? _id : SSIdentifier(); }
     SSIdentifier getIdentifier ( SSCatalog cat );
     vector<SSIdentifier> getIdentifiers ( void ) { return vector<SSIdentifier> { _id }; }
-    SSOrbit getOrbit ( void ) { return _orbit; }
+    SSSpan<SSIdentifier> getIdentifierSpan ( void ) { return SSSpan<SSIdentifier> ( &_id, 1 ); }
+    const SSOrbit &getOrbit ( void ) { return _orbit; }
     float getHMagnitude ( void ) { return _Hmag; }
     float getGMagnitude ( void ) { return _Gmag; }
     float getColorIndex ( void ) { return _BminV; }
@@ -141,6 +150,7 @@ public:
 
     SSVector getPosition ( void ) { return _position; }
     SSVector getVelocity ( void ) { return _velocity; }
+    void setPositionVelocity ( SSVector pos, SSVector vel ) { _position = pos; _velocity = vel; }
 
     double distance ( SSPlanet &other ) { return _position.distance ( other._position ); }
     
@@ -167,6 +177,7 @@ public:
     
     static double getGRSLongitude ( double jd );
     bool rayIntersect ( SSVector p, SSVector u, double &d, SSVector &q, float s = 1.0f );
+    size_t rayIntersect ( SSVector p, size_t n, const double *ux, const double *uy, const double *uz, uint8_t *hit, double *d, double *lon, double *lat, float s = 1.0f );
 
     // Sets whether to use (accurate, but slow) VSOP/ELP planetary & lunar ephemeris when JPL DE438 is not available.
     // Also USE_VSOP_ELP must be #defined as 1 at the top of SSPlanet.cpp!
@@ -174,11 +185,86 @@ public:
     static void useVSOPELP ( bool use );
     static bool useVSOPELP ( void );
 
+    // Sets or returns VSOP/ELP precision tier: each series is truncated where the root-sum-square amplitude
+    // of the omitted terms falls below this, in radians. Zero (kVSOPELPFull, the default) evaluates every term
+    // in the embedded series. Geocentric errors over 1950-2050 (DE438 excludes Pluto); speedups are for the
+    // series evaluation alone:
+    //
+    // tier     VSOP speed  ELP speed  planets vs. full  vs. DE438  Moon vs. full  vs. DE438
+    // full     1.0x        1.0x       0.00"             1.06"      0.00"          0.32"
+    // 0.1"     1.6x        1.0x       0.06"             1.06"      0.01"          0.32"
+    // 1"       2.2x        2.4x       0.80"             0.96"      0.13"          0.44"
+    
+    static constexpr double kVSOPELPFull = 0.0;                 // full embedded series
+    static constexpr double kVSOPELPTenthArcsec = 1.0e-8;       // max error 0.1 arcsec vs. full series
+    static constexpr double kVSOPELPArcsec = 1.5e-7;            // max error 1 arcsec vs. full series
+
+    static void setVSOPELPPrecision ( double prec );
+    static double getVSOPELPPrecision ( void );
+
+    // Sets or returns the policy choosing which ephemeris computes each major planet and the Moon in each era
+    // (see SSEphemerisPolicy); an empty policy, the default, keeps the usual JPL DE, then VSOP/ELP, then PS order.
+    // Set the policy before computing, not while other threads are computing.
+    
+    static void setEphemerisPolicy ( const SSEphemerisPolicy &policy );
+    static SSEphemerisPolicy getEphemerisPolicy ( void );
+
+    // Computes a major planet's (id = kSun ... kPluto) heliocentric position and velocity, or the Moon's (id = kLuna)
+    // geocentric position and velocity, in AU and AU/day in the fundamental J2000 equatorial frame, at Julian Ephemeris
+    // Date (jed), with one particular backend. Returns false if that backend isn't available or doesn't cover the date.
+    
+    static bool computeBackendPositionVelocity ( SSEphemerisBackend backend, int id, double jed, SSVector &pos, SSVector &vel );
+
+    // Sets whether to fit and evaluate Chebyshev polynomials for major planet and Moon positions instead
+    // of evaluating the underlying ephemeris (JPL DE, VSOP/ELP, or PS) every time; off by default.
+    // Clear the cache after opening or closing a JPL ephemeris file. Cached positions agree with the underlying
+    // ephemeris to about 9.3e-10 of the distance, within the cache tolerance; but velocities are derivatives of the
+    // polynomials, which are fitted to positions only, so they differ by up to about 3.6e-5 of the speed (Neptune,
+    // with VSOP2013). Don't use the cache where velocities must be more accurate than that.
+    
+    static void useEphemerisCache ( bool use );
+    static bool useEphemerisCache ( void );
+    static SSChebyshevCache &getEphemerisCache ( void );
+
+    // Compiles heliocentric positions of planets, moons, asteroids, and comets (not satellites) from jed0 to jed1
+    // into a Chebyshev ephemeris file, using whatever ephemeris is currently selected for each object.
+    // While a compiled file is open, objects in it are computed from the file within its time range.
+    
+    static bool compileEphemerisFile ( const string &filename, vector<SSPlanet *> &objects, double jed0, double jed1, double tolerance = SSChebyshevCache::kDefaultTolerance );
+    static bool openEphemerisFile ( const string &filename );
+    static void closeEphemerisFile ( void );
+    static SSChebyshevEphemeris &getEphemerisFile ( void );
+
+    // Sets or returns the light time correction tolerance, in radians. If zero (the default), computeEphemeris() always
+    // re-evaluates an object's ephemeris antedated for light time. Otherwise, it antedates the geometric position by its
+    // velocity times light time, and only re-evaluates the ephemeris if a bound on the resulting error - from the object's
+    // acceleration around the Sun, or its primary, or Earth - exceeds this angle.
+
+    static void setLightTimeTolerance ( double tol );
+    static double getLightTimeTolerance ( void );
+
+    // Per-object light time correction statistics: number of first-order corrections from velocity alone,
+    // and of ephemeris re-evaluations. Only counted while enabled (off by default), since this takes a lock.
+
+    struct LightTimeStats
+    {
+        uint64_t firstOrder = 0;
+        uint64_t evaluations = 0;
+    };
+
+    static void countLightTime ( bool count );
+    static bool countLightTime ( void );
+    static map<SSPlanet *, LightTimeStats> getLightTimeStats ( void );
+    static void resetLightTimeStats ( void );
+
     static void computeMajorPlanetPositionVelocity ( int id, double jed, double lt, SSVector &pos, SSVector &vel );
     virtual void computePositionVelocity ( double jed, double lt, SSVector &pos, SSVector &vel );
     virtual void computePositionVelocity  ( SSCoordinates &coords, SSVector &pos, SSVector &vel );
     virtual float computeMagnitude ( double rad, double dist, double phase );
+    static float computeAsteroidMagnitude ( double rad, double dist, double phase, double hmag, double gmag );
+    static float computeCometMagnitude ( double rad, double dist, double hmag, double kmag );
     virtual void computeEphemeris ( SSCoordinates &coords );
+    void computeEphemeris ( SSCoordinates &coords, SSVector pos, SSVector vel );
     SSSpherical computeApparentMotion ( SSCoordinates &coords, SSFrame frame = kFundamental );
 
     double umbraLength ( float s = 1.0f );
@@ -194,7 +280,12 @@ public:
     // imports/exports from/to CSV-format text string
     
     static SSObjectPtr fromCSV ( string csv );
+    static SSObjectPtr fromCSV ( const SSCSVFields &fields );
     string toCSV ( void );
+    void appendCSV ( string &csv );
+    
+    virtual size_t sizeOf ( void ) { return sizeof ( SSPlanet ); }
+    virtual size_t heapBytes ( void ) { return SSObject::heapBytes() + strbytes ( _taxonomy ); }
 };
 
 // Subclass of solar system object for artificial Earth satellites.
@@ -230,17 +321,22 @@ public:
     SSSatellite ( SSTLE &tle );
     
     SSTLE getTLE ( void ) { return _tle; }
+    void setTLE ( const SSTLE &tle );
 
     virtual void  computePositionVelocity ( double jed, double lt, SSVector &pos, SSVector &vel );
     virtual float computeMagnitude ( double rad, double dist, double phase );
     static  float computeSatelliteMagnitude ( double dist, double phase, double stdmag );
     
-    vector<FreqData> getRadioFrequencies ( void ) { return _freqData; }
+    const vector<FreqData> &getRadioFrequencies ( void ) { return _freqData; }
     string getSourceCountry ( void ) { return _sourceCountry; }
     string getLaunchSite ( void ) { return _launchSite; }
     double getLaunchDate ( void ) { return _launchDate; }
 
+    virtual size_t sizeOf ( void ) { return sizeof ( SSSatellite ); }
+    virtual size_t heapBytes ( void );
+    
     void setRadioFrequencies ( const vector<FreqData> &freqs ) { _freqData = freqs; }
+    void setRadioFrequencies ( vector<FreqData> &&freqs ) { _freqData = move ( freqs ); }
     void setSourceCountry ( string source ) { _sourceCountry = source; }
     void setLaunchSite ( string site ) { _launchSite = site; }
     void setLaunchDate ( double jd ) { _launchDate = jd; }
@@ -267,15 +363,27 @@ struct McName
     float  mag;           // Magnitude at 1000 km range, 50% illumination.
 };
 
-typedef map<int,McName> McNameMap;
+typedef unordered_map<int,McName> McNameMap;
 
 int SSImportSatellitesFromTLE ( const string &path, SSObjectVec &satellites );
+
+// NORAD numbers of satellites added, changed, and missing after SSUpdateSatellitesFromTLE().
+
+struct SSTLEUpdate
+{
+    vector<int> added;      // satellites appended from the TLE file
+    vector<int> changed;    // satellites whose TLEs were replaced
+    vector<int> removed;    // satellites which were not in the TLE file; deleted only if requested
+    int unchanged;          // number of satellites whose TLEs were identical
+};
+
+int SSUpdateSatellitesFromTLE ( const string &path, SSObjectVec &satellites, SSTLEUpdate &update, bool removeMissing = false );
 int SSImportMcNames ( const string &path, McNameMap &mcnames );
 int SSImportMcNames ( const string &filename, SSObjectVec &objects );
 
 // Struct used to store CSV-parsed data from amateur satellite frequency table
 
-typedef map<int,vector<SSSatellite::FreqData>> SatFreqMap;
+typedef unordered_map<int,vector<SSSatellite::FreqData>> SatFreqMap;
 
 int SSImportSatelliteFrequencyData ( const string &path, SatFreqMap &satfreqs );
 int SSImportSatelliteFrequencyData ( const string &path, SSObjectVec &objects );
@@ -294,7 +402,7 @@ struct N2Data
     float  decay_date;         // Julian date of reentry
 };
 
-typedef map<int,N2Data> N2DataMap;
+typedef unordered_map<int,N2Data> N2DataMap;
 
 int SSImportN2Data ( const string &path, N2DataMap &n2data );
 int SSImportN2Data ( const string &path, SSObjectVec &satellites );
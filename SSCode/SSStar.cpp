@@ -200,7 +200,7 @@ static vector<SSStar::SpecInfo> _specinfo =
 
 SSStar::SSStar ( SSObjectType type ) : SSObject ( type )
 {
-    _names = vector<string> ( 0 );
+    _names = vector<SSIString> ( 0 );
     _idents = vector<SSIdentifier> ( 0 );
 
     _parallax = 0.0;
@@ -244,6 +244,7 @@ SSDoubleStar::SSDoubleStar ( void ) : SSStar ( kTypeDoubleStar )
     _PAyr = INFINITY;
     _pOrbit = nullptr;
     _pPrimary = nullptr;
+    _orbitJED = INFINITY;
 }
 
 // Destructs double star. Deletes binary star orbit data if present.
@@ -360,10 +361,10 @@ void SSStar::computeEphemeris ( SSCoordinates &coords )
     if ( coords.getStarMotion() && ! ( _velocity.isinf() || _velocity.isnan() ) )
         _direction += _velocity * ( coords.getJED() - SSTime::kJ2000 ) / SSTime::kDaysPerJulianYear;
     
-    // If applying heliocentric parallax, and the star's parallax is known, subtract the observer's
-    // position divided by the star's J2000 distance.
+    // If applying heliocentric parallax, and the star's parallax is known and not below the limit,
+    // subtract the observer's position divided by the star's J2000 distance.
     
-    if ( coords.getStarParallax() && _parallax > 0.0 )
+    if ( coords.getStarParallax() && _parallax > 0.0 && _parallax >= coords.getStarParallaxLimit() )
         _direction -= coords.getObserverPosition() * ( _parallax / coords.kAUPerParsec );
 
     // If star's apparent direction is the same as in J2000, we ignored both its space motion and parallax.
@@ -419,8 +420,7 @@ void SSDoubleStar::computeEphemeris ( SSCoordinates &coords )
     {
         // NOTE: this only works when viewed from within Solar System
         
-        SSVector pos, vel, dir;
-        _pOrbit->toPositionVelocity ( coords.getJED(), pos, vel );
+        SSVector pos = getOrbitPosition ( coords.getJED() ), dir;
         _pPrimary->computeEphemeris ( coords );
         _magnitude = _Vmag < INFINITY ? _Vmag : _Bmag;
         if ( getParallax() > 0.0 && _pPrimary->getParallax() > 0.0 )
@@ -443,21 +443,65 @@ void SSDoubleStar::computeEphemeris ( SSCoordinates &coords )
         SSStar::computeEphemeris ( coords );
     }
     
-    // If double star has an orbit, compute current separation and position angle.
+    // If double star has an orbit, compute current separation and position angle by projecting the orbit position
+    // onto the sky plane's north and east directions; this is the same as transforming the orbit to the sky plane,
+    // without re-solving Kepler's equation.
 
     if ( _pOrbit )
     {
-        SSAngle pa;
-        double r, sep;
+        SSVector pos = getOrbitPosition ( coords.getJED() );
         SSSpherical radec = _direction;
-        SSOrbit orbit = getOrbit ( radec.lon, radec.lat );
-        orbit.toPositionSeparation ( coords.getJED(), pa, r, sep );
-        _sep = sep / SSAngle::kArcsecPerRad;
-        _PA = pa;
+        double cr = cos ( radec.lon ), sr = sin ( radec.lon );
+        double cd = cos ( radec.lat ), sd = sin ( radec.lat );
+        double n = pos * SSVector ( -sd * cr, -sd * sr, cd );
+        double e = pos * SSVector ( -sr, cr, 0.0 );
+        _sep = sqrt ( n * n + e * e ) / SSAngle::kArcsecPerRad;
+        _PA = SSAngle ( atan2 ( e, n ) ).mod2Pi();
         _PAyr = coords.getTime().toJulianYear();
     }
 }
 
+// Returns binary orbit position at Julian Ephemeris Date (jed), solving Kepler's equation only if not cached.
+
+SSVector SSDoubleStar::getOrbitPosition ( double jed )
+{
+    if ( _pOrbit == nullptr )
+        return SSVector ( 0.0, 0.0, 0.0 );
+    
+    if ( jed != _orbitJED )
+    {
+        SSVector vel;
+        _pOrbit->toPositionVelocity ( jed, _orbitPos, vel );
+        _orbitJED = jed;
+    }
+    
+    return _orbitPos;
+}
+
+void SSDoubleStarOrbits::setStars ( SSObjectArray &objects )
+{
+    _stars.clear();
+    _orbits.clear();
+    for ( size_t i = 0; i < objects.size(); i++ )
+    {
+        SSDoubleStarPtr pStar = SSGetDoubleStarPtr ( objects[i] );
+        if ( pStar != nullptr && pStar->hasOrbit() )
+        {
+            _stars.push_back ( pStar );
+            _orbits.push_back ( pStar->getOrbit() );
+        }
+    }
+    
+    _orbits.prepare ( SSMatrix::identity() );
+}
+
+void SSDoubleStarOrbits::computePositions ( double jed )
+{
+    _orbits.toPositionVelocity ( jed, _pos, _vel );
+    for ( size_t i = 0; i < _stars.size(); i++ )
+        _stars[i]->setOrbitPosition ( jed, _pos[i] );
+}
+
 // Returns this star's apparent proper motion in the coordinate system (frame)
 // at the observer time and location stored in the SSCoordinates object (coords).
 // Assumes star's apparent direction and current distance have already
@@ -1162,9 +1206,9 @@ float SSStar::radius ( void )
     return SSStar::radius ( luminosity, temperature );
 }
 
-// Returns CSV string from base data (excluding names and identifiers).
+// Appends CSV fields from base data (excluding names and identifiers) to a string (csv).
 
-string SSStar::toCSV1 ( void )
+void SSStar::appendCSV1 ( string &csv )
 {
     SSSpherical coords = getFundamentalCoords();
     SSSpherical motion = getFundamentalMotion();
@@ -1173,47 +1217,64 @@ string SSStar::toCSV1 ( void )
     SSDegMinSec dec = coords.lat;
     double distance = coords.rad;
     
-    string csv = SSObject::typeToCode ( _type ) + ",";
+    csv += SSObject::typeToCode ( _type ) + ",";
     
     csv += ra.toString() + ",";
     csv += dec.toString() + ",";
     
-    csv += ::isnan ( motion.lon ) || ::isinf ( motion.lon ) ? "," : format ( "%+.5f,", ( motion.lon / 15.0 ).toArcsec() );
-    csv += ::isnan ( motion.lat ) || ::isinf ( motion.lat ) ? "," : format ( "%+.4f,", motion.lat.toArcsec() );
+    if ( ! ::isnan ( motion.lon ) && ! ::isinf ( motion.lon ) )
+        append_fixed ( csv, ( motion.lon / 15.0 ).toArcsec(), 5, true );
+    csv += ",";
     
-    csv += ::isinf ( _Vmag ) ? "," : format ( "%+.2f,", _Vmag );
-    csv += ::isinf ( _Bmag ) ? "," : format ( "%+.2f,", _Bmag );
+    if ( ! ::isnan ( motion.lat ) && ! ::isinf ( motion.lat ) )
+        append_fixed ( csv, motion.lat.toArcsec(), 4, true );
+    csv += ",";
     
-    csv += ::isinf ( distance ) ? "," : format ( "%.3E,", distance * SSCoordinates::kParsecPerLY );
-    csv += ::isinf ( _radvel ) ? "," : format ( "%+.1f,", _radvel * SSCoordinates::kLightKmPerSec );
+    append_csv_fixed ( csv, _Vmag, 2, true );
+    append_csv_fixed ( csv, _Bmag, 2, true );
     
-    // If spectrum contains a comma, put it in quotes.
+    if ( ! ::isinf ( distance ) )
+        appendf ( csv, "%.3E", distance * SSCoordinates::kParsecPerLY );
+    csv += ",";
     
-    csv += _spectrum.find ( "," ) == string::npos ? _spectrum + "," : "\"" + _spectrum + "\",";
+    if ( ! ::isinf ( _radvel ) )
+        append_fixed ( csv, _radvel * SSCoordinates::kLightKmPerSec, 1, true );
+    csv += ",";
     
-    return csv;
+    append_csv_string ( csv, _spectrum );
 }
 
-// Returns CSV string from identifiers and names (excluding base data).
+// Appends CSV fields from identifiers and names (excluding base data) to a string (csv).
 
-string SSStar::toCSV2 ( void )
+void SSStar::appendCSV2 ( string &csv )
 {
-    string csv = "";
-    
     for ( int i = 0; i < _idents.size(); i++ )
-        csv += _idents[i].toString() + ",";
+    {
+        csv += _idents[i].toString();
+        csv += ',';
+    }
     
     for ( int i = 0; i < _names.size(); i++ )
-        csv += _names[i] + ",";
-
-    return csv;
+    {
+        csv += _names[i].str();
+        csv += ',';
+    }
 }
 
-// Returns CSV string including base star data plus names and identifiers.
+// Returns CSV string including base star data plus names and identifiers,
+// and any subclass data, from appendCSV().
 
 string SSStar::toCSV ( void )
 {
-    return toCSV1() + toCSV2();
+    string csv;
+    appendCSV ( csv );
+    return csv;
+}
+
+void SSStar::appendCSV ( string &csv )
+{
+    appendCSV1 ( csv );
+    appendCSV2 ( csv );
 }
 
 // Stores orbital elements (orbit) referenced to sky plane centered at (ra,dec),
@@ -1234,103 +1295,97 @@ SSOrbit SSDoubleStar::getOrbit ( SSAngle ra, SSAngle dec )
     return getOrbit().transform ( m );
 }
 
-// Returns CSV string from double-star data (but not SStar base class).
+// Appends CSV fields from double-star data (but not SStar base class) to a string (csv).
 
-string SSDoubleStar::toCSVD ( void )
+void SSDoubleStar::appendCSVD ( string &csv )
 {
-    string csv = "";
-    
-    // If components contains a comma, put them in quotes.
-
-    csv += _comps.find ( "," ) == string::npos ? _comps + "," : "\"" + _comps + "\",";
-    csv += ::isinf ( _magDelta ) ? "," : format ( "%+.2f,", _magDelta );
-    csv += ::isinf ( _sep ) ? "," : format ( "%.1f,", _sep * SSAngle::kArcsecPerRad );
-    csv += ::isinf ( _PA ) ? "," : format ( "%.1f,", _PA * SSAngle::kDegPerRad );
-    csv += ::isinf ( _PAyr ) ? "," : format ( "%.2f,", _PAyr );
+    append_csv_string ( csv, _comps );
+    append_csv_fixed ( csv, _magDelta, 2, true );
+    append_csv_fixed ( csv, _sep * SSAngle::kArcsecPerRad, 1 );
+    append_csv_fixed ( csv, _PA * SSAngle::kDegPerRad, 1 );
+    append_csv_fixed ( csv, _PAyr, 2 );
 
     if ( _pOrbit == nullptr )
-        return csv + ",,,,,,,";
+    {
+        csv += ",,,,,,,";
+        return;
+    }
     
     SSSpherical coords = getFundamentalCoords();
     SSOrbit orbit = getOrbit ( coords.lon, coords.lat );
     
-    csv += format ( "%.4f,", SSTime ( orbit.t ).toJulianYear() );
-    csv += format ( "%.4f,", orbit.semiMajorAxis() );
-    csv += format ( "%.4f,", orbit.e );
-    csv += format ( "%.2f,", radtodeg ( orbit.i ) );
-    csv += format ( "%.2f,", radtodeg ( orbit.w ) );
-    csv += format ( "%.2f,", radtodeg ( orbit.n ) );
+    append_csv_fixed ( csv, SSTime ( orbit.t ).toJulianYear(), 4 );
+    append_csv_fixed ( csv, orbit.semiMajorAxis(), 4 );
+    append_csv_fixed ( csv, orbit.e, 4 );
+    append_csv_fixed ( csv, radtodeg ( orbit.i ), 2 );
+    append_csv_fixed ( csv, radtodeg ( orbit.w ), 2 );
+    append_csv_fixed ( csv, radtodeg ( orbit.n ), 2 );
     if ( orbit.mm == 0.0 )
         csv += ",";
     else
-        csv += format ( "%.6f,", ( SSAngle::kTwoPi / orbit.mm ) / SSTime::kDaysPerJulianYear );
-
-    return csv;
+        append_csv_fixed ( csv, ( SSAngle::kTwoPi / orbit.mm ) / SSTime::kDaysPerJulianYear, 6 );
 }
 
-// Returns CSV string including base star data, double-star data,
-// plus names and identifiers. Overrides SSStar::toCSV().
+// Appends CSV fields from base star data, double-star data, plus names and identifiers.
+// Overrides SSStar::appendCSV().
 
-string SSDoubleStar::toCSV ( void )
+void SSDoubleStar::appendCSV ( string &csv )
 {
-    return toCSV1() + toCSVD() + toCSV2();
+    appendCSV1 ( csv );
+    appendCSVD ( csv );
+    appendCSV2 ( csv );
 }
 
-// Returns CSV string from variable-star data (but not SStar base class).
+// Appends CSV fields from variable-star data (but not SStar base class) to a string (csv).
 
-string SSVariableStar::toCSVV ( void )
+void SSVariableStar::appendCSVV ( string &csv )
 {
-    string csv = "";
-    
-    // If variable type contains a comma, put it in quotes.
-
-    csv += _varType.find ( "," ) == string::npos ? _varType + "," : "\"" + _varType + "\",";
-    csv += ::isinf ( _varMinMag ) ? "," : format ( "%+.2f,", _varMinMag );
-    csv += ::isinf ( _varMaxMag ) ? "," : format ( "%+.2f,", _varMaxMag );
-    csv += ::isinf ( _varPeriod ) ? "," : format ( "%.2f,", _varPeriod );
-    csv += ::isinf ( _varEpoch )  ? "," : format ( "%.2f,", _varEpoch );
-
-    return csv;
+    append_csv_string ( csv, _varType );
+    append_csv_fixed ( csv, _varMinMag, 2, true );
+    append_csv_fixed ( csv, _varMaxMag, 2, true );
+    append_csv_fixed ( csv, _varPeriod, 2 );
+    append_csv_fixed ( csv, _varEpoch, 2 );
 }
 
-// Returns CSV string including base star data, variable-star data, plus names and identifiers.
-// Overrides SSStar::toCSV().
+// Appends CSV fields from base star data, variable-star data, plus names and identifiers.
+// Overrides SSStar::appendCSV().
 
-string SSVariableStar::toCSV ( void )
+void SSVariableStar::appendCSV ( string &csv )
 {
-    return toCSV1() + toCSVV() + toCSV2();
+    appendCSV1 ( csv );
+    appendCSVV ( csv );
+    appendCSV2 ( csv );
 }
 
-// Returns CSV string including base star data, double-star data, variable-star data,
-// plus names and identifiers.  Overrides SSStar::toCSV().
+// Appends CSV fields from base star data, double-star data, variable-star data,
+// plus names and identifiers.  Overrides SSStar::appendCSV().
 
-string SSDoubleVariableStar::toCSV ( void )
+void SSDoubleVariableStar::appendCSV ( string &csv )
 {
-    return toCSV1() + toCSVD() + toCSVV() + toCSV2();
+    appendCSV1 ( csv );
+    appendCSVD ( csv );
+    appendCSVV ( csv );
+    appendCSV2 ( csv );
 }
 
-// Returns CSV string from deep sky object data (but not SStar base class).
+// Appends CSV fields from deep sky object data (but not SStar base class) to a string (csv).
 
-string SSDeepSky::toCSVDS ( void )
+void SSDeepSky::appendCSVDS ( string &csv )
 {
-    string csv = "";
-
-    csv += ::isinf ( _majAxis ) ? "," : format ( "%.2f,", _majAxis * SSAngle::kArcminPerRad );
-    csv += ::isinf ( _minAxis ) ? "," : format ( "%.2f,", _minAxis * SSAngle::kArcminPerRad );
-    csv += ::isinf ( _PA ) ? "," : format ( "%.1f,", _PA * SSAngle::kDegPerRad );
-
-    return csv;
+    append_csv_fixed ( csv, _majAxis * SSAngle::kArcminPerRad, 2 );
+    append_csv_fixed ( csv, _minAxis * SSAngle::kArcminPerRad, 2 );
+    append_csv_fixed ( csv, _PA * SSAngle::kDegPerRad, 1 );
 }
 
-// Returns CSV string including base star data, double-star data,
-// plus names and identifiers. Overrides SSStar::toCSV().
+// Appends CSV fields from base star data, deep sky object data,
+// plus names and identifiers. Overrides SSStar::appendCSV().
 
-string SSDeepSky::toCSV ( void )
+void SSDeepSky::appendCSV ( string &csv )
 {
-    if ( _type == kTypeStar )
-        return toCSV1() + toCSV2();
-    else
-        return toCSV1() + toCSVDS() + toCSV2();
+    appendCSV1 ( csv );
+    if ( _type != kTypeStar )
+        appendCSVDS ( csv );
+    appendCSV2 ( csv );
 }
 
 // Allocates a new SSStar and initializes it from a CSV-formatted string.
@@ -1341,11 +1396,18 @@ SSObjectPtr SSStar::fromCSV ( string csv )
     // split string into comma-delimited fields,
     // remove leading & trailing whitespace from each field.
     
-    vector<string> fields = split_csv ( csv );
-    for ( int i = 0; i < fields.size(); i++ )
-        fields[i] = trim ( fields[i] );
-    
-    SSObjectType type = SSObject::codeToType ( fields[0] );
+    SSCSVFields fields;
+    fields.split ( csv );
+    return fromCSV ( fields );
+}
+
+// Allocates a new SSStar and initializes it from a line of CSV already split into fields.
+// Numeric fields are parsed directly from the field views, without copying them into strings.
+// Returns nullptr on error (invalid CSV fields, heap allocation failure, etc.)
+
+SSObjectPtr SSStar::fromCSV ( const SSCSVFields &fields )
+{
+    SSObjectType type = SSObject::codeToType ( fields.str ( 0 ) );
     if ( type < kTypeStar || type > kTypeGalaxy )
         if ( type != kTypeNonexistent )
             return nullptr;
@@ -1368,8 +1430,8 @@ SSObjectPtr SSStar::fromCSV ( string csv )
     if ( fields.size() < fid )
         return nullptr;
     
-    SSHourMinSec ra ( fields[1] );
-    SSDegMinSec dec ( fields[2] );
+    SSHourMinSec ra ( fields.str ( 1 ) );
+    SSDegMinSec dec ( fields.str ( 2 ) );
     
     double pmRA = fields[3].empty() ? INFINITY : SSAngle::kRadPerArcsec * strtofloat64 ( fields[3] ) * 15.0;
     double pmDec = fields[4].empty() ? INFINITY : SSAngle::kRadPerArcsec * strtofloat64 ( fields[4] );
@@ -1379,7 +1441,7 @@ SSObjectPtr SSStar::fromCSV ( string csv )
     
     float dist = fields[7].empty() ? INFINITY : strtofloat ( fields[7] ) * SSCoordinates::kLYPerParsec;
     float radvel = fields[8].empty() ? INFINITY : strtofloat ( fields[8] ) / SSCoordinates::kLightKmPerSec;
-    string spec = trim ( fields[9] );
+    string spec = fields.str ( 9 );
     
     // For remaining fields, attempt to parse an identifier.
     // If we succeed, add it to the identifier vector; otherwise add it to the name vector.
@@ -1392,11 +1454,11 @@ SSObjectPtr SSStar::fromCSV ( string csv )
         if ( fields[i].empty() )
             continue;
         
-        SSIdentifier ident = SSIdentifier::fromString ( fields[i] );
+        SSIdentifier ident = SSIdentifier::fromString ( fields.str ( i ) );
         if ( ident )
             idents.push_back ( ident );
         else
-            names.push_back ( fields[i] );
+            names.push_back ( fields.str ( i ) );
     }
     
     SSObjectPtr pObject = SSNewObject ( type );
@@ -1415,12 +1477,12 @@ SSObjectPtr SSStar::fromCSV ( string csv )
     pStar->setVMagnitude ( vmag );
     pStar->setBMagnitude ( bmag );
     pStar->setSpectralType ( spec );
-    pStar->setIdentifiers( idents );
+    pStar->setIdentifiers ( move ( idents ) );
     pStar->setNames ( names );
     
     if ( pDoubleStar )
     {
-        string comps = fields[10];
+        string comps = fields.str ( 10 );
         float dmag = fields[11].empty() ? INFINITY : strtofloat ( fields[11] );
         float sep = fields[12].empty() ? INFINITY : strtofloat ( fields[12] ) / SSAngle::kArcsecPerRad;
         float pa = fields[13].empty() ? INFINITY : strtofloat ( fields[13] ) / SSAngle::kDegPerRad;
@@ -1432,7 +1494,7 @@ SSObjectPtr SSStar::fromCSV ( string csv )
         pDoubleStar->setPositionAngle ( pa );
         pDoubleStar->setPositionAngleYear ( year );
         
-        if ( fields[15].length() && fields[16].length() && fields[17].length() )
+        if ( fields[15].size() && fields[16].size() && fields[17].size() )
         {
             SSOrbit orbit;
             
@@ -1453,7 +1515,7 @@ SSObjectPtr SSStar::fromCSV ( string csv )
     {
         int fv = ( type == kTypeVariableStar ) ? 10 : 22;
             
-        string vtype = fields[fv];
+        string vtype = fields.str ( fv );
         float vmin = fields[fv+1].empty() ? INFINITY : strtofloat ( fields[fv+1] );
         float vmax = fields[fv+2].empty() ? INFINITY : strtofloat ( fields[fv+2] );
         float vper = fields[fv+3].empty() ? INFINITY : strtofloat ( fields[fv+3] );
@@ -1485,7 +1547,11 @@ SSObjectPtr SSStar::fromCSV ( string csv )
 
 SSStarPtr SSGetStarPtr ( SSObjectPtr ptr )
 {
-    return dynamic_cast<SSStarPtr> ( ptr );
+    SSObjectFamily family = ptr ? SSGetObjectFamily ( ptr->getType() ) : kFamilyUnknown;
+    if ( family == kFamilyStar || family == kFamilyDeepSky )
+        return static_cast<SSStarPtr> ( ptr );
+    
+    return family == kFamilyUnknown ? dynamic_cast<SSStarPtr> ( ptr ) : nullptr;
 }
 
 // Downcasts generic SSObject pointer to SSDoubleStar pointer.
@@ -1494,7 +1560,11 @@ SSStarPtr SSGetStarPtr ( SSObjectPtr ptr )
 
 SSDoubleStarPtr SSGetDoubleStarPtr ( SSObjectPtr ptr )
 {
-    return dynamic_cast<SSDoubleStarPtr> ( ptr );
+    SSObjectType type = ptr ? ptr->getType() : kTypeNonexistent;
+    if ( type == kTypeDoubleStar || type == kTypeDoubleVariableStar || SSGetObjectFamily ( type ) == kFamilyUnknown )
+        return dynamic_cast<SSDoubleStarPtr> ( ptr );
+    
+    return nullptr;
 }
 
 // Downcasts generic SSObject pointer to SSVariableStar pointer.
@@ -1503,7 +1573,11 @@ SSDoubleStarPtr SSGetDoubleStarPtr ( SSObjectPtr ptr )
 
 SSVariableStarPtr SSGetVariableStarPtr ( SSObjectPtr ptr )
 {
-    return dynamic_cast<SSVariableStarPtr> ( ptr );
+    SSObjectType type = ptr ? ptr->getType() : kTypeNonexistent;
+    if ( type == kTypeVariableStar || type == kTypeDoubleVariableStar || SSGetObjectFamily ( type ) == kFamilyUnknown )
+        return dynamic_cast<SSVariableStarPtr> ( ptr );
+    
+    return nullptr;
 }
 
 // Downcasts generic SSObject pointer to SSDeepSkyStar pointer.
@@ -1511,5 +1585,9 @@ SSVariableStarPtr SSGetVariableStarPtr ( SSObjectPtr ptr )
 
 SSDeepSkyPtr SSGetDeepSkyPtr ( SSObjectPtr ptr )
 {
-    return dynamic_cast<SSDeepSkyPtr> ( ptr );
+    SSObjectFamily family = ptr ? SSGetObjectFamily ( ptr->getType() ) : kFamilyUnknown;
+    if ( family == kFamilyDeepSky )
+        return static_cast<SSDeepSkyPtr> ( ptr );
+    
+    return family == kFamilyUnknown ? dynamic_cast<SSDeepSkyPtr> ( ptr ) : nullptr;
 }
@@ -17,7 +17,9 @@
 #include "SSObject.hpp"
 #include "SSOrbit.hpp"
 
+#if SS_PACKED_OBJECTS
 #pragma pack ( push, 1 )
+#endif
 
 // This subclass of SSObject stores basic data for stars.
 // Its subclasses store double and variable star data,
@@ -38,29 +40,33 @@ protected:
     float   _Vmag;          // visual magnitude at J2000
     float   _Bmag;          // blue magnitude at J2000
 
-    string  _spectrum;      // Spectral type string
+    SSIString _spectrum;    // Spectral type string, interned in global string pool
     
     SSStar ( SSObjectType type ); // constructs a star with a specific type code
-    string toCSV1 ( void );       // returns CSV string from base data (excluding names and identifiers).
-    string toCSV2 ( void );       // returns CSV string from names and identifiers (excluding base data).
+    void appendCSV1 ( string &csv );  // appends CSV fields from base data (excluding names and identifiers).
+    void appendCSV2 ( string &csv );  // appends CSV fields from names and identifiers (excluding base data).
 
 public:
     
     SSStar ( void );
     
     void setIdentifiers ( const vector<SSIdentifier> &idents ) { _idents = idents; }
+    void setIdentifiers ( vector<SSIdentifier> &&idents ) { _idents = move ( idents ); }
     void setFundamentalPosition ( SSVector pos ) { _position = pos; }
     void setFundamentalVelocity ( SSVector vel ) { _velocity = vel; }
     void setFundamentalCoords ( SSSpherical coords );
     void setFundamentalMotion ( SSSpherical coords, SSSpherical motion );
     void setVMagnitude ( float vmag ) { _Vmag = vmag; }
     void setBMagnitude ( float bmag ) { _Bmag = bmag; }
+    void setParallax ( float plx ) { _parallax = plx; }
+    void setRadVel ( float rv ) { _radvel = rv; }
     void setSpectralType ( const string &spectrum ) { _spectrum = spectrum; }
     
     bool addIdentifier ( SSIdentifier ident );
     SSIdentifier getIdentifier ( SSCatalog cat );
     SSIdentifier getIdentifier ( int i );
     vector<SSIdentifier> getIdentifiers ( void ) { return _idents; }
+    SSSpan<SSIdentifier> getIdentifierSpan ( void ) { return _idents; }
     void sortIdentifiers ( void );
     
     SSVector getFundamentalPosition ( void ) { return _position; }
@@ -80,7 +86,12 @@ public:
     // imports/exports from/to CSV-format text string
     
     static SSObjectPtr fromCSV ( string csv );
+    static SSObjectPtr fromCSV ( const SSCSVFields &fields );
     virtual string toCSV ( void );
+    virtual void appendCSV ( string &csv );
+    
+    virtual size_t sizeOf ( void ) { return sizeof ( SSStar ); }
+    virtual size_t heapBytes ( void ) { return SSObject::heapBytes() + vecbytes ( _idents ); }
     
     // magnitude and color conversion utilities
     
@@ -174,8 +185,10 @@ protected:
     float _PAyr;                // Julian year of position angle measurement; infinite if unknown
     SSOrbit *_pOrbit;           // pointer to binary star orbit data referenced to fundamental J2000 mean equatorial plane, or nullptr if double star has no binary orbit
     SSStar *_pPrimary;          // pointer to this double star's primary star, or nullptr if this is the primary star of the system.
+    double _orbitJED;           // Julian Ephemeris Date of cached binary orbit position; infinite if none
+    SSVector _orbitPos;         // cached binary orbit position of fainter relative to brighter component in fundamental J2000 mean equatorial frame [arcsec]
     
-    string toCSVD ( void );     // returns CSV string from double-star data (but not SStar base class).
+    void appendCSVD ( string &csv );    // appends CSV fields from double-star data (but not SStar base class).
 
 public:
     
@@ -188,7 +201,7 @@ public:
     void setSeparation ( float sep ) { _sep = sep; }
     void setPositionAngle ( float pa ) { _PA = pa; }
     void setPositionAngleYear ( float year ) { _PAyr = year; }
-    void setOrbit ( const SSOrbit &orbit ) { delete _pOrbit; _pOrbit = new SSOrbit ( orbit ); }
+    void setOrbit ( const SSOrbit &orbit ) { delete _pOrbit; _pOrbit = new SSOrbit ( orbit ); _orbitJED = INFINITY; }
     void setOrbit ( SSOrbit orbit, SSAngle ra, SSAngle dec );
     void setPrimary ( SSStar *pPrimary ) { _pPrimary = pPrimary; }
     
@@ -203,11 +216,21 @@ public:
     SSStar *getPrimary ( void ) { return _pPrimary; }
     bool isPrimary ( void );
     
+    // Returns binary orbit position of fainter relative to brighter component at Julian Ephemeris Date (jed) in the
+    // fundamental J2000 mean equatorial frame, in arcseconds. This is cached, so each date's Kepler equation is solved
+    // once however many times it's needed; setOrbitPosition() stores a position computed elsewhere, e.g. in a batch.
+    
+    SSVector getOrbitPosition ( double jed );
+    void setOrbitPosition ( double jed, const SSVector &pos ) { _orbitJED = jed; _orbitPos = pos; }
+    
     // Used in copy contructor.
     void cloneOrbit ( void ) { _pOrbit = _pOrbit ? new SSOrbit ( *_pOrbit ) : nullptr; }
     
     void computeEphemeris ( SSCoordinates &coords );
-    virtual string toCSV ( void );
+    virtual void appendCSV ( string &csv );
+    
+    virtual size_t sizeOf ( void ) { return sizeof ( SSDoubleStar ); }
+    virtual size_t heapBytes ( void ) { return SSStar::heapBytes() + strbytes ( _comps ) + ( _pOrbit ? heapbytes ( sizeof ( SSOrbit ) ) : 0 ); }
 };
 
 // This subclass of SSStar stores data for variable stars
@@ -223,7 +246,7 @@ protected:
     double _varPeriod;           // Variability period, in days; infinite if unknown
     double _varEpoch;            // Variability epoch, as Julian Date; infinite if unknown
     
-    string toCSVV ( void );      // returns CSV string from variable-star data (but not SStar base class).
+    void appendCSVV ( string &csv );     // appends CSV fields from variable-star data (but not SStar base class).
 
 public:
     
@@ -241,7 +264,10 @@ public:
     double getPeriod ( void ) { return _varPeriod; }
     double getEpoch ( void ) { return _varEpoch; }
     
-    virtual string toCSV ( void );
+    virtual void appendCSV ( string &csv );
+    
+    virtual size_t sizeOf ( void ) { return sizeof ( SSVariableStar ); }
+    virtual size_t heapBytes ( void ) { return SSStar::heapBytes() + strbytes ( _varType ); }
 };
 
 // This subclass of SSStar inherits from both SSDoubleStar and SSVariableStar,
@@ -253,7 +279,10 @@ public:
     
     SSDoubleVariableStar ( void );
 
-    virtual string toCSV ( void );
+    virtual void appendCSV ( string &csv );
+    
+    virtual size_t sizeOf ( void ) { return sizeof ( SSDoubleVariableStar ); }
+    virtual size_t heapBytes ( void ) { return SSDoubleStar::heapBytes() + strbytes ( _varType ); }
 };
 
 // This subclass of SSStar stores data for star clusters, nebulae, and galaxies.
@@ -266,7 +295,7 @@ protected:
     float _minAxis;     // apparent size minor axis, in radians; infinite if unknown
     float _PA;          // position angle of major axis from north in fundamental mean J2000 equatorial frame, in radians; infinite if unknown
 
-    string toCSVDS ( void );   // returns CSV string from deep sky object data (but not SStar base class).
+    void appendCSVDS ( string &csv );  // appends CSV fields from deep sky object data (but not SStar base class).
 
 public:
     
@@ -282,10 +311,14 @@ public:
     float getPositionAngle ( void ) { return _PA; }
     string getGalaxyType ( void ) { return _spectrum; }
 
-    virtual string toCSV ( void );
+    virtual void appendCSV ( string &csv );
+    
+    virtual size_t sizeOf ( void ) { return sizeof ( SSDeepSky ); }
 };
 
+#if SS_PACKED_OBJECTS
 #pragma pack ( pop )
+#endif
 
 // convenient aliases for pointers to various subclasses of SSStar
 
@@ -302,4 +335,29 @@ SSDoubleStarPtr SSGetDoubleStarPtr ( SSObjectPtr ptr );
 SSVariableStarPtr SSGetVariableStarPtr ( SSObjectPtr ptr );
 SSDeepSkyPtr SSGetDeepSkyPtr ( SSObjectPtr ptr );
 
+// Computes binary orbit positions of many double stars at once with the batch Kepler solver in SSOrbitArray,
+// and caches them in the stars, so their computeEphemeris() costs about as much as a single star's.
+// The stars are not owned by this class, and must outlive it or be replaced with setStars().
+
+class SSDoubleStarOrbits
+{
+protected:
+    
+    vector<SSDoubleStarPtr> _stars;     // double stars with binary orbits
+    SSOrbitArray _orbits;               // their orbits, in the fundamental J2000 mean equatorial frame
+    vector<SSVector> _pos, _vel;        // scratch storage for positions and velocities
+    
+public:
+    
+    // Replaces the double stars in this batch with all those in an array (objects) which have binary orbits;
+    // other objects are ignored. Call again after changing any star's orbit.
+    
+    void setStars ( SSObjectArray &objects );
+    size_t size ( void ) { return _stars.size(); }
+    
+    // Computes and caches all stars' orbit positions at Julian Ephemeris Date (jed).
+    
+    void computePositions ( double jed );
+};
+
 #endif /* SSStar_hpp */
@@ -0,0 +1,248 @@
+// SSStarPipeline.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include "SSStarPipeline.hpp"
+
+SSStarPipeline::SSStarPipeline ( SSStarTable &table, int level, double margin )
+{
+    _table = &table;
+    _compact = nullptr;
+    _level = min ( max ( level, 1 ), 20 );
+    _margin = margin;
+    _float32 = false;
+}
+
+SSStarPipeline::SSStarPipeline ( SSCompactStarTable &table, int level, double margin )
+{
+    _table = nullptr;
+    _compact = &table;
+    _level = min ( max ( level, 1 ), 20 );
+    _margin = margin;
+    _float32 = true;
+}
+
+size_t SSStarPipeline::index ( void )
+{
+    size_t n = tableSize();
+    vector<uint64_t> ids ( n );
+    vector<float> mags ( n );
+    vector<uint32_t> order ( n );
+
+    for ( size_t i = 0; i < n; i++ )
+    {
+        ids[i] = _htm.vector2ID ( _table ? _table->getFundamentalPosition ( i ) : _compact->getFundamentalPosition ( i ), _level - 1 );
+        mags[i] = tableMagnitude ( i );
+        order[i] = (uint32_t) i;
+    }
+
+    // Stable sort keeps stars of equal magnitude in their original order, so indexing is repeatable.
+
+    stable_sort ( order.begin(), order.end(), [&] ( uint32_t a, uint32_t b )
+    {
+        return ids[a] < ids[b] || ( ids[a] == ids[b] && mags[a] < mags[b] );
+    } );
+
+    if ( _table )
+        _table->reorder ( order );
+    else
+        _compact->reorder ( order );
+
+    _trixelIDs.clear();
+    _trixelStart.clear();
+    for ( size_t i = 0; i < n; i++ )
+    {
+        uint64_t id = ids[ order[i] ];
+        if ( _trixelIDs.empty() || _trixelIDs.back() != id )
+        {
+            _trixelIDs.push_back ( id );
+            _trixelStart.push_back ( (uint32_t) i );
+        }
+    }
+    _trixelStart.push_back ( (uint32_t) n );
+
+    // Star colors from B-V color index; white if either magnitude is unknown.
+
+    _red.assign ( n, 1.0f );
+    _green.assign ( n, 1.0f );
+    _blue.assign ( n, 1.0f );
+    for ( size_t i = 0; i < n; i++ )
+    {
+        float bmv = _table ? _table->bmag[i] - _table->vmag[i] : _compact->getColorIndex ( i );
+        if ( ! isinf ( bmv ) && ! isnan ( bmv ) )
+            SSStar::bmv2rgb ( bmv, _red[i], _green[i], _blue[i] );
+    }
+
+    return _trixelIDs.size();
+}
+
+// Stars whose J2000 magnitude is up to this much fainter than the magnitude limit have their ephemeris computed,
+// in case space motion has brightened them; the computed magnitude is then tested against the limit.
+
+static constexpr float kMagSlack = 0.1;
+
+size_t SSStarPipeline::render ( SSCoordinates &coords, SSView &view, SSFrame frame, const Style &style, vector<Vertex> &vertices )
+{
+    double start = clocksec(), time = start, now = start;
+    auto lap = [&] ( double &seconds )
+    {
+        now = clocksec();
+        seconds += now - time;
+        time = now;
+    };
+
+    _stats = Stats();
+    vertices.clear();
+    if ( _trixelStart.size() != _trixelIDs.size() + 1 || _trixelStart.back() != tableSize() )
+        return 0;
+
+    // Skip parallax of stars it moves by less than the style's parallax pixels; restore the coordinates' limit after the frame.
+
+    float parallaxLimit = coords.getStarParallaxLimit();
+    if ( style.parallaxPixels > 0.0 )
+    {
+        double scale = min ( fabs ( view.getScaleX() ), fabs ( view.getScaleY() ) );
+        coords.setStarParallaxLimit ( max ( parallaxLimit, coords.starParallaxLimit ( style.parallaxPixels * scale ) ) );
+    }
+
+    // Project stars' fundamental-frame directions with one matrix from fundamental frame to view.
+
+    SSView fview = view;
+    fview.setCenterMatrix ( view.getCenterMatrix() * coords.getTransformMatrix ( kFundamental, frame ) );
+
+    // Find triangles covering a circle around the view center through its corners, plus margin;
+    // then in each triangle, the run of stars down to the magnitude limit. Runs which meet are merged.
+
+    SSProjection proj = view.getProjection();
+    double radius = INFINITY;
+    if ( proj == kGnomonic || proj == kOrthographic || proj == kStereographic )
+        radius = view.getAngularDiagonal() / 2.0 + _margin;
+
+    vector<pair<size_t,size_t>> trixels;
+    if ( radius < SSAngle::kPi )
+    {
+        SSHTM::Cover cover;
+        _htm.coverCircle ( fview.getCenterVector(), radius, _level, cover );
+        for ( const vector<SSHTM::IDRange> *pRanges : { &cover.full, &cover.partial } )
+            for ( const SSHTM::IDRange &range : *pRanges )
+            {
+                size_t first = lower_bound ( _trixelIDs.begin(), _trixelIDs.end(), range.first ) - _trixelIDs.begin();
+                size_t last = upper_bound ( _trixelIDs.begin(), _trixelIDs.end(), range.last ) - _trixelIDs.begin();
+                if ( first < last )
+                    trixels.push_back ( { first, last } );
+            }
+        sort ( trixels.begin(), trixels.end() );
+    }
+    else
+    {
+        trixels.push_back ( { 0, _trixelIDs.size() } );
+    }
+
+    // Stars in those triangles are culled individually against the view's circle, and the horizon if desired.
+
+    vector<SSStarTable::Bound> bounds;
+    if ( radius < SSAngle::kPi )
+        bounds.push_back ( { fview.getCenterVector(), view.getAngularDiagonal() / 2.0 } );
+    if ( style.horizon )
+        bounds.push_back ( SSStarTable::horizonBound ( coords, style.horizonMargin ) );
+
+    vector<pair<size_t,size_t>> runs;
+    float magLimit = style.magLimit + kMagSlack;
+    for ( const pair<size_t,size_t> &t : trixels )
+    {
+        _stats.trixels += t.second - t.first;
+        for ( size_t k = t.first; k < t.second; k++ )
+        {
+            // Stars in a triangle are sorted by magnitude; find the first one fainter than the limit.
+
+            size_t begin = _trixelStart[k], end = begin, count = _trixelStart[k + 1] - begin;
+            while ( count > 0 )
+            {
+                size_t half = count / 2;
+                if ( tableMagnitude ( end + half ) <= magLimit )
+                {
+                    end += half + 1;
+                    count -= half + 1;
+                }
+                else
+                {
+                    count = half;
+                }
+            }
+            if ( begin == end )
+                continue;
+            if ( ! runs.empty() && runs.back().second == begin )
+                runs.back().second = end;
+            else
+                runs.push_back ( { begin, end } );
+        }
+    }
+
+    _stats.ranges = runs.size();
+    lap ( _stats.cullSeconds );
+
+    // For each run of stars: compute ephemeris, project, and append visible stars down to the magnitude limit to the vertex buffer.
+
+    for ( const pair<size_t,size_t> &run : runs )
+    {
+        size_t begin = run.first, n = run.second - run.first, computed = 0;
+        const float *mag = nullptr;
+        if ( _float32 )
+        {
+            if ( _fx.size() < n )
+            {
+                for ( vector<float> *v : { &_dx, &_dy, &_dz, &_mag, &_fx, &_fy } )
+                    v->resize ( n );
+            }
+            if ( _compact )
+                computed = _compact->computeEphemeris ( coords, begin, run.second, _dx.data(), _dy.data(), _dz.data(), _mag.data(), bounds );
+            else
+                computed = _table->computeEphemeris ( coords, begin, run.second, _dx.data(), _dy.data(), _dz.data(), _mag.data(), bounds );
+            mag = _mag.data();
+        }
+        else
+        {
+            computed = _table->computeEphemeris ( coords, begin, run.second, bounds );
+            mag = &_table->magnitude[begin];
+        }
+        _stats.computed += computed;
+        _stats.culled += n - computed;
+        lap ( _stats.ephemerisSeconds );
+
+        if ( _float32 )
+        {
+            _stats.projected += fview.projectBatch ( _dx.data(), _dy.data(), _dz.data(), _fx.data(), _fy.data(), n );
+        }
+        else
+        {
+            if ( _x.size() < n )
+            {
+                _x.resize ( n );
+                _y.resize ( n );
+            }
+            _stats.projected += fview.projectBatch ( &_table->direction[begin], _x.data(), _y.data(), n );
+        }
+        lap ( _stats.projectSeconds );
+
+        for ( size_t i = 0; i < n; i++ )
+        {
+            float x = _float32 ? _fx[i] : (float) _x[i], y = _float32 ? _fy[i] : (float) _y[i];
+            if ( x == INFINITY || ! ( mag[i] <= style.magLimit ) )
+                continue;
+
+            double ratio = SSStar::brightnessRatio ( style.magLimit - mag[i] );
+            double r = style.scale * SSStar::moffatRadius ( 1.0, ratio, style.beta );
+            Vertex v = { x, y, (float) r, _red[begin + i], _green[begin + i], _blue[begin + i], (uint32_t) ( begin + i ) };
+            v.radius = min ( max ( v.radius, style.minRadius ), style.maxRadius );
+            vertices.push_back ( v );
+        }
+        lap ( _stats.vertexSeconds );
+    }
+
+    coords.setStarParallaxLimit ( parallaxLimit );
+    _stats.drawn = vertices.size();
+    _stats.frameSeconds = clocksec() - start;
+    return vertices.size();
+}
@@ -0,0 +1,131 @@
+// SSStarPipeline.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class draws the stars in a columnar star table (SSStarTable or SSCompactStarTable) in one pass per frame.
+// Instead of searching an SSHTM for star objects, then computing each star's ephemeris, transforming, projecting,
+// and testing it against the view separately, it sorts the table by HTM triangle and magnitude once; then each frame it finds the triangles
+// covering the view, and for each one computes the ephemeris of its stars down to the magnitude limit, projects them
+// with SSView::projectBatch(), and converts them to a ready-to-draw vertex buffer of positions, radii, and colors.
+// Times and counts for each stage of the last frame are kept for profiling.
+
+#ifndef SSStarPipeline_hpp
+#define SSStarPipeline_hpp
+
+#include "SSCompactStarTable.hpp"
+#include "SSHTM.hpp"
+
+class SSStarPipeline
+{
+public:
+
+    // A star ready to draw: its position in the view, radius in pixels, color, and index in the star table.
+
+    struct Vertex
+    {
+        float x, y;                 // position in view's 2D bounding rectangle
+        float radius;               // radius of star image in pixels
+        float red, green, blue;     // color components from 0.0 to 1.0
+        uint32_t index;             // index of star in table
+    };
+
+    // How stars are drawn. A star's image is a Moffat profile (see SSStar::moffatFunction()) whose peak intensity is
+    // its brightness relative to a star at the magnitude limit; its radius is where the profile falls to that star's
+    // peak intensity, multiplied by (scale), and kept between (minRadius) and (maxRadius).
+
+    struct Style
+    {
+        float magLimit = 6.5;       // faintest magnitude drawn
+        double beta = 2.5;          // Moffat profile exponent
+        float scale = 1.0;          // pixels per unit of Moffat radius
+        float minRadius = 0.5;      // radius of stars at magnitude limit, in pixels
+        float maxRadius = 32.0;     // largest radius of brightest stars, in pixels
+        bool horizon = false;       // if true, stars below the horizon are culled before their ephemeris is computed
+        double horizonMargin = SSStarTable::kHorizonMargin;   // radians below the horizon still drawn, for refraction
+        float parallaxPixels = 0.0; // if positive, parallax is only applied to stars it moves by at least this many pixels
+    };
+
+    // Counts and times in seconds for each stage of the last frame drawn.
+
+    struct Stats
+    {
+        size_t trixels = 0;         // HTM triangles covering the view
+        size_t ranges = 0;          // contiguous runs of stars in those triangles down to the magnitude limit
+        size_t culled = 0;          // stars in those runs rejected below the horizon or outside the view before their ephemeris
+        size_t computed = 0;        // stars whose ephemeris was computed
+        size_t projected = 0;       // stars inside the view's bounding rectangle
+        size_t drawn = 0;           // stars in vertex buffer
+        double cullSeconds = 0.0;   // time finding triangles and star ranges covering the view
+        double ephemerisSeconds = 0.0;  // time computing ephemeris
+        double projectSeconds = 0.0;    // time projecting stars into view
+        double vertexSeconds = 0.0;     // time filling vertex buffer
+        double frameSeconds = 0.0;      // total time for frame
+    };
+
+    static constexpr int kDefaultLevel = 5;
+    static constexpr double kDefaultMargin = 0.01;
+
+protected:
+
+    SSStarTable *_table;            // star table drawn, sorted by index(); or nullptr if drawing a compact table
+    SSCompactStarTable *_compact;   // compact star table drawn, sorted by index(); or nullptr if drawing a star table
+    SSHTM _htm;                     // used for its mesh geometry only; holds no objects
+    int _level;                     // HTM level of triangles in index
+    double _margin;                 // radians added to view radius to find stars which moved since J2000
+    vector<uint64_t> _trixelIDs;    // HTM IDs of triangles containing stars, in ascending order
+    vector<uint32_t> _trixelStart;  // index of first star in each triangle in table, plus table size at end
+    vector<float> _red, _green, _blue;  // star colors, in table order
+    vector<double> _x, _y;          // projected star positions; scratch storage
+    bool _float32;                  // if true, compute and project stars in single precision; see setFloat32()
+    vector<float> _dx, _dy, _dz, _mag;  // single-precision star directions and magnitudes; scratch storage
+    vector<float> _fx, _fy;         // single-precision projected star positions; scratch storage
+    Stats _stats;                   // counts and times for last frame
+
+    size_t tableSize ( void ) { return _table ? _table->size() : _compact->size(); }
+    float tableMagnitude ( size_t k ) { return _table ? _table->mag[k] : _compact->getMagnitude ( k ); }
+
+public:
+
+    // Creates a pipeline for a star table, using HTM triangles at mesh level (level) to cull stars outside the view,
+    // and adding (margin) radians to the view's radius to cover stars which moved from their J2000 triangle.
+
+    SSStarPipeline ( SSStarTable &table, int level = kDefaultLevel, double margin = kDefaultMargin );
+
+    // As above, but draws a compact star table (see SSCompactStarTable), always with the single-precision path,
+    // reading its quantized columns directly.
+
+    SSStarPipeline ( SSCompactStarTable &table, int level = kDefaultLevel, double margin = kDefaultMargin );
+
+    // Sorts the table by HTM triangle, and by magnitude within each triangle, and computes star colors.
+    // Call after the table is filled or changed, before render(). Returns the number of triangles containing stars.
+
+    size_t index ( void );
+
+    // Draws stars in a view whose celestial reference frame is (frame), at the time and location in (coords).
+    // Replaces the contents of (vertices) with stars inside the view's bounding rectangle down to the style's
+    // magnitude limit, ordered by triangle then magnitude; their table directions, distances, and magnitudes
+    // are updated, unless the float32 path is selected. Only azimuthal projections are culled by triangle; others compute every star down to the
+    // magnitude limit. Within each triangle, stars outside the view's circle, and below the horizon if the style asks, are rejected by
+    // SSStarTable's culling computeEphemeris() before their ephemeris is computed. If the style's parallax pixels are positive,
+    // the star parallax limit in (coords) is raised for the frame to the parallax which moves a star that far at the view's
+    // scale from the current observer position. Returns the number of stars drawn.
+
+    size_t render ( SSCoordinates &coords, SSView &view, SSFrame frame, const Style &style, vector<Vertex> &vertices );
+
+    // Selects the single-precision display path (float32) or the default double-precision one. With float32, render()
+    // computes star directions and magnitudes with SSStarTable's float computeEphemeris(), and projects them with the float
+    // SSView::projectBatch(), moving half as many bytes per star with twice as many SIMD lanes; the table's direction,
+    // distance, and magnitude columns are then not updated. Time, observer position, and frame matrices stay double, and
+    // drawn positions agree with the double path to well under a pixel.
+
+    void setFloat32 ( bool float32 ) { _float32 = float32 || _compact != nullptr; }
+    bool getFloat32 ( void ) { return _float32; }
+
+    // Returns counts and times for the last frame drawn.
+
+    const Stats &getStats ( void ) { return _stats; }
+};
+
+#endif /* SSStarPipeline_hpp */
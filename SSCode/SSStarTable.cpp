@@ -0,0 +1,735 @@
+// SSStarTable.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include "SSStarTable.hpp"
+
+SSStarTable::SSStarTable ( void )
+{
+    _epoch.jed = _next.jed = INFINITY;
+    _epochTolerance = 0.0;
+    _parallaxLimit = kDefaultParallaxLimit;
+    _refreshing = false;
+    _maxMotion = -1.0;
+    _maxParallax = -1.0;
+    _significantLimit = -1.0;
+#if USE_THREADS
+    _ready = false;
+#endif
+}
+
+SSStarTable::~SSStarTable ( void )
+{
+    finishRefresh();
+}
+
+void SSStarTable::clear ( void )
+{
+    finishRefresh();
+    _epoch.jed = _next.jed = INFINITY;
+    _maxMotion = _maxParallax = _significantLimit = -1.0;
+    _fpx.clear();
+    _fpy.clear();
+    _fpz.clear();
+    _fvx.clear();
+    _fvy.clear();
+    _fvz.clear();
+
+    _px.clear();
+    _py.clear();
+    _pz.clear();
+    _vx.clear();
+    _vy.clear();
+    _vz.clear();
+
+    type.clear();
+    idents.clear();
+    names.clear();
+    spectrum.clear();
+    parallax.clear();
+    radvel.clear();
+    vmag.clear();
+    bmag.clear();
+    mag.clear();
+
+    direction.clear();
+    distance.clear();
+    magnitude.clear();
+}
+
+void SSStarTable::reserve ( size_t size )
+{
+    finishRefresh();
+    _px.reserve ( size );
+    _py.reserve ( size );
+    _pz.reserve ( size );
+    _vx.reserve ( size );
+    _vy.reserve ( size );
+    _vz.reserve ( size );
+
+    type.reserve ( size );
+    idents.reserve ( size );
+    names.reserve ( size );
+    spectrum.reserve ( size );
+    parallax.reserve ( size );
+    radvel.reserve ( size );
+    vmag.reserve ( size );
+    bmag.reserve ( size );
+    mag.reserve ( size );
+}
+
+bool SSStarTable::push_back ( SSObjectPtr pObject )
+{
+    SSStarPtr pStar = SSGetStarPtr ( pObject );
+    if ( pStar == nullptr )
+        return false;
+
+    finishRefresh();
+    _epoch.jed = _next.jed = INFINITY;
+    _maxMotion = _maxParallax = _significantLimit = -1.0;
+
+    // Unknown space velocity is stored as zero, which leaves position unchanged exactly as skipping it would.
+
+    SSVector pos = pStar->getFundamentalPosition();
+    SSVector vel = pStar->getFundamentalVelocity();
+    if ( vel.isinf() || vel.isnan() )
+        vel = SSVector ( 0.0, 0.0, 0.0 );
+
+    _px.push_back ( pos.x );
+    _py.push_back ( pos.y );
+    _pz.push_back ( pos.z );
+    _vx.push_back ( vel.x );
+    _vy.push_back ( vel.y );
+    _vz.push_back ( vel.z );
+
+    type.push_back ( pStar->getType() );
+    idents.push_back ( pStar->getIdentifiers() );
+    names.push_back ( pStar->getNames() );
+    spectrum.push_back ( pStar->getSpectralType() );
+    parallax.push_back ( pStar->getParallax() );
+    radvel.push_back ( pStar->getRadVel() );
+    vmag.push_back ( pStar->getVMagnitude() );
+    bmag.push_back ( pStar->getBMagnitude() );
+    mag.push_back ( vmag.back() < INFINITY ? vmag.back() : bmag.back() );
+    return true;
+}
+
+int SSStarTable::append ( SSObjectArray &objects )
+{
+    int n = 0;
+
+    reserve ( size() + objects.size() );
+    for ( size_t i = 0; i < objects.size(); i++ )
+        if ( push_back ( objects[i] ) )
+            n++;
+
+    return n;
+}
+
+// Rearranges elements of a column (col) so the k-th element is the one formerly at index order[k].
+
+template<class T> static void reorder_column ( vector<T> &col, const vector<uint32_t> &order )
+{
+    vector<T> old;
+    old.swap ( col );
+    col.reserve ( order.size() );
+    for ( uint32_t i : order )
+        col.push_back ( std::move ( old[i] ) );
+}
+
+void SSStarTable::reorder ( const vector<uint32_t> &order )
+{
+    finishRefresh();
+    _epoch.jed = _next.jed = INFINITY;
+    _significantLimit = -1.0;
+    _fpx.clear();
+    _fpy.clear();
+    _fpz.clear();
+    _fvx.clear();
+    _fvy.clear();
+    _fvz.clear();
+
+    reorder_column ( _px, order );
+    reorder_column ( _py, order );
+    reorder_column ( _pz, order );
+    reorder_column ( _vx, order );
+    reorder_column ( _vy, order );
+    reorder_column ( _vz, order );
+
+    reorder_column ( type, order );
+    reorder_column ( idents, order );
+    reorder_column ( names, order );
+    reorder_column ( spectrum, order );
+    reorder_column ( parallax, order );
+    reorder_column ( radvel, order );
+    reorder_column ( vmag, order );
+    reorder_column ( bmag, order );
+    reorder_column ( mag, order );
+
+    direction.clear();
+    distance.clear();
+    magnitude.clear();
+}
+
+SSVector SSStarTable::getFundamentalVelocity ( size_t k )
+{
+    if ( _vx[k] == 0.0 && _vy[k] == 0.0 && _vz[k] == 0.0 )
+        return SSVector ( INFINITY, INFINITY, INFINITY );
+
+    return SSVector ( _vx[k], _vy[k], _vz[k] );
+}
+
+void SSStarTable::computeEphemeris ( SSCoordinates &coords )
+{
+    computeEphemeris ( coords, 0, size() );
+}
+
+// Each step below is a separate loop over plain arrays, with no function calls or branches other than selects,
+// so the compiler can vectorize it. Parallax and aberration use the batch SSCoordinates routines. Arithmetic
+// is done in the same order as SSStar::computeEphemeris(), so the results are identical.
+
+void SSStarTable::computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end )
+{
+    end = min ( end, size() );
+    if ( begin >= end )
+        return;
+
+    if ( direction.size() < size() )
+    {
+        direction.resize ( size(), SSVector ( INFINITY, INFINITY, INFINITY ) );
+        distance.resize ( size(), INFINITY );
+        magnitude.resize ( size(), INFINITY );
+    }
+
+    size_t n = end - begin;
+    if ( _epochTolerance > 0.0 )
+    {
+        updateEpoch ( coords.getJED(), coords.getStarMotion() );
+        computeFromEpoch ( coords, begin, end );
+    }
+    else
+    {
+        _dx.assign ( _px.begin() + begin, _px.begin() + end );
+        _dy.assign ( _py.begin() + begin, _py.begin() + end );
+        _dz.assign ( _pz.begin() + begin, _pz.begin() + end );
+        _delta.resize ( n );
+    
+        double *dx = _dx.data(), *dy = _dy.data(), *dz = _dz.data(), *delta = _delta.data();
+        const double *px = &_px[begin], *py = &_py[begin], *pz = &_pz[begin];
+        const float *plx = &parallax[begin];
+
+        // Add space velocity times years since J2000 to J2000 position.
+
+        if ( coords.getStarMotion() )
+        {
+            double dt = coords.getJED() - SSTime::kJ2000;
+            const double *vx = &_vx[begin], *vy = &_vy[begin], *vz = &_vz[begin];
+            for ( size_t i = 0; i < n; i++ )
+            {
+                dx[i] += vx[i] * dt / SSTime::kDaysPerJulianYear;
+                dy[i] += vy[i] * dt / SSTime::kDaysPerJulianYear;
+                dz[i] += vz[i] * dt / SSTime::kDaysPerJulianYear;
+            }
+        }
+
+        // Subtract observer position divided by star's J2000 distance, for stars with known parallax.
+
+        if ( coords.getStarParallax() )
+            applyStarParallax ( coords, begin, end, dx, dy, dz );
+
+        // Get ratio of current to J2000 distance (delta) unless direction is unchanged, then normalize direction,
+        // and compute distance and magnitude.
+
+        for ( size_t i = 0; i < n; i++ )
+        {
+            bool same = dx[i] == px[i] && dy[i] == py[i] && dz[i] == pz[i];
+            delta[i] = same ? 1.0 : sqrt ( dx[i] * dx[i] + dy[i] * dy[i] + dz[i] * dz[i] );
+            if ( ! same )
+            {
+                dx[i] /= delta[i];
+                dy[i] /= delta[i];
+                dz[i] /= delta[i];
+            }
+        }
+
+        double *dist = &distance[begin];
+        float *vmg = &magnitude[begin];
+        const float *m = &mag[begin];
+        for ( size_t i = 0; i < n; i++ )
+        {
+            dist[i] = plx[i] > 0.0 ? delta[i] * SSCoordinates::kAUPerParsec / plx[i] : INFINITY;
+            vmg[i] = delta[i] == 1.0 ? m[i] : m[i] + 5.0 * log10 ( delta[i] );
+        }
+    }
+
+    double *dx = _dx.data(), *dy = _dy.data(), *dz = _dz.data();
+
+    // Apply aberration of light, if desired.
+
+    if ( coords.getAberration() )
+        coords.applyAberration ( dx, dy, dz, n );
+
+    SSVector *dir = &direction[begin];
+    for ( size_t i = 0; i < n; i++ )
+        dir[i] = SSVector ( dx[i], dy[i], dz[i] );
+}
+
+void SSStarTable::computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end, float *x, float *y, float *z, float *mags )
+{
+    end = min ( end, size() );
+    if ( begin >= end )
+        return;
+
+    if ( _fpx.size() != size() )
+    {
+        _fpx.assign ( _px.begin(), _px.end() );
+        _fpy.assign ( _py.begin(), _py.end() );
+        _fpz.assign ( _pz.begin(), _pz.end() );
+        _fvx.assign ( _vx.begin(), _vx.end() );
+        _fvy.assign ( _vy.begin(), _vy.end() );
+        _fvz.assign ( _vz.begin(), _vz.end() );
+    }
+
+    size_t n = end - begin;
+    if ( _epochTolerance > 0.0 )
+    {
+        updateEpoch ( coords.getJED(), coords.getStarMotion() );
+        if ( _epoch.fx.size() != size() )
+        {
+            _epoch.fx.assign ( _epoch.qx.begin(), _epoch.qx.end() );
+            _epoch.fy.assign ( _epoch.qy.begin(), _epoch.qy.end() );
+            _epoch.fz.assign ( _epoch.qz.begin(), _epoch.qz.end() );
+        }
+
+        copy ( _epoch.fx.begin() + begin, _epoch.fx.begin() + end, x );
+        copy ( _epoch.fy.begin() + begin, _epoch.fy.begin() + end, y );
+        copy ( _epoch.fz.begin() + begin, _epoch.fz.begin() + end, z );
+        copy ( _epoch.mag.begin() + begin, _epoch.mag.begin() + end, mags );
+
+        // Parallax of near stars only, in double precision as computeFromEpoch() does; there are few of them.
+
+        if ( coords.getStarParallax() )
+        {
+            SSVector obs = coords.getObserverPosition();
+            auto k = lower_bound ( _epoch.nearby.begin(), _epoch.nearby.end(), (uint32_t) begin );
+            for ( ; k != _epoch.nearby.end() && *k < end; k++ )
+            {
+                size_t i = *k, j = i - begin;
+                if ( parallax[i] < coords.getStarParallaxLimit() )
+                    continue;
+                double s = parallax[i] / SSCoordinates::kAUPerParsec;
+                double px = _epoch.qx[i] * _epoch.delta[i] - obs.x * s;
+                double py = _epoch.qy[i] * _epoch.delta[i] - obs.y * s;
+                double pz = _epoch.qz[i] * _epoch.delta[i] - obs.z * s;
+                double d = sqrt ( px * px + py * py + pz * pz );
+                x[j] = px / d;
+                y[j] = py / d;
+                z[j] = pz / d;
+                mags[j] = mag[i] + 5.0 * log10 ( d );
+            }
+        }
+    }
+    else
+    {
+        const float *px = &_fpx[begin], *py = &_fpy[begin], *pz = &_fpz[begin];
+        copy ( px, px + n, x );
+        copy ( py, py + n, y );
+        copy ( pz, pz + n, z );
+
+        if ( coords.getStarMotion() )
+        {
+            float years = ( coords.getJED() - SSTime::kJ2000 ) / SSTime::kDaysPerJulianYear;
+            const float *vx = &_fvx[begin], *vy = &_fvy[begin], *vz = &_fvz[begin];
+            for ( size_t i = 0; i < n; i++ )
+            {
+                x[i] += vx[i] * years;
+                y[i] += vy[i] * years;
+                z[i] += vz[i] * years;
+            }
+        }
+
+        if ( coords.getStarParallax() )
+            applyStarParallax ( coords, begin, end, x, y, z );
+
+        const float *m = &mag[begin];
+        for ( size_t i = 0; i < n; i++ )
+        {
+            bool same = x[i] == px[i] && y[i] == py[i] && z[i] == pz[i];
+            float delta = same ? 1.0f : sqrt ( x[i] * x[i] + y[i] * y[i] + z[i] * z[i] );
+            x[i] /= delta;
+            y[i] /= delta;
+            z[i] /= delta;
+            mags[i] = same ? m[i] : m[i] + 5.0f * log10 ( delta );
+        }
+    }
+
+    if ( coords.getAberration() )
+        coords.applyAberration ( x, y, z, n );
+}
+
+// Subtracts the observer position divided by J2000 distance from directions (x, y, z) of stars from (begin) up to (end),
+// with the same arithmetic as SSCoordinates::applyStarParallax(). When the star parallax limit is positive, only
+// stars in the parallax significance index are visited; the index is rebuilt if the limit has moved out of its octave.
+
+template<class T> void SSStarTable::applyStarParallax ( SSCoordinates &coords, size_t begin, size_t end, T *x, T *y, T *z )
+{
+    float limit = coords.getStarParallaxLimit();
+    if ( limit <= 0.0 )
+    {
+        coords.applyStarParallax ( x, y, z, &parallax[begin], end - begin );
+        return;
+    }
+    
+    if ( ! ( limit >= _significantLimit && limit < 2.0 * _significantLimit ) )
+    {
+        _significantLimit = exp2 ( floor ( log2 ( limit ) ) );
+        _significant.clear();
+        for ( size_t i = 0; i < size(); i++ )
+            if ( parallax[i] >= _significantLimit )
+                _significant.push_back ( (uint32_t) i );
+    }
+    
+    SSVector obs = coords.getObserverPosition();
+    T ox = obs.x, oy = obs.y, oz = obs.z;
+    auto k = lower_bound ( _significant.begin(), _significant.end(), (uint32_t) begin );
+    for ( ; k != _significant.end() && *k < end; k++ )
+    {
+        size_t i = *k, j = i - begin;
+        if ( parallax[i] < limit )
+            continue;
+        
+        T s = parallax[i] / (T) SSCoordinates::kAUPerParsec;
+        x[j] -= ox * s;
+        y[j] -= oy * s;
+        z[j] -= oz * s;
+    }
+}
+
+SSStarTable::Bound SSStarTable::horizonBound ( SSCoordinates &coords, double margin )
+{
+    return { coords.transform<kHorizon, kFundamental> ( SSVector ( 0.0, 0.0, 1.0 ) ), SSAngle::kHalfPi + margin };
+}
+
+// Returns the most any star's apparent direction can differ from its J2000 direction, or its working epoch direction
+// if (epoch) is true, at the time and location in (coords): the angle subtended by the largest space motion since then,
+// plus the largest heliocentric parallax and the aberration. Returns infinity if motion is too large to bound this way.
+
+double SSStarTable::cullMargin ( SSCoordinates &coords, bool epoch )
+{
+    if ( _maxMotion < 0.0 )
+    {
+        _maxMotion = _maxParallax = 0.0;
+        for ( size_t i = 0; i < size(); i++ )
+        {
+            _maxMotion = max ( _maxMotion, _vx[i] * _vx[i] + _vy[i] * _vy[i] + _vz[i] * _vz[i] );
+            _maxParallax = max ( _maxParallax, parallax[i] );
+        }
+        _maxMotion = sqrt ( _maxMotion );
+    }
+
+    // With a working epoch, the directions tested and the directions computed may come from different epochs,
+    // each within the tolerance of the ephemeris time.
+    
+    double motion = 0.0;
+    if ( coords.getStarMotion() )
+    {
+        double days = epoch ? fabs ( coords.getJED() - _epoch.jed ) + _epochTolerance : fabs ( coords.getJED() - SSTime::kJ2000 );
+        motion = _maxMotion * days / SSTime::kDaysPerJulianYear;
+    }
+    
+    if ( motion >= 0.5 )
+        return INFINITY;
+
+    double margin = asin ( motion );
+    if ( coords.getStarParallax() )
+        margin += asin ( min ( coords.getObserverPosition().magnitude() * _maxParallax / SSCoordinates::kAUPerParsec / ( 1.0 - motion ), 1.0 ) );
+    if ( coords.getAberration() )
+        margin += asin ( min ( coords.getObserverVelocity().magnitude() / SSCoordinates::kLightAUPerDay, 1.0 ) );
+
+    return margin + kCullSlack;
+}
+
+// Tests directions of stars from (begin) up to (end) against caps in (bounds), and stores runs of stars to compute in _runs.
+// Gaps between runs shorter than kCullGap stars are included in the runs. Returns the number of stars in runs.
+
+size_t SSStarTable::cull ( SSCoordinates &coords, size_t begin, size_t end, const vector<Bound> &bounds )
+{
+    bool epoch = _epochTolerance > 0.0;
+    if ( epoch )
+        updateEpoch ( coords.getJED(), coords.getStarMotion() );
+    
+    size_t n = end - begin;
+    const double *qx = epoch ? &_epoch.qx[begin] : &_px[begin];
+    const double *qy = epoch ? &_epoch.qy[begin] : &_py[begin];
+    const double *qz = epoch ? &_epoch.qz[begin] : &_pz[begin];
+    double margin = cullMargin ( coords, epoch );
+    
+    _keep.assign ( n, 1 );
+    uint8_t *keep = _keep.data();
+    for ( const Bound &bound : bounds )
+    {
+        if ( bound.radius + margin >= SSAngle::kPi )
+            continue;
+        
+        double cx = bound.center.x, cy = bound.center.y, cz = bound.center.z, cosr = cos ( bound.radius + margin );
+        for ( size_t i = 0; i < n; i++ )
+            keep[i] &= qx[i] * cx + qy[i] * cy + qz[i] * cz >= cosr;
+    }
+    
+    size_t computed = 0;
+    _runs.clear();
+    for ( size_t i = 0; i < n; i++ )
+    {
+        if ( ! keep[i] )
+            continue;
+        if ( _runs.empty() || begin + i - _runs.back().second > kCullGap )
+            _runs.push_back ( { begin + i, begin + i } );
+        computed += begin + i + 1 - _runs.back().second;
+        _runs.back().second = begin + i + 1;
+    }
+    
+    return computed;
+}
+
+size_t SSStarTable::computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end, const vector<Bound> &bounds )
+{
+    end = min ( end, size() );
+    if ( begin >= end )
+        return 0;
+    
+    if ( direction.size() < size() )
+    {
+        direction.resize ( size(), SSVector ( INFINITY, INFINITY, INFINITY ) );
+        distance.resize ( size(), INFINITY );
+        magnitude.resize ( size(), INFINITY );
+    }
+
+    auto reject = [&] ( size_t from, size_t to )
+    {
+        fill ( direction.begin() + from, direction.begin() + to, SSVector ( INFINITY, INFINITY, INFINITY ) );
+        fill ( distance.begin() + from, distance.begin() + to, INFINITY );
+        fill ( magnitude.begin() + from, magnitude.begin() + to, INFINITY );
+    };
+
+    size_t computed = cull ( coords, begin, end, bounds ), i = begin;
+    for ( const pair<size_t,size_t> &run : _runs )
+    {
+        reject ( i, run.first );
+        computeEphemeris ( coords, run.first, run.second );
+        i = run.second;
+    }
+    reject ( i, end );
+
+    return computed;
+}
+
+size_t SSStarTable::computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end, float *x, float *y, float *z, float *mags, const vector<Bound> &bounds )
+{
+    end = min ( end, size() );
+    if ( begin >= end )
+        return 0;
+    
+    auto reject = [&] ( size_t from, size_t to )
+    {
+        for ( float *col : { x, y, z, mags } )
+            fill ( col + from - begin, col + to - begin, INFINITY );
+    };
+
+    size_t computed = cull ( coords, begin, end, bounds ), i = begin;
+    for ( const pair<size_t,size_t> &run : _runs )
+    {
+        size_t j = run.first - begin;
+        reject ( i, run.first );
+        computeEphemeris ( coords, run.first, run.second, x + j, y + j, z + j, mags + j );
+        i = run.second;
+    }
+    reject ( i, end );
+
+    return computed;
+}
+
+void SSStarTable::setEpochTolerance ( double days, float plx )
+{
+    finishRefresh();
+    if ( plx != _parallaxLimit )
+        _epoch.jed = _next.jed = INFINITY;
+
+    _epochTolerance = max ( days, 0.0 );
+    _parallaxLimit = plx;
+}
+
+// Computes working epoch (epoch) at Julian Ephemeris Date (jed), applying space motion if (motion) is true,
+// with the same arithmetic as computeEphemeris(). Only reads the table, so it can run on a background thread.
+
+void SSStarTable::computeEpoch ( Epoch &epoch, double jed, bool motion )
+{
+    size_t n = size();
+    epoch.qx = _px;
+    epoch.qy = _py;
+    epoch.qz = _pz;
+    epoch.delta.assign ( n, 1.0 );
+    epoch.mag = mag;
+    epoch.nearby.clear();
+    epoch.fx.clear();
+    epoch.fy.clear();
+    epoch.fz.clear();
+
+    if ( motion )
+    {
+        double dt = jed - SSTime::kJ2000;
+        double *qx = epoch.qx.data(), *qy = epoch.qy.data(), *qz = epoch.qz.data(), *delta = epoch.delta.data();
+        for ( size_t i = 0; i < n; i++ )
+        {
+            qx[i] += _vx[i] * dt / SSTime::kDaysPerJulianYear;
+            qy[i] += _vy[i] * dt / SSTime::kDaysPerJulianYear;
+            qz[i] += _vz[i] * dt / SSTime::kDaysPerJulianYear;
+        }
+        
+        for ( size_t i = 0; i < n; i++ )
+        {
+            bool same = qx[i] == _px[i] && qy[i] == _py[i] && qz[i] == _pz[i];
+            delta[i] = same ? 1.0 : sqrt ( qx[i] * qx[i] + qy[i] * qy[i] + qz[i] * qz[i] );
+            if ( ! same )
+            {
+                qx[i] /= delta[i];
+                qy[i] /= delta[i];
+                qz[i] /= delta[i];
+            }
+        }
+        
+        float *m = epoch.mag.data();
+        for ( size_t i = 0; i < n; i++ )
+            m[i] = delta[i] == 1.0 ? m[i] : m[i] + 5.0 * log10 ( delta[i] );
+    }
+
+    for ( size_t i = 0; i < n; i++ )
+        if ( parallax[i] > 0.0 && parallax[i] >= _parallaxLimit )
+            epoch.nearby.push_back ( (uint32_t) i );
+
+    epoch.jed = jed;
+    epoch.motion = motion;
+    epoch.parallaxLimit = _parallaxLimit;
+}
+
+// Waits for any background working epoch computation to finish.
+
+void SSStarTable::finishRefresh ( void )
+{
+#if USE_THREADS
+    if ( _refresh.joinable() )
+        _refresh.join();
+#endif
+    _refreshing = false;
+}
+
+// Makes sure the working epoch is valid at Julian Ephemeris Date (jed), with space motion applied if (motion)
+// is true, and starts computing the next working epoch in the background if the current one is half expired.
+
+void SSStarTable::updateEpoch ( double jed, bool motion )
+{
+    auto valid = [&] ( const Epoch &epoch )
+    {
+        return epoch.jed < INFINITY && epoch.motion == motion && epoch.parallaxLimit == _parallaxLimit
+            && epoch.delta.size() == size() && ( ! motion || fabs ( jed - epoch.jed ) <= _epochTolerance );
+    };
+
+#if USE_THREADS
+    if ( _refreshing && ( _ready || ! valid ( _epoch ) ) )
+    {
+        finishRefresh();
+        if ( valid ( _next ) )
+            swap ( _epoch, _next );
+    }
+#endif
+
+    if ( ! valid ( _epoch ) )
+    {
+        computeEpoch ( _epoch, jed, motion );
+        return;
+    }
+
+#if USE_THREADS
+    if ( motion && ! _refreshing && fabs ( jed - _epoch.jed ) > _epochTolerance / 2.0 )
+    {
+        _ready = false;
+        _refreshing = true;
+        _refresh = thread ( [this, jed, motion]()
+        {
+            computeEpoch ( _next, jed, motion );
+            _ready = true;
+        } );
+    }
+#endif
+}
+
+// Copies directions, distances, and magnitudes of stars from (begin) up to (end) from the working epoch,
+// then applies heliocentric parallax to near stars only, as in computeEphemeris().
+
+void SSStarTable::computeFromEpoch ( SSCoordinates &coords, size_t begin, size_t end )
+{
+    size_t n = end - begin;
+    _dx.assign ( _epoch.qx.begin() + begin, _epoch.qx.begin() + end );
+    _dy.assign ( _epoch.qy.begin() + begin, _epoch.qy.begin() + end );
+    _dz.assign ( _epoch.qz.begin() + begin, _epoch.qz.begin() + end );
+
+    double *dist = &distance[begin];
+    float *vmg = &magnitude[begin];
+    const double *delta = &_epoch.delta[begin];
+    const float *plx = &parallax[begin];
+    for ( size_t i = 0; i < n; i++ )
+        dist[i] = plx[i] > 0.0 ? delta[i] * SSCoordinates::kAUPerParsec / plx[i] : INFINITY;
+    copy ( _epoch.mag.begin() + begin, _epoch.mag.begin() + end, vmg );
+
+    if ( ! coords.getStarParallax() )
+        return;
+
+    SSVector obs = coords.getObserverPosition();
+    auto k = lower_bound ( _epoch.nearby.begin(), _epoch.nearby.end(), (uint32_t) begin );
+    for ( ; k != _epoch.nearby.end() && *k < end; k++ )
+    {
+        size_t i = *k, j = i - begin;
+        if ( parallax[i] < coords.getStarParallaxLimit() )
+            continue;
+        double s = parallax[i] / SSCoordinates::kAUPerParsec;
+        double x = _epoch.qx[i] * _epoch.delta[i] - obs.x * s;
+        double y = _epoch.qy[i] * _epoch.delta[i] - obs.y * s;
+        double z = _epoch.qz[i] * _epoch.delta[i] - obs.z * s;
+        double d = sqrt ( x * x + y * y + z * z );
+        _dx[j] = x / d;
+        _dy[j] = y / d;
+        _dz[j] = z / d;
+        dist[j] = d * SSCoordinates::kAUPerParsec / parallax[i];
+        vmg[j] = mag[i] + 5.0 * log10 ( d );
+    }
+}
+
+SSStarPtr SSStarTable::materialize ( size_t k )
+{
+    if ( k >= size() )
+        return nullptr;
+
+    SSStarPtr pStar = SSGetStarPtr ( SSNewObject ( type[k] ) );
+    if ( pStar == nullptr )
+        return nullptr;
+
+    pStar->setFundamentalPosition ( getFundamentalPosition ( k ) );
+    pStar->setFundamentalVelocity ( getFundamentalVelocity ( k ) );
+    pStar->setParallax ( parallax[k] );
+    pStar->setRadVel ( radvel[k] );
+    pStar->setVMagnitude ( vmag[k] );
+    pStar->setBMagnitude ( bmag[k] );
+    pStar->setSpectralType ( spectrum[k] );
+    pStar->setIdentifiers ( idents[k] );
+    pStar->setNames ( names[k] );
+
+    if ( k < direction.size() )
+    {
+        pStar->setDirection ( direction[k] );
+        pStar->setDistance ( distance[k] );
+        pStar->setMagnitude ( magnitude[k] );
+    }
+
+    return pStar;
+}
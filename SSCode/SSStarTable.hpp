@@ -0,0 +1,196 @@
+// SSStarTable.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class stores stars in columns - contiguous J2000 positions, space velocities, parallaxes, and magnitudes,
+// with identifiers, names, and spectral types in side tables - instead of as individual SSStar objects,
+// so that the apparent directions, distances, and magnitudes of millions of stars can be computed in tight loops
+// which the compiler can vectorize, without a virtual function call per star. The results are identical to
+// SSStar::computeEphemeris(). Individual SSStar objects can still be created on demand, e.g. for display.
+// Optionally, space motion can be applied at a working epoch near the current time, instead of every frame.
+
+#ifndef SSStarTable_hpp
+#define SSStarTable_hpp
+
+#include "SSStar.hpp"
+
+#if USE_THREADS
+#include <atomic>
+#include <thread>
+#endif
+
+class SSStarTable
+{
+public:
+
+    // A cap of sky used to cull stars before their ephemeris is computed: all directions within (radius) radians
+    // of the unit vector (center) in the fundamental frame. A radius of pi or more includes the whole sky.
+
+    struct Bound
+    {
+        SSVector center;
+        double radius;
+    };
+
+protected:
+
+    // Star directions and magnitudes with space motion applied at a working epoch; see setEpochTolerance().
+    
+    struct Epoch
+    {
+        double jed;                         // working epoch as Julian Ephemeris Date; infinite if not computed
+        bool motion;                        // true if space motion was applied
+        float parallaxLimit;                // parallax limit in arcseconds used to find near stars
+        vector<double> qx, qy, qz;          // unit vectors toward stars at working epoch, in fundamental frame
+        vector<double> delta;               // ratio of distance at working epoch to J2000 distance
+        vector<float> mag;                  // visual magnitude at working epoch
+        vector<uint32_t> nearby;            // indices of stars whose parallax is at or above the parallax limit, in order
+        vector<float> fx, fy, fz;           // single-precision copies of qx, qy, qz; empty until needed for float32 ephemeris
+    };
+    
+    Epoch _epoch, _next;                    // current working epoch, and next one being computed in background
+    double _epochTolerance;                 // maximum days between working epoch and ephemeris time; zero to always compute exactly
+    float _parallaxLimit;                   // per-frame parallax is only applied to stars with this parallax or more, in arcseconds
+    bool _refreshing;                       // true while the next working epoch is being computed
+#if USE_THREADS
+    thread _refresh;                        // background thread computing next working epoch
+    atomic<bool> _ready;                    // set by background thread when next working epoch is ready
+#endif
+
+    vector<double> _px, _py, _pz;       // heliocentric J2000 position unit vectors in fundamental frame
+    vector<double> _vx, _vy, _vz;       // heliocentric space velocities in fundamental frame in distance units per Julian year; zero if unknown
+    vector<double> _dx, _dy, _dz, _delta;   // apparent directions and distance ratios; scratch storage for computeEphemeris()
+    vector<float> _fpx, _fpy, _fpz;     // single-precision copies of _px, _py, _pz; empty until needed for float32 ephemeris
+    vector<float> _fvx, _fvy, _fvz;     // single-precision copies of _vx, _vy, _vz; likewise
+    double _maxMotion;                  // largest space velocity magnitude in distance units per Julian year; negative until computed
+    float _maxParallax;                 // largest parallax in arcseconds; likewise
+    vector<uint32_t> _significant;      // indices of stars whose parallax is at least _significantLimit, in order
+    float _significantLimit;            // power of two at or below the coordinates' star parallax limit; negative until computed
+    vector<uint8_t> _keep;              // nonzero for stars which survive culling; scratch storage for computeEphemeris()
+    vector<pair<size_t,size_t>> _runs;  // runs of stars to compute after culling; likewise
+
+    static constexpr size_t kCullGap = 16;          // runs of fewer rejected stars than this are computed anyway
+    static constexpr double kCullSlack = 1.0e-6;    // radians added to culling margin for rounding
+
+    void computeEpoch ( Epoch &epoch, double jed, bool motion );
+    void updateEpoch ( double jed, bool motion );
+    void finishRefresh ( void );
+    void computeFromEpoch ( SSCoordinates &coords, size_t begin, size_t end );
+    double cullMargin ( SSCoordinates &coords, bool epoch );
+    template<class T> void applyStarParallax ( SSCoordinates &coords, size_t begin, size_t end, T *x, T *y, T *z );
+    size_t cull ( SSCoordinates &coords, size_t begin, size_t end, const vector<Bound> &bounds );
+
+public:
+
+    vector<SSObjectType>         type;          // object type, usually kTypeStar
+    vector<vector<SSIdentifier>> idents;        // identifiers
+    vector<vector<string>>       names;         // name string(s)
+    vector<string>               spectrum;      // spectral type string
+    vector<float>                parallax;      // heliocentric parallax in arcseconds; zero if unknown
+    vector<float>                radvel;        // radial velocity as fraction of light speed; infinite if unknown
+    vector<float>                vmag;          // visual magnitude at J2000; infinite if unknown
+    vector<float>                bmag;          // blue magnitude at J2000; infinite if unknown
+    vector<float>                mag;           // visual magnitude at J2000, or blue magnitude if visual is unknown
+
+    // Results of computeEphemeris(); empty until then.
+
+    vector<SSVector>             direction;     // apparent direction from observer as unit vector in fundamental frame
+    vector<double>               distance;      // distance from observer in AU; infinite if parallax is unknown
+    vector<float>                magnitude;     // visual magnitude at current distance; infinite if unknown
+
+    SSStarTable ( void );
+    SSStarTable ( const SSStarTable &other ) = delete;
+    SSStarTable &operator = ( const SSStarTable &other ) = delete;
+    ~SSStarTable ( void );
+    
+    size_t size ( void ) { return type.size(); }
+    void clear ( void );
+    void reserve ( size_t size );
+
+    // Appends a star, or any other object stored as an SSStar (e.g. double and variable stars, deep sky objects),
+    // copying its base SSStar data only. Returns false (and does nothing) if the object is not an SSStar.
+
+    bool push_back ( SSObjectPtr pObject );
+
+    // Appends all stars in an object array to the table; returns number of objects appended.
+
+    int append ( SSObjectArray &objects );
+
+    // Reorders the table so the k-th star is the one formerly at index order[k], e.g. to store nearby stars contiguously.
+    // (order) must be a permutation of 0 ... size() - 1. Clears the results of computeEphemeris() and the working epoch.
+
+    void reorder ( const vector<uint32_t> &order );
+
+    // Returns k-th star's J2000 position unit vector and space velocity (infinite if unknown).
+
+    SSVector getFundamentalPosition ( size_t k ) { return SSVector ( _px[k], _py[k], _pz[k] ); }
+    SSVector getFundamentalVelocity ( size_t k );
+
+    // Computes apparent direction, distance, and magnitude of all stars, or of the stars with indices from
+    // (begin) up to (but not including) (end), at the time and observer location in a coordinates object (coords),
+    // exactly as SSStar::computeEphemeris() does: applying space motion, heliocentric parallax, the resulting
+    // change in magnitude, and aberration, as enabled in (coords). Results for other stars are unchanged.
+    // Double star orbital motion around a primary is not applied; the table only has base SSStar data.
+
+    void computeEphemeris ( SSCoordinates &coords );
+    void computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end );
+
+    // Single-precision version of computeEphemeris() for display, e.g. SSStarPipeline's float32 path. Writes apparent
+    // directions of stars (begin) up to (end) as separate arrays (x, y, z), and their magnitudes to (mags), each with room
+    // for end - begin values; the direction, distance, and magnitude columns are unchanged. It reads float copies of the
+    // J2000 positions and velocities, made on first use, so it moves half as many bytes per star; the ephemeris time and
+    // observer position are kept in double precision. Directions agree with computeEphemeris() to about 1.0e-7 radians.
+
+    void computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end, float *x, float *y, float *z, float *mags );
+
+    // Returns the part of the sky above the horizon at the time and location in (coords), extended (margin) radians below
+    // the horizon for stars which refraction lifts above it. The default, one degree, is almost twice the refraction at the horizon.
+
+    static constexpr double kHorizonMargin = SSAngle::kRadPerDeg;
+
+    static Bound horizonBound ( SSCoordinates &coords, double margin = kHorizonMargin );
+
+    // Culling versions of computeEphemeris(): stars from (begin) up to (end) outside any of the caps in (bounds) are rejected
+    // with a test of their J2000 (or working epoch) directions, widened by a conservative margin for the largest space motion,
+    // parallax, and aberration in the table, before anything else is computed for them. Their directions and magnitudes
+    // (and distances, in the double version) are set to infinity; other stars get exactly the results computeEphemeris()
+    // would. Rejected stars are skipped in runs, so culling saves the most work when the table is ordered by position,
+    // e.g. by SSStarPipeline::index(). Returns the number of stars whose ephemeris was computed.
+
+    size_t computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end, const vector<Bound> &bounds );
+    size_t computeEphemeris ( SSCoordinates &coords, size_t begin, size_t end, float *x, float *y, float *z, float *mags, const vector<Bound> &bounds );
+
+    // All versions of computeEphemeris() honor the star parallax limit in (coords); see SSCoordinates::starParallaxLimit().
+    // When it is positive, stars are partitioned once by parallax significance - an index of the stars whose parallax
+    // is at least the limit, rounded down to a power of two - and parallax is applied to those stars only, so the
+    // index is rebuilt only when the limit changes by a factor of two. Results are identical to applying parallax
+    // with the limit to every star.
+
+    // Sets or returns maximum days between a working epoch and the ephemeris time (days). When positive,
+    // computeEphemeris() applies space motion, and the resulting magnitude change, once at a working epoch,
+    // instead of at every call; then each call only applies heliocentric parallax to stars whose parallax is at
+    // or above a limit (plx, in arcseconds), and aberration to all stars. Other stars' directions, distances, and
+    // magnitudes are used unchanged from the working epoch. When the ephemeris time moves more than half the
+    // tolerance from the working epoch, a new working epoch is computed on a background thread, and used once
+    // it is ready or once the time exceeds the tolerance. Zero (the default) makes computeEphemeris() exact.
+    // Errors are at most the stars' space motion during (days), plus their parallax below (plx).
+    // The table must not be changed from another thread while computeEphemeris() may be running.
+
+    static constexpr double kDefaultEpochTolerance = 1.0;
+    static constexpr float kDefaultParallaxLimit = 0.01;
+
+    void setEpochTolerance ( double days, float plx = kDefaultParallaxLimit );
+    double getEpochTolerance ( void ) { return _epochTolerance; }
+    float getParallaxLimit ( void ) { return _parallaxLimit; }
+    double getWorkingEpoch ( void ) { return _epoch.jed; }
+
+    // Creates a new object of the k-th star's type, with its base SSStar data, and its direction, distance,
+    // and magnitude from the last computeEphemeris(). The caller owns (and must delete) the result.
+    // Returns nullptr if k is out of range.
+
+    SSStarPtr materialize ( size_t k );
+};
+
+#endif /* SSStarTable_hpp */
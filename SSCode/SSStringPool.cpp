@@ -0,0 +1,66 @@
+// SSStringPool.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include "SSStringPool.hpp"
+
+const string *SSStringPool::empty ( void )
+{
+    static const string _empty;
+    return &_empty;
+}
+
+// The global pool is never destroyed, so its strings stay valid even in objects destroyed at program exit.
+
+SSStringPool &SSStringPool::global ( void )
+{
+    static SSStringPool *_global = new SSStringPool();
+    return *_global;
+}
+
+const string *SSStringPool::intern ( const string &str )
+{
+    if ( str.empty() )
+        return empty();
+
+#if USE_THREADS
+    lock_guard<mutex> lock ( _mutex );
+#endif
+    return &*_strings.insert ( str ).first;
+}
+
+const string *SSStringPool::find ( const string &str )
+{
+    if ( str.empty() )
+        return empty();
+
+#if USE_THREADS
+    lock_guard<mutex> lock ( _mutex );
+#endif
+    auto it = _strings.find ( str );
+    return it == _strings.end() ? nullptr : &*it;
+}
+
+size_t SSStringPool::size ( void )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _mutex );
+#endif
+    return _strings.size();
+}
+
+// Each node of the hash set holds a string and a pointer to the next node; libstdc++ also caches the hash.
+
+size_t SSStringPool::memoryUsage ( void )
+{
+#if USE_THREADS
+    lock_guard<mutex> lock ( _mutex );
+#endif
+    size_t bytes = heapbytes ( _strings.bucket_count() * sizeof ( void * ) );
+    for ( const string &str : _strings )
+        bytes += heapbytes ( sizeof ( string ) + 2 * sizeof ( void * ) ) + strbytes ( str );
+
+    return bytes;
+}
@@ -0,0 +1,100 @@
+// SSStringPool.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/14/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// String interning for names, spectral types, and other strings repeated across millions of objects.
+// An SSStringPool stores one copy of each distinct string, which is never freed while the pool exists;
+// an SSIString is a handle to a string in a pool, the size of a pointer. Handles to the same string
+// in the same pool compare equal by comparing pointers. The global pool is used unless another is given.
+// The global pool lives for the whole program, so every string ever interned in it stays in memory even after
+// all objects using it are deleted, e.g. when SSHTM regions are evicted; memoryUsage() reports how large it has grown.
+
+#ifndef SSStringPool_hpp
+#define SSStringPool_hpp
+
+#include <string>
+#include <unordered_set>
+
+#include "SSUtilities.hpp"
+
+#if USE_THREADS
+#include <mutex>
+#endif
+
+using namespace std;
+
+class SSStringPool
+{
+protected:
+    unordered_set<string> _strings;     // distinct strings; elements never move, so pointers to them stay valid
+#if USE_THREADS
+    mutex _mutex;                       // pools may be used from several threads, e.g. by parallel CSV import
+#endif
+
+public:
+    SSStringPool ( void ) {}
+    SSStringPool ( const SSStringPool &other ) = delete;
+    SSStringPool &operator = ( const SSStringPool &other ) = delete;
+
+    // Returns pointer to this pool's copy of a string (str), adding it if not already present.
+    // All pools return the same pointer for the empty string.
+
+    const string *intern ( const string &str );
+
+    // Returns pointer to this pool's copy of a string (str), or nullptr if the string is not in this pool.
+
+    const string *find ( const string &str );
+
+    size_t size ( void );
+
+    // Returns heap memory used by this pool, in bytes: its hash table, nodes, and string contents.
+
+    size_t memoryUsage ( void );
+
+    static const string *empty ( void );
+    static SSStringPool &global ( void );
+};
+
+class SSIString
+{
+protected:
+    const string *_str;     // string in a pool; never nullptr
+
+public:
+    SSIString ( void ) : _str ( SSStringPool::empty() ) {}
+    SSIString ( const string &str ) : _str ( SSStringPool::global().intern ( str ) ) {}
+    SSIString ( const char *str ) : _str ( SSStringPool::global().intern ( str ) ) {}
+    SSIString ( const string &str, SSStringPool &pool ) : _str ( pool.intern ( str ) ) {}
+
+    // Creates handle from a pointer already returned by SSStringPool::intern() or find(); nullptr gives the empty string.
+
+    explicit SSIString ( const string *str ) : _str ( str ? str : SSStringPool::empty() ) {}
+
+    operator const string & ( void ) const { return *_str; }
+    const string &str ( void ) const { return *_str; }
+    const char *c_str ( void ) const { return _str->c_str(); }
+    size_t length ( void ) const { return _str->length(); }
+    bool empty ( void ) const { return _str->empty(); }
+    char operator [] ( size_t i ) const { return (*_str)[i]; }
+
+    // Handles are equal only if they point to the same string, so handles to equal strings in different pools
+    // are not equal; compare their str() instead. Ordering is by string content, as for std::string.
+
+    bool operator == ( const SSIString &other ) const { return _str == other._str; }
+    bool operator != ( const SSIString &other ) const { return _str != other._str; }
+    bool operator < ( const SSIString &other ) const { return _str != other._str && *_str < *other._str; }
+    bool operator == ( const string &other ) const { return *_str == other; }
+    bool operator != ( const string &other ) const { return *_str != other; }
+};
+
+// Concatenation with ordinary strings, since std::string's operator + templates don't apply implicit conversions.
+
+inline string operator + ( const SSIString &a, const string &b ) { return a.str() + b; }
+inline string operator + ( const string &a, const SSIString &b ) { return a + b.str(); }
+inline string operator + ( const SSIString &a, const char *b ) { return a.str() + b; }
+inline string operator + ( const char *a, const SSIString &b ) { return a + b.str(); }
+inline string operator + ( const SSIString &a, char b ) { return a.str() + b; }
+
+#endif /* SSStringPool_hpp */
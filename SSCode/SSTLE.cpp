@@ -14,12 +14,35 @@
 
 #include "SSUtilities.hpp"
 #include "SSTime.hpp"
+#include "SSCoordinates.hpp"
 #include "SSTLE.hpp"
+#include "SSTrig.hpp"
+
+#if USE_THREADS
+#include <thread>
+#endif
+
+// Orbit model and elements from which an orbit model's arguments were initialized.
+// This is the first member of every model's arguments, so it can be checked before knowing the model.
+
+enum orbit_model
+{
+    sgp_model = 1,      // SGP arguments
+    sgp4_model = 2,     // SGP4 arguments
+    sdp4_model = 3      // SDP4 arguments
+};
+
+struct init_args
+{
+    int model;
+    double jdepoch, bstar, xincl, xnodeo, eo, omegao, xmo, xno;
+};
 
 // Static data used by SGP orbit model
 
 struct sgp_args
 {
+    struct init_args init;
     double ao,qo,xlo,d1o,d2o,d3o,d4o,omgdt,xnodot,c5,c6;
 };
 
@@ -27,6 +50,7 @@ struct sgp_args
 
 struct sgp4_args
 {
+    struct init_args init;
     int isimp;
     double aodp,aycof,c1,c4,c5,cosio,d2,d3,d4,delmo,omgcof,
            eta,omgdot,sinio,xnodp,sinmo,t2cof,t3cof,t4cof,t5cof,
@@ -64,6 +88,7 @@ struct deep_args
 
 struct sdp4_args
 {
+    struct init_args init;
     double x3thm1,c1,x1mth2,c4,xnodcf,t2cof,xlcof,aycof,x7thm1;
 
     struct deep_args deep;
@@ -286,13 +311,84 @@ SSTLE::SSTLE ( void )
     argp.sgp = nullptr;
 }
 
-// copy constructor nullifies argp pointer; any of the sgp() methods will re-create it.
-// This ensures that deleting this SSTLE won't delete the original SSTLE's argp.
+// copy constructor and assignment operator copy elements, but not the argp pointer; any of the sgp() methods
+// will re-create it. This ensures that deleting this SSTLE won't delete the original SSTLE's argp.
 
 SSTLE::SSTLE ( const SSTLE &other )
 {
-    *this = other;
     argp.sgp = nullptr;
+    *this = other;
+}
+
+SSTLE &SSTLE::operator = ( const SSTLE &other )
+{
+    if ( this != &other )
+    {
+        delargs();
+        name = other.name;
+        desig = other.desig;
+        norad = other.norad;
+        jdepoch = other.jdepoch;
+        xndt2o = other.xndt2o;
+        xndd6o = other.xndd6o;
+        bstar = other.bstar;
+        xincl = other.xincl;
+        xnodeo = other.xnodeo;
+        eo = other.eo;
+        omegao = other.omegao;
+        xmo = other.xmo;
+        xno = other.xno;
+        deep = other.deep;
+    }
+    
+    return *this;
+}
+
+SSTLE::~SSTLE ( void )
+{
+    delargs();
+}
+
+// Returns true if argp holds arguments for an orbit model (model) which were initialized from the current elements.
+// So if elements are changed after initialization, the next propagation re-initializes.
+
+bool SSTLE::hasargs ( int model )
+{
+    init_args *init = argp.init;
+    
+    return init && init->model == model && init->jdepoch == jdepoch && init->bstar == bstar && init->xincl == xincl
+        && init->xnodeo == xnodeo && init->eo == eo && init->omegao == omegao && init->xmo == xmo && init->xno == xno;
+}
+
+// Records orbit model (model) and current elements in newly-allocated arguments (init).
+
+void SSTLE::setargs ( init_args *init, int model )
+{
+    init->model = model;
+    init->jdepoch = jdepoch;
+    init->bstar = bstar;
+    init->xincl = xincl;
+    init->xnodeo = xnodeo;
+    init->eo = eo;
+    init->omegao = omegao;
+    init->xmo = xmo;
+    init->xno = xno;
+}
+
+// Initializes SGP4, or SDP4 for deep-space TLEs, now instead of on first use, unless already initialized
+// from the current elements. After this, toPositionVelocity() only runs the time-dependent part of the model.
+
+void SSTLE::init ( void )
+{
+    if ( deep && ! hasargs ( sdp4_model ) )
+        sdp4init();
+    else if ( ! deep && ! hasargs ( sgp4_model ) )
+        sgp4init();
+}
+
+bool SSTLE::initialized ( void )
+{
+    return hasargs ( deep ? sdp4_model : sgp4_model );
 }
 
 // Determines whether to use a deep-space (true) or near-Earth (false) ephemeris.
@@ -1025,11 +1121,13 @@ void SSTLE::sgp ( double tsince, SSVector &pos, SSVector &vel )
 
     int i;
 
-    if ( argp.sgp == nullptr )
+    if ( ! hasargs ( sgp_model ) )
     {
         // Initialization
 
+        delargs();
         sgp_args *arg = argp.sgp = new sgp_args;
+        setargs ( &arg->init, sgp_model );
 
         c1 = ck2 * 1.5;
         c2 = ck2 / 4.0;
@@ -1192,202 +1290,204 @@ void SSTLE::sgp ( double tsince, SSVector &pos, SSVector &vel )
     vel.z = rvdot * vz + vel.z;
 }
 
-// SGP4 orbit model. Computes satellite position and velocity
-// in Earth-centered, inertial equatorial reference frame,
-// in units of Earth-radii and Earth-radii per minute.
-// Elapsed time since orbital element epoch (tsince) is in minutes.
-// Use this for near-Earth satellites with orbit periods < 225 minutes.
+// Initializes SGP4 orbit model arguments from this TLE's elements.
 
-void SSTLE::sgp4 ( double tsince, SSVector &pos, SSVector &vel )
+void SSTLE::sgp4init ( void )
 {
-    double aodp,aycof,c1,c4,c5,cosio,d2,d3,d4,delmo,omgcof,
-           eta,omgdot,sinio,xnodp,sinmo,t2cof,t3cof,t4cof,t5cof,
-           x1mth2,x3thm1,x7thm1,xmcof,xmdot,xnodcf,xnodot,xlcof;
- 
-    double cosuk,sinuk,rfdotk,vx,vy,vz,ux,uy,uz,xmy,xmx,
-           cosnok,sinnok,cosik,sinik,rdotk,xinck,xnodek,uk,
-           rk,cos2u,sin2u,u,sinu,cosu,betal,rfdot,rdot,r,pl,
-           elsq,esine,ecose,epw,cosepw,x1m5th,xhdot1,tfour,
-           sinepw,capu,ayn,xlt,aynl,xll,axn,xn,beta,xl,e,a,
-           tcube,delm,delomg,templ,tempe,tempa,xnode,tsq,xmp,
-           omega,xnoddf,omgadf,xmdf,a1,a3ovk2,ao,betao,betao2,
-           c1sq,c2,c3,coef,coef1,del1,delo,eeta,eosq,etasq,
-           perige,pinvsq,psisq,qoms24,s4,temp,temp1,temp2,
-           temp3,temp4,temp5,temp6,theta2,theta4,tsi;
+    double aodp,aycof,c1,c4,c5,cosio,d2,d3,d4,delmo,omgcof,eta,omgdot,sinio,xnodp,sinmo,t2cof,t3cof,
+           t4cof,t5cof,x1mth2,x3thm1,x7thm1,xmcof,xmdot,xnodcf,xnodot,xlcof,x1m5th,xhdot1,
+           a1,a3ovk2,ao,betao,betao2,c1sq,c2,c3,coef,coef1,del1,delo,eeta,eosq,etasq,perige,pinvsq,
+           psisq,qoms24,s4,temp,temp1,temp2,temp3,theta2,theta4,tsi;
 
-    int i;
+    delargs();
+    sgp4_args *arg = argp.sgp4 = new sgp4_args;
+    setargs ( &arg->init, sgp4_model );
+
+    // Recover original mean motion (xnodp) and
+    // semimajor axis (aodp) from input elements.
+    
+    a1 = pow(xke/xno,tothrd);
+    cosio = cos(xincl);
+    theta2 = cosio*cosio;
+    x3thm1 = 3*theta2-1.0;
+    eosq = eo*eo;
+    betao2 = 1-eosq;
+    betao = sqrt(betao2);
+    del1 = 1.5*ck2*x3thm1/(a1*a1*betao*betao2);
+    ao = a1*(1-del1*(0.5*tothrd+del1*(1+134/81*del1)));
+    delo = 1.5*ck2*x3thm1/(ao*ao*betao*betao2);
+    xnodp = xno/(1+delo);
+    aodp = ao/(1-delo);
+
+    // For perigee less than 220 kilometers, the "simple" flag is set
+    // and the equations are truncated to linear variation in sqrt a
+    // and quadratic variation in mean anomaly.  Also, the c3 term,
+    // the delta omega term, and the delta m term are dropped.
+    
+    if((aodp*(1-eo)/xae) < (220/xkmper+xae))
+        arg->isimp = 1;
+    else
+        arg->isimp = 0;
 
-    sgp4_args *arg;
+    // For perigee below 156 km, the
+    // values of s and qoms2t are altered.
     
-    if ( argp.sgp4 == nullptr )
+    s4 = s;
+    qoms24 = qoms2t;
+    perige = (aodp*(1-eo)-xae)*xkmper;
+    if(perige < 156)
     {
-        // Initialization
-
-        arg = argp.sgp4 = new sgp4_args;
-
-        // Recover original mean motion (xnodp) and
-        // semimajor axis (aodp) from input elements.
-        
-        a1 = pow(xke/xno,tothrd);
-        cosio = cos(xincl);
-        theta2 = cosio*cosio;
-        x3thm1 = 3*theta2-1.0;
-        eosq = eo*eo;
-        betao2 = 1-eosq;
-        betao = sqrt(betao2);
-        del1 = 1.5*ck2*x3thm1/(a1*a1*betao*betao2);
-        ao = a1*(1-del1*(0.5*tothrd+del1*(1+134/81*del1)));
-        delo = 1.5*ck2*x3thm1/(ao*ao*betao*betao2);
-        xnodp = xno/(1+delo);
-        aodp = ao/(1-delo);
-
-        // For perigee less than 220 kilometers, the "simple" flag is set
-        // and the equations are truncated to linear variation in sqrt a
-        // and quadratic variation in mean anomaly.  Also, the c3 term,
-        // the delta omega term, and the delta m term are dropped.
-        
-        if((aodp*(1-eo)/xae) < (220/xkmper+xae))
-            arg->isimp = 1;
-        else
-            arg->isimp = 0;
-
-        // For perigee below 156 km, the
-        // values of s and qoms2t are altered.
-        
-        s4 = s;
-        qoms24 = qoms2t;
-        perige = (aodp*(1-eo)-xae)*xkmper;
-        if(perige < 156)
-        {
-            if(perige <= 98)
-                s4 = 20;
-            else
-                s4 = perige-78;
-            qoms24 = pow((120-s4)*xae/xkmper,4);
-            s4 = s4/xkmper+xae;
-        }
-
-        pinvsq = 1/(aodp*aodp*betao2*betao2);
-        tsi = 1/(aodp-s4);
-        eta = aodp*eo*tsi;
-        etasq = eta*eta;
-        eeta = eo*eta;
-        psisq = fabs(1-etasq);
-        coef = qoms24*pow(tsi,4);
-        coef1 = coef/pow(psisq,3.5);
-        c2 = coef1*xnodp*(aodp*(1+1.5*etasq+eeta*(4+etasq))+
-        0.75*ck2*tsi/psisq*x3thm1*(8+3*etasq*(8+etasq)));
-        c1 = bstar*c2;
-        sinio = sin(xincl);
-        a3ovk2 = -xj3/ck2*pow(xae,3);
-        c3 = coef*tsi*a3ovk2*xnodp*xae*sinio/eo;
-        x1mth2 = 1-theta2;
-        c4 = 2*xnodp*coef1*aodp*betao2*(eta*(2+0.5*etasq)+
-        eo*(0.5+2*etasq)-2*ck2*tsi/(aodp*psisq)*
-        (-3*x3thm1*(1-2*eeta+etasq*(1.5-0.5*eeta))+0.75*
-        x1mth2*(2*etasq-eeta*(1+etasq))*cos(2*omegao)));
-        c5 = 2*coef1*aodp*betao2*(1+2.75*(etasq+eeta)+eeta*etasq);
-        theta4 = theta2*theta2;
-        temp1 = 3*ck2*pinvsq*xnodp;
-        temp2 = temp1*ck2*pinvsq;
-        temp3 = 1.25*ck4*pinvsq*pinvsq*xnodp;
-        xmdot = xnodp+0.5*temp1*betao*x3thm1+0.0625*temp2*betao*(13-78*theta2+137*theta4);
-        x1m5th = 1-5*theta2;
-        omgdot = -0.5*temp1*x1m5th+0.0625*temp2*(7-114*theta2+395*theta4)+temp3*(3-36*theta2+49*theta4);
-        xhdot1 = -temp1*cosio;
-        xnodot = xhdot1+(0.5*temp2*(4-19*theta2)+2*temp3*(3-7*theta2))*cosio;
-        omgcof = bstar*c3*cos(omegao);
-        xmcof = -tothrd*coef*bstar*xae/eeta;
-        xnodcf = 3.5*betao2*xhdot1*c1;
-        t2cof = 1.5*c1;
-        xlcof = 0.125*a3ovk2*sinio*(3+5*cosio)/(1+cosio);
-        aycof = 0.25*a3ovk2*sinio;
-        delmo = pow(1+eta*cos(xmo),3);
-        sinmo = sin(xmo);
-        x7thm1 = 7*theta2-1;
-        
-        if (arg->isimp == 0)
-        {
-            c1sq = c1*c1;
-            d2 = 4*aodp*tsi*c1sq;
-            temp = d2*tsi*c1/3;
-            d3 = (17*aodp+s4)*temp;
-            d4 = 0.5*temp*aodp*tsi*(221*aodp+31*s4)*c1;
-            t3cof = d2+2*c1sq;
-            t4cof = 0.25*(3*d3+c1*(12*d2+10*c1sq));
-            t5cof = 0.2*(3*d4+12*c1*d3+6*d2*d2+15*c1sq*(2*d2+c1sq));
-        }
+        if(perige <= 98)
+            s4 = 20;
         else
-        {
-            d2 = d3 = d4 = t3cof = t4cof = t5cof = 0.0;
-        }
+            s4 = perige-78;
+        qoms24 = pow((120-s4)*xae/xkmper,4);
+        s4 = s4/xkmper+xae;
+    }
 
-        // End of SGP4 initialization, save variables for further use
-        
-        arg->aodp = aodp;
-        arg->aycof = aycof;
-        arg->c1 = c1;
-        arg->c4 = c4;
-        arg->c5 = c5;
-        arg->cosio = cosio;
-        arg->d2 = d2;
-        arg->d3 = d3;
-        arg->d4 = d4;
-        arg->delmo = delmo;
-        arg->omgcof = omgcof;
-        arg->eta = eta;
-        arg->omgdot = omgdot;
-        arg->sinio = sinio;
-        arg->xnodp = xnodp;
-        arg->sinmo = sinmo;
-        arg->t2cof = t2cof;
-        arg->t3cof = t3cof;
-        arg->t4cof = t4cof;
-        arg->t5cof = t5cof;
-        arg->x1mth2 = x1mth2;
-        arg->x3thm1 = x3thm1;
-        arg->x7thm1 = x7thm1;
-        arg->xmcof = xmcof;
-        arg->xmdot = xmdot;
-        arg->xnodcf = xnodcf;
-        arg->xnodot = xnodot;
-        arg->xlcof = xlcof;
+    pinvsq = 1/(aodp*aodp*betao2*betao2);
+    tsi = 1/(aodp-s4);
+    eta = aodp*eo*tsi;
+    etasq = eta*eta;
+    eeta = eo*eta;
+    psisq = fabs(1-etasq);
+    coef = qoms24*pow(tsi,4);
+    coef1 = coef/pow(psisq,3.5);
+    c2 = coef1*xnodp*(aodp*(1+1.5*etasq+eeta*(4+etasq))+
+    0.75*ck2*tsi/psisq*x3thm1*(8+3*etasq*(8+etasq)));
+    c1 = bstar*c2;
+    sinio = sin(xincl);
+    a3ovk2 = -xj3/ck2*pow(xae,3);
+    c3 = coef*tsi*a3ovk2*xnodp*xae*sinio/eo;
+    x1mth2 = 1-theta2;
+    c4 = 2*xnodp*coef1*aodp*betao2*(eta*(2+0.5*etasq)+
+    eo*(0.5+2*etasq)-2*ck2*tsi/(aodp*psisq)*
+    (-3*x3thm1*(1-2*eeta+etasq*(1.5-0.5*eeta))+0.75*
+    x1mth2*(2*etasq-eeta*(1+etasq))*cos(2*omegao)));
+    c5 = 2*coef1*aodp*betao2*(1+2.75*(etasq+eeta)+eeta*etasq);
+    theta4 = theta2*theta2;
+    temp1 = 3*ck2*pinvsq*xnodp;
+    temp2 = temp1*ck2*pinvsq;
+    temp3 = 1.25*ck4*pinvsq*pinvsq*xnodp;
+    xmdot = xnodp+0.5*temp1*betao*x3thm1+0.0625*temp2*betao*(13-78*theta2+137*theta4);
+    x1m5th = 1-5*theta2;
+    omgdot = -0.5*temp1*x1m5th+0.0625*temp2*(7-114*theta2+395*theta4)+temp3*(3-36*theta2+49*theta4);
+    xhdot1 = -temp1*cosio;
+    xnodot = xhdot1+(0.5*temp2*(4-19*theta2)+2*temp3*(3-7*theta2))*cosio;
+    omgcof = bstar*c3*cos(omegao);
+    xmcof = -tothrd*coef*bstar*xae/eeta;
+    xnodcf = 3.5*betao2*xhdot1*c1;
+    t2cof = 1.5*c1;
+    xlcof = 0.125*a3ovk2*sinio*(3+5*cosio)/(1+cosio);
+    aycof = 0.25*a3ovk2*sinio;
+    delmo = pow(1+eta*cos(xmo),3);
+    sinmo = sin(xmo);
+    x7thm1 = 7*theta2-1;
+    
+    if (arg->isimp == 0)
+    {
+        c1sq = c1*c1;
+        d2 = 4*aodp*tsi*c1sq;
+        temp = d2*tsi*c1/3;
+        d3 = (17*aodp+s4)*temp;
+        d4 = 0.5*temp*aodp*tsi*(221*aodp+31*s4)*c1;
+        t3cof = d2+2*c1sq;
+        t4cof = 0.25*(3*d3+c1*(12*d2+10*c1sq));
+        t5cof = 0.2*(3*d4+12*c1*d3+6*d2*d2+15*c1sq*(2*d2+c1sq));
     }
     else
     {
-        // Recover saved variables
-        
-        arg = argp.sgp4;
-        
-        aodp = arg->aodp;
-        aycof = arg->aycof;
-        c1 = arg->c1;
-        c4 = arg->c4;
-        c5 = arg->c5;
-        cosio = arg->cosio;
-        d2 = arg->d2;
-        d3 = arg->d3;
-        d4 = arg->d4;
-        delmo = arg->delmo;
-        omgcof = arg->omgcof;
-        eta = arg->eta;
-        omgdot = arg->omgdot;
-        sinio = arg->sinio;
-        xnodp = arg->xnodp;
-        sinmo = arg->sinmo;
-        t2cof = arg->t2cof;
-        t3cof = arg->t3cof;
-        t4cof = arg->t4cof;
-        t5cof = arg->t5cof;
-        x1mth2 = arg->x1mth2;
-        x3thm1 = arg->x3thm1;
-        x7thm1 = arg->x7thm1;
-        xmcof = arg->xmcof;
-        xmdot = arg->xmdot;
-        xnodcf = arg->xnodcf;
-        xnodot = arg->xnodot;
-        xlcof = arg->xlcof;
+        d2 = d3 = d4 = t3cof = t4cof = t5cof = 0.0;
     }
+
+    // End of SGP4 initialization, save variables for further use
+    
+    arg->aodp = aodp;
+    arg->aycof = aycof;
+    arg->c1 = c1;
+    arg->c4 = c4;
+    arg->c5 = c5;
+    arg->cosio = cosio;
+    arg->d2 = d2;
+    arg->d3 = d3;
+    arg->d4 = d4;
+    arg->delmo = delmo;
+    arg->omgcof = omgcof;
+    arg->eta = eta;
+    arg->omgdot = omgdot;
+    arg->sinio = sinio;
+    arg->xnodp = xnodp;
+    arg->sinmo = sinmo;
+    arg->t2cof = t2cof;
+    arg->t3cof = t3cof;
+    arg->t4cof = t4cof;
+    arg->t5cof = t5cof;
+    arg->x1mth2 = x1mth2;
+    arg->x3thm1 = x3thm1;
+    arg->x7thm1 = x7thm1;
+    arg->xmcof = xmcof;
+    arg->xmdot = xmdot;
+    arg->xnodcf = xnodcf;
+    arg->xnodot = xnodot;
+    arg->xlcof = xlcof;
+}
+
+// SGP4 orbit model. Computes satellite position and velocity
+// in Earth-centered, inertial equatorial reference frame,
+// in units of Earth-radii and Earth-radii per minute.
+// Elapsed time since orbital element epoch (tsince) is in minutes.
+// Use this for near-Earth satellites with orbit periods < 225 minutes.
+
+void SSTLE::sgp4 ( double tsince, SSVector &pos, SSVector &vel )
+{
+    double aodp,aycof,c1,c4,c5,cosio,d2,d3,d4,delmo,omgcof,eta,omgdot,
+           sinio,xnodp,sinmo,t2cof,t3cof,t4cof,t5cof,x1mth2,x3thm1,
+           x7thm1,xmcof,xmdot,xnodcf,xnodot,xlcof;
+ 
+    double cosuk,sinuk,rfdotk,vx,vy,vz,ux,uy,uz,xmy,xmx,cosnok,sinnok,
+           cosik,sinik,rdotk,xinck,xnodek,uk,rk,cos2u,sin2u,u,sinu,cosu,
+           betal,rfdot,rdot,r,pl,elsq,esine,ecose,epw,cosepw,tfour,
+           sinepw,capu,ayn,xlt,aynl,xll,axn,xn,beta,xl,e,a,tcube,delm,
+           delomg,templ,tempe,tempa,xnode,tsq,xmp,omega,xnoddf,omgadf,
+           xmdf,temp,temp1,temp2,temp3,temp4,temp5,temp6;
+
+    int i;
+
+    if ( ! hasargs ( sgp4_model ) )
+        sgp4init();
+    
+    // Recover saved variables
+    
+    sgp4_args *arg = argp.sgp4;
+    
+    aodp = arg->aodp;
+    aycof = arg->aycof;
+    c1 = arg->c1;
+    c4 = arg->c4;
+    c5 = arg->c5;
+    cosio = arg->cosio;
+    d2 = arg->d2;
+    d3 = arg->d3;
+    d4 = arg->d4;
+    delmo = arg->delmo;
+    omgcof = arg->omgcof;
+    eta = arg->eta;
+    omgdot = arg->omgdot;
+    sinio = arg->sinio;
+    xnodp = arg->xnodp;
+    sinmo = arg->sinmo;
+    t2cof = arg->t2cof;
+    t3cof = arg->t3cof;
+    t4cof = arg->t4cof;
+    t5cof = arg->t5cof;
+    x1mth2 = arg->x1mth2;
+    x3thm1 = arg->x3thm1;
+    x7thm1 = arg->x7thm1;
+    xmcof = arg->xmcof;
+    xmdot = arg->xmdot;
+    xnodcf = arg->xnodcf;
+    xnodot = arg->xnodot;
+    xlcof = arg->xlcof;
     
     // Update for secular gravity and atmospheric drag.
     
@@ -1512,6 +1612,110 @@ void SSTLE::sgp4 ( double tsince, SSVector &pos, SSVector &vel )
     vel.z = rdotk*uz+rfdotk*vz;
 }
 
+// Initializes SDP4 orbit model arguments, including deep-space arguments, from this TLE's elements.
+
+void SSTLE::sdp4init ( void )
+{
+    double x3thm1 = 0,c1 = 0,x1mth2 = 0,c4 = 0,xnodcf = 0,t2cof = 0,xlcof = 0,aycof = 0,
+           x7thm1 = 0,theta4 = 0,a1 = 0,a3ovk2 = 0,ao = 0,c2 = 0,coef = 0,coef1 = 0,
+           x1m5th = 0,xhdot1 = 0,del1 = 0,delo = 0,eeta = 0,eta = 0,etasq = 0,perige = 0,
+           psisq = 0,tsi = 0,qoms24 = 0,s4 = 0,pinvsq = 0,temp1 = 0,temp2 = 0,temp3 = 0;
+
+    delargs();
+    sdp4_args *arg = argp.sdp4 = new sdp4_args;
+    setargs ( &arg->init, sdp4_model );
+
+    // Recover original mean motion (xnodp) and
+    // semimajor axis (aodp) from input elements.
+    
+    a1 = pow(xke/xno,tothrd);
+    arg->deep.cosio = cos(xincl);
+    arg->deep.theta2 = arg->deep.cosio*arg->deep.cosio;
+    x3thm1 = 3*arg->deep.theta2-1;
+    arg->deep.eosq = eo*eo;
+    arg->deep.betao2 = 1-arg->deep.eosq;
+    arg->deep.betao = sqrt(arg->deep.betao2);
+    del1 = 1.5*ck2*x3thm1/(a1*a1*arg->deep.betao*arg->deep.betao2);
+    ao = a1*(1-del1*(0.5*tothrd+del1*(1+134/81*del1)));
+    delo = 1.5*ck2*x3thm1/(ao*ao*arg->deep.betao*arg->deep.betao2);
+    arg->deep.xnodp = xno/(1+delo);
+    arg->deep.aodp = ao/(1-delo);
+
+    // For perigee below 156 km, the values
+    // of s and qoms2t are altered.
+    
+    s4 = s;
+    qoms24 = qoms2t;
+    perige = (arg->deep.aodp*(1-eo)-xae)*xkmper;
+    if(perige < 156)
+    {
+      if (perige <= 98 )
+          s4 = 20;
+      else
+          s4 = perige-78;
+      qoms24 = pow((120-s4)*xae/xkmper,4);
+      s4 = s4/xkmper+xae;
+    }
+    
+    pinvsq = 1/(arg->deep.aodp*arg->deep.aodp*arg->deep.betao2*arg->deep.betao2);
+    arg->deep.sing = sin(omegao);
+    arg->deep.cosg = cos(omegao);
+    tsi = 1/(arg->deep.aodp-s4);
+    eta = arg->deep.aodp*eo*tsi;
+    etasq = eta*eta;
+    eeta = eo*eta;
+    psisq = fabs(1-etasq);
+    coef = qoms24*pow(tsi,4);
+    coef1 = coef/pow(psisq,3.5);
+    c2 = coef1*arg->deep.xnodp*(arg->deep.aodp*(1+1.5*etasq+eeta*
+       (4+etasq))+0.75*ck2*tsi/psisq*x3thm1*(8+3*etasq*(8+etasq)));
+    c1 = bstar*c2;
+    arg->deep.sinio = sin(xincl);
+    a3ovk2 = -xj3/ck2*pow(xae,3);
+    x1mth2 = 1-arg->deep.theta2;
+    c4 = 2*arg->deep.xnodp*coef1*arg->deep.aodp*arg->deep.betao2*
+           (eta*(2+0.5*etasq)+eo*(0.5+2*etasq)-2*ck2*tsi/
+           (arg->deep.aodp*psisq)*(-3*x3thm1*(1-2*eeta+etasq*
+           (1.5-0.5*eeta))+0.75*x1mth2*(2*etasq-eeta*(1+etasq))*
+           cos(2*omegao)));
+    theta4 = arg->deep.theta2*arg->deep.theta2;
+    temp1 = 3*ck2*pinvsq*arg->deep.xnodp;
+    temp2 = temp1*ck2*pinvsq;
+    temp3 = 1.25*ck4*pinvsq*pinvsq*arg->deep.xnodp;
+    arg->deep.xmdot = arg->deep.xnodp+0.5*temp1*arg->deep.betao*
+                     x3thm1+0.0625*temp2*arg->deep.betao*
+                     (13-78*arg->deep.theta2+137*theta4);
+    x1m5th = 1-5*arg->deep.theta2;
+    arg->deep.omgdot = -0.5*temp1*x1m5th+0.0625*temp2*
+                      (7-114*arg->deep.theta2+395*theta4)+
+                      temp3*(3-36*arg->deep.theta2+49*theta4);
+    xhdot1 = -temp1*arg->deep.cosio;
+    arg->deep.xnodot = xhdot1+(0.5*temp2*(4-19*arg->deep.theta2)+
+                     2*temp3*(3-7*arg->deep.theta2))*arg->deep.cosio;
+    xnodcf = 3.5*arg->deep.betao2*xhdot1*c1;
+    t2cof = 1.5*c1;
+    xlcof = 0.125*a3ovk2*arg->deep.sinio*(3+5*arg->deep.cosio)/
+            (1+arg->deep.cosio);
+    aycof = 0.25*a3ovk2*arg->deep.sinio;
+    x7thm1 = 7*arg->deep.theta2-1;
+
+    // initialize deep space perturbations
+    
+    dodeep ( dpinit, &arg->deep );
+      
+    // End of SDP4 initialization, save variables for further use.
+      
+    arg->x3thm1 = x3thm1;
+    arg->c1 = c1;
+    arg->x1mth2 = x1mth2;
+    arg->c4 = c4;
+    arg->xnodcf = xnodcf;
+    arg->t2cof = t2cof;
+    arg->xlcof = xlcof;
+    arg->aycof = aycof;
+    arg->x7thm1 = x7thm1;
+}
+
 // SGP4 orbit model. Computes satellite position and velocity
 // in Earth-centered, inertial equatorial reference frame,
 // in units of Earth-radii and Earth-radii per minute.
@@ -1522,182 +1726,88 @@ void SSTLE::sdp4 ( double tsince, SSVector &pos, SSVector &vel )
 {
     int i = 0;
 
-    double x3thm1 = 0, c1 = 0, x1mth2 = 0, c4 = 0, xnodcf = 0, t2cof = 0, xlcof = 0, aycof = 0, x7thm1 = 0;
+    double x3thm1 = 0,c1 = 0,x1mth2 = 0,c4 = 0,xnodcf = 0,t2cof = 0,xlcof = 0,aycof = 0,
+           x7thm1 = 0;
 
-    double a = 0,axn = 0,ayn = 0,aynl = 0,beta = 0,betal = 0,capu = 0,cos2u = 0,cosepw = 0,cosik = 0,
-           cosnok = 0,cosu = 0,cosuk = 0,ecose = 0,elsq = 0,epw = 0,esine = 0,pl = 0,theta4 = 0,
-           rdot = 0,rdotk = 0,rfdot = 0,rfdotk = 0,rk = 0,sin2u = 0,sinepw = 0,sinik = 0,
-           sinnok = 0,sinu = 0,sinuk = 0,tempe = 0,templ = 0,tsq = 0,u = 0,uk = 0,ux = 0,uy = 0,uz = 0,
-           vx = 0,vy = 0,vz = 0,xinck = 0,xl = 0,xlt = 0,xmam = 0,xmdf = 0,xmx = 0,xmy = 0,xnoddf = 0,
-           xnodek = 0,xll = 0,a1 = 0,a3ovk2 = 0,ao = 0,c2 = 0,coef = 0,coef1 = 0,x1m5th = 0,
-           xhdot1 = 0,del1 = 0,r = 0,delo = 0,eeta = 0,eta = 0,etasq = 0,perige = 0,
-           psisq = 0,tsi = 0,qoms24 = 0,s4 = 0,pinvsq = 0,temp = 0,tempa = 0,temp1 = 0,
-           temp2 = 0,temp3 = 0,temp4 = 0,temp5 = 0,temp6 = 0;
+    double a = 0,axn = 0,ayn = 0,aynl = 0,beta = 0,betal = 0,capu = 0,cos2u = 0,
+           cosepw = 0,cosik = 0,cosnok = 0,cosu = 0,cosuk = 0,ecose = 0,elsq = 0,epw = 0,
+           esine = 0,pl = 0,rdot = 0,rdotk = 0,rfdot = 0,rfdotk = 0,rk = 0,sin2u = 0,
+           sinepw = 0,sinik = 0,sinnok = 0,sinu = 0,sinuk = 0,tempe = 0,templ = 0,tsq = 0,
+           u = 0,uk = 0,ux = 0,uy = 0,uz = 0,vx = 0,vy = 0,vz = 0,xinck = 0,xl = 0,
+           xlt = 0,xmam = 0,xmdf = 0,xmx = 0,xmy = 0,xnoddf = 0,xnodek = 0,xll = 0,r = 0,
+           temp = 0,tempa = 0,temp1 = 0,temp2 = 0,temp3 = 0,temp4 = 0,temp5 = 0,temp6 = 0;
 
-//    deep_args deep_arg = { 0 };
-
-    sdp4_args *arg;
+    if ( ! hasargs ( sdp4_model ) )
+        sdp4init();
     
-    if ( argp.sdp4 == nullptr )
-    {
-        // Initialization
-        
-        arg = argp.sdp4 = new sdp4_args;
-
-        // Recover original mean motion (xnodp) and
-        // semimajor axis (aodp) from input elements.
-        
-        a1 = pow(xke/xno,tothrd);
-        arg->deep.cosio = cos(xincl);
-        arg->deep.theta2 = arg->deep.cosio*arg->deep.cosio;
-        x3thm1 = 3*arg->deep.theta2-1;
-        arg->deep.eosq = eo*eo;
-        arg->deep.betao2 = 1-arg->deep.eosq;
-        arg->deep.betao = sqrt(arg->deep.betao2);
-        del1 = 1.5*ck2*x3thm1/(a1*a1*arg->deep.betao*arg->deep.betao2);
-        ao = a1*(1-del1*(0.5*tothrd+del1*(1+134/81*del1)));
-        delo = 1.5*ck2*x3thm1/(ao*ao*arg->deep.betao*arg->deep.betao2);
-        arg->deep.xnodp = xno/(1+delo);
-        arg->deep.aodp = ao/(1-delo);
-
-        // For perigee below 156 km, the values
-        // of s and qoms2t are altered.
-        
-        s4 = s;
-        qoms24 = qoms2t;
-        perige = (arg->deep.aodp*(1-eo)-xae)*xkmper;
-        if(perige < 156)
-        {
-          if (perige <= 98 )
-              s4 = 20;
-          else
-              s4 = perige-78;
-          qoms24 = pow((120-s4)*xae/xkmper,4);
-          s4 = s4/xkmper+xae;
-        }
-        
-        pinvsq = 1/(arg->deep.aodp*arg->deep.aodp*arg->deep.betao2*arg->deep.betao2);
-        arg->deep.sing = sin(omegao);
-        arg->deep.cosg = cos(omegao);
-        tsi = 1/(arg->deep.aodp-s4);
-        eta = arg->deep.aodp*eo*tsi;
-        etasq = eta*eta;
-        eeta = eo*eta;
-        psisq = fabs(1-etasq);
-        coef = qoms24*pow(tsi,4);
-        coef1 = coef/pow(psisq,3.5);
-        c2 = coef1*arg->deep.xnodp*(arg->deep.aodp*(1+1.5*etasq+eeta*
-           (4+etasq))+0.75*ck2*tsi/psisq*x3thm1*(8+3*etasq*(8+etasq)));
-        c1 = bstar*c2;
-        arg->deep.sinio = sin(xincl);
-        a3ovk2 = -xj3/ck2*pow(xae,3);
-        x1mth2 = 1-arg->deep.theta2;
-        c4 = 2*arg->deep.xnodp*coef1*arg->deep.aodp*arg->deep.betao2*
-               (eta*(2+0.5*etasq)+eo*(0.5+2*etasq)-2*ck2*tsi/
-               (arg->deep.aodp*psisq)*(-3*x3thm1*(1-2*eeta+etasq*
-               (1.5-0.5*eeta))+0.75*x1mth2*(2*etasq-eeta*(1+etasq))*
-               cos(2*omegao)));
-        theta4 = arg->deep.theta2*arg->deep.theta2;
-        temp1 = 3*ck2*pinvsq*arg->deep.xnodp;
-        temp2 = temp1*ck2*pinvsq;
-        temp3 = 1.25*ck4*pinvsq*pinvsq*arg->deep.xnodp;
-        arg->deep.xmdot = arg->deep.xnodp+0.5*temp1*arg->deep.betao*
-                         x3thm1+0.0625*temp2*arg->deep.betao*
-                         (13-78*arg->deep.theta2+137*theta4);
-        x1m5th = 1-5*arg->deep.theta2;
-        arg->deep.omgdot = -0.5*temp1*x1m5th+0.0625*temp2*
-                          (7-114*arg->deep.theta2+395*theta4)+
-                          temp3*(3-36*arg->deep.theta2+49*theta4);
-        xhdot1 = -temp1*arg->deep.cosio;
-        arg->deep.xnodot = xhdot1+(0.5*temp2*(4-19*arg->deep.theta2)+
-                         2*temp3*(3-7*arg->deep.theta2))*arg->deep.cosio;
-        xnodcf = 3.5*arg->deep.betao2*xhdot1*c1;
-        t2cof = 1.5*c1;
-        xlcof = 0.125*a3ovk2*arg->deep.sinio*(3+5*arg->deep.cosio)/
-                (1+arg->deep.cosio);
-        aycof = 0.25*a3ovk2*arg->deep.sinio;
-        x7thm1 = 7*arg->deep.theta2-1;
-
-        // initialize deep space perturbations
-        
-        dodeep ( dpinit, &arg->deep );
-          
-        // End of SDP4 initialization, save variables for further use.
-          
-        arg->x3thm1 = x3thm1;
-        arg->c1 = c1;
-        arg->x1mth2 = x1mth2;
-        arg->c4 = c4;
-        arg->xnodcf = xnodcf;
-        arg->t2cof = t2cof;
-        arg->xlcof = xlcof;
-        arg->aycof = aycof;
-        arg->x7thm1 = x7thm1;
-    }
-    else
-    {
-        // Recover saved variables
-        
-        arg = argp.sdp4;
-        
-        x3thm1 = arg->x3thm1;
-        c1 = arg->c1;
-        x1mth2 = arg->x1mth2;
-        c4 = arg->c4;
-        xnodcf = arg->xnodcf;
-        t2cof = arg->t2cof;
-        xlcof = arg->xlcof;
-        aycof = arg->aycof;
-        x7thm1 = arg->x7thm1;
-    }
+    // Recover saved variables
+    
+    sdp4_args *arg = argp.sdp4;
+    
+    x3thm1 = arg->x3thm1;
+    c1 = arg->c1;
+    x1mth2 = arg->x1mth2;
+    c4 = arg->c4;
+    xnodcf = arg->xnodcf;
+    t2cof = arg->t2cof;
+    xlcof = arg->xlcof;
+    aycof = arg->aycof;
+    x7thm1 = arg->x7thm1;
 
+    // Propagate with a copy of the deep-space arguments, so this TLE's arguments are only written during
+    // initialization. Then the result depends only on (tsince), not on previous calls: the resonance integrator
+    // always starts at the epoch, and lunar-solar periodics are always recomputed. Once initialized, different
+    // threads can propagate the same TLE at the same time.
+    
+    deep_args deep = arg->deep;
+    
     // Update for secular gravity and atmospheric drag
     
-    xmdf = xmo+arg->deep.xmdot*tsince;
-    arg->deep.omgadf = omegao+arg->deep.omgdot*tsince;
-    xnoddf = xnodeo+arg->deep.xnodot*tsince;
+    xmdf = xmo+deep.xmdot*tsince;
+    deep.omgadf = omegao+deep.omgdot*tsince;
+    xnoddf = xnodeo+deep.xnodot*tsince;
     tsq = tsince*tsince;
-    arg->deep.xnode = xnoddf+xnodcf*tsq;
+    deep.xnode = xnoddf+xnodcf*tsq;
     tempa = 1-c1*tsince;
     tempe = bstar*c4*tsince;
     templ = t2cof*tsq;
-    arg->deep.xn = arg->deep.xnodp;
+    deep.xn = deep.xnodp;
 
     // Update for deep-space secular effects
     
-    arg->deep.xll = xmdf;
-    arg->deep.t = tsince;
+    deep.xll = xmdf;
+    deep.t = tsince;
 
-    dodeep ( dpsec, &arg->deep );
+    dodeep ( dpsec, &deep );
 
-    xmdf = arg->deep.xll;
-    a = pow(xke/arg->deep.xn,tothrd)*tempa*tempa;
-    arg->deep.em = arg->deep.em-tempe;
-    xmam = xmdf+arg->deep.xnodp*templ;
+    xmdf = deep.xll;
+    a = pow(xke/deep.xn,tothrd)*tempa*tempa;
+    deep.em = deep.em-tempe;
+    xmam = xmdf+deep.xnodp*templ;
 
     // Update for deep-space periodic effects
     
-    arg->deep.xll = xmam;
+    deep.xll = xmam;
 
-    dodeep ( dpper, &arg->deep );
+    dodeep ( dpper, &deep );
 
-    xmam = arg->deep.xll;
-    xl = xmam+arg->deep.omgadf+arg->deep.xnode;
-    beta = sqrt(1-arg->deep.em*arg->deep.em);
-    arg->deep.xn = xke/pow(a,1.5);
+    xmam = deep.xll;
+    xl = xmam+deep.omgadf+deep.xnode;
+    beta = sqrt(1-deep.em*deep.em);
+    deep.xn = xke/pow(a,1.5);
 
     // Long period periodics
     
-    axn = arg->deep.em*cos(arg->deep.omgadf);
+    axn = deep.em*cos(deep.omgadf);
     temp = 1/(a*beta*beta);
     xll = temp*xlcof*axn;
     aynl = temp*aycof;
     xlt = xl+xll;
-    ayn = arg->deep.em*sin(arg->deep.omgadf)+aynl;
+    ayn = deep.em*sin(deep.omgadf)+aynl;
 
     // Solve Kepler's Equation
     
-    capu = fmod2p(xlt-arg->deep.xnode);
+    capu = fmod2p(xlt-deep.xnode);
     temp2 = capu;
 
     i = 0;
@@ -1742,10 +1852,10 @@ void SSTLE::sdp4 ( double tsince, SSVector &pos, SSVector &vel )
     
     rk = r*(1-1.5*temp2*betal*x3thm1)+0.5*temp1*x1mth2*cos2u;
     uk = u-0.25*temp2*x7thm1*sin2u;
-    xnodek = arg->deep.xnode+1.5*temp2*arg->deep.cosio*sin2u;
-    xinck = arg->deep.xinc+1.5*temp2*arg->deep.cosio*arg->deep.sinio*cos2u;
-    rdotk = rdot-arg->deep.xn*temp1*x1mth2*sin2u;
-    rfdotk = rfdot+arg->deep.xn*temp1*(x1mth2*cos2u+1.5*x3thm1);
+    xnodek = deep.xnode+1.5*temp2*deep.cosio*sin2u;
+    xinck = deep.xinc+1.5*temp2*deep.cosio*deep.sinio*cos2u;
+    rdotk = rdot-deep.xn*temp1*x1mth2*sin2u;
+    rfdotk = rfdot+deep.xn*temp1*(x1mth2*cos2u+1.5*x3thm1);
 
     // Orientation vectors
     
@@ -2084,36 +2194,96 @@ void SSTLE::fromPositionVelocity ( double jd, SSVector &pos, SSVector &vel )
 
 int SSTLE::read ( FILE *file )
 {
-    string buf = "";
+    string line0, line1, line2;
+
+    // Read first line (satellite name), then second line; second line must start with a '1'
+    
+    if ( ! fgetline ( file, line0 ) )
+        return ( -1 );
+
+    if ( ! fgetline ( file, line1 ) )
+        return ( -2 );
+    
+    if ( line1[0] != '1' )
+        return ( -2 );
+    
+    // Read third line, then parse all three.
+    
+    if ( ! fgetline ( file, line2 ) )
+        return ( -3 );
+
+    return parse ( line0.c_str(), line1.c_str(), line2.c_str() );
+}
+
+// Copies a fixed-width field (len characters starting at column pos) of a TLE line (line, with length n)
+// into a null-terminated buffer (buf, at least len + 1 bytes) without allocating memory, and returns the buffer.
+// Any part of the field past the end of the line is empty.
+
+static const char *tle_field ( const char *line, size_t n, size_t pos, size_t len, char *buf )
+{
+    size_t k = 0;
+    
+    for ( ; k < len && pos + k < n; k++ )
+        buf[k] = line[pos + k];
+    
+    buf[k] = 0;
+    return buf;
+}
+
+// Returns string containing a TLE field (as above) or whole line (len = n) with leading and trailing whitespace trimmed.
+
+static string tle_trim ( const char *line, size_t n, size_t pos, size_t len )
+{
+    size_t end = min ( n, pos + len );
+    
+    while ( pos < end && isspace ( (unsigned char) line[pos] ) )
+        pos++;
+    
+    while ( end > pos && isspace ( (unsigned char) line[end - 1] ) )
+        end--;
+    
+    return string ( line + pos, end - pos );
+}
+
+// Parses a TLE record from three null-terminated lines of text: satellite name (line0), and TLE lines
+// 1 and 2 (line1, line2), by fixed columns. Returns 0 if successful or a negative number of failure,
+// the same as read(). Lines may end with trailing whitespace, but must not contain line breaks.
+
+int SSTLE::parse ( const char *line0, const char *line1, const char *line2 )
+{
+    return parse ( SSSpan<char> ( line0, strlen ( line0 ) ), SSSpan<char> ( line1, strlen ( line1 ) ), SSSpan<char> ( line2, strlen ( line2 ) ) );
+}
+
+// As above, but parses lines which are views of text (text0, text1, text2), not necessarily null-terminated.
+
+int SSTLE::parse ( SSSpan<char> text0, SSSpan<char> text1, SSSpan<char> text2 )
+{
+    const char *line0 = text0.data(), *line1 = text1.data(), *line2 = text2.data();
     int    year = 0, number = 0, iexp = 0, ibexp = 0;
     double xm0 = 0.0, xnode0 = 0.0, omega0 = 0.0;
     double e0 = 0.0, xn0 = 1.0, xndt20 = 0.0, xndd60 = 0.0;
     double day = 0.0, epoch = 0.0;
     double temp = M_2PI / xmnpda / xmnpda;
+    char   buf[16] = { 0 };
 
-    // Read first line; trim trailing whitespace; copy satellite name
+    // Trim trailing whitespace from first line; copy satellite name
     
-    if ( ! fgetline ( file, buf ) )
-        return ( -1 );
+    name = tle_trim ( line0, text0.size(), 0, string::npos );
 
-    name = trim ( buf );
-
-    // Read second line; must start with a '1'
-    
-    if ( ! fgetline ( file, buf ) )
-        return ( -2 );
+    // Second line must start with a '1'
     
-    if ( buf[0] != '1' )
+    size_t n = text1.size();
+    if ( n < 1 || line1[0] != '1' )
         return ( -2 );
     
-    number = strtoint ( buf.substr ( 2, 5 ) );
-    desig = trim ( buf.substr ( 9, 6 ) );
-    epoch = strtofloat64 ( buf.substr ( 18, 14 ) );
-    xndt20 = strtofloat64 ( buf.substr ( 33, 10 ) );
-    xndd60 = strtofloat64 ( buf.substr ( 44, 6 ) );
-    iexp = strtoint ( buf.substr ( 50, 2 ) );
-    bstar = strtofloat64 ( buf.substr ( 53, 6 ) );
-    ibexp = strtoint ( buf.substr ( 59, 2 ) );
+    number = atoi ( tle_field ( line1, n, 2, 5, buf ) );
+    desig = tle_trim ( line1, n, 9, 6 );
+    epoch = strtod ( tle_field ( line1, n, 18, 14, buf ), nullptr );
+    xndt20 = strtod ( tle_field ( line1, n, 33, 10, buf ), nullptr );
+    xndd60 = strtod ( tle_field ( line1, n, 44, 6, buf ), nullptr );
+    iexp = atoi ( tle_field ( line1, n, 50, 2, buf ) );
+    bstar = strtod ( tle_field ( line1, n, 53, 6, buf ), nullptr );
+    ibexp = atoi ( tle_field ( line1, n, 59, 2, buf ) );
     
     // Convert epoch to year and day of year
 
@@ -2134,19 +2304,17 @@ int SSTLE::read ( FILE *file )
              
     // Third line must start with a '2'
     
-    if ( ! fgetline ( file, buf ) )
-        return ( -3 );
-
-    if ( buf[0] != '2' )
+    n = text2.size();
+    if ( n < 1 || line2[0] != '2' )
         return ( -3 );
     
-    number = strtoint ( buf.substr ( 2, 5 ) );
-    xincl = strtofloat64 ( buf.substr ( 8, 8 ) );
-    xnode0 = strtofloat64 ( buf.substr ( 17, 8 ) );
-    e0 = strtofloat64 ( buf.substr ( 26, 7 ) );
-    omega0 = strtofloat64 ( buf.substr ( 34, 8 ) );
-    xm0 = strtofloat64 ( buf.substr ( 43, 8 ) );
-    xn0 = strtofloat64 ( buf.substr ( 52, 11 ) );
+    number = atoi ( tle_field ( line2, n, 2, 5, buf ) );
+    xincl = strtod ( tle_field ( line2, n, 8, 8, buf ), nullptr );
+    xnode0 = strtod ( tle_field ( line2, n, 17, 8, buf ), nullptr );
+    e0 = strtod ( tle_field ( line2, n, 26, 7, buf ), nullptr );
+    omega0 = strtod ( tle_field ( line2, n, 34, 8, buf ), nullptr );
+    xm0 = strtod ( tle_field ( line2, n, 43, 8, buf ), nullptr );
+    xn0 = strtod ( tle_field ( line2, n, 52, 11, buf ), nullptr );
     
     // Convert other parameters
     
@@ -2248,15 +2416,16 @@ char SSTLE::checksum ( string &line )
 
 void SSTLE::delargs ( void )
 {
-    if ( argp.sdp4 || argp.sgp4 )
+    if ( argp.init )
     {
-        if ( deep )
+        if ( argp.init->model == sdp4_model )
             delete argp.sdp4;
-        else
+        else if ( argp.init->model == sgp4_model )
             delete argp.sgp4;
+        else
+            delete argp.sgp;
         
-        argp.sdp4 = nullptr;
-        argp.sgp4 = nullptr;
+        argp.sgp = nullptr;
     }
 }
 
@@ -2292,3 +2461,298 @@ SSOrbit SSTLE::toOrbit ( double tsince )
     
     return SSOrbit ( jdepoch + tsince / xmnpda, aodp * ( 1.0 - eo ), eo, xincl, omegat, xnodet, xmt, xnodp );
 }
+
+SSTLEArray::SSTLEArray ( void )
+{
+    _prepared = false;
+}
+
+void SSTLEArray::clear ( void )
+{
+    _tles.clear();
+    _near.clear();
+    _deep.clear();
+    _prepared = false;
+}
+
+void SSTLEArray::reserve ( size_t size )
+{
+    _tles.reserve ( size );
+}
+
+// Copies a TLE into the array. Its SGP4/SDP4 arguments are not copied, and are re-created when propagated.
+
+void SSTLEArray::push_back ( const SSTLE &tle )
+{
+    ( tle.deep ? _deep : _near ).push_back ( _tles.size() );
+    _tles.push_back ( tle );
+    _prepared = false;
+}
+
+// Computes SGP4 constants of all near-Earth TLEs by initializing a temporary copy of each,
+// so the constants are identical to those sgp4() uses.
+
+void SSTLEArray::prepare ( void )
+{
+    vector<double> *cols[] = { &_epoch, &_xmo, &_omegao, &_xnodeo, &_eo, &_xincl, &_bstar,
+        &_aodp, &_aycof, &_c1, &_c4, &_c5, &_cosio, &_d2, &_d3, &_d4, &_delmo, &_omgcof,
+        &_eta, &_omgdot, &_sinio, &_xnodp, &_sinmo, &_t2cof, &_t3cof, &_t4cof, &_t5cof,
+        &_x1mth2, &_x3thm1, &_x7thm1, &_xmcof, &_xmdot, &_xnodcf, &_xnodot, &_xlcof };
+    
+    for ( vector<double> *col : cols )
+        col->resize ( _near.size() );
+    
+    for ( size_t j = 0; j < _near.size(); j++ )
+    {
+        SSTLE tle ( _tles[ _near[j] ] );
+        tle.init();
+        sgp4_args *arg = tle.argp.sgp4;
+        
+        _epoch[j] = tle.jdepoch;
+        _xmo[j] = tle.xmo;
+        _omegao[j] = tle.omegao;
+        _xnodeo[j] = tle.xnodeo;
+        _eo[j] = tle.eo;
+        _xincl[j] = tle.xincl;
+        _bstar[j] = tle.bstar;
+        
+        _aodp[j] = arg->aodp;
+        _aycof[j] = arg->aycof;
+        _c1[j] = arg->c1;
+        _c4[j] = arg->c4;
+        _c5[j] = arg->isimp ? 0.0 : arg->c5;
+        _cosio[j] = arg->cosio;
+        _d2[j] = arg->d2;
+        _d3[j] = arg->d3;
+        _d4[j] = arg->d4;
+        _delmo[j] = arg->delmo;
+        _omgcof[j] = arg->isimp ? 0.0 : arg->omgcof;
+        _eta[j] = arg->eta;
+        _omgdot[j] = arg->omgdot;
+        _sinio[j] = arg->sinio;
+        _xnodp[j] = arg->xnodp;
+        _sinmo[j] = arg->sinmo;
+        _t2cof[j] = arg->t2cof;
+        _t3cof[j] = arg->t3cof;
+        _t4cof[j] = arg->t4cof;
+        _t5cof[j] = arg->t5cof;
+        _x1mth2[j] = arg->x1mth2;
+        _x3thm1[j] = arg->x3thm1;
+        _x7thm1[j] = arg->x7thm1;
+        _xmcof[j] = arg->isimp ? 0.0 : arg->xmcof;
+        _xmdot[j] = arg->xmdot;
+        _xnodcf[j] = arg->xnodcf;
+        _xnodot[j] = arg->xnodot;
+        _xlcof[j] = arg->xlcof;
+    }
+    
+    // Initialize deep-space TLEs' SDP4 arguments now, so propagation only reads them.
+    
+    for ( size_t k : _deep )
+        _tles[k].init();
+    
+    _prepared = true;
+}
+
+// Propagates near-Earth TLEs from _near[n0] up to (but not including) _near[n1] with the SGP4 model,
+// in blocks, one stage at a time. Each stage repeats SSTLE::sgp4()'s arithmetic in the same order, but with
+// SSTrig's sincos(), so results can differ from sgp4()'s in the last few bits; with the "simple" orbit
+// terms zeroed in prepare(), the drag terms need no branch. Results are in km and km/sec.
+
+void SSTLEArray::propagateNear ( double jd, size_t n0, size_t n1, vector<SSVector> &pos, vector<SSVector> &vel )
+{
+    static constexpr size_t kBlock = 64;
+    double xnode[kBlock], omega[kBlock], a[kBlock], e[kBlock], xn[kBlock], axn[kBlock], ayn[kBlock], capu[kBlock];
+    double sinepw[kBlock], cosepw[kBlock], temp3[kBlock], temp4[kBlock], temp5[kBlock], temp6[kBlock], epw[kBlock];
+    bool done[kBlock];
+    
+    for ( size_t b = n0; b < n1; b += kBlock )
+    {
+        size_t nb = min ( kBlock, n1 - b );
+        
+        // Update for secular gravity and atmospheric drag, and long period periodics.
+        
+        for ( size_t j = 0; j < nb; j++ )
+        {
+            size_t k = b + j;
+            double tsince = ( jd - _epoch[k] ) * xmnpda;
+            double xmdf = _xmo[k] + _xmdot[k] * tsince;
+            double omgadf = _omegao[k] + _omgdot[k] * tsince;
+            double xnoddf = _xnodeo[k] + _xnodot[k] * tsince;
+            double tsq = tsince * tsince;
+            double tcube = tsq * tsince;
+            double tfour = tsince * tcube;
+            double delomg = _omgcof[k] * tsince;
+            double delm = _xmcof[k] * ( pow ( 1 + _eta[k] * cos ( xmdf ), 3 ) - _delmo[k] );
+            double temp = delomg + delm;
+            double xmp = xmdf + temp;
+            
+            xnode[j] = xnoddf + _xnodcf[k] * tsq;
+            omega[j] = omgadf - temp;
+            
+            double tempa = 1 - _c1[k] * tsince;
+            double tempe = _bstar[k] * _c4[k] * tsince;
+            double templ = _t2cof[k] * tsq;
+            
+            tempa = tempa - _d2[k] * tsq - _d3[k] * tcube - _d4[k] * tfour;
+            tempe = tempe + _bstar[k] * _c5[k] * ( sin ( xmp ) - _sinmo[k] );
+            templ = templ + _t3cof[k] * tcube + tfour * ( _t4cof[k] + tsince * _t5cof[k] );
+            
+            a[j] = _aodp[k] * pow ( tempa, 2 );
+            e[j] = _eo[k] - tempe;
+            xn[j] = xke / pow ( a[j], 1.5 );
+            
+            double xl = xmp + omega[j] + xnode[j] + _xnodp[k] * templ;
+            double beta = sqrt ( 1 - e[j] * e[j] );
+            
+            axn[j] = e[j] * cos ( omega[j] );
+            temp = 1 / ( a[j] * beta * beta );
+            ayn[j] = e[j] * sin ( omega[j] ) + temp * _aycof[k];
+            capu[j] = fmod2p ( xl + temp * _xlcof[k] * axn[j] - xnode[j] );
+            epw[j] = capu[j];
+            done[j] = false;
+        }
+        
+        // Solve Kepler's equation for all satellites in the block at once, with the same
+        // iteration limit and tolerance as sgp4(); converged satellites drop out of later passes.
+        
+        size_t left = nb;
+        for ( int i = 0; i <= 10 && left > 0; i++ )
+        {
+            for ( size_t j = 0; j < nb; j++ )
+            {
+                if ( done[j] )
+                    continue;
+                
+                double temp2 = epw[j];
+                sincos ( temp2, sinepw[j], cosepw[j] );
+                temp3[j] = axn[j] * sinepw[j];
+                temp4[j] = ayn[j] * cosepw[j];
+                temp5[j] = axn[j] * cosepw[j];
+                temp6[j] = ayn[j] * sinepw[j];
+                epw[j] = ( capu[j] - temp4[j] + temp3[j] - temp2 ) / ( 1 - temp5[j] - temp6[j] ) + temp2;
+                if ( fabs ( epw[j] - temp2 ) <= e6a )
+                {
+                    done[j] = true;
+                    left--;
+                }
+            }
+        }
+        
+        // Short period periodics, and orientation vectors.
+        
+        for ( size_t j = 0; j < nb; j++ )
+        {
+            size_t k = b + j;
+            double ecose = temp5[j] + temp6[j];
+            double esine = temp3[j] - temp4[j];
+            double elsq = axn[j] * axn[j] + ayn[j] * ayn[j];
+            double temp = 1 - elsq;
+            double pl = a[j] * temp;
+            double r = a[j] * ( 1 - ecose );
+            double temp1 = 1 / r;
+            double rdot = xke * sqrt ( a[j] ) * esine * temp1;
+            double rfdot = xke * sqrt ( pl ) * temp1;
+            double temp2 = a[j] * temp1;
+            double betal = sqrt ( temp );
+            double tmp3 = 1 / ( 1 + betal );
+            double cosu = temp2 * ( cosepw[j] - axn[j] + ayn[j] * esine * tmp3 );
+            double sinu = temp2 * ( sinepw[j] - ayn[j] - axn[j] * esine * tmp3 );
+            double u = actan ( sinu, cosu );
+            double sin2u = 2 * sinu * cosu;
+            double cos2u = 2 * cosu * cosu - 1;
+            
+            temp = 1 / pl;
+            temp1 = ck2 * temp;
+            temp2 = temp1 * temp;
+            
+            double rk = r * ( 1 - 1.5 * temp2 * betal * _x3thm1[k] ) + 0.5 * temp1 * _x1mth2[k] * cos2u;
+            double uk = u - 0.25 * temp2 * _x7thm1[k] * sin2u;
+            double xnodek = xnode[j] + 1.5 * temp2 * _cosio[k] * sin2u;
+            double xinck = _xincl[k] + 1.5 * temp2 * _cosio[k] * _sinio[k] * cos2u;
+            double rdotk = rdot - xn[j] * temp1 * _x1mth2[k] * sin2u;
+            double rfdotk = rfdot + xn[j] * temp1 * ( _x1mth2[k] * cos2u + 1.5 * _x3thm1[k] );
+            
+            double sinuk, cosuk, sinik, cosik, sinnok, cosnok;
+            sincos ( uk, sinuk, cosuk );
+            sincos ( xinck, sinik, cosik );
+            sincos ( xnodek, sinnok, cosnok );
+            double xmx = -sinnok * cosik, xmy = cosnok * cosik;
+            SSVector uv ( xmx * sinuk + cosnok * cosuk, xmy * sinuk + sinnok * cosuk, sinik * sinuk );
+            SSVector vv ( xmx * cosuk - cosnok * sinuk, xmy * cosuk - sinnok * sinuk, sinik * cosuk );
+            
+            size_t n = _near[k];
+            pos[n] = uv * rk;
+            vel[n] = uv * rdotk + vv * rfdotk;
+            pos[n] *= xkmper;
+            vel[n] *= xkmper / 60.0;
+        }
+    }
+}
+
+// Propagates deep-space TLEs from _deep[d0] up to (but not including) _deep[d1] with SSTLE::sdp4().
+// Their SDP4 arguments were initialized in prepare(), and sdp4() does not modify them afterwards.
+
+void SSTLEArray::propagateDeep ( double jd, size_t d0, size_t d1, vector<SSVector> &pos, vector<SSVector> &vel )
+{
+    for ( size_t j = d0; j < d1; j++ )
+    {
+        size_t k = _deep[j];
+        _tles[k].toPositionVelocity ( jd, pos[k], vel[k] );
+    }
+}
+
+void SSTLEArray::toPositionVelocity ( double jd, vector<SSVector> &pos, vector<SSVector> &vel, int threads )
+{
+    if ( ! _prepared )
+        prepare();
+    
+    pos.resize ( _tles.size() );
+    vel.resize ( _tles.size() );
+    
+#if USE_THREADS
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+    
+    // Each thread gets an equal share of near-Earth and of deep-space TLEs; with few TLEs, use fewer threads.
+    
+    static constexpr size_t kMinChunkSize = 64;
+    size_t chunks = max ( (size_t) 1, min ( (size_t) threads, _tles.size() / kMinChunkSize ) );
+    if ( chunks > 1 )
+    {
+        vector<thread> workers;
+        for ( size_t c = 0; c < chunks; c++ )
+        {
+            size_t n0 = _near.size() * c / chunks, n1 = _near.size() * ( c + 1 ) / chunks;
+            size_t d0 = _deep.size() * c / chunks, d1 = _deep.size() * ( c + 1 ) / chunks;
+            workers.push_back ( thread ( [=,&pos,&vel]()
+            {
+                propagateNear ( jd, n0, n1, pos, vel );
+                propagateDeep ( jd, d0, d1, pos, vel );
+            } ) );
+        }
+        
+        for ( thread &worker : workers )
+            worker.join();
+        
+        return;
+    }
+#endif
+    
+    propagateNear ( jd, 0, _near.size(), pos, vel );
+    propagateDeep ( jd, 0, _deep.size(), pos, vel );
+}
+
+void SSTLEArray::toFundamentalPositionVelocity ( double jd, vector<SSVector> &pos, vector<SSVector> &vel, int threads )
+{
+    toPositionVelocity ( jd, pos, vel, threads );
+    
+    double jed = jd + SSTime ( jd ).getDeltaT() / SSTime::kSecondsPerDay;
+    SSMatrix earthMat = SSCoordinates::getPrecessionMatrix ( jed ).transpose();
+    
+    for ( size_t k = 0; k < pos.size(); k++ )
+    {
+        pos[k] = earthMat * ( pos[k] / SSCoordinates::kKmPerAU );
+        vel[k] = earthMat * ( vel[k] / ( SSCoordinates::kKmPerAU / SSTime::kSecondsPerDay ) );
+    }
+}
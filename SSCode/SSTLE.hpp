@@ -14,6 +14,7 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 #include "SSVector.hpp"
 #include "SSOrbit.hpp"
@@ -41,6 +42,7 @@ struct SSTLE
     
     union
     {
+        struct init_args *init;
         struct sgp_args *sgp;
         struct sgp4_args *sgp4;
         struct sdp4_args *sdp4;
@@ -49,10 +51,14 @@ struct SSTLE
 
     SSTLE ( void );
     SSTLE ( const SSTLE &other );
+    SSTLE &operator = ( const SSTLE &other );
+    ~SSTLE ( void );
     
     // Read from/write to input/output stream.
     
     int read ( FILE *file );
+    int parse ( const char *line0, const char *line1, const char *line2 );
+    int parse ( SSSpan<char> text0, SSSpan<char> text1, SSSpan<char> text2 );
     int write ( ostream &file );
     void delargs ( void );
     
@@ -62,7 +68,18 @@ struct SSTLE
     
     void sgp ( double tsince, SSVector &pos, SSVector &vel );
     void sgp4 ( double tsince, SSVector &pos, SSVector &vel );
-    void sdp4 ( double tsince, SSVector &pos, SSVector &vel );
+    void sdp4 ( double tsince, SSVector &pos, SSVector &vel );     // reentrant after first call initializes argp
+    
+    // SGP4/SDP4 initialization depends only on the elements; it normally runs on first use, and again
+    // whenever read(), rv2el(), or direct changes to the elements make it stale. init() runs it in advance;
+    // initialized() returns true if it is current. Initialized TLEs can then be propagated on several threads.
+    
+    void init ( void );
+    bool initialized ( void );
+    void sgp4init ( void );
+    void sdp4init ( void );
+    bool hasargs ( int model );
+    void setargs ( struct init_args *init, int model );
 
     bool isdeep ( void );
     void dodeep ( int ientry, struct deep_args *args );
@@ -78,4 +95,58 @@ struct SSTLE
     SSOrbit toOrbit ( double tsince );
 };
 
+// This class propagates an entire catalog of TLEs to a common time in one call.
+// Near-Earth TLEs are split from deep-space TLEs; their SGP4 initialization constants are computed once,
+// by the same code as SSTLE::sgp4(), and stored in columns, so propagation runs in blocks, one stage at a time,
+// with no branches or pointer chasing between satellites, which overlaps well (and can vectorize).
+// Deep-space TLEs are propagated with SSTLE::sdp4(), one at a time, as initialized once in advance. Their results are identical
+// to SSTLE::toPositionVelocity(). Near-Earth results use SSTrig's sincos() instead of the standard library's sin() and cos(),
+// so they differ in the last few bits: by less than a micrometer near the TLE epoch, growing slowly with time from it.
+
+class SSTLEArray
+{
+protected:
+    
+    vector<SSTLE> _tles;                    // copies of all TLEs; deep-space TLEs keep their SDP4 arguments
+    vector<size_t> _near, _deep;            // indices of near-Earth and deep-space TLEs
+    bool _prepared;                         // true if near-Earth columns below are current
+    
+    // Near-Earth TLE elements and SGP4 constants, in the order of _near.
+    // For "simple" orbits, omgcof, xmcof, c5, d2, d3, d4, t3cof, t4cof, t5cof are zero.
+    
+    vector<double> _epoch, _xmo, _omegao, _xnodeo, _eo, _xincl, _bstar;
+    vector<double> _aodp, _aycof, _c1, _c4, _c5, _cosio, _d2, _d3, _d4, _delmo, _omgcof,
+                   _eta, _omgdot, _sinio, _xnodp, _sinmo, _t2cof, _t3cof, _t4cof, _t5cof,
+                   _x1mth2, _x3thm1, _x7thm1, _xmcof, _xmdot, _xnodcf, _xnodot, _xlcof;
+    
+    void prepare ( void );
+    void propagateNear ( double jd, size_t n0, size_t n1, vector<SSVector> &pos, vector<SSVector> &vel );
+    void propagateDeep ( double jd, size_t d0, size_t d1, vector<SSVector> &pos, vector<SSVector> &vel );
+    
+public:
+    
+    SSTLEArray ( void );
+    
+    size_t size ( void ) { return _tles.size(); }
+    size_t numNearEarth ( void ) { return _near.size(); }
+    size_t numDeepSpace ( void ) { return _deep.size(); }
+    
+    void clear ( void );
+    void reserve ( size_t size );
+    void push_back ( const SSTLE &tle );
+    const SSTLE &get ( size_t k ) { return _tles[k]; }
+    
+    // Computes positions and velocities of all TLEs at a Julian Date (jd) in civil time (UTC), in the same
+    // Earth-centered TEME frame and units (km and km/sec) as SSTLE::toPositionVelocity(). Satellites are split
+    // into chunks propagated on separate threads (threads; if zero or negative, one per processor core).
+    
+    void toPositionVelocity ( double jd, vector<SSVector> &pos, vector<SSVector> &vel, int threads = 1 );
+    
+    // As above, but returns geocentric positions and velocities in the fundamental J2000 equatorial frame,
+    // in AU and AU/day, rotated from the equator of date as SSSatellite::computePositionVelocity() does.
+    // Unlike that method, SGP4/SDP4 are used at all times, even far from the TLE epoch, and there is no light time.
+    
+    void toFundamentalPositionVelocity ( double jd, vector<SSVector> &pos, vector<SSVector> &vel, int threads = 1 );
+};
+
 #endif /* SSTLE_hpp */
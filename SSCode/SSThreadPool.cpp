@@ -0,0 +1,236 @@
+// SSThreadPool.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <memory>
+
+#include "SSThreadPool.hpp"
+
+#if USE_THREADS
+
+// The pool whose worker is running on this thread, if any, and that worker's index.
+
+static thread_local SSThreadPool *tPool = nullptr;
+static thread_local size_t tIndex = 0;
+
+SSThreadPool::SSThreadPool ( int threads )
+{
+    if ( threads <= 0 )
+        threads = max ( 1, (int) thread::hardware_concurrency() );
+
+    _pending = 0;
+    _stop = false;
+    _next = 0;
+
+    for ( int i = 1; i < threads; i++ )
+        _workers.push_back ( unique_ptr<Worker> ( new Worker ) );
+
+    for ( size_t i = 0; i < _workers.size(); i++ )
+        _threads.push_back ( thread ( &SSThreadPool::run, this, i ) );
+}
+
+// Lets workers finish all queued tasks, then stops and joins them.
+
+SSThreadPool::~SSThreadPool ( void )
+{
+    {
+        lock_guard<mutex> lock ( _waitLock );
+        _stop = true;
+    }
+
+    _wake.notify_all();
+    for ( thread &t : _threads )
+        t.join();
+}
+
+int SSThreadPool::size ( void )
+{
+    return (int) _workers.size() + 1;
+}
+
+// Takes the newest task from worker (index)'s own queue, or failing that, steals the oldest task from another worker.
+// Returns true and the task in (task) if one was found.
+
+bool SSThreadPool::takeTask ( size_t index, function<void()> &task )
+{
+    bool found = false;
+    for ( size_t k = 0; k < _workers.size() && ! found; k++ )
+    {
+        Worker &worker = *_workers[ ( index + k ) % _workers.size() ];
+        lock_guard<mutex> lock ( worker.lock );
+        if ( worker.tasks.empty() )
+            continue;
+
+        if ( k == 0 )
+        {
+            task = move ( worker.tasks.back() );
+            worker.tasks.pop_back();
+        }
+        else
+        {
+            task = move ( worker.tasks.front() );
+            worker.tasks.pop_front();
+        }
+        found = true;
+    }
+
+    if ( found )
+    {
+        lock_guard<mutex> lock ( _waitLock );
+        _pending--;
+    }
+
+    return found;
+}
+
+// Worker thread (index) main loop: runs tasks until none are pending and the pool is stopping.
+
+void SSThreadPool::run ( size_t index )
+{
+    tPool = this;
+    tIndex = index;
+
+    while ( true )
+    {
+        function<void()> task;
+        if ( takeTask ( index, task ) )
+        {
+            task();
+            continue;
+        }
+
+        unique_lock<mutex> lock ( _waitLock );
+        _wake.wait ( lock, [this] { return _stop || _pending > 0; } );
+        if ( _stop && _pending == 0 )
+            return;
+    }
+}
+
+// Tasks submitted by one of this pool's workers go on its own queue, so it runs them next unless they are stolen;
+// tasks submitted from other threads are spread over the workers' queues in turn.
+
+void SSThreadPool::submit ( function<void()> task )
+{
+    if ( _workers.empty() )
+    {
+        task();
+        return;
+    }
+
+    size_t index = tPool == this ? tIndex : _next++ % _workers.size();
+    {
+        Worker &worker = *_workers[index];
+        lock_guard<mutex> lock ( worker.lock );
+        worker.tasks.push_back ( move ( task ) );
+    }
+
+    {
+        lock_guard<mutex> lock ( _waitLock );
+        _pending++;
+    }
+
+    _wake.notify_one();
+}
+
+void SSThreadPool::parallelFor ( size_t begin, size_t end, const function<void ( size_t, size_t )> &body, size_t grain )
+{
+    if ( end <= begin )
+        return;
+
+    size_t count = end - begin;
+    size_t threads = size();
+    if ( grain == 0 )
+        grain = max ( (size_t) 1, count / ( threads * 4 ) );
+
+    size_t chunks = ( count + grain - 1 ) / grain;
+    if ( threads == 1 || chunks == 1 )
+    {
+        for ( size_t i = begin; i < end; i += grain )
+            body ( i, min ( end, i + grain ) );
+        return;
+    }
+
+    // Chunks are taken in order from a shared counter by the caller and by helper tasks. State is shared,
+    // since helper tasks which start after every chunk is taken may outlive this call; they never touch (body).
+
+    struct State
+    {
+        atomic<size_t> next, done;
+        mutex lock;
+        condition_variable finished;
+    };
+
+    shared_ptr<State> state ( new State );
+    state->next = 0;
+    state->done = 0;
+
+    const function<void ( size_t, size_t )> *pBody = &body;
+    auto work = [state, pBody, begin, end, grain, chunks] ( void )
+    {
+        size_t chunk, ndone = 0;
+        while ( ( chunk = state->next++ ) < chunks )
+        {
+            (*pBody) ( begin + chunk * grain, min ( end, begin + ( chunk + 1 ) * grain ) );
+            ndone++;
+        }
+
+        if ( ndone > 0 && state->done.fetch_add ( ndone ) + ndone == chunks )
+        {
+            lock_guard<mutex> lock ( state->lock );
+            state->finished.notify_all();
+        }
+    };
+
+    size_t helpers = min ( threads - 1, chunks - 1 );
+    for ( size_t i = 0; i < helpers; i++ )
+        submit ( work );
+
+    work();
+
+    unique_lock<mutex> lock ( state->lock );
+    state->finished.wait ( lock, [&state, chunks] { return state->done == chunks; } );
+}
+
+#else
+
+SSThreadPool::SSThreadPool ( int threads )
+{
+}
+
+SSThreadPool::~SSThreadPool ( void )
+{
+}
+
+int SSThreadPool::size ( void )
+{
+    return 1;
+}
+
+void SSThreadPool::submit ( function<void()> task )
+{
+    task();
+}
+
+void SSThreadPool::parallelFor ( size_t begin, size_t end, const function<void ( size_t, size_t )> &body, size_t grain )
+{
+    if ( grain == 0 )
+        grain = max ( (size_t) 1, end > begin ? end - begin : 1 );
+
+    for ( size_t i = begin; i < end; i += grain )
+        body ( i, min ( end, i + grain ) );
+}
+
+#endif
+
+SSThreadPool &SSThreadPool::shared ( void )
+{
+    static SSThreadPool pool ( 0 );
+    return pool;
+}
+
+void SSParallelFor ( SSObjectArray &objects, const function<void ( size_t, size_t )> &body, size_t grain, SSThreadPool &pool )
+{
+    pool.parallelFor ( 0, objects.size(), body, grain );
+}
@@ -0,0 +1,88 @@
+// SSThreadPool.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// This class is a small work-stealing thread pool, so batch operations can share one set of worker threads instead of
+// each starting and joining its own. Each worker has its own queue of tasks; it runs its newest task first, and when
+// its queue is empty, steals the oldest task from another worker's queue. parallelFor() divides a range of indices
+// into chunks which the calling thread and the workers take in turn, so the caller always helps and never just waits;
+// this also makes it safe to call parallelFor() from inside a task. Without threads (USE_THREADS is zero, as in an
+// Emscripten build without pthreads), or in a pool of one thread, everything runs on the calling thread.
+
+#ifndef SSThreadPool_hpp
+#define SSThreadPool_hpp
+
+#include <deque>
+#include <functional>
+
+#include "SSObject.hpp"
+
+#if USE_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+class SSThreadPool
+{
+protected:
+
+#if USE_THREADS
+    struct Worker
+    {
+        deque<function<void()>> tasks;      // this worker's tasks; newest at back
+        mutex lock;                         // protects tasks
+    };
+
+    vector<unique_ptr<Worker>> _workers;    // one per worker thread
+    vector<thread> _threads;                // worker threads
+    mutex _waitLock;                        // protects _pending and _stop, for idle workers
+    condition_variable _wake;               // wakes idle workers when a task is submitted, or pool is stopping
+    size_t _pending;                        // number of tasks submitted but not yet started
+    bool _stop;                             // true when pool is being destroyed
+    atomic<size_t> _next;                   // round-robin counter for tasks submitted from outside the pool
+
+    void run ( size_t index );
+    bool takeTask ( size_t index, function<void()> &task );
+#endif
+
+public:
+
+    // Creates a pool which runs tasks on (threads) threads in all, counting the thread which calls parallelFor(); so
+    // it starts (threads - 1) workers. If (threads) is zero or negative, uses one thread per processor core.
+
+    SSThreadPool ( int threads = 0 );
+    ~SSThreadPool ( void );
+
+    SSThreadPool ( const SSThreadPool &other ) = delete;
+    SSThreadPool &operator = ( const SSThreadPool &other ) = delete;
+
+    // Returns the number of threads which run tasks, including the calling thread.
+
+    int size ( void );
+
+    // Queues a task to run on a worker thread; runs it immediately on the calling thread if the pool has no workers.
+
+    void submit ( function<void()> task );
+
+    // Calls (body) on consecutive chunks of indices [begin, end) covering the whole range, in parallel, and returns when all
+    // calls have returned. Each call gets a chunk's first index, and one past its last. Chunks hold (grain) indices, except
+    // perhaps the last; if (grain) is zero, the range is divided into several chunks per thread. Chunks may run in any
+    // order, so (body) must be safe to call concurrently for different chunks.
+
+    void parallelFor ( size_t begin, size_t end, const function<void ( size_t, size_t )> &body, size_t grain = 0 );
+
+    // Returns a pool shared by the whole library, with one thread per processor core, created on first use.
+
+    static SSThreadPool &shared ( void );
+};
+
+// Calls (body) on consecutive chunks of indices into an object array (objects) in parallel with a thread pool (pool),
+// as SSThreadPool::parallelFor() does. The array must not be changed until this returns.
+
+void SSParallelFor ( SSObjectArray &objects, const function<void ( size_t, size_t )> &body, size_t grain = 0, SSThreadPool &pool = SSThreadPool::shared() );
+
+#endif /* SSThreadPool_hpp */
@@ -12,6 +12,8 @@
 #include <sys/time.h>
 #endif
 
+#include <cstring>
+
 #include "SSAngle.hpp"
 #include "SSTime.hpp"
 
@@ -318,6 +320,19 @@ void SSTime::JDToIndian ( double jd, int &y, short &m, double &d )
     y = 100 * ( n - 49 ) + l + i - 78;
 }
 
+// Constructs a calendar date/time of 1.5 January 2000 UTC (J2000) in the Gregorian calendar.
+
+SSDate::SSDate ( void )
+{
+    calendar = kGregorian;
+    zone = 0.0;
+    year = 2000;
+    month = day = 1;
+    hour = 12;
+    min = 0;
+    sec = 0.0;
+}
+
 // Constructs a calendar date/time from the specified calendar system, local time zone in hours east of UTC,
 // and year/month/day including fractional part of day.
 
@@ -469,6 +484,249 @@ bool SSDate::parse ( const string &fmt, const string &str )
     return true;
 }
 
+// Reads exactly (n) decimal digits from a string (str) at a position (pos), which is advanced past them, into (value).
+// Returns false if there are fewer digits.
+
+static bool readDigits ( const string &str, size_t &pos, int n, int &value )
+{
+    value = 0;
+    for ( int i = 0; i < n; i++, pos++ )
+    {
+        if ( pos >= str.length() || str[pos] < '0' || str[pos] > '9' )
+            return false;
+        value = value * 10 + str[pos] - '0';
+    }
+    
+    return true;
+}
+
+bool SSDate::parseISO ( const string &str )
+{
+    size_t pos = 0, len = str.length();
+    while ( pos < len && isspace ( str[pos] ) )
+        pos++;
+    
+    // Year has at least four digits, and may have a sign; then month and day, separated by dashes.
+    
+    int sign = 1, y = 0, m = 0, d = 0, h = 0, mi = 0, digit = 0;
+    double s = 0.0, z = zone;
+    if ( pos < len && ( str[pos] == '-' || str[pos] == '+' ) )
+        sign = str[pos++] == '-' ? -1 : 1;
+    
+    size_t first = pos;
+    while ( pos < len && str[pos] >= '0' && str[pos] <= '9' && pos - first < 9 )
+        y = y * 10 + str[pos++] - '0';
+    if ( pos - first < 4 || pos >= len || str[pos++] != '-' || ! readDigits ( str, pos, 2, m ) )
+        return false;
+    if ( pos >= len || str[pos++] != '-' || ! readDigits ( str, pos, 2, d ) )
+        return false;
+    
+    // Optional time: hours and minutes, then optional seconds with fraction.
+    
+    if ( pos < len && ( str[pos] == 'T' || str[pos] == ' ' ) && pos + 1 < len && isdigit ( str[pos + 1] ) )
+    {
+        pos++;
+        if ( ! readDigits ( str, pos, 2, h ) || pos >= len || str[pos++] != ':' || ! readDigits ( str, pos, 2, mi ) )
+            return false;
+        
+        if ( pos < len && str[pos] == ':' )
+        {
+            int is = 0;
+            pos++;
+            if ( ! readDigits ( str, pos, 2, is ) )
+                return false;
+            
+            s = is;
+            if ( pos < len && ( str[pos] == '.' || str[pos] == ',' ) )
+            {
+                double scale = 0.1;
+                for ( pos++; pos < len && readDigits ( str, pos, 1, digit ); scale *= 0.1 )
+                    s += digit * scale;
+            }
+        }
+        
+        // Optional time zone: Z for UTC, or hours and optional minutes east of UTC.
+        
+        if ( pos < len && str[pos] == 'Z' )
+        {
+            z = 0.0;
+            pos++;
+        }
+        else if ( pos < len && ( str[pos] == '+' || str[pos] == '-' ) )
+        {
+            int zs = str[pos++] == '-' ? -1 : 1, zh = 0, zm = 0;
+            if ( ! readDigits ( str, pos, 2, zh ) )
+                return false;
+            if ( pos < len && str[pos] == ':' )
+                pos++;
+            if ( pos < len && isdigit ( str[pos] ) && ! readDigits ( str, pos, 2, zm ) )
+                return false;
+            z = zs * ( zh + zm / 60.0 );
+        }
+    }
+    
+    while ( pos < len && isspace ( str[pos] ) )
+        pos++;
+    
+    if ( pos < len || m < 1 || m > 12 || d < 1 || d > 31 || h > 24 || mi > 59 || s >= 61.0 )
+        return false;
+    
+    calendar = kGregorian;
+    zone = z;
+    year = sign * y;
+    month = m;
+    day = d;
+    hour = h;
+    min = mi;
+    sec = s;
+    return true;
+}
+
+static const char *kMonthNames[12] = { "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December" };
+static const char *kWeekdayNames[7] = { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" };
+
+SSDateFormat::SSDateFormat ( const string &fmt )
+{
+    static const char *kDirectCodes = "YyCmdejHIMSpaAbBhznt%";
+    
+    for ( size_t i = 0; i < fmt.length(); i++ )
+    {
+        if ( fmt[i] != '%' || i + 1 >= fmt.length() )
+        {
+            if ( _tokens.empty() || _tokens.back().code != 0 )
+                _tokens.push_back ( { 0, string() } );
+            _tokens.back().text += fmt[i];
+            continue;
+        }
+        
+        // Composite codes are expanded into their parts; codes with flags or modifiers are passed to strftime().
+        
+        char code = fmt[++i];
+        const char *parts = code == 'F' ? "Y-m-d" : code == 'T' ? "H:M:S" : code == 'R' ? "H:M" : code == 'D' ? "m/d/y" : nullptr;
+        if ( parts != nullptr )
+        {
+            for ( const char *p = parts; *p; p++ )
+                if ( *p == '-' || *p == ':' || *p == '/' )
+                    _tokens.push_back ( { 0, string ( 1, *p ) } );
+                else
+                    _tokens.push_back ( { *p, string() } );
+        }
+        else if ( strchr ( kDirectCodes, code ) != nullptr )
+        {
+            _tokens.push_back ( { code, string() } );
+        }
+        else
+        {
+            string text = string ( "%" ) + code;
+            if ( strchr ( "-_0^#EO", code ) != nullptr && i + 1 < fmt.length() )
+                text += fmt[++i];
+            _tokens.push_back ( { '?', text } );
+        }
+    }
+}
+
+size_t SSDateFormat::format ( SSDate date, char *buf, size_t size ) const
+{
+    size_t len = 0;
+    auto put = [&] ( const char *str, size_t n )
+    {
+        for ( size_t i = 0; i < n; i++, len++ )
+            if ( len + 1 < size )
+                buf[len] = str[i];
+    };
+    
+    // Writes an integer (value) with at least (width) digits, padded with (pad) characters.
+    
+    auto putInt = [&] ( long value, int width, char pad )
+    {
+        char digits[24];
+        int n = 0;
+        bool negative = value < 0;
+        unsigned long u = negative ? 0UL - (unsigned long) value : (unsigned long) value;
+        do
+        {
+            digits[n++] = '0' + u % 10;
+            u /= 10;
+        }
+        while ( u > 0 );
+        
+        if ( negative )
+            put ( "-", 1 );
+        for ( int i = n; i < width; i++ )
+            put ( &pad, 1 );
+        while ( n > 0 )
+            put ( &digits[--n], 1 );
+    };
+    
+    for ( const Token &token : _tokens )
+    {
+        int month = date.month >= 1 && date.month <= 12 ? date.month - 1 : 0;
+        switch ( token.code )
+        {
+            case 0: put ( token.text.data(), token.text.length() ); break;
+            case 'Y': putInt ( date.year, 1, '0' ); break;
+            case 'y': putInt ( ( date.year % 100 + 100 ) % 100, 2, '0' ); break;
+            case 'C': putInt ( (long) floor ( date.year / 100.0 ), 2, '0' ); break;
+            case 'm': putInt ( date.month, 2, '0' ); break;
+            case 'd': putInt ( date.day, 2, '0' ); break;
+            case 'e': putInt ( date.day, 2, ' ' ); break;
+            case 'H': putInt ( date.hour, 2, '0' ); break;
+            case 'I': putInt ( date.hour % 12 == 0 ? 12 : date.hour % 12, 2, '0' ); break;
+            case 'M': putInt ( date.min, 2, '0' ); break;
+            case 'S': putInt ( (int) date.sec, 2, '0' ); break;
+            case 'p': put ( date.hour < 12 ? "AM" : "PM", 2 ); break;
+            case 'b': case 'h': put ( kMonthNames[month], 3 ); break;
+            case 'B': put ( kMonthNames[month], strlen ( kMonthNames[month] ) ); break;
+            case 'n': put ( "\n", 1 ); break;
+            case 't': put ( "\t", 1 ); break;
+            case '%': put ( "%", 1 ); break;
+            case 'a': case 'A':
+            {
+                const char *name = kWeekdayNames[ SSTime ( date ).getWeekday() ];
+                put ( name, token.code == 'a' ? 3 : strlen ( name ) );
+                break;
+            }
+            case 'j':
+            {
+                SSDate jan0 ( date.calendar, 0.0, date.year, 1, 0, 0, 0, 0.0 ), today ( date.calendar, 0.0, date.year, date.month, date.day, 0, 0, 0.0 );
+                putInt ( lround ( SSTime ( today ).jd - SSTime ( jan0 ).jd ), 3, '0' );
+                break;
+            }
+            case 'z':
+            {
+                long minutes = (long) ( date.zone * 3600.0 ) / 60;
+                put ( minutes < 0 ? "-" : "+", 1 );
+                putInt ( labs ( minutes ) / 60, 2, '0' );
+                putInt ( labs ( minutes ) % 60, 2, '0' );
+                break;
+            }
+            default:
+            {
+                string str = date.format ( token.text );
+                put ( str.data(), str.length() );
+                break;
+            }
+        }
+    }
+    
+    if ( size > 0 )
+        buf[ len < size ? len : size - 1 ] = 0;
+    
+    return len;
+}
+
+string SSDateFormat::format ( SSDate date ) const
+{
+    char buf[256];
+    size_t len = format ( date, buf, sizeof ( buf ) );
+    if ( len < sizeof ( buf ) )
+        return string ( buf, len );
+    
+    vector<char> big ( len + 1 );
+    format ( date, big.data(), big.size() );
+    return string ( big.data(), len );
+}
+
 // Constructs a time with default values of 1.5 Jan 2000 UTC.
 
 SSTime::SSTime ( void )
@@ -772,6 +1030,166 @@ SSAngle SSTime::getSiderealTime ( SSAngle lon )
     return ( SSAngle::fromDegrees ( gmst ) + lon ).mod2Pi();
 }
 
+// Batch versions of getDeltaT(), getJulianEphemerisDate(), and getSiderealTime(), for arrays of (n) Julian Dates (jd);
+// results are stored in (dt), (jed), and (lst), and are identical to the single-time versions.
+
+void SSTime::getDeltaT ( const double *jd, double *dt, size_t n )
+{
+    for ( size_t i = 0; i < n; i++ )
+        dt[i] = SSTime ( jd[i] ).getDeltaT();
+}
+
+void SSTime::getJulianEphemerisDate ( const double *jd, double *jed, size_t n )
+{
+    for ( size_t i = 0; i < n; i++ )
+        jed[i] = SSTime ( jd[i] ).getJulianEphemerisDate();
+}
+
+void SSTime::getSiderealTime ( const double *jd, SSAngle lon, double *lst, size_t n )
+{
+    for ( size_t i = 0; i < n; i++ )
+        lst[i] = SSTime ( jd[i] ).getSiderealTime ( lon );
+}
+
+bool SSTime::parse ( const string &str )
+{
+    SSDate date;
+    date.zone = zone;
+    if ( date.parseISO ( str ) )
+    {
+        *this = SSTime ( date );
+        return true;
+    }
+    
+    // Julian Date, optionally after "JD"; or Modified Julian Date after "MJD".
+    
+    size_t pos = str.find_first_not_of ( " \t" );
+    if ( pos == string::npos )
+        return false;
+    
+    double offset = 0.0;
+    if ( str.compare ( pos, 3, "MJD" ) == 0 )
+    {
+        offset = 2400000.5;
+        pos += 3;
+    }
+    else if ( str.compare ( pos, 2, "JD" ) == 0 )
+    {
+        pos += 2;
+    }
+    
+    const char *start = str.c_str() + pos;
+    char *end = nullptr;
+    double value = strtod ( start, &end );
+    if ( end == start )
+        return false;
+    
+    while ( isspace ( *end ) )
+        end++;
+    if ( *end != 0 || isinf ( value ) || isnan ( value ) )
+        return false;
+    
+    jd = value + offset;
+    return true;
+}
+
+// Converts an integer day number (jdn), the Julian Date at noon, to a Gregorian (gregorian true) or Julian calendar date.
+// Algorithms from "The Explanatory Supplement to the Astronomical Almanac" (1992), as in JDToGregorian() and JDToJulian().
+
+static void dayNumberToDate ( int64_t jdn, bool gregorian, int &y, short &m, short &d )
+{
+    if ( gregorian )
+    {
+        int64_t l = jdn + 68569;
+        int64_t n = ( 4 * l ) / 146097;
+        l = l - ( 146097 * n + 3 ) / 4;
+        int64_t i = ( 4000 * ( l + 1 ) ) / 1461001;
+        l = l - ( 1461 * i ) / 4 + 31;
+        int64_t j = ( 80 * l ) / 2447;
+        d = (short) ( l - ( 2447 * j ) / 80 );
+        l = j / 11;
+        m = (short) ( j + 2 - 12 * l );
+        y = (int) ( 100 * ( n - 49 ) + i + l );
+    }
+    else
+    {
+        int64_t j = jdn + 1402;
+        int64_t k = ( j - 1 ) / 1461;
+        int64_t l = j - 1461 * k;
+        int64_t n = ( l - 1 ) / 365 - l / 1461;
+        int64_t i = l - 365 * n + 30;
+        j = ( 80 * i ) / 2447;
+        d = (short) ( i - ( 2447 * j ) / 80 );
+        i = j / 11;
+        m = (short) ( j + 2 - 12 * i );
+        y = (int) ( 4 * k + n + i - 4716 );
+    }
+}
+
+// Converts a Gregorian (gregorian true) or Julian calendar date (y/m/d) to an integer day number, the Julian Date at noon.
+
+static int64_t dateToDayNumber ( int64_t y, int64_t m, int64_t d, bool gregorian )
+{
+    if ( gregorian )
+        return ( 1461 * ( y + 4800 + ( m - 14 ) / 12 ) ) / 4 + ( 367 * ( m - 2 - 12 * ( ( m - 14 ) / 12 ) ) ) / 12
+             - ( 3 * ( ( y + 4900 + ( m - 14 ) / 12 ) / 100 ) ) / 4 + d - 32075;
+    else
+        return 367 * y - ( 7 * ( y + 5001 + ( m - 9 ) / 7 ) ) / 4 + ( 275 * m ) / 9 + d + 1729777;
+}
+
+void SSTime::toCalendarDates ( const double *jd, SSDate *dates, size_t n, SSCalendar cal, double zone )
+{
+    static constexpr int64_t kMicrosecondsPerDay = 86400000000LL;
+    
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double local = jd[i] + zone / 24.0 + 0.5;
+        if ( cal > kJulian || ! ( local >= 0.0 && local < 1.0e9 ) )
+        {
+            dates[i] = SSDate ( SSTime ( jd[i], zone ), cal );
+            continue;
+        }
+        
+        int64_t jdn = (int64_t) floor ( local );
+        int64_t usec = llround ( ( local - jdn ) * kMicrosecondsPerDay );
+        if ( usec >= kMicrosecondsPerDay )
+        {
+            jdn++;
+            usec -= kMicrosecondsPerDay;
+        }
+        
+        SSDate &date = dates[i];
+        bool gregorian = cal == kGregorian || ( cal == kGregorianJulian && jdn >= 2299161 );
+        dayNumberToDate ( jdn, gregorian, date.year, date.month, date.day );
+        date.hour = (short) ( usec / 3600000000LL );
+        date.min = (short) ( usec / 60000000LL % 60 );
+        date.sec = ( usec % 60000000LL ) / 1.0e6;
+        date.calendar = cal;
+        date.zone = zone;
+    }
+}
+
+void SSTime::fromCalendarDates ( const SSDate *dates, double *jd, size_t n )
+{
+    for ( size_t i = 0; i < n; i++ )
+    {
+        const SSDate &date = dates[i];
+        if ( date.calendar > kJulian || date.year < -4712 )
+        {
+            jd[i] = SSTime ( date ).jd;
+            continue;
+        }
+        
+        bool gregorian = date.calendar == kGregorian;
+        if ( date.calendar == kGregorianJulian )
+            gregorian = date.year > 1582 || ( date.year == 1582 && ( date.month > 10 || ( date.month == 10 && date.day >= 5 ) ) );
+        
+        int64_t jdn = dateToDayNumber ( date.year, date.month, date.day, gregorian );
+        double seconds = date.hour * 3600.0 + date.min * 60.0 + date.sec - date.zone * 3600.0;
+        jd[i] = ( jdn - 0.5 ) + seconds / kSecondsPerDay;
+    }
+}
+
 // Returns the Julian Dates that corresponds to the start of the local day.
      
 SSTime SSTime::getLocalMidnight ( void )
@@ -10,6 +10,7 @@
 #define SSTime_hpp
 
 #include <string>
+#include <vector>
 #include <stdio.h>
 #include <math.h>
 #include <time.h>
@@ -45,6 +46,7 @@ struct SSDate
     short min;             // minute of hour; 0 to 59
     double sec;            // seconds of minute including fractional part; 0 to 59.999...
     
+    SSDate ( void );
     SSDate ( SSCalendar calendar, double zone, int year, short month, short day, short hour, short min, double sec );
     SSDate ( SSCalendar calendar, double zone, int year, short month, double dayf );
     SSDate ( SSTime time, SSCalendar calendar = kGregorianJulian );
@@ -55,6 +57,38 @@ struct SSDate
     
     string format ( const string &fmt );
     bool parse ( const string &fmt, const string &str );
+    
+    // Parses an ISO 8601 date (str) without strptime(): [-]YYYY-MM-DD, optionally followed by 'T' or a space and
+    // hh:mm[:ss[.sss]], then optionally a time zone, 'Z' or +/-hh[:mm], which sets this date's zone. Sets the calendar
+    // to Gregorian. Returns false, leaving this date unchanged, if the string is not in this form.
+    
+    bool parseISO ( const string &str );
+};
+
+// A strftime()-style date format (see SSDate::format()), parsed once, then applied to many dates without calling
+// strftime() or allocating memory, e.g. for event tables and ephemeris exports. Codes %Y %y %C %m %d %e %j %H %I %M %S %p
+// %a %A %b %B %h %z %F %T %R %D %n %t %% are formatted directly, with the same results as SSDate::format() in the "C" locale,
+// except that %j is the actual day of the year; other codes, or codes with flags, are passed to SSDate::format(), and are no faster.
+
+class SSDateFormat
+{
+protected:
+    struct Token
+    {
+        char code;          // conversion code, e.g. 'Y'; or zero for literal text
+        string text;        // literal text, or "%" and code for codes passed to SSDate::format()
+    };
+    
+    vector<Token> _tokens;
+    
+public:
+    SSDateFormat ( const string &fmt );
+    
+    // Formats a date (date) into a buffer (buf) of (size) bytes, truncating if needed, and always null-terminated
+    // if (size) is not zero. Returns the length of the whole formatted string, not counting the null, as snprintf() does.
+    
+    size_t format ( SSDate date, char *buf, size_t size ) const;
+    string format ( SSDate date ) const;
 };
 
 // Represents an instant in time as a Julian Date and a local time zone;
@@ -117,6 +151,23 @@ struct SSTime
     double  getDeltaT ( void );
     double  getJulianEphemerisDate ( void );
     SSAngle getSiderealTime ( SSAngle lon );
+    
+    static void getDeltaT ( const double *jd, double *dt, size_t n );
+    static void getJulianEphemerisDate ( const double *jd, double *jed, size_t n );
+    static void getSiderealTime ( const double *jd, SSAngle lon, double *lst, size_t n );
+    
+    // Parses a time (str) as an ISO 8601 date and time (see SSDate::parseISO()), or as a Julian Date: a number, optionally
+    // after "JD"; or a Modified Julian Date after "MJD". Returns false, leaving this time unchanged, if not parsed.
+    
+    bool parse ( const string &str );
+    
+    // Batch conversions of (n) Julian Dates (jd) to calendar dates (dates) in a calendar system (cal) and time zone (zone),
+    // and back, with integer day numbers and times of day. In the Gregorian and Julian calendars, times of day are rounded
+    // to the nearest microsecond, so e.g. noon is 12:00:00 rather than 11:59:59.999999; dates in other calendars, and before
+    // JD 0, are converted as by SSDate ( SSTime ) and SSTime ( SSDate ).
+    
+    static void toCalendarDates ( const double *jd, SSDate *dates, size_t n, SSCalendar cal = kGregorianJulian, double zone = 0.0 );
+    static void fromCalendarDates ( const SSDate *dates, double *jd, size_t n );
     SSTime  getLocalMidnight ( void );
     
     static double CalendarToJD ( int y, short m, double d );
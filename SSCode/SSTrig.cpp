@@ -0,0 +1,327 @@
+// SSTrig.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <algorithm>
+
+#include "SSTrig.hpp"
+
+using namespace std;
+
+// Arctangent rational approximation on [-tan(pi/8), +tan(pi/8)] after range reduction (from Cephes atan.c),
+// and the low-order bits of pi/2 lost in kHalfPi, added back when the reduced argument is offset by pi/2 or pi/4.
+
+static constexpr double kAtanP0 = -8.750608600031904122785e-01, kAtanP1 = -1.615753718733365076637e+01, kAtanP2 = -7.500855792314704667340e+01;
+static constexpr double kAtanP3 = -1.228866684490136173410e+02, kAtanP4 = -6.485021904942025371773e+01;
+static constexpr double kAtanQ0 = 2.485846490142306297962e+01, kAtanQ1 = 1.650270098316988542046e+02, kAtanQ2 = 4.328810604912902668951e+02;
+static constexpr double kAtanQ3 = 4.853903996359136964868e+02, kAtanQ4 = 1.945506571482613964425e+02;
+static constexpr double kTan3PiOver8 = 2.41421356237309504880, kMoreBits = 6.123233995736765886130e-17;
+static constexpr double kQuarterPi = 7.85398163397448309616e-01, kHalfPi = 1.57079632679489661923, kPi = 3.14159265358979323846;
+
+#if SSTRIG_AVX2
+
+#define SSTRIG_TARGET __attribute__ (( target ( "avx2,fma" ) ))
+
+// Checked on first call, not in a static initializer, since other files' static initializers may call this first.
+
+bool trigAVX2 ( void )
+{
+    static bool avx2 = __builtin_cpu_supports ( "avx2" ) && __builtin_cpu_supports ( "fma" );
+    return avx2;
+}
+
+// Vector operations used by the kernels below, so each kernel is written once for all instruction sets.
+// Comparisons return lane masks; select ( m, a, b ) returns a where the mask is set, otherwise b.
+
+struct SSTrigVec
+{
+    typedef __m256d V;
+    typedef __m256d M;
+    static constexpr int kLanes = 4;
+
+    SSTRIG_TARGET static inline V set1 ( double x ) { return _mm256_set1_pd ( x ); }
+    SSTRIG_TARGET static inline V load ( const double *p ) { return _mm256_loadu_pd ( p ); }
+    SSTRIG_TARGET static inline void store ( double *p, V x ) { _mm256_storeu_pd ( p, x ); }
+    SSTRIG_TARGET static inline V add ( V a, V b ) { return _mm256_add_pd ( a, b ); }
+    SSTRIG_TARGET static inline V sub ( V a, V b ) { return _mm256_sub_pd ( a, b ); }
+    SSTRIG_TARGET static inline V mul ( V a, V b ) { return _mm256_mul_pd ( a, b ); }
+    SSTRIG_TARGET static inline V div ( V a, V b ) { return _mm256_div_pd ( a, b ); }
+    SSTRIG_TARGET static inline V madd ( V a, V b, V c ) { return _mm256_fmadd_pd ( a, b, c ); }
+    SSTRIG_TARGET static inline V sqrt ( V a ) { return _mm256_sqrt_pd ( a ); }
+    SSTRIG_TARGET static inline V abs ( V a ) { return _mm256_andnot_pd ( _mm256_set1_pd ( -0.0 ), a ); }
+    SSTRIG_TARGET static inline V signbit ( V a ) { return _mm256_and_pd ( _mm256_set1_pd ( -0.0 ), a ); }
+    SSTRIG_TARGET static inline V xorbits ( V a, V b ) { return _mm256_xor_pd ( a, b ); }
+    SSTRIG_TARGET static inline M lt ( V a, V b ) { return _mm256_cmp_pd ( a, b, _CMP_LT_OQ ); }
+    SSTRIG_TARGET static inline M eq ( V a, V b ) { return _mm256_cmp_pd ( a, b, _CMP_EQ_OQ ); }
+    SSTRIG_TARGET static inline V select ( M m, V a, V b ) { return _mm256_blendv_pd ( b, a, m ); }
+    SSTRIG_TARGET static inline void sincos ( V x, V &s, V &c ) { sincos4 ( x, s, c ); }
+};
+
+#elif SSTRIG_NEON
+
+#define SSTRIG_TARGET
+
+struct SSTrigVec
+{
+    typedef float64x2_t V;
+    typedef uint64x2_t M;
+    static constexpr int kLanes = 2;
+
+    static inline V set1 ( double x ) { return vdupq_n_f64 ( x ); }
+    static inline V load ( const double *p ) { return vld1q_f64 ( p ); }
+    static inline void store ( double *p, V x ) { vst1q_f64 ( p, x ); }
+    static inline V add ( V a, V b ) { return vaddq_f64 ( a, b ); }
+    static inline V sub ( V a, V b ) { return vsubq_f64 ( a, b ); }
+    static inline V mul ( V a, V b ) { return vmulq_f64 ( a, b ); }
+    static inline V div ( V a, V b ) { return vdivq_f64 ( a, b ); }
+    static inline V madd ( V a, V b, V c ) { return vfmaq_f64 ( c, a, b ); }
+    static inline V sqrt ( V a ) { return vsqrtq_f64 ( a ); }
+    static inline V abs ( V a ) { return vabsq_f64 ( a ); }
+    static inline V signbit ( V a ) { return vreinterpretq_f64_u64 ( vandq_u64 ( vreinterpretq_u64_f64 ( a ), vdupq_n_u64 ( 1ULL << 63 ) ) ); }
+    static inline V xorbits ( V a, V b ) { return vreinterpretq_f64_u64 ( veorq_u64 ( vreinterpretq_u64_f64 ( a ), vreinterpretq_u64_f64 ( b ) ) ); }
+    static inline M lt ( V a, V b ) { return vcltq_f64 ( a, b ); }
+    static inline M eq ( V a, V b ) { return vceqq_f64 ( a, b ); }
+    static inline V select ( M m, V a, V b ) { return vbslq_f64 ( m, a, b ); }
+    static inline void sincos ( V x, V &s, V &c ) { sincos2 ( x, s, c ); }
+};
+
+#elif SSTRIG_WASM
+
+#define SSTRIG_TARGET
+
+struct SSTrigVec
+{
+    typedef v128_t V;
+    typedef v128_t M;
+    static constexpr int kLanes = 2;
+
+    static inline V set1 ( double x ) { return wasm_f64x2_splat ( x ); }
+    static inline V load ( const double *p ) { return wasm_v128_load ( p ); }
+    static inline void store ( double *p, V x ) { wasm_v128_store ( p, x ); }
+    static inline V add ( V a, V b ) { return wasm_f64x2_add ( a, b ); }
+    static inline V sub ( V a, V b ) { return wasm_f64x2_sub ( a, b ); }
+    static inline V mul ( V a, V b ) { return wasm_f64x2_mul ( a, b ); }
+    static inline V div ( V a, V b ) { return wasm_f64x2_div ( a, b ); }
+    static inline V madd ( V a, V b, V c ) { return madd2 ( c, a, b ); }
+    static inline V sqrt ( V a ) { return wasm_f64x2_sqrt ( a ); }
+    static inline V abs ( V a ) { return wasm_f64x2_abs ( a ); }
+    static inline V signbit ( V a ) { return wasm_v128_and ( a, wasm_f64x2_splat ( -0.0 ) ); }
+    static inline V xorbits ( V a, V b ) { return wasm_v128_xor ( a, b ); }
+    static inline M lt ( V a, V b ) { return wasm_f64x2_lt ( a, b ); }
+    static inline M eq ( V a, V b ) { return wasm_f64x2_eq ( a, b ); }
+    static inline V select ( M m, V a, V b ) { return wasm_v128_bitselect ( a, b, m ); }
+    static inline void sincos ( V x, V &s, V &c ) { sincos2 ( x, s, c ); }
+};
+
+#endif
+
+#if SSTRIG_AVX2 || SSTRIG_NEON || SSTRIG_WASM
+
+typedef SSTrigVec::V V;
+
+// Arctangent of (y) / (x) for every lane, from -pi to +pi. Cephes' three argument ranges are chosen
+// by comparing |y| with multiples of |x|, so only one division is needed.
+
+SSTRIG_TARGET static inline V atan2Vec ( V y, V x )
+{
+    typedef SSTrigVec T;
+    V ay = T::abs ( y ), ax = T::abs ( x );
+    T::M big = T::lt ( T::mul ( T::set1 ( kTan3PiOver8 ), ax ), ay );
+    T::M mid = T::lt ( T::mul ( T::set1 ( 0.66 ), ax ), ay );
+
+    V num = T::select ( big, T::sub ( T::set1 ( 0.0 ), ax ), T::select ( mid, T::sub ( ay, ax ), ay ) );
+    V den = T::select ( big, ay, T::select ( mid, T::add ( ay, ax ), ax ) );
+    den = T::select ( T::eq ( den, T::set1 ( 0.0 ) ), T::set1 ( 1.0 ), den );
+    V base = T::select ( big, T::set1 ( kHalfPi ), T::select ( mid, T::set1 ( kQuarterPi ), T::set1 ( 0.0 ) ) );
+    V more = T::select ( big, T::set1 ( kMoreBits ), T::select ( mid, T::set1 ( 0.5 * kMoreBits ), T::set1 ( 0.0 ) ) );
+
+    V t = T::div ( num, den );
+    V z = T::mul ( t, t );
+    V p = T::madd ( z, T::set1 ( kAtanP0 ), T::set1 ( kAtanP1 ) );
+    p = T::madd ( z, p, T::set1 ( kAtanP2 ) );
+    p = T::madd ( z, p, T::set1 ( kAtanP3 ) );
+    p = T::madd ( z, p, T::set1 ( kAtanP4 ) );
+    V q = T::add ( z, T::set1 ( kAtanQ0 ) );
+    q = T::madd ( z, q, T::set1 ( kAtanQ1 ) );
+    q = T::madd ( z, q, T::set1 ( kAtanQ2 ) );
+    q = T::madd ( z, q, T::set1 ( kAtanQ3 ) );
+    q = T::madd ( z, q, T::set1 ( kAtanQ4 ) );
+
+    V a = T::add ( base, T::add ( T::madd ( T::mul ( t, z ), T::div ( p, q ), t ), more ) );
+    a = T::select ( T::lt ( x, T::set1 ( 0.0 ) ), T::add ( T::sub ( T::set1 ( kPi ), a ), T::set1 ( 2.0 * kMoreBits ) ), a );
+    return T::xorbits ( a, T::signbit ( y ) );
+}
+
+// Arccosine of every lane: 2 atan ( sqrt ( ( 1 - x ) / ( 1 + x ) ) ), where 1 - x and 1 + x are exact near +/-1.
+
+SSTRIG_TARGET static inline V acosVec ( V x )
+{
+    typedef SSTrigVec T;
+    V a = atan2Vec ( T::sqrt ( T::sub ( T::set1 ( 1.0 ), x ) ), T::sqrt ( T::add ( T::set1 ( 1.0 ), x ) ) );
+    return T::add ( a, a );
+}
+
+// Batch loops. The last partial vector is padded with zeros, so every element is computed by the same kernel.
+
+SSTRIG_TARGET static void vsincosSIMD ( const double *x, double *sinx, double *cosx, size_t n )
+{
+    typedef SSTrigVec T;
+    const int L = T::kLanes;
+    V s, c;
+
+    for ( size_t i = 0; i < n; i += L )
+    {
+        if ( i + L <= n )
+        {
+            T::sincos ( T::load ( x + i ), s, c );
+            T::store ( sinx + i, s );
+            T::store ( cosx + i, c );
+        }
+        else
+        {
+            double xs[L] = { 0.0 }, ss[L], cs[L];
+            copy ( x + i, x + n, xs );
+            T::sincos ( T::load ( xs ), s, c );
+            T::store ( ss, s );
+            T::store ( cs, c );
+            copy ( ss, ss + n - i, sinx + i );
+            copy ( cs, cs + n - i, cosx + i );
+        }
+    }
+}
+
+SSTRIG_TARGET static void vatan2SIMD ( const double *y, const double *x, double *a, size_t n )
+{
+    typedef SSTrigVec T;
+    const int L = T::kLanes;
+
+    for ( size_t i = 0; i < n; i += L )
+    {
+        if ( i + L <= n )
+        {
+            T::store ( a + i, atan2Vec ( T::load ( y + i ), T::load ( x + i ) ) );
+        }
+        else
+        {
+            double ys[L] = { 0.0 }, xs[L] = { 0.0 }, as[L];
+            copy ( y + i, y + n, ys );
+            copy ( x + i, x + n, xs );
+            T::store ( as, atan2Vec ( T::load ( ys ), T::load ( xs ) ) );
+            copy ( as, as + n - i, a + i );
+        }
+    }
+}
+
+SSTRIG_TARGET static void vacosSIMD ( const double *x, double *a, size_t n )
+{
+    typedef SSTrigVec T;
+    const int L = T::kLanes;
+
+    for ( size_t i = 0; i < n; i += L )
+    {
+        if ( i + L <= n )
+        {
+            T::store ( a + i, acosVec ( T::load ( x + i ) ) );
+        }
+        else
+        {
+            double xs[L] = { 0.0 }, as[L];
+            copy ( x + i, x + n, xs );
+            T::store ( as, acosVec ( T::load ( xs ) ) );
+            copy ( as, as + n - i, a + i );
+        }
+    }
+}
+
+#endif
+
+// Returns true if batch functions should use the SIMD kernels above on this CPU.
+
+static inline bool useSIMD ( void )
+{
+#if SSTRIG_AVX2
+    return trigAVX2();
+#elif SSTRIG_NEON || SSTRIG_WASM
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char *trigSIMD ( void )
+{
+#if SSTRIG_AVX2
+    return trigAVX2() ? "AVX2" : "none";
+#elif SSTRIG_NEON
+    return "NEON";
+#elif SSTRIG_WASM
+    return "WASM";
+#else
+    return "none";
+#endif
+}
+
+void vsincos ( const double *x, double *sinx, double *cosx, size_t n )
+{
+#if SSTRIG_AVX2 || SSTRIG_NEON || SSTRIG_WASM
+    if ( useSIMD() )
+    {
+        // Kernels are only accurate below kTrigMaxArg; recompute larger and non-finite arguments with libm.
+        // An element of (x) may have been overwritten if (x) is (sinx) or (cosx), so save those first.
+
+        double big[16];
+        size_t ibig[16], nbig = 0;
+        for ( size_t i0 = 0; i0 < n; i0 += 16 )
+        {
+            size_t n0 = min ( n - i0, (size_t) 16 );
+            nbig = 0;
+            for ( size_t i = i0; i < i0 + n0; i++ )
+                if ( ! ( fabs ( x[i] ) < kTrigMaxArg ) )
+                {
+                    big[nbig] = x[i];
+                    ibig[nbig++] = i;
+                }
+
+            vsincosSIMD ( x + i0, sinx + i0, cosx + i0, n0 );
+            for ( size_t k = 0; k < nbig; k++ )
+            {
+                sinx[ibig[k]] = sin ( big[k] );
+                cosx[ibig[k]] = cos ( big[k] );
+            }
+        }
+        return;
+    }
+#endif
+
+    for ( size_t i = 0; i < n; i++ )
+    {
+        double s, c;
+        sincos ( x[i], s, c );
+        sinx[i] = s;
+        cosx[i] = c;
+    }
+}
+
+void vatan2 ( const double *y, const double *x, double *a, size_t n )
+{
+#if SSTRIG_AVX2 || SSTRIG_NEON || SSTRIG_WASM
+    if ( useSIMD() )
+        return vatan2SIMD ( y, x, a, n );
+#endif
+
+    for ( size_t i = 0; i < n; i++ )
+        a[i] = x[i] == 0.0 && y[i] == 0.0 ? 0.0 : atan2 ( y[i], x[i] );
+}
+
+void vacos ( const double *x, double *a, size_t n )
+{
+#if SSTRIG_AVX2 || SSTRIG_NEON || SSTRIG_WASM
+    if ( useSIMD() )
+        return vacosSIMD ( x, a, n );
+#endif
+
+    for ( size_t i = 0; i < n; i++ )
+        a[i] = acos ( x[i] );
+}
@@ -0,0 +1,222 @@
+// SSTrig.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// Shared trigonometric kernels for SSCore's hot loops: a combined sincos() which reduces its argument once,
+// batch sine and cosine, arctangent, and arccosine over arrays, and the SIMD building blocks they're made of,
+// which subsystems with their own SIMD loops (e.g. VSOP2013's packed series) use instead of separate intrinsics.
+// Batch functions use AVX2 + FMA (x86-64, chosen at run time), NEON (ARM64), or WASM SIMD128 (-msimd128),
+// and portable scalar code elsewhere, or everywhere if SSTRIG_USE_SIMD is #defined as 0.
+//
+// Accuracy, measured against long double libm over 10 million random arguments (AVX2 and WASM kernels agree):
+//   sincos(), vsincos(): max error 1.7 ulp, or 1.8e-16 absolute, for |x| < kTrigMaxArg.
+//                        Larger or non-finite arguments fall back to libm sin() and cos().
+//   vatan2():            max error 1.6 ulp, or 5.2e-16 radians absolute, for finite arguments.
+//                        atan2 ( 0, 0 ) is 0, and x = -0.0 is treated as +0.0.
+//   vacos():             max error 2.8 ulp, or 5.8e-16 radians absolute, for -1 <= x <= 1; NaN outside.
+// The scalar fallback paths call libm, whose error is typically below 1 ulp.
+
+#ifndef SSTrig_hpp
+#define SSTrig_hpp
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#ifndef SSTRIG_USE_SIMD
+#define SSTRIG_USE_SIMD 1           // 1 to use AVX2, NEON, or WASM SIMD128 kernels where available; 0 for portable scalar code only
+#endif
+
+#if SSTRIG_USE_SIMD && ( defined ( __x86_64__ ) || defined ( __i386__ ) ) && ( defined ( __GNUC__ ) || defined ( __clang__ ) )
+#define SSTRIG_AVX2 1
+#include <immintrin.h>
+#elif SSTRIG_USE_SIMD && defined ( __aarch64__ ) && defined ( __ARM_NEON )
+#define SSTRIG_NEON 1
+#include <arm_neon.h>
+#elif SSTRIG_USE_SIMD && defined ( __wasm_simd128__ )
+#define SSTRIG_WASM 1
+#include <wasm_simd128.h>
+#endif
+
+// Argument reduction constants: pi/2 split into 33 + 33 + 53 bits (from fdlibm). With |x| < kTrigMaxArg,
+// k * kPio2_1 and k * kPio2_2 are exact, so the reduced argument is accurate to ~1 ulp without FMA.
+
+static constexpr double kTrigMaxArg = 1048576.0;       // 2^20 radians
+static constexpr double kTwoOverPi = 6.36619772367581382433e-01;
+static constexpr double kPio2_1 = 1.57079632673412561417e+00;
+static constexpr double kPio2_2 = 6.07710050630396597660e-11;
+static constexpr double kPio2_2t = 2.02226624879595063154e-21;
+
+// Minimax polynomial coefficients for sin and cos on [-pi/4, +pi/4] (from fdlibm).
+
+static constexpr double kS1 = -1.66666666666666324348e-01, kS2 = 8.33333333332248946124e-03, kS3 = -1.98412698298579493134e-04;
+static constexpr double kS4 = 2.75573137070700676789e-06, kS5 = -2.50507602534068634195e-08, kS6 = 1.58969099521155010221e-10;
+static constexpr double kC1 = 4.16666666666666019037e-02, kC2 = -1.38888888888741095749e-03, kC3 = 2.48015872894767294178e-05;
+static constexpr double kC4 = -2.75573143513906633035e-07, kC5 = 2.08757232129817482790e-09, kC6 = -1.13596475577881948265e-11;
+
+// Computes sin (sinx) and cos (cosx) of (x) with one argument reduction.
+
+inline void sincos ( double x, double &sinx, double &cosx )
+{
+    if ( ! ( fabs ( x ) < kTrigMaxArg ) )
+    {
+        sinx = sin ( x );
+        cosx = cos ( x );
+        return;
+    }
+
+    double k = nearbyint ( x * kTwoOverPi );
+    int q = (int) k;
+    double r = x - k * kPio2_1 - k * kPio2_2 - k * kPio2_2t;
+    double z = r * r;
+    double s = r + z * r * ( kS1 + z * ( kS2 + z * ( kS3 + z * ( kS4 + z * ( kS5 + z * kS6 ) ) ) ) );
+    double c = 1.0 - 0.5 * z + z * z * ( kC1 + z * ( kC2 + z * ( kC3 + z * ( kC4 + z * ( kC5 + z * kC6 ) ) ) ) );
+
+    // Quadrant q: 1 swaps sin and cos; sin changes sign in quadrants 2,3; cos in quadrants 1,2.
+
+    if ( q & 1 )
+    {
+        double t = s;
+        s = c;
+        c = t;
+    }
+
+    sinx = q & 2 ? -s : s;
+    cosx = ( q + 1 ) & 2 ? -c : c;
+}
+
+// Batch versions: sines (sinx) and cosines (cosx) of (n) arguments (x); arctangents (a) of (n) ratios (y) / (x),
+// in the correct quadrant from -pi to +pi; and arccosines (a) of (n) values (x) from 0 to pi.
+// Output arrays may be the same as input arrays.
+
+void vsincos ( const double *x, double *sinx, double *cosx, size_t n );
+void vatan2 ( const double *y, const double *x, double *a, size_t n );
+void vacos ( const double *x, double *a, size_t n );
+
+// Returns name of the SIMD instruction set the batch functions use on this CPU: "AVX2", "NEON", "WASM", or "none".
+
+const char *trigSIMD ( void );
+
+// SIMD building blocks. Each computes sin and cos of every lane of (x), as sincos() does, for |x| < kTrigMaxArg.
+
+#if SSTRIG_AVX2
+
+// Returns true if this CPU supports AVX2 and FMA; AVX2 functions must not be called otherwise.
+
+bool trigAVX2 ( void );
+
+__attribute__ (( target ( "avx2,fma" ) ))
+static inline void sincos4 ( __m256d x, __m256d &sinx, __m256d &cosx )
+{
+    const __m256d magic = _mm256_set1_pd ( 6755399441055744.0 );   // 1.5 * 2^52: integer part lands in low mantissa bits
+    __m256d k = _mm256_round_pd ( _mm256_mul_pd ( x, _mm256_set1_pd ( kTwoOverPi ) ), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+    __m256i q = _mm256_castpd_si256 ( _mm256_add_pd ( k, magic ) );
+
+    __m256d r = _mm256_fnmadd_pd ( k, _mm256_set1_pd ( kPio2_1 ), x );
+    r = _mm256_fnmadd_pd ( k, _mm256_set1_pd ( kPio2_2 ), r );
+    r = _mm256_fnmadd_pd ( k, _mm256_set1_pd ( kPio2_2t ), r );
+
+    __m256d z = _mm256_mul_pd ( r, r );
+    __m256d ps = _mm256_fmadd_pd ( z, _mm256_set1_pd ( kS6 ), _mm256_set1_pd ( kS5 ) );
+    ps = _mm256_fmadd_pd ( z, ps, _mm256_set1_pd ( kS4 ) );
+    ps = _mm256_fmadd_pd ( z, ps, _mm256_set1_pd ( kS3 ) );
+    ps = _mm256_fmadd_pd ( z, ps, _mm256_set1_pd ( kS2 ) );
+    ps = _mm256_fmadd_pd ( z, ps, _mm256_set1_pd ( kS1 ) );
+    __m256d s = _mm256_fmadd_pd ( _mm256_mul_pd ( z, r ), ps, r );
+
+    __m256d pc = _mm256_fmadd_pd ( z, _mm256_set1_pd ( kC6 ), _mm256_set1_pd ( kC5 ) );
+    pc = _mm256_fmadd_pd ( z, pc, _mm256_set1_pd ( kC4 ) );
+    pc = _mm256_fmadd_pd ( z, pc, _mm256_set1_pd ( kC3 ) );
+    pc = _mm256_fmadd_pd ( z, pc, _mm256_set1_pd ( kC2 ) );
+    pc = _mm256_fmadd_pd ( z, pc, _mm256_set1_pd ( kC1 ) );
+    __m256d c = _mm256_fmadd_pd ( _mm256_mul_pd ( z, z ), pc, _mm256_fnmadd_pd ( z, _mm256_set1_pd ( 0.5 ), _mm256_set1_pd ( 1.0 ) ) );
+
+    const __m256i one = _mm256_set1_epi64x ( 1 ), two = _mm256_set1_epi64x ( 2 );
+    __m256d swap = _mm256_castsi256_pd ( _mm256_cmpeq_epi64 ( _mm256_and_si256 ( q, one ), one ) );
+    __m256d ssign = _mm256_castsi256_pd ( _mm256_slli_epi64 ( _mm256_and_si256 ( q, two ), 62 ) );
+    __m256d csign = _mm256_castsi256_pd ( _mm256_slli_epi64 ( _mm256_and_si256 ( _mm256_add_epi64 ( q, one ), two ), 62 ) );
+
+    sinx = _mm256_xor_pd ( _mm256_blendv_pd ( s, c, swap ), ssign );
+    cosx = _mm256_xor_pd ( _mm256_blendv_pd ( c, s, swap ), csign );
+}
+
+#elif SSTRIG_NEON
+
+static inline void sincos2 ( float64x2_t x, float64x2_t &sinx, float64x2_t &cosx )
+{
+    float64x2_t k = vrndnq_f64 ( vmulq_n_f64 ( x, kTwoOverPi ) );
+    int64x2_t q = vcvtq_s64_f64 ( k );
+
+    float64x2_t r = vfmsq_f64 ( x, k, vdupq_n_f64 ( kPio2_1 ) );
+    r = vfmsq_f64 ( r, k, vdupq_n_f64 ( kPio2_2 ) );
+    r = vfmsq_f64 ( r, k, vdupq_n_f64 ( kPio2_2t ) );
+
+    float64x2_t z = vmulq_f64 ( r, r );
+    float64x2_t ps = vfmaq_f64 ( vdupq_n_f64 ( kS5 ), z, vdupq_n_f64 ( kS6 ) );
+    ps = vfmaq_f64 ( vdupq_n_f64 ( kS4 ), z, ps );
+    ps = vfmaq_f64 ( vdupq_n_f64 ( kS3 ), z, ps );
+    ps = vfmaq_f64 ( vdupq_n_f64 ( kS2 ), z, ps );
+    ps = vfmaq_f64 ( vdupq_n_f64 ( kS1 ), z, ps );
+    float64x2_t s = vfmaq_f64 ( r, vmulq_f64 ( z, r ), ps );
+
+    float64x2_t pc = vfmaq_f64 ( vdupq_n_f64 ( kC5 ), z, vdupq_n_f64 ( kC6 ) );
+    pc = vfmaq_f64 ( vdupq_n_f64 ( kC4 ), z, pc );
+    pc = vfmaq_f64 ( vdupq_n_f64 ( kC3 ), z, pc );
+    pc = vfmaq_f64 ( vdupq_n_f64 ( kC2 ), z, pc );
+    pc = vfmaq_f64 ( vdupq_n_f64 ( kC1 ), z, pc );
+    float64x2_t c = vfmaq_f64 ( vfmsq_f64 ( vdupq_n_f64 ( 1.0 ), z, vdupq_n_f64 ( 0.5 ) ), vmulq_f64 ( z, z ), pc );
+
+    uint64x2_t swap = vtstq_s64 ( q, vdupq_n_s64 ( 1 ) );
+    uint64x2_t ssign = vshlq_n_u64 ( vreinterpretq_u64_s64 ( vandq_s64 ( q, vdupq_n_s64 ( 2 ) ) ), 62 );
+    uint64x2_t csign = vshlq_n_u64 ( vreinterpretq_u64_s64 ( vandq_s64 ( vaddq_s64 ( q, vdupq_n_s64 ( 1 ) ), vdupq_n_s64 ( 2 ) ) ), 62 );
+
+    sinx = vreinterpretq_f64_u64 ( veorq_u64 ( vreinterpretq_u64_f64 ( vbslq_f64 ( swap, c, s ) ), ssign ) );
+    cosx = vreinterpretq_f64_u64 ( veorq_u64 ( vreinterpretq_u64_f64 ( vbslq_f64 ( swap, s, c ) ), csign ) );
+}
+
+#elif SSTRIG_WASM
+
+// WASM SIMD has no fused multiply-add; madd2() returns a + b * c with separate operations.
+
+static inline v128_t madd2 ( v128_t a, v128_t b, v128_t c )
+{
+    return wasm_f64x2_add ( a, wasm_f64x2_mul ( b, c ) );
+}
+
+static inline void sincos2 ( v128_t x, v128_t &sinx, v128_t &cosx )
+{
+    v128_t k = wasm_f64x2_nearest ( wasm_f64x2_mul ( x, wasm_f64x2_splat ( kTwoOverPi ) ) );
+    v128_t q = wasm_i64x2_extend_low_i32x4 ( wasm_i32x4_trunc_sat_f64x2_zero ( k ) );
+
+    v128_t r = wasm_f64x2_sub ( x, wasm_f64x2_mul ( k, wasm_f64x2_splat ( kPio2_1 ) ) );
+    r = wasm_f64x2_sub ( r, wasm_f64x2_mul ( k, wasm_f64x2_splat ( kPio2_2 ) ) );
+    r = wasm_f64x2_sub ( r, wasm_f64x2_mul ( k, wasm_f64x2_splat ( kPio2_2t ) ) );
+
+    v128_t z = wasm_f64x2_mul ( r, r );
+    v128_t ps = madd2 ( wasm_f64x2_splat ( kS5 ), z, wasm_f64x2_splat ( kS6 ) );
+    ps = madd2 ( wasm_f64x2_splat ( kS4 ), z, ps );
+    ps = madd2 ( wasm_f64x2_splat ( kS3 ), z, ps );
+    ps = madd2 ( wasm_f64x2_splat ( kS2 ), z, ps );
+    ps = madd2 ( wasm_f64x2_splat ( kS1 ), z, ps );
+    v128_t s = madd2 ( r, wasm_f64x2_mul ( z, r ), ps );
+
+    v128_t pc = madd2 ( wasm_f64x2_splat ( kC5 ), z, wasm_f64x2_splat ( kC6 ) );
+    pc = madd2 ( wasm_f64x2_splat ( kC4 ), z, pc );
+    pc = madd2 ( wasm_f64x2_splat ( kC3 ), z, pc );
+    pc = madd2 ( wasm_f64x2_splat ( kC2 ), z, pc );
+    pc = madd2 ( wasm_f64x2_splat ( kC1 ), z, pc );
+    v128_t c = madd2 ( wasm_f64x2_sub ( wasm_f64x2_splat ( 1.0 ), wasm_f64x2_mul ( z, wasm_f64x2_splat ( 0.5 ) ) ), wasm_f64x2_mul ( z, z ), pc );
+
+    v128_t swap = wasm_i64x2_ne ( wasm_v128_and ( q, wasm_i64x2_splat ( 1 ) ), wasm_i64x2_splat ( 0 ) );
+    v128_t ssign = wasm_i64x2_shl ( wasm_v128_and ( q, wasm_i64x2_splat ( 2 ) ), 62 );
+    v128_t csign = wasm_i64x2_shl ( wasm_v128_and ( wasm_i64x2_add ( q, wasm_i64x2_splat ( 1 ) ), wasm_i64x2_splat ( 2 ) ), 62 );
+
+    sinx = wasm_v128_xor ( wasm_v128_bitselect ( c, s, swap ), ssign );
+    cosx = wasm_v128_xor ( wasm_v128_bitselect ( s, c, swap ), csign );
+}
+
+#endif
+
+#endif /* SSTrig_hpp */
@@ -20,6 +20,16 @@
 #endif
 
 #include "SSUtilities.hpp"
+#include "SSGzip.hpp"
+
+#if USE_FETCH && defined(__EMSCRIPTEN__)
+#include <emscripten/fetch.h>
+#endif
+
+#if USE_MMAP && ! defined(_WIN32)
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
 
 // Returns path to current working directory as a string
 
@@ -50,11 +60,11 @@ string getcwd(void)
 bool fgetline ( FILE *file, string &line )
 {
     line = "";
-    char c = 0;
+    int c = 0;
 
     while ( true )
     {
-        if ( fread ( &c, 1, 1, file ) != 1 )
+        if ( ( c = getc ( file ) ) == EOF )
             return false;
         
         if ( c == '\n' )
@@ -62,12 +72,12 @@ bool fgetline ( FILE *file, string &line )
 
         if ( c == '\r' )
         {
-            if ( fread ( &c, 1, 1, file ) == 1 && c != '\n' )
-                fseek ( file, -1, SEEK_CUR );
+            if ( ( c = getc ( file ) ) != '\n' && c != EOF )
+                ungetc ( c, file );
             return true;
         }
         
-        line += c;
+        line += (char) c;
     }
 }
 
@@ -99,6 +109,95 @@ string format ( const char *fmt, ... )
     return string ( buf );
 }
 
+// Appends printf()-style formatted text to a string (str), without constructing a temporary string.
+
+void appendf ( string &str, const char *fmt, ... )
+{
+    char buf[1024] = { 0 };
+
+    va_list args;
+    va_start ( args, fmt );
+    int len = vsnprintf ( buf, sizeof buf, fmt, args );
+    va_end ( args );
+
+    if ( len > 0 )
+        str.append ( buf, min ( (size_t) len, sizeof buf - 1 ) );
+}
+
+// Appends a floating-point value to a string (str) with a fixed number of decimal places (decimals),
+// producing exactly the same text as printf ( "%.*f" ), or "%+.*f" if (plus) is true, but much faster.
+// The value is scaled and rounded with integer arithmetic; values which are too large, have too many
+// decimals, or lie too close to a rounding tie to be rounded correctly that way are passed to snprintf().
+
+void append_fixed ( string &str, double value, int decimals, bool plus )
+{
+    static const double kPow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+    static const uint64_t kIntPow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+    
+    if ( decimals >= 0 && decimals <= 9 && isfinite ( value ) )
+    {
+        // Product (x) is within half an ulp of the exact scaled value, so unless it is nearly half-way between
+        // two integers, rounding it to nearest gives the same integer as rounding the exact value would.
+        
+        double x = fabs ( value ) * kPow10[decimals];
+        double f = floor ( x ), frac = x - f;
+        if ( x < 1.0e15 && fabs ( frac - 0.5 ) > x * 4.0e-16 )
+        {
+            uint64_t r = (uint64_t) f + ( frac > 0.5 ? 1 : 0 );
+            uint64_t ip = r / kIntPow10[decimals], fp = r % kIntPow10[decimals];
+            char buf[32], *p = buf + sizeof buf;
+            
+            for ( int i = 0; i < decimals; i++, fp /= 10 )
+                *--p = '0' + fp % 10;
+            
+            if ( decimals > 0 )
+                *--p = '.';
+            
+            do
+                *--p = '0' + ip % 10;
+            while ( ip /= 10 );
+            
+            if ( signbit ( value ) )
+                *--p = '-';
+            else if ( plus )
+                *--p = '+';
+            
+            str.append ( p, buf + sizeof buf - p );
+            return;
+        }
+    }
+    
+    appendf ( str, plus ? "%+.*f" : "%.*f", decimals, value );
+}
+
+// Appends a numeric field and its trailing comma to a line of CSV text (csv), as append_fixed() does,
+// or only the comma if the value is infinite (i.e. unknown).
+
+void append_csv_fixed ( string &csv, double value, int decimals, bool plus )
+{
+    if ( ! ::isinf ( value ) )
+        append_fixed ( csv, value, decimals, plus );
+    
+    csv += ',';
+}
+
+// Appends a text field and its trailing comma to a line of CSV text (csv); if the field contains a comma, puts it in quotes.
+
+void append_csv_string ( string &csv, const string &field )
+{
+    if ( field.find ( ',' ) == string::npos )
+    {
+        csv += field;
+        csv += ',';
+    }
+    else
+    {
+        csv += '"';
+        csv += field;
+        csv += "\",";
+    }
+}
+
 // Robust string comparison function. Returns an integer less than zero if str1 is less than str2;
 // zero if str1 equals str2; or an integer greater than zero if str1 equals str2. If n > 0, only
 // the first n characters are compared. Performs a case-sensitive comparison if casesens is true;
@@ -283,6 +382,88 @@ vector<string> split_csv ( const string &csv )
     return fields;
 }
 
+// Returns true for the whitespace characters which trim() removes.
+
+static inline bool is_csv_space ( char c )
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Splits a line of comma-separated values (csv) into fields, exactly as split_csv() does, then trims leading and
+// trailing whitespace from each field. Fields are views into this object's own unescaped copy of the line;
+// storage is reused from line to line, so no memory is allocated unless a line is longer, or has more fields,
+// than any line before it. Returns the number of fields, which is always at least one.
+
+size_t SSCSVFields::split ( SSSpan<char> csv )
+{
+    CSVState state = kCSVUnquotedField;
+    vector<size_t> &starts = _starts;
+    size_t n = 0;
+    
+    // Unescaped text is never longer than the line, so the buffer is sized once, before any views point into it.
+    
+    if ( _text.size() < csv.size() )
+        _text.resize ( csv.size() );
+    
+    starts.clear();
+    starts.push_back ( 0 );
+    
+    for ( char c : csv )
+    {
+        switch ( state )
+        {
+            case kCSVUnquotedField:
+                if ( c == ',' )
+                    starts.push_back ( n );
+                else if ( c == '"' )
+                    state = kCSVQuotedField;
+                else
+                    _text[n++] = c;
+                break;
+            case kCSVQuotedField:
+                if ( c == '"' )
+                    state = kCSVQuotedQuote;
+                else
+                    _text[n++] = c;
+                break;
+            case kCSVQuotedQuote:
+                if ( c == ',' )
+                {
+                    starts.push_back ( n );
+                    state = kCSVUnquotedField;
+                }
+                else if ( c == '"' )
+                {
+                    _text[n++] = '"';
+                    state = kCSVQuotedField;
+                }
+                else
+                {
+                    state = kCSVUnquotedField;
+                }
+                break;
+        }
+    }
+    
+    // Make trimmed views of each field.
+    
+    _fields.resize ( starts.size() );
+    for ( size_t i = 0; i < starts.size(); i++ )
+    {
+        size_t start = starts[i], end = i + 1 < starts.size() ? starts[i + 1] : n;
+        
+        while ( start < end && is_csv_space ( _text[start] ) )
+            start++;
+        
+        while ( end > start && is_csv_space ( _text[end - 1] ) )
+            end--;
+        
+        _fields[i] = SSSpan<char> ( _text.data() + start, end - start );
+    }
+    
+    return _fields.size();
+}
+
 // Converts string to 32-bit signed integer.
 // Avoids throwing exceptions, unlike stoi().
 // Returns zero if string cannot be converted.
@@ -319,6 +500,117 @@ double strtofloat64 ( string str )
     return strtod ( str.c_str(), nullptr );
 }
 
+// Copies a view of a string (str) into a null-terminated buffer (buf) of (size) bytes, truncating it if necessary,
+// so it can be converted with C library functions without allocating memory. Returns the buffer.
+
+static const char *span_to_buffer ( SSSpan<char> str, char *buf, size_t size )
+{
+    size_t n = min ( str.size(), size - 1 );
+    memcpy ( buf, str.data(), n );
+    buf[n] = 0;
+    return buf;
+}
+
+// Parses a plain decimal number, with optional sign and decimal point and no exponent, of at most (maxDigits)
+// significant digits, from a view of a string (str), into an integer mantissa (m) and number of decimal places (k).
+// Returns false if the string is anything else. A number with few enough digits is exactly representable as
+// m / 10^k with both m and 10^k exact, so one correctly-rounded division gives the same result as strtod()/strtof().
+
+static bool parse_decimal ( SSSpan<char> str, int maxDigits, bool &neg, uint64_t &m, int &k )
+{
+    const char *p = str.begin(), *end = str.end();
+    int digits = 0;
+    bool point = false, any = false;
+    
+    neg = false;
+    m = 0;
+    k = 0;
+    
+    while ( p < end && ( *p == ' ' || *p == '\t' ) )
+        p++;
+    
+    if ( p < end && ( *p == '-' || *p == '+' ) )
+        neg = *p++ == '-';
+    
+    for ( ; p < end; p++ )
+    {
+        if ( *p >= '0' && *p <= '9' )
+        {
+            any = true;
+            if ( m == 0 && *p == '0' && ! point )
+                continue;
+            
+            if ( ++digits > maxDigits )
+                return false;
+            
+            m = m * 10 + ( *p - '0' );
+            if ( point )
+                k++;
+        }
+        else if ( *p == '.' && ! point )
+        {
+            point = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    
+    return any;
+}
+
+// Equivalents of strtoint(), strtoint64(), strtofloat(), and strtofloat64() for views of strings (str),
+// which do not allocate memory. Plain decimal numbers are converted directly, with results identical
+// to the C library functions; others are converted by those functions from a stack buffer.
+
+int strtoint ( SSSpan<char> str )
+{
+    char buf[32];
+    return atoi ( span_to_buffer ( str, buf, sizeof ( buf ) ) );
+}
+
+int64_t strtoint64 ( SSSpan<char> str )
+{
+    char buf[32];
+    return atoll ( span_to_buffer ( str, buf, sizeof ( buf ) ) );
+}
+
+float strtofloat ( SSSpan<char> str )
+{
+    static const float pow10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+    bool neg = false;
+    uint64_t m = 0;
+    int k = 0;
+    
+    if ( parse_decimal ( str, 7, neg, m, k ) && k <= 10 )
+    {
+        float x = (float) m / pow10[k];
+        return neg ? -x : x;
+    }
+    
+    char buf[64];
+    return strtof ( span_to_buffer ( str, buf, sizeof ( buf ) ), nullptr );
+}
+
+double strtofloat64 ( SSSpan<char> str )
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    bool neg = false;
+    uint64_t m = 0;
+    int k = 0;
+    
+    if ( parse_decimal ( str, 15, neg, m, k ) && k <= 22 )
+    {
+        double x = (double) m / pow10[k];
+        return neg ? -x : x;
+    }
+    
+    char buf[64];
+    return strtod ( span_to_buffer ( str, buf, sizeof ( buf ) ), nullptr );
+}
+
 // Converts a string representing an angle in deg min sec to decimal degrees.
 // Works with angle strings in any format (DD MM SS.S, DD MM.M, DD.D, etc.)
 // Assumes leading whitespace has been removed from string!
@@ -600,3 +892,338 @@ time_t filetime ( const string &path )
     else
         return 0;
 }
+
+// Maps an entire file (path) into memory for reading, and returns its size in bytes (size).
+// Returns pointer to start of mapped file, or nullptr if the file can't be mapped, is empty,
+// or memory mapping is not supported on this platform. Unmap with unmapfile() when done.
+
+const void *mapfile ( const string &path, size_t &size )
+{
+    size = 0;
+    
+#if USE_MMAP && defined(_WIN32)
+    HANDLE file = CreateFileA ( path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+    if ( file == INVALID_HANDLE_VALUE )
+        return nullptr;
+    
+    LARGE_INTEGER len = { 0 };
+    HANDLE mapping = NULL;
+    void *data = nullptr;
+    if ( GetFileSizeEx ( file, &len ) && len.QuadPart > 0 )
+        mapping = CreateFileMappingA ( file, NULL, PAGE_READONLY, 0, 0, NULL );
+    if ( mapping != NULL )
+        data = MapViewOfFile ( mapping, FILE_MAP_READ, 0, 0, 0 );
+
+    // The view keeps the file mapped after its handles are closed.
+    
+    if ( mapping != NULL )
+        CloseHandle ( mapping );
+    CloseHandle ( file );
+    if ( data != nullptr )
+        size = (size_t) len.QuadPart;
+    return data;
+#elif USE_MMAP
+    int fd = open ( path.c_str(), O_RDONLY );
+    if ( fd < 0 )
+        return nullptr;
+    
+    struct stat st;
+    void *data = nullptr;
+    if ( fstat ( fd, &st ) == 0 && st.st_size > 0 )
+    {
+        data = mmap ( nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+        if ( data == MAP_FAILED )
+            data = nullptr;
+        else
+            size = st.st_size;
+    }
+    
+    ::close ( fd );
+    return data;
+#else
+    return nullptr;
+#endif
+}
+
+// Unmaps a file mapped by mapfile(), given the pointer (data) and size returned by it.
+
+void unmapfile ( const void *data, size_t size )
+{
+    if ( data == nullptr )
+        return;
+    
+#if USE_MMAP && defined(_WIN32)
+    UnmapViewOfFile ( data );
+#elif USE_MMAP
+    munmap ( (void *) data, size );
+#endif
+}
+
+// Reads an entire file into memory (bytes), e.g. a binary catalog or HTM archive to open from memory.
+// With USE_FETCH in an Emscripten build, (url) is fetched from the web server straight into memory, instead of
+// being preloaded into Emscripten's virtual filesystem; the fetch is synchronous, so it must be called from a
+// worker thread, not the browser's main thread. Otherwise (url) is a local file path. Returns false on failure.
+
+bool fetchfile ( const string &url, vector<char> &bytes )
+{
+    bytes.clear();
+    
+#if USE_FETCH && defined(__EMSCRIPTEN__)
+    emscripten_fetch_attr_t attr;
+    emscripten_fetch_attr_init ( &attr );
+    strcpy ( attr.requestMethod, "GET" );
+    attr.attributes = EMSCRIPTEN_FETCH_LOAD_TO_MEMORY | EMSCRIPTEN_FETCH_SYNCHRONOUS;
+    
+    emscripten_fetch_t *fetch = emscripten_fetch ( &attr, url.c_str() );
+    bool ok = fetch != nullptr && fetch->status == 200;
+    if ( ok )
+        bytes.assign ( fetch->data, fetch->data + fetch->numBytes );
+    if ( fetch != nullptr )
+        emscripten_fetch_close ( fetch );
+    return ok;
+#else
+    FILE *file = fopen ( url.c_str(), "rb" );
+    if ( file == nullptr )
+        return false;
+    
+    bool ok = fseek ( file, 0, SEEK_END ) == 0;
+    long size = ok ? ftell ( file ) : -1;
+    if ( size > 0 && fseek ( file, 0, SEEK_SET ) == 0 )
+    {
+        bytes.resize ( size );
+        ok = fread ( bytes.data(), 1, size, file ) == (size_t) size;
+    }
+    else
+    {
+        ok = size == 0;
+    }
+    
+    fclose ( file );
+    if ( ! ok )
+        bytes.clear();
+    return ok;
+#endif
+}
+
+SSLineReader::SSLineReader ( void )
+{
+    _file = nullptr;
+    _gzip = nullptr;
+    _ownFile = false;
+    _map = _data = nullptr;
+    _mapSize = _begin = _end = 0;
+    _eof = _skipLF = false;
+}
+
+SSLineReader::SSLineReader ( const string &path ) : SSLineReader()
+{
+    open ( path );
+}
+
+SSLineReader::SSLineReader ( FILE *file ) : SSLineReader()
+{
+    open ( file );
+}
+
+SSLineReader::~SSLineReader ( void )
+{
+    close();
+}
+
+// Opens a file (path) for reading, memory-mapped if possible; otherwise opens it with fopen(), which on Android
+// also reads from the application package. A gzip-compressed file is decompressed in large blocks as it is read.
+// Any previous file is closed first. Returns true if successful.
+
+bool SSLineReader::open ( const string &path )
+{
+    close();
+    
+    _map = (const char *) mapfile ( path, _mapSize );
+    if ( _map != nullptr && ! SSGzipReader::isGzip ( _map, _mapSize ) )
+    {
+        _data = _map;
+        _end = _mapSize;
+        _eof = true;
+        return true;
+    }
+    
+    if ( _map != nullptr )
+    {
+        _gzip = new SSGzipReader();
+        _gzip->open ( _map, _mapSize );
+    }
+    else
+    {
+        FILE *file = fopen ( path.c_str(), "rb" );
+        if ( file == nullptr )
+            return false;
+        
+        uint8_t magic[2] = { 0 };
+        bool gzip = SSGzipReader::isGzip ( magic, fread ( magic, 1, 2, file ) );
+        rewind ( file );
+        
+        open ( file );
+        _ownFile = true;
+        if ( ! gzip )
+            return true;
+        
+        _gzip = new SSGzipReader();
+        _gzip->open ( _file );
+    }
+    
+    _buffer.resize ( SSGzipReader::kBlockSize );
+    _data = _buffer.data();
+    return true;
+}
+
+// Reads lines from a file already opened for reading in binary mode (file), in blocks.
+// Any previous file is closed first. The reader does not close this file.
+
+bool SSLineReader::open ( FILE *file )
+{
+    close();
+    if ( file == nullptr )
+        return false;
+    
+    _file = file;
+    _buffer.resize ( 1 << 16 );
+    _data = _buffer.data();
+    return true;
+}
+
+// Reads lines from text already in memory (data) of (size) bytes, without copying it.
+// Any previous file is closed first.
+
+bool SSLineReader::open ( const char *data, size_t size )
+{
+    close();
+    if ( data == nullptr )
+        return false;
+    
+    _data = data;
+    _end = size;
+    _eof = true;
+    return true;
+}
+
+void SSLineReader::close ( void )
+{
+    delete _gzip;
+    _gzip = nullptr;
+    
+    if ( _file != nullptr && _ownFile )
+        fclose ( _file );
+    
+    if ( _map != nullptr )
+        unmapfile ( _map, _mapSize );
+    
+    _file = nullptr;
+    _ownFile = false;
+    _map = _data = nullptr;
+    _mapSize = _begin = _end = 0;
+    _eof = _skipLF = false;
+}
+
+// Moves unread text to the start of the buffer, enlarging the buffer if it is full of unread text,
+// then reads as much more of the file as will fit.
+
+void SSLineReader::fill ( void )
+{
+    if ( _file == nullptr && _gzip == nullptr )
+    {
+        _eof = true;
+        return;
+    }
+    
+    if ( _begin > 0 )
+    {
+        memmove ( _buffer.data(), _buffer.data() + _begin, _end - _begin );
+        _end -= _begin;
+        _begin = 0;
+    }
+    
+    if ( _end == _buffer.size() )
+        _buffer.resize ( _buffer.size() * 2 );
+    
+    _data = _buffer.data();
+    char *buffer = _buffer.data() + _end;
+    size_t size = _gzip ? _gzip->read ( buffer, _buffer.size() - _end ) : fread ( buffer, 1, _buffer.size() - _end, _file );
+    _end += size;
+    if ( size == 0 )
+        _eof = true;
+}
+
+bool SSLineReader::getline ( SSSpan<char> &line )
+{
+    if ( _data == nullptr && _file == nullptr )
+        return false;
+    
+    // If the last line ended with a CR at the end of the buffer, skip an LF that follows it.
+    
+    if ( _skipLF )
+    {
+        if ( _begin == _end && ! _eof )
+            fill();
+        if ( _begin < _end && _data[_begin] == '\n' )
+            _begin++;
+        _skipLF = false;
+    }
+    
+    size_t scan = _begin;
+    while ( true )
+    {
+        // Find the next LF, then any CR before it, with memchr(), which is much faster than testing each character.
+        
+        const char *lf = (const char *) memchr ( _data + scan, '\n', _end - scan );
+        const char *stop = lf ? lf : _data + _end;
+        const char *cr = (const char *) memchr ( _data + scan, '\r', stop - ( _data + scan ) );
+        scan = ( cr ? cr : stop ) - _data;
+        
+        if ( scan < _end )
+        {
+            line = SSSpan<char> ( _data + _begin, scan - _begin );
+            if ( _data[scan] == '\r' )
+            {
+                if ( scan + 1 < _end )
+                {
+                    if ( _data[scan + 1] == '\n' )
+                        scan++;
+                }
+                else
+                {
+                    _skipLF = true;
+                }
+            }
+            
+            _begin = scan + 1;
+            return true;
+        }
+        
+        // No line ending in the unread text. At end of file, return what is left as the last line.
+        // Otherwise read more of the file, and continue scanning where we stopped.
+        
+        if ( _eof )
+        {
+            if ( _begin == _end )
+                return false;
+            
+            line = SSSpan<char> ( _data + _begin, _end - _begin );
+            _begin = _end;
+            return true;
+        }
+        
+        size_t scanned = scan - _begin;
+        fill();
+        scan = _begin + scanned;
+    }
+}
+
+bool SSLineReader::getline ( string &line )
+{
+    SSSpan<char> span;
+    if ( ! getline ( span ) )
+        return false;
+    
+    line.assign ( span.data(), span.size() );
+    return true;
+}
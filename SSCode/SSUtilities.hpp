@@ -26,6 +26,39 @@ using namespace std;
 template <typename T>  const T &clamp ( const T &value, const T &low, const T &high ) { return value < low ? low : value > high ? high : value; }
 #endif
 
+// SSSpan is a read-only view of a contiguous array of elements owned by something else:
+// either a C array, which may be a constexpr table in read-only storage, or a vector.
+// This is a C++11 replacement for a const std::span declared in <span> in C++20.
+
+template <typename T> class SSSpan
+{
+    const T *_data;
+    size_t _size;
+
+public:
+
+    constexpr SSSpan ( void ) : _data ( nullptr ), _size ( 0 ) {}
+    constexpr SSSpan ( const T *data, size_t size ) : _data ( data ), _size ( size ) {}
+    template <size_t N> constexpr SSSpan ( const T (&array)[N] ) : _data ( array ), _size ( N ) {}
+    SSSpan ( const vector<T> &vec ) : _data ( vec.data() ), _size ( vec.size() ) {}
+
+    constexpr size_t size ( void ) const { return _size; }
+    constexpr bool empty ( void ) const { return _size == 0; }
+    constexpr const T *data ( void ) const { return _data; }
+    constexpr const T *begin ( void ) const { return _data; }
+    constexpr const T *end ( void ) const { return _data + _size; }
+    constexpr const T &operator [] ( size_t i ) const { return _data[i]; }
+};
+
+// Memory accounting helpers. heapbytes() returns memory actually taken by a heap block of (size) bytes: typical
+// allocators round blocks up to 16 bytes and add a header of one pointer. vecbytes() and strbytes() return
+// heap memory owned by a vector (its capacity, not just its size) or string (none if short enough to be stored
+// inside the string object itself); the vector or string object itself is counted as part of whatever contains it.
+
+constexpr size_t heapbytes ( size_t size ) { return size ? ( size + sizeof ( void * ) + 15 ) & ~(size_t) 15 : 0; }
+template <typename T> size_t vecbytes ( const vector<T> &vec ) { return heapbytes ( vec.capacity() * sizeof ( T ) ); }
+inline size_t strbytes ( const string &str ) { return str.capacity() > string().capacity() ? heapbytes ( str.capacity() + 1 ) : 0; }
+
 // on Android, hijack fopen and route it through the android asset system
 // so that we can pull things out of our package's APK. From:
 // http://www.50ply.com/blog/2013/01/19/loading-compressed-android-assets-with-file-pointer/
@@ -46,15 +79,67 @@ extern "C" FILE *android_fopen ( const char *fname, const char *mode );
 
 #define M_2PI (2*M_PI)
 
+// USE_MMAP enables memory-mapped file access with mapfile(); not available with Emscripten.
+
+#ifndef USE_MMAP
+#if defined(__EMSCRIPTEN__)
+#define USE_MMAP 0
+#else
+#define USE_MMAP 1
+#endif
+#endif
+
+// USE_THREADS enables multithreading; not available with Emscripten unless it is built with pthreads.
+
+#ifndef USE_THREADS
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+#define USE_THREADS 0
+#else
+#define USE_THREADS 1
+#endif
+#endif
+
+// USE_FETCH makes fetchfile() download URLs with the Emscripten Fetch API; link with -sFETCH=1 and -pthread.
+// Otherwise fetchfile() reads local files.
+
+#ifndef USE_FETCH
+#define USE_FETCH 0
+#endif
+
 string getcwd ( void );
 bool fgetline ( FILE *infile, string &line );
 
 string trim ( string str );
 string format ( const char *fmt, ... );
+void appendf ( string &str, const char *fmt, ... );
+void append_fixed ( string &str, double value, int decimals, bool plus = false );
+void append_csv_fixed ( string &csv, double value, int decimals, bool plus = false );
+void append_csv_string ( string &csv, const string &field );
 vector<string> split ( string str, string delim );
 vector<string> tokenize ( string str, string delim );
 vector<string> split_csv ( const string &csv );
 
+// Splits comma-separated values into trimmed fields like split_csv(), but returns them as views into
+// its own reusable storage instead of new strings; see split(). Views are valid until the next split().
+
+class SSCSVFields
+{
+protected:
+    
+    vector<char> _text;             // unescaped copy of the line that fields point into
+    vector<size_t> _starts;         // offset of each field in _text; scratch storage for split()
+    vector<SSSpan<char>> _fields;   // trimmed fields
+    
+public:
+    
+    size_t split ( SSSpan<char> csv );
+    size_t split ( const string &csv ) { return split ( SSSpan<char> ( csv.data(), csv.size() ) ); }
+    
+    size_t size ( void ) const { return _fields.size(); }
+    SSSpan<char> operator [] ( size_t i ) const { return i < _fields.size() ? _fields[i] : SSSpan<char>(); }
+    string str ( size_t i ) const { SSSpan<char> f = (*this)[i]; return string ( f.data(), f.size() ); }
+};
+
 int compare ( const string &str1, const string &str2, size_t n, bool casesens = true );
 
 void toLower ( string &str );
@@ -69,6 +154,11 @@ int64_t strtoint64 ( string str );
 float strtofloat ( string str );
 double strtofloat64 ( string str );
 
+int strtoint ( SSSpan<char> str );
+int64_t strtoint64 ( SSSpan<char> str );
+float strtofloat ( SSSpan<char> str );
+double strtofloat64 ( SSSpan<char> str );
+
 double strtodeg ( string str );
 double degtorad ( double deg );
 double radtodeg ( double rad );
@@ -101,4 +191,65 @@ void set_timezonename ( string zonename );
 size_t filesize ( const string &path );
 time_t filetime ( const string &path );
 
+const void *mapfile ( const string &path, size_t &size );
+void unmapfile ( const void *data, size_t size );
+bool fetchfile ( const string &url, vector<char> &bytes );
+
+// Reads a text file line by line, from a memory-mapped file if possible, otherwise in large buffered blocks,
+// instead of one character at a time like fgetline(). Lines may end in LF, CR, or CRLF, as with fgetline(),
+// and line ending characters are discarded; unlike fgetline(), a last line without a line ending is also returned.
+// getline() can return a line as a read-only view into the reader's memory, valid until the next call,
+// without copying it into a string. Files opened by path which are gzip-compressed are decompressed as they are read,
+// on a separate thread if possible (see SSGzipReader).
+
+class SSGzipReader;
+
+class SSLineReader
+{
+protected:
+    
+    FILE *_file;                // file being read in blocks, or nullptr if mapped or not open
+    SSGzipReader *_gzip;        // decompresses gzip file (mapped, or read from _file), or nullptr if not compressed
+    bool _ownFile;              // true if this reader opened the file, and must close it
+    const char *_map;           // memory-mapped file contents, or nullptr if not mapped
+    size_t _mapSize;            // size of memory-mapped file in bytes
+    vector<char> _buffer;       // block read from file
+    const char *_data;          // start of text: mapped file, or buffer
+    size_t _begin, _end;        // offsets to start of unread text and end of valid text
+    bool _eof;                  // true when end of file has been read into buffer
+    bool _skipLF;               // true if last line ended with CR at end of buffer, so a following LF must be skipped
+    
+    void fill ( void );
+    
+public:
+    
+    SSLineReader ( void );
+    SSLineReader ( const string &path );
+    SSLineReader ( FILE *file );
+    SSLineReader ( const SSLineReader &other ) = delete;
+    SSLineReader &operator = ( const SSLineReader &other ) = delete;
+    ~SSLineReader ( void );
+    
+    // Opens a file (path), or reads from a file already opened for reading in binary mode (file),
+    // which this reader does not close. Returns true if successful.
+    
+    bool open ( const string &path );
+    bool open ( FILE *file );
+    
+    // Reads lines from text already in memory (data) of (size) bytes, which this reader does not copy or free;
+    // it must stay valid while the reader is open. Returns true if successful.
+    
+    bool open ( const char *data, size_t size );
+    void close ( void );
+    
+    bool isOpen ( void ) { return _data != nullptr || _file != nullptr; }
+    explicit operator bool ( void ) { return isOpen(); }
+    
+    // Reads the next line into a view (line), or copies it into a string (line).
+    // Returns true if successful or false at end-of-file.
+    
+    bool getline ( SSSpan<char> &line );
+    bool getline ( string &line );
+};
+
 #endif /* SSUtilities_hpp */
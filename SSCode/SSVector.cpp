@@ -131,23 +131,6 @@ SSAngle SSSpherical::positionAngle ( SSSpherical other )
     return SSAngle ( atan2pi ( eta, xi ) );
 }
 
-// Constructs a rectangular coordinate vector at the origin of the coordinate system
-
-SSVector::SSVector ( void )
-{
-    x = y = z = 0.0;
-}
-
-// Constructs a rectangular coordinate vector with X, Y, Z positions relative to
-// the origin of the coordinate system specified in arbitrary units.
-
-SSVector::SSVector ( double x, double y, double z )
-{
-    this->x = x;
-    this->y = y;
-    this->z = z;
-}
-
 // Constructs a rectangular coordinate vector from spherical coordinates.
 // The origin of longitude is along the +X axis, and X/Y plane is the "equator"
 // The origin of latitude is the X/Y plane, and latitude increases with Z.
@@ -161,86 +144,6 @@ SSVector::SSVector ( SSSpherical sph )
     z = sph.rad * sin ( sph.lat );
 }
 
-// Returns this vector's magnitude (length) measured from the origin.
-
-double SSVector::magnitude ( void )
-{
-    return ( sqrt ( x * x + y * y + z * z ) );
-}
-
-// Returns a copy of this vector normalized to unit length, and returns its original magnitude.
-// If the original vector was a zero-length vector, the returned vector will also be zero length.
-// Does not modify this vector!
-
-SSVector SSVector::normalize ( double &mag )
-{
-    mag = magnitude();
-    if ( mag > 0.0 )
-        return divideBy ( mag );
-    else
-        return SSVector ( 0.0, 0.0, 0.0 );
-}
-
-// Returns a copy of this vector normalized to unit length. Does not modify this vector!
-
-SSVector SSVector::normalize ( void )
-{
-    double mag;
-    return normalize ( mag );
-}
-
-
-// Returns a vector which is the sum of this vector with another.
-// This vector is not affected by the addition.
-
-SSVector SSVector::add ( SSVector other )
-{
-    return ( SSVector ( x + other.x, y + other.y, z + other.z ) );
-}
-
-// Returns a vector which is the difference of this vector with another.
-// This vector is not affected by the subtraction.
-
-SSVector SSVector::subtract ( SSVector other )
-{
-    return ( SSVector ( x - other.x, y - other.y, z - other.z ) );
-}
-
-// Returns a copy of this vector multiplied by a scale factor.
-// This vector is not modified by the scaling.
-
-SSVector SSVector::multiplyBy ( double s )
-{
-    return ( SSVector ( x * s, y * s, z * s ) );
-}
-
-// Returns a copy of this vector divided by a scale factor.
-// This vector is not modified by the scaling.
-
-SSVector SSVector::divideBy ( double s )
-{
-    return ( SSVector ( x / s, y / s, z / s ) );
-}
-
-// Returns the dot product of this vector with another vector.
-
-double SSVector::dotProduct ( SSVector other )
-{
-    return ( x * other.x + y * other.y + z * other.z );
-}
-
-// Returns the vector cross product of this vector with another vector.
-// This vector is not modified by the cross product operation.
-
-SSVector SSVector::crossProduct ( SSVector other )
-{
-    double u = y * other.z - z * other.y;
-    double v = z * other.x - x * other.z;
-    double w = x * other.y - y * other.x;
-    
-    return ( SSVector ( u, v, w ) );
-}
-
 // Returns the angular separation in radians from this vector in a rectangular coordinate system
 // to another vector (v) in the same rectangular system, as seen from the origin of the coordinate system.
 // Both vectors must be unit vectors. Formula is accurate for all angles from 0 to kPi radians.
@@ -41,42 +41,44 @@ struct SSSpherical
 };
 
 // Represents a point in a rectangular (x,y,z) coordinate system.
+// Arithmetic is inline and constexpr, so chains like ( v0 + v1 + v2 ) / 3.0 compile to plain
+// arithmetic on doubles with no calls or temporaries left in memory.
 
 struct SSVector
 {
     double x, y, z;    // Point's distance from origin along X, Y, Z axes, in arbitrary units.
 
-    SSVector ( void );
-    SSVector ( double x, double y, double z );
+    constexpr SSVector ( void ) : x ( 0.0 ), y ( 0.0 ), z ( 0.0 ) {}
+    constexpr SSVector ( double x, double y, double z ) : x ( x ), y ( y ), z ( z ) {}
     SSVector ( SSSpherical lbr );
     
-    double magnitude ( void );
-    SSVector normalize ( void );
-    SSVector normalize ( double &magnitude );
-
-    SSVector add ( SSVector other );
-    SSVector subtract ( SSVector other );
-    SSVector multiplyBy ( double s );
-    SSVector divideBy ( double s );
+    double magnitude ( void ) const { return sqrt ( x * x + y * y + z * z ); }
+    SSVector normalize ( void ) const { double mag; return normalize ( mag ); }
+    SSVector normalize ( double &mag ) const { mag = magnitude(); return mag > 0.0 ? divideBy ( mag ) : SSVector ( 0.0, 0.0, 0.0 ); }
+
+    constexpr SSVector add ( SSVector other ) const { return SSVector ( x + other.x, y + other.y, z + other.z ); }
+    constexpr SSVector subtract ( SSVector other ) const { return SSVector ( x - other.x, y - other.y, z - other.z ); }
+    constexpr SSVector multiplyBy ( double s ) const { return SSVector ( x * s, y * s, z * s ); }
+    constexpr SSVector divideBy ( double s ) const { return SSVector ( x / s, y / s, z / s ); }
     
-    double dotProduct ( SSVector other );
-    SSVector crossProduct ( SSVector other );
+    constexpr double dotProduct ( SSVector other ) const { return x * other.x + y * other.y + z * other.z; }
+    constexpr SSVector crossProduct ( SSVector other ) const { return SSVector ( y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x ); }
     
     operator double() { return magnitude(); }
     
-    SSVector operator + ( SSVector other ) { return add ( other ); }
-    SSVector operator - ( SSVector other ) { return subtract ( other ); }
-    double   operator * ( SSVector other ) { return dotProduct ( other ); }
-    SSVector operator * ( double scale )  { return multiplyBy ( scale ); }
-    SSVector operator / ( double scale )  { return divideBy ( scale ); }
-
-    bool operator == ( SSVector other ) { return x == other.x && y == other.y && z == other.z; }
-    bool operator != ( SSVector other ) { return x != other.x || y != other.y || z != other.z; }
+    constexpr SSVector operator + ( SSVector other ) const { return add ( other ); }
+    constexpr SSVector operator - ( SSVector other ) const { return subtract ( other ); }
+    constexpr double   operator * ( SSVector other ) const { return dotProduct ( other ); }
+    constexpr SSVector operator * ( double scale ) const { return multiplyBy ( scale ); }
+    constexpr SSVector operator / ( double scale ) const { return divideBy ( scale ); }
+
+    constexpr bool operator == ( SSVector other ) const { return x == other.x && y == other.y && z == other.z; }
+    constexpr bool operator != ( SSVector other ) const { return x != other.x || y != other.y || z != other.z; }
     
-    void operator += ( SSVector other ) { *this = add ( other ); }
-    void operator -= ( SSVector other ) { *this = subtract ( other ); }
-    void operator *= ( double scale )  { *this = multiplyBy ( scale ); }
-    void operator /= ( double scale )  { *this = divideBy ( scale ); }
+    void operator += ( SSVector other ) { x += other.x; y += other.y; z += other.z; }
+    void operator -= ( SSVector other ) { x -= other.x; y -= other.y; z -= other.z; }
+    void operator *= ( double scale )  { x *= scale; y *= scale; z *= scale; }
+    void operator /= ( double scale )  { x /= scale; y /= scale; z /= scale; }
 
     bool isinf ( void ) { return std::isinf ( x ) || std::isinf ( y ) || std::isinf ( z ); }
     bool isnan ( void ) { return std::isnan ( x ) || std::isnan ( y ) || std::isnan ( z ); }
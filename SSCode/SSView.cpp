@@ -5,6 +5,7 @@
 // Copyright © 2020 Southern Stars. All rights reserved.
 
 #include "SSView.hpp"
+#include "SSInstrument.hpp"
 
 // Default constructor. Creates SSView with Gnonomic projection, and 90-degree field of view
 // spanning 640x480 rectangle centered at (320,240), looking toward celestial coordiantes (0,0).
@@ -275,6 +276,134 @@ SSAngle SSView::getAngularDiagonal ( void )
     return angle;
 }
 
+// View parameters used by the batch projection loops below.
+
+struct SSViewBatchParams
+{
+    SSMatrix m;                                 // celestial to view frame rotation matrix
+    double centerX, centerY, scaleX, scaleY;    // field of view center and scale
+    double left, top, right, bottom;            // field of view bounding rectangle
+    double minDepth;                            // points with view-frame x coordinate <= minDepth are culled
+};
+
+// Projects a point (x,y,z) in the view reference frame to 2D field of view coordinates (px,py)
+// with the same formulas as SSView::project(); one specialization per projection, so the batch loop
+// below contains no per-point projection switch. Formulas are templated on the floating-point type (T),
+// so the float32 batch loop uses them too; with T = double, results are identical to project().
+
+template<SSProjection P> struct SSProjectionFormula;
+
+template<> struct SSProjectionFormula<kGnomonic>
+{
+    template<typename T> static inline void apply ( T cx, T cy, T sx, T sy, T x, T y, T z, T &px, T &py )
+    {
+        px = cx - ( y / x ) / sx;
+        py = cy - ( z / x ) / sy;
+    }
+};
+
+template<> struct SSProjectionFormula<kOrthographic>
+{
+    template<typename T> static inline void apply ( T cx, T cy, T sx, T sy, T x, T y, T z, T &px, T &py )
+    {
+        px = cx - y / sx;
+        py = cy - z / sy;
+    }
+};
+
+template<> struct SSProjectionFormula<kStereographic>
+{
+    template<typename T> static inline void apply ( T cx, T cy, T sx, T sy, T x, T y, T z, T &px, T &py )
+    {
+        px = cx - ( y / ( x + T ( 1 ) ) ) / sx;
+        py = cy - ( z / ( x + T ( 1 ) ) ) / sy;
+    }
+};
+
+template<> struct SSProjectionFormula<kEquirectangular>
+{
+    template<typename T> static inline void apply ( T cx, T cy, T sx, T sy, T x, T y, T z, T &px, T &py )
+    {
+        px = cx - ( x ? atan2 ( y, x ) : y > 0 ? T ( SSAngle::kHalfPi ) : -T ( SSAngle::kHalfPi ) ) / sx;
+        py = cy - asin ( z ) / sy;
+    }
+};
+
+template<> struct SSProjectionFormula<kMercator>
+{
+    template<typename T> static inline void apply ( T cx, T cy, T sx, T sy, T x, T y, T z, T &px, T &py )
+    {
+        T r = sqrt ( ( T ( 1 ) - z ) * ( T ( 1 ) + z ) );
+        px = cx - ( x ? atan2 ( y, x ) : y > 0 ? T ( SSAngle::kHalfPi ) : -T ( SSAngle::kHalfPi ) ) / sx;
+        py = r ? cy - ( z / r ) / sy : z > 0 ? - INFINITY : INFINITY;
+    }
+};
+
+template<> struct SSProjectionFormula<kMollweide>
+{
+    template<typename T> static inline void apply ( T cx, T cy, T sx, T sy, T x, T y, T z, T &px, T &py )
+    {
+        T a = x ? atan2 ( y, x ) : y > 0 ? T ( SSAngle::kHalfPi ) : -T ( SSAngle::kHalfPi );
+        T r = sqrt ( ( T ( 1 ) - z ) * ( T ( 1 ) + z ) );
+        px = cx - a * ( r / sx );
+        py = cy - T ( SSAngle::kHalfPi ) * ( z / sy );
+    }
+};
+
+template<> struct SSProjectionFormula<kSinusoidal>
+{
+    template<typename T> static inline void apply ( T cx, T cy, T sx, T sy, T x, T y, T z, T &px, T &py )
+    {
+        T a = x ? atan2 ( y, x ) : y > 0 ? T ( SSAngle::kHalfPi ) : -T ( SSAngle::kHalfPi );
+        T r = sqrt ( ( T ( 1 ) - z ) * ( T ( 1 ) + z ) );
+        px = cx - ( a * r ) / sx;
+        py = cy - asin ( z ) / sy;
+    }
+};
+
+template<SSProjection P, typename T> static inline void project_point ( T cx, T cy, T sx, T sy, T x, T y, T z, T &px, T &py )
+{
+    SSProjectionFormula<P>::apply ( cx, cy, sx, sy, x, y, z, px, py );
+}
+
+// Projects a point (x,y,z) in the view reference frame which is behind the viewer, for azimuthal projections (P),
+// to infinity on the side of the field of view toward which it lies, with (sx,sy) the view scale, as project() does.
+// Returns false, leaving (px,py) unchanged, if the point is in front, or for projections which map the whole sphere.
+
+template<SSProjection P> static inline bool project_behind ( double sx, double sy, double x, double y, double z, double &px, double &py )
+{
+    return false;
+}
+
+template<> inline bool project_behind<kGnomonic> ( double sx, double sy, double x, double y, double z, double &px, double &py )
+{
+    if ( x > 0.0 )
+        return false;
+    
+    px = y / sx > 0.0 ? -INFINITY : INFINITY;
+    py = z / sx > 0.0 ? -INFINITY : INFINITY;
+    return true;
+}
+
+template<> inline bool project_behind<kOrthographic> ( double sx, double sy, double x, double y, double z, double &px, double &py )
+{
+    if ( x > 0.0 )
+        return false;
+    
+    px = py = INFINITY;
+    return true;
+}
+
+template<> inline bool project_behind<kStereographic> ( double sx, double sy, double x, double y, double z, double &px, double &py )
+{
+    if ( x > -0.9 )
+        return false;
+    
+    px = y / sx > 0.0 ? -INFINITY : INFINITY;
+    py = z / sy > 0.0 ? -INFINITY : INFINITY;
+    return true;
+}
+
 // Projects a vector representing a point on the 3D celestial sphere (cvec)
 // to a point on the 2D field of view (x and y fields of the returned vector).
 // The z field in the returned vector is the depth coordinate: positive if
@@ -283,82 +412,238 @@ SSAngle SSView::getAngularDiagonal ( void )
 // the point (cvec) is located on part of the celestial sphere that cannot be
 // projected onto the rectangular field of view for its current projection.
 
-SSVector SSView::project ( SSVector cvec )
-{
-    cvec = transform ( cvec );
+// The projection (P) is a template parameter, so the formulas are chosen when the caller is compiled.
 
-    double x = cvec.x;
-    double y = cvec.y;
-    double z = cvec.z;
+template<SSProjection P> SSVector SSView::project ( SSVector cvec )
+{
+    static_assert ( P >= kGnomonic && P <= kSinusoidal, "unknown projection" );
+    SS_INSTRUMENT_TIME ( kInstrumentProject );
     
+    cvec = transform ( cvec );
     SSVector vvec = cvec;
+    if ( ! project_behind<P> ( _scaleX, _scaleY, cvec.x, cvec.y, cvec.z, vvec.x, vvec.y ) )
+        project_point<P> ( _centerX, _centerY, _scaleX, _scaleY, cvec.x, cvec.y, cvec.z, vvec.x, vvec.y );
+    
+    vvec.z = cvec.x;
+    return vvec;
+}
+
+template SSVector SSView::project<kGnomonic> ( SSVector cvec );
+template SSVector SSView::project<kOrthographic> ( SSVector cvec );
+template SSVector SSView::project<kStereographic> ( SSVector cvec );
+template SSVector SSView::project<kEquirectangular> ( SSVector cvec );
+template SSVector SSView::project<kMercator> ( SSVector cvec );
+template SSVector SSView::project<kMollweide> ( SSVector cvec );
+template SSVector SSView::project<kSinusoidal> ( SSVector cvec );
+
+// Runtime version of project<P>(), for the view's current projection.
 
+SSVector SSView::project ( SSVector cvec )
+{
     if ( _projection == kGnomonic )
+        return project<kGnomonic> ( cvec );
+    else if ( _projection == kOrthographic )
+        return project<kOrthographic> ( cvec );
+    else if ( _projection == kStereographic )
+        return project<kStereographic> ( cvec );
+    else if ( _projection == kEquirectangular )
+        return project<kEquirectangular> ( cvec );
+    else if ( _projection == kMercator )
+        return project<kMercator> ( cvec );
+    else if ( _projection == kMollweide )
+        return project<kMollweide> ( cvec );
+    else if ( _projection == kSinusoidal )
+        return project<kSinusoidal> ( cvec );
+    
+    SSVector vvec = transform ( cvec );
+    vvec.z = vvec.x;
+    return vvec;
+}
+
+// Batch projection loop for a single projection (P). The depth cull is tested before the rest of
+// the rotation and the projection formulas are evaluated, so culled points cost three multiplies.
+
+template<SSProjection P> static size_t project_batch ( const SSViewBatchParams &p, const SSVector *cvecs, double *x, double *y, size_t n, const bool *mask, bool *visible )
+{
+    size_t count = 0;
+    
+    for ( size_t i = 0; i < n; i++ )
     {
-        if ( cvec.x > 0 )
+        const SSVector &c = cvecs[i];
+        double px = INFINITY, py = INFINITY;
+        double vx = p.m.m00 * c.x + p.m.m01 * c.y + p.m.m02 * c.z;
+        bool vis = vx > p.minDepth && ( mask == nullptr || mask[i] );
+        
+        if ( vis )
         {
-            vvec.x = _centerX - ( y / x ) / _scaleX;
-            vvec.y = _centerY - ( z / x ) / _scaleY;
+            double vy = p.m.m10 * c.x + p.m.m11 * c.y + p.m.m12 * c.z;
+            double vz = p.m.m20 * c.x + p.m.m21 * c.y + p.m.m22 * c.z;
+            project_point<P> ( p.centerX, p.centerY, p.scaleX, p.scaleY, vx, vy, vz, px, py );
+            vis = px > p.left && px < p.right && py > p.top && py < p.bottom;
+            if ( ! vis )
+                px = py = INFINITY;
         }
+        
+        x[i] = px;
+        y[i] = py;
+        if ( visible )
+            visible[i] = vis;
+        count += vis;
+    }
+    
+    return count;
+}
+
+// Projects an array of (n) celestial-frame vectors (cvecs) onto the field of view in one pass.
+// For the azimuthal projections (gnomonic, orthographic, stereographic) points farther from the view
+// center than the corners of the bounding rectangle are culled by depth before projecting them;
+// the cylindrical and pseudo-cylindrical projections can wrap around the whole sky so only the
+// bounding rectangle test applies to them.
+
+static double cull_depth ( SSView &view )
+{
+    SSProjection proj = view.getProjection();
+    double minDepth = -2.0;
+    
+    if ( proj == kGnomonic || proj == kOrthographic || proj == kStereographic )
+    {
+        double radius = view.getAngularDiagonal() / 2.0 + 1.0e-6;
+        minDepth = radius < SSAngle::kPi ? cos ( radius ) : -2.0;
+        if ( proj == kGnomonic || proj == kOrthographic )
+            minDepth = max ( minDepth, 0.0 );
         else
-        {
-            vvec.x = cvec.y / _scaleX > 0.0 ? -INFINITY : INFINITY;
-            vvec.y = cvec.z / _scaleX > 0.0 ? -INFINITY : INFINITY;
-        }
+            minDepth = max ( minDepth, -0.9 );
     }
+    
+    return minDepth;
+}
+
+size_t SSView::projectBatch ( const SSVector *cvecs, double *x, double *y, size_t n, const bool *mask, bool *visible )
+{
+    SS_INSTRUMENT_TIME_N ( kInstrumentProject, n );
+    SSViewBatchParams p = { _matrix, _centerX, _centerY, _scaleX, _scaleY, getLeft(), getTop(), getRight(), getBottom(), cull_depth ( *this ) };
+
+    if ( _projection == kGnomonic )
+        return project_batch<kGnomonic> ( p, cvecs, x, y, n, mask, visible );
     else if ( _projection == kOrthographic )
+        return project_batch<kOrthographic> ( p, cvecs, x, y, n, mask, visible );
+    else if ( _projection == kStereographic )
+        return project_batch<kStereographic> ( p, cvecs, x, y, n, mask, visible );
+    else if ( _projection == kEquirectangular )
+        return project_batch<kEquirectangular> ( p, cvecs, x, y, n, mask, visible );
+    else if ( _projection == kMercator )
+        return project_batch<kMercator> ( p, cvecs, x, y, n, mask, visible );
+    else if ( _projection == kMollweide )
+        return project_batch<kMollweide> ( p, cvecs, x, y, n, mask, visible );
+    else // ( _projection == kSinusoidal )
+        return project_batch<kSinusoidal> ( p, cvecs, x, y, n, mask, visible );
+}
+
+// Single-precision batch projection loop for a single projection (P), with the same culling as project_batch(),
+// for directions as separate float arrays (cx, cy, cz). Float lanes are twice as wide as double lanes.
+
+template<SSProjection P> static size_t project_batch ( const SSViewBatchParams &p, const float *cx, const float *cy, const float *cz, float *x, float *y, size_t n, const bool *mask, bool *visible )
+{
+    const float m00 = p.m.m00, m01 = p.m.m01, m02 = p.m.m02;
+    const float m10 = p.m.m10, m11 = p.m.m11, m12 = p.m.m12;
+    const float m20 = p.m.m20, m21 = p.m.m21, m22 = p.m.m22;
+    const float centerX = p.centerX, centerY = p.centerY, scaleX = p.scaleX, scaleY = p.scaleY;
+    const float left = p.left, top = p.top, right = p.right, bottom = p.bottom, minDepth = p.minDepth;
+    size_t count = 0;
+    
+    for ( size_t i = 0; i < n; i++ )
     {
-        if ( x > 0.0 )
-        {
-            vvec.x = _centerX - y / _scaleX;
-            vvec.y = _centerY - z / _scaleY;
-        }
-        else
+        float px = INFINITY, py = INFINITY;
+        float vx = m00 * cx[i] + m01 * cy[i] + m02 * cz[i];
+        bool vis = vx > minDepth && ( mask == nullptr || mask[i] );
+        
+        if ( vis )
         {
-            vvec.x = vvec.y = INFINITY;
+            float vy = m10 * cx[i] + m11 * cy[i] + m12 * cz[i];
+            float vz = m20 * cx[i] + m21 * cy[i] + m22 * cz[i];
+            project_point<P> ( centerX, centerY, scaleX, scaleY, vx, vy, vz, px, py );
+            vis = px > left && px < right && py > top && py < bottom;
+            if ( ! vis )
+                px = py = INFINITY;
         }
+        
+        x[i] = px;
+        y[i] = py;
+        if ( visible )
+            visible[i] = vis;
+        count += vis;
     }
+    
+    return count;
+}
+
+size_t SSView::projectBatch ( const float *cx, const float *cy, const float *cz, float *x, float *y, size_t n, const bool *mask, bool *visible )
+{
+    SS_INSTRUMENT_TIME_N ( kInstrumentProject, n );
+    SSViewBatchParams p = { _matrix, _centerX, _centerY, _scaleX, _scaleY, getLeft(), getTop(), getRight(), getBottom(), cull_depth ( *this ) };
+    
+    if ( _projection == kGnomonic )
+        return project_batch<kGnomonic> ( p, cx, cy, cz, x, y, n, mask, visible );
+    else if ( _projection == kOrthographic )
+        return project_batch<kOrthographic> ( p, cx, cy, cz, x, y, n, mask, visible );
     else if ( _projection == kStereographic )
+        return project_batch<kStereographic> ( p, cx, cy, cz, x, y, n, mask, visible );
+    else if ( _projection == kEquirectangular )
+        return project_batch<kEquirectangular> ( p, cx, cy, cz, x, y, n, mask, visible );
+    else if ( _projection == kMercator )
+        return project_batch<kMercator> ( p, cx, cy, cz, x, y, n, mask, visible );
+    else if ( _projection == kMollweide )
+        return project_batch<kMollweide> ( p, cx, cy, cz, x, y, n, mask, visible );
+    else // ( _projection == kSinusoidal )
+        return project_batch<kSinusoidal> ( p, cx, cy, cz, x, y, n, mask, visible );
+}
+
+// Azimuthal projections use the per-projection formulas for points in front of the viewer,
+// and project() for points behind, which it maps to infinity.
+
+template<SSProjection P> static void project_all ( SSView &view, const SSViewBatchParams &p, const SSVector *cvecs, SSVector *vvecs, size_t n )
+{
+    for ( size_t i = 0; i < n; i++ )
     {
-        if ( cvec.x > -0.9 )
+        const SSVector &c = cvecs[i];
+        double vx = p.m.m00 * c.x + p.m.m01 * c.y + p.m.m02 * c.z;
+        if ( vx > p.minDepth )
         {
-            vvec.x = _centerX - ( cvec.y / ( cvec.x + 1.0 ) ) / _scaleX;
-            vvec.y = _centerY - ( cvec.z / ( cvec.x + 1.0 ) ) / _scaleY;
+            double vy = p.m.m10 * c.x + p.m.m11 * c.y + p.m.m12 * c.z;
+            double vz = p.m.m20 * c.x + p.m.m21 * c.y + p.m.m22 * c.z;
+            project_point<P> ( p.centerX, p.centerY, p.scaleX, p.scaleY, vx, vy, vz, vvecs[i].x, vvecs[i].y );
+            vvecs[i].z = vx;
         }
         else
         {
-            vvec.x = cvec.y / _scaleX > 0.0 ? -INFINITY : INFINITY;
-            vvec.y = cvec.z / _scaleY > 0.0 ? -INFINITY : INFINITY;
+            vvecs[i] = view.project<P> ( c );
         }
     }
+}
+
+void SSView::projectBatch ( const SSVector *cvecs, SSVector *vvecs, size_t n )
+{
+    SS_INSTRUMENT_TIME_N ( kInstrumentProject, n );
+    SSViewBatchParams p = { _matrix, _centerX, _centerY, _scaleX, _scaleY, getLeft(), getTop(), getRight(), getBottom(), -2.0 };
+    if ( _projection == kGnomonic || _projection == kOrthographic )
+        p.minDepth = 0.0;
+    else if ( _projection == kStereographic )
+        p.minDepth = -0.9;
+
+    if ( _projection == kGnomonic )
+        project_all<kGnomonic> ( *this, p, cvecs, vvecs, n );
+    else if ( _projection == kOrthographic )
+        project_all<kOrthographic> ( *this, p, cvecs, vvecs, n );
+    else if ( _projection == kStereographic )
+        project_all<kStereographic> ( *this, p, cvecs, vvecs, n );
     else if ( _projection == kEquirectangular )
-    {
-        vvec.x = _centerX - ( x ? atan2 ( y, x ) : y > 0 ? SSAngle::kHalfPi : -SSAngle::kHalfPi ) / _scaleX;
-        vvec.y = _centerY - asin ( z ) / _scaleY;
-    }
+        project_all<kEquirectangular> ( *this, p, cvecs, vvecs, n );
     else if ( _projection == kMercator )
-    {
-        double r = sqrt ( ( 1.0 - z ) * ( 1.0 + z ) );
-        vvec.x = _centerX - ( x ? atan2 ( y, x ) : y > 0 ? SSAngle::kHalfPi : -SSAngle::kHalfPi ) / _scaleX;
-        vvec.y = r ? _centerY - ( z / r ) / _scaleY : z > 0 ? - INFINITY : INFINITY;
-    }
+        project_all<kMercator> ( *this, p, cvecs, vvecs, n );
     else if ( _projection == kMollweide )
-    {
-        double a = x ? atan2 ( y, x ) : y > 0 ? SSAngle::kHalfPi : -SSAngle::kHalfPi;
-        double r = sqrt ( ( 1.0 - z ) * ( 1.0 + z ) );
-        vvec.x = _centerX - a * ( r / _scaleX );
-        vvec.y = _centerY - SSAngle::kHalfPi * ( z / _scaleY );
-    }
-    else if ( _projection == kSinusoidal )
-    {
-        double a = x ? atan2 ( y, x ) : y > 0 ? SSAngle::kHalfPi : -SSAngle::kHalfPi;
-        double r = sqrt ( ( 1.0 - z ) * ( 1.0 + z ) );
-        vvec.x = _centerX - ( a * r ) / _scaleX;
-        vvec.y = _centerY - asin ( z ) / _scaleY;
-    }
-    
-    vvec.z = x;
-    return vvec;
+        project_all<kMollweide> ( *this, p, cvecs, vvecs, n );
+    else // ( _projection == kSinusoidal )
+        project_all<kSinusoidal> ( *this, p, cvecs, vvecs, n );
 }
 
 // Projects a vector representing a point on the 2D field of view (vvec)
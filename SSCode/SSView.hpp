@@ -103,7 +103,31 @@ public:
     
     SSVector project ( SSVector cvec );
     SSVector unproject ( SSVector vvec );
-    
+
+    // Compile-time version of project() for a projection known when the caller is compiled, e.g. project<kGnomonic> ( cvec ),
+    // with no branching on projection; results are identical. It's instantiated for every SSProjection in SSView.cpp.
+
+    template<SSProjection P> SSVector project ( SSVector cvec );
+
+    // Batch version of project(), which projects (n) celestial-frame vectors (cvecs) onto the field of view,
+    // storing their 2D coordinates in (x) and (y). If (mask) is not null, points whose mask entry is false are skipped.
+    // Points outside the cone circumscribing the field of view are culled before projection. Points which are skipped,
+    // culled, or fall outside the bounding rectangle have (x,y) set to infinity and (visible) entry set to false
+    // if (visible) is not null. Visible points have the same (x,y) as project(). Returns number of visible points.
+
+    size_t projectBatch ( const SSVector *cvecs, double *x, double *y, size_t n, const bool *mask = nullptr, bool *visible = nullptr );
+
+    // Single-precision version of the culling projectBatch() above, for display-only directions given as separate float
+    // arrays (cx, cy, cz), e.g. from SSStarTable's float32 computeEphemeris(). The view matrix, center, and scale are
+    // rounded to float, so positions agree with project() to about 1.0e-7 of the field of view, well under a pixel.
+
+    size_t projectBatch ( const float *cx, const float *cy, const float *cz, float *x, float *y, size_t n, const bool *mask = nullptr, bool *visible = nullptr );
+
+    // Batch version of project() without culling, which projects (n) celestial-frame vectors (cvecs) to (vvecs),
+    // exactly as project() does, including depth and points off the view; e.g. for lines which must be clipped.
+
+    void projectBatch ( const SSVector *cvecs, SSVector *vvecs, size_t n );
+
     SSVector transform ( SSVector cvec ) { return _matrix * cvec; }
     SSVector untransform ( SSVector vvec ) { return _matrix.transpose() * vvec; }
 
@@ -0,0 +1,486 @@
+// SSWarmStart.cpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+#include "SSWarmStart.hpp"
+
+// Fixed-size map section entries. Strings are offsets into the string data following the entries.
+
+struct ValueEntry
+{
+    int64_t key;                    // identifier, or string offset
+    int64_t value;                  // object index, identifier, string offset, or feature offset
+};
+
+struct LocEntry
+{
+    int64_t key;                    // identifier, or string offset
+    uint64_t region;                // HTM region ID
+    uint64_t offset;                // offset of object in region
+};
+
+struct FoldedEntry
+{
+    uint64_t folded;                // string offset of case-folded name
+    uint64_t name;                  // string offset of name
+    uint64_t region;                // HTM region ID
+    uint64_t offset;                // offset of object in region
+};
+
+// Accumulates a map section: entries, then string data, storing each distinct string once.
+
+template<class E> class SectionWriter
+{
+public:
+
+    vector<E> entries;
+    string strings;
+    unordered_map<string,uint64_t> offsets;
+
+    uint64_t add ( const string &str )
+    {
+        auto it = offsets.find ( str );
+        if ( it != offsets.end() )
+            return it->second;
+
+        uint64_t offset = strings.size();
+        strings.append ( str.c_str(), str.size() + 1 );
+        offsets[str] = offset;
+        return offset;
+    }
+
+    vector<char> data ( void )
+    {
+        vector<char> bytes ( entries.size() * sizeof ( E ) + strings.size() );
+        if ( entries.size() > 0 )
+            memcpy ( bytes.data(), entries.data(), entries.size() * sizeof ( E ) );
+        if ( strings.size() > 0 )
+            memcpy ( bytes.data() + entries.size() * sizeof ( E ), strings.data(), strings.size() );
+        return bytes;
+    }
+};
+
+// Reads a map section's entries and strings in place. Interns each distinct string once; the string pool
+// returns the same handle for equal strings, so this only saves hashing a string again.
+
+template<class E> class SectionReader
+{
+public:
+
+    const E *entries;
+    size_t count;
+    const char *strings;
+    size_t stringSize;
+    unordered_map<uint64_t,SSIString> interned;
+
+    SectionReader ( const char *data, const SSWarmStartSection *section )
+    {
+        entries = (const E *) ( data + section->offset );
+        count = section->count;
+        strings = data + section->offset + count * sizeof ( E );
+        stringSize = section->size - count * sizeof ( E );
+    }
+
+    // Returns string at offset, or empty string if offset is outside string data or its string is not terminated.
+
+    const char *get ( uint64_t offset )
+    {
+        if ( offset >= stringSize || memchr ( strings + offset, 0, stringSize - offset ) == nullptr )
+            return "";
+        return strings + offset;
+    }
+
+    SSIString intern ( uint64_t offset )
+    {
+        auto it = interned.find ( offset );
+        if ( it != interned.end() )
+            return it->second;
+
+        SSIString str ( get ( offset ) );
+        interned.insert ( { offset, str } );
+        return str;
+    }
+};
+
+SSWarmStart::SSWarmStart ( void )
+{
+    _map = nullptr;
+    _mapSize = 0;
+    _data = nullptr;
+    _header = nullptr;
+    _sections = nullptr;
+}
+
+SSWarmStart::~SSWarmStart ( void )
+{
+    close();
+}
+
+bool SSWarmStart::addSection ( const string &name, SectionType type, int param, uint64_t count, vector<char> &data )
+{
+    SSWarmStartSection info = { { 0 } };
+    if ( name.size() >= sizeof ( info.name ) )
+        return false;
+
+    for ( Pending &pending : _pending )
+        if ( pending.info.type == type && pending.info.param == param && name == pending.info.name )
+            return false;
+
+    strncpy ( info.name, name.c_str(), sizeof ( info.name ) - 1 );
+    info.type = type;
+    info.param = param;
+    info.size = data.size();
+    info.count = count;
+
+    _pending.push_back ( Pending() );
+    _pending.back().info = info;
+    _pending.back().data.swap ( data );
+    return true;
+}
+
+bool SSWarmStart::addObjects ( const string &name, SSObjectArray &objects )
+{
+    vector<char> bytes;
+    int n = SSExportObjectsToBinary ( bytes, objects );
+    return addSection ( name, kObjects, 0, n, bytes );
+}
+
+bool SSWarmStart::addObjectMap ( const string &name, SSObjectMap &map )
+{
+    SectionWriter<ValueEntry> writer;
+    writer.entries.reserve ( map.size() );
+    for ( auto &entry : map )
+        writer.entries.push_back ( { (int64_t) entry.first, entry.second } );
+
+    vector<char> data = writer.data();
+    return addSection ( name, kObjectMap, 0, writer.entries.size(), data );
+}
+
+bool SSWarmStart::addIdentifierNameMap ( const string &name, SSIdentifierNameMap &map )
+{
+    SectionWriter<ValueEntry> writer;
+    writer.entries.reserve ( map.size() );
+    for ( auto &entry : map )
+        writer.entries.push_back ( { (int64_t) entry.first, (int64_t) writer.add ( entry.second ) } );
+
+    vector<char> data = writer.data();
+    return addSection ( name, kIdentifierNameMap, 0, writer.entries.size(), data );
+}
+
+bool SSWarmStart::addPlanetFeatureMap ( const string &name, SSPlanetFeatureMap &map )
+{
+    SectionWriter<ValueEntry> writer;
+    for ( auto &entry : map )
+        writer.entries.push_back ( { (int64_t) writer.add ( entry.first ), entry.second } );
+
+    vector<char> data = writer.data();
+    return addSection ( name, kPlanetFeatureMap, 0, writer.entries.size(), data );
+}
+
+// Stores the name index and case-folded name index as one section each, and each catalog's identifier index
+// as a section with the catalog as its parameter.
+
+bool SSWarmStart::addHTMIndexes ( const string &name, SSHTM &htm )
+{
+    bool ok = true;
+    for ( auto &index : *htm.getIdentIndex() )
+    {
+        if ( index.first == kCatUnknown || index.second->empty() )
+            continue;
+
+        SectionWriter<LocEntry> writer;
+        writer.entries.reserve ( index.second->size() );
+        for ( auto &entry : *index.second )
+            writer.entries.push_back ( { (int64_t) entry.first, entry.second.region, entry.second.offset } );
+
+        vector<char> data = writer.data();
+        ok = addSection ( name, kHTMIdentIndex, index.first, writer.entries.size(), data ) && ok;
+    }
+
+    shared_ptr<const SSHTM::NameMap> nameIndex = htm.getNameIndex();
+    shared_ptr<const SSHTM::FoldedNameMap> foldedIndex = htm.getFoldedNameIndex();
+    if ( ! nameIndex->empty() )
+    {
+        SectionWriter<LocEntry> writer;
+        writer.entries.reserve ( nameIndex->size() );
+        for ( auto &entry : *nameIndex )
+            writer.entries.push_back ( { (int64_t) writer.add ( entry.first ), entry.second.region, entry.second.offset } );
+
+        vector<char> data = writer.data();
+        ok = addSection ( name, kHTMNameIndex, 0, writer.entries.size(), data ) && ok;
+
+        SectionWriter<FoldedEntry> folded;
+        folded.entries.reserve ( foldedIndex->size() );
+        for ( auto &entry : *foldedIndex )
+            folded.entries.push_back ( { folded.add ( entry.first ), folded.add ( entry.second.name ), entry.second.loc.region, entry.second.loc.offset } );
+
+        data = folded.data();
+        ok = addSection ( name, kHTMFoldedNameIndex, 0, folded.entries.size(), data ) && ok;
+    }
+
+    return ok;
+}
+
+// Writes header, section table, then section data, each section padded to an 8-byte boundary.
+
+bool SSWarmStart::save ( const string &path, uint64_t dataVersion )
+{
+    SSWarmStartHeader header = { { 0 } };
+    memcpy ( header.magic, kWarmStartMagic, sizeof ( header.magic ) );
+    header.version = kWarmStartVersion;
+    header.byteOrder = kWarmStartByteOrder;
+    header.dataVersion = dataVersion;
+    header.numSections = (uint32_t) _pending.size();
+    header.sectionOffset = sizeof ( header );
+
+    uint64_t offset = header.sectionOffset + _pending.size() * sizeof ( SSWarmStartSection );
+    for ( Pending &pending : _pending )
+    {
+        pending.info.offset = offset;
+        offset += ( pending.info.size + 7 ) & ~7ULL;
+    }
+    header.fileSize = offset;
+
+    string temp = path + ".tmp";
+    FILE *file = fopen ( temp.c_str(), "wb" );
+    if ( file == nullptr )
+        return false;
+
+    static const char padding[8] = { 0 };
+    bool ok = fwrite ( &header, sizeof ( header ), 1, file ) == 1;
+    for ( Pending &pending : _pending )
+        ok = ok && fwrite ( &pending.info, sizeof ( pending.info ), 1, file ) == 1;
+    for ( Pending &pending : _pending )
+    {
+        size_t size = pending.data.size();
+        ok = ok && ( size == 0 || fwrite ( pending.data.data(), size, 1, file ) == 1 );
+        ok = ok && ( size % 8 == 0 || fwrite ( padding, 8 - size % 8, 1, file ) == 1 );
+    }
+
+    ok = fclose ( file ) == 0 && ok;
+    remove ( path.c_str() );
+    ok = ok && rename ( temp.c_str(), path.c_str() ) == 0;
+    if ( ! ok )
+        remove ( temp.c_str() );
+
+    _pending.clear();
+    return ok;
+}
+
+bool SSWarmStart::open ( const string &path, uint64_t dataVersion )
+{
+    close();
+
+    _map = (const char *) mapfile ( path, _mapSize );
+    if ( _map != nullptr )
+    {
+        if ( validate ( _map, _mapSize, dataVersion ) )
+            return true;
+
+        close();
+        return false;
+    }
+
+    // Read into memory where files can't be mapped. A vector<char>'s data is allocated by operator new,
+    // so it is aligned for any fundamental type, as section data must be.
+
+    if ( ! fetchfile ( path, _buffer ) || ! validate ( _buffer.data(), _buffer.size(), dataVersion ) )
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void SSWarmStart::close ( void )
+{
+    unmapfile ( _map, _mapSize );
+    _map = nullptr;
+    _mapSize = 0;
+    _buffer.clear();
+    _buffer.shrink_to_fit();
+    _data = nullptr;
+    _header = nullptr;
+    _sections = nullptr;
+}
+
+// Checks that an image in memory (data) of (size) bytes has a valid header for this version and byte order, and the
+// expected data version (dataVersion), and that its section table and every section are inside it and aligned.
+
+bool SSWarmStart::validate ( const char *data, size_t size, uint64_t dataVersion )
+{
+    if ( size < sizeof ( SSWarmStartHeader ) )
+        return false;
+
+    const SSWarmStartHeader *header = (const SSWarmStartHeader *) data;
+    if ( memcmp ( header->magic, kWarmStartMagic, sizeof ( header->magic ) ) != 0 )
+        return false;
+
+    if ( header->version != kWarmStartVersion || header->byteOrder != kWarmStartByteOrder )
+        return false;
+
+    if ( header->dataVersion != dataVersion || header->fileSize != size )
+        return false;
+
+    if ( header->sectionOffset % 8 != 0 || header->sectionOffset > size
+        || header->numSections > ( size - header->sectionOffset ) / sizeof ( SSWarmStartSection ) )
+        return false;
+
+    const SSWarmStartSection *sections = (const SSWarmStartSection *) ( data + header->sectionOffset );
+    for ( uint32_t i = 0; i < header->numSections; i++ )
+    {
+        const SSWarmStartSection &section = sections[i];
+        if ( section.offset % 8 != 0 || section.offset > size || section.size > size - section.offset )
+            return false;
+
+        if ( memchr ( section.name, 0, sizeof ( section.name ) ) == nullptr )
+            return false;
+
+        size_t entrySize = 0;
+        if ( section.type == kObjectMap || section.type == kIdentifierNameMap || section.type == kPlanetFeatureMap )
+            entrySize = sizeof ( ValueEntry );
+        else if ( section.type == kHTMIdentIndex || section.type == kHTMNameIndex )
+            entrySize = sizeof ( LocEntry );
+        else if ( section.type == kHTMFoldedNameIndex )
+            entrySize = sizeof ( FoldedEntry );
+
+        if ( entrySize > 0 && section.count > section.size / entrySize )
+            return false;
+    }
+
+    _data = data;
+    _header = header;
+    _sections = sections;
+    return true;
+}
+
+const SSWarmStartSection *SSWarmStart::findSection ( const string &name, SectionType type, int param )
+{
+    for ( uint32_t i = 0; i < numSections(); i++ )
+        if ( _sections[i].type == type && _sections[i].param == param && name == _sections[i].name )
+            return _sections + i;
+
+    return nullptr;
+}
+
+bool SSWarmStart::getCatalog ( const string &name, SSBinaryCatalog &catalog )
+{
+    const SSWarmStartSection *section = findSection ( name, kObjects );
+    if ( section == nullptr )
+        return false;
+
+    return catalog.open ( _data + section->offset, section->size );
+}
+
+int SSWarmStart::getObjects ( const string &name, SSObjectArray &objects )
+{
+    SSBinaryCatalog catalog;
+    if ( ! getCatalog ( name, catalog ) )
+        return 0;
+
+    return catalog.materialize ( objects );
+}
+
+// Map entries were saved in sorted order, so inserting them in the same order leaves the map sorted.
+
+bool SSWarmStart::getObjectMap ( const string &name, SSObjectMap &map )
+{
+    const SSWarmStartSection *section = findSection ( name, kObjectMap );
+    if ( section == nullptr )
+        return false;
+
+    SectionReader<ValueEntry> reader ( _data, section );
+    map.clear();
+    map.reserve ( reader.count );
+    for ( size_t i = 0; i < reader.count; i++ )
+        map.insert ( { SSIdentifier ( reader.entries[i].key ), (int) reader.entries[i].value } );
+
+    return true;
+}
+
+bool SSWarmStart::getIdentifierNameMap ( const string &name, SSIdentifierNameMap &map )
+{
+    const SSWarmStartSection *section = findSection ( name, kIdentifierNameMap );
+    if ( section == nullptr )
+        return false;
+
+    SectionReader<ValueEntry> reader ( _data, section );
+    map.clear();
+    map.reserve ( reader.count );
+    for ( size_t i = 0; i < reader.count; i++ )
+        map.insert ( { SSIdentifier ( reader.entries[i].key ), reader.intern ( reader.entries[i].value ) } );
+
+    return true;
+}
+
+bool SSWarmStart::getPlanetFeatureMap ( const string &name, SSPlanetFeatureMap &map )
+{
+    const SSWarmStartSection *section = findSection ( name, kPlanetFeatureMap );
+    if ( section == nullptr )
+        return false;
+
+    SectionReader<ValueEntry> reader ( _data, section );
+    map.clear();
+    for ( size_t i = 0; i < reader.count; i++ )
+        map.insert ( map.end(), { reader.get ( reader.entries[i].key ), (int) reader.entries[i].value } );
+
+    return true;
+}
+
+bool SSWarmStart::getHTMIndexes ( const string &name, SSHTM &htm )
+{
+    bool found = false;
+    for ( uint32_t i = 0; i < numSections(); i++ )
+    {
+        const SSWarmStartSection *section = _sections + i;
+        if ( section->type != kHTMIdentIndex || name != section->name )
+            continue;
+
+        SectionReader<LocEntry> reader ( _data, section );
+        SSHTM::IdentMap map;
+        map.reserve ( reader.count );
+        for ( size_t k = 0; k < reader.count; k++ )
+            map.insert ( { SSIdentifier ( reader.entries[k].key ), { reader.entries[k].region, (size_t) reader.entries[k].offset } } );
+
+        htm.publishIdentMap ( (SSCatalog) section->param, map );
+        found = true;
+    }
+
+    const SSWarmStartSection *section = findSection ( name, kHTMNameIndex );
+    if ( section != nullptr )
+    {
+        SectionReader<LocEntry> reader ( _data, section );
+        SSHTM::NameMap map;
+        map.reserve ( reader.count );
+        for ( size_t k = 0; k < reader.count; k++ )
+            map.insert ( { reader.intern ( reader.entries[k].key ), { reader.entries[k].region, (size_t) reader.entries[k].offset } } );
+
+        // The case-folded names are plain strings; their original names are interned strings, which are already
+        // in the pool after restoring the name index. Without them, publishing the name index builds them.
+
+        SSHTM::FoldedNameMap folded;
+        const SSWarmStartSection *foldedSection = findSection ( name, kHTMFoldedNameIndex );
+        if ( foldedSection != nullptr )
+        {
+            SectionReader<FoldedEntry> foldedReader ( _data, foldedSection );
+            folded.reserve ( foldedReader.count );
+            for ( size_t k = 0; k < foldedReader.count; k++ )
+            {
+                const FoldedEntry &entry = foldedReader.entries[k];
+                folded.insert ( { foldedReader.get ( entry.folded ), { foldedReader.intern ( entry.name ), { entry.region, (size_t) entry.offset } } } );
+            }
+        }
+
+        htm.publishNameIndex ( map, foldedSection ? &folded : nullptr );
+        found = true;
+    }
+
+    return found;
+}
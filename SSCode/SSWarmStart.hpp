@@ -0,0 +1,147 @@
+// SSWarmStart.hpp
+// SSCore
+//
+// Created by Tim DeBenedictis on 10/15/26.
+// Copyright © 2026 Southern Stars. All rights reserved.
+//
+// A warm-start image: a snapshot of the library state an app builds at startup - object arrays imported from CSV
+// catalogs, SSObjectMaps, SSIdentifierNameMaps, SSPlanetFeatureMaps, and SSHTM name and identifier indexes - saved in
+// one versioned binary file, so later launches can restore it instead of parsing catalogs and rebuilding maps.
+// The image is a table of named sections. Object arrays are stored as binary catalogs (see SSBinaryCatalog), which are
+// read in place from the memory-mapped image, and materialized only on request. Maps are stored as arrays of fixed-size
+// entries, already sorted, with strings in a table after them; restoring a map copies its entries in order, so it
+// is never re-sorted, and replaces each string offset with an interned string (SSIString). An image is rejected when
+// opened if it was written by a different format version or byte order, or for a different data version: a number the
+// app chooses, e.g. its build number or a hash of its catalog files (see SSCatalogBuild::hashFile()), so it falls back
+// to a cold start whenever its catalogs change. VSOP2013 and ELP/MPP02 series are not stored; they are compiled in,
+// and packed on first use of each planet (see VSOP2013), which costs less than reading them from an image.
+
+#ifndef SSWarmStart_hpp
+#define SSWarmStart_hpp
+
+#include "SSBinaryCatalog.hpp"
+#include "SSFeature.hpp"
+#include "SSHTM.hpp"
+
+#pragma pack ( push, 1 )
+
+// Warm-start image file header. Values are stored in the byte order of the computer which wrote the file;
+// files with a different byte order are rejected. All offsets are from the start of the file.
+
+struct SSWarmStartHeader
+{
+    char     magic[8];              // kWarmStartMagic
+    uint32_t version;               // kWarmStartVersion
+    uint32_t byteOrder;             // kWarmStartByteOrder, as written by this computer
+    uint64_t dataVersion;           // data version given when image was saved
+    uint32_t numSections;           // number of sections in section table
+    uint32_t reserved;              // always zero
+    uint64_t sectionOffset;         // offset to section table
+    uint64_t fileSize;              // total size of file in bytes
+};
+
+// Section table entry. Section data starts on an 8-byte boundary. Map sections contain (count) entries,
+// then string data: UTF-8 text, each string followed by a NUL, at offsets given by the entries.
+
+struct SSWarmStartSection
+{
+    char     name[48];              // section name, NUL-terminated
+    uint32_t type;                  // section type (SSWarmStart::SectionType)
+    int32_t  param;                 // catalog (SSCatalog) of HTM identifier index sections, otherwise zero
+    uint64_t offset;                // offset to section data
+    uint64_t size;                  // size of section data in bytes
+    uint64_t count;                 // number of entries; number of objects for object sections
+};
+
+#pragma pack ( pop )
+
+constexpr char kWarmStartMagic[8] = { 'S', 'S', 'W', 'A', 'R', 'M', 'S', 'T' };
+constexpr uint32_t kWarmStartVersion = 1;
+constexpr uint32_t kWarmStartByteOrder = 0x01020304;
+
+class SSWarmStart
+{
+public:
+
+    enum SectionType
+    {
+        kObjects = 1,               // binary catalog
+        kObjectMap = 2,             // SSObjectMap
+        kIdentifierNameMap = 3,     // SSIdentifierNameMap
+        kPlanetFeatureMap = 4,      // SSPlanetFeatureMap
+        kHTMIdentIndex = 5,         // SSHTM identifier index for one catalog
+        kHTMNameIndex = 6,          // SSHTM name index
+        kHTMFoldedNameIndex = 7     // SSHTM case-folded name index
+    };
+
+protected:
+
+    struct Pending
+    {
+        SSWarmStartSection info;                // section table entry; offset is set when saved
+        vector<char> data;                      // section data
+    };
+
+    vector<Pending> _pending;                   // sections added since last save
+
+    const char *_map;                           // memory-mapped image, or nullptr if not mapped
+    size_t _mapSize;                            // size of memory-mapped image in bytes
+    vector<char> _buffer;                       // entire image, if it could not be memory-mapped
+    const char *_data;                          // start of open image, or nullptr if not open
+    const SSWarmStartHeader *_header;           // image header, or nullptr if not open
+    const SSWarmStartSection *_sections;        // section table
+
+    bool addSection ( const string &name, SectionType type, int param, uint64_t count, vector<char> &data );
+    const SSWarmStartSection *findSection ( const string &name, SectionType type, int param = 0 );
+    bool validate ( const char *data, size_t size, uint64_t dataVersion );
+
+public:
+
+    SSWarmStart ( void );
+    SSWarmStart ( const SSWarmStart &other ) = delete;
+    SSWarmStart &operator = ( const SSWarmStart &other ) = delete;
+    ~SSWarmStart ( void );
+
+    // Adds a snapshot of an object array, SSObjectMap, SSIdentifierNameMap, SSPlanetFeatureMap, or SSHTM's name,
+    // case-folded name, and identifier indexes, as a section named (name), to be written by save(). Names must be
+    // unique for each kind of section, and shorter than 48 bytes; returns false if not. Object arrays are stored as
+    // SSExportObjectsToBinary() stores them, without satellites; object maps are stored as given, so they should
+    // index arrays without satellites, or they won't match the arrays restored.
+
+    bool addObjects ( const string &name, SSObjectArray &objects );
+    bool addObjectMap ( const string &name, SSObjectMap &map );
+    bool addIdentifierNameMap ( const string &name, SSIdentifierNameMap &map );
+    bool addPlanetFeatureMap ( const string &name, SSPlanetFeatureMap &map );
+    bool addHTMIndexes ( const string &name, SSHTM &htm );
+
+    // Writes sections added since the last save to an image file (path), tagged with (dataVersion), via a temporary
+    // file, so a failed save never leaves a partial image; then discards them. Returns false on failure.
+
+    bool save ( const string &path, uint64_t dataVersion );
+
+    // Opens an image file (path), memory-mapped if possible; any image already open is closed first.
+    // Returns false if it can't be read, or is not a valid image of this format version and byte order
+    // saved with the same data version (dataVersion).
+
+    bool open ( const string &path, uint64_t dataVersion );
+    void close ( void );
+    bool isOpen ( void ) { return _header != nullptr; }
+    size_t numSections ( void ) { return _header ? _header->numSections : 0; }
+
+    // Opens the object section named (name) as a binary catalog (catalog), read in place from the image;
+    // it is valid until the catalog or this image is closed. Or materializes all of its objects, appending them to
+    // (objects), and returns the number appended. Both fail (returning false or zero) if there is no such section.
+
+    bool getCatalog ( const string &name, SSBinaryCatalog &catalog );
+    int getObjects ( const string &name, SSObjectArray &objects );
+
+    // Restores a map, or an SSHTM's indexes, from the section(s) named (name), replacing their contents.
+    // Returns false, leaving the destination unchanged, if there is no such section.
+
+    bool getObjectMap ( const string &name, SSObjectMap &map );
+    bool getIdentifierNameMap ( const string &name, SSIdentifierNameMap &map );
+    bool getPlanetFeatureMap ( const string &name, SSPlanetFeatureMap &map );
+    bool getHTMIndexes ( const string &name, SSHTM &htm );
+};
+
+#endif /* SSWarmStart_hpp */
@@ -12,6 +12,8 @@
 #include <string>
 
 #include "../SSCoordinates.hpp"
+#include "../SSInstrument.hpp"
+#include "../SSTrig.hpp"
 #include "ELPMPP02.hpp"
 
 #define PRINT_SERIES 0  // 1 to convert input ELPMPP02 series data files to output .cpp source code
@@ -20,7 +22,7 @@
 
 #if ELPMPP02_EMBED_SERIES
 
-static const ELPMainSeries _lon_main = { 1, 204, {
+static constexpr ELPMainTerm _lon_main_terms[] = {
 {   0,   0,   1,   0,   22639.55000,         0.00,         0.00,    412529.62,         0.00,         0.00,         0.00 },
 {   2,   0,  -1,   0,    4586.43061,     87132.46,      -842.12,     83586.18,      -191.17,        20.31,        -0.17 },
 {   2,   0,   0,   0,    2369.91227,     69551.14,     -1472.50,     10817.07,      -255.36,        22.07,        -0.15 },
@@ -225,9 +227,11 @@ static const ELPMainSeries _lon_main = { 1, 204, {
 {   1,   0,   2,  -1,      -0.01483,        -0.72,         0.03,        -0.56,        -0.89,        -5.77,         0.03 },
 {   6,   0,  -4,   0,       0.01376,         0.88,         0.00,         1.00,         0.00,         0.00,         0.00 },
 {   2,   4,   0,   0,       0.01372,         0.35,         1.22,         0.21,         0.00,         0.00,         0.00 }
-} };
+};
+
+static constexpr ELPMainSeries _lon_main = { 1, 204, _lon_main_terms };
 
-static const ELPMainSeries _lat_main = { 2, 183, {
+static constexpr ELPMainTerm _lat_main_terms[] = {
 {   0,   1,   0,   0,   18461.40000,         0.00,    412529.62,         0.00,         0.00,         0.00,         0.00 },
 {   0,   1,   1,   0,    1010.17430,       -93.16,     22571.83,     18386.36,        -0.76,        -0.17,         0.00 },
 {   0,  -1,   1,   0,     999.70079,      -563.82,     22508.54,     18298.82,        -0.92,        -0.21,         0.00 },
@@ -411,9 +415,11 @@ static const ELPMainSeries _lat_main = { 2, 183, {
 {   6,  -1,  -2,  -1,       0.01091,         0.59,         0.24,         0.40,         0.65,         0.00,         0.00 },
 {   5,  -1,  -1,   0,      -0.01049,        -0.54,        -0.24,        -0.22,         0.01,        -4.08,         0.02 },
 {   2,   1,  -1,  -3,       0.01042,         0.25,         0.23,         0.19,         1.87,         0.00,         0.00 }
-} };
+};
 
-static const ELPMainSeries _dist_main = { 3, 140, {
+static constexpr ELPMainSeries _lat_main = { 2, 183, _lat_main_terms };
+
+static constexpr ELPMainTerm _dist_main_terms[] = {
 {   0,   0,   0,   0,  385000.52719,     -7992.63,       -11.06,     21578.08,        -4.53,        11.39,        -0.06 },
 {   0,   0,   1,   0,  -20905.32206,      6888.23,       -35.83,   -380331.75,        22.31,         1.77,         0.00 },
 {   2,   0,  -1,   0,   -3699.10468,    -63127.05,       818.00,    -67236.74,       147.86,       -15.95,         0.14 },
@@ -554,10 +560,11 @@ static const ELPMainSeries _dist_main = { 3, 140, {
 {   2,   2,  -2,  -1,       0.03024,         0.36,         1.36,         1.10,         1.81,         0.00,         0.00 },
 {   1,   0,   0,  -2,      -0.02948,         0.18,         0.00,        -0.03,        -3.52,       -11.46,         0.06 },
 {   4,   0,  -4,   0,      -0.02939,        -0.87,         0.00,        -2.14,         0.00,         0.00,         0.00 }
-} };
+};
+
+static constexpr ELPMainSeries _dist_main = { 3, 140, _dist_main_terms };
 
-static const vector<ELPPertSeries> _lon_pert = {
-{ 1, 0, 1131, {
+static constexpr ELPPertTerm _lon_pert0[] = {
 { -1.274921554086e+01, +6.368794709728e+00,   0,   0,   1,   0,   0, -18,  16,   0,   0,   0,   0,   0,   0 },
 { -7.062989999049e+00, +1.158760846981e-04,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -1 },
 { -1.142992395166e+00, -2.364916989220e-03,   2,   0,  -1,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0 },
@@ -1689,8 +1696,9 @@ static const vector<ELPPertSeries> _lon_pert = {
 { -1.909445330508e-04, +8.066219108147e-04,   1,  -1,   0,   0,   0,   7,  -6,   0,   0,   0,   0,   0,   0 },
 { +8.058771886184e-04, +1.871864553221e-04,   2,   0,  -1,   0,   0,   0,  -5,   6,   0,   0,   0,   0,   0 },
 { +6.002776045511e-04, -5.682671630266e-04,   2,   0,   0,   0,   0,   0,   1,   0,  -3,   0,   0,   0,   0 }
-} },
-{ 1, 1, 119, {
+};
+
+static constexpr ELPPertTerm _lon_pert1[] = {
 { +1.676800000000e+00, +0.000000000000e+00,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { -5.164200000000e-01, +0.000000000000e+00,   2,   0,  -1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { -4.138300000000e-01, +0.000000000000e+00,   2,   0,   0,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
@@ -1810,8 +1818,9 @@ static const vector<ELPPertSeries> _lon_pert = {
 { -1.813393568887e-04, -4.657109873238e-04,   1,   0,   0,   0,   0,   0, -34,  41,  -2,   0,   0,   0,   0 },
 { +6.864005029495e-06, +4.921677567826e-04,   2,   0,  -1,   0,   0,  -8,  13,   0,   0,   0,   0,   0,   0 },
 { -6.589745157930e-06, +4.880091277539e-04,   2,   0,  -1,   0,   0,   8, -13,   0,   0,   0,   0,   0,   0 }
-} },
-{ 1, 2, 21, {
+};
+
+static constexpr ELPPertTerm _lon_pert2[] = {
 { +4.870000000000e-03, +0.000000000000e+00,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { +2.089962898161e-03, -9.113098687827e-04,   0,   0,   1,   0,   0, -18,  16,   0,   0,   0,   0,   0,   0 },
 { -1.500000000000e-03, +0.000000000000e+00,   2,   0,  -1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
@@ -1833,12 +1842,16 @@ static const vector<ELPPertSeries> _lon_pert = {
 { +2.613668288081e-05, +6.485092371070e-05,   0,   0,   1,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0 },
 { -2.612480750583e-05, +6.483663110662e-05,   0,   0,   1,   0,   0,   0,  -4,   8,  -3,   0,   0,   0,   0 },
 { -6.000000000000e-05, +0.000000000000e+00,   2,   0,  -2,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 }
-} },
-{ 1, 3, 0, {
-} } };
+};
 
-static const vector<ELPPertSeries> _lat_pert = {
-{ 2, 0, 646, {
+static constexpr ELPPertSeries _lon_pert[] = {
+{ 1, 0, 1131, _lon_pert0 },
+{ 1, 1, 119, _lon_pert1 },
+{ 1, 2, 21, _lon_pert2 },
+{ 1, 3, 0, {} }
+};
+
+static constexpr ELPPertTerm _lat_pert0[] = {
 { -8.045039999382e+00, -9.969282987996e-05,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1 },
 { +1.756754655786e-01, -1.499956686934e+00,   1,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0 },
 { +5.640575434610e-01, +2.817713704141e-01,   0,   1,  -1,   0,   0,  18, -16,   0,   0,   0,   0,   0,   0 },
@@ -2485,8 +2498,9 @@ static const vector<ELPPertSeries> _lat_pert = {
 { -4.548921756690e-04, -2.813150875775e-04,   2,   1,   0,   0,   0,   0,  -3,   4,   0,   0,   0,   0,   0 },
 { +5.212882136804e-04, -1.193163754754e-04,   0,   1,  -1,   0,   0,   6,  -8,   0,   0,   0,   0,   0,   0 },
 { -5.323710328111e-04, -2.760844896562e-06,   1,   1,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0 }
-} },
-{ 2, 1, 51, {
+};
+
+static constexpr ELPPertTerm _lat_pert1[] = {
 { -7.430000000000e-02, +0.000000000000e+00,   2,  -1,   0,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { +3.043000000000e-02, +0.000000000000e+00,   2,  -1,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { -2.229000000000e-02, +0.000000000000e+00,   2,   1,  -1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
@@ -2538,19 +2552,24 @@ static const vector<ELPPertSeries> _lat_pert = {
 { +5.300000000000e-04, +0.000000000000e+00,   2,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { +5.300000000000e-04, +0.000000000000e+00,   2,  -1,  -1,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { +4.800000000000e-04, +0.000000000000e+00,   0,   1,  -1,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0 }
-} },
-{ 2, 2, 5, {
+};
+
+static constexpr ELPPertTerm _lat_pert2[] = {
 { -2.200000000000e-04, +0.000000000000e+00,   2,  -1,   0,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { -9.246507995485e-05, -4.031873652025e-05,   0,   1,  -1,   0,   0,  18, -16,   0,   0,   0,   0,   0,   0 },
 { +9.242860002116e-05, -4.030282025139e-05,   0,   1,   1,   0,   0, -18,  16,   0,   0,   0,   0,   0,   0 },
 { +9.000000000000e-05, +0.000000000000e+00,   2,  -1,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { -6.000000000000e-05, +0.000000000000e+00,   2,   1,   0,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 }
-} },
-{ 2, 3, 0, {
-} } };
+};
 
-static const vector<ELPPertSeries> _dist_pert = {
-{ 3, 0, 1211, {
+static constexpr ELPPertSeries _lat_pert[] = {
+{ 2, 0, 646, _lat_pert0 },
+{ 2, 1, 51, _lat_pert1 },
+{ 2, 2, 5, _lat_pert2 },
+{ 2, 3, 0, {} }
+};
+
+static constexpr ELPPertTerm _dist_pert0[] = {
 { -2.189679448352e-03, +1.058616729945e+00,   2,   0,  -1,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0 },
 { +3.253561194684e-01, +6.513087890330e-01,   0,   0,   2,   0,   0, -18,  16,   0,   0,   0,   0,   0,   0 },
 { +3.051470167778e-01, -6.108298914226e-01,   0,   0,   0,   0,   0,  18, -16,   0,   0,   0,   0,   0,   0 },
@@ -3762,8 +3781,9 @@ static const vector<ELPPertSeries> _dist_pert = {
 { -3.413485764924e-04, +3.023221316678e-04,   0,   0,   0,   0,   0,  12,  -8,   0,   0,   0,   0,   0,   0 },
 { -1.697717462184e-07, -4.556903645639e-04,   0,   0,   3,   0,   0,  -1,   1,   0,   0,   0,   0,   0,   0 },
 { -2.042377936089e-04, -4.073188672221e-04,   2,   0,  -1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0 }
-} },
-{ 3, 1, 116, {
+};
+
+static constexpr ELPPertTerm _dist_pert1[] = {
 { +0.000000000000e+00, +5.139500000000e-01,   2,   0,   0,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { +0.000000000000e+00, +3.824500000000e-01,   2,   0,  -1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { +0.000000000000e+00, +3.265400000000e-01,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
@@ -3880,8 +3900,9 @@ static const vector<ELPPertSeries> _dist_pert = {
 { +0.000000000000e+00, +2.900000000000e-04,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { +3.456544939125e-05, -2.830098632379e-04,   0,   0,   2,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0 },
 { +3.456252886172e-05, +2.829755606647e-04,   0,   0,   2,   0,   0,   0,  -4,   8,  -3,   0,   0,   0,   0 }
-} },
-{ 3, 2, 21, {
+};
+
+static constexpr ELPPertTerm _dist_pert2[] = {
 { +0.000000000000e+00, +1.490000000000e-03,   2,   0,   0,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { +0.000000000000e+00, +1.110000000000e-03,   2,   0,  -1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { +0.000000000000e+00, +9.500000000000e-04,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
@@ -3903,9 +3924,14 @@ static const vector<ELPPertSeries> _dist_pert = {
 { +0.000000000000e+00, -4.000000000000e-05,   0,   0,   2,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
 { -1.309383743933e-05, -3.002885516495e-05,   2,   0,   1,   0,   0, -18,  16,   0,   0,   0,   0,   0,   0 },
 { -1.302599933607e-05, +2.987337089078e-05,   2,   0,  -1,   0,   0,  18, -16,   0,   0,   0,   0,   0,   0 }
-} },
-{ 3, 3, 0, {
-} } };
+};
+
+static constexpr ELPPertSeries _dist_pert[] = {
+{ 3, 0, 1211, _dist_pert0 },
+{ 3, 1, 116, _dist_pert1 },
+{ 3, 2, 21, _dist_pert2 },
+{ 3, 3, 0, {} }
+};
 
 
 #endif // ELPMPP02_EMBED_SERIES
@@ -3917,8 +3943,6 @@ static const vector<ELPPertSeries> _dist_pert = {
 #define a405 384747.9613701725
 #define aelp 384747.980674318
 #define sc 36525
-#define max1 2645
-#define max2 33256
 #define dj2000 2451545.0
 
 double rad = 648000.0 / cpi;
@@ -3930,12 +3954,31 @@ double DMS(int ideg, int imin, double sec) {
 
 // Some variable declarations are pulled outside the INITIAL function for scope purposes
 // these variables are populated by READFILE
-double cmpb[max1] = {0};
-double fmpb[5][max1] = {{0},{0}};
+// Evaluation-time series data is stored as tight columns, one entry per term loaded: amplitude (c),
+// phase polynomial coefficients (f), and root-sum-square tail amplitude (t). Terms of every series
+// are contiguous; nmpb and nper hold each series' term count and first and last indices.
+
+vector<double> cmpb;
+vector<double> fmpb[5];
 double nmpb[3][3] = {{0},{0}};
-double cper[max2] = {0};
-double fper[5][max2] = {{0},{0}};
+vector<double> cper;
+vector<double> fper[5];
 double nper[3][4][3] = {{0},{0},{0}};
+vector<double> tmpb;        // root-sum-square amplitude of each main problem term and all following terms in its series
+vector<double> tper;        // same for perturbation terms
+
+// Grows a set of series columns (c, f, t) to hold at least n terms.
+
+static void reserve_columns ( vector<double> &c, vector<double> f[5], vector<double> &t, size_t n )
+{
+    if ( c.size() >= n )
+        return;
+    
+    c.resize ( n );
+    t.resize ( n );
+    for ( int k = 0; k <= 4; k++ )
+        f[k].resize ( n );
+}
 
 double w[3][5] = {{0},{0}};
 double eart[5] = {0};
@@ -4122,6 +4165,7 @@ void read_main_problem_series ( const ELPMainSeries &series, int starting_idx )
     int iv = series.iv - 1;
     int ir = starting_idx;
 
+    reserve_columns ( cmpb, fmpb, tmpb, ir + nt );
     nmpb[iv][0] = nt;
     nmpb[iv][1] = ir;
     nmpb[iv][2] = nmpb[iv][0] + nmpb[iv][1] - 1;
@@ -4151,6 +4195,13 @@ void read_main_problem_series ( const ELPMainSeries &series, int starting_idx )
         if (iv == 2) fmpb[0][ir] = fmpb[0][ir] + pis2;
         ir = ir + 1;
     }
+
+    double sum2 = 0.0;
+    for ( ir = ir - 1; ir >= starting_idx; ir-- )
+    {
+        sum2 += cmpb[ir] * cmpb[ir];
+        tmpb[ir] = sqrt ( sum2 );
+    }
 }
 
 // Read perturbation series
@@ -4166,6 +4217,7 @@ void read_perturbation_series ( const ELPPertSeries &series, int starting_idx )
     int iv = series.iv - 1;
     int ir = starting_idx;
 
+    reserve_columns ( cper, fper, tper, ir + nt );
     nper[iv][it][0] = nt;
     nper[iv][it][1] = ir;
     nper[iv][it][2] = nper[iv][it][0] + nper[iv][it][1] - 1;
@@ -4188,6 +4240,13 @@ void read_perturbation_series ( const ELPPertSeries &series, int starting_idx )
         }
         ir = ir + 1;
     }
+
+    double sum2 = 0.0;
+    for ( ir = ir - 1; ir >= starting_idx; ir-- )
+    {
+        sum2 += cper[ir] * cper[ir];
+        tper[ir] = sqrt ( sum2 );
+    }
 }
 
 // comparison functions for sorting ELPMainTerms and ELPPertTerms
@@ -4205,11 +4264,75 @@ bool compareELPPertTerms ( const ELPPertTerm &term1, const ELPPertTerm &term2 )
     return a1 > a2;
 }
 
+// Precision at which series are truncated, in radians; zero means no truncation.
+
+static double _precision = 0.0;
+
+// Returns the index of the last term to evaluate in the series from index n1 to n2 so that
+// the root-sum-square amplitude of the omitted terms (tail) is below a limit (lim). Assumes
+// series terms are sorted by decreasing amplitude.
+
+static int truncate_series ( const vector<double> &tail, int n1, int n2, double lim )
+{
+    if ( lim <= 0.0 )
+        return n2;
+    
+    while ( n1 <= n2 )
+    {
+        int mid = ( n1 + n2 ) / 2;
+        if ( tail[mid] > lim )
+            n1 = mid + 1;
+        else
+            n2 = mid - 1;
+    }
+    
+    return n1 - 1;
+}
+
+void spherical_to_rectangular ( const double t[5], double v[6], double *xyz );
+
+// Phases of up to ELP_CHUNK terms are computed at once, then their sines and cosines with one
+// vectorized call; chunks are small enough that the scratch arrays stay in L1 cache.
+
+#define ELP_CHUNK 64
+
+// Adds terms n1 to n2 of a series with amplitudes (c), phase polynomial coefficients (f), and time power (it)
+// to a series sum (v) and its rate (vp) at time powers (t).
+
+static void eval_series ( const vector<double> &c, const vector<double> f[5], int n1, int n2, int it, const double t[5], double &v, double &vp )
+{
+    double y[ELP_CHUNK], yp[ELP_CHUNK], siny[ELP_CHUNK], cosy[ELP_CHUNK];
+    double xt = t[it], xp = it > 0 ? it * t[it - 1] : 0.0;
+
+    for ( int n0 = n1; n0 <= n2; n0 += ELP_CHUNK )
+    {
+        int m = min ( ELP_CHUNK, n2 - n0 + 1 );
+        const double *a = &c[n0], *f0 = &f[0][n0], *f1 = &f[1][n0], *f2 = &f[2][n0], *f3 = &f[3][n0], *f4 = &f[4][n0];
+
+        for ( int i = 0; i < m; i++ )
+        {
+            y[i] = f0[i] + f1[i] * t[1] + f2[i] * t[2] + f3[i] * t[3] + f4[i] * t[4];
+            yp[i] = f1[i] + 2.0 * f2[i] * t[1] + 3.0 * f3[i] * t[2] + 4.0 * f4[i] * t[3];
+        }
+
+        vsincos ( y, siny, cosy, m );
+
+        double sv = 0.0, svp = 0.0;
+        for ( int i = 0; i < m; i++ )
+        {
+            sv += a[i] * siny[i];
+            svp += a[i] * yp[i] * cosy[i];
+        }
+
+        v += xt * sv;
+        vp += xp * sv + xt * svp;
+    }
+}
+
 void get_position_velocity ( double tj, double *xyz )
 {
     double t[5] = {0};
     double v[6] = {0};
-    double x, y, xp, yp;
 
     t[0] = 1.0;
     t[1] = tj / sc;
@@ -4217,46 +4340,37 @@ void get_position_velocity ( double tj, double *xyz )
     t[3] = t[2] * t[1];
     t[4] = t[3] * t[1];
 
+    // Truncation limits for longitude/latitude (arcsec) and distance (km), and time powers used
+    // to scale them; these never go below 1 century so velocity terms aren't lost near J2000.
+
+    double lim[3] = { _precision * rad, _precision * rad, _precision * a405 };
+    double tl = max ( fabs ( t[1] ), 1.0 );
+    double tlim[4] = { 1.0, tl, tl * tl, tl * tl * tl };
+
     for ( int iv = 0; iv <= 2; iv++ )
     {
         v[iv] = 0.0;
         v[iv + 3] = 0.0;
 
-        for ( int n = nmpb[iv][1]; n <= nmpb[iv][2]; n++ )
-        {
-            x = cmpb[n];
-            y = fmpb[0][n];
-            yp = 0.0;
-            for ( int k = 1; k <= 4; k++ )
-            {
-                y = y + fmpb[k][n] * t[k];
-                yp = yp + k * fmpb[k][n] * t[k - 1];
-            }
-            v[iv] = v[iv] + x * sin(y);
-            v[iv + 3] = v[iv + 3] + x * yp * cos(y);
-        }
+        int n2 = truncate_series ( tmpb, nmpb[iv][1], nmpb[iv][2], lim[iv] );
+        eval_series ( cmpb, fmpb, nmpb[iv][1], n2, 0, t, v[iv], v[iv + 3] );
 
         for ( int it = 0; it <= 3; it++ )
         {
             if ( nper[iv][it][1] == 0 && nper[iv][it][2] == 0 ) continue;
-            for (int n = nper[iv][it][1]; n <= nper[iv][it][2]; n++ )
-            {
-                x = cper[n];
-                y = fper[0][n];
-                xp = 0.0;
-                yp = 0.0;
-                if ( it != 0 ) xp = it * x * t[it - 1];
-                for ( int k = 1; k <= 4; k++ )
-                {
-                    y = y + fper[k][n] * t[k];
-                    yp = yp + k * fper[k][n] * t[k - 1];
-                }
-                v[iv] = v[iv] + x * t[it] * sin(y);
-                v[iv + 3] = v[iv + 3] + xp * sin(y) + x * t[it] * yp * cos(y);
-            }
+            n2 = truncate_series ( tper, nper[iv][it][1], nper[iv][it][2], lim[iv] / tlim[it] );
+            eval_series ( cper, fper, nper[iv][it][1], n2, it, t, v[iv], v[iv + 3] );
         }
     }
 
+    spherical_to_rectangular ( t, v, xyz );
+}
+
+// Converts series sums (v) for longitude, latitude, distance and their rates at time powers (t)
+// in centuries from J2000 to rectangular position and velocity (xyz) in the J2000 ecliptic frame.
+
+void spherical_to_rectangular ( const double t[5], double v[6], double *xyz )
+{
     v[0] = v[0] / rad + w[0][0] + w[0][1] * t[1] + w[0][2] * t[2] + w[0][3] * t[3] + w[0][4] * t[4];
     v[1] = v[1] / rad;
     v[2] = v[2] * a405 / aelp;
@@ -4304,8 +4418,156 @@ void get_position_velocity ( double tj, double *xyz )
     xyz[5] = ( -pwra * xp1 + qwra * xp2 + ( pw2 + qw2 - 1.0 ) * xp3 - ppwra * x1 + qpwra * x2 + ( ppw2 + qpw2 ) * x3 ) / sc;
 }
 
+// Batch computations evaluate up to BATCH_BLOCK evenly spaced times per block, spanning at most
+// BATCH_SPAN centuries. Within a block, each term's phase is split into a linear part, advanced by
+// angle-addition recurrence, and a nonlinear remainder which stays below 1.0e-4 radians, so its sine
+// and cosine are computed exactly enough from short Taylor series.
+
+#define BATCH_BLOCK 32
+#define BATCH_SPAN 0.25
+
+// Adds one term with amplitude (x), phase polynomial coefficients (f), and time power (it)
+// to series sums (v) and their rates (vp) at nk times tb + k * dt, with time powers (tp).
+
+static void eval_term_block ( double x, const double f[5], int it, double tb, double dt, int nk, const double tp[][5], double *v, double *vp )
+{
+    // Phase, its rate, and Taylor coefficients of the nonlinear remainder at block start.
+    
+    double y0 = f[0] + tb * ( f[1] + tb * ( f[2] + tb * ( f[3] + tb * f[4] ) ) );
+    double y1 = f[1] + tb * ( 2.0 * f[2] + tb * ( 3.0 * f[3] + tb * 4.0 * f[4] ) );
+    double c2 = f[2] + tb * ( 3.0 * f[3] + tb * 6.0 * f[4] );
+    double c3 = f[3] + tb * 4.0 * f[4];
+    double c4 = f[4];
+    
+    double sn, cs, sd, cd;
+    sincos ( y0, sn, cs );
+    sincos ( y1 * dt, sd, cd );
+
+    for ( int k = 0; k < nk; k++ )
+    {
+        double tau = k * dt;
+        double r = tau * tau * ( c2 + tau * ( c3 + tau * c4 ) );
+        double r2 = r * r;
+        double sr = r * ( 1.0 - r2 / 6.0 );
+        double cr = 1.0 - r2 * ( 0.5 - r2 / 24.0 );
+        double siny = sn * cr + cs * sr;
+        double cosy = cs * cr - sn * sr;
+        double yp = y1 + tau * ( 2.0 * c2 + tau * ( 3.0 * c3 + tau * 4.0 * c4 ) );
+        double xt = x * tp[k][it];
+
+        v[k] += xt * siny;
+        vp[k] += xt * yp * cosy;
+        if ( it != 0 )
+            vp[k] += it * x * tp[k][it - 1] * siny;
+
+        double sn1 = sn * cd + cs * sd;
+        cs = cs * cd - sn * sd;
+        sn = sn1;
+    }
+}
+
+// Computes position and velocity (xyz, 6 values per time) at n evenly spaced times tj0, tj0 + dtj ...
+// in days from J2000, in the J2000 ecliptic frame. Series are truncated at the time farthest from J2000.
+
+void get_positions_velocities ( double tj0, double dtj, int n, double *xyz )
+{
+    double t0 = tj0 / sc, dt = dtj / sc;
+    int block = BATCH_BLOCK;
+    if ( fabs ( dt ) * ( block - 1 ) > BATCH_SPAN )
+        block = (int) ( BATCH_SPAN / fabs ( dt ) ) + 1;
+
+    // If times are too far apart for blocks of more than one, the recurrence doesn't help.
+    
+    if ( block < 2 )
+    {
+        for ( int i = 0; i < n; i++ )
+            get_position_velocity ( tj0 + i * dtj, xyz + 6 * i );
+        return;
+    }
+
+    double lim[3] = { _precision * rad, _precision * rad, _precision * a405 };
+    double tl = max ( max ( fabs ( t0 ), fabs ( t0 + ( n - 1 ) * dt ) ), 1.0 );
+    double tlim[4] = { 1.0, tl, tl * tl, tl * tl * tl };
+    int nmain[3], npert[3][4];
+
+    for ( int iv = 0; iv <= 2; iv++ )
+    {
+        nmain[iv] = truncate_series ( tmpb, nmpb[iv][1], nmpb[iv][2], lim[iv] );
+        for ( int it = 0; it <= 3; it++ )
+            npert[iv][it] = truncate_series ( tper, nper[iv][it][1], nper[iv][it][2], lim[iv] / tlim[it] );
+    }
+
+    for ( int k0 = 0; k0 < n; k0 += block )
+    {
+        int nk = min ( block, n - k0 );
+        double tb = t0 + k0 * dt;
+        double tp[BATCH_BLOCK][5];
+        double v[6][BATCH_BLOCK] = {{0}};
+        double f[5];
+
+        for ( int k = 0; k < nk; k++ )
+        {
+            tp[k][0] = 1.0;
+            tp[k][1] = tb + k * dt;
+            tp[k][2] = tp[k][1] * tp[k][1];
+            tp[k][3] = tp[k][2] * tp[k][1];
+            tp[k][4] = tp[k][3] * tp[k][1];
+        }
+
+        for ( int iv = 0; iv <= 2; iv++ )
+        {
+            for ( int n = nmpb[iv][1]; n <= nmain[iv]; n++ )
+            {
+                for ( int i = 0; i <= 4; i++ )
+                    f[i] = fmpb[i][n];
+                eval_term_block ( cmpb[n], f, 0, tb, dt, nk, tp, v[iv], v[iv + 3] );
+            }
+
+            for ( int it = 0; it <= 3; it++ )
+            {
+                if ( nper[iv][it][1] == 0 && nper[iv][it][2] == 0 ) continue;
+                for ( int n = nper[iv][it][1]; n <= npert[iv][it]; n++ )
+                {
+                    for ( int i = 0; i <= 4; i++ )
+                        f[i] = fper[i][n];
+                    eval_term_block ( cper[n], f, it, tb, dt, nk, tp, v[iv], v[iv + 3] );
+                }
+            }
+        }
+
+        for ( int k = 0; k < nk; k++ )
+        {
+            double vk[6] = { v[0][k], v[1][k], v[2][k], v[3][k], v[4][k], v[5][k] };
+            spherical_to_rectangular ( tp[k], vk, xyz + 6 * ( k0 + k ) );
+        }
+    }
+}
+
 static bool _init = false;  // initialization flag ensures series are only loaded once.
 
+void ELPMPP02::setPrecision ( double prec )
+{
+    _precision = prec;
+}
+
+double ELPMPP02::getPrecision ( void )
+{
+    return _precision;
+}
+
+size_t ELPMPP02::getResidentSize ( void )
+{
+    size_t size = vecbytes ( cmpb ) + vecbytes ( cper ) + vecbytes ( tmpb ) + vecbytes ( tper );
+    for ( int k = 0; k <= 4; k++ )
+        size += vecbytes ( fmpb[k] ) + vecbytes ( fper[k] );
+    
+    size += vecbytes ( pertLon ) + vecbytes ( pertLat ) + vecbytes ( pertDist );
+    for ( int i = 0; i < 3; i++ )
+        size += vecbytes ( mainTerms[i] ) + vecbytes ( pertTerms[i] );
+    
+    return size;
+}
+
 ELPMPP02::ELPMPP02 ( void )
 {
     icor = 0;
@@ -4321,9 +4583,6 @@ bool setup_Elp_series ()
     if ( _lon_main.terms.size() == 0 || _lat_main.terms.size() == 0 || _dist_main.terms.size() == 0 )
         return false;
 
-    if ( _lon_pert.size() == 0 || _lat_pert.size() == 0 || _dist_pert.size() == 0 )
-        return false;
-
     // Main problem
 
     int starting_idx = 0;
@@ -4369,8 +4628,8 @@ bool setup_Elp_series ()
     return true;
 }
 
-// Copies data from ELPMPP02 series embedded in this C++ source code
-// into Kam's main and perturbation series arrays. Only do this once!
+// Derives Kam's main and perturbation series coefficient arrays from ELPMPP02 series
+// embedded in this C++ source code, on first use. The series themselves are read in place.
 
 bool ELPMPP02::initSeries ( void )
 {
@@ -4504,6 +4763,8 @@ int ELPMPP02::readMainSeries ( const string &filename, ELPMainSeries &ser )
         return count;
     
     ser.nt = strtoint ( line.substr ( 31, 4) );
+    vector<ELPMainTerm> &terms = mainTerms[ser.iv - 1];
+    terms.clear();
     
     for ( int i = 0; i < ser.nt; i++ )
     {
@@ -4526,10 +4787,11 @@ int ELPMPP02::readMainSeries ( const string &filename, ELPMainSeries &ser )
         term.b[4] = strtofloat64 ( line.substr ( 75, 12 ) );
         term.b[5] = strtofloat64 ( line.substr ( 87, 12 ) );
         
-        ser.terms.push_back ( term );
+        terms.push_back ( term );
     }
 
-    sort ( ser.terms.begin(), ser.terms.end(), compareELPMainTerms );
+    sort ( terms.begin(), terms.end(), compareELPMainTerms );
+    ser.terms = terms;
     
 #if PRINT_SERIES
     ofstream outfile ( filename + ".cpp" );
@@ -4556,6 +4818,7 @@ int ELPMPP02::readPertSeries ( const string &filename, vector<ELPPertSeries> &pe
 
     string line = "";
     int count = 0;
+    vector<size_t> first;
 
     while ( getline ( file, line ) )
     {
@@ -4574,6 +4837,11 @@ int ELPMPP02::readPertSeries ( const string &filename, vector<ELPPertSeries> &pe
         ser.nt = strtoint ( line.substr ( 30, 5 ) );
         ser.it = strtoint ( line.substr ( 44, 1 ) );
 
+        vector<ELPPertTerm> &terms = pertTerms[ser.iv - 1];
+        if ( pert.size() == 0 )
+            terms.clear();
+        first.push_back ( terms.size() );
+
         for ( int i = 0; i < ser.nt; i++ )
         {
             if ( ! getline ( file, line ) )
@@ -4588,13 +4856,23 @@ int ELPMPP02::readPertSeries ( const string &filename, vector<ELPPertSeries> &pe
             for ( int k = 0; k < 13; k++ )
                 term.i[k] = strtoint ( line.substr ( 45 + 3 * k, 3 ) );
             
-            ser.terms.push_back ( term );
+            terms.push_back ( term );
         }
         
-        sort ( ser.terms.begin(), ser.terms.end(), compareELPPertTerms );
+        sort ( terms.begin() + first.back(), terms.end(), compareELPPertTerms );
         pert.push_back ( ser );
     }
 
+    // Now that all terms have been read, and won't be reallocated,
+    // point each series at its own terms.
+    
+    for ( size_t k = 0; k < pert.size(); k++ )
+    {
+        const vector<ELPPertTerm> &terms = pertTerms[pert[k].iv - 1];
+        size_t last = k + 1 < pert.size() ? first[k + 1] : terms.size();
+        pert[k].terms = SSSpan<ELPPertTerm> ( terms.data() + first[k], last - first[k] );
+    }
+
     if ( pert[0].iv == 1 )
         pertLon = pert;
     else if ( pert[0].iv == 2 )
@@ -4617,17 +4895,17 @@ int ELPMPP02::readPertSeries ( const string &filename, vector<ELPPertSeries> &pe
 void ELPMPP02::printMainSeries ( ostream &out, const ELPMainSeries &ser )
 {
     out << "#include \"ELPMPP02.hpp\"\n" << endl;
-    out << "static ELPMainSeries ";
     
+    string name = "";
     if ( ser.iv == 1 )
-        out << "_lon_main";
+        name = "_lon_main";
     else if ( ser.iv == 2 )
-        out << "_lat_main";
+        name = "_lat_main";
     else if ( ser.iv == 3 )
-        out << "_dist_main";
+        name = "_dist_main";
 
     int nt = (int) ser.terms.size() / TRUNC_FACTOR;
-    out << format ( " = { %d, %d, {\n", ser.iv, nt );
+    out << "static constexpr ELPMainTerm " << name << "_terms[] = {\n";
 
     for ( int k = 0; k < nt; k++ )
     {
@@ -4643,7 +4921,8 @@ void ELPMPP02::printMainSeries ( ostream &out, const ELPMainSeries &ser )
             out << "\n";
     }
 
-    out << "} };\n";
+    out << "};\n" << endl;
+    out << "static constexpr ELPMainSeries " << name << format ( " = { %d, %d, ", ser.iv, nt ) << name << "_terms };\n";
 }
 
 // Exports a vector of ELPPertSeries (pert) as C++ source code to an output stream (out).
@@ -4652,21 +4931,26 @@ void ELPMPP02::printMainSeries ( ostream &out, const ELPMainSeries &ser )
 void ELPMPP02::printPertSeries ( ostream &out, const vector<ELPPertSeries> &pert )
 {
     out << "#include \"ELPMPP02.hpp\"\n" << endl;
-    out << "static vector<ELPPertSeries> ";
     
+    string name = "";
     if ( pert[0].iv == 1 )
-        out << "_lon_pert = {\n";
+        name = "_lon_pert";
     else if ( pert[0].iv == 2 )
-        out << "_lat_pert = {\n";
+        name = "_lat_pert";
     else if ( pert[0].iv == 3 )
-        out << "_dist_pert = {\n";
+        name = "_dist_pert";
 
+    // print each series' terms as a constexpr array; C++ doesn't allow empty arrays, so skip empty series.
+    
     for ( int k = 0; k < pert.size(); k++ )
     {
         const ELPPertSeries &ser = pert[k];
         
         int nt = (int) ser.terms.size() / TRUNC_FACTOR;
-        out << format ( "{ %d, %d, %d, {\n", ser.iv, ser.it, nt );
+        if ( nt < 1 )
+            continue;
+        
+        out << "static constexpr ELPPertTerm " << name << k << "[] = {\n";
 
         for ( int i = 0; i < nt; i++ )
         {
@@ -4682,11 +4966,26 @@ void ELPMPP02::printPertSeries ( ostream &out, const vector<ELPPertSeries> &pert
                 out << format ( "%3d }\n", term.i[12] );
         }
         
-        if ( k < pert.size() - 1 )
-            out << "} },\n";
+        out << "};\n" << endl;
+    }
+    
+    // then print the array of series which refer to them.
+    
+    out << "static constexpr ELPPertSeries " << name << "[] = {\n";
+    for ( int k = 0; k < pert.size(); k++ )
+    {
+        const ELPPertSeries &ser = pert[k];
+        
+        int nt = (int) ser.terms.size() / TRUNC_FACTOR;
+        out << format ( "{ %d, %d, %d, ", ser.iv, ser.it, nt );
+        if ( nt < 1 )
+            out << "{} }";
         else
-            out << "} } };\n";
+            out << name << k << " }";
+        
+        out << ( k < pert.size() - 1 ? ",\n" : "\n" );
     }
+    out << "};\n";
 }
 
 // Computes Moon's geocentric position and velocity on a specific Julian Ephemeris Date (jed)
@@ -4694,6 +4993,7 @@ void ELPMPP02::printPertSeries ( ostream &out, const vector<ELPPertSeries> &pert
 
 bool ELPMPP02::computePositionVelocity ( double jed, SSVector &pos, SSVector &vel )
 {
+    SS_INSTRUMENT_TIME ( kInstrumentELP );
     static SSMatrix eclequ = SSCoordinates::getEclipticMatrix ( SSCoordinates::getObliquity ( SSTime::kJ2000 ) );
     double tj = jed - 2451545.0;
 
@@ -4726,3 +5026,56 @@ bool ELPMPP02::computePositionVelocity ( double jed, SSVector &pos, SSVector &ve
     
     return true;
 }
+
+// Computes Moon's geocentric positions and velocities (pos and vel) in AU and AU per day, referred to
+// the J2000 mean equatorial frame (ICRS), at n evenly spaced Julian Ephemeris Dates jed0, jed0 + step ...
+// Results agree with computePositionVelocity() for each time to about 1.0e-12 relative.
+
+bool ELPMPP02::computePositionVelocity ( double jed0, double step, int n, vector<SSVector> &pos, vector<SSVector> &vel )
+{
+    static SSMatrix eclequ = SSCoordinates::getEclipticMatrix ( SSCoordinates::getObliquity ( SSTime::kJ2000 ) );
+
+#if ELPMPP02_EMBED_SERIES
+    initSeries();
+#endif
+
+    if ( ! _init || n < 0 )
+        return false;
+
+    vector<double> xyz ( 6 * n );
+    get_positions_velocities ( jed0 - 2451545.0, step, n, xyz.data() );
+
+    pos.resize ( n );
+    vel.resize ( n );
+    for ( int i = 0; i < n; i++ )
+    {
+        pos[i] = eclequ * SSVector ( xyz[6 * i], xyz[6 * i + 1], xyz[6 * i + 2] ) / SSCoordinates::kKmPerAU;
+        vel[i] = eclequ * SSVector ( xyz[6 * i + 3], xyz[6 * i + 4], xyz[6 * i + 5] ) / SSCoordinates::kKmPerAU;
+    }
+
+    return true;
+}
+
+// As above, but at an arbitrary array of Julian Ephemeris Dates (jeds). If they are evenly spaced,
+// the batch recurrence is used; otherwise each time is computed individually.
+
+bool ELPMPP02::computePositionVelocity ( const vector<double> &jeds, vector<SSVector> &pos, vector<SSVector> &vel )
+{
+    int n = (int) jeds.size();
+    double step = n > 1 ? ( jeds[n - 1] - jeds[0] ) / ( n - 1 ) : 0.0;
+    bool even = true;
+
+    for ( int i = 1; i < n && even; i++ )
+        even = fabs ( jeds[i] - ( jeds[0] + i * step ) ) < 1.0e-9;
+
+    if ( even )
+        return computePositionVelocity ( n > 0 ? jeds[0] : 0.0, step, n, pos, vel );
+
+    pos.resize ( n );
+    vel.resize ( n );
+    for ( int i = 0; i < n; i++ )
+        if ( ! computePositionVelocity ( jeds[i], pos[i], vel[i] ) )
+            return false;
+
+    return true;
+}
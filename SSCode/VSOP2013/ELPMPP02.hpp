@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "../SSVector.hpp"
+#include "../SSUtilities.hpp"
 
 #ifndef ELPMPP02_EMBED_SERIES
 #define ELPMPP02_EMBED_SERIES 1     // 1 to include embedded series; 0 to use external data files only
@@ -39,13 +40,14 @@ struct ELPMainTerm
     double b[6];     // derivates of a with respect to six constants
 };
 
-// Represents a complete ELPMPP02 "main problem" series.
+// Represents a complete ELPMPP02 "main problem" series. Terms are stored elsewhere:
+// in constexpr arrays for embedded series, or in an ELPMPP02 object for series read from files.
 
 struct ELPMainSeries
 {
     int iv;         // series variable: 1 = longitude, 2 = latitude, 3 = distance
     int nt;         // number of terms in series
-    vector<ELPMainTerm> terms;
+    SSSpan<ELPMainTerm> terms;
 };
 
 // Represents an individual term in an ELPMPP02 "perturbation" series.
@@ -63,7 +65,7 @@ struct ELPPertSeries
     int iv;         // series variable: 1 = longitude, 2 = latitude, 3 = distance
     int it;         // time power of series
     int nt;         // number of terms in series
-    vector<ELPPertTerm> terms;
+    SSSpan<ELPPertTerm> terms;
 };
 
 // This class stores ELPMPP02 lunar ephemeris series, reads them from data files,
@@ -80,11 +82,19 @@ protected:
     vector<ELPPertSeries> pertLat;
     vector<ELPPertSeries> pertDist;
     
+    vector<ELPMainTerm> mainTerms[3];   // terms of main problem series read from files: longitude, latitude, distance
+    vector<ELPPertTerm> pertTerms[3];   // terms of all perturbation series read from files, in series order
+    
 public:
     static constexpr double kMoonEarthMassRatio = 1.0 / 81.3005678;
 
     ELPMPP02 ( void );
 
+    // Series read from files point into this object's mainTerms[] and pertTerms[], so it can't be copied or assigned.
+
+    ELPMPP02 ( const ELPMPP02 &other ) = delete;
+    ELPMPP02 &operator = ( const ELPMPP02 &other ) = delete;
+
     // Reads ELPMPP02 series from external data files, or initializes from embedded C++ data.
 
     bool readSeries ( const string &datadir );
@@ -103,6 +113,22 @@ public:
     // Computes Moon's geocentric position and velocity in AU and AU/day in J2000 equatorial frame (ICRS)
 
     bool computePositionVelocity ( double jed, SSVector &pos, SSVector &vel );
+
+    // Computes Moon's positions and velocities at an array of times; much faster when times are evenly spaced.
+
+    bool computePositionVelocity ( double jed0, double step, int n, vector<SSVector> &pos, vector<SSVector> &vel );
+    bool computePositionVelocity ( const vector<double> &jeds, vector<SSVector> &pos, vector<SSVector> &vel );
+
+    // Sets or returns the amplitude below which series terms are omitted, in radians
+    // (distance terms are scaled by the Moon's mean distance). Zero evaluates every term.
+    
+    static void setPrecision ( double prec );
+    static double getPrecision ( void );
+
+    // Returns memory used by series read from files into this object, plus the working tables shared by all
+    // ELPMPP02 objects, in bytes. Embedded series in read-only storage aren't counted.
+
+    size_t getResidentSize ( void );
 };
 
 #endif /* ELPMPP02_hpp */
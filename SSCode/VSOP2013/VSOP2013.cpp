@@ -6,14 +6,35 @@
 
 #include "../SSUtilities.hpp"
 #include "../SSMatrix.hpp"
+#include "../SSInstrument.hpp"
+#include "../SSTrig.hpp"
 #include "VSOP2013.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
+// Packed series kernels are built on SSTrig's SIMD sin and cos, for whichever instruction set SSTrig uses.
+
+#if VSOP2013_USE_SIMD && SSTRIG_AVX2
+#define VSOP2013_AVX2 1
+#elif VSOP2013_USE_SIMD && SSTRIG_NEON
+#define VSOP2013_NEON 1
+#elif VSOP2013_USE_SIMD && SSTRIG_WASM
+#define VSOP2013_WASM 1
+#endif
+
 #define PRINT_SERIES    0       // 1 to comvert input series data files to output .cpp source code
 #define TRUNC_FACTOR    100     // exported seriees truncation factor: 1 exports everything, 10 exports only first tenth; 100 exports only first hundredth, etc,
 
+mutex VSOP2013::_loadMutex;
+
+VSOP2013::VSOP2013 ( void )
+{
+    for ( int i = 0; i < 9; i++ )
+        loaded[i] = false;
+}
+
 // Reads a VSOP2013 data file (filename) for the specified planet
 // (iplanet) 1 = Mercury ... 9 = Pluto into this VSOP2013 object.
 // Returns number of lines read from file.
@@ -80,12 +101,26 @@ int VSOP2013::readFile ( const string &filename, int iplanet )
             term.c = strtofloat64 ( line.substr ( 93, 20 ) );
             term.c *= pow ( 10.0, strtoint ( line.substr ( 113, 3 ) ) );
             
-            ser.terms.push_back ( term );
+            terms[iplanet-1].push_back ( term );
         }
         
         planets[iplanet-1].push_back ( ser );
     }
 
+    // Now that all terms have been read, and won't be reallocated,
+    // point each series at its own terms, in the order they were read.
+    
+    size_t first = 0;
+    for ( VSOP2013Series &ser : planets[iplanet-1] )
+    {
+        size_t nt = min ( (size_t) ser.nt, terms[iplanet-1].size() - first );
+        ser.terms = SSSpan<VSOP2013Term> ( terms[iplanet-1].data() + first, nt );
+        first += nt;
+    }
+
+    packed[iplanet-1] = packSeries ( { planets[iplanet-1] } );
+    loaded[iplanet-1] = packed[iplanet-1].size() > 0;
+
 #if PRINT_SERIES
     ofstream outfile ( filename + ".cpp" );
     if ( outfile )
@@ -96,59 +131,34 @@ int VSOP2013::readFile ( const string &filename, int iplanet )
 }
 
 // Exports a planet's VSOP2013 series (planet) as C++ source code to an output stream (out).
+// Each series' terms are exported as a constexpr array, so embedded series need no copying at startup.
 // If TRUNC_FACTOR is #defined to be > 1, a trunctated subset of terms are exported.
 
 void VSOP2013::printSeries ( ostream &out, const vector<VSOP2013Series> &planet )
 {
     out << "#include \"VSOP2013.hpp\"\n" << endl;
     
-    int iv = -1;
-    int it = -1;
+    static const char *names[7] = { "", "_a", "_l", "_k", "_h", "_q", "_p" };
+    vector<const VSOP2013Series *> printed;
     
     for ( int s = 0; s < planet.size(); s++ )
     {
         const VSOP2013Series &ser = planet[s];
         
         int nt = (int) ser.terms.size() / TRUNC_FACTOR;
-        if ( nt < 1 )
+        if ( nt < 1 || ser.iv < 1 || ser.iv > 6 )
             continue;
         
-        if ( ser.iv != iv )
-        {
-            // close preceding series, if there was one
-            
-            if ( iv > 0 )
-                out << "} } };\n" << endl;
-            
-            if ( ser.iv == 1 )
-                out << "static vector<VSOP2013Series> _a = {\n";
-            if ( ser.iv == 2 )
-                out << "static vector<VSOP2013Series> _l = {\n";
-            if ( ser.iv == 3 )
-                out << "static vector<VSOP2013Series> _k = {\n";
-            if ( ser.iv == 4 )
-                out << "static vector<VSOP2013Series> _h = {\n";
-            if ( ser.iv == 5 )
-                out << "static vector<VSOP2013Series> _q = {\n";
-            if ( ser.iv == 6 )
-                out << "static vector<VSOP2013Series> _p = {\n";
-            
-            iv = ser.iv;
-            it = -1;
-        }
-
-        if ( ser.it != it )     // print terms header
-        {
-            if ( it >= 0 )
-                out << "} }," << endl;   // close preceding terms
-
-            out << format ( "{ %3d, %3d, %3d, %3d, {\n", ser.ip, ser.iv, ser.it, nt );
-            it = ser.it;
-        }
+        // print terms as a constexpr array named after the variable and its series number, like _a0
+        
+        if ( printed.size() > 0 && printed.back()->iv != ser.iv )
+            printed.clear();
+        
+        out << "static constexpr VSOP2013Term " << names[ser.iv] << printed.size() << "[] = {\n";
         
-        for ( int k = 0; k < nt; k++ )  // print terms
+        for ( int k = 0; k < nt; k++ )
         {
-            VSOP2013Term term = ser.terms[k];
+            const VSOP2013Term &term = ser.terms[k];
             
             out << "{ ";
             for ( int i = 0; i < 17; i++ )
@@ -159,14 +169,33 @@ void VSOP2013::printSeries ( ostream &out, const vector<VSOP2013Series> &planet
             out << format ( "%+.15e, ", term.s );
             out << format ( "%+.15e }", term.c );
             
-            if ( k == ser.terms.size() - 1 )
+            if ( k == nt - 1 )
                 out << "\n";
             else
                 out << ",\n";
         }
+        
+        out << "};\n" << endl;
+        printed.push_back ( &ser );
+        
+        // after the last series of this variable, print the array of series which refer to the terms
+        
+        int next = s + 1;
+        while ( next < planet.size() && planet[next].terms.size() / TRUNC_FACTOR < 1 )
+            next++;
+        
+        if ( next == planet.size() || planet[next].iv != ser.iv )
+        {
+            out << "static constexpr VSOP2013Series " << names[ser.iv] << "[] = {\n";
+            for ( int i = 0; i < printed.size(); i++ )
+            {
+                const VSOP2013Series &p = *printed[i];
+                out << format ( "{ %3d, %3d, %3d, %3d, %s%d }", p.ip, p.iv, p.it, (int) p.terms.size() / TRUNC_FACTOR, names[p.iv], i );
+                out << ( i < printed.size() - 1 ? ",\n" : "\n" );
+            }
+            out << "};\n" << endl;
+        }
     }
-
-    out << "} } };\n" << endl;   // close final series
 }
 
 // Evaluates seventeen fundamental longitude arguments in radians (ll)
@@ -203,7 +232,7 @@ double VSOP2013::evalSeries ( double t, const VSOP2013Series &ser, double ll[17]
     double ta = pow ( t, ser.it );
     double sum = 0.0;
     
-    for ( VSOP2013Term term : ser.terms )
+    for ( const VSOP2013Term &term : ser.terms )
     {
         double phi = 0.0;
         for ( int i = 0; i < 17; i++ )
@@ -215,6 +244,708 @@ double VSOP2013::evalSeries ( double t, const VSOP2013Series &ser, double ll[17]
     return ta * sum;
 }
 
+// Packed series evaluation is on by default; turn it off to use the original evalSeries() path.
+
+static bool _usePacked = true;
+
+void VSOP2013::usePackedSeries ( bool use )
+{
+    _usePacked = use;
+}
+
+bool VSOP2013::usePackedSeries ( void )
+{
+    return _usePacked;
+}
+
+// Amplitude at which packed series are truncated, in radians; zero means no truncation.
+
+static double _precision = 0.0;
+
+void VSOP2013::setPrecision ( double prec )
+{
+    _precision = prec;
+}
+
+double VSOP2013::getPrecision ( void )
+{
+    return _precision;
+}
+
+// Converts one or more vectors of VSOP2013 series to packed form. The phase of every term
+// is a linear combination of the fundamental arguments in evalLongitudes(), so it is folded
+// into a phase at J2000 (phi0) and a rate (phi1); ll[13] (Pluto mu) has no constant part.
+// Terms are sorted by decreasing amplitude so setPrecision() can truncate them cheaply.
+
+vector<VSOP2013PackedSeries> VSOP2013::packSeries ( initializer_list<SSSpan<VSOP2013Series>> series )
+{
+    double ll0[17] = { 0.0 }, ll1[17] = { 0.0 }, llt[17] = { 0.0 };
+    vector<VSOP2013PackedSeries> packed;
+    double a0 = 0.0;
+    VSOP2013 vsop;
+    
+    vsop.evalLongitudes ( 0.0, ll0 );
+    vsop.evalLongitudes ( 1.0, llt );
+    for ( int i = 0; i < 17; i++ )
+        ll1[i] = llt[i] - ll0[i];
+    
+    for ( const SSSpan<VSOP2013Series> &span : series )
+    {
+        for ( const VSOP2013Series &ser : span )
+        {
+            VSOP2013PackedSeries pack;
+            size_t nt = ser.terms.size();
+            vector<const VSOP2013Term *> terms ( nt );
+            
+            for ( size_t n = 0; n < nt; n++ )
+                terms[n] = &ser.terms[n];
+            
+            stable_sort ( terms.begin(), terms.end(), []( const VSOP2013Term *t1, const VSOP2013Term *t2 )
+            {
+                return t1->s * t1->s + t1->c * t1->c > t2->s * t2->s + t2->c * t2->c;
+            } );
+            
+            pack.iv = ser.iv;
+            pack.it = ser.it;
+            pack.phi0.resize ( nt );
+            pack.phi1.resize ( nt );
+            pack.s.resize ( nt );
+            pack.c.resize ( nt );
+            pack.tail.resize ( nt );
+            
+            for ( size_t n = 0; n < nt; n++ )
+            {
+                const VSOP2013Term &term = *terms[n];
+                double phi0 = 0.0, phi1 = 0.0;
+                
+                for ( int i = 0; i < 17; i++ )
+                {
+                    if ( term.iphi[i] )
+                    {
+                        phi0 += term.iphi[i] * ll0[i];
+                        phi1 += term.iphi[i] * ll1[i];
+                    }
+                }
+                
+                pack.phi0[n] = phi0;
+                pack.phi1[n] = phi1;
+                pack.s[n] = term.s;
+                pack.c[n] = term.c;
+            }
+            
+            double sum2 = 0.0;
+            for ( size_t n = nt; n > 0; n-- )
+            {
+                sum2 += pack.s[n - 1] * pack.s[n - 1] + pack.c[n - 1] * pack.c[n - 1];
+                pack.tail[n - 1] = sqrt ( sum2 );
+            }
+            
+            // The largest term in the constant semimajor axis series is the mean semimajor axis.
+            
+            if ( pack.iv == 1 && pack.it == 0 && nt > 0 )
+                a0 = hypot ( pack.s[0], pack.c[0] );
+            
+            packed.push_back ( pack );
+        }
+    }
+    
+    if ( a0 > 0.0 )
+        for ( VSOP2013PackedSeries &pack : packed )
+            if ( pack.iv == 1 )
+                for ( double &tail : pack.tail )
+                    tail /= a0;
+    
+    return packed;
+}
+
+// Number of evenly spaced times evaluated per block in batch computations. Each term's sine and cosine
+// are recomputed at the start of every block, and advanced by angle-addition recurrence within it,
+// so rounding errors in the recurrence can't build up over long tables.
+
+static constexpr int kBatchBlock = 32;
+
+#if VSOP2013_AVX2
+
+// Loads four packed series values starting at index n, padding with zeros past the end (nt).
+
+__attribute__ (( target ( "avx2,fma" ) ))
+static inline __m256d loadPadded4 ( const double *x, size_t n, size_t nt )
+{
+    if ( n + 4 <= nt )
+        return _mm256_loadu_pd ( x + n );
+    
+    double pad[4] = { 0.0 };
+    for ( size_t i = 0; n + i < nt; i++ )
+        pad[i] = x[n + i];
+    return _mm256_loadu_pd ( pad );
+}
+
+// Returns the sum of a vector's four lanes.
+
+__attribute__ (( target ( "avx2,fma" ) ))
+static inline double sum4 ( __m256d x )
+{
+    double lanes[4];
+    _mm256_storeu_pd ( lanes, x );
+    return ( lanes[0] + lanes[1] ) + ( lanes[2] + lanes[3] );
+}
+
+// AVX2 kernel: evaluates sum of s * sin ( phi0 + phi1 * t ) + c * cos ( phi0 + phi1 * t ) four terms at a time.
+// If kRate is true, also returns the sum's time derivative, phi1 * ( s * cos ( phi ) - c * sin ( phi ) ), in rate.
+
+template <bool kRate>
+__attribute__ (( target ( "avx2,fma" ) ))
+static double evalPackedSeriesAVX2 ( double t, const double *phi0, const double *phi1, const double *s, const double *c, size_t nt, double &rate )
+{
+    __m256d tt = _mm256_set1_pd ( t );
+    __m256d sum = _mm256_setzero_pd(), rsum = _mm256_setzero_pd();
+    __m256d sinx, cosx;
+    
+    for ( size_t n = 0; n < nt; n += 4 )
+    {
+        __m256d p1 = loadPadded4 ( phi1, n, nt ), ss = loadPadded4 ( s, n, nt ), cc = loadPadded4 ( c, n, nt );
+        sincos4 ( _mm256_fmadd_pd ( p1, tt, loadPadded4 ( phi0, n, nt ) ), sinx, cosx );
+        sum = _mm256_fmadd_pd ( ss, sinx, sum );
+        sum = _mm256_fmadd_pd ( cc, cosx, sum );
+        if ( kRate )
+        {
+            rsum = _mm256_fmadd_pd ( _mm256_mul_pd ( p1, ss ), cosx, rsum );
+            rsum = _mm256_fnmadd_pd ( _mm256_mul_pd ( p1, cc ), sinx, rsum );
+        }
+    }
+    
+    if ( kRate )
+        rate = sum4 ( rsum );
+    
+    return sum4 ( sum );
+}
+
+// AVX2 batch kernel: adds s * sin ( phi ) + c * cos ( phi ), where phi = phi0 + phi1 * ( tb + k * dt ),
+// to sums[k] for k = 0 ... nk - 1. Each lane's phase is rotated by phi1 * dt per step. Eight terms
+// are processed at a time as two independent recurrences, to hide floating-point latency.
+// If kRate is true, also adds the time derivative phi1 * ( s * cos ( phi ) - c * sin ( phi ) ) to rates[k].
+
+template <bool kRate>
+__attribute__ (( target ( "avx2,fma" ) ))
+static void evalPackedBlockAVX2 ( double tb, double dt, int nk, const double *phi0, const double *phi1, const double *s, const double *c, size_t nt, double *sums, double *rates )
+{
+    __m256d acc[kBatchBlock], racc[kBatchBlock];
+    __m256d tt = _mm256_set1_pd ( tb ), dd = _mm256_set1_pd ( dt );
+    
+    for ( int k = 0; k < nk; k++ )
+        acc[k] = racc[k] = _mm256_setzero_pd();
+    
+    for ( size_t n = 0; n < nt; n += 8 )
+    {
+        __m256d p1a = loadPadded4 ( phi1, n, nt ), p1b = loadPadded4 ( phi1, n + 4, nt );
+        __m256d ssa = loadPadded4 ( s, n, nt ), ssb = loadPadded4 ( s, n + 4, nt );
+        __m256d cca = loadPadded4 ( c, n, nt ), ccb = loadPadded4 ( c, n + 4, nt );
+        __m256d rsa = _mm256_mul_pd ( p1a, ssa ), rsb = _mm256_mul_pd ( p1b, ssb );
+        __m256d rca = _mm256_mul_pd ( p1a, cca ), rcb = _mm256_mul_pd ( p1b, ccb );
+        __m256d sna, csa, sda, cda, snb, csb, sdb, cdb;
+        
+        sincos4 ( _mm256_fmadd_pd ( p1a, tt, loadPadded4 ( phi0, n, nt ) ), sna, csa );
+        sincos4 ( _mm256_fmadd_pd ( p1b, tt, loadPadded4 ( phi0, n + 4, nt ) ), snb, csb );
+        sincos4 ( _mm256_mul_pd ( p1a, dd ), sda, cda );
+        sincos4 ( _mm256_mul_pd ( p1b, dd ), sdb, cdb );
+        
+        for ( int k = 0; k < nk; k++ )
+        {
+            __m256d sum = _mm256_fmadd_pd ( ssa, sna, _mm256_mul_pd ( cca, csa ) );
+            sum = _mm256_fmadd_pd ( ssb, snb, _mm256_fmadd_pd ( ccb, csb, sum ) );
+            acc[k] = _mm256_add_pd ( acc[k], sum );
+            
+            if ( kRate )
+            {
+                __m256d rsum = _mm256_fmsub_pd ( rsa, csa, _mm256_mul_pd ( rca, sna ) );
+                rsum = _mm256_fnmadd_pd ( rcb, snb, _mm256_fmadd_pd ( rsb, csb, rsum ) );
+                racc[k] = _mm256_add_pd ( racc[k], rsum );
+            }
+            
+            __m256d sn1 = _mm256_fmadd_pd ( sna, cda, _mm256_mul_pd ( csa, sda ) );
+            csa = _mm256_fmsub_pd ( csa, cda, _mm256_mul_pd ( sna, sda ) );
+            sna = sn1;
+            sn1 = _mm256_fmadd_pd ( snb, cdb, _mm256_mul_pd ( csb, sdb ) );
+            csb = _mm256_fmsub_pd ( csb, cdb, _mm256_mul_pd ( snb, sdb ) );
+            snb = sn1;
+        }
+    }
+    
+    for ( int k = 0; k < nk; k++ )
+    {
+        sums[k] += sum4 ( acc[k] );
+        if ( kRate )
+            rates[k] += sum4 ( racc[k] );
+    }
+}
+
+static bool _simd = trigAVX2();
+
+#elif VSOP2013_NEON
+
+// NEON kernel: evaluates sum of s * sin ( phi0 + phi1 * t ) + c * cos ( phi0 + phi1 * t ) two terms at a time.
+// If kRate is true, also returns the sum's time derivative, phi1 * ( s * cos ( phi ) - c * sin ( phi ) ), in rate.
+
+template <bool kRate>
+static double evalPackedSeriesNEON ( double t, const double *phi0, const double *phi1, const double *s, const double *c, size_t nt, double &rate )
+{
+    float64x2_t sum = vdupq_n_f64 ( 0.0 ), rsum = vdupq_n_f64 ( 0.0 );
+    float64x2_t sinx, cosx;
+    size_t n = 0;
+    
+    for ( ; n + 2 <= nt; n += 2 )
+    {
+        float64x2_t p1 = vld1q_f64 ( phi1 + n ), ss = vld1q_f64 ( s + n ), cc = vld1q_f64 ( c + n );
+        sincos2 ( vfmaq_n_f64 ( vld1q_f64 ( phi0 + n ), p1, t ), sinx, cosx );
+        sum = vfmaq_f64 ( sum, ss, sinx );
+        sum = vfmaq_f64 ( sum, cc, cosx );
+        if ( kRate )
+        {
+            rsum = vfmaq_f64 ( rsum, vmulq_f64 ( p1, ss ), cosx );
+            rsum = vfmsq_f64 ( rsum, vmulq_f64 ( p1, cc ), sinx );
+        }
+    }
+    
+    double total = vgetq_lane_f64 ( sum, 0 ) + vgetq_lane_f64 ( sum, 1 );
+    double rtotal = vgetq_lane_f64 ( rsum, 0 ) + vgetq_lane_f64 ( rsum, 1 );
+    if ( n < nt )
+    {
+        double phi = phi0[n] + phi1[n] * t;
+        total += s[n] * sin ( phi ) + c[n] * cos ( phi );
+        rtotal += phi1[n] * ( s[n] * cos ( phi ) - c[n] * sin ( phi ) );
+    }
+    
+    if ( kRate )
+        rate = rtotal;
+    
+    return total;
+}
+
+// NEON batch kernel: adds s * sin ( phi ) + c * cos ( phi ), where phi = phi0 + phi1 * ( tb + k * dt ),
+// to sums[k] for k = 0 ... nk - 1, two terms at a time. Each lane's phase is rotated by phi1 * dt per step.
+// If kRate is true, also adds the time derivative phi1 * ( s * cos ( phi ) - c * sin ( phi ) ) to rates[k].
+
+template <bool kRate>
+static void evalPackedBlockNEON ( double tb, double dt, int nk, const double *phi0, const double *phi1, const double *s, const double *c, size_t nt, double *sums, double *rates )
+{
+    float64x2_t acc[kBatchBlock], racc[kBatchBlock];
+    float64x2_t sn, cs, sd, cd;
+    
+    for ( int k = 0; k < nk; k++ )
+        acc[k] = racc[k] = vdupq_n_f64 ( 0.0 );
+    
+    for ( size_t n = 0; n < nt; n += 2 )
+    {
+        double a0[2] = { phi0[n], 0.0 }, a1[2] = { phi1[n], 0.0 }, as[2] = { s[n], 0.0 }, ac[2] = { c[n], 0.0 };
+        if ( n + 1 < nt )
+        {
+            a0[1] = phi0[n + 1];
+            a1[1] = phi1[n + 1];
+            as[1] = s[n + 1];
+            ac[1] = c[n + 1];
+        }
+        
+        float64x2_t p1 = vld1q_f64 ( a1 ), ss = vld1q_f64 ( as ), cc = vld1q_f64 ( ac );
+        float64x2_t rs = vmulq_f64 ( p1, ss ), rc = vmulq_f64 ( p1, cc );
+        sincos2 ( vfmaq_n_f64 ( vld1q_f64 ( a0 ), p1, tb ), sn, cs );
+        sincos2 ( vmulq_n_f64 ( p1, dt ), sd, cd );
+        
+        for ( int k = 0; k < nk; k++ )
+        {
+            acc[k] = vfmaq_f64 ( acc[k], ss, sn );
+            acc[k] = vfmaq_f64 ( acc[k], cc, cs );
+            if ( kRate )
+            {
+                racc[k] = vfmaq_f64 ( racc[k], rs, cs );
+                racc[k] = vfmsq_f64 ( racc[k], rc, sn );
+            }
+            float64x2_t sn1 = vfmaq_f64 ( vmulq_f64 ( cs, sd ), sn, cd );
+            cs = vfmsq_f64 ( vmulq_f64 ( cs, cd ), sn, sd );
+            sn = sn1;
+        }
+    }
+    
+    for ( int k = 0; k < nk; k++ )
+    {
+        sums[k] += vgetq_lane_f64 ( acc[k], 0 ) + vgetq_lane_f64 ( acc[k], 1 );
+        if ( kRate )
+            rates[k] += vgetq_lane_f64 ( racc[k], 0 ) + vgetq_lane_f64 ( racc[k], 1 );
+    }
+}
+
+static bool _simd = true;
+
+#elif VSOP2013_WASM
+
+// WebAssembly SIMD128 versions of the NEON kernels above, using SSTrig's madd2() since WASM SIMD has no fused multiply-add.
+// Returns the sum of both lanes of (x).
+
+static inline double sum2 ( v128_t x )
+{
+    return wasm_f64x2_extract_lane ( x, 0 ) + wasm_f64x2_extract_lane ( x, 1 );
+}
+
+// WASM kernel: evaluates sum of s * sin ( phi0 + phi1 * t ) + c * cos ( phi0 + phi1 * t ) two terms at a time.
+// If kRate is true, also returns the sum's time derivative, phi1 * ( s * cos ( phi ) - c * sin ( phi ) ), in rate.
+
+template <bool kRate>
+static double evalPackedSeriesWASM ( double t, const double *phi0, const double *phi1, const double *s, const double *c, size_t nt, double &rate )
+{
+    v128_t sum = wasm_f64x2_splat ( 0.0 ), rsum = wasm_f64x2_splat ( 0.0 );
+    v128_t sinx, cosx, tt = wasm_f64x2_splat ( t );
+    size_t n = 0;
+    
+    for ( ; n + 2 <= nt; n += 2 )
+    {
+        v128_t p1 = wasm_v128_load ( phi1 + n ), ss = wasm_v128_load ( s + n ), cc = wasm_v128_load ( c + n );
+        sincos2 ( madd2 ( wasm_v128_load ( phi0 + n ), p1, tt ), sinx, cosx );
+        sum = madd2 ( sum, ss, sinx );
+        sum = madd2 ( sum, cc, cosx );
+        if ( kRate )
+        {
+            rsum = madd2 ( rsum, wasm_f64x2_mul ( p1, ss ), cosx );
+            rsum = wasm_f64x2_sub ( rsum, wasm_f64x2_mul ( wasm_f64x2_mul ( p1, cc ), sinx ) );
+        }
+    }
+    
+    double total = sum2 ( sum ), rtotal = sum2 ( rsum );
+    if ( n < nt )
+    {
+        double phi = phi0[n] + phi1[n] * t;
+        total += s[n] * sin ( phi ) + c[n] * cos ( phi );
+        rtotal += phi1[n] * ( s[n] * cos ( phi ) - c[n] * sin ( phi ) );
+    }
+    
+    if ( kRate )
+        rate = rtotal;
+    
+    return total;
+}
+
+// WASM batch kernel: as the NEON batch kernel, two terms at a time.
+
+template <bool kRate>
+static void evalPackedBlockWASM ( double tb, double dt, int nk, const double *phi0, const double *phi1, const double *s, const double *c, size_t nt, double *sums, double *rates )
+{
+    v128_t acc[kBatchBlock], racc[kBatchBlock];
+    v128_t sn, cs, sd, cd;
+    
+    for ( int k = 0; k < nk; k++ )
+        acc[k] = racc[k] = wasm_f64x2_splat ( 0.0 );
+    
+    for ( size_t n = 0; n < nt; n += 2 )
+    {
+        double a0[2] = { phi0[n], 0.0 }, a1[2] = { phi1[n], 0.0 }, as[2] = { s[n], 0.0 }, ac[2] = { c[n], 0.0 };
+        if ( n + 1 < nt )
+        {
+            a0[1] = phi0[n + 1];
+            a1[1] = phi1[n + 1];
+            as[1] = s[n + 1];
+            ac[1] = c[n + 1];
+        }
+        
+        v128_t p1 = wasm_v128_load ( a1 ), ss = wasm_v128_load ( as ), cc = wasm_v128_load ( ac );
+        v128_t rs = wasm_f64x2_mul ( p1, ss ), rc = wasm_f64x2_mul ( p1, cc );
+        sincos2 ( madd2 ( wasm_v128_load ( a0 ), p1, wasm_f64x2_splat ( tb ) ), sn, cs );
+        sincos2 ( wasm_f64x2_mul ( p1, wasm_f64x2_splat ( dt ) ), sd, cd );
+        
+        for ( int k = 0; k < nk; k++ )
+        {
+            acc[k] = madd2 ( acc[k], ss, sn );
+            acc[k] = madd2 ( acc[k], cc, cs );
+            if ( kRate )
+            {
+                racc[k] = madd2 ( racc[k], rs, cs );
+                racc[k] = wasm_f64x2_sub ( racc[k], wasm_f64x2_mul ( rc, sn ) );
+            }
+            v128_t sn1 = madd2 ( wasm_f64x2_mul ( cs, sd ), sn, cd );
+            cs = wasm_f64x2_sub ( wasm_f64x2_mul ( cs, cd ), wasm_f64x2_mul ( sn, sd ) );
+            sn = sn1;
+        }
+    }
+    
+    for ( int k = 0; k < nk; k++ )
+    {
+        sums[k] += sum2 ( acc[k] );
+        if ( kRate )
+            rates[k] += sum2 ( racc[k] );
+    }
+}
+
+static bool _simd = true;
+
+#else
+
+static bool _simd = false;
+
+#endif
+
+// Returns true if packed series are evaluated with a SIMD kernel on this CPU.
+
+bool VSOP2013::simdAvailable ( void )
+{
+    return _simd;
+}
+
+// Returns number of terms in a packed series (ser) to evaluate at time (t) in Julian millenia from J2000,
+// at the precision set with setPrecision(): the root-sum-square amplitude of the omitted terms
+// times t^it is below the precision. Returns zero if t^it is zero.
+
+static size_t truncatePackedSeries ( double t, const VSOP2013PackedSeries &ser )
+{
+    size_t nt = ser.phi0.size();
+    
+    if ( _precision > 0.0 && nt > 0 )
+    {
+        double tpow = ser.it == 0 ? 1.0 : pow ( fabs ( t ), ser.it );
+        if ( tpow == 0.0 )
+            return 0;
+        
+        // Find first term where the remaining terms' amplitude is below the limit.
+        
+        double lim = _precision / tpow;
+        size_t lo = 0, hi = nt;
+        while ( lo < hi )
+        {
+            size_t mid = ( lo + hi ) / 2;
+            if ( ser.tail[mid] > lim )
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        nt = lo;
+    }
+    
+    return nt;
+}
+
+// Evaluates the first nt terms of a packed series (ser) at time (t), without the time power t^it.
+// If kRate is true, also returns their time derivative in rate.
+
+template <bool kRate>
+static double evalPackedTerms ( double t, const VSOP2013PackedSeries &ser, size_t nt, double &rate )
+{
+    const double *phi0 = ser.phi0.data(), *phi1 = ser.phi1.data(), *s = ser.s.data(), *c = ser.c.data();
+    double sum = 0.0, rsum = 0.0;
+    
+#if VSOP2013_AVX2
+    if ( _simd )
+        return evalPackedSeriesAVX2<kRate> ( t, phi0, phi1, s, c, nt, rate );
+#elif VSOP2013_NEON
+    if ( _simd )
+        return evalPackedSeriesNEON<kRate> ( t, phi0, phi1, s, c, nt, rate );
+#elif VSOP2013_WASM
+    if ( _simd )
+        return evalPackedSeriesWASM<kRate> ( t, phi0, phi1, s, c, nt, rate );
+#endif
+    
+    for ( size_t n = 0; n < nt; n++ )
+    {
+        double phi = phi0[n] + phi1[n] * t;
+        double sn = sin ( phi ), cs = cos ( phi );
+        sum += s[n] * sn + c[n] * cs;
+        if ( kRate )
+            rsum += phi1[n] * ( s[n] * cs - c[n] * sn );
+    }
+    
+    if ( kRate )
+        rate = rsum;
+    
+    return sum;
+}
+
+// Evaluates all terms in a packed VSOP2013 series (ser) at time (t) in Julian millenia
+// of 365250 days from J2000 (JD 2451545.0). Unlike evalSeries(), fundamental arguments
+// do not need to be precomputed. Uses AVX2 or NEON kernels where available.
+// Series are truncated at the precision set with setPrecision(); see packSeries().
+
+double VSOP2013::evalPackedSeries ( double t, const VSOP2013PackedSeries &ser )
+{
+    size_t nt = truncatePackedSeries ( t, ser );
+    double rate = 0.0;
+    
+    if ( nt == 0 )
+        return 0.0;
+    
+    double sum = evalPackedTerms<false> ( t, ser, nt, rate );
+    return ser.it == 0 ? sum : sum * pow ( t, ser.it );
+}
+
+// As above, but also returns the series' time derivative (rate) per Julian millenium,
+// from the same evaluation of each term's sine and cosine.
+
+double VSOP2013::evalPackedSeries ( double t, const VSOP2013PackedSeries &ser, double &rate )
+{
+    size_t nt = truncatePackedSeries ( t, ser );
+    
+    rate = 0.0;
+    if ( nt == 0 )
+        return 0.0;
+    
+    double sum = evalPackedTerms<true> ( t, ser, nt, rate );
+    if ( ser.it == 0 )
+        return sum;
+    
+    rate = ( rate * t + ser.it * sum ) * pow ( t, ser.it - 1 );
+    return sum * pow ( t, ser.it );
+}
+
+// Evaluates a packed VSOP2013 series (ser) at n evenly spaced times t0, t0 + dt, t0 + 2 * dt ...
+// in Julian millenia from J2000, and adds the results to sums[0] ... sums[n-1]. Each term's sine and
+// cosine are computed once per block of times and advanced by angle-addition recurrence in between.
+// The series is truncated at the time farthest from J2000, so every time gets at least the requested precision.
+// If rates is not null, the series' time derivatives per Julian millenium are added to rates[0] ... rates[n-1].
+
+void VSOP2013::evalPackedSeries ( double t0, double dt, int n, const VSOP2013PackedSeries &ser, double *sums, double *rates )
+{
+    if ( n < 1 )
+        return;
+    
+    double t1 = t0 + ( n - 1 ) * dt;
+    size_t nt = truncatePackedSeries ( fabs ( t0 ) > fabs ( t1 ) ? t0 : t1, ser );
+    if ( nt == 0 )
+        return;
+    
+    const double *phi0 = ser.phi0.data(), *phi1 = ser.phi1.data(), *s = ser.s.data(), *c = ser.c.data();
+    for ( int k0 = 0; k0 < n; k0 += kBatchBlock )
+    {
+        int nk = min ( kBatchBlock, n - k0 );
+        double tb = t0 + k0 * dt;
+        double block[kBatchBlock] = { 0.0 }, rblock[kBatchBlock] = { 0.0 };
+        
+#if VSOP2013_AVX2
+        if ( _simd && rates )
+            evalPackedBlockAVX2<true> ( tb, dt, nk, phi0, phi1, s, c, nt, block, rblock );
+        else if ( _simd )
+            evalPackedBlockAVX2<false> ( tb, dt, nk, phi0, phi1, s, c, nt, block, rblock );
+        else
+#elif VSOP2013_NEON
+        if ( _simd && rates )
+            evalPackedBlockNEON<true> ( tb, dt, nk, phi0, phi1, s, c, nt, block, rblock );
+        else if ( _simd )
+            evalPackedBlockNEON<false> ( tb, dt, nk, phi0, phi1, s, c, nt, block, rblock );
+        else
+#elif VSOP2013_WASM
+        if ( _simd && rates )
+            evalPackedBlockWASM<true> ( tb, dt, nk, phi0, phi1, s, c, nt, block, rblock );
+        else if ( _simd )
+            evalPackedBlockWASM<false> ( tb, dt, nk, phi0, phi1, s, c, nt, block, rblock );
+        else
+#endif
+        {
+            for ( size_t j = 0; j < nt; j++ )
+            {
+                double phi = phi0[j] + phi1[j] * tb;
+                double sn = sin ( phi ), cs = cos ( phi );
+                double sd = sin ( phi1[j] * dt ), cd = cos ( phi1[j] * dt );
+                for ( int k = 0; k < nk; k++ )
+                {
+                    block[k] += s[j] * sn + c[j] * cs;
+                    if ( rates )
+                        rblock[k] += phi1[j] * ( s[j] * cs - c[j] * sn );
+                    double sn1 = sn * cd + cs * sd;
+                    cs = cs * cd - sn * sd;
+                    sn = sn1;
+                }
+            }
+        }
+        
+        for ( int k = 0; k < nk; k++ )
+        {
+            double t = tb + k * dt;
+            sums[k0 + k] += ser.it == 0 ? block[k] : block[k] * pow ( t, ser.it );
+            if ( rates )
+                rates[k0 + k] += ser.it == 0 ? rblock[k] : ( rblock[k] * t + ser.it * block[k] ) * pow ( t, ser.it - 1 );
+        }
+    }
+}
+
+// Computes a planet's (iplanet = 1 = Mercury ... 9 = Pluto) VSOP2013 elliptic elements (elem), in order
+// a, l, k, h, q, p, referred to the J2000 ecliptic, at a Julian Ephemeris Date (jed), from its packed series.
+// Their time derivatives per day (rate) come from the same pass through the series.
+// Returns true if successful or false if planet identifier not recognized.
+
+bool VSOP2013::getElements ( int iplanet, double jed, double elem[6], double rate[6] )
+{
+    const vector<VSOP2013PackedSeries> &series = getPackedSeries ( iplanet );
+    if ( series.empty() )
+        return false;
+    
+    double t = ( jed - 2451545.0 ) / 365250.0;
+    for ( int i = 0; i < 6; i++ )
+        elem[i] = rate[i] = 0.0;
+    
+    for ( const VSOP2013PackedSeries &ser : series )
+    {
+        if ( ser.iv >= 1 && ser.iv <= 6 )
+        {
+            double r = 0.0;
+            elem[ser.iv - 1] += evalPackedSeries ( t, ser, r );
+            rate[ser.iv - 1] += r / 365250.0;
+        }
+    }
+    
+    return true;
+}
+
+// Converts VSOP2013 elliptic elements (elem) a, l, k, h, q, p and their time derivatives (rate)
+// to J2000 ecliptic position (pos) and velocity (vel). Velocity is the exact time derivative of
+// position, including the element rates; not the velocity in the osculating (Keplerian) orbit.
+// Units are AU and AU per unit of time in rate, normally days.
+
+void VSOP2013::toPositionVelocity ( const double elem[6], const double rate[6], SSVector &pos, SSVector &vel )
+{
+    double a = elem[0], l = elem[1], k = elem[2], h = elem[3], q = elem[4], p = elem[5];
+    double ad = rate[0], ld = rate[1], kd = rate[2], hd = rate[3], qd = rate[4], pd = rate[5];
+    
+    // Solve Kepler's equation in eccentric longitude F: F - k sin F + h cos F = l.
+    
+    double f = mod2pi ( l ), sf = 0.0, cf = 0.0;
+    for ( int i = 0; i < 20; i++ )
+    {
+        sf = sin ( f );
+        cf = cos ( f );
+        double df = ( mod2pi ( l ) - f + k * sf - h * cf ) / ( 1.0 - k * cf - h * sf );
+        f += df;
+        if ( fabs ( df ) < 1.0e-15 )
+            break;
+    }
+    
+    sf = sin ( f );
+    cf = cos ( f );
+    double fd = ( ld + kd * sf - hd * cf ) / ( 1.0 - k * cf - h * sf );
+    
+    // Position and velocity in the orbital plane, before rotating by inclination and node.
+    
+    double phi = sqrt ( 1.0 - k * k - h * h );
+    double phid = - ( k * kd + h * hd ) / phi;
+    double b = 1.0 / ( 1.0 + phi ), bd = -b * b * phid;
+    double bhk = b * h * k, bhkd = bd * h * k + b * hd * k + b * h * kd;
+    
+    double xn = ( 1.0 - b * h * h ) * cf + bhk * sf - k;
+    double yn = ( 1.0 - b * k * k ) * sf + bhk * cf - h;
+    double xnd = - ( bd * h * h + 2.0 * b * h * hd ) * cf - ( 1.0 - b * h * h ) * sf * fd + bhkd * sf + bhk * cf * fd - kd;
+    double ynd = - ( bd * k * k + 2.0 * b * k * kd ) * sf + ( 1.0 - b * k * k ) * cf * fd + bhkd * cf - bhk * sf * fd - hd;
+    
+    double x = a * xn, y = a * yn;
+    double xd = ad * xn + a * xnd, yd = ad * yn + a * ynd;
+    
+    // Rotate from orbital plane to ecliptic.
+    
+    double g = sqrt ( 1.0 - p * p - q * q );
+    double gd = - ( p * pd + q * qd ) / g;
+    double pq = p * q, pqd = pd * q + p * qd;
+    double w = q * y - p * x, wd = qd * y + q * yd - pd * x - p * xd;
+    
+    pos.x = ( 1.0 - 2.0 * p * p ) * x + 2.0 * pq * y;
+    pos.y = 2.0 * pq * x + ( 1.0 - 2.0 * q * q ) * y;
+    pos.z = 2.0 * g * w;
+    
+    vel.x = -4.0 * p * pd * x + ( 1.0 - 2.0 * p * p ) * xd + 2.0 * pqd * y + 2.0 * pq * yd;
+    vel.y = 2.0 * pqd * x + 2.0 * pq * xd - 4.0 * q * qd * y + ( 1.0 - 2.0 * q * q ) * yd;
+    vel.z = 2.0 * ( gd * w + g * wd );
+}
+
 // Returns J2000 ecliptic orbital elements for a planet (iplanet)
 // 1 = Mercury .... 9 = Pluto at a specific Julian Ephemeris Date.
 // This method only works if the planet's VSOP2013 series have been
@@ -222,13 +953,16 @@ double VSOP2013::evalSeries ( double t, const VSOP2013Series &ser, double ll[17]
 
 SSOrbit VSOP2013::getOrbit ( int iplanet, double jed )
 {
+    if ( _usePacked || ! loadSeries ( iplanet ) )
+        return getOrbit ( iplanet, jed, getPackedSeries ( iplanet ) );
+    
     double a = 0.0, l = 0.0, k = 0.0, h = 0.0, q = 0.0, p = 0.0;
     double t = ( jed - 2451545.0 ) / 365250.0;
     double ll[17] = { 0 };
     
     evalLongitudes ( t, ll );
     vector<VSOP2013Series> &series = planets[iplanet - 1];
-    for ( VSOP2013Series ser : series )
+    for ( const VSOP2013Series &ser : series )
     {
         double sum = evalSeries ( t, ser, ll );
         if ( ser.iv == 1 )
@@ -245,6 +979,29 @@ SSOrbit VSOP2013::getOrbit ( int iplanet, double jed )
             p += sum;
     }
     
+    return toOrbit ( iplanet, jed, a, l, k, h, q, p );
+}
+
+// Returns J2000 ecliptic orbital elements for a planet (iplanet) 1 = Mercury .... 9 = Pluto
+// at a specific Julian Ephemeris Date (jed), from the planet's packed VSOP2013 series.
+
+SSOrbit VSOP2013::getOrbit ( int iplanet, double jed, const vector<VSOP2013PackedSeries> &series )
+{
+    double sum[7] = { 0.0 };
+    double t = ( jed - 2451545.0 ) / 365250.0;
+    
+    for ( const VSOP2013PackedSeries &ser : series )
+        if ( ser.iv >= 1 && ser.iv <= 6 )
+            sum[ser.iv] += evalPackedSeries ( t, ser );
+    
+    return toOrbit ( iplanet, jed, sum[1], sum[2], sum[3], sum[4], sum[5], sum[6] );
+}
+
+// Converts VSOP2013 elliptic elements (a, l, k, h, q, p) for a planet (iplanet)
+// 1 = Mercury .... 9 = Pluto at a Julian Ephemeris Date (jed) to Keplerian orbital elements.
+
+SSOrbit VSOP2013::toOrbit ( int iplanet, double jed, double a, double l, double k, double h, double q, double p )
+{
     double e = sqrt ( k * k + h * h );  // eccentricity
     double w = atan2 ( h, k );          // longitude of perihelion
     double n = atan2 ( p, q );          // longitude of ascending node
@@ -300,6 +1057,7 @@ SSVector VSOP2013::toEquatorial ( SSVector ecl )
 
 bool VSOP2013::computePositionVelocity ( int iplanet, double jed, SSVector &pos, SSVector &vel )
 {
+    SS_INSTRUMENT_TIME ( kInstrumentVSOP );
     SSOrbit orbit;
     
     if ( iplanet == 0 )
@@ -308,6 +1066,20 @@ bool VSOP2013::computePositionVelocity ( int iplanet, double jed, SSVector &pos,
         return true;
     }
     
+    // With packed series, velocity comes directly from the series' time derivatives.
+    
+    if ( _usePacked )
+    {
+        double elem[6], rate[6];
+        if ( ! getElements ( iplanet, jed, elem, rate ) )
+            return false;
+        
+        toPositionVelocity ( elem, rate, pos, vel );
+        pos = toEquatorial ( pos );
+        vel = toEquatorial ( vel );
+        return true;
+    }
+    
     if ( iplanet == 1 )
         orbit = mercuryOrbit ( jed );
     else if ( iplanet == 2 )
@@ -335,3 +1107,240 @@ bool VSOP2013::computePositionVelocity ( int iplanet, double jed, SSVector &pos,
     
     return true;
 }
+
+// Returns a planet's (iplanet = 1 = Mercury ... 9 = Pluto) packed series: the embedded series, if compiled in;
+// otherwise those read with readFile() or from the file set with setDataFile(). Series are loaded on first use.
+// Returns an empty vector if iplanet is not recognized, or its series can't be loaded.
+
+const vector<VSOP2013PackedSeries> &VSOP2013::getPackedSeries ( int iplanet )
+{
+    static const vector<VSOP2013PackedSeries> empty;
+    
+    if ( loadSeries ( iplanet ) )
+        return packed[iplanet - 1];
+    
+    return empty;
+}
+
+// Loads a planet's (iplanet = 1 = Mercury ... 9 = Pluto) packed series, if not already loaded:
+// by packing its embedded series, if compiled in; otherwise by packing series previously read with
+// readFile(), or reading them from the file set with setDataFile(). Returns true if successful.
+
+bool VSOP2013::loadSeries ( int iplanet )
+{
+    if ( iplanet < 1 || iplanet > 9 )
+        return false;
+    
+    int i = iplanet - 1;
+    if ( loaded[i] )
+        return true;
+    
+    lock_guard<mutex> lock ( _loadMutex );
+    if ( loaded[i] )
+        return true;
+    
+#if VSOP2013_EMBED_SERIES
+    if ( iplanet == 1 )
+        packed[i] = mercuryPackedSeries();
+    else if ( iplanet == 2 )
+        packed[i] = venusPackedSeries();
+    else if ( iplanet == 3 )
+        packed[i] = earthPackedSeries();
+    else if ( iplanet == 4 )
+        packed[i] = marsPackedSeries();
+    else if ( iplanet == 5 )
+        packed[i] = jupiterPackedSeries();
+    else if ( iplanet == 6 )
+        packed[i] = saturnPackedSeries();
+    else if ( iplanet == 7 )
+        packed[i] = uranusPackedSeries();
+    else if ( iplanet == 8 )
+        packed[i] = neptunePackedSeries();
+    else if ( iplanet == 9 )
+        packed[i] = plutoPackedSeries();
+#else
+    if ( planets[i].empty() && ! files[i].empty() )
+        readFile ( files[i], iplanet );
+    else if ( packed[i].empty() )
+        packed[i] = packSeries ( { planets[i] } );
+#endif
+    
+    loaded[i] = packed[i].size() > 0;
+    return loaded[i];
+}
+
+// Sets the VSOP2013 data file (filename) to read a planet's (iplanet = 1 = Mercury ... 9 = Pluto) series from
+// on first use, for builds without embedded series. Any series already read for that planet are freed.
+
+void VSOP2013::setDataFile ( int iplanet, const string &filename )
+{
+    if ( iplanet < 1 || iplanet > 9 )
+        return;
+    
+    unloadSeries ( iplanet );
+    lock_guard<mutex> lock ( _loadMutex );
+    files[iplanet - 1] = filename;
+    planets[iplanet - 1] = vector<VSOP2013Series>();
+    terms[iplanet - 1] = vector<VSOP2013Term>();
+}
+
+// Returns true if a planet's (iplanet = 1 = Mercury ... 9 = Pluto) packed series are currently loaded.
+
+bool VSOP2013::isLoaded ( int iplanet )
+{
+    return iplanet >= 1 && iplanet <= 9 && loaded[iplanet - 1];
+}
+
+// Frees a planet's (iplanet = 1 = Mercury ... 9 = Pluto) packed series, or all planets' if iplanet is zero.
+// They'll be packed again from the embedded series when next needed. Series read from a data file
+// set with setDataFile() are also freed, and read again when next needed; series read directly with
+// readFile() are kept, since they can't be read again.
+
+void VSOP2013::unloadSeries ( int iplanet )
+{
+    if ( iplanet == 0 )
+    {
+        for ( int p = 1; p <= 9; p++ )
+            unloadSeries ( p );
+        return;
+    }
+    
+    if ( iplanet < 1 || iplanet > 9 )
+        return;
+    
+    int i = iplanet - 1;
+    lock_guard<mutex> lock ( _loadMutex );
+    loaded[i] = false;
+    packed[i] = vector<VSOP2013PackedSeries>();
+    
+    if ( ! files[i].empty() )
+    {
+        planets[i] = vector<VSOP2013Series>();
+        terms[i] = vector<VSOP2013Term>();
+    }
+}
+
+// Returns heap memory currently used by a planet's (iplanet = 1 = Mercury ... 9 = Pluto) series, in bytes:
+// both packed series, and any series read from files, including allocator overhead (see heapbytes()).
+// Embedded series in read-only storage aren't counted.
+
+size_t VSOP2013::getResidentSize ( int iplanet )
+{
+    if ( iplanet < 1 || iplanet > 9 )
+        return 0;
+    
+    int i = iplanet - 1;
+    lock_guard<mutex> lock ( _loadMutex );
+    size_t size = vecbytes ( packed[i] );
+    
+    for ( const VSOP2013PackedSeries &ser : packed[i] )
+        size += vecbytes ( ser.phi0 ) + vecbytes ( ser.phi1 ) + vecbytes ( ser.s ) + vecbytes ( ser.c ) + vecbytes ( ser.tail );
+    
+    size += vecbytes ( planets[i] );
+    size += vecbytes ( terms[i] );
+    return size;
+}
+
+// Computes J2000 ecliptic orbital elements (orbits) for a planet (iplanet) 1 = Mercury .... 9 = Pluto
+// at n evenly spaced Julian Ephemeris Dates jed0, jed0 + step, jed0 + 2 * step ...
+// Returns true if successful or false if planet identifier not recognized.
+
+bool VSOP2013::getOrbits ( int iplanet, double jed0, double step, int n, vector<SSOrbit> &orbits )
+{
+    const vector<VSOP2013PackedSeries> &series = getPackedSeries ( iplanet );
+    if ( series.empty() || n < 0 )
+        return false;
+    
+    vector<double> sums[7];
+    for ( int iv = 1; iv <= 6; iv++ )
+        sums[iv].assign ( n, 0.0 );
+    
+    double t0 = ( jed0 - 2451545.0 ) / 365250.0, dt = step / 365250.0;
+    for ( const VSOP2013PackedSeries &ser : series )
+        if ( ser.iv >= 1 && ser.iv <= 6 )
+            evalPackedSeries ( t0, dt, n, ser, sums[ser.iv].data() );
+    
+    orbits.resize ( n );
+    for ( int i = 0; i < n; i++ )
+        orbits[i] = toOrbit ( iplanet, jed0 + i * step, sums[1][i], sums[2][i], sums[3][i], sums[4][i], sums[5][i], sums[6][i] );
+    
+    return true;
+}
+
+// Computes a planet's heliocentric positions and velocities (pos and vel) in the ICRS, in AU and AU/day,
+// at n evenly spaced Julian Ephemeris Dates jed0, jed0 + step, jed0 + 2 * step ...
+// As with computePositionVelocity() for a single time, iplanet = 0 is the Sun and 3 is the Earth-Moon Barycenter.
+// Returns true if successful or false if planet identifier not recognized.
+
+bool VSOP2013::computePositionVelocity ( int iplanet, double jed0, double step, int n, vector<SSVector> &pos, vector<SSVector> &vel )
+{
+    if ( n < 0 )
+        return false;
+    
+    if ( iplanet == 0 )
+    {
+        pos.assign ( n, SSVector ( 0.0, 0.0, 0.0 ) );
+        vel.assign ( n, SSVector ( 0.0, 0.0, 0.0 ) );
+        return true;
+    }
+    
+    const vector<VSOP2013PackedSeries> &series = getPackedSeries ( iplanet );
+    if ( series.empty() )
+        return false;
+    
+    // Evaluate all six elements and their rates at all times, then convert to position and velocity.
+    
+    vector<double> sums[6], rates[6];
+    for ( int i = 0; i < 6; i++ )
+    {
+        sums[i].assign ( n, 0.0 );
+        rates[i].assign ( n, 0.0 );
+    }
+    
+    double t0 = ( jed0 - 2451545.0 ) / 365250.0, dt = step / 365250.0;
+    for ( const VSOP2013PackedSeries &ser : series )
+        if ( ser.iv >= 1 && ser.iv <= 6 )
+            evalPackedSeries ( t0, dt, n, ser, sums[ser.iv - 1].data(), rates[ser.iv - 1].data() );
+    
+    pos.resize ( n );
+    vel.resize ( n );
+    for ( int i = 0; i < n; i++ )
+    {
+        double elem[6], rate[6];
+        for ( int j = 0; j < 6; j++ )
+        {
+            elem[j] = sums[j][i];
+            rate[j] = rates[j][i] / 365250.0;
+        }
+        
+        toPositionVelocity ( elem, rate, pos[i], vel[i] );
+        pos[i] = toEquatorial ( pos[i] );
+        vel[i] = toEquatorial ( vel[i] );
+    }
+    
+    return true;
+}
+
+// As above, but at an arbitrary array of Julian Ephemeris Dates (jeds). If they are evenly spaced,
+// the batch recurrence is used; otherwise each time is computed individually.
+
+bool VSOP2013::computePositionVelocity ( int iplanet, const vector<double> &jeds, vector<SSVector> &pos, vector<SSVector> &vel )
+{
+    int n = (int) jeds.size();
+    double step = n > 1 ? ( jeds[n - 1] - jeds[0] ) / ( n - 1 ) : 0.0;
+    bool even = true;
+    
+    for ( int i = 1; i < n && even; i++ )
+        even = fabs ( jeds[i] - ( jeds[0] + i * step ) ) < 1.0e-9;
+    
+    if ( even )
+        return computePositionVelocity ( iplanet, n > 0 ? jeds[0] : 0.0, step, n, pos, vel );
+    
+    pos.resize ( n );
+    vel.resize ( n );
+    for ( int i = 0; i < n; i++ )
+        if ( ! computePositionVelocity ( iplanet, jeds[i], pos[i], vel[i] ) )
+            return false;
+    
+    return true;
+}
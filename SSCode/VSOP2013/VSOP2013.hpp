@@ -19,10 +19,14 @@
 #ifndef VSOP2013_hpp
 #define VSOP2013_hpp
 
+#include <atomic>
+#include <initializer_list>
 #include <iostream>
+#include <mutex>
 #include <vector>
 
 #include "../SSOrbit.hpp"
+#include "../SSUtilities.hpp"
 
 // Stores data for an individual term in a VSOP2013 series
 
@@ -32,7 +36,9 @@ struct VSOP2013Term
     double s, c;      // coefficients of sine (s) and cosine (c) of arguments
 };
 
-// Stores data for an entire series of VSOP2013 terms.
+// Stores data for an entire series of VSOP2013 terms. The terms themselves
+// live elsewhere: in constexpr arrays for embedded series, so they are never
+// copied at startup, or in a VSOP2013 object for series read from files.
 
 struct VSOP2013Series
 {
@@ -40,13 +46,34 @@ struct VSOP2013Series
     int iv;     // variable index: 1 = a, 2 = l, 3 = k, 4 = h, 5 = q, 6 = p
     int it;     // time power (alpha)
     int nt;     // number of terms in series
-    vector<VSOP2013Term> terms;
+    SSSpan<VSOP2013Term> terms;
+};
+
+// Stores a VSOP2013 series in packed structure-of-arrays form for fast evaluation.
+// Since all seventeen fundamental arguments are linear in time, each term's phase
+// reduces to phi0 + phi1 * t; the packed form stores those two values per term,
+// plus the sine and cosine coefficients, as four contiguous columns. Terms are
+// sorted by decreasing amplitude, so a series can be truncated by term count.
+// Semimajor axis amplitudes in tail are relative to the planet's mean distance.
+
+struct VSOP2013PackedSeries
+{
+    int iv;                 // variable index: 1 = a, 2 = l, 3 = k, 4 = h, 5 = q, 6 = p
+    int it;                 // time power (alpha)
+    vector<double> phi0;    // phase of each term at J2000, in radians
+    vector<double> phi1;    // phase rate of each term, in radians per Julian millenium
+    vector<double> s, c;    // coefficients of sine (s) and cosine (c) of phase
+    vector<double> tail;    // root-sum-square amplitude of this and all following terms, in radians
 };
 
 #ifndef VSOP2013_EMBED_SERIES
 #define VSOP2013_EMBED_SERIES 1   // 1 to include embedded series; 0 to use external data files only
 #endif
 
+#ifndef VSOP2013_USE_SIMD
+#define VSOP2013_USE_SIMD 1       // 1 to evaluate packed series with AVX2 (x86-64), NEON (ARM64), or WASM SIMD128 (-msimd128) kernels where available; 0 for portable scalar code only
+#endif
+
 // This class stores VSOP2013 planetary ephemeris series, reads them from data files,
 // exports them to C++ source code, and computes planetary position/velocity from them.
 
@@ -54,18 +81,93 @@ class VSOP2013
 {
 protected:
     vector<VSOP2013Series> planets[9];      // series for each planet 0 = Mercury ... 8 = Pluto
+    vector<VSOP2013Term> terms[9];          // terms of all series read from files for each planet, in series order
+    vector<VSOP2013PackedSeries> packed[9]; // packed copies of the above series, for fast evaluation
+    string files[9];                        // data file to read each planet's series from on first use; empty if none
+    atomic<bool> loaded[9];                 // true once each planet's packed series are ready
+    
+    static mutex _loadMutex;                // serializes loading and unloading series
+    
+    bool loadSeries ( int iplanet );
     
 public:
+    VSOP2013 ( void );
+
+    // Series read from files point into this object's terms[], so it can't be copied or assigned.
+
+    VSOP2013 ( const VSOP2013 &other ) = delete;
+    VSOP2013 &operator = ( const VSOP2013 &other ) = delete;
+    
+    // Each planet's series are loaded on first use: packed from embedded series, or read from the data file
+    // set with setDataFile(). unloadSeries() frees a planet's series (iplanet = 0 frees all) until next used;
+    // don't call it while other threads are computing that planet. getResidentSize() returns the heap memory
+    // currently used by a planet's series, in bytes; embedded series themselves are in read-only storage
+    // and use no heap.
+    
+    void setDataFile ( int iplanet, const string &filename );
+    bool isLoaded ( int iplanet );
+    void unloadSeries ( int iplanet );
+    size_t getResidentSize ( int iplanet );
+    
     void evalLongitudes ( double t, double ll[17] );
     double evalSeries ( double t, const VSOP2013Series &ser, double ll[17] );
+
+    // Packed (structure-of-arrays) series evaluation. When enabled, all orbit
+    // computations go through evalPackedSeries(), which uses SIMD where available.
+    // Positions agree with the evalSeries() path to about 2.0e-12 relative.
+    
+    static void usePackedSeries ( bool use );
+    static bool usePackedSeries ( void );
+    static bool simdAvailable ( void );
+    static vector<VSOP2013PackedSeries> packSeries ( initializer_list<SSSpan<VSOP2013Series>> series );
+    static double evalPackedSeries ( double t, const VSOP2013PackedSeries &ser );
+    static double evalPackedSeries ( double t, const VSOP2013PackedSeries &ser, double &rate );
+
+    // Sets or returns packed series precision, in radians: each series is truncated where the
+    // root-sum-square amplitude of the omitted terms, times t^it, falls below this. Zero (the
+    // default) evaluates every term.
+    
+    static void setPrecision ( double prec );
+    static double getPrecision ( void );
+    SSOrbit getOrbit ( int iplanet, double jed, const vector<VSOP2013PackedSeries> &series );
+    SSOrbit toOrbit ( int iplanet, double jed, double a, double l, double k, double h, double q, double p );
+
     void printSeries ( ostream &out, const vector<VSOP2013Series> &planet );
     int readFile ( const string &filename, int iplanet );
     SSOrbit getOrbit ( int iplanet, double jed );
     double getMeanMotion ( int iplanet, double a );
     SSVector toEquatorial ( SSVector ecl );
+    // Computes heliocentric J2000 equatorial position and velocity. With packed series, velocity is the exact
+    // derivative of the series, evaluated in the same pass as position; otherwise, it's from the osculating orbit.
+    
     bool computePositionVelocity ( int iplanet, double jed, SSVector &pos, SSVector &vel );
+    bool getElements ( int iplanet, double jed, double elem[6], double rate[6] );
+    static void toPositionVelocity ( const double elem[6], const double rate[6], SSVector &pos, SSVector &vel );
+    
+    // Batch time-series evaluation. On evenly spaced times, each term's sine and cosine are advanced by
+    // angle-addition recurrence instead of being recomputed at every time, which is about ten times faster.
+    // Batches always use packed series; results agree with single-time packed evaluation to about 1.0e-12,
+    // most of which comes from rounding each time to a double-precision JED for the single-time path.
+    
+    static void evalPackedSeries ( double t0, double dt, int n, const VSOP2013PackedSeries &ser, double *sums, double *rates = nullptr );
+    const vector<VSOP2013PackedSeries> &getPackedSeries ( int iplanet );
+    bool getOrbits ( int iplanet, double jed0, double step, int n, vector<SSOrbit> &orbits );
+    bool computePositionVelocity ( int iplanet, double jed0, double step, int n, vector<SSVector> &pos, vector<SSVector> &vel );
+    bool computePositionVelocity ( int iplanet, const vector<double> &jeds, vector<SSVector> &pos, vector<SSVector> &vel );
     
 #if VSOP2013_EMBED_SERIES
+    // These return newly packed copies of each planet's embedded series.
+    
+    vector<VSOP2013PackedSeries> mercuryPackedSeries ( void );
+    vector<VSOP2013PackedSeries> venusPackedSeries ( void );
+    vector<VSOP2013PackedSeries> earthPackedSeries ( void );
+    vector<VSOP2013PackedSeries> marsPackedSeries ( void );
+    vector<VSOP2013PackedSeries> jupiterPackedSeries ( void );
+    vector<VSOP2013PackedSeries> saturnPackedSeries ( void );
+    vector<VSOP2013PackedSeries> uranusPackedSeries ( void );
+    vector<VSOP2013PackedSeries> neptunePackedSeries ( void );
+    vector<VSOP2013PackedSeries> plutoPackedSeries ( void );
+
     SSOrbit mercuryOrbit ( double jed );
     SSOrbit venusOrbit ( double jed );
     SSOrbit earthOrbit ( double jed );      // Earth-Moon barycenter
@@ -1,8 +1,7 @@
 #include "VSOP2013.hpp"
 #if VSOP2013_EMBED_SERIES
 
-static vector<VSOP2013Series> _a = {
-{   1,   1,   0, 322, {
+static constexpr VSOP2013Term _a0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.870983098840000e-01 },
 {   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +7.134020401409140e-07, -1.652072785401277e-07 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.439283395053392e-07, +2.709202267017637e-07 },
@@ -324,9 +323,10 @@ static vector<VSOP2013Series> _a = {
 {  13, -18,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.565528177801004e-11, -5.740177360679818e-11 },
 {   7,   0, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.915527425798986e-11, +4.384741396535120e-11 },
 {   9,   0,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.287060036509708e-11, +2.938053763714101e-11 },
-{   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0,   0, -8.540016592634644e-12, +6.181964115466553e-11 },
-} },
-{   1,   1,   1, 205, {
+{   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0,   0, -8.540016592634644e-12, +6.181964115466553e-11 }
+};
+
+static constexpr VSOP2013Term _a1[] = {
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.755131985562522e-08, -2.331509638928640e-08 },
 {   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.740286012626052e-09, +2.014213815081629e-08 },
 {   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.077686245267941e-08, +7.179562743163701e-09 },
@@ -531,9 +531,10 @@ static vector<VSOP2013Series> _a = {
 {   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0, -1.962070786312877e-11, -1.119910228318012e-11 },
 {  10, -16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.626156668629632e-12, -2.691097171965843e-11 },
 {   4,   0,   0,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0,   0,   0, +1.974874311496185e-11, +9.661000245228749e-12 },
-{   7, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.320283977147167e-11, +1.555339560814285e-11 },
-} },
-{   1,   1,   2, 111, {
+{   7, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.320283977147167e-11, +1.555339560814285e-11 }
+};
+
+static constexpr VSOP2013Term _a2[] = {
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.143657642356183e-09, -1.318981952862366e-09 },
 {   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.167854115104720e-10, -3.533663800087843e-10 },
 {   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.550034550633224e-10, +2.455220980896832e-10 },
@@ -644,9 +645,10 @@ static vector<VSOP2013Series> _a = {
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0,   0, -3.224854636852336e-12, +4.776302507208777e-12 },
 {   3,   0,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +7.502527781242494e-12, -4.108600360028943e-13 },
 {   9, -12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.924493991311430e-12, -3.863716596538870e-12 },
-{   6,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.584957409475126e-12, -2.103179326851755e-12 },
-} },
-{   1,   1,   3,  50, {
+{   6,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.584957409475126e-12, -2.103179326851755e-12 }
+};
+
+static constexpr VSOP2013Term _a3[] = {
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.918037064502018e-11, +4.155558909842423e-11 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +1.164454138673907e-11, +7.375051458008809e-12 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +1.115980734915942e-11, -7.398810428244633e-12 },
@@ -696,9 +698,10 @@ static vector<VSOP2013Series> _a = {
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -9.980300853315626e-13, -4.355888685710817e-13 },
 {   3,   0,   0,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, +1.416542807548862e-12, -5.087031845892792e-15 },
 {   4, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -9.657840386978939e-13, +4.538518524526358e-13 },
-{   2,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +7.621406379779376e-13, -5.753152941602615e-13 },
-} },
-{   1,   1,   4,  21, {
+{   2,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +7.621406379779376e-13, -5.753152941602615e-13 }
+};
+
+static constexpr VSOP2013Term _a4[] = {
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.313068034713595e-12, +1.313742158688771e-12 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -9.704324601223236e-13, +1.067961795659493e-12 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -9.847075009686876e-13, -1.007611224837694e-12 },
@@ -719,9 +722,10 @@ static vector<VSOP2013Series> _a = {
 {   3,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -1.512769100326114e-13, -9.511145677750077e-14 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +1.251404579276708e-13, +1.098782097380207e-13 },
 {   3,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.146699560504331e-13, +1.122481542966849e-13 },
-{   2,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   3,   0,   0,   0,   0,   0,   0, +9.951290707024000e-14, +1.204736393854526e-13 },
-} },
-{   1,   1,   5,  10, {
+{   2,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   3,   0,   0,   0,   0,   0,   0, +9.951290707024000e-14, +1.204736393854526e-13 }
+};
+
+static constexpr VSOP2013Term _a5[] = {
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -7.275364763076545e-14, -9.949957508576064e-14 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -6.617456380535364e-14, +1.021817399304613e-13 },
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -7.026011118752450e-14, +9.132217272162853e-14 },
@@ -731,20 +735,32 @@ static vector<VSOP2013Series> _a = {
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, +2.167563630870180e-14, -3.685814760936785e-14 },
 {   3,   0,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +2.234661990121226e-14, +2.550437235600706e-14 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,   2, -10,   0,   0,   0,   0,   0,   0, +1.385105595643800e-14, +2.063615451334129e-14 },
-{   1,   0,   0,   0,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, -2.357981077807646e-14, -6.876851268946760e-15 },
-} },
-{   1,   1,   6,   4, {
+{   1,   0,   0,   0,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, -2.357981077807646e-14, -6.876851268946760e-15 }
+};
+
+static constexpr VSOP2013Term _a6[] = {
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +6.392400336505513e-15, +8.677662644708159e-15 },
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -5.825374881806129e-15, -6.813668562562698e-15 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +8.402324816048419e-15, -3.598370822471985e-15 },
-{   2,   0,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +8.728657425262324e-15, +2.960785492993340e-15 },
-} },
-{   1,   1,   7,   1, {
-{   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.194388645205459e-16, +6.339240068748700e-16 },
-} } };
+{   2,   0,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +8.728657425262324e-15, +2.960785492993340e-15 }
+};
 
-static vector<VSOP2013Series> _l = {
-{   1,   2,   0, 282, {
+static constexpr VSOP2013Term _a7[] = {
+{   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.194388645205459e-16, +6.339240068748700e-16 }
+};
+
+static constexpr VSOP2013Series _a[] = {
+{   1,   1,   0, 322, _a0 },
+{   1,   1,   1, 205, _a1 },
+{   1,   1,   2, 111, _a2 },
+{   1,   1,   3,  50, _a3 },
+{   1,   1,   4,  21, _a4 },
+{   1,   1,   5,  10, _a5 },
+{   1,   1,   6,   4, _a6 },
+{   1,   1,   7,   1, _a7 }
+};
+
+static constexpr VSOP2013Term _l0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.402608631669000e+00 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.642015105471128e-05, -2.382707472808938e-05 },
 {   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.940312272049771e-06, +1.686988542736688e-05 },
@@ -1026,9 +1042,10 @@ static vector<VSOP2013Series> _l = {
 {  11, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.756209588028632e-10, -4.462146773728686e-10 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, +6.277451234035734e-10, +7.766899151661170e-10 },
 {   2,  -8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.269649260833103e-10, +1.126078092019666e-09 },
-{   4, -17,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.023362769062304e-10, -4.282106034911469e-10 },
-} },
-{   1,   2,   1, 174, {
+{   4, -17,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.023362769062304e-10, -4.282106034911469e-10 }
+};
+
+static constexpr VSOP2013Term _l1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.608790314068555e+04 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.276615245307316e-06, -2.684794569786837e-06 },
 {   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.787238351955830e-07, +1.391831900282937e-07 },
@@ -1202,9 +1219,10 @@ static vector<VSOP2013Series> _l = {
 {   9, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.681025116752007e-10, +3.089085529931512e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0, -1.357251807299639e-10, -3.387445767739194e-10 },
 {   8,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.700706812935467e-10, -3.023069810927357e-10 },
-{   4,   0,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +3.859898361304079e-10, +7.655751947731767e-11 },
-} },
-{   1,   2,   2,  95, {
+{   4,   0,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +3.859898361304079e-10, +7.655751947731767e-11 }
+};
+
+static constexpr VSOP2013Term _l2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -8.653050353289743e-06 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.282517685152912e-07, +1.114909193566599e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.637337213143905e-08, -9.358045437926292e-09 },
@@ -1299,9 +1317,10 @@ static vector<VSOP2013Series> _l = {
 {   3,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.329003517626762e-11, -8.965047020557612e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   0,   0, +9.503784883019183e-11, +2.414582747325551e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, +1.427956864046441e-11, -1.032193121850980e-10 },
-{   4, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +7.537696406984847e-11, -3.704968756740736e-11 },
-} },
-{   1,   2,   3,  44, {
+{   4, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +7.537696406984847e-11, -3.704968756740736e-11 }
+};
+
+static constexpr VSOP2013Term _l3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.664455639601079e-07 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.037850032887796e-09, +4.783112346055039e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.531858089711223e-09, -2.029882056707724e-09 },
@@ -1345,9 +1364,10 @@ static vector<VSOP2013Series> _l = {
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, +1.664299669942959e-11, -2.013647131153609e-11 },
 {   5, -12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.127875343327023e-11, +2.460639049540617e-11 },
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, +3.228727695732620e-11, +3.007772928727687e-12 },
-{   2,   0,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +1.766975877477287e-11, +1.561971585605785e-11 },
-} },
-{   1,   2,   4,  20, {
+{   2,   0,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +1.766975877477287e-11, +1.561971585605785e-11 }
+};
+
+static constexpr VSOP2013Term _l4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +8.420828071160617e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.811743495506656e-10, +1.896196081585504e-10 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.276894998462835e-10, -1.273696590494839e-10 },
@@ -1367,9 +1387,10 @@ static vector<VSOP2013Series> _l = {
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -4.954466903827159e-12, -4.509701284375407e-12 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +4.681912007027361e-12, -4.568152016688863e-12 },
 {   3,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.014120432275816e-12, +6.108909427196092e-12 },
-{   1,   0,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -5.430402359883499e-12, -3.233944797108196e-12 },
-} },
-{   1,   2,   5,  10, {
+{   1,   0,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -5.430402359883499e-12, -3.233944797108196e-12 }
+};
+
+static constexpr VSOP2013Term _l5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.339234576888984e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.880792301829404e-11, +1.188572820114440e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +5.734445469712739e-12, -2.766611047016847e-12 },
@@ -1379,21 +1400,33 @@ static vector<VSOP2013Series> _l = {
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.143860898375161e-12, -7.988652443584007e-13 },
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -7.845327410067059e-13, -6.096458348631814e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, -5.116693334435485e-13, +6.763706966990134e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, +2.358415910473888e-13, +9.446464000757025e-13 },
-} },
-{   1,   2,   6,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, +2.358415910473888e-13, +9.446464000757025e-13 }
+};
+
+static constexpr VSOP2013Term _l6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.896905508714758e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, +2.623527466381246e-12, -1.803032649715574e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -5.472625846204316e-13, -1.560841591833278e-12 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.465792538825238e-13, +6.215540606058614e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +2.494332237998997e-13, +8.321399871865774e-13 },
-} },
-{   1,   2,   7,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.431484836388532e-13 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +2.494332237998997e-13, +8.321399871865774e-13 }
+};
+
+static constexpr VSOP2013Term _l7[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.431484836388532e-13 }
+};
 
-static vector<VSOP2013Series> _k = {
-{   1,   3,   0, 236, {
+static constexpr VSOP2013Series _l[] = {
+{   1,   2,   0, 282, _l0 },
+{   1,   2,   1, 174, _l1 },
+{   1,   2,   2,  95, _l2 },
+{   1,   2,   3,  44, _l3 },
+{   1,   2,   4,  20, _l4 },
+{   1,   2,   5,  10, _l5 },
+{   1,   2,   6,   5, _l6 },
+{   1,   2,   7,   1, _l7 }
+};
+
+static constexpr VSOP2013Term _k0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.466062941700000e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +7.052282000033976e-06, +1.495412395749504e-06 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.715811436720008e-06, -2.904746012591218e-06 },
@@ -1629,9 +1662,10 @@ static vector<VSOP2013Series> _k = {
 {   2,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -9.441083341126260e-10, +2.831161623303520e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   0,   0, +9.412182539584509e-10, -2.820305522212538e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0, -2.862617192528431e-10, -9.144368096325799e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0, -1.009884361027273e-09, +1.769568594786657e-10 },
-} },
-{   1,   3,   1, 143, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0, -1.009884361027273e-09, +1.769568594786657e-10 }
+};
+
+static constexpr VSOP2013Term _k1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.521455127763387e-03 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.810258815190993e-07, -1.170922224711110e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +4.023421282762885e-08, -1.972783636192053e-07 },
@@ -1774,9 +1808,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -1.764453964317127e-10, -2.155649074867564e-10 },
 {   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -5.633721222885717e-11, +3.316339273493664e-10 },
 {   4,   0,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.019462761583431e-11, -3.017880772396403e-10 },
-{   6,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.584025719406717e-10, -1.212194150899384e-10 },
-} },
-{   1,   3,   2,  76, {
+{   6,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.584025719406717e-10, -1.212194150899384e-10 }
+};
+
+static constexpr VSOP2013Term _k2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.860176830365075e-05 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.373104327704233e-09, +5.929809013130840e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -2.508166819730315e-09, -3.290910630767397e-09 },
@@ -1852,9 +1887,10 @@ static vector<VSOP2013Series> _k = {
 {   3,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.630048527838523e-11, -7.831845241410574e-12 },
 {   1,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.708895323014454e-11, +2.630770787970363e-11 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.036137130410259e-11, +6.834764290762701e-11 },
-{   1,   0,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.356279769157867e-11, +6.419523925023788e-11 },
-} },
-{   1,   3,   3,  35, {
+{   1,   0,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.356279769157867e-11, +6.419523925023788e-11 }
+};
+
+static constexpr VSOP2013Term _k3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.899613605259872e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +1.807859843700311e-10, +5.497413372368833e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.206603467623830e-10, -3.967720440099062e-10 },
@@ -1889,9 +1925,10 @@ static vector<VSOP2013Series> _k = {
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +1.331335221455324e-11, -1.386778144551981e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0, +1.606574019561586e-11, +7.724265317678894e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0, -1.021385105156785e-11, -1.263640685824672e-11 },
-{   1,   0,   0,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, +1.801125855270142e-11, +3.714996661932550e-12 },
-} },
-{   1,   3,   4,  17, {
+{   1,   0,   0,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, +1.801125855270142e-11, +3.714996661932550e-12 }
+};
+
+static constexpr VSOP2013Term _k4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.759153129057756e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +5.725776803971088e-11, -2.957037791558027e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.403606571031554e-11, +2.915906730732215e-11 },
@@ -1908,9 +1945,10 @@ static vector<VSOP2013Series> _k = {
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -3.963670292747425e-12, +4.109530242633251e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +6.323081011184994e-12, -1.642975959520058e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -12,   0,   0,   0,   0,   0,   0, -3.602759371843311e-12, -2.576559905206401e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   0,   0, -3.641665819398678e-12, -1.877689999044789e-12 },
-} },
-{   1,   3,   5,   8, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   0,   0, -3.641665819398678e-12, -1.877689999044789e-12 }
+};
+
+static constexpr VSOP2013Term _k5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.519601904296424e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, -3.578547435967009e-12, -4.604057826500020e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.967065676795100e-12, +2.243715047729823e-12 },
@@ -1918,20 +1956,32 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, -1.194455502624666e-12, +1.337049377981570e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   5,   0,   0,   0,   0,   0,   0, -3.446794310799512e-13, -1.596550987761296e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +9.743928209492855e-13, -7.184031547602088e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -10,   0,   0,   0,   0,   0,   0, -1.213940259080538e-12, +3.457711537369756e-13 },
-} },
-{   1,   3,   6,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -10,   0,   0,   0,   0,   0,   0, -1.213940259080538e-12, +3.457711537369756e-13 }
+};
+
+static constexpr VSOP2013Term _k6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.130216511048746e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, -2.929207570186048e-13, +3.468082449626388e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.151281072672803e-13, -2.472484252415490e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +5.485194506841213e-15, +2.245246554084521e-13 },
-} },
-{   1,   3,   7,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.411992876207433e-13 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +5.485194506841213e-15, +2.245246554084521e-13 }
+};
+
+static constexpr VSOP2013Term _k7[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.411992876207433e-13 }
+};
+
+static constexpr VSOP2013Series _k[] = {
+{   1,   3,   0, 236, _k0 },
+{   1,   3,   1, 143, _k1 },
+{   1,   3,   2,  76, _k2 },
+{   1,   3,   3,  35, _k3 },
+{   1,   3,   4,  17, _k4 },
+{   1,   3,   5,   8, _k5 },
+{   1,   3,   6,   4, _k6 },
+{   1,   3,   7,   1, _k7 }
+};
 
-static vector<VSOP2013Series> _h = {
-{   1,   4,   0, 236, {
+static constexpr VSOP2013Term _h0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.007233087310000e-01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +1.462474987448847e-06, -7.076701462520828e-06 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.004333949585185e-06, -1.850005796839090e-06 },
@@ -2167,9 +2217,10 @@ static vector<VSOP2013Series> _h = {
 {   3,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.167289920643323e-09, +5.789246365577064e-11 },
 {   9,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.695897448818382e-10, +6.061872974629724e-10 },
 {   7,   0,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.493845648787716e-10, -4.256713963483680e-10 },
-{  10, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.741790206383829e-10, +7.955277487378140e-10 },
-} },
-{   1,   4,   1, 146, {
+{  10, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.741790206383829e-10, +7.955277487378140e-10 }
+};
+
+static constexpr VSOP2013Term _h1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.437550757037212e-03 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.341447802238685e-07, +1.912649138044491e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -1.985198856040492e-07, -4.198366734892758e-08 },
@@ -2315,9 +2366,10 @@ static vector<VSOP2013Series> _h = {
 {   6, -14,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.245286241417051e-10, -2.645395290063709e-10 },
 {   3,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, +7.027457299796759e-11, -3.083290826963477e-10 },
 {   3, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.169756907035033e-10, +5.327241023394795e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   5,   0,   0,   0,   0,   0,   0, -3.579097846099250e-10, +1.225778588199526e-11 },
-} },
-{   1,   4,   2,  77, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   5,   0,   0,   0,   0,   0,   0, -3.579097846099250e-10, +1.225778588199526e-11 }
+};
+
+static constexpr VSOP2013Term _h2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -7.974840632101417e-05 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.531509692741810e-09, +4.501981595939004e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -3.299144610492425e-09, +2.522276818481878e-09 },
@@ -2394,9 +2446,10 @@ static vector<VSOP2013Series> _h = {
 {   1,   0,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.636821517567249e-11, +1.454029805801986e-11 },
 {   5,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.051044889204085e-11, -5.035538180959912e-11 },
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -6.336746981581213e-11, -1.515195136985006e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.320461874287817e-11, +5.727811785770006e-11 },
-} },
-{   1,   4,   3,  35, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.320461874287817e-11, +5.727811785770006e-11 }
+};
+
+static constexpr VSOP2013Term _h3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.031357937028700e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +5.510938714974443e-10, -1.827047534607134e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +2.574802714608929e-10, +2.803398873508874e-10 },
@@ -2431,9 +2484,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0, -1.262111049174649e-11, +1.049061882489344e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, -1.293266882114689e-11, -9.425801109005667e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -9,   0,   0,   0,   0,   0,   0, -9.207783332143017e-12, -1.182618652237832e-11 },
-{   1,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.776903051368325e-12, +1.223067341378745e-11 },
-} },
-{   1,   4,   4,  17, {
+{   1,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.776903051368325e-12, +1.223067341378745e-11 }
+};
+
+static constexpr VSOP2013Term _h4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.765131698346629e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, -2.973670989688513e-11, -5.743371248712949e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -3.233467001591201e-11, +1.935715351733235e-11 },
@@ -2450,9 +2504,10 @@ static vector<VSOP2013Series> _h = {
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.134233126289961e-12, -2.298871754286345e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -12,   0,   0,   0,   0,   0,   0, +2.568070629578714e-12, -3.587325192812518e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +2.068750385055706e-12, +3.738294750216915e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +3.810626242697196e-12, +1.866757109610468e-12 },
-} },
-{   1,   4,   5,   8, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +3.810626242697196e-12, +1.866757109610468e-12 }
+};
+
+static constexpr VSOP2013Term _h5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -7.855265219683982e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, -4.624720580181505e-12, +3.589000490251154e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -9.050320191708434e-13, -2.950208987784487e-12 },
@@ -2460,20 +2515,32 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   5,   0,   0,   0,   0,   0,   0, -1.599078478678141e-12, +3.486102556362667e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -10,   0,   0,   0,   0,   0,   0, +3.564714054183160e-13, +1.209938677702164e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +9.824836934405819e-13, -5.500213621303824e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, -10,   0,   0,   0,   0,   0,   0, -7.546774254684337e-13, -6.735961598684238e-13 },
-} },
-{   1,   4,   6,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, -10,   0,   0,   0,   0,   0,   0, -7.546774254684337e-13, -6.735961598684238e-13 }
+};
+
+static constexpr VSOP2013Term _h6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.943370147057729e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +3.472449485823355e-13, +2.951040709298829e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +2.242783289765190e-13, -7.521607371759341e-15 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, -10,   0,   0,   0,   0,   0,   0, +1.139577753605892e-13, -9.131184746476315e-14 },
-} },
-{   1,   4,   7,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.107995498240579e-14 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, -10,   0,   0,   0,   0,   0,   0, +1.139577753605892e-13, -9.131184746476315e-14 }
+};
 
-static vector<VSOP2013Series> _q = {
-{   1,   5,   0,  69, {
+static constexpr VSOP2013Term _h7[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.107995498240579e-14 }
+};
+
+static constexpr VSOP2013Series _h[] = {
+{   1,   4,   0, 236, _h0 },
+{   1,   4,   1, 146, _h1 },
+{   1,   4,   2,  77, _h2 },
+{   1,   4,   3,  35, _h3 },
+{   1,   4,   4,  17, _h4 },
+{   1,   4,   5,   8, _h5 },
+{   1,   4,   6,   4, _h6 },
+{   1,   4,   7,   1, _h7 }
+};
+
+static constexpr VSOP2013Term _q0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.061564059600001e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +2.664040056450221e-07, +2.941930918381553e-07 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.118223958894232e-07, -2.398756962916450e-08 },
@@ -2542,9 +2609,10 @@ static vector<VSOP2013Series> _q = {
 {   1,   0,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.790933309699827e-10, -1.658159932638917e-09 },
 {   0,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.279881671580818e-10, -1.649032217840641e-09 },
 {   4,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.220117260145419e-09, -4.203309769594790e-10 },
-{   2,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.457321338592221e-09, +1.728602181120390e-10 },
-} },
-{   1,   5,   1,  38, {
+{   2,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.457321338592221e-09, +1.728602181120390e-10 }
+};
+
+static constexpr VSOP2013Term _q1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.543150544460608e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -9.190739705841426e-09, +7.587510343441174e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +4.051003358956945e-09, -3.320373511954389e-09 },
@@ -2582,9 +2650,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, +1.647074649632194e-10, +1.951114132913084e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, -2.485532996026291e-10, +8.827155477632560e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   0,   0,   0, +2.982700605717278e-10, +3.686409651554367e-11 },
-{   1,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.237117040060086e-10, +1.878893483329197e-10 },
-} },
-{   1,   5,   2,  17, {
+{   1,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.237117040060086e-10, +1.878893483329197e-10 }
+};
+
+static constexpr VSOP2013Term _q2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.071265646582313e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.658158773347864e-10, +3.182761011110988e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +6.799950113548956e-11, +2.016853538967717e-10 },
@@ -2601,9 +2670,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, -4.292939495348520e-11, +2.392896435356872e-11 },
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.100671159963907e-11, +1.147239471751001e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, +4.003168170908668e-11, -2.137268794428221e-11 },
-{   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.289300090363409e-11, -8.536447965795547e-12 },
-} },
-{   1,   5,   3,   9, {
+{   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.289300090363409e-11, -8.536447965795547e-12 }
+};
+
+static constexpr VSOP2013Term _q3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.244469068144186e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -4.981901617012320e-11, +4.210438078220930e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -3.084626523978899e-11, +5.820914165347767e-12 },
@@ -2612,20 +2682,30 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, +9.462435883671549e-12, +1.087300955769630e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, -1.819923579984264e-12, -6.089001746467454e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +4.572216360760522e-12, -3.329749433056383e-12 },
-{   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.311527514805879e-12, +6.565956556830517e-12 },
-} },
-{   1,   5,   4,   4, {
+{   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.311527514805879e-12, +6.565956556830517e-12 }
+};
+
+static constexpr VSOP2013Term _q4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.797849791778796e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -3.366070872017506e-12, -5.906423736603097e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -9.603603929259269e-14, -3.493902340218119e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +2.064915618721318e-12, -9.594998869219814e-16 },
-} },
-{   1,   5,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.978526773498540e-11 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +2.064915618721318e-12, -9.594998869219814e-16 }
+};
 
-static vector<VSOP2013Series> _p = {
-{   1,   6,   0,  80, {
+static constexpr VSOP2013Term _q5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.978526773498540e-11 }
+};
+
+static constexpr VSOP2013Series _q[] = {
+{   1,   5,   0,  69, _q0 },
+{   1,   5,   1,  38, _q1 },
+{   1,   5,   2,  17, _q2 },
+{   1,   5,   3,   9, _q3 },
+{   1,   5,   4,   4, _q4 },
+{   1,   5,   5,   1, _q5 }
+};
+
+static constexpr VSOP2013Term _p0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.563549330800001e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +3.724565583598006e-07, -2.876333930779383e-07 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.679501643354155e-08, -1.994236967978576e-07 },
@@ -2705,9 +2785,10 @@ static vector<VSOP2013Series> _p = {
 {   1,   0,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.069102906694189e-09, +4.675888201347167e-11 },
 {   2,   0,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.578313438212057e-10, -1.384520784507719e-09 },
 {   2,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.112948580481775e-11, +1.570919126238164e-09 },
-{   5,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.096992712549034e-09, +5.360479910552830e-10 },
-} },
-{   1,   6,   1,  44, {
+{   5,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.096992712549034e-09, +5.360479910552830e-10 }
+};
+
+static constexpr VSOP2013Term _p1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.276365552465256e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +6.812147226005045e-09, +7.008082103269810e-09 },
 {   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +7.950293020627870e-09, +7.037534106135839e-10 },
@@ -2751,9 +2832,10 @@ static vector<VSOP2013Series> _p = {
 {   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.171188154242066e-11, +2.988515927543870e-10 },
 {   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.910930889575870e-10, +1.063743656367585e-10 },
 {   2,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.631626712165092e-10, -3.044117436762557e-11 },
-{   4,  -8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.389211153931128e-11, -1.956458673441573e-10 },
-} },
-{   1,   6,   2,  21, {
+{   4,  -8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.389211153931128e-11, -1.956458673441573e-10 }
+};
+
+static constexpr VSOP2013Term _p2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.135017283432294e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -6.500583727537940e-10, -2.517590316995216e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +1.858566471692340e-10, +3.026752155203927e-10 },
@@ -2774,9 +2856,10 @@ static vector<VSOP2013Series> _p = {
 {   4, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.753135746913787e-11, +3.311944510934065e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   5,   0,   0,   0,   0,   0,   0, -2.542709898775185e-11, +3.028076398685972e-11 },
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.815628460453666e-12, +4.956340251370635e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0, -4.123049775508633e-11, +1.102424553898449e-11 },
-} },
-{   1,   6,   3,  10, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0, -4.123049775508633e-11, +1.102424553898449e-11 }
+};
+
+static constexpr VSOP2013Term _p3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.893983254292155e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.760956668127237e-11, -8.468636493069211e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +4.190700829143866e-12, +3.488274760158763e-11 },
@@ -2786,44 +2869,63 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, -7.624286050937649e-12, +5.594555797013238e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, +2.414031902379288e-12, -1.034689558938666e-11 },
 {   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.092388110424072e-12, +8.655512476348866e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, +7.691930212176909e-12, -3.413810762029171e-12 },
-} },
-{   1,   6,   4,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, +7.691930212176909e-12, -3.413810762029171e-12 }
+};
+
+static constexpr VSOP2013Term _p4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.387806404167506e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +8.400222415976409e-12, +4.417781123612964e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -3.851658676434847e-12, -1.298386372359780e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +3.918995954393950e-13, -2.688744364452227e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -9.936136070773287e-13, -9.632414505520545e-13 },
-} },
-{   1,   6,   5,   2, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -9.936136070773287e-13, -9.632414505520545e-13 }
+};
+
+static constexpr VSOP2013Term _p5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.031582889230913e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -4.356027246290974e-13, +6.795547901342330e-13 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -4.356027246290974e-13, +6.795547901342330e-13 }
+};
+
+static constexpr VSOP2013Series _p[] = {
+{   1,   6,   0,  80, _p0 },
+{   1,   6,   1,  44, _p1 },
+{   1,   6,   2,  21, _p2 },
+{   1,   6,   3,  10, _p3 },
+{   1,   6,   4,   5, _p4 },
+{   1,   6,   5,   2, _p5 }
+};
+
+vector<VSOP2013PackedSeries> VSOP2013::mercuryPackedSeries ( void )
+{
+    return packSeries ( { _a, _l, _k, _h, _q, _p } );
+}
 
 SSOrbit VSOP2013::mercuryOrbit ( double jed )
 {
+    if ( usePackedSeries() )
+        return getOrbit ( 1, jed, getPackedSeries ( 1 ) );
+    
     double a = 0.0, l = 0.0, k = 0.0, h = 0.0, q = 0.0, p = 0.0;
     double t = ( jed - 2451545.0 ) / 365250.0;
     double ll[17] = { 0 };
     
     evalLongitudes ( t, ll );
 
-    for ( VSOP2013Series &series : _a )
+    for ( const VSOP2013Series &series : _a )
         a += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _l )
+    for ( const VSOP2013Series &series : _l )
         l += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _k )
+    for ( const VSOP2013Series &series : _k )
         k += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _h )
+    for ( const VSOP2013Series &series : _h )
         h += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _q )
+    for ( const VSOP2013Series &series : _q )
         q += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _p )
+    for ( const VSOP2013Series &series : _p )
         p += evalSeries ( t, series, ll );
     
     double e = sqrt ( k * k + h * h );  // eccentricity
@@ -1,8 +1,7 @@
 #include "VSOP2013.hpp"
 #if VSOP2013_EMBED_SERIES
 
-static vector<VSOP2013Series> _a = {
-{   2,   1,   0, 324, {
+static constexpr VSOP2013Term _a0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.233298199450000e-01 },
 {   0,   2,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.576210079946264e-10, +4.322657013014351e-06 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -2.079643371026511e-09, +2.939798258802545e-06 },
@@ -326,9 +325,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   3,  -4,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -9.825990726153300e-12, -3.221510285853297e-10 },
 {   0,   7,   0, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.581500827138611e-10, +7.058886598390259e-11 },
 {   0,   4,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.507065638099134e-10, -7.551911385284866e-11 },
-{   6,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.103974469201875e-10, +2.147243874335401e-10 },
-} },
-{   2,   1,   1, 205, {
+{   6,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.103974469201875e-10, +2.147243874335401e-10 }
+};
+
+static constexpr VSOP2013Term _a1[] = {
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.856829065023917e-08, -8.938613308665014e-08 },
 {   0,   3,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.057601170811042e-08, -3.254676546140384e-08 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -2.363322163399515e-08, +1.129337736398970e-08 },
@@ -533,9 +533,10 @@ static vector<VSOP2013Series> _a = {
 {   6,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +6.457722270340964e-11, +5.656528314726633e-11 },
 {   0,   6,   0,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.993254776380407e-11, +9.996512091617848e-11 },
 {   5,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.758634614451649e-11, -9.218336474328731e-11 },
-{   0,   2,   0,   0,   0,   0,   0,   0,   0,  -2,  -2,   0,   0,   0,   0,   0,   0, +4.545252335756405e-11, -7.265535002277210e-11 },
-} },
-{   2,   1,   2, 113, {
+{   0,   2,   0,   0,   0,   0,   0,   0,   0,  -2,  -2,   0,   0,   0,   0,   0,   0, +4.545252335756405e-11, -7.265535002277210e-11 }
+};
+
+static constexpr VSOP2013Term _a2[] = {
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.072940934904896e-09, +1.922719651044657e-09 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.334507432133202e-10, -4.165954888552100e-09 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -1.237062148276226e-09, -1.229873832165826e-09 },
@@ -648,9 +649,10 @@ static vector<VSOP2013Series> _a = {
 {   3,  -8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.424739468196661e-12, +3.919923982689597e-11 },
 {   0,   7,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.681693658883981e-11, -6.444607044914644e-12 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0,   0, +2.212435674672581e-11, -1.981116818779294e-11 },
-{   0,   3,   0,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.235474142448486e-11, +2.926630238165533e-11 },
-} },
-{   2,   1,   3,  53, {
+{   0,   3,   0,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.235474142448486e-11, +2.926630238165533e-11 }
+};
+
+static constexpr VSOP2013Term _a3[] = {
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +1.667693439880883e-10, +1.029764388068326e-10 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +1.579552714099093e-10, -1.056126373006791e-10 },
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.628004234160225e-11, +1.415176433378138e-10 },
@@ -703,9 +705,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,  -3,   5,   0,   0,   0,   0,   0,   0, +5.483391051263978e-12, -3.410201695536018e-12 },
 {   0,   2,   0,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.067487022799396e-13, -7.938867711519385e-12 },
 {   0,   6,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.031087945347138e-12, -3.797765591833604e-12 },
-{   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.091710888541342e-12, +3.724055866204893e-12 },
-} },
-{   2,   1,   4,  21, {
+{   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.091710888541342e-12, +3.724055866204893e-12 }
+};
+
+static constexpr VSOP2013Term _a4[] = {
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -1.361789848330487e-11, +1.533251551686524e-11 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -1.404081222911813e-11, -1.424409673501121e-11 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.264019592408853e-12, +1.046576739601372e-11 },
@@ -726,9 +729,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +9.308268354991317e-13, +1.763384456592877e-12 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -4,   0,   0,   0,   0,   0,   0,   0, +1.801885224896843e-12, +8.568772865220314e-13 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, -8.890329486794456e-13, +1.759737730617656e-12 },
-{   0,   3,   0,   0,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, -8.924974416443878e-13, +1.503391143753953e-12 },
-} },
-{   2,   1,   5,   9, {
+{   0,   3,   0,   0,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, -8.924974416443878e-13, +1.503391143753953e-12 }
+};
+
+static constexpr VSOP2013Term _a5[] = {
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -1.050463714284185e-12, -1.400661680798903e-12 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -9.323968580162507e-13, +1.456028030024053e-12 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -6.463021200265849e-13, -4.476272134386057e-13 },
@@ -737,20 +741,32 @@ static vector<VSOP2013Series> _a = {
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,   2, -10,   0,   0,   0,   0,   0,   0, +2.085018704808835e-13, +2.890710152363424e-13 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -3.100995675408444e-13, +1.235963238994279e-13 },
 {   0,   3,   0,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -1.795124181947394e-13, -2.298866142896698e-13 },
-{   0,   3,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -1.524987877072339e-13, +2.563331974054802e-13 },
-} },
-{   2,   1,   6,   4, {
+{   0,   3,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -1.524987877072339e-13, +2.563331974054802e-13 }
+};
+
+static constexpr VSOP2013Term _a6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.472376638460421e-13 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +1.184249481782118e-13, -5.283652575473283e-14 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +1.244338370750627e-13, +4.116470873993711e-14 },
-{   0,   2,   0,   0,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, -7.941569241313565e-14, -2.937405899424850e-14 },
-} },
-{   2,   1,   7,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.385323530749442e-14 },
-} } };
+{   0,   2,   0,   0,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, -7.941569241313565e-14, -2.937405899424850e-14 }
+};
 
-static vector<VSOP2013Series> _l = {
-{   2,   2,   0, 299, {
+static constexpr VSOP2013Term _a7[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.385323530749442e-14 }
+};
+
+static constexpr VSOP2013Series _a[] = {
+{   2,   1,   0, 324, _a0 },
+{   2,   1,   1, 205, _a1 },
+{   2,   1,   2, 113, _a2 },
+{   2,   1,   3,  53, _a3 },
+{   2,   1,   4,  21, _a4 },
+{   2,   1,   5,   9, _a5 },
+{   2,   1,   6,   4, _a6 },
+{   2,   1,   7,   1, _a7 }
+};
+
+static constexpr VSOP2013Term _l0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.176134461576000e+00 },
 {   0,   2,   0,  -7,   0,   0,   0,   0,   0,   8,  -6,   0,   0,   0,   0,   0,   0, -8.462401430068983e-06, +1.381171158669011e-05 },
 {   0,   2,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.003897615671844e-05, -3.916661902850538e-09 },
@@ -1049,9 +1065,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   6, -10,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +1.913070140800275e-09, -3.994045957017723e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, -1.208308783995542e-09, +1.096273034337636e-09 },
 {   0,  21, -22,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +6.728519571296660e-11, -2.226621992323425e-09 },
-{   0,  17, -19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.102616243928825e-09, -1.706772871059732e-10 },
-} },
-{   2,   2,   1, 182, {
+{   0,  17, -19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.102616243928825e-09, -1.706772871059732e-10 }
+};
+
+static constexpr VSOP2013Term _l1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.021328554743445e+04 },
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.406613955946860e-06, +4.352576284873701e-07 },
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.215126068105180e-08, +1.738117968643502e-06 },
@@ -1233,9 +1250,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   3,   0,   0,   0,   0,   0,   0,   0,   0,  -4,   0,   0,   0,   0,   0,   0, +4.926992192582617e-10, +3.305261712566322e-10 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +1.842461337366108e-10, +6.261605978603504e-10 },
 {   1,  -5,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.379054807921660e-10, -4.548882903360887e-10 },
-{   0,   5,   0,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.705290218980141e-10, -4.939481466629986e-10 },
-} },
-{   2,   2,   2, 100, {
+{   0,   5,   0,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.705290218980141e-10, -4.939481466629986e-10 }
+};
+
+static constexpr VSOP2013Term _l2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.824289409513071e-06 },
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.302248657651907e-07, +2.046413689262703e-07 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.004637557697520e-07, +1.076448560432294e-09 },
@@ -1335,9 +1353,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +2.660564550139501e-10, +4.051789175955889e-11 },
 {   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.617091925121244e-11, -2.596640185043068e-10 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +6.732165723986830e-11, -2.127366654464087e-10 },
-{   0,   3,   0,   0,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, +1.843274421617166e-10, +9.274110206051188e-11 },
-} },
-{   2,   2,   3,  47, {
+{   0,   3,   0,   0,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, +1.843274421617166e-10, +9.274110206051188e-11 }
+};
+
+static constexpr VSOP2013Term _l3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.355373583963255e-08 },
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.062218603404335e-09, -2.794502856479500e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.793896723816547e-09, -4.927123820347490e-09 },
@@ -1384,9 +1403,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -2,   3,   0,   0,   0,   0,   0,   0, -2.629539662570121e-11, -4.351558571611702e-11 },
 {   0,   2,   0,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.902294378740917e-11, +6.983593165226291e-12 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.378615867234669e-11, -4.183471133219766e-11 },
-{   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.501286896904713e-11, -4.033131620756480e-11 },
-} },
-{   2,   2,   4,  21, {
+{   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.501286896904713e-11, -4.033131620756480e-11 }
+};
+
+static constexpr VSOP2013Term _l4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.265564231364570e-09 },
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.883597435973172e-10, -1.165148881837866e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.586026828578269e-10, +2.813410127134553e-10 },
@@ -1407,9 +1427,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -1.743368960161291e-11, -1.067938292843473e-11 },
 {   0,   3,   0,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.073071044852264e-11, +6.613328067228168e-12 },
 {   0,   3,  -7,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.183982657551526e-11, -1.054079590908487e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -1.810707037257086e-12, +1.769702781056527e-11 },
-} },
-{   2,   2,   5,   9, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -1.810707037257086e-12, +1.769702781056527e-11 }
+};
+
+static constexpr VSOP2013Term _l5[] = {
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.208590067412030e-11, +2.034759836287061e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.527147434830566e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -4.742670610731886e-11, +2.777185897809899e-11 },
@@ -1418,20 +1439,32 @@ static vector<VSOP2013Series> _l = {
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.429151075813318e-12, -3.915332869688612e-13 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +3.484745167410950e-12, -2.613876328955558e-12 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -3.621755911991430e-12, -2.319727306831324e-12 },
-{   0,   1,   0,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.186427052667951e-12, -3.355104516671077e-12 },
-} },
-{   2,   2,   6,   4, {
+{   0,   1,   0,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.186427052667951e-12, -3.355104516671077e-12 }
+};
+
+static constexpr VSOP2013Term _l6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.421161026695537e-10 },
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.761427428887468e-12, +7.375055035137715e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.385147237206420e-12, -3.928432185761571e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +4.661352570528057e-13, +2.094418194203152e-12 },
-} },
-{   2,   2,   7,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.418571032851466e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +4.661352570528057e-13, +2.094418194203152e-12 }
+};
+
+static constexpr VSOP2013Term _l7[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.418571032851466e-12 }
+};
 
-static vector<VSOP2013Series> _k = {
-{   2,   3,   0, 270, {
+static constexpr VSOP2013Series _l[] = {
+{   2,   2,   0, 299, _l0 },
+{   2,   2,   1, 182, _l1 },
+{   2,   2,   2, 100, _l2 },
+{   2,   2,   3,  47, _l3 },
+{   2,   2,   4,  21, _l4 },
+{   2,   2,   5,   9, _l5 },
+{   2,   2,   6,   4, _l6 },
+{   2,   2,   7,   1, _l7 }
+};
+
+static constexpr VSOP2013Term _k0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.492821048000000e-03 },
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.559416913702809e-08, +2.247486286645199e-05 },
 {   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.298948808319820e-08, -1.705855867658912e-05 },
@@ -1701,9 +1734,10 @@ static vector<VSOP2013Series> _k = {
 {   0,  19, -21,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.132082124584363e-09, -8.523159142020542e-11 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +9.862836297550626e-10, -1.226080976165119e-09 },
 {   0,   5,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +6.577500794757947e-10, -1.551288168015943e-09 },
-{   0,   5,   0,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.651693771424084e-11, +2.172248221961905e-09 },
-} },
-{   2,   3,   1, 161, {
+{   0,   5,   0,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.651693771424084e-11, +2.172248221961905e-09 }
+};
+
+static constexpr VSOP2013Term _k1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.126002304108446e-04 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -9.223195202885283e-08, +2.845168562165404e-07 },
 {   0,   1,   0,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.109887829996478e-07, +6.031823041300299e-08 },
@@ -1864,9 +1898,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   3,   0,  -8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.043816523882649e-10, +4.250134088041778e-10 },
 {   0,   3,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.847916996160735e-10, +2.341818450732287e-10 },
 {   4,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.679639385265838e-10, -3.499185430441592e-10 },
-{   0,  13, -16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.675600112918297e-10, +2.357725997199066e-10 },
-} },
-{   2,   3,   2,  85, {
+{   0,  13, -16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.675600112918297e-10, +2.357725997199066e-10 }
+};
+
+static constexpr VSOP2013Term _k2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.057729505260103e-06 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.300610490060526e-08, -6.101885775817629e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -6.495138581360035e-09, +7.468184387810593e-10 },
@@ -1951,9 +1986,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, +7.057922640064229e-11, -1.399463206104336e-10 },
 {   0,   3,   0,   0,   0,   0,   0,   0,   0,  -4,   0,   0,   0,   0,   0,   0,   0, -1.088413539178616e-10, -9.700829054746414e-11 },
 {   0,   3,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -2.007479345697146e-10, +2.085318233005326e-12 },
-{   0,   3,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.347333058760070e-10, -6.537237963307975e-11 },
-} },
-{   2,   3,   3,  38, {
+{   0,   3,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.347333058760070e-10, -6.537237963307975e-11 }
+};
+
+static constexpr VSOP2013Term _k3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.823027053624649e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +7.319429023439006e-11, -5.998957104220631e-10 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.065402975712875e-10, -4.563288359023474e-10 },
@@ -1991,9 +2027,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.610988291502659e-11, -3.137585765980818e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, -2.878611954244552e-11, -1.776315123203678e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +1.254414390434221e-11, +3.393468545197512e-11 },
-{   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.896797384558979e-11, -1.595717261279747e-11 },
-} },
-{   2,   3,   4,  17, {
+{   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.896797384558979e-11, -1.595717261279747e-11 }
+};
+
+static constexpr VSOP2013Term _k4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.800454225777884e-09 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -2.992139644025999e-11, +3.363102265525598e-11 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -3.093111643991145e-11, -3.131329581803864e-11 },
@@ -2010,9 +2047,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -8.991914886847861e-13, -9.087731540691123e-12 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +4.263899240344670e-12, +3.845177210711975e-12 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -4.008624854779074e-12, -3.867536539849070e-12 },
-{   0,   2,   0,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -3.675656852048766e-12, +4.193634104282009e-12 },
-} },
-{   2,   3,   5,   8, {
+{   0,   2,   0,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -3.675656852048766e-12, +4.193634104282009e-12 }
+};
+
+static constexpr VSOP2013Term _k5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.991312768550148e-10 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -2.298328126937314e-12, -3.077837451446647e-12 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -2.049609967850570e-12, +3.206834094786389e-12 },
@@ -2020,16 +2058,26 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +1.016530239060013e-12, -1.766534191191235e-12 },
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.751847504869603e-13, -2.397324610806164e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +1.109331648211442e-12, +1.571978437736236e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -1.081332242034700e-12, -1.562475440949728e-12 },
-} },
-{   2,   3,   6,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -1.081332242034700e-12, -1.562475440949728e-12 }
+};
+
+static constexpr VSOP2013Term _k6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.145680252997922e-12 },
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.647928618446265e-13, +2.034528611190790e-15 },
-{   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +2.603569067943607e-13, -1.147235219934526e-13 },
-} } };
+{   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +2.603569067943607e-13, -1.147235219934526e-13 }
+};
+
+static constexpr VSOP2013Series _k[] = {
+{   2,   3,   0, 270, _k0 },
+{   2,   3,   1, 161, _k1 },
+{   2,   3,   2,  85, _k2 },
+{   2,   3,   3,  38, _k3 },
+{   2,   3,   4,  17, _k4 },
+{   2,   3,   5,   8, _k5 },
+{   2,   3,   6,   3, _k6 }
+};
 
-static vector<VSOP2013Series> _h = {
-{   2,   4,   0, 269, {
+static constexpr VSOP2013Term _h0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.066851475000001e-03 },
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.230660060124298e-05, -3.671173316142774e-08 },
 {   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.690194962402941e-05, +3.970022963775860e-08 },
@@ -2298,9 +2346,10 @@ static vector<VSOP2013Series> _h = {
 {   2,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.758821151320682e-10, +1.511176815173704e-09 },
 {   0,   5,   0,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.129783994481984e-09, -4.878351953055936e-11 },
 {   0,   2,   0,   0,   0,   0,   0,   0,   0,  -6,   5,   0,   0,   0,   0,   0,   0, +1.095125441774032e-09, +1.078900402108361e-09 },
-{   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0, +1.026403756873111e-09, -1.142240758240791e-09 },
-} },
-{   2,   4,   1, 161, {
+{   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0, +1.026403756873111e-09, -1.142240758240791e-09 }
+};
+
+static constexpr VSOP2013Term _h1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.612193139215600e-04 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.867028992079713e-07, -9.051465217363802e-08 },
 {   0,   1,   0,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.299871137603042e-08, -1.116710039966102e-07 },
@@ -2461,9 +2510,10 @@ static vector<VSOP2013Series> _h = {
 {   0,  10,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.688066726911881e-10, +4.368997882604795e-10 },
 {   0,   2,   0,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.783604895436814e-10, -1.155174130473575e-10 },
 {   0,   8,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.667558176907153e-11, -5.151772701922179e-10 },
-{   0,   3,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.285734891165799e-10, -2.233297512414447e-10 },
-} },
-{   2,   4,   2,  86, {
+{   0,   3,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.285734891165799e-10, -2.233297512414447e-10 }
+};
+
+static constexpr VSOP2013Term _h2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.844861217822704e-05 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +6.200387436000872e-09, -1.289500515502835e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.440383956896337e-09, -7.033644521243281e-09 },
@@ -2549,9 +2599,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   5,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.202107308868457e-10, -7.124692586061776e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0, -1.435076696149015e-10, -4.002991125903188e-11 },
 {   0,   3,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.226316555261895e-10, -5.596402069468119e-11 },
-{   0,   6,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.035007311858535e-10, -6.475117281836001e-11 },
-} },
-{   2,   4,   3,  38, {
+{   0,   6,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.035007311858535e-10, -6.475117281836001e-11 }
+};
+
+static constexpr VSOP2013Term _h3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.483534568791632e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +6.901210409342412e-10, -2.375334751491022e-11 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.611983055710889e-10, +1.979146909524151e-10 },
@@ -2589,9 +2640,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, -1.721678468255157e-11, +3.056413477364356e-11 },
 {   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.169558722429806e-11, +1.486567994756842e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, -1.770973957520204e-11, +2.870835555009018e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +3.385362656265863e-11, -1.230065900815319e-11 },
-} },
-{   2,   4,   4,  17, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +3.385362656265863e-11, -1.230065900815319e-11 }
+};
+
+static constexpr VSOP2013Term _h4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.091153571701819e-09 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -3.384013181855196e-11, -3.003827501220011e-11 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +3.133122743727573e-11, -3.080265061287119e-11 },
@@ -2608,9 +2660,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   1,   4,   0,   0,   0,   0, +2.440824413826455e-12, -8.092237957873846e-12 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, +9.072371014977597e-12, -8.881020011187929e-13 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -3.882877937643464e-12, +4.383168606624317e-12 },
-{   0,   2,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, +3.862866668670978e-12, -3.934091172694461e-12 },
-} },
-{   2,   4,   5,   8, {
+{   0,   2,   0,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, +3.862866668670978e-12, -3.934091172694461e-12 }
+};
+
+static constexpr VSOP2013Term _h5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.743169990952612e-10 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +3.089323203020660e-12, -2.321891859364106e-12 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -3.195126460485263e-12, -2.050642277459735e-12 },
@@ -2618,16 +2671,26 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +2.092317404884959e-12, +8.668555648858274e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -1.604936075896093e-12, +1.162177383988099e-12 },
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.361331890133997e-12, +3.591816821187142e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -1.525794724833230e-12, +1.072080693573477e-12 },
-} },
-{   2,   4,   6,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -1.525794724833230e-12, +1.072080693573477e-12 }
+};
+
+static constexpr VSOP2013Term _h6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.139019548625317e-11 },
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.101848277680570e-16, -4.595956073132520e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.443602797189842e-13, +2.488720912377338e-13 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.443602797189842e-13, +2.488720912377338e-13 }
+};
 
-static vector<VSOP2013Series> _q = {
-{   2,   5,   0,  81, {
+static constexpr VSOP2013Series _h[] = {
+{   2,   4,   0, 269, _h0 },
+{   2,   4,   1, 161, _h1 },
+{   2,   4,   2,  86, _h2 },
+{   2,   4,   3,  38, _h3 },
+{   2,   4,   4,  17, _h4 },
+{   2,   4,   5,   8, _h5 },
+{   2,   4,   6,   3, _h6 }
+};
+
+static constexpr VSOP2013Term _q0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.824113927999999e-03 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.689278771253725e-07, +1.542400112585501e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +3.411752667134517e-07, +1.680825019161366e-07 },
@@ -2708,9 +2771,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   8, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.123685570941049e-10, +2.329385952823373e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +2.053025857066756e-09, +6.875362765550018e-10 },
 {   0,  12, -12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.508252409973393e-09, -1.849532804784057e-10 },
-{   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.976222595259498e-10, +1.744584472471867e-09 },
-} },
-{   2,   5,   1,  44, {
+{   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.976222595259498e-10, +1.744584472471867e-09 }
+};
+
+static constexpr VSOP2013Term _q1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.381339313288797e-03 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.983149429577228e-09, +5.920424085131069e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -3.291221761513272e-09, +3.193941869731373e-08 },
@@ -2754,9 +2818,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   2,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.958068624077261e-10, +7.628672389787722e-12 },
 {   0,   7,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.261123254443521e-10, +6.743955842885520e-10 },
 {   0,   7,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.126014520642776e-10, -4.455587871542629e-10 },
-{   0,   1,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -7.316398125695665e-11, -6.611390834319745e-10 },
-} },
-{   2,   5,   2,  21, {
+{   0,   1,   0,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -7.316398125695665e-11, -6.611390834319745e-10 }
+};
+
+static constexpr VSOP2013Term _q2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.091344274426134e-05 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.169679591582377e-09, -4.890730807328570e-10 },
 {   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.673625319244691e-09, +2.055685924110494e-11 },
@@ -2777,9 +2842,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   4,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.557255229276381e-10, +1.866566982356022e-11 },
 {   0,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.918862883885824e-10, -3.650717237873034e-11 },
 {   0,   3,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.577379459358222e-11, -1.281374153406182e-10 },
-{   0,   5,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.580184097401742e-10, +1.323882923889014e-11 },
-} },
-{   2,   5,   3,  10, {
+{   0,   5,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.580184097401742e-10, +1.323882923889014e-11 }
+};
+
+static constexpr VSOP2013Term _q3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.864297517390441e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -7.452166744383773e-11, +7.372655045979846e-11 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.363776597082833e-12, -6.164616994368706e-11 },
@@ -2789,20 +2855,30 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +3.089591286294448e-12, -4.563167492126364e-11 },
 {   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.644329865389191e-11, -1.088852981425088e-11 },
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.794605256439791e-12, -2.584381786664207e-11 },
-{   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.244093419264151e-11, +2.365510045749724e-12 },
-} },
-{   2,   5,   4,   4, {
+{   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.244093419264151e-11, +2.365510045749724e-12 }
+};
+
+static constexpr VSOP2013Term _q4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.039761529142753e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -7.730316550209011e-12, -9.185456711565805e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -3.321726489870357e-12, -4.059234212615147e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +1.460194092218720e-12, +1.513489537785275e-12 },
-} },
-{   2,   5,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.455291047677198e-10 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +1.460194092218720e-12, +1.513489537785275e-12 }
+};
+
+static constexpr VSOP2013Term _q5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.455291047677198e-10 }
+};
 
-static vector<VSOP2013Series> _p = {
-{   2,   6,   0,  76, {
+static constexpr VSOP2013Series _q[] = {
+{   2,   5,   0,  81, _q0 },
+{   2,   5,   1,  44, _q1 },
+{   2,   5,   2,  21, _q2 },
+{   2,   5,   3,  10, _q3 },
+{   2,   5,   4,   4, _q4 },
+{   2,   5,   5,   1, _q5 }
+};
+
+static constexpr VSOP2013Term _p0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.882281923000000e-02 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.692371931608021e-07, -6.925832353291873e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +1.678483619672549e-07, -3.366755781815740e-07 },
@@ -2878,9 +2954,10 @@ static vector<VSOP2013Series> _p = {
 {   0,  10, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.310048473385010e-09, -1.486551086180947e-09 },
 {   0,   3,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.437420683294341e-09, +3.223111994596287e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +6.907103165084487e-10, -2.026989679250957e-09 },
-{   0,   2,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.357564750786514e-09, +2.460790052484156e-10 },
-} },
-{   2,   6,   1,  43, {
+{   0,   2,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.357564750786514e-09, +2.460790052484156e-10 }
+};
+
+static constexpr VSOP2013Term _p1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.039078836907815e-04 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.210400622136713e-08, +1.327570850552666e-08 },
 {   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.894334602151907e-08, +3.093180519646469e-10 },
@@ -2923,9 +3000,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.516738833116428e-10, +9.837484125199962e-10 },
 {   0,   8,  -8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.075427822498891e-09, +4.775574060459664e-11 },
 {   0,   4,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.562355709727323e-10, -6.956108426599164e-10 },
-{   0,   7,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +7.140437423249353e-10, +1.575255623880479e-10 },
-} },
-{   2,   6,   2,  20, {
+{   0,   7,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +7.140437423249353e-10, +1.575255623880479e-10 }
+};
+
+static constexpr VSOP2013Term _p2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.232661635102321e-05 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.603568712319170e-10, +2.741902257651129e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +1.850577571127857e-12, +1.585687178594973e-09 },
@@ -2945,9 +3023,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.844389267133050e-11, +2.220723788982119e-10 },
 {   0,   5,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.346712022878436e-11, -1.779712743694279e-10 },
 {   0,   3,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.306754602387895e-10, +6.208948541407429e-11 },
-{   0,   3,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.001134328549611e-10, +9.141889289686185e-11 },
-} },
-{   2,   6,   3,   9, {
+{   0,   3,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.001134328549611e-10, +9.141889289686185e-11 }
+};
+
+static constexpr VSOP2013Term _p3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.470048961174132e-07 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.054142008280785e-10, -3.178385938614073e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.441640347327543e-11, -6.568628809964795e-11 },
@@ -2956,42 +3035,61 @@ static vector<VSOP2013Series> _p = {
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.827273645074953e-11, +3.523202303719957e-11 },
 {   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.964993837325323e-11, -7.398961000105192e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -4.565794252396776e-11, -4.121359849069986e-12 },
-{   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.058509228600531e-11, -2.660853519847144e-11 },
-} },
-{   2,   6,   4,   4, {
+{   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.058509228600531e-11, -2.660853519847144e-11 }
+};
+
+static constexpr VSOP2013Term _p4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.228182873352631e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +8.675334377519171e-12, -3.828312218554918e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -4.093101309817727e-12, +3.292081000044490e-12 },
-{   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.478910681335119e-12, -2.357979109878708e-12 },
-} },
-{   2,   6,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.279152719492361e-11 },
-} } };
+{   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.478910681335119e-12, -2.357979109878708e-12 }
+};
+
+static constexpr VSOP2013Term _p5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.279152719492361e-11 }
+};
+
+static constexpr VSOP2013Series _p[] = {
+{   2,   6,   0,  76, _p0 },
+{   2,   6,   1,  43, _p1 },
+{   2,   6,   2,  20, _p2 },
+{   2,   6,   3,   9, _p3 },
+{   2,   6,   4,   4, _p4 },
+{   2,   6,   5,   1, _p5 }
+};
+
+vector<VSOP2013PackedSeries> VSOP2013::venusPackedSeries ( void )
+{
+    return packSeries ( { _a, _l, _k, _h, _q, _p } );
+}
 
 SSOrbit VSOP2013::venusOrbit ( double jed )
 {
+    if ( usePackedSeries() )
+        return getOrbit ( 2, jed, getPackedSeries ( 2 ) );
+    
     double a = 0.0, l = 0.0, k = 0.0, h = 0.0, q = 0.0, p = 0.0;
     double t = ( jed - 2451545.0 ) / 365250.0;
     double ll[17] = { 0 };
     
     evalLongitudes ( t, ll );
 
-    for ( VSOP2013Series &series : _a )
+    for ( const VSOP2013Series &series : _a )
         a += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _l )
+    for ( const VSOP2013Series &series : _l )
         l += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _k )
+    for ( const VSOP2013Series &series : _k )
         k += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _h )
+    for ( const VSOP2013Series &series : _h )
         h += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _q )
+    for ( const VSOP2013Series &series : _q )
         q += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _p )
+    for ( const VSOP2013Series &series : _p )
         p += evalSeries ( t, series, ll );
 
     double e = sqrt ( k * k + h * h );  // eccentricity
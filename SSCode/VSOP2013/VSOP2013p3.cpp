@@ -1,8 +1,7 @@
 #include "VSOP2013.hpp"
 #if VSOP2013_EMBED_SERIES
 
-static vector<VSOP2013Series> _a = {
-{   3,   1,   0, 326, {
+static constexpr VSOP2013Term _a0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.000001017641000e+00 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -7.736236063963646e-09, +1.120495653357545e-05 },
 {   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.487098118809132e-10, +7.608600062585683e-06 },
@@ -328,9 +327,10 @@ static vector<VSOP2013Series> _a = {
 {   0,  13, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.061505853534486e-10, +7.930606790579448e-10 },
 {   0,   0,  14, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.811712621880533e-10, +7.094426503349009e-10 },
 {   0,   0,   4,   0,   0,   0,   0,   0,   0,  -6,   2,   0,   0,   0,   0,   0,   0, -3.165328575261665e-11, +1.137252924528480e-09 },
-{   0,   0,  14, -19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.756401977919484e-10, -6.921669767527819e-10 },
-} },
-{   3,   1,   1, 206, {
+{   0,   0,  14, -19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.756401977919484e-10, -6.921669767527819e-10 }
+};
+
+static constexpr VSOP2013Term _a1[] = {
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.055939670685411e-08, +1.269093175241482e-07 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -9.492445468383825e-08, +5.312092913550602e-08 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -3.127811551369313e-08, +3.468606697209054e-08 },
@@ -536,9 +536,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   3,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.316354351023441e-10, -1.461236605188686e-10 },
 {   0,   0,   3,   0,   0,   0,   0,   0,   0,  -2,   2,   0,   0,   0,   0,   0,   0, +3.640022110703345e-10, -1.085613572881944e-10 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -2,  -2,   0,   0,   0,   0,   0,   0, +1.723579576966443e-10, -2.969356983632034e-10 },
-{   0,   0,   3,   0,   0,   0,   0,   0,   0,  -7,   5,   0,   0,   0,   0,   0,   0, -1.692544546828377e-10, -2.982960638215202e-10 },
-} },
-{   3,   1,   2, 117, {
+{   0,   0,   3,   0,   0,   0,   0,   0,   0,  -7,   5,   0,   0,   0,   0,   0,   0, -1.692544546828377e-10, -2.982960638215202e-10 }
+};
+
+static constexpr VSOP2013Term _a2[] = {
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -5.173886833822476e-09, -4.916485555961884e-09 },
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.782736485997923e-09, -2.729687739939616e-09 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +2.116913598040857e-09, -4.977181598440322e-09 },
@@ -655,9 +656,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   4,   0,   0,   0,   0,   0,   0,  -3,  -5,   0,   0,   0,   0,   0,   0, +5.306036091222473e-11, -1.285559332863853e-10 },
 {   0,   0,  11, -16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.295728398715915e-11, +1.179080848900966e-10 },
 {   0,   0,  10, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.714889011402927e-10, +8.418554229946525e-12 },
-{   0,   0,   3,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +6.147218904425818e-11, -1.134380893860146e-10 },
-} },
-{   3,   1,   3,  56, {
+{   0,   0,   3,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +6.147218904425818e-11, -1.134380893860146e-10 }
+};
+
+static constexpr VSOP2013Term _a3[] = {
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +6.340454731699656e-10, +3.927513770678965e-10 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +6.027673078800534e-10, -4.017082504514490e-10 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.920267401056554e-10, +2.620581647519616e-10 },
@@ -713,9 +715,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   6,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.487243910632873e-12, -4.637716818901468e-11 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0,   0,   0, +2.713859811714753e-11, +2.066991310931789e-11 },
 {   0,   0,   8, -12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.937923858650562e-11, -2.839312747803645e-11 },
-{   0,   0,   1,   0,   0,   0,   0,   0,   0,  -3,   5,   0,   0,   0,   0,   0,   0, +2.883042064843409e-11, -1.770499300041670e-11 },
-} },
-{   3,   1,   4,  23, {
+{   0,   0,   1,   0,   0,   0,   0,   0,   0,  -3,   5,   0,   0,   0,   0,   0,   0, +2.883042064843409e-11, -1.770499300041670e-11 }
+};
+
+static constexpr VSOP2013Term _a4[] = {
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -5.192937402024370e-11, +5.824686157491549e-11 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -5.338274947999883e-11, -5.443168275734972e-11 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.839756656415428e-11, -5.300108266463409e-11 },
@@ -738,9 +741,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -4,   0,   0,   0,   0,   0,   0,   0, +8.167786510488876e-12, +3.065046762208858e-12 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +2.899555761141406e-12, +8.268152403284942e-12 },
 {   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -9.762713635643634e-12, +9.668694970706651e-13 },
-{   0,   0,   2,   0,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, -2.649207305964760e-12, +7.734791955184438e-12 },
-} },
-{   3,   1,   5,  10, {
+{   0,   0,   2,   0,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, -2.649207305964760e-12, +7.734791955184438e-12 }
+};
+
+static constexpr VSOP2013Term _a5[] = {
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.768487220916389e-12, -4.433971460260165e-12 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -3.981154803543501e-12, -5.341016988085767e-12 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -3.576387832917985e-12, +5.534845388132675e-12 },
@@ -750,20 +754,32 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   7, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.476570946678654e-12, -3.247328607595093e-13 },
 {   0,   0,   3,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -8.073664812334532e-13, +1.387902804388972e-12 },
 {   0,   0,   3,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -9.463906820333802e-13, -1.216549557811372e-12 },
-{   0,   0,   6, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.414072935782017e-12, +5.991408505769290e-13 },
-} },
-{   3,   1,   6,   4, {
+{   0,   0,   6, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.414072935782017e-12, +5.991408505769290e-13 }
+};
+
+static constexpr VSOP2013Term _a6[] = {
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.306084858995164e-13, +5.412780801034645e-13 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +4.524906030656998e-13, -1.983083917184471e-13 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +4.722263270544714e-13, +1.603480416956836e-13 },
-{   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.478918921260176e-13, -1.349410646975460e-13 },
-} },
-{   3,   1,   7,   1, {
-{   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.352024320187319e-14, +3.569942110430233e-14 },
-} } };
+{   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.478918921260176e-13, -1.349410646975460e-13 }
+};
 
-static vector<VSOP2013Series> _l = {
-{   3,   2,   0, 314, {
+static constexpr VSOP2013Term _a7[] = {
+{   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.352024320187319e-14, +3.569942110430233e-14 }
+};
+
+static constexpr VSOP2013Series _a[] = {
+{   3,   1,   0, 326, _a0 },
+{   3,   1,   1, 206, _a1 },
+{   3,   1,   2, 117, _a2 },
+{   3,   1,   3,  56, _a3 },
+{   3,   1,   4,  23, _a4 },
+{   3,   1,   5,  10, _a5 },
+{   3,   1,   6,   4, _a6 },
+{   3,   1,   7,   1, _a7 }
+};
+
+static constexpr VSOP2013Term _l0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.753470369433000e+00 },
 {   0,   0,   4,  -8,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -9.528802326523678e-06, +3.225447561917028e-05 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -2.056396003946340e-05, -1.716306740014159e-08 },
@@ -1077,9 +1093,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,  12, -16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.576169573012105e-09, +3.098168693393525e-09 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -2,   2,   0,   0,   0,   0,   0,   0, -3.509947039981017e-09, -1.085975199088637e-09 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, -7.725670017099724e-10, +3.769418628529800e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -1.095264789574972e-09, +3.417827559592843e-09 },
-} },
-{   3,   2,   1, 188, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -1.095264789574972e-09, +3.417827559592843e-09 }
+};
+
+static constexpr VSOP2013Term _l1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.283075850353214e+03 },
 {   0,   0,   4,  -8,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -4.181419030192462e-06, +1.980919587351421e-07 },
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -9.522813410574556e-07, -2.945430414369931e-07 },
@@ -1267,9 +1284,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   3,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.804382105432268e-09, +4.131575861023560e-11 },
 {   0,   0,   9, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.017978881424180e-10, -1.121545487821671e-09 },
 {   0,   0,  12, -23,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -1.443566610696952e-09, +3.666665379151859e-10 },
-{   0,   0,  10, -18,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.086658182393743e-09, +7.058432170660874e-10 },
-} },
-{   3,   2,   2, 105, {
+{   0,   0,  10, -18,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.086658182393743e-09, +7.058432170660874e-10 }
+};
+
+static constexpr VSOP2013Term _l2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.803726171868714e-06 },
 {   0,   0,   4,  -8,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -2.241625311443162e-08, -2.714069603426302e-07 },
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.924135563638978e-08, -1.402406859467742e-07 },
@@ -1374,9 +1392,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +3.148625796877115e-10, -4.157611235113014e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, +3.184632427704809e-10, -4.082476416451198e-10 },
 {   0,   0,   3,  -6,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +4.649199623282377e-10, -2.589629814314111e-10 },
-{   0,   0,   7,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.440326732695440e-10, -4.780448740974030e-10 },
-} },
-{   3,   2,   3,  51, {
+{   0,   0,   7,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.440326732695440e-10, -4.780448740974030e-10 }
+};
+
+static constexpr VSOP2013Term _l3[] = {
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.617399226661640e-08, -2.416843041264425e-08 },
 {   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.416593385833476e-10, +1.916411368415335e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +6.995189908093986e-09, -8.248774670520645e-09 },
@@ -1427,9 +1446,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +2.904904810024259e-10, +2.507273362679488e-11 },
 {   0,   0,   5, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.018489229021215e-10, -2.115718521766892e-10 },
 {   0,   3,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.024287893247523e-10, +9.186852845862113e-11 },
-{   0,   0,   7, -12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.008220827162636e-11, -1.929472169009823e-10 },
-} },
-{   3,   2,   4,  23, {
+{   0,   0,   7, -12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.008220827162636e-11, -1.929472169009823e-10 }
+};
+
+static constexpr VSOP2013Term _l4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +9.208504495727659e-09 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.267476297693476e-09, -2.369706443175836e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +7.407039940704556e-10, +8.393109300450594e-10 },
@@ -1452,9 +1472,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -4.934312895691653e-11, -3.647546900235053e-11 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -5.451644614707965e-11, -2.736181326747993e-11 },
 {   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.800110537916305e-12, +6.236506226844670e-11 },
-{   0,   0,   4,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.766064914808417e-12, +6.221404056150162e-11 },
-} },
-{   3,   2,   5,  10, {
+{   0,   0,   4,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.766064914808417e-12, +6.221404056150162e-11 }
+};
+
+static constexpr VSOP2013Term _l5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.530841755295383e-08 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.736008457989798e-10, +3.555676040287389e-10 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.202845291948293e-10, +5.023444409084822e-11 },
@@ -1464,20 +1485,32 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   7, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +6.016061635796488e-12, +4.524421589794261e-11 },
 {   0,   0,  17, -32,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.331570950512264e-11, +1.945533586005181e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +2.508262651388941e-11, -9.949680464919033e-12 },
-{   0,   0,   6, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.656752639195422e-12, +1.583209217079912e-11 },
-} },
-{   3,   2,   6,   4, {
+{   0,   0,   6, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.656752639195422e-12, +1.583209217079912e-11 }
+};
+
+static constexpr VSOP2013Term _l6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.045912241306341e-10 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.334681409471063e-11, +2.655639280988085e-11 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.104059515056786e-12, +1.312280191894516e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.220014759278776e-12, -6.742676467961256e-12 },
-} },
-{   3,   2,   7,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.142063029336711e-10 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.220014759278776e-12, -6.742676467961256e-12 }
+};
+
+static constexpr VSOP2013Term _l7[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.142063029336711e-10 }
+};
 
-static vector<VSOP2013Series> _k = {
-{   3,   3,   0, 282, {
+static constexpr VSOP2013Series _l[] = {
+{   3,   2,   0, 314, _l0 },
+{   3,   2,   1, 188, _l1 },
+{   3,   2,   2, 105, _l2 },
+{   3,   2,   3,  51, _l3 },
+{   3,   2,   4,  23, _l4 },
+{   3,   2,   5,  10, _l5 },
+{   3,   2,   6,   4, _l6 },
+{   3,   2,   7,   1, _l7 }
+};
+
+static constexpr VSOP2013Term _k0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.740818074000000e-03 },
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.391176220236722e-09, -1.988948191079879e-05 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -4.577900644927902e-09, +1.859260221360864e-05 },
@@ -1759,9 +1792,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   4,   0,   0,   0,   0,   0,   0, +3.039968363965974e-09, -1.267754194092439e-09 },
 {   0,   0,   3,   0,   0,   0,   0,   0,   0,  -7,   0,   0,   0,   0,   0,   0,   0, -1.573476375399993e-09, +2.694800088785963e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   0,   0, -3.002706323874567e-09, +1.250353248201594e-09 },
-{   0,   0,   6,   0,   0,   0,   0,   0,   0,  -6,   0,   0,   0,   0,   0,   0,   0, -3.232787509672080e-10, +3.803089073492427e-09 },
-} },
-{   3,   3,   1, 164, {
+{   0,   0,   6,   0,   0,   0,   0,   0,   0,  -6,   0,   0,   0,   0,   0,   0,   0, -3.232787509672080e-10, +3.803089073492427e-09 }
+};
+
+static constexpr VSOP2013Term _k1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -8.226866083381023e-04 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.073581157030718e-08, -2.535416170895548e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -1.460922434808269e-07, -1.525733371310965e-07 },
@@ -1925,9 +1959,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   9, -12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.470946302993229e-10, -8.319673394485827e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0, -5.733982289863996e-10, -8.051444738996602e-10 },
 {   0,   0,  10, -14,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.450629995082152e-10, +1.220527020261685e-09 },
-{   0,   0,   4,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -1.075362419205982e-09, -2.862069125743776e-10 },
-} },
-{   3,   3,   2,  89, {
+{   0,   0,   4,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -1.075362419205982e-09, -2.862069125743776e-10 }
+};
+
+static constexpr VSOP2013Term _k2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.766670965181005e-05 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -9.188091568390195e-09, -8.675665856858965e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.579526169862766e-08, +1.425955622987341e-09 },
@@ -2016,9 +2051,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +6.450467056812352e-11, +4.212539355526508e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   5,   0,   0,   0,   0,   0,   0, -1.933894135634945e-10, +2.885571945048703e-10 },
 {   0,   0,  10, -19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.077483815701679e-10, -1.688508669135675e-10 },
-{   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.391230163176748e-10, -2.355912659366974e-10 },
-} },
-{   3,   3,   3,  42, {
+{   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.391230163176748e-10, -2.355912659366974e-10 }
+};
+
+static constexpr VSOP2013Term _k3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.172924720970200e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.321164737224201e-10, -1.483993461019406e-09 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +1.051173620996685e-09, +6.511297743615495e-10 },
@@ -2060,9 +2096,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +6.402497137987173e-11, -5.436756621478068e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, +6.242213114725796e-11, +4.316261534060554e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, -6.407821275196773e-11, -3.987324220151790e-11 },
-{   0,   0,   7, -12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.469190020060108e-11, -5.800999735568397e-11 },
-} },
-{   3,   3,   4,  19, {
+{   0,   0,   7, -12,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.469190020060108e-11, -5.800999735568397e-11 }
+};
+
+static constexpr VSOP2013Term _k4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.733318996560913e-08 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -8.606062106058152e-11, +9.647207383120489e-11 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -8.878300067505458e-11, -9.026794893661479e-11 },
@@ -2081,9 +2118,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -1.577604166679057e-11, -1.510478854050881e-11 },
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -1.381346456079918e-11, +1.658141654428650e-11 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -3.007438405397047e-12, -2.654172362468846e-11 },
-{   0,   0,   1,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +1.341488889272344e-11, +1.162605295570341e-11 },
-} },
-{   3,   3,   5,   8, {
+{   0,   0,   1,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +1.341488889272344e-11, +1.162605295570341e-11 }
+};
+
+static constexpr VSOP2013Term _k5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -7.231233413191204e-10 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -6.582840234870697e-12, -8.847653346523877e-12 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -5.921872800149150e-12, +9.205723577706802e-12 },
@@ -2091,16 +2129,26 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -5.898542002489881e-12, +5.336526897005615e-12 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -4.823086538971064e-12, -2.834208087290859e-12 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.177215299784368e-12, +3.472819691556334e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +2.695744088845307e-12, -4.327561943015936e-12 },
-} },
-{   3,   3,   6,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +2.695744088845307e-12, -4.327561943015936e-12 }
+};
+
+static constexpr VSOP2013Term _k6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.201584910680027e-11 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +7.489454778849708e-13, -3.268547797476063e-13 },
-{   0,   0,   1,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +7.856742387833521e-13, +2.644152499262725e-13 },
-} } };
+{   0,   0,   1,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +7.856742387833521e-13, +2.644152499262725e-13 }
+};
+
+static constexpr VSOP2013Series _k[] = {
+{   3,   3,   0, 282, _k0 },
+{   3,   3,   1, 164, _k1 },
+{   3,   3,   2,  89, _k2 },
+{   3,   3,   3,  42, _k3 },
+{   3,   3,   4,  19, _k4 },
+{   3,   3,   5,   8, _k5 },
+{   3,   3,   6,   3, _k6 }
+};
 
-static vector<VSOP2013Series> _h = {
-{   3,   4,   0, 279, {
+static constexpr VSOP2013Term _h0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.628448918000000e-02 },
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.987013745289864e-05, +7.526846313162709e-09 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -1.864057696178798e-05, -2.452936689604385e-08 },
@@ -2379,9 +2427,10 @@ static vector<VSOP2013Series> _h = {
 {   0,  16, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.635699937464155e-09, -1.548535743035423e-10 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -3,   5,   0,   0,   0,   0,   0,   0, -1.154521837792606e-09, +2.612569761769790e-09 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +1.762817484902841e-09, +1.984998358729979e-09 },
-{   0,   0,   3,   0,   0,   0,   0,   0,   0,  -4,   2,   0,   0,   0,   0,   0,   0, +3.549554001211683e-09, +1.481867855718761e-10 },
-} },
-{   3,   4,   1, 163, {
+{   0,   0,   3,   0,   0,   0,   0,   0,   0,  -4,   2,   0,   0,   0,   0,   0,   0, +3.549554001211683e-09, +1.481867855718761e-10 }
+};
+
+static constexpr VSOP2013Term _h1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.203015463663059e-04 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.538760797483729e-07, +8.051011237238433e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -1.534622260889824e-07, +1.470961162934456e-07 },
@@ -2544,9 +2593,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.133486266742624e-10, -6.515058966098742e-10 },
 {   0,   0,   5,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.782528961508609e-10, +4.842299281804972e-10 },
 {   0,   0,   3,   0,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, +2.782386738572129e-10, -1.163586807110061e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   0,   0, +6.064920017452752e-10, -8.194553809001167e-10 },
-} },
-{   3,   4,   2,  87, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   0,   0, +6.064920017452752e-10, -8.194553809001167e-10 }
+};
+
+static constexpr VSOP2013Term _h2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.387469970891834e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -3.582155245177800e-09, -1.615579416700978e-08 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +8.746308457195433e-09, -9.210535480278601e-09 },
@@ -2633,9 +2683,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   2,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.196746797172795e-10, +6.235382634507616e-11 },
 {   0,   0,  10, -19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.782382329795324e-10, -2.940231392503124e-10 },
 {   0,   0,   1,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.455730446466949e-10, +3.187834511593732e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, +2.185698364390996e-10, -2.429785284947818e-10 },
-} },
-{   3,   4,   3,  41, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, +2.185698364390996e-10, -2.429785284947818e-10 }
+};
+
+static constexpr VSOP2013Term _h3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +8.561504508364347e-07 },
 {   0,   0,   8, -16,   0,   0,   0,   0,   0,   4,   5,   0,   0,   0,   0,   0,   0, -3.380662466946946e-10, -2.055784975072682e-09 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -6.544516154286532e-10, +1.056897138417770e-09 },
@@ -2676,9 +2727,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0,   0, +7.560696250406529e-11, +4.905186340471534e-11 },
 {   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.019158416119623e-11, -6.842054868673027e-11 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +5.428025676361078e-11, +6.376724262312217e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, +6.294461942635407e-11, -5.194265339164084e-11 },
-} },
-{   3,   4,   4,  19, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, +6.294461942635407e-11, -5.194265339164084e-11 }
+};
+
+static constexpr VSOP2013Term _h4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.776340239813239e-08 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -9.722735345138315e-11, -8.649323628215195e-11 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +9.038102497816615e-11, -8.860849711389444e-11 },
@@ -2697,9 +2749,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   2,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -1.569498922216479e-11, -1.469112485063168e-11 },
 {   0,   0,   6, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.144420075775378e-11, +1.839448655862040e-11 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, +2.653526095360718e-11, -2.993204287933654e-12 },
-{   0,   0,   1,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -1.188498286850212e-11, +1.373221078806724e-11 },
-} },
-{   3,   4,   5,   8, {
+{   0,   0,   1,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -1.188498286850212e-11, +1.373221078806724e-11 }
+};
+
+static constexpr VSOP2013Term _h5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.447875344468708e-10 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +8.894208570206309e-12, -6.664153425167116e-12 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -9.193022954076698e-12, -5.932274449896165e-12 },
@@ -2707,16 +2760,26 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -6.633429677911894e-12, -2.252526602012201e-12 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, +2.845059894295268e-12, -4.841856121899611e-12 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.923021230328797e-12, -4.292172400608555e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +4.893264705941047e-12, +1.927525565013087e-12 },
-} },
-{   3,   4,   6,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +4.893264705941047e-12, +1.927525565013087e-12 }
+};
+
+static constexpr VSOP2013Term _h6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.799921941302621e-12 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +3.343256705684222e-13, +7.532859619151021e-13 },
-{   0,   0,   1,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -2.652973803910816e-13, +7.847720036376405e-13 },
-} } };
+{   0,   0,   1,   0,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -2.652973803910816e-13, +7.847720036376405e-13 }
+};
 
-static vector<VSOP2013Series> _q = {
-{   3,   5,   0,  72, {
+static constexpr VSOP2013Series _h[] = {
+{   3,   4,   0, 279, _h0 },
+{   3,   4,   1, 163, _h1 },
+{   3,   4,   2,  87, _h2 },
+{   3,   4,   3,  41, _h3 },
+{   3,   4,   4,  19, _h4 },
+{   3,   4,   5,   8, _h5 },
+{   3,   4,   6,   3, _h6 }
+};
+
+static constexpr VSOP2013Term _q0[] = {
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.575127329355824e-07, -1.064889038356864e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -3.639028511489842e-07, +6.807446056543058e-08 },
 {   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.379069608265148e-07, +1.288237771382845e-08 },
@@ -2788,9 +2851,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   8,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.720738099625456e-09, -8.419669880576926e-10 },
 {   0,   6, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.005177536020133e-09, +1.157380778263077e-09 },
 {   0,   1,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.899510528301282e-10, +3.437266437922269e-09 },
-{   0,   6,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.337924285207461e-11, -3.901640248456480e-09 },
-} },
-{   3,   5,   1,  36, {
+{   0,   6,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.337924285207461e-11, -3.901640248456480e-09 }
+};
+
+static constexpr VSOP2013Term _q1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.134731322072173e-03 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.031123650789526e-09, -4.084813758168335e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +1.077991689012610e-08, -2.605424248131432e-08 },
@@ -2826,9 +2890,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   5,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.200174066796366e-10, -6.384616862030683e-10 },
 {   0,   5,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.763995926984561e-10, -9.606897223180867e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -1.662359917665184e-10, +9.693769436867686e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -7.980789858680077e-11, -1.052538883370911e-09 },
-} },
-{   3,   5,   2,  19, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -7.980789858680077e-11, -1.052538883370911e-09 }
+};
+
+static constexpr VSOP2013Term _q2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.236743820044911e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +9.047356166749571e-10, +1.063828994689760e-09 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.504197521017551e-09, +3.779484543871329e-10 },
@@ -2847,9 +2912,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -2.215832653188783e-10, -8.710435594850892e-11 },
 {   0,   3,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.972569014812913e-10, +1.070784318374601e-11 },
 {   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.811932471309235e-10, +1.117088736241874e-10 },
-{   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.283125385582947e-10, +4.833591659128031e-11 },
-} },
-{   3,   5,   3,   9, {
+{   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.283125385582947e-10, +4.833591659128031e-11 }
+};
+
+static constexpr VSOP2013Term _q3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.265390615335290e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +7.630769614855125e-11, -6.906356036270878e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +2.179035342233908e-11, -3.232618314142134e-11 },
@@ -2858,20 +2924,30 @@ static vector<VSOP2013Series> _q = {
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.062852679742474e-11, -1.611823797461821e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +2.485102314232809e-12, -3.475890668571215e-11 },
 {   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.996464833311299e-11, +7.941317928315338e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, -1.250320286424305e-11, +1.470309093099610e-11 },
-} },
-{   3,   5,   4,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, -1.250320286424305e-11, +1.470309093099610e-11 }
+};
+
+static constexpr VSOP2013Term _q4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.364851841718890e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +6.275018503060254e-12, +1.090257884114796e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +3.299836207231345e-12, +3.581831851038067e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, -2.821640246717278e-12, -7.326357280407853e-13 },
-} },
-{   3,   5,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.167797729580470e-10 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, -2.821640246717278e-12, -7.326357280407853e-13 }
+};
+
+static constexpr VSOP2013Term _q5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.167797729580470e-10 }
+};
 
-static vector<VSOP2013Series> _p = {
-{   3,   6,   0,  67, {
+static constexpr VSOP2013Series _q[] = {
+{   3,   5,   0,  72, _q0 },
+{   3,   5,   1,  36, _q1 },
+{   3,   5,   2,  19, _q2 },
+{   3,   5,   3,   9, _q3 },
+{   3,   5,   4,   4, _q4 },
+{   3,   5,   5,   1, _q5 }
+};
+
+static constexpr VSOP2013Term _p0[] = {
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.143051248946656e-07, +4.702136779419192e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +6.684459764580089e-08, +3.603178002233933e-07 },
 {   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.383757728520679e-08, +9.861749707454420e-08 },
@@ -2938,9 +3014,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.387094363845776e-09, +2.267936158631531e-09 },
 {   0,   6, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.227070351752233e-09, -3.080800415386073e-09 },
 {   0,   8,  -8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.963707268870064e-09, -2.326902636407604e-09 },
-{   0,   1,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.510480820055319e-09, +6.460250598503657e-10 },
-} },
-{   3,   6,   1,  35, {
+{   0,   1,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.510480820055319e-09, +6.460250598503657e-10 }
+};
+
+static constexpr VSOP2013Term _p1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.017891898227051e-04 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.236543085970792e-08, -8.775084424897674e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -2.624835080227579e-08, -1.089878211528249e-08 },
@@ -2975,9 +3052,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   5,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.026811694372942e-09, -2.290632531776744e-10 },
 {   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.310997651019505e-10, -1.014509966910544e-09 },
 {   0,   7,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.106100917011726e-09, +6.612863982991680e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +9.716784879123531e-10, +1.857232824931783e-10 },
-} },
-{   3,   6,   2,  18, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +9.716784879123531e-10, +1.857232824931783e-10 }
+};
+
+static constexpr VSOP2013Term _p2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.702795245810685e-05 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.710471800210820e-10, -1.800837750117577e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +1.058264088244395e-09, -8.845949175798145e-10 },
@@ -2995,9 +3073,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.231009071548884e-11, -2.628359642820659e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -9.025940039428666e-11, +2.210183941277468e-10 },
 {   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.822258766495998e-10, +9.933244355661900e-11 },
-{   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.776769779703385e-11, -1.753615348376922e-10 },
-} },
-{   3,   6,   3,   9, {
+{   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.776769779703385e-11, -1.753615348376922e-10 }
+};
+
+static constexpr VSOP2013Term _p3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.421827377115325e-07 },
 {   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.074507338012408e-11, +1.742474656298139e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +4.818426860442890e-11, +2.660660967914015e-11 },
@@ -3006,42 +3085,61 @@ static vector<VSOP2013Series> _p = {
 {   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.571302284935365e-11, -3.111300952900608e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -3.412115729228185e-11, -8.699111257925609e-12 },
 {   0,   1,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.662656076313869e-11, +1.586780058535359e-12 },
-{   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.416695851038444e-12, +2.047088149936765e-11 },
-} },
-{   3,   6,   4,   4, {
+{   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.416695851038444e-12, +2.047088149936765e-11 }
+};
+
+static constexpr VSOP2013Term _p4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.508633795522544e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -4.752295188472543e-12, +5.184606474827711e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +3.609532075898068e-12, -3.272295735360252e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, -7.495711047857574e-13, +2.795194359512411e-12 },
-} },
-{   3,   6,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.575014479216902e-10 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, -7.495711047857574e-13, +2.795194359512411e-12 }
+};
+
+static constexpr VSOP2013Term _p5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.575014479216902e-10 }
+};
+
+static constexpr VSOP2013Series _p[] = {
+{   3,   6,   0,  67, _p0 },
+{   3,   6,   1,  35, _p1 },
+{   3,   6,   2,  18, _p2 },
+{   3,   6,   3,   9, _p3 },
+{   3,   6,   4,   4, _p4 },
+{   3,   6,   5,   1, _p5 }
+};
+
+vector<VSOP2013PackedSeries> VSOP2013::earthPackedSeries ( void )
+{
+    return packSeries ( { _a, _l, _k, _h, _q, _p } );
+}
 
 SSOrbit VSOP2013::earthOrbit ( double jed )
 {
+    if ( usePackedSeries() )
+        return getOrbit ( 3, jed, getPackedSeries ( 3 ) );
+    
     double a = 0.0, l = 0.0, k = 0.0, h = 0.0, q = 0.0, p = 0.0;
     double t = ( jed - 2451545.0 ) / 365250.0;
     double ll[17] = { 0 };
     
     evalLongitudes ( t, ll );
 
-    for ( VSOP2013Series &series : _a )
+    for ( const VSOP2013Series &series : _a )
         a += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _l )
+    for ( const VSOP2013Series &series : _l )
         l += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _k )
+    for ( const VSOP2013Series &series : _k )
         k += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _h )
+    for ( const VSOP2013Series &series : _h )
         h += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _q )
+    for ( const VSOP2013Series &series : _q )
         q += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _p )
+    for ( const VSOP2013Series &series : _p )
         p += evalSeries ( t, series, ll );
 
     double e = sqrt ( k * k + h * h );  // eccentricity
@@ -1,8 +1,7 @@
 #include "VSOP2013.hpp"
 #if VSOP2013_EMBED_SERIES
 
-static vector<VSOP2013Series> _a = {
-{   4,   1,   0, 321, {
+static constexpr VSOP2013Term _a0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.523679340234000e+00 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, +2.101775373331733e-07, +6.601704278461370e-05 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -9.977604980983227e-06, -1.962695157182863e-05 },
@@ -323,9 +322,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   4, -11,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   0,   0, -6.488525849762241e-09, -1.690000212238479e-09 },
 {   0,   0,   0,   5,   0,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0, -5.031820417927221e-09, +3.088319072295366e-09 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, +3.684839083948857e-09, -4.344380246635312e-09 },
-{   0,   1,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.411162897167539e-09, -2.615864225171286e-09 },
-} },
-{   4,   1,   1, 225, {
+{   0,   1,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.411162897167539e-09, -2.615864225171286e-09 }
+};
+
+static constexpr VSOP2013Term _a1[] = {
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, +1.488179289234472e-06, -8.972948530903373e-07 },
 {   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.722863664192959e-07, +9.018550948605026e-07 },
 {   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.832730573411330e-07, +5.636440207534160e-07 },
@@ -550,9 +550,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -2.808577134368619e-09, -4.135588650811114e-10 },
 {   0,   0,   0,   5,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, -1.558402337717009e-09, -1.643116266196612e-09 },
 {   0,   0,   0,   5,   0,   0,   0,   0,   0,  -8,   5,   0,   0,   0,   0,   0,   0, -1.158768440673777e-09, -2.032487388539012e-09 },
-{   0,   0,   0,   3,   0,   0,   0,   0,   0,  -5,   3,   0,   0,   0,   0,   0,   0, +1.399698450532738e-09, +1.771601346115452e-09 },
-} },
-{   4,   1,   2, 141, {
+{   0,   0,   0,   3,   0,   0,   0,   0,   0,  -5,   3,   0,   0,   0,   0,   0,   0, +1.399698450532738e-09, +1.771601346115452e-09 }
+};
+
+static constexpr VSOP2013Term _a2[] = {
 {   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -7.125593307409964e-08, -3.494586580111632e-08 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, +4.072935333342275e-08, +5.491274130007689e-08 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.859116166527643e-08, -4.750423093222961e-08 },
@@ -693,9 +694,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0, +7.004344378314450e-10, -6.793295036683089e-10 },
 {   0,   3,   0,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.069103744554689e-10, -9.668690981562840e-10 },
 {   0,   0,  11, -19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.689186906768162e-10, -5.036114800953749e-10 },
-{   0,   0,  12, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.308119973623608e-09, -6.369220948270867e-11 },
-} },
-{   4,   1,   3,  71, {
+{   0,   0,  12, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.308119973623608e-09, -6.369220948270867e-11 }
+};
+
+static constexpr VSOP2013Term _a3[] = {
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.548385710344830e-09, -5.714376393898725e-09 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +3.807271802448551e-09, +2.358858911588804e-09 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +3.535196855573691e-09, -2.395973409298733e-09 },
@@ -766,9 +768,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   8, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.662130955638243e-11, +3.964729055622822e-10 },
 {   0,   0,   0,   3,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -3.757693253563749e-10, -2.538612486125330e-11 },
 {   0,   0,  10, -16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.751047197501809e-10, -2.459392470911570e-11 },
-{   0,   0,  11, -16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.673989046091715e-10, +1.311274553662328e-10 },
-} },
-{   4,   1,   4,  30, {
+{   0,   0,  11, -16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.673989046091715e-10, +1.311274553662328e-10 }
+};
+
+static constexpr VSOP2013Term _a4[] = {
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.371800546222749e-10, +1.155564177863453e-09 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.430076740708072e-10, -2.475488973183669e-10 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -3.104384002278354e-10, +3.489889041967078e-10 },
@@ -798,9 +801,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.425560808569360e-11, -3.451240284801142e-11 },
 {   0,   0,   7, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.460727544911664e-11, +3.873236724144072e-11 },
 {   0,   0,   8, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.894426797830731e-11, +6.420762528004814e-11 },
-{   0,   0,   0,   2,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -7.922961667461970e-11, +1.311930583968088e-11 },
-} },
-{   4,   1,   5,  10, {
+{   0,   0,   0,   2,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -7.922961667461970e-11, +1.311930583968088e-11 }
+};
+
+static constexpr VSOP2013Term _a5[] = {
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.256000408559459e-10, +9.653329969275665e-11 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.912713457487230e-11, -6.992758286667179e-11 },
 {   0,   0,   7, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.340388949830534e-11, +7.009529989130786e-12 },
@@ -810,20 +814,32 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +2.932673703388642e-11, +7.942104377931384e-12 },
 {   0,   0,   5,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.143977795442810e-11, -1.580137751741260e-11 },
 {   0,   0,  10, -19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.398938623377122e-12, -1.930168379438105e-11 },
-{   0,   0,   0,   3,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -8.532179159173488e-12, +1.154498885040914e-11 },
-} },
-{   4,   1,   6,   4, {
+{   0,   0,   0,   3,   0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   0, -8.532179159173488e-12, +1.154498885040914e-11 }
+};
+
+static constexpr VSOP2013Term _a6[] = {
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -9.169378192794495e-12, -1.150692706411547e-11 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +7.491411389156863e-12, +2.900379241854380e-12 },
 {   0,   0,   7, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.940532218809070e-13, -4.268095467096865e-12 },
-{   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +2.675201147880746e-12, -1.182731606106917e-12 },
-} },
-{   4,   1,   7,   1, {
-{   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.202755858279954e-13, -7.424541863946993e-13 },
-} } };
+{   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +2.675201147880746e-12, -1.182731606106917e-12 }
+};
 
-static vector<VSOP2013Series> _l = {
-{   4,   2,   0, 324, {
+static constexpr VSOP2013Term _a7[] = {
+{   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.202755858279954e-13, -7.424541863946993e-13 }
+};
+
+static constexpr VSOP2013Series _a[] = {
+{   4,   1,   0, 321, _a0 },
+{   4,   1,   1, 225, _a1 },
+{   4,   1,   2, 141, _a2 },
+{   4,   1,   3,  71, _a3 },
+{   4,   1,   4,  30, _a4 },
+{   4,   1,   5,  10, _a5 },
+{   4,   1,   6,   4, _a6 },
+{   4,   1,   7,   1, _a7 }
+};
+
+static constexpr VSOP2013Term _l0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.203500014141000e+00 },
 {   0,   0,   4,  -8,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, +7.742264425111476e-05, -2.617832697374777e-04 },
 {   0,   2,   0,  -7,   0,   0,   0,   0,   0,   8,  -6,   0,   0,   0,   0,   0,   0, +5.345241861531846e-05, -7.804886631701535e-05 },
@@ -1147,9 +1163,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,  13, -18,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.072540303319049e-08, -7.230566893188204e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +9.116091116331772e-10, +1.688478232958982e-08 },
 {   0,   4,   0,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.182558928607540e-08, -5.845365007118099e-09 },
-{   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0, -1.764048189535492e-08, -1.246583047985916e-11 },
-} },
-{   4,   2,   1, 214, {
+{   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0, -1.764048189535492e-08, -1.246583047985916e-11 }
+};
+
+static constexpr VSOP2013Term _l1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.340612434145457e+03 },
 {   0,   0,   4,  -8,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, +3.392467736366959e-05, -1.511101396473551e-06 },
 {   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.140779257662208e-06, +4.159884204788708e-06 },
@@ -1363,9 +1380,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +6.283283518205015e-09, +4.310651155144283e-10 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, +2.926411548236687e-09, +3.713111197740398e-09 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -3.271916800559542e-09, +3.340271625553513e-09 },
-{   0,   0,  11, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.197219444468167e-10, -6.473720952669137e-09 },
-} },
-{   4,   2,   2, 121, {
+{   0,   0,  11, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.197219444468167e-10, -6.473720952669137e-09 }
+};
+
+static constexpr VSOP2013Term _l2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.432192152061476e-05 },
 {   0,   0,   8, -16,   0,   0,   0,   0,   0,   4,   5,   0,   0,   0,   0,   0,   0, +1.588460249318501e-06, +9.691488856676208e-06 },
 {   0,   0,   4,  -8,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, +1.338015515532807e-07, +2.173692005747185e-06 },
@@ -1486,9 +1504,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   9, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.562061760579882e-09, -1.321780067306586e-10 },
 {   0,   0,  10, -14,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.405804182423776e-09, +2.171946885283511e-09 },
 {   0,   0,   8, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.201107793605451e-09, +2.331848180733601e-09 },
-{   0,   0,   0,   4,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, +1.319508696601488e-09, +2.201904216778393e-09 },
-} },
-{   4,   2,   3,  57, {
+{   0,   0,   0,   4,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, +1.319508696601488e-09, +2.201904216778393e-09 }
+};
+
+static constexpr VSOP2013Term _l3[] = {
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.237462981980040e-07, +1.849168951656110e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.142755393737710e-07 },
 {   0,   0,   4,  -8,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -1.019907473752331e-07, +1.935060624173663e-09 },
@@ -1545,9 +1564,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   8, -14,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.048009154280181e-10, +1.316431885585253e-09 },
 {   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.950511999371453e-10, -8.802742600695606e-10 },
 {   0,   0,   9, -16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.472209486627421e-10, +8.112038343816710e-10 },
-{   0,   3,   0,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.405190600666130e-10, +9.373931278599991e-10 },
-} },
-{   4,   2,   4,  26, {
+{   0,   3,   0,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.405190600666130e-10, +9.373931278599991e-10 }
+};
+
+static constexpr VSOP2013Term _l4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.151849842298193e-07 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.499671454943439e-08, +1.812819061787064e-08 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.237352262089132e-09, +7.083868302560463e-09 },
@@ -1573,9 +1593,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   2,   1,  -8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.468413211443086e-10, +8.605600041768395e-11 },
 {   0,   0,   4,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.445891932565637e-11, -4.786546152748907e-10 },
 {   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.380758271067065e-11, -4.699458247579673e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.958279615757546e-10, -3.094059728771877e-10 },
-} },
-{   4,   2,   5,  11, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.958279615757546e-10, -3.094059728771877e-10 }
+};
+
+static constexpr VSOP2013Term _l5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.402963387437254e-08 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.090228221119656e-09, -2.716822521407404e-09 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -9.122519561886006e-10, -3.809490643732071e-10 },
@@ -1586,20 +1607,32 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   6, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.129254821782496e-11, -1.219608245337121e-10 },
 {   0,   0,   7, -13,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0,   0,   0, -6.917958673851214e-11, -4.709807619040576e-11 },
 {   0,   0,  10, -19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.910189125544114e-11, +1.081759761020549e-11 },
-{   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -2.025850605038793e-11, +7.703363095119875e-11 },
-} },
-{   4,   2,   6,   4, {
+{   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -2.025850605038793e-11, +7.703363095119875e-11 }
+};
+
+static constexpr VSOP2013Term _l6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.436839925185774e-09 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.488602657163550e-10, -1.985121297146351e-10 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.795513439046533e-11, -9.775157891923823e-11 },
-{   0,   0,  17, -32,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.347838591708496e-12, +4.880673633658369e-11 },
-} },
-{   4,   2,   7,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.990366659178468e-10 },
-} } };
+{   0,   0,  17, -32,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.347838591708496e-12, +4.880673633658369e-11 }
+};
+
+static constexpr VSOP2013Term _l7[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.990366659178468e-10 }
+};
 
-static vector<VSOP2013Series> _k = {
-{   4,   3,   0, 294, {
+static constexpr VSOP2013Series _l[] = {
+{   4,   2,   0, 324, _l0 },
+{   4,   2,   1, 214, _l1 },
+{   4,   2,   2, 121, _l2 },
+{   4,   2,   3,  57, _l3 },
+{   4,   2,   4,  26, _l4 },
+{   4,   2,   5,  11, _l5 },
+{   4,   2,   6,   4, _l6 },
+{   4,   2,   7,   1, _l7 }
+};
+
+static constexpr VSOP2013Term _k0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +8.536559316400000e-02 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, +7.592342405387394e-07, +8.228281656722220e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +1.328646517298552e-06, -4.629996603431496e-05 },
@@ -1893,9 +1926,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, +2.863510872561145e-09, -1.059296093217138e-08 },
 {   0,   0,   0,   3,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -9.130065587816676e-09, +3.973843474940491e-09 },
 {   0,   0,  10, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.189721930980378e-08, +1.142156082335055e-09 },
-{   0,   0,   0,   3,   0,   0,   0,   0,   0,  -3,  -5,   0,   0,   0,   0,   0,   0, -7.986548062829076e-09, +4.748536082406659e-09 },
-} },
-{   4,   3,   1, 173, {
+{   0,   0,   0,   3,   0,   0,   0,   0,   0,  -3,  -5,   0,   0,   0,   0,   0,   0, -7.986548062829076e-09, +4.748536082406659e-09 }
+};
+
+static constexpr VSOP2013Term _k1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.763367938421870e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +1.754756076412481e-06, +1.065495035971535e-06 },
 {   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.789095244321896e-07, +4.357638654269466e-07 },
@@ -2068,9 +2102,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, -3.400894532661269e-10, +6.016098781802158e-09 },
 {   0,   0,   0,   3,   0,   0,   0,   0,   0,  -7,   5,   0,   0,   0,   0,   0,   0, -2.195238933991500e-09, -4.013132849352716e-09 },
 {   0,   4,   0,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.851691730737848e-09, -2.352124729422915e-09 },
-{   0,   0,   0,   1,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, +3.985067854440842e-09, -2.050403715713639e-09 },
-} },
-{   4,   3,   2, 100, {
+{   0,   0,   0,   1,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, +3.985067854440842e-09, -2.050403715713639e-09 }
+};
+
+static constexpr VSOP2013Term _k2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.464616210115644e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +4.645299455638257e-08, -6.403665659839849e-08 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.981260981762795e-09, -6.099145341732228e-08 },
@@ -2170,9 +2205,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0, +2.081140972316998e-09, -2.264015076565742e-10 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -1.518097221703964e-10, +2.092852021138340e-09 },
 {   0,   0,   0,   3,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, +1.539254495451271e-10, -2.067215376370293e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, -1.789015723933357e-09, -3.907629960351452e-10 },
-} },
-{   4,   3,   3,  47, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, -1.789015723933357e-09, -3.907629960351452e-10 }
+};
+
+static constexpr VSOP2013Term _k3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.664324658584607e-06 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.669914721753250e-09, -9.470432058861718e-10 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +4.823647709986418e-09, +2.881117870132097e-09 },
@@ -2219,9 +2255,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   3,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.354015297817772e-11, -5.347556823998068e-10 },
 {   0,   0,   0,   3,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, +3.472022339930031e-10, -2.264435599626597e-10 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +3.393935735190593e-10, -2.209665607251085e-10 },
-{   0,   0,  10, -18,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.108583618818703e-10, -2.182341331232795e-10 },
-} },
-{   4,   3,   4,  21, {
+{   0,   0,  10, -18,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.108583618818703e-10, -2.182341331232795e-10 }
+};
+
+static constexpr VSOP2013Term _k4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.095038205659516e-07 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.595982081682298e-10, +1.148425224974407e-09 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -3.801215421535193e-10, +4.470170582096752e-10 },
@@ -2242,9 +2279,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, +7.936672359934889e-11, +6.405655383884084e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, +1.576882093467162e-11, -1.191435690231919e-10 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -1,  -5,   0,   0,   0,   0,   0,   0, -1.144793724432532e-10, +1.233577251735137e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.050721882427320e-10, -2.053617226288403e-11 },
-} },
-{   4,   3,   5,   9, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.050721882427320e-10, -2.053617226288403e-11 }
+};
+
+static constexpr VSOP2013Term _k5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.467007735627301e-10 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.094017040866368e-10, +1.881947085606674e-11 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.565623129616971e-11, -3.767174872057323e-11 },
@@ -2253,16 +2291,26 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, +3.437436405460967e-11, -8.944726000823545e-12 },
 {   0,   0,   7, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.058346358794247e-11, -1.126209201745287e-11 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, +8.395691025786996e-12, -1.469473992721768e-11 },
-{   0,   0,   6, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.027676541368484e-11, -1.239208708551166e-11 },
-} },
-{   4,   3,   6,   3, {
+{   0,   0,   6, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.027676541368484e-11, -1.239208708551166e-11 }
+};
+
+static constexpr VSOP2013Term _k6[] = {
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.730027429573658e-12, -8.782944949678600e-12 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.650237807059121e-12, +4.172493921822930e-12 },
-{   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +3.307000696925009e-12, -1.627748473182749e-12 },
-} } };
+{   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, +3.307000696925009e-12, -1.627748473182749e-12 }
+};
+
+static constexpr VSOP2013Series _k[] = {
+{   4,   3,   0, 294, _k0 },
+{   4,   3,   1, 173, _k1 },
+{   4,   3,   2, 100, _k2 },
+{   4,   3,   3,  47, _k3 },
+{   4,   3,   4,  21, _k4 },
+{   4,   3,   5,   9, _k5 },
+{   4,   3,   6,   3, _k6 }
+};
 
-static vector<VSOP2013Series> _h = {
-{   4,   4,   0, 288, {
+static constexpr VSOP2013Term _h0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.789970916200000e-02 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -8.158300803476505e-05, -1.631333225777431e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -4.514621671640089e-05, -1.338560051808422e-06 },
@@ -2550,9 +2598,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -4,   4,   0,   0,   0,   0,   0,   0, -4.799812035406301e-09, +9.007030507953387e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -3,   0,   0,   0,   0,   0,   0, +8.259033491116072e-09, -5.530714844530291e-09 },
 {   0,   0,   4,  -9,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0,   0, -3.122371631136733e-09, +1.064966465324928e-08 },
-{   0,   0,   0,   1,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -1.060660629882812e-08, -2.912858128251717e-09 },
-} },
-{   4,   4,   1, 168, {
+{   0,   0,   0,   1,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -1.060660629882812e-08, -2.912858128251717e-09 }
+};
+
+static constexpr VSOP2013Term _h1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.246745883366477e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +1.064675812517608e-06, -1.758731729267913e-06 },
 {   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.328945977234749e-07, -6.841322086436945e-07 },
@@ -2720,9 +2769,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   8, -16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.130023097628835e-09, +4.201036190378307e-09 },
 {   0,   0,   9, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +6.647018421058994e-10, +5.581256405779601e-09 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -3,   5,   0,   0,   0,   0,   0,   0, +3.486558925945318e-09, +2.549466442176702e-09 },
-{   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.107650786236826e-09, -1.893122947521749e-09 },
-} },
-{   4,   4,   2,  98, {
+{   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.107650786236826e-09, -1.893122947521749e-09 }
+};
+
+static constexpr VSOP2013Term _h2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.551692161239763e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -6.444755087417827e-08, -4.669057602868794e-08 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.980509719784001e-08, -3.507019228599896e-10 },
@@ -2820,9 +2870,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   8, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.080901133353803e-09, +1.307088131173128e-09 },
 {   0,   0,   5,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.944055833852835e-09, +4.049856985616786e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, +1.351242078222362e-09, +9.787307489491688e-10 },
-{   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0, -1.606771682854980e-10, +2.158631344110976e-09 },
-} },
-{   4,   4,   3,  46, {
+{   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0, -1.606771682854980e-10, +2.158631344110976e-09 }
+};
+
+static constexpr VSOP2013Term _h3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.329624344097053e-06 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.767924951602517e-10, +9.442398314605181e-09 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -2.979197443756103e-09, +4.655459255248018e-09 },
@@ -2868,9 +2919,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   3,  -7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.329238011372860e-10, -4.008183428021493e-11 },
 {   0,   0,   0,   3,   0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0, -2.390254519800573e-10, -3.302742943543211e-10 },
 {   0,   0,   0,   3,   0,   0,   0,   0,   0,  -2,  -5,   0,   0,   0,   0,   0,   0, -2.115613312805247e-10, +3.391843783978863e-10 },
-{   0,   0,   0,   1,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +2.105932120029115e-10, +3.384603818252024e-10 },
-} },
-{   4,   4,   4,  20, {
+{   0,   0,   0,   1,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +2.105932120029115e-10, +3.384603818252024e-10 }
+};
+
+static constexpr VSOP2013Term _h4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.535074899958189e-08 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.115489720486496e-09, +6.761632584577276e-11 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -4.221544118471210e-10, -3.915354703379509e-10 },
@@ -2890,9 +2942,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +4.610091142259775e-11, -9.634139592385233e-11 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, -6.409888234609770e-11, +7.825535720981092e-11 },
 {   0,   0,   5,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.794739276057342e-12, -1.305652081428300e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, +1.178295541954784e-10, +1.424613502338365e-11 },
-} },
-{   4,   4,   5,   9, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, +1.178295541954784e-10, +1.424613502338365e-11 }
+};
+
+static constexpr VSOP2013Term _h5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.288097615171915e-10 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -6.927718874549830e-12, -1.054748169575822e-10 },
 {   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.202423906969867e-11, +4.677877695341843e-11 },
@@ -2901,16 +2954,26 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, -8.971401142159606e-12, -3.443999495577420e-11 },
 {   0,   0,   7, -13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.423259481756190e-11, -2.728419608397947e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.150147530754669e-11, -2.721693359106705e-11 },
-{   0,   0,   0,   1,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, +1.454302353143960e-11, +8.432270377195453e-12 },
-} },
-{   4,   4,   6,   3, {
+{   0,   0,   0,   1,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   0, +1.454302353143960e-11, +8.432270377195453e-12 }
+};
+
+static constexpr VSOP2013Term _h6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.159177857037481e-11 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.371799477388961e-12, -3.966206547230817e-13 },
-{   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.334248800568867e-12, +2.973059463660481e-12 },
-} } };
+{   0,   0,   9, -17,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -4.334248800568867e-12, +2.973059463660481e-12 }
+};
 
-static vector<VSOP2013Series> _q = {
-{   4,   5,   0,  59, {
+static constexpr VSOP2013Series _h[] = {
+{   4,   4,   0, 288, _h0 },
+{   4,   4,   1, 168, _h1 },
+{   4,   4,   2,  98, _h2 },
+{   4,   4,   3,  46, _h3 },
+{   4,   4,   4,  20, _h4 },
+{   4,   4,   5,   9, _h5 },
+{   4,   4,   6,   3, _h6 }
+};
+
+static constexpr VSOP2013Term _q0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.047042802100000e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +5.246813302741171e-08, +8.594274361620359e-07 },
 {   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.449904008972912e-07, +1.141430534438391e-07 },
@@ -2969,9 +3032,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   2,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +8.461335843567932e-09, +2.956963046991851e-09 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +4.281980944864125e-09, +6.378552354259243e-09 },
 {   0,   0,   5, -10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.605788034923050e-09, +5.850962748678746e-09 },
-{   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.545712622829404e-09, +1.635956182163615e-09 },
-} },
-{   4,   5,   1,  31, {
+{   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.545712622829404e-09, +1.635956182163615e-09 }
+};
+
+static constexpr VSOP2013Term _q1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.713209209255757e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -5.677487399022446e-08, +3.318755809935548e-08 },
 {   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.811146962227075e-09, -2.512633111088620e-08 },
@@ -3002,9 +3066,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   5,  -9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.641433009008076e-09, -5.863659664919197e-10 },
 {   0,   0,   3,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -3.554980350149797e-10, +2.824623143299396e-09 },
 {   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.489807341526242e-09, +5.586467718214123e-10 },
-{   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.458282836673889e-09, +1.404721926399005e-09 },
-} },
-{   4,   5,   2,  16, {
+{   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.458282836673889e-09, +1.404721926399005e-09 }
+};
+
+static constexpr VSOP2013Term _q2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.078518124360005e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -2.308077831697969e-09, -1.708547830670184e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +2.556721637214748e-09, +1.403891103429332e-09 },
@@ -3020,9 +3085,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, +2.835213317704904e-10, -5.532854624900750e-10 },
 {   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.155104897195855e-10, -5.005102609342345e-10 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, -5.131226978089331e-10, +2.901449471782683e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.113407890516423e-11, +6.856487647126319e-10 },
-} },
-{   4,   5,   3,   8, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.113407890516423e-11, +6.856487647126319e-10 }
+};
+
+static constexpr VSOP2013Term _q3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.388846384860339e-06 },
 {   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.186254534502900e-11, +1.584097740559248e-10 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +2.458626258058778e-11, +1.460266581945905e-10 },
@@ -3030,19 +3096,29 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -2.662507314230173e-11, +1.176471444871072e-10 },
 {   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.578948917811133e-11, +8.229264776026907e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.116050098390660e-10, -1.878835106375559e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -8.558017798707556e-11, -2.014133147138803e-11 },
-} },
-{   4,   5,   4,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -8.558017798707556e-11, -2.014133147138803e-11 }
+};
+
+static constexpr VSOP2013Term _q4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +9.109734983080438e-09 },
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.885270377276419e-11, +2.710422348253381e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.189854035430838e-12, -1.329482746506025e-11 },
-} },
-{   4,   5,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.744083760717282e-09 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.189854035430838e-12, -1.329482746506025e-11 }
+};
+
+static constexpr VSOP2013Term _q5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.744083760717282e-09 }
+};
 
-static vector<VSOP2013Series> _p = {
-{   4,   6,   0,  56, {
+static constexpr VSOP2013Series _q[] = {
+{   4,   5,   0,  59, _q0 },
+{   4,   5,   1,  31, _q1 },
+{   4,   5,   2,  16, _q2 },
+{   4,   5,   3,   8, _q3 },
+{   4,   5,   4,   3, _q4 },
+{   4,   5,   5,   1, _q5 }
+};
+
+static constexpr VSOP2013Term _p0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.228448645700000e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +8.451824768408958e-07, -7.454192373232668e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -1.464107166424126e-07, +2.827376448972970e-07 },
@@ -3098,9 +3174,10 @@ static vector<VSOP2013Series> _p = {
 {   1,   0,   0,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.452715716425785e-09, +6.006494326697074e-09 },
 {   0,   2,   0,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -5.119342094128436e-09, -6.319773324393894e-09 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +6.402627940130470e-09, -4.284818205412684e-09 },
-{   0,   0,   2,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.282331209369154e-09, -7.917740837316151e-09 },
-} },
-{   4,   6,   1,  29, {
+{   0,   0,   2,  -1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.282331209369154e-09, -7.917740837316151e-09 }
+};
+
+static constexpr VSOP2013Term _p1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.080243440121441e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +3.023030769487578e-08, +5.747001717834816e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -1.284053640307716e-08, -2.374144101021306e-08 },
@@ -3129,9 +3206,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   3,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0,   0,   0, +1.304725890364275e-09, +2.199105352635115e-09 },
 {   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.225355809288744e-09, +2.113620670782072e-09 },
 {   0,   0,   6, -11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +9.493889312385352e-10, +2.226466819898205e-09 },
-{   0,   0,   3,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.637429843953263e-09, -4.795275786345610e-10 },
-} },
-{   4,   6,   2,  16, {
+{   0,   0,   3,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -2.637429843953263e-09, -4.795275786345610e-10 }
+};
+
+static constexpr VSOP2013Term _p2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.920867334542991e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -1.709020899911859e-09, +2.420991267557025e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +1.302860328647180e-09, -2.713231732286074e-09 },
@@ -3147,9 +3225,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.516390257237364e-10, +4.256273282786963e-10 },
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,  -3,   0,   0,   0,   0,   0,   0,   0, -3.810629747827032e-10, -3.716991487995186e-10 },
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0,   0, +3.602743417766476e-10, +3.779195755037523e-10 },
-{   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.621715776763914e-10, -5.079087685415620e-10 },
-} },
-{   4,   6,   3,   8, {
+{   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +1.621715776763914e-10, -5.079087685415620e-10 }
+};
+
+static constexpr VSOP2013Term _p3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +8.713671657696112e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +7.624491687690110e-11, -1.685926404042897e-10 },
 {   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.261383439364439e-10, -4.439845161806819e-11 },
@@ -3157,42 +3236,61 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -1.296571276248752e-10, -2.318824928413275e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +1.309164291828521e-10, +1.397276652051160e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -1.948646589464200e-11, +8.598925243844954e-11 },
-{   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.245621909479450e-11, +2.257224339043675e-11 },
-} },
-{   4,   6,   4,   3, {
+{   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8.245621909479450e-11, +2.257224339043675e-11 }
+};
+
+static constexpr VSOP2013Term _p4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.082821399822329e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.069701125505216e-11, +8.915539196253361e-12 },
-{   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.732117614630103e-12, -1.651574262073118e-11 },
-} },
-{   4,   6,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.910273921909445e-11 },
-} } };
+{   0,   0,   8, -15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +3.732117614630103e-12, -1.651574262073118e-11 }
+};
+
+static constexpr VSOP2013Term _p5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.910273921909445e-11 }
+};
 
+static constexpr VSOP2013Series _p[] = {
+{   4,   6,   0,  56, _p0 },
+{   4,   6,   1,  29, _p1 },
+{   4,   6,   2,  16, _p2 },
+{   4,   6,   3,   8, _p3 },
+{   4,   6,   4,   3, _p4 },
+{   4,   6,   5,   1, _p5 }
+};
+
+
+vector<VSOP2013PackedSeries> VSOP2013::marsPackedSeries ( void )
+{
+    return packSeries ( { _a, _l, _k, _h, _q, _p } );
+}
 
 SSOrbit VSOP2013::marsOrbit ( double jed )
 {
+    if ( usePackedSeries() )
+        return getOrbit ( 4, jed, getPackedSeries ( 4 ) );
+    
     double a = 0.0, l = 0.0, k = 0.0, h = 0.0, q = 0.0, p = 0.0;
     double t = ( jed - 2451545.0 ) / 365250.0;
     double ll[17] = { 0 };
     
     evalLongitudes ( t, ll );
 
-    for ( VSOP2013Series &series : _a )
+    for ( const VSOP2013Series &series : _a )
         a += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _l )
+    for ( const VSOP2013Series &series : _l )
         l += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _k )
+    for ( const VSOP2013Series &series : _k )
         k += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _h )
+    for ( const VSOP2013Series &series : _h )
         h += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _q )
+    for ( const VSOP2013Series &series : _q )
         q += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _p )
+    for ( const VSOP2013Series &series : _p )
         p += evalSeries ( t, series, ll );
 
     double e = sqrt ( k * k + h * h );  // eccentricity
@@ -1,8 +1,7 @@
 #include "VSOP2013.hpp"
 #if VSOP2013_EMBED_SERIES
 
-static vector<VSOP2013Series> _a = {
-{   5,   1,   0, 324, {
+static constexpr VSOP2013Term _a0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.202603206345000e+00 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0, +5.100731376088231e-06, +6.908043510561457e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -2.878287385373483e-05, -3.214904645945905e-04 },
@@ -326,9 +325,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   1,   0,   0,   0,   0,   0, -2.041662998122927e-08, +8.713231694054182e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,  -1,   2,   0,   0,   0,   0, -2.101103119289570e-08, +8.045681230173610e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   3,   0,   0,   0,   0,   0,   0, +2.885338129270364e-09, +2.615561401584376e-08 },
-{   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0, -3.419605213150913e-09, -2.505734635207752e-08 },
-} },
-{   5,   1,   1, 244, {
+{   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0,   0, -3.419605213150913e-09, -2.505734635207752e-08 }
+};
+
+static constexpr VSOP2013Term _a1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +9.779860650885716e-05, +2.824746971953850e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, +1.896590586074550e-05, -2.292145555389705e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, +2.209583739367573e-05, -1.795736921027807e-05 },
@@ -572,9 +572,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, -18,   0,   0,   0,   0,   0,   0, +1.107157727392176e-08, -2.560059741713898e-09 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  -5,   0,   0,   0,   0,   0,   0, -9.072682528193944e-09, -4.436098221363841e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, -12,   0,   0,   0,   0,   0,   0, +3.574730069256836e-09, -9.893813569856095e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   2,   0,   0,   0,   0,   0, -2.505321437596945e-09, -1.085962524409481e-08 },
-} },
-{   5,   1,   2, 153, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   2,   0,   0,   0,   0,   0, -2.505321437596945e-09, -1.085962524409481e-08 }
+};
+
+static constexpr VSOP2013Term _a2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -8.439980695835434e-06, +1.923847047408348e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, +1.304222275526331e-06, +1.658539515043111e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, -2.416962633645190e-06, +3.946097813035192e-07 },
@@ -727,9 +728,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  14, -18,   0,   0,   0,   0,   0,   0, -2.684539657967633e-09, -8.397863800167026e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,  -4,   0,   0,   0,   0,   0,   0, +2.366605176600703e-09, -8.704454409351592e-09 },
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0,   0,   0, -1.090146106205817e-08, +5.927607465258818e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -14,   3,   0,   0,   0,   0,   0, -7.543305421486883e-09, +3.342831736845263e-09 },
-} },
-{   5,   1,   3,  88, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -14,   3,   0,   0,   0,   0,   0, -7.543305421486883e-09, +3.342831736845263e-09 }
+};
+
+static constexpr VSOP2013Term _a3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.445427500388217e-06, -1.547929857527429e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +3.188255954380461e-07, +2.791594272355200e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, +5.107102072632548e-09, -2.266447046540960e-07 },
@@ -817,9 +819,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.929217761898074e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, -9.732222766283027e-10, -4.947031726450840e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   5,   0,   0,   0,   0,   0,   0, -3.423073630345171e-09, +2.472519812097686e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, +4.486098402704502e-09, -1.374897348963305e-09 },
-} },
-{   5,   1,   4,  46, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, +4.486098402704502e-09, -1.374897348963305e-09 }
+};
+
+static constexpr VSOP2013Term _a4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.044330455487113e-07, -2.238239680442930e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -6.638278380679850e-08, +5.664380379344806e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0,   0, +4.722845159875839e-09, +1.830217796193390e-08 },
@@ -865,9 +868,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -8,   0,   0,   0,   0,   0,   0, +2.073093041602438e-09, +8.931966883524339e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -14,   0,   0,   0,   0,   0,   0, -2.678712986172734e-10, -2.620288549658473e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -1,   0,   0,   0,   0,   0,   0, +9.825994208525294e-10, +1.888273416239970e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0, -2.041942664854291e-09, +8.202420750593143e-10 },
-} },
-{   5,   1,   5,  22, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0, -2.041942664854291e-09, +8.202420750593143e-10 }
+};
+
+static constexpr VSOP2013Term _a5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.513478310332555e-08, +2.107161059856010e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -7.567135512363059e-09, -1.233300978730986e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +1.129989467750161e-09, -2.281795202767685e-09 },
@@ -889,9 +893,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -11,   0,   0,   0,   0,   0,   0, -8.374541888264766e-10, -5.115633882830240e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, -3.477213896813795e-10, -5.213684838836568e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   0,   0,   0,   0,   0, -6.243961042005152e-10, +1.720196911340219e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -7,   0,   0,   0,   0,   0,   0, -1.426003274922831e-10, -6.465570967527396e-10 },
-} },
-{   5,   1,   6,  11, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -7,   0,   0,   0,   0,   0,   0, -1.426003274922831e-10, -6.465570967527396e-10 }
+};
+
+static constexpr VSOP2013Term _a6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +1.870837028400480e-09, -7.509731641884469e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.789124885384978e-09, +7.310964088888858e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, -3.425587684454614e-10, +8.490351125864236e-11 },
@@ -902,22 +907,35 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   0,   0,   0,   0,   0,   0, -1.443530036859942e-10, +6.083508928970483e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -9,   0,   0,   0,   0,   0,   0, +3.402882893284336e-11, -1.571795676211398e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -12,   0,   0,   0,   0,   0,   0, -2.790114806113037e-11, -1.493677043736564e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -12,   0,   0,   0,   0,   0,   0, +8.402686406672766e-11, +7.171540805646839e-11 },
-} },
-{   5,   1,   7,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -12,   0,   0,   0,   0,   0,   0, +8.402686406672766e-11, +7.171540805646839e-11 }
+};
+
+static constexpr VSOP2013Term _a7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +4.829176460405952e-11, +2.387395821605370e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.994472196344532e-11, -1.309493998992632e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, -5.388186285082352e-12, -6.255746508345706e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, -2.310687378547925e-11, +2.025692014061508e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -1.540480990779242e-11, +1.262193038046831e-11 },
-} },
-{   5,   1,   8,   2, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -1.540480990779242e-11, +1.262193038046831e-11 }
+};
+
+static constexpr VSOP2013Term _a8[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -2.616640057828521e-11, +9.626595057036631e-14 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, +9.773792405586039e-12, +7.776336363726945e-13 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, +9.773792405586039e-12, +7.776336363726945e-13 }
+};
+
+static constexpr VSOP2013Series _a[] = {
+{   5,   1,   0, 324, _a0 },
+{   5,   1,   1, 244, _a1 },
+{   5,   1,   2, 153, _a2 },
+{   5,   1,   3,  88, _a3 },
+{   5,   1,   4,  46, _a4 },
+{   5,   1,   5,  22, _a5 },
+{   5,   1,   6,  11, _a6 },
+{   5,   1,   7,   5, _a7 },
+{   5,   1,   8,   2, _a8 }
+};
 
-static vector<VSOP2013Series> _l = {
-{   5,   2,   0, 292, {
+static constexpr VSOP2013Term _l0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.995461070350000e-01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -5.666256834180089e-03, -8.925144752155674e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, +6.166232843201025e-04, -9.025260614463747e-05 },
@@ -1209,9 +1227,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0, +9.266508537322437e-09, -1.171189068763829e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   2,   0,   0,   0,   0,   0, -1.998922893151680e-09, +1.885291852967406e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, -15,   0,   0,   0,   0,   0,   0, +8.012999311071664e-09, +1.269129564845088e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   1,   0,   0,   0,   0,   0, +2.009393599913138e-08, +1.738421054446781e-10 },
-} },
-{   5,   2,   1, 202, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   1,   0,   0,   0,   0,   0, +2.009393599913138e-08, +1.738421054446781e-10 }
+};
+
+static constexpr VSOP2013Term _l1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.296909615623250e+02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +6.463174368757044e-04, -2.196106383104567e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, +3.796073585971277e-05, +4.440436406102723e-05 },
@@ -1413,9 +1432,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   2,   0,   0,   0,   0, +8.816638852969610e-09, +4.484192821178444e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,  -1,   0,   0,   0,   0,   0, -9.575489899330030e-09, +3.499621763443988e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,   0,   0, +6.934512174295370e-09, -6.025433427451699e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -9,  16,  -9,   0,   0,   0,   0, -1.005455579084307e-08, +2.736857347398961e-09 },
-} },
-{   5,   2,   2, 127, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -9,  16,  -9,   0,   0,   0,   0, -1.005455579084307e-08, +2.736857347398961e-09 }
+};
+
+static constexpr VSOP2013Term _l2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +4.312318531901481e-04, +1.928790661753141e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.483392972823448e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.433818064928569e-05, -9.487037871646341e-06 },
@@ -1542,9 +1562,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, -13,   0,   0,   0,   0,   0,   0, -9.412499591355667e-10, -7.106165973829163e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -7,   0,   0,   0,   0,   0,   0, -4.900537511757449e-09, -2.988683554792429e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  -5,   0,   0,   0,   0,   0,   0, +1.159331827952631e-10, +7.569196357140035e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +7.577120964297534e-09, +5.571903204076018e-11 },
-} },
-{   5,   2,   3,  73, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +7.577120964297534e-09, +5.571903204076018e-11 }
+};
+
+static constexpr VSOP2013Term _l3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -3.535350378107832e-05, +5.469025073461363e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +3.103318768964940e-06, -3.519212175160192e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -1.094373543392943e-06, +2.488222949070012e-07 },
@@ -1617,9 +1638,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, -15,   0,   0,   0,   0,   0,   0, -3.808757335409730e-09, -5.724354025414986e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -15,   0,   0,   0,   0,   0,   0, -8.609562388352000e-10, -3.370500139481913e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +7.509072054649874e-10, +3.448463908426820e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   0,   0, +3.773340205262188e-09, -4.066594163962267e-10 },
-} },
-{   5,   2,   4,  39, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   0,   0, +3.773340205262188e-09, -4.066594163962267e-10 }
+};
+
+static constexpr VSOP2013Term _l4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -4.984856462431523e-06, -4.666523516307367e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +6.236539422011207e-07, +7.384385432721765e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.253879303361725e-07 },
@@ -1658,9 +1680,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -11,   0,   0,   0,   0,   0,   0, -2.316458792767705e-09, +4.133338416233527e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, +1.712972547984748e-09, -6.621272910588724e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0,   0, +9.860420529493609e-10, +1.301561676777147e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -17,   0,   0,   0,   0,   0,   0, +1.820236354029753e-09, -3.756281207434146e-10 },
-} },
-{   5,   2,   5,  19, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -17,   0,   0,   0,   0,   0,   0, +1.820236354029753e-09, -3.756281207434146e-10 }
+};
+
+static constexpr VSOP2013Term _l5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +4.809490708496387e-07, -3.346173859078089e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.372182687955888e-07, +8.294098125525814e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +2.690297690532524e-08, +5.562638468487505e-09 },
@@ -1679,9 +1702,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, -7.325054178539098e-10, -2.602718734424773e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0, +4.694955304117381e-10, +3.991915781312772e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -14,   0,   0,   0,   0,   0,   0, -4.543901366907960e-10, -3.319202754175546e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,  -2,   7,   0,   0,   0,   0, +3.963253730004418e-10, +3.521150092991532e-10 },
-} },
-{   5,   2,   6,  10, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,  -2,   7,   0,   0,   0,   0, +3.963253730004418e-10, +3.521150092991532e-10 }
+};
+
+static constexpr VSOP2013Term _l6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.592688251529058e-08, +4.087788028252074e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -8.155827013897258e-09, -2.081234429221949e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -1.503379742756532e-09, +2.764308179206619e-09 },
@@ -1691,21 +1715,34 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -13,  -2,   7,   0,   0,   0,   0, +2.641004003878716e-10, +2.378937537493725e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, -1.938044332391154e-10, +2.458830721410819e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -12,   0,   0,   0,   0,   0,   0, +2.726190001154478e-10, -5.454797101663361e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,  -2,   7,   0,   0,   0,   0, +1.104081034526121e-10, -2.072458252563391e-10 },
-} },
-{   5,   2,   7,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,  -2,   7,   0,   0,   0,   0, +1.104081034526121e-10, -2.072458252563391e-10 }
+};
+
+static constexpr VSOP2013Term _l7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -3.003812156311042e-09, +4.131850339568882e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +2.654675563975797e-09, -5.100387301039008e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, -4.543468642047927e-10, +3.724119776542162e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -1.931636766403276e-10, -2.419211304229328e-10 },
-} },
-{   5,   2,   8,   2, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -1.931636766403276e-10, -2.419211304229328e-10 }
+};
+
+static constexpr VSOP2013Term _l8[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -2.038353491370583e-12, +2.906077285662028e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +9.734010126124410e-12, -2.025884195635560e-10 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +9.734010126124410e-12, -2.025884195635560e-10 }
+};
+
+static constexpr VSOP2013Series _l[] = {
+{   5,   2,   0, 292, _l0 },
+{   5,   2,   1, 202, _l1 },
+{   5,   2,   2, 127, _l2 },
+{   5,   2,   3,  73, _l3 },
+{   5,   2,   4,  39, _l4 },
+{   5,   2,   5,  19, _l5 },
+{   5,   2,   6,  10, _l6 },
+{   5,   2,   7,   4, _l7 },
+{   5,   2,   8,   2, _l8 }
+};
 
-static vector<VSOP2013Series> _k = {
-{   5,   3,   0, 260, {
+static constexpr VSOP2013Term _k0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.698584700500000e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -4.347545948308645e-06, +6.529663871698988e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -3.444205345201338e-04, +1.608724094551382e-04 },
@@ -1965,9 +2002,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   2,   0,   0,   0,   0, -3.321527687129486e-09, +1.301228117608818e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  13, -11,   0,   0,   0,   0,   0,   0, -5.182117429173328e-09, +1.102094577102513e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  13, -14,   0,   0,   0,   0,   0,   0, +7.702608123794527e-09, +8.476058251535322e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   2,   0,   0,   0,   0, -5.004047573844305e-09, -1.079912268373708e-08 },
-} },
-{   5,   3,   1, 172, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   2,   0,   0,   0,   0, -5.004047573844305e-09, -1.079912268373708e-08 }
+};
+
+static constexpr VSOP2013Term _k1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.130313783478597e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -3.076454418708960e-05, -9.837616545761109e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, -1.531233471206593e-05, +1.252856676716392e-05 },
@@ -2139,9 +2177,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   2,   0,   0,   0,   0,   0, +2.303609705032836e-09, +6.040643203258503e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, -12,   0,   0,   0,   0,   0,   0, +6.311611959961992e-09, -1.919681808624439e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,  -3,   0,   0,   0,   0,   0, -2.599186036968663e-09, -5.619064391972506e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   2,   0,   0,   0,   0,   0, -4.418753794293877e-09, +3.785659134648816e-09 },
-} },
-{   5,   3,   2, 104, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   2,   0,   0,   0,   0,   0, -4.418753794293877e-09, +3.785659134648816e-09 }
+};
+
+static constexpr VSOP2013Term _k2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.093621680728395e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.429692860732896e-05, -2.019869628614621e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, -4.513854944564841e-07, -1.740800180455808e-06 },
@@ -2245,9 +2284,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, -14,   0,   0,   0,   0,   0,   0, -4.159175724733879e-09, -2.149334148234559e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, -16,   0,   0,   0,   0,   0,   0, -2.003338725955049e-09, -3.953961132647175e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -17,   0,   0,   0,   0,   0,   0, +2.540017425494683e-09, -3.277550702969016e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, -1.303361637117378e-09, -4.377587859747575e-09 },
-} },
-{   5,   3,   3,  59, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0, -1.303361637117378e-09, -4.377587859747575e-09 }
+};
+
+static constexpr VSOP2013Term _k3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.317689288877983e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -9.780229402820981e-08, +1.356236361785286e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +5.214086864207020e-08, -3.697484602222998e-07 },
@@ -2306,9 +2346,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -1,   0,   0,   0,   0,   0,   0, -4.465600943383694e-10, -2.735618610537152e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, -14,   0,   0,   0,   0,   0,   0, +2.399346767284594e-09, -7.672487027898513e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -15,   0,   0,   0,   0,   0,   0, -2.443081871748592e-09, +6.870960704109496e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   1,   4,   0,   0,   0,   0, -2.042427350140678e-09, -1.060384829494932e-09 },
-} },
-{   5,   3,   4,  30, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   1,   4,   0,   0,   0,   0, -2.042427350140678e-09, -1.060384829494932e-09 }
+};
+
+static constexpr VSOP2013Term _k4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.965902836610493e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -9.561966611689859e-08, -3.527431007600007e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +6.177959320180341e-08, +1.914540923681149e-08 },
@@ -2338,9 +2379,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -9,   0,   0,   0,   0,   0,   0, +7.066560537079310e-10, -8.196959556214904e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -13,   0,   0,   0,   0,   0,   0, -1.034365483412090e-09, -3.727809222553014e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -14,   0,   0,   0,   0,   0,   0, -1.342931853596349e-10, -1.231111351458259e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -12,   0,   0,   0,   0,   0,   0, +1.763121255443623e-10, +9.921155490915736e-10 },
-} },
-{   5,   3,   5,  15, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -12,   0,   0,   0,   0,   0,   0, +1.763121255443623e-10, +9.921155490915736e-10 }
+};
+
+static constexpr VSOP2013Term _k5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -4.161848047395293e-09, +8.038104369248599e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +4.202881024887243e-09, -5.179883136285555e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.336893310995354e-09 },
@@ -2355,29 +2397,43 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0, +1.907754068268250e-10, -1.944625213663443e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -3.344046725101108e-10, +2.338262747556071e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -12,   0,   0,   0,   0,   0,   0, +1.070503725864163e-10, -2.136002346865333e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0,   0, +1.076428364612285e-10, +2.017144706880487e-10 },
-} },
-{   5,   3,   6,   7, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0,   0, +1.076428364612285e-10, +2.017144706880487e-10 }
+};
+
+static constexpr VSOP2013Term _k6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -8.376194213317451e-10, -6.679002048917696e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.354232007354588e-10, +3.531920066158634e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, +1.967626989944780e-10, +1.873080183428544e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, -1.447964503811626e-10, -2.437693298622670e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   0,   0,   0,   0,   0, -1.993880491052032e-11, +1.000945445306261e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, +6.604173467449565e-11, -4.277681548011565e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +1.550645929083659e-11, -8.147526818302845e-11 },
-} },
-{   5,   3,   7,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +1.550645929083659e-11, -8.147526818302845e-11 }
+};
+
+static constexpr VSOP2013Term _k7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +8.598299150090356e-11, -7.032030849014625e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, +3.351457145827777e-11, +4.468853293506265e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, -3.478515523170690e-11, +2.584205547358460e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.415970206937004e-11, +1.065158379029509e-11 },
-} },
-{   5,   3,   8,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +4.643505963745040e-12, +9.258083043780913e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.415970206937004e-11, +1.065158379029509e-11 }
+};
+
+static constexpr VSOP2013Term _k8[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +4.643505963745040e-12, +9.258083043780913e-12 }
+};
+
+static constexpr VSOP2013Series _k[] = {
+{   5,   3,   0, 260, _k0 },
+{   5,   3,   1, 172, _k1 },
+{   5,   3,   2, 104, _k2 },
+{   5,   3,   3,  59, _k3 },
+{   5,   3,   4,  30, _k4 },
+{   5,   3,   5,  15, _k5 },
+{   5,   3,   6,   7, _k6 },
+{   5,   3,   7,   4, _k7 },
+{   5,   3,   8,   1, _k8 }
+};
 
-static vector<VSOP2013Series> _h = {
-{   5,   4,   0, 262, {
+static constexpr VSOP2013Term _h0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.200371972600000e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -6.427198737338274e-04, +1.479851653240996e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.604439138315285e-04, -3.411176558900131e-04 },
@@ -2639,9 +2695,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   2,   0,   0,   0,   0, +8.846515558557594e-09, -6.783672494020590e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0,   0, +1.443097778716323e-08, +1.094331501704424e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,  -4,   0,   0,   0,   0,   0,   0, +1.408235946669883e-08, +1.305277370909552e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -14,   3,   0,   0,   0,   0,   0, +1.127658985031732e-08, -3.817440243272867e-09 },
-} },
-{   5,   4,   1, 173, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -14,   3,   0,   0,   0,   0,   0, +1.127658985031732e-08, -3.817440243272867e-09 }
+};
+
+static constexpr VSOP2013Term _h1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.171843761244132e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +9.683559870129499e-05, -3.097332848074398e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, -1.487381075931062e-05, -7.517614533633825e-06 },
@@ -2814,9 +2871,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   3,   0,   0,   0,   0,   0, -8.432276753774485e-10, -7.138269100570894e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -4,   0,   0,   0,   0,   0, -1.032543605861189e-09, -6.884772239040724e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   2,   0,   0,   0,   0,   0, -3.765127451137470e-09, -4.072903686166179e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   3,   0,   0,   0,   0,   0, +3.000365727058573e-09, -4.727032680153126e-09 },
-} },
-{   5,   4,   2, 105, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   3,   0,   0,   0,   0,   0, +3.000365727058573e-09, -4.727032680153126e-09 }
+};
+
+static constexpr VSOP2013Term _h2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +9.861588767909847e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.184641568162600e-06, +1.393825317230794e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -7.030041780636023e-09, -1.612488445795039e-06 },
@@ -2921,9 +2979,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, -14,   0,   0,   0,   0,   0,   0, -8.864038688342478e-10, -4.810282272832624e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -2,   0,   0,   0,   0,   0,   0, +2.920567192952584e-09, -2.751915673373385e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, -17,   0,   0,   0,   0,   0,   0, +7.862070424670895e-10, +4.496331378512259e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -3,   0,   0,   0,   0,   0, -3.706639674407891e-09, -1.489828231933535e-09 },
-} },
-{   5,   4,   3,  59, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -3,   0,   0,   0,   0,   0, -3.706639674407891e-09, -1.489828231933535e-09 }
+};
+
+static constexpr VSOP2013Term _h3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.174064995306223e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.305250151470391e-06, -5.172762113137991e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +3.648069668664833e-07, +5.214122936523273e-08 },
@@ -2982,9 +3041,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -15,   0,   0,   0,   0,   0,   0, -5.841731449166218e-10, -2.460506012348693e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -16,   0,   0,   0,   0,   0,   0, +2.325168597945127e-09, +6.964775208004935e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -2,   0,   0,   0,   0,   0,   0, -1.107360577746643e-09, -1.890193065526080e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   1,   0,   0,   0,   0,   0,   0, +1.303055827802674e-09, +1.611334413708677e-09 },
-} },
-{   5,   4,   4,  30, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   1,   0,   0,   0,   0,   0,   0, +1.303055827802674e-09, +1.611334413708677e-09 }
+};
+
+static constexpr VSOP2013Term _h4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.727154984257942e-08, -9.090238513006498e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.969548584223314e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.892957549953459e-08, +6.072684200803757e-08 },
@@ -3014,9 +3074,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -14,   0,   0,   0,   0,   0,   0, +1.200932861622321e-09, -1.245023484675603e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -13,   0,   0,   0,   0,   0,   0, +2.765049439103202e-10, -1.029921409291855e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +7.620205311459976e-10, +4.502807749228632e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, +1.113306475831917e-09, +7.914414249709433e-11 },
-} },
-{   5,   4,   5,  14, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, +1.113306475831917e-09, +7.914414249709433e-11 }
+};
+
+static constexpr VSOP2013Term _h5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -7.865456265720184e-09, -4.085374893331420e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +4.943632811913910e-09, +3.193036659893271e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.976956704728384e-09 },
@@ -3030,29 +3091,43 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, +1.724226347897014e-11, -3.446109149958106e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0, +1.894358849236937e-10, +1.705202231602926e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -12,   0,   0,   0,   0,   0,   0, +2.195062879134400e-10, +1.264724150367866e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -1.160052170152262e-10, -2.011102430376210e-10 },
-} },
-{   5,   4,   6,   7, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -1.160052170152262e-10, -2.011102430376210e-10 }
+};
+
+static constexpr VSOP2013Term _h6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +6.510746500406458e-10, -8.152107439683555e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, -2.596030562654690e-10, +2.907818280588392e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.533712875466918e-10, +2.424735136640534e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, -1.830865723391578e-10, +1.934806484840811e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.571340407995264e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   0,   0,   0,   0,   0, -9.630839627381504e-11, -1.104811816204791e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +7.721488781783517e-11, +1.485109041381652e-11 },
-} },
-{   5,   4,   7,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +7.721488781783517e-11, +1.485109041381652e-11 }
+};
+
+static constexpr VSOP2013Term _h7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +6.801783701986151e-11, +8.317225136814664e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, -2.542973858106737e-11, -3.382247416148610e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.367964312827538e-11, -1.617803476858073e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   0,   0,   0,   0,   0, +2.650915820904858e-12, -7.764099642586049e-12 },
-} },
-{   5,   4,   8,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -8.928994249057967e-12, +4.427652479444607e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   0,   0,   0,   0,   0, +2.650915820904858e-12, -7.764099642586049e-12 }
+};
 
-static vector<VSOP2013Series> _q = {
-{   5,   5,   0,  58, {
+static constexpr VSOP2013Term _h8[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -8.928994249057967e-12, +4.427652479444607e-12 }
+};
+
+static constexpr VSOP2013Series _h[] = {
+{   5,   4,   0, 262, _h0 },
+{   5,   4,   1, 173, _h1 },
+{   5,   4,   2, 105, _h2 },
+{   5,   4,   3,  59, _h3 },
+{   5,   4,   4,  30, _h4 },
+{   5,   4,   5,  14, _h5 },
+{   5,   4,   6,   7, _h6 },
+{   5,   4,   7,   4, _h7 },
+{   5,   4,   8,   1, _h8 }
+};
+
+static constexpr VSOP2013Term _q0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.065622731000000e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -7.510064823645628e-06, +4.127505042017256e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, +1.895509290582169e-06, +1.129707750006306e-06 },
@@ -3110,9 +3185,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +1.035873104246500e-08, +8.614016713432553e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  -8,   0,   0,   0,   0,   0,   0, +1.019043809925578e-08, -8.429146310859785e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, -9.874787353863466e-09, +8.151731983498754e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -5,   0,   0,   0,   0,   0,   0, -1.385130786513972e-09, -1.594478190720012e-08 },
-} },
-{   5,   5,   1,  32, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -5,   0,   0,   0,   0,   0,   0, -1.385130786513972e-09, -1.594478190720012e-08 }
+};
+
+static constexpr VSOP2013Term _q1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.135048283468208e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, +2.153259807666326e-07, -2.666748877949371e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, +2.034151644448207e-07, -7.945056948017118e-08 },
@@ -3144,9 +3220,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   0,   0, -3.686343632263052e-09, -5.313287575149179e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0,   0, -4.731368335531180e-09, -4.200594338991612e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0, -4.003922391693269e-09, +4.730284102570736e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0,   0, -5.331287662716060e-09, +3.218469891514067e-09 },
-} },
-{   5,   5,   2,  16, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0,   0, -5.331287662716060e-09, +3.218469891514067e-09 }
+};
+
+static constexpr VSOP2013Term _q2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.671376172208626e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.555832882419421e-08, +2.689482076010225e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, +1.944675992627902e-09, +1.232338908642923e-08 },
@@ -3162,9 +3239,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0, +1.911546923541512e-09, -1.175706538347727e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -1,   0,   0,   0,   0,   0,   0, -5.304526501343773e-10, +2.298117685113437e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, +1.198932141007711e-09, +1.273636742862563e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -1.066926635149291e-09, +1.221307840889138e-09 },
-} },
-{   5,   5,   3,   8, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -1.066926635149291e-09, +1.221307840889138e-09 }
+};
+
+static constexpr VSOP2013Term _q3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.983406736254565e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -7.030053912226966e-10, -5.035773113108818e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -2.018044644710967e-09, +1.462143066004512e-09 },
@@ -3172,24 +3250,36 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, -1.108200039491229e-09, -6.165042334593350e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +1.589071352116926e-10, -1.314612897848170e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, +7.059000421837033e-10, -5.496082254775128e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0, +4.776261535619012e-10, +4.392062987604923e-10 },
-} },
-{   5,   5,   4,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0, +4.776261535619012e-10, +4.392062987604923e-10 }
+};
+
+static constexpr VSOP2013Term _q4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.667508151933561e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +6.144655163468247e-10, -1.260208675437710e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -1.650526753959442e-10, -8.450436358232856e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, -1.036976293935391e-10, -4.631453159742177e-11 },
-} },
-{   5,   5,   5,   2, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, -1.036976293935391e-10, -4.631453159742177e-11 }
+};
+
+static constexpr VSOP2013Term _q5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.257728641776597e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.792277867124089e-11, +6.331865347372887e-11 },
-} },
-{   5,   5,   6,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.672263002142630e-11 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.792277867124089e-11, +6.331865347372887e-11 }
+};
 
-static vector<VSOP2013Series> _p = {
-{   5,   6,   0,  56, {
+static constexpr VSOP2013Term _q6[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.672263002142630e-11 }
+};
+
+static constexpr VSOP2013Series _q[] = {
+{   5,   5,   0,  58, _q0 },
+{   5,   5,   1,  32, _q1 },
+{   5,   5,   2,  16, _q2 },
+{   5,   5,   3,   8, _q3 },
+{   5,   5,   4,   4, _q4 },
+{   5,   5,   5,   2, _q5 },
+{   5,   5,   6,   1, _q6 }
+};
+
+static constexpr VSOP2013Term _p0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.118386458000000e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -3.339923137107150e-06, -7.835068902148984e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, -1.378654418658206e-06, +1.698016251121175e-06 },
@@ -3245,9 +3335,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -7,   0,   0,   0,   0,   0,   0, +1.621085518856045e-09, -1.873122973518113e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, -1.336819283184208e-08, +6.960007804715552e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, +1.195141731212635e-08, -7.966333271461462e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -8,   0,   0,   0,   0,   0,   0, +1.315193782832794e-08, -4.777551202701678e-09 },
-} },
-{   5,   6,   1,  33, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -8,   0,   0,   0,   0,   0,   0, +1.315193782832794e-08, -4.777551202701678e-09 }
+};
+
+static constexpr VSOP2013Term _p1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.343211190834333e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, +2.806576783285896e-07, +1.859292772776353e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +5.524184130243616e-08, +2.892030255220875e-07 },
@@ -3280,9 +3371,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   0,   0, -5.400635182428424e-09, +3.519534909880183e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   0,   0,   0,   0,   0, +2.229847087645931e-09, +6.489847696059794e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -6,   0,   0,   0,   0,   0,   0, +5.176272582179119e-09, +2.442366107022646e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +1.392436148893320e-09, +5.836704349142451e-09 },
-} },
-{   5,   6,   2,  16, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +1.392436148893320e-09, +5.836704349142451e-09 }
+};
+
+static constexpr VSOP2013Term _p2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.088219062909500e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.690446191788929e-08, -2.114803094205927e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -2.038090763988976e-08, -1.405932445278295e-08 },
@@ -3298,9 +3390,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -1,   0,   0,   0,   0,   0,   0, +1.976266531143111e-09, +1.348327574913259e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0, -1.430585147125351e-09, -1.893331811465246e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +3.595584688719013e-10, +2.917766461079309e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, -2.511322044933368e-09, +4.171684385042957e-10 },
-} },
-{   5,   6,   3,   8, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, -2.511322044933368e-09, +4.171684385042957e-10 }
+};
+
+static constexpr VSOP2013Term _p3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.275024423083654e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +5.627277380338531e-09, -1.747396671805958e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, +1.602600444683713e-09, -2.238524599379955e-09 },
@@ -3308,47 +3401,68 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +1.251778402324686e-09, +9.795707104933338e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, +6.040473055537794e-10, +1.265699075696069e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0, +5.050158478461325e-10, +7.474156332374201e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, -6.953989468006662e-10, -2.950964495919521e-10 },
-} },
-{   5,   6,   4,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, -6.953989468006662e-10, -2.950964495919521e-10 }
+};
+
+static constexpr VSOP2013Term _p4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.434963652049033e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -6.100860981006596e-11, +7.679102385493322e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, +1.031382250931968e-10, +2.543775931450707e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.597268474596174e-10, +3.717337572968356e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, +4.003842471537341e-11, -1.039377450308111e-10 },
-} },
-{   5,   6,   5,   2, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, +4.003842471537341e-11, -1.039377450308111e-10 }
+};
+
+static constexpr VSOP2013Term _p5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.132662694940098e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -8.018020335186947e-11, -3.768964692381113e-11 },
-} },
-{   5,   6,   6,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.936367653717730e-11 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -8.018020335186947e-11, -3.768964692381113e-11 }
+};
+
+static constexpr VSOP2013Term _p6[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.936367653717730e-11 }
+};
+
+static constexpr VSOP2013Series _p[] = {
+{   5,   6,   0,  56, _p0 },
+{   5,   6,   1,  33, _p1 },
+{   5,   6,   2,  16, _p2 },
+{   5,   6,   3,   8, _p3 },
+{   5,   6,   4,   5, _p4 },
+{   5,   6,   5,   2, _p5 },
+{   5,   6,   6,   1, _p6 }
+};
+
+vector<VSOP2013PackedSeries> VSOP2013::jupiterPackedSeries ( void )
+{
+    return packSeries ( { _a, _l, _k, _h, _q, _p } );
+}
 
 SSOrbit VSOP2013::jupiterOrbit ( double jed )
 {
+    if ( usePackedSeries() )
+        return getOrbit ( 5, jed, getPackedSeries ( 5 ) );
+    
     double a = 0.0, l = 0.0, k = 0.0, h = 0.0, q = 0.0, p = 0.0;
     double t = ( jed - 2451545.0 ) / 365250.0;
     double ll[17] = { 0 };
     
     evalLongitudes ( t, ll );
 
-    for ( VSOP2013Series &series : _a )
+    for ( const VSOP2013Series &series : _a )
         a += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _l )
+    for ( const VSOP2013Series &series : _l )
         l += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _k )
+    for ( const VSOP2013Series &series : _k )
         k += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _h )
+    for ( const VSOP2013Series &series : _h )
         h += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _q )
+    for ( const VSOP2013Series &series : _q )
         q += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _p )
+    for ( const VSOP2013Series &series : _p )
         p += evalSeries ( t, series, ll );
 
     double e = sqrt ( k * k + h * h );  // eccentricity
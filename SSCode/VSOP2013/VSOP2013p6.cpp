@@ -1,8 +1,7 @@
 #include "VSOP2013.hpp"
 #if VSOP2013_EMBED_SERIES
 
-static vector<VSOP2013Series> _a = {
-{   6,   1,   0, 326, {
+static constexpr VSOP2013Term _a0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +9.554910386038999e+00 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, -3.437266469055700e-05, +3.363467481202068e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -2.229385518635504e-03, +2.756171976705157e-03 },
@@ -328,9 +327,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -13,   3,   0,   0,   0,   0,   0, -1.356457235289432e-07, +1.670016413604286e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -3,   0,   0,   0,   0, +2.137111666659446e-07, -8.888295749814192e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -2,  -3,   0,   0,   0,   0,   0, +2.795169169024832e-07, +2.191223313671825e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0, +2.467520172530858e-07, -5.365349015589166e-08 },
-} },
-{   6,   1,   1, 248, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0, +2.467520172530858e-07, -5.365349015589166e-08 }
+};
+
+static constexpr VSOP2013Term _a1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.105970394103897e-03, -3.193271577091174e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, -1.301383551544057e-04, +1.581125229230819e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, -1.265563862236850e-04, -1.470135629064336e-04 },
@@ -578,9 +578,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,  -4,   0,   0,   0,   0, -5.704541640640833e-08, +7.627168766037379e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, -18,   0,   0,   0,   0,   0,   0, -9.992541452292990e-10, -1.318290712811388e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, -1.074036762938747e-07, -2.533430340500049e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0,   0, -3.828835355938383e-08, -9.379882039629776e-08 },
-} },
-{   6,   1,   2, 159, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   0,   0,   0, -3.828835355938383e-08, -9.379882039629776e-08 }
+};
+
+static constexpr VSOP2013Term _a2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +9.543232806737214e-05, -2.175658703767189e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, -1.355073980465816e-05, +3.047971411338665e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   0,   0,   0,   0,   0,   0, +1.277617483417609e-05, -2.789650804287107e-05 },
@@ -739,9 +740,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   2,   0,   0,   0,   0,   0,   0, -5.919338076349720e-08, +1.389637579480286e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, -16,   0,   0,   0,   0,   0,   0, +1.186027911782048e-08, -6.057723281929861e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, -3.468903498153030e-08, +3.773617848739422e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0, -6.029855227532743e-08, -1.174661692866189e-08 },
-} },
-{   6,   1,   3,  90, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0, -6.029855227532743e-08, -1.174661692866189e-08 }
+};
+
+static constexpr VSOP2013Term _a3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.765513245963422e-05, +1.750455016051973e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -3.596540219568218e-06, -3.147894103406804e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, -3.850967305230505e-06, -2.543514190765736e-06 },
@@ -831,9 +833,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, -17,   0,   0,   0,   0,   0,   0, +5.339562999630497e-09, -3.237753641792947e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -3,   0,   0,   0,   0,   0,   0, +2.826435377082404e-08, -8.765395354747336e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,  -9,   0,   0,   0,   0,   0,   0, +2.885480254627859e-08, +7.996894521621419e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   1,   0,   0,   0,   0,   0,   0, +3.169766882657630e-08, +3.345266749050246e-09 },
-} },
-{   6,   1,   4,  48, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   1,   0,   0,   0,   0,   0,   0, +3.169766882657630e-08, +3.345266749050246e-09 }
+};
+
+static constexpr VSOP2013Term _a4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.311917652702994e-06, +2.531174622981228e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +7.486403252105042e-07, -6.389958552436178e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, +3.423595295975908e-07, -3.465199459724480e-07 },
@@ -881,9 +884,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -8,   0,   0,   0,   0,   0,   0, -1.238213556608669e-08, -6.282105818585471e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -15,   0,   0,   0,   0,   0,   0, -1.267440154344283e-08, -5.860600755673595e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -5.735785949401953e-09, +1.163831307518141e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, -15,   0,   0,   0,   0,   0,   0, +1.265976297324913e-08, +4.412599829692548e-09 },
-} },
-{   6,   1,   5,  23, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, -15,   0,   0,   0,   0,   0,   0, +1.265976297324913e-08, +4.412599829692548e-09 }
+};
+
+static constexpr VSOP2013Term _a5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.711500883696264e-07, -2.383038292804749e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +8.536459951750379e-08, +1.390978641233724e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, +2.251043632770212e-08, +3.580108579711039e-08 },
@@ -906,9 +910,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -10,   0,   0,   0,   0,   0,   0, +6.478906134831780e-09, +1.504806922430648e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +7.194041168846380e-10, -5.275021694079654e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -14,   0,   0,   0,   0,   0,   0, +2.466313163437811e-09, -3.480386531048454e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +2.494781674493872e-09, -3.256420053431116e-09 },
-} },
-{   6,   1,   6,  11, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +2.494781674493872e-09, -3.256420053431116e-09 }
+};
+
+static constexpr VSOP2013Term _a6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -2.110084746599739e-08, +8.471289518939769e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.023421999898973e-08, -8.267973788121696e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, +3.850508661351566e-09, -9.548501367210731e-10 },
@@ -919,22 +924,35 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -12,   0,   0,   0,   0,   0,   0, +2.614329581635356e-10, +2.379211571136712e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -7,   0,   0,   0,   0,   0,   0, -4.824071761093985e-10, -1.694089090747226e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -1.140905733918149e-09, -9.020261196345995e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   0,   0,   0,   0,   0, +7.490079620633658e-10, +1.115416152887112e-09 },
-} },
-{   6,   1,   7,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   0,   0,   0,   0,   0, +7.490079620633658e-10, +1.115416152887112e-09 }
+};
+
+static constexpr VSOP2013Term _a7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -5.450183276023943e-10, -2.691940854457816e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.257898156420167e-10, +1.481048147786732e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, +6.079478152494950e-11, +7.020854649233129e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   0,   0,   0,   0,   0,   0, +7.757507154085076e-11, +4.190067473303486e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +1.986248952582680e-10, -1.734381360682944e-10 },
-} },
-{   6,   1,   8,   2, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +1.986248952582680e-10, -1.734381360682944e-10 }
+};
+
+static constexpr VSOP2013Term _a8[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +2.952827922066158e-10, -1.537555458343564e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, -1.100426298290852e-10, -8.594065001066540e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, -1.100426298290852e-10, -8.594065001066540e-12 }
+};
+
+static constexpr VSOP2013Series _a[] = {
+{   6,   1,   0, 326, _a0 },
+{   6,   1,   1, 248, _a1 },
+{   6,   1,   2, 159, _a2 },
+{   6,   1,   3,  90, _a3 },
+{   6,   1,   4,  48, _a4 },
+{   6,   1,   5,  23, _a5 },
+{   6,   1,   6,  11, _a6 },
+{   6,   1,   7,   5, _a7 },
+{   6,   1,   8,   2, _a8 }
+};
 
-static vector<VSOP2013Series> _l = {
-{   6,   2,   0, 291, {
+static constexpr VSOP2013Term _l0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +8.740185101070000e-01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.394485247958371e-02, +2.196822377038024e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, +2.597835215572053e-03, -1.166003573736016e-05 },
@@ -1225,9 +1243,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +5.275413029084121e-09, +1.001292550087117e-07 },
 {   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +4.656886906301489e-09, +1.007149850197123e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -7,   0,   0,   0,   0,   0, -9.968443970194498e-08, -5.161071891676297e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0, +1.356996051941717e-08, +8.959415060567535e-08 },
-} },
-{   6,   2,   1, 213, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0, +1.356996051941717e-08, +8.959415060567535e-08 }
+};
+
+static constexpr VSOP2013Term _l1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.132990861084880e+02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.590734155170401e-03, +5.404682690426123e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -9.236930020131259e-05, -1.074916347085107e-04 },
@@ -1440,9 +1459,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -1, -16,   9,   0,   0,   0,   0, +2.076326711105305e-08, +2.395052909722285e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,  -2,   0,   0,   0,   0, +1.022814770838888e-08, -3.411794049115566e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  13, -17,   0,   0,   0,   0,   0,   0, +1.733760208117886e-08, +2.699001671022964e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   0, -1.355921287949796e-08, -3.064299853019244e-08 },
-} },
-{   6,   2,   2, 138, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   0, -1.355921287949796e-08, -3.064299853019244e-08 }
+};
+
+static constexpr VSOP2013Term _l2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.061268915745726e-03, -4.747083771768399e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.661911152525741e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +3.534082785170441e-05, +2.338193965235595e-05 },
@@ -1580,9 +1600,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   9, -16,   0,   0,   0,   0,   0,   0, +1.643465474493762e-08, -6.560285870277405e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -3,   0,   0,   0,   0,   0, -7.204631866560418e-09, -1.552910924336457e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   3,   0,   0,   0,   0,   0, +2.047351076405603e-08, +2.215268565676634e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -20,   0,   0,   0,   0,   0,   0, +8.951609337504373e-09, +1.363221831414170e-08 },
-} },
-{   6,   2,   3,  81, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -20,   0,   0,   0,   0,   0,   0, +8.951609337504373e-09, +1.363221831414170e-08 }
+};
+
+static constexpr VSOP2013Term _l3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +8.700988187498828e-05, -1.345927969728194e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -7.648633463942244e-06, +8.674194078046316e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +2.825795726360029e-06, -6.331495415268961e-07 },
@@ -1663,9 +1684,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -2,   0,   0,   0,   0,   0,   0, +2.715965278878324e-09, +6.852222911776808e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -10,   0,   0,   0,   0,   0,   0, -8.133844121471773e-09, -1.197578204542918e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   4,  -2,   0,   0,   0,   0, -4.739656420975033e-09, +4.491545968434180e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   3,   0,   0,   0,   0, -6.948508853725864e-09, -1.894871896261026e-09 },
-} },
-{   6,   2,   4,  44, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   3,   0,   0,   0,   0, -6.948508853725864e-09, -1.894871896261026e-09 }
+};
+
+static constexpr VSOP2013Term _l4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.226757598446507e-05, +1.148485190624113e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.537193994448864e-06, -1.820024231322189e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.542570378513483e-07 },
@@ -1709,9 +1731,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0,   0, -2.113732275110895e-09, -2.818145979213121e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -13,   0,   0,   0,   0,   0,   0, -1.228954988405877e-09, +3.579085958746831e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -20,   0,   0,   0,   0,   0,   0, -1.127436160226145e-09, -3.397297082723699e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, -3.529714272192419e-09, +8.905222818287923e-10 },
-} },
-{   6,   2,   5,  22, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, -3.529714272192419e-09, +8.905222818287923e-10 }
+};
+
+static constexpr VSOP2013Term _l5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.183695717085750e-06, +8.234433063511541e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +3.382017258382292e-07, -2.044314687921656e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -6.885674248265315e-08, -1.367789047927325e-08 },
@@ -1733,9 +1756,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,  -2,   7,   0,   0,   0,   0, -9.421656941512645e-10, -8.788688134499189e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -21,   3,   0,   0,   0,   0,   0, -1.335492422680632e-09, -4.549763412912029e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -9,   0,   0,   0,   0,   0,   0, +2.212219902773649e-11, +1.681446764862215e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   0,   0,   0,   0,   0,   0, +1.038541996154719e-09, -6.174209590818592e-10 },
-} },
-{   6,   2,   6,  10, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   0,   0,   0,   0,   0,   0, +1.038541996154719e-09, -6.174209590818592e-10 }
+};
+
+static constexpr VSOP2013Term _l6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -3.919453341383889e-08, -1.006105899836557e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +2.010142468816885e-08, +5.129417335961141e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +3.270465622582133e-09, -7.309386954603359e-09 },
@@ -1745,21 +1769,34 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -13,  -2,   7,   0,   0,   0,   0, -6.529222217425928e-10, -5.706344293317170e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +4.743268320264228e-10, -6.032947808284562e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -12,   0,   0,   0,   0,   0,   0, -6.918625487227299e-10, +1.273983177335775e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,  -2,   7,   0,   0,   0,   0, -2.767227774726099e-10, +4.923594322431881e-10 },
-} },
-{   6,   2,   7,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,  -2,   7,   0,   0,   0,   0, -2.767227774726099e-10, +4.923594322431881e-10 }
+};
+
+static constexpr VSOP2013Term _l7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +7.393529766272820e-09, -1.017889200395244e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -6.540739725048396e-09, +1.257988307398436e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, +1.121882001728464e-09, -9.317777419720913e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +5.644690283813088e-10, +4.514622111937980e-10 },
-} },
-{   6,   2,   8,   2, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +5.644690283813088e-10, +4.514622111937980e-10 }
+};
+
+static constexpr VSOP2013Term _l8[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +3.880190057349222e-12, -7.163162296197900e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.364444141465541e-11, +4.986925609509680e-10 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.364444141465541e-11, +4.986925609509680e-10 }
+};
+
+static constexpr VSOP2013Series _l[] = {
+{   6,   2,   0, 291, _l0 },
+{   6,   2,   1, 213, _l1 },
+{   6,   2,   2, 138, _l2 },
+{   6,   2,   3,  81, _l3 },
+{   6,   2,   4,  44, _l4 },
+{   6,   2,   5,  22, _l5 },
+{   6,   2,   6,  10, _l6 },
+{   6,   2,   7,   4, _l7 },
+{   6,   2,   8,   2, _l8 }
+};
 
-static vector<VSOP2013Series> _k = {
-{   6,   3,   0, 279, {
+static constexpr VSOP2013Term _k0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.959913416000000e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.416866413629940e-03, -6.365432862294004e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +6.666444240440023e-06, +1.972688473832003e-03 },
@@ -2038,9 +2075,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   2,   0,   0,   0,   0, +1.391536104633135e-08, -5.265178439260416e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   2,  -3,   0,   0,   0,   0,   0, +1.475691161865705e-08, +5.134290345286168e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0, -3.885004347002044e-08, +2.682271526078364e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -4,  -2,   0,   0,   0,   0, +2.045139091037608e-08, -4.521248898139077e-08 },
-} },
-{   6,   3,   1, 196, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -4,  -2,   0,   0,   0,   0, +2.045139091037608e-08, -4.521248898139077e-08 }
+};
+
+static constexpr VSOP2013Term _k1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.295935348421570e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.227660674397330e-04, +3.998517433434891e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, +2.336306414211702e-05, -3.074655206304296e-05 },
@@ -2236,9 +2274,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0, +1.199165686107180e-08, +1.174859186346014e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   2,   2,   0,   0,   0,   0, +5.711557873530510e-09, +1.794881175039458e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,  -2,   0,   0,   0,   0, -1.788021906112188e-08, -5.328565459892652e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,  10,  -9,   0,   0,   0,   0,   0,   0, -3.437387809049434e-09, -1.961055154306749e-08 },
-} },
-{   6,   3,   2, 123, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,  10,  -9,   0,   0,   0,   0,   0,   0, -3.437387809049434e-09, -1.961055154306749e-08 }
+};
+
+static constexpr VSOP2013Term _k2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.093287173810389e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -5.787480588432654e-05, +8.302324785071556e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +6.601849816035039e-06, +1.430920356486717e-08 },
@@ -2361,9 +2400,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, -17,   0,   0,   0,   0,   0,   0, +5.023470151175434e-09, +9.942105673356151e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   4,   0,   0,   0,   0,   0,   0, +5.148305389811505e-09, +9.720496869380947e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   3,   0,   0,   0,   0,   0, +2.710092646961588e-09, +1.184218343375339e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -14,   3,   0,   0,   0,   0,   0, +9.634406358548086e-09, -4.715018671188575e-09 },
-} },
-{   6,   3,   3,  72, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -14,   3,   0,   0,   0,   0,   0, +9.634406358548086e-09, -4.715018671188575e-09 }
+};
+
+static constexpr VSOP2013Term _k3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.296252652539246e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.383068096575640e-07, -5.456813744825627e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -2.177408129354486e-07, +1.493946649411141e-06 },
@@ -2435,9 +2475,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, -1.603954632998924e-09, -6.240373641200592e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0, +4.475086606745430e-09, +3.279241827869120e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -17,   0,   0,   0,   0,   0,   0, -1.684037405383588e-09, +5.786917304574177e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  -9,   0,   0,   0,   0,   0,   0, +5.442222974107185e-09, +1.695042569013604e-09 },
-} },
-{   6,   3,   4,  38, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  -9,   0,   0,   0,   0,   0,   0, +5.442222974107185e-09, +1.695042569013604e-09 }
+};
+
+static constexpr VSOP2013Term _k4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.297295872691882e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.835165707482967e-07, +1.331490254760813e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -2.491536524207134e-07, -7.740531731401670e-08 },
@@ -2475,9 +2516,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -2.156720041346187e-09, -2.589814818373328e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -14,   0,   0,   0,   0,   0,   0, +2.888042184278126e-09, +1.006197623908478e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -16,   0,   0,   0,   0,   0,   0, -2.633705106941756e-09, -1.170524776780888e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -8,   0,   0,   0,   0,   0,   0, -2.072309032531568e-09, -1.618677084651514e-09 },
-} },
-{   6,   3,   5,  18, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -8,   0,   0,   0,   0,   0,   0, -2.072309032531568e-09, -1.618677084651514e-09 }
+};
+
+static constexpr VSOP2013Term _k5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +1.662862235531095e-08, -3.239300352911286e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.587569506250202e-08, +2.071298946589561e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, -3.346816115765949e-09, +4.828250436163555e-09 },
@@ -2495,9 +2537,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -12,   0,   0,   0,   0,   0,   0, -5.375279060465231e-10, +9.072447326927628e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -17,   0,   0,   0,   0,   0,   0, +4.377299758354954e-10, +9.217959313389396e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -9.107458699701520e-10, +3.729811997742800e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0,   0, -4.755376710877431e-10, -7.529380863892024e-10 },
-} },
-{   6,   3,   6,   8, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0,   0, -4.755376710877431e-10, -7.529380863892024e-10 }
+};
+
+static constexpr VSOP2013Term _k6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +3.378910241361581e-09, +2.650459241432226e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -9.520441437567607e-10, -1.324287605567180e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, -7.824866090174764e-10, -7.495197018762098e-10 },
@@ -2505,19 +2548,32 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -12,   0,   0,   0,   0,   0,   0, +5.233391326186424e-10, -2.134563002616628e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, +4.868022193946386e-10, +8.521781775780292e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, -7.224664546180452e-11, +3.364898843863509e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   0,   0,   0,   0,   0,   0, -1.981235914267215e-10, -1.489736389626529e-10 },
-} },
-{   6,   3,   7,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   0,   0,   0,   0,   0,   0, -1.981235914267215e-10, -1.489736389626529e-10 }
+};
+
+static constexpr VSOP2013Term _k7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -3.397880938811679e-10, +2.850697335240891e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, -9.660898371714759e-11, -1.536447606095041e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, +1.382507391639211e-10, -1.029982963910029e-10 },
-} },
-{   6,   3,   8,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.896842700691913e-11, -3.623873468624919e-11 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, +1.382507391639211e-10, -1.029982963910029e-10 }
+};
+
+static constexpr VSOP2013Term _k8[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.896842700691913e-11, -3.623873468624919e-11 }
+};
+
+static constexpr VSOP2013Series _k[] = {
+{   6,   3,   0, 279, _k0 },
+{   6,   3,   1, 196, _k1 },
+{   6,   3,   2, 123, _k2 },
+{   6,   3,   3,  72, _k3 },
+{   6,   3,   4,  38, _k4 },
+{   6,   3,   5,  18, _k5 },
+{   6,   3,   6,   8, _k6 },
+{   6,   3,   7,   3, _k7 },
+{   6,   3,   8,   1, _k8 }
+};
 
-static vector<VSOP2013Series> _h = {
-{   6,   4,   0, 276, {
+static constexpr VSOP2013Term _h0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.542963610200000e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +6.351298603636020e-04, +1.409019853370721e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +1.968876969728439e-03, +6.603697826702186e-06 },
@@ -2793,9 +2849,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  -4,   0,   0,   0,   0,   0,   0, +3.122731729859760e-08, -3.264954163830520e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -14,   3,   0,   0,   0,   0,   0, -3.527183175034553e-08, -2.859626761355735e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   2,   2,   0,   0,   0,   0, -1.345774031422543e-08, +5.018507610916525e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -4,   0,   0,   0,   0,   0, +1.445024103101772e-08, -4.918400654374647e-08 },
-} },
-{   6,   4,   1, 197, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -4,   0,   0,   0,   0,   0, +1.445024103101772e-08, -4.918400654374647e-08 }
+};
+
+static constexpr VSOP2013Term _h1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.756078197884624e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -3.963243047779896e-04, +1.231948230505334e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, +2.790905631445607e-05, +3.227069164579987e-05 },
@@ -2992,9 +3049,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0, +2.541038020738747e-08, -1.282258484969699e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,  -6,   0,   0,   0,   0,   0,   0, -1.117733232040481e-08, -1.541474996715887e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  11, -11,   0,   0,   0,   0,   0,   0, +2.496350463492087e-08, +4.382720137656128e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,  14, -17,   0,   0,   0,   0,   0,   0, +1.508896022985328e-08, -8.634836466542829e-09 },
-} },
-{   6,   4,   2, 125, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,  14, -17,   0,   0,   0,   0,   0,   0, +1.508896022985328e-08, -8.634836466542829e-09 }
+};
+
+static constexpr VSOP2013Term _h2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.198819340389719e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -8.659886106466092e-06, -5.711382879318549e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -5.581572959088311e-08, +6.575079529213676e-06 },
@@ -3119,9 +3177,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, -17,   0,   0,   0,   0,   0,   0, -1.091837583521000e-08, +4.529902268612059e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -14,   3,   0,   0,   0,   0,   0, +4.627844440468696e-09, +9.555952002595331e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,  12, -18,   0,   0,   0,   0,   0,   0, -9.177980789989158e-10, -1.297584687300891e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -2,   0,   0,   0,   0,   0,   0, -1.281829810980397e-08, +6.280622105420764e-10 },
-} },
-{   6,   4,   3,  72, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -2,   0,   0,   0,   0,   0,   0, -1.281829810980397e-08, +6.280622105420764e-10 }
+};
+
+static constexpr VSOP2013Term _h3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.598787856566942e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +5.358037472574585e-06, +2.385713801327033e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -1.485309910330049e-06, -2.292489902289015e-07 },
@@ -3193,9 +3252,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   3,   0,   0,   0,   0,   0,   0, -4.885811334203377e-09, -2.894067496355481e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0, +1.690044595725070e-09, -6.015145686689459e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -17,   0,   0,   0,   0,   0,   0, -5.772971558300757e-09, -1.771813501557067e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   2,   0,   0,   0,   0,   0,   0, -2.021407189418031e-09, +5.261883065947796e-09 },
-} },
-{   6,   4,   4,  38, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   2,   0,   0,   0,   0,   0,   0, -2.021407189418031e-09, +5.261883065947796e-09 }
+};
+
+static constexpr VSOP2013Term _h4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.159519620749372e-07, +3.759102062803400e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +7.979907433605400e-08, -2.470574855640586e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.047043760094803e-07 },
@@ -3233,9 +3293,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   1,   4,   0,   0,   0,   0, -9.977956640138514e-10, -2.878359115785608e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -16,   0,   0,   0,   0,   0,   0, +1.216881450603113e-09, -2.619868538987580e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -10,   0,   0,   0,   0,   0,   0, -1.124464286585340e-09, -2.653901046836449e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -14,   0,   0,   0,   0,   0,   0, -8.442438325009593e-10, +2.870487913187718e-09 },
-} },
-{   6,   4,   5,  18, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   8, -14,   0,   0,   0,   0,   0,   0, -8.442438325009593e-10, +2.870487913187718e-09 }
+};
+
+static constexpr VSOP2013Term _h5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +3.198351278455784e-08, +1.702459331562391e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.058922956278390e-08, -1.372625858134769e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.276678150222069e-08 },
@@ -3253,9 +3314,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -17,   0,   0,   0,   0,   0,   0, -9.268593024259432e-10, +4.298270384819451e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0,   0, +7.767721314422412e-10, -4.243296632960958e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +5.747559781041760e-10, -4.622398000244862e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, +5.202557441029823e-10, +5.021544900523342e-10 },
-} },
-{   6,   4,   6,   8, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, +5.202557441029823e-10, +5.021544900523342e-10 }
+};
+
+static constexpr VSOP2013Term _h6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -2.703607822291357e-09, +3.311959799128951e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.115666766127050e-09, -1.011629694421522e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, +8.844349766363288e-10, -8.314015367258948e-10 },
@@ -3263,20 +3325,33 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -8.932474973184140e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -12,   0,   0,   0,   0,   0,   0, +2.081161719720881e-10, +5.313332243165037e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, -3.200149838699251e-10, -4.825047547117278e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   0,   0,   0,   0,   0,   0, +1.647709929417236e-10, -1.950909358487257e-10 },
-} },
-{   6,   4,   7,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   0,   0,   0,   0,   0,   0, +1.647709929417236e-10, -1.950909358487257e-10 }
+};
+
+static constexpr VSOP2013Term _h7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -2.755105295116311e-10, -3.453008800453344e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,   0,   0, +1.007761698247554e-10, +1.386721224859514e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +5.515241140980252e-11, +7.314946884826078e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -12,   0,   0,   0,   0,   0,   0, -6.845054854895193e-11, +1.211980650241748e-11 },
-} },
-{   6,   4,   8,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +3.696636142621768e-11, -1.769571954801971e-11 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -12,   0,   0,   0,   0,   0,   0, -6.845054854895193e-11, +1.211980650241748e-11 }
+};
 
-static vector<VSOP2013Series> _q = {
-{   6,   5,   0,  63, {
+static constexpr VSOP2013Term _h8[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, +3.696636142621768e-11, -1.769571954801971e-11 }
+};
+
+static constexpr VSOP2013Series _h[] = {
+{   6,   4,   0, 276, _h0 },
+{   6,   4,   1, 197, _h1 },
+{   6,   4,   2, 125, _h2 },
+{   6,   4,   3,  72, _h3 },
+{   6,   4,   4,  38, _h4 },
+{   6,   4,   5,  18, _h5 },
+{   6,   4,   6,   8, _h6 },
+{   6,   4,   7,   4, _h7 },
+{   6,   4,   8,   1, _h8 }
+};
+
+static constexpr VSOP2013Term _q0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -8.717455856000002e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.814718710627404e-05, -9.708882147686620e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, -4.477534826320693e-06, +5.747278616956238e-06 },
@@ -3339,9 +3414,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -1.686996740770734e-08, -3.870144536420964e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0, +3.741676603552080e-08, +1.515456577487054e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  -7,   0,   0,   0,   0,   0,   0, +3.011774835072334e-08, -1.556274689801402e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0,   0, -2.991574434189610e-08, +1.343204443237850e-08 },
-} },
-{   6,   5,   1,  39, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0,   0, -2.991574434189610e-08, +1.343204443237850e-08 }
+};
+
+static constexpr VSOP2013Term _q1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +8.016916082545978e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, -3.706572130390690e-07, -9.900490034071385e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, -5.741469098341147e-07, +6.691091804680895e-07 },
@@ -3380,9 +3456,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   0,   0, +8.665203614956438e-09, +1.237830295049345e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,   0,   0,   0,   0,   0,   0, -1.071306227058805e-08, +1.014581142617922e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, +2.753884778337629e-10, -1.761562914292185e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -1.254013324221756e-08, -4.597669440245161e-09 },
-} },
-{   6,   5,   2,  21, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -1.254013324221756e-08, -4.597669440245161e-09 }
+};
+
+static constexpr VSOP2013Term _q2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.145059115445134e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +1.232508846567990e-07, -2.089347584129820e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, +4.506794083963323e-08, -4.419315492654848e-08 },
@@ -3403,9 +3480,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0, -4.441044311369130e-09, +3.063043071351551e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +3.794790445381807e-09, +3.424535751927448e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   0,   0,   0,   0,   0,   0, +3.073090367714050e-09, -3.728200239256034e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +1.012401162215827e-09, -5.748848344535746e-09 },
-} },
-{   6,   5,   3,  10, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +1.012401162215827e-09, -5.748848344535746e-09 }
+};
+
+static constexpr VSOP2013Term _q3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.998668842836250e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.469999580827585e-09, +2.345620791418398e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, +4.813360477535852e-09, -3.656283546139705e-09 },
@@ -3415,25 +3493,37 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, -8.577497142140486e-10, +2.880214034997606e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +2.609501050194816e-09, +5.322704029616211e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, -4.220920121870531e-10, -2.504770724655617e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -4.109566023709903e-10, +2.087605634427242e-09 },
-} },
-{   6,   5,   4,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   0,   0,   0,   0,   0,   0, -4.109566023709903e-10, +2.087605634427242e-09 }
+};
+
+static constexpr VSOP2013Term _q4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -8.966162892559247e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -3.003144720336459e-09, +2.282996612627154e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, +3.732289704504161e-10, +2.292182910535462e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, +2.566734975591234e-10, +2.119338139417584e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, +3.419750434307118e-10, -1.000335283393608e-11 },
-} },
-{   6,   5,   5,   2, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, +3.419750434307118e-10, -1.000335283393608e-11 }
+};
+
+static constexpr VSOP2013Term _q5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.808006733655035e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.667688445956251e-11, -3.137094060147176e-10 },
-} },
-{   6,   5,   6,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.355903326938356e-10 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -1.667688445956251e-11, -3.137094060147176e-10 }
+};
 
-static vector<VSOP2013Series> _p = {
-{   6,   6,   0,  62, {
+static constexpr VSOP2013Term _q6[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.355903326938356e-10 }
+};
+
+static constexpr VSOP2013Series _q[] = {
+{   6,   5,   0,  63, _q0 },
+{   6,   5,   1,  39, _q1 },
+{   6,   5,   2,  21, _q2 },
+{   6,   5,   3,  10, _q3 },
+{   6,   5,   4,   5, _q4 },
+{   6,   5,   5,   2, _q5 },
+{   6,   5,   6,   1, _q6 }
+};
+
+static constexpr VSOP2013Term _p0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.989143623600000e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +8.698421468517217e-06, +1.870741111592860e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, -3.505597446448660e-06, -7.681225091167857e-06 },
@@ -3495,9 +3585,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0,   0, -3.556845370041013e-08, +2.434916284972043e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   0,   0, +4.748628246439170e-08, -6.018616759318019e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   2,   0,   0,   0,   0, -2.901807547128523e-08, +2.377801745178526e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -2.796805445716674e-08, +2.331774658131804e-08 },
-} },
-{   6,   6,   1,  39, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0, -2.796805445716674e-08, +2.331774658131804e-08 }
+};
+
+static constexpr VSOP2013Term _p1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.943892444878046e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, +5.473105793009217e-07, -7.463835018938875e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0, -6.829942190636450e-07, -5.056657567012844e-07 },
@@ -3536,9 +3627,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   0,   0, +1.297738654877926e-08, -7.752086472640596e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0,   0, -4.361187253996113e-09, +1.613854506401621e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0, +2.234916832066485e-09, -1.721888272773792e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +6.718752933346931e-09, -1.271794585107964e-08 },
-} },
-{   6,   6,   2,  21, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +6.718752933346931e-09, -1.271794585107964e-08 }
+};
+
+static constexpr VSOP2013Term _p2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.236775180658310e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +4.730474534202460e-08, +1.176283746951345e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, +3.455171894660531e-08, +6.518647595082114e-08 },
@@ -3559,9 +3651,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   0,   0,   0,   0,   0,   0, -1.703322948854231e-09, +5.338450305905012e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -2.134803847455246e-09, +4.406472909792488e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0, -1.672881256292104e-09, -4.770397015050404e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +5.445977202881709e-09, +6.485064026814484e-10 },
-} },
-{   6,   6,   3,  11, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, +5.445977202881709e-09, +6.485064026814484e-10 }
+};
+
+static constexpr VSOP2013Term _p3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.298999051458208e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.476898499590618e-08, +1.727973392969146e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -4.556135761726662e-09, +5.751109467678630e-09 },
@@ -3572,47 +3665,68 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0, -1.313093479070566e-09, +1.945551177737936e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -1.792524293887745e-10, -2.885569626762725e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0, -1.204279105965567e-09, +1.759332801229227e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, +2.562576856085155e-09, -3.639045269223891e-10 },
-} },
-{   6,   6,   4,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, +2.562576856085155e-09, -3.639045269223891e-10 }
+};
+
+static constexpr VSOP2013Term _p4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +8.631079290668904e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +5.200686744603414e-10, -3.297628421176238e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, -2.478616521817168e-10, -6.586720872777839e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, -9.716888951640960e-11, +2.724617575163149e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, +3.299908779612750e-12, +3.496119235724685e-10 },
-} },
-{   6,   6,   5,   2, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0, +3.299908779612750e-12, +3.496119235724685e-10 }
+};
+
+static constexpr VSOP2013Term _p5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.572023319667706e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.425065801531501e-10, +1.441979994194924e-10 },
-} },
-{   6,   6,   6,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.723996491617339e-11 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +3.425065801531501e-10, +1.441979994194924e-10 }
+};
+
+static constexpr VSOP2013Term _p6[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -9.723996491617339e-11 }
+};
+
+static constexpr VSOP2013Series _p[] = {
+{   6,   6,   0,  62, _p0 },
+{   6,   6,   1,  39, _p1 },
+{   6,   6,   2,  21, _p2 },
+{   6,   6,   3,  11, _p3 },
+{   6,   6,   4,   5, _p4 },
+{   6,   6,   5,   2, _p5 },
+{   6,   6,   6,   1, _p6 }
+};
+
+vector<VSOP2013PackedSeries> VSOP2013::saturnPackedSeries ( void )
+{
+    return packSeries ( { _a, _l, _k, _h, _q, _p } );
+}
 
 SSOrbit VSOP2013::saturnOrbit ( double jed )
 {
+    if ( usePackedSeries() )
+        return getOrbit ( 6, jed, getPackedSeries ( 6 ) );
+    
     double a = 0.0, l = 0.0, k = 0.0, h = 0.0, q = 0.0, p = 0.0;
     double t = ( jed - 2451545.0 ) / 365250.0;
     double ll[17] = { 0 };
     
     evalLongitudes ( t, ll );
 
-    for ( VSOP2013Series &series : _a )
+    for ( const VSOP2013Series &series : _a )
         a += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _l )
+    for ( const VSOP2013Series &series : _l )
         l += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _k )
+    for ( const VSOP2013Series &series : _k )
         k += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _h )
+    for ( const VSOP2013Series &series : _h )
         h += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _q )
+    for ( const VSOP2013Series &series : _q )
         q += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _p )
+    for ( const VSOP2013Series &series : _p )
         p += evalSeries ( t, series, ll );
 
     double e = sqrt ( k * k + h * h );  // eccentricity
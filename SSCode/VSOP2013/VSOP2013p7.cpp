@@ -1,8 +1,7 @@
 #include "VSOP2013.hpp"
 #if VSOP2013_EMBED_SERIES
 
-static vector<VSOP2013Series> _a = {
-{   7,   1,   0, 327, {
+static constexpr VSOP2013Term _a0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.921843855547400e+01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0,   0, +2.278569703780060e-06, +8.030525688697848e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0, -7.304916090376658e-06, +2.068731026327745e-02 },
@@ -329,9 +328,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  10, -12,   0,   0,   0,   0, -3.711411586349027e-07, +1.352669049730336e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   1,  -7,   0,   0,   0,   0,   0, -7.798349830656461e-07, +8.961685275444915e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  13, -14,   0,   0,   0,   0, -2.174810414433381e-07, +1.451535310048385e-06 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   2,  -6,   0,   0,   0,   0, -2.962141161791725e-07, +1.371077989763223e-06 },
-} },
-{   7,   1,   1, 230, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   2,  -6,   0,   0,   0,   0, -2.962141161791725e-07, +1.371077989763223e-06 }
+};
+
+static constexpr VSOP2013Term _a1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +1.593158937303201e-04, -1.015381615448104e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0,   0, +1.636126179807707e-04, +8.488387144682473e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -1,   0,   0,   0,   0,   0, -7.066598207230603e-05, -9.893318859039495e-05 },
@@ -561,9 +561,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -4,   0,   0,   0,   0,   0, +2.468206685770198e-07, -6.978843660426205e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -10,   0,   0,   0,   0,   0, +2.510276205953190e-07, -6.359774248393980e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   5,  -3,   0,   0,   0,   0,   0, -2.450895744554823e-07, +6.772820266702328e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -4,   0,   0,   0,   0,   0, -1.142221853411548e-07, +1.979493387378156e-07 },
-} },
-{   7,   1,   2, 136, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -4,   0,   0,   0,   0,   0, -1.142221853411548e-07, +1.979493387378156e-07 }
+};
+
+static constexpr VSOP2013Term _a2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -1,   0,   0,   0,   0,   0, -7.795760256474532e-06, +1.727521796680265e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   1,   0,   0,   0,   0,   0, +7.692763888067547e-06, -1.734846921001273e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0,   0, +8.440298465109056e-06, -8.515702486696484e-06 },
@@ -699,9 +700,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -2,   2,   0,   0,   0,   0, -4.121363727179264e-08, +7.393528691285131e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -8,   0,   0,   0,   0,   0, -4.986485894659414e-08, +6.356611966120793e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   2,   0,   0,   0,   0, -3.999970375307181e-08, +7.195293537155390e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0, -9.362528250710004e-08, -1.590411425379861e-08 },
-} },
-{   7,   1,   3,  73, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0, -9.362528250710004e-08, -1.590411425379861e-08 }
+};
+
+static constexpr VSOP2013Term _a3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -1,   0,   0,   0,   0,   0, -2.187517675468639e-06, -1.433158579047726e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   1,   0,   0,   0,   0,   0, +2.203261901357430e-06, +1.406798621909229e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   1,   0,   0,   0,   0,   0, -1.403511319056106e-06, -9.259086363207511e-07 },
@@ -774,9 +776,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -2,   0,   0,   0,   0, -1.815441586707962e-08, -1.119956874773958e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, -11,   6,   0,   0,   0,   0,   0, +2.023727989561426e-08, +8.499966744785215e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -6,   0,   0,   0,   0,   0, +1.821269338344644e-09, +2.636627493003790e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0, -7.657803103065280e-09, +2.010615543513856e-08 },
-} },
-{   7,   1,   4,  37, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0, -7.657803103065280e-09, +2.010615543513856e-08 }
+};
+
+static constexpr VSOP2013Term _a4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -1,   0,   0,   0,   0,   0, +1.898620003654737e-07, -1.985604758936937e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   1,   0,   0,   0,   0,   0, -1.850639858763802e-07, +2.015619237853948e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   1,   0,   0,   0,   0,   0, +1.237655848049858e-07, -1.267434488437905e-07 },
@@ -813,9 +816,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -2,  -4,   0,   0,   0,   0,   0, -7.980487890349255e-09, -2.448137995614125e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -1,  -4,   0,   0,   0,   0,   0, +4.030622322200917e-09, -5.848456698848544e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -10,  -1,   0,   0,   0,   0,   0, +4.452246868505280e-09, +5.398866344310943e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0, +6.711990480996522e-09, +3.035444616464885e-09 },
-} },
-{   7,   1,   5,  16, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0, +6.711990480996522e-09, +3.035444616464885e-09 }
+};
+
+static constexpr VSOP2013Term _a5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -1,   0,   0,   0,   0,   0, +1.320934053319505e-08, +1.963221893176033e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   1,   0,   0,   0,   0,   0, -1.366468867997567e-08, -1.901250663384689e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   1,   0,   0,   0,   0,   0, +8.316842902679695e-09, +1.288754214483752e-08 },
@@ -831,27 +835,41 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,  -1,   0,   0,   0,   0,   0, +1.277041722777884e-09, +2.105974652185936e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -3,   0,   0,   0,   0,   0, +2.395926025886096e-09, +8.898963960642916e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -2,   0,   0,   0,   0,   0, +1.225166795022032e-09, +1.316930391351722e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0,   0, -2.314858545005135e-09, -7.199609290452797e-12 },
-} },
-{   7,   1,   6,   7, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0,   0, -2.314858545005135e-09, -7.199609290452797e-12 }
+};
+
+static constexpr VSOP2013Term _a6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -1,   0,   0,   0,   0,   0, -1.672978922196557e-09, +6.131981825033655e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   1,   0,   0,   0,   0,   0, +1.611075069657847e-09, -6.675370509813921e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   1,   0,   0,   0,   0,   0, -1.103853935963635e-09, +3.703610506962856e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, +9.742298156442734e-10, -4.479472974301449e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,  -1,   0,   0,   0,   0,   0, +9.692971350682485e-10, -3.724611265364006e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   1,   0,   0,   0,   0,   0, +7.532882709164785e-10, -2.897299570384465e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -10,   1,   0,   0,   0,   0,   0, -7.036630459523058e-10, +2.816870591903474e-10 },
-} },
-{   7,   1,   7,   2, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -10,   1,   0,   0,   0,   0,   0, -7.036630459523058e-10, +2.816870591903474e-10 }
+};
+
+static constexpr VSOP2013Term _a7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,  -1,   0,   0,   0,   0,   0, +2.270437548487321e-11, +1.236473698133547e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   1,   0,   0,   0,   0,   0, +1.904482500941278e-11, +1.180388920081109e-10 },
-} },
-{   7,   1,   8,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,  -1,   0,   0,   0,   0,   0, -1.351267083206541e-11, -2.450571497424874e-13 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   1,   0,   0,   0,   0,   0, +1.904482500941278e-11, +1.180388920081109e-10 }
+};
 
-static vector<VSOP2013Series> _l = {
-{   7,   2,   0, 289, {
+static constexpr VSOP2013Term _a8[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,  -1,   0,   0,   0,   0,   0, -1.351267083206541e-11, -2.450571497424874e-13 }
+};
+
+static constexpr VSOP2013Series _a[] = {
+{   7,   1,   0, 327, _a0 },
+{   7,   1,   1, 230, _a1 },
+{   7,   1,   2, 136, _a2 },
+{   7,   1,   3,  73, _a3 },
+{   7,   1,   4,  37, _a4 },
+{   7,   1,   5,  16, _a5 },
+{   7,   1,   6,   7, _a6 },
+{   7,   1,   7,   2, _a7 },
+{   7,   1,   8,   1, _a8 }
+};
+
+static constexpr VSOP2013Term _l0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.481225395662999e+00 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0, -1.494499507304893e-02, +8.348444735902004e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0,   0, +3.410476217551242e-03, -1.910577101277037e-07 },
@@ -1140,9 +1158,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0, +1.283986989471830e-07, -2.399385986100398e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -6,   0,   0,   0,   0,   0, -6.239724964161383e-08, -8.899919758034271e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,  -6,   0,   0,   0,   0,   0, +1.426132788751504e-07, -7.865197221557926e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, -10,   6,   0,   0,   0,   0,   0, -1.395584170284734e-07, -1.074312965908174e-08 },
-} },
-{   7,   2,   1, 194, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, -10,   6,   0,   0,   0,   0,   0, -1.395584170284734e-07, -1.074312965908174e-08 }
+};
+
+static constexpr VSOP2013Term _l1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.478165903077800e+01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0, +6.752982629002030e-05, -2.347386427729234e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -4.756200485466317e-05, -7.563524617772785e-05 },
@@ -1336,9 +1355,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   2,  -2,   0,   0,   0,   0, -7.207948205773394e-09, +2.993681370517842e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -2,   2,   0,   0,   0,   0, -1.039889446806073e-08, +2.654926723465724e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -2,   0,   0,   0,   0, +7.119390312384643e-09, -2.910452289994682e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, -11,   7,   0,   0,   0,   0,   0, +4.126955042856764e-09, -3.171798184578088e-08 },
-} },
-{   7,   2,   2, 119, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, -11,   7,   0,   0,   0,   0,   0, +4.126955042856764e-09, -3.171798184578088e-08 }
+};
+
+static constexpr VSOP2013Term _l2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -8.517442742610338e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +7.423202172221361e-06, +4.045698731961527e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, -3.510853457362750e-06, -4.303336955284712e-06 },
@@ -1457,9 +1477,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   5,   0,   0,   0,   0,   0, -8.392901410663822e-09, -3.756019767313860e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -12,   2,   0,   0,   0,   0,   0, +7.436306313188542e-09, +4.703844489037779e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   2,   0,   0,   0,   0, +9.165901790633206e-09, +2.899137141300437e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0, +1.124564689649336e-08, +4.524714963508010e-10 },
-} },
-{   7,   2,   3,  66, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0, +1.124564689649336e-08, +4.524714963508010e-10 }
+};
+
+static constexpr VSOP2013Term _l3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, +4.813832380403231e-07, -2.403737096897720e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -2.907146534935541e-07, +4.139337875934267e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -6.144870763016476e-07, +8.136310837323478e-08 },
@@ -1525,9 +1546,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -9,   5,   0,   0,   0,   0,   0, -1.436951451116717e-09, +2.175918137207235e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -14,   3,   3,   0,   0,   0,   0, +2.294323288209954e-09, +1.201751130893348e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   4,   0,   0,   0,   0,   0, +1.709289872555271e-09, -1.696114874628192e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -12,   2,   0,   0,   0,   0,   0, -1.565927099295804e-09, +1.828432717780784e-09 },
-} },
-{   7,   2,   4,  35, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -12,   2,   0,   0,   0,   0,   0, -1.565927099295804e-09, +1.828432717780784e-09 }
+};
+
+static constexpr VSOP2013Term _l4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.879329676374498e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +7.176043278881807e-09, -1.071554581681031e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, +1.002595666358660e-08, +3.972840042189730e-08 },
@@ -1562,9 +1584,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0, +1.075038677569706e-09, -3.401012245978083e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   2,   0,   0,   0,   0, -1.716889404798963e-10, +1.215423845878484e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -1,   5,   0,   0,   0,   0, +6.161634404690305e-10, +6.138997706202168e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   1,   4,   0,   0,   0,   0, +2.219714669599342e-10, -9.471819964718036e-10 },
-} },
-{   7,   2,   5,  16, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   1,   4,   0,   0,   0,   0, +2.219714669599342e-10, -9.471819964718036e-10 }
+};
+
+static constexpr VSOP2013Term _l5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +1.422378123862454e-08, +3.833781538204223e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.340133323569073e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, -2.799097922776825e-09, -8.781175914600114e-11 },
@@ -1580,22 +1603,34 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, -4.281364408584555e-10, +3.276116587998210e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -2,   0,   0,   0,   0,   0, +2.195318587624086e-10, +4.573762622134881e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,  -1,   0,   0,   0,   0,   0, -2.699718340871662e-10, +1.613514588801976e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -16,   3,   0,   0,   0,   0,   0, -2.388636867494051e-10, -1.096261614602226e-10 },
-} },
-{   7,   2,   6,   6, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -16,   3,   0,   0,   0,   0,   0, -2.388636867494051e-10, -1.096261614602226e-10 }
+};
+
+static constexpr VSOP2013Term _l6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.962329375791907e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -17,   6,   0,   0,   0,   0,   0, +1.556838445864250e-09, -1.831955396370270e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -17,   7,  -2,   0,   0,   0,   0, -2.778559693391210e-09, +3.167466161221531e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -6.872901445626240e-10, +1.431988171912069e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, +2.648209600104493e-11, -1.440189706125948e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -8.568185612876264e-12, +1.000730133454375e-10 },
-} },
-{   7,   2,   7,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.516702369736084e-09 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -8.568185612876264e-12, +1.000730133454375e-10 }
+};
+
+static constexpr VSOP2013Term _l7[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.516702369736084e-09 }
+};
 
-static vector<VSOP2013Series> _k = {
-{   7,   3,   0, 296, {
+static constexpr VSOP2013Series _l[] = {
+{   7,   2,   0, 289, _l0 },
+{   7,   2,   1, 194, _l1 },
+{   7,   2,   2, 119, _l2 },
+{   7,   2,   3,  66, _l3 },
+{   7,   2,   4,  35, _l4 },
+{   7,   2,   5,  16, _l5 },
+{   7,   2,   6,   6, _l6 },
+{   7,   2,   7,   1, _l7 }
+};
+
+static constexpr VSOP2013Term _k0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.595307483800001e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -1.727930941617936e-07, +2.745343620327603e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0, +3.657353136054777e-06, -2.085621323646657e-03 },
@@ -1891,9 +1926,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0,   0, -1.115625458353717e-07, +4.409594973301759e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -3,  -2,   0,   0,   0,   0, +6.029247059454445e-08, +9.492188353084032e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   1,   0,   0,   0,   0,   0, +8.213719160913145e-09, +1.462615732906222e-07 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   2,   0,   0,   0,   0,   0, +1.501597175268378e-07, -2.909943122127777e-09 },
-} },
-{   7,   3,   1, 191, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   2,   0,   0,   0,   0,   0, +1.501597175268378e-07, -2.909943122127777e-09 }
+};
+
+static constexpr VSOP2013Term _k1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.833262663241947e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -1.568326362224334e-05, +2.527517340896218e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +5.955119449203349e-06, +3.088037593465037e-06 },
@@ -2084,9 +2120,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -4,   0,   0,   0,   0, -2.427497699395134e-08, -7.912009337565592e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   2,   0,   0,   0,   0,   0, -1.613169372137127e-08, -1.586628553384180e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  -8,   0,   0,   0,   0,   0, -1.001402627328932e-08, -2.193750168476885e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -1,   0,   0,   0,   0,   0, +1.988958442125794e-08, +1.201614939407286e-08 },
-} },
-{   7,   3,   2, 115, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -1,   0,   0,   0,   0,   0, +1.988958442125794e-08, +1.201614939407286e-08 }
+};
+
+static constexpr VSOP2013Term _k2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -1.492869145306024e-06, -1.350767063048637e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, +6.156142682513892e-07, -3.694716235443472e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +2.633222214096637e-07, -5.939980199984353e-07 },
@@ -2201,9 +2238,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   0,   0,   0, +3.133465799167996e-09, -6.306099914373016e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0, +4.844244015842895e-09, +4.390321470745130e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   0, +7.828538498566592e-09, +1.374887644456125e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   6,   0,   0,   0,   0,   0, +2.862453538190158e-09, -6.167121733713825e-09 },
-} },
-{   7,   3,   3,  63, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   6,   0,   0,   0,   0,   0, +2.862453538190158e-09, -6.167121733713825e-09 }
+};
+
+static constexpr VSOP2013Term _k3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.500504087006896e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +6.345068098563264e-08, -6.775771316941115e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -7.468505943343645e-08, -4.899856139704518e-08 },
@@ -2266,9 +2304,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -2,   0,   0,   0,   0,   0, +9.142949294190902e-10, -2.062044964010914e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -2,   0,   0,   0,   0,   0, +4.631501354749988e-10, -2.289985625927910e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   0,   0,   0,   0,   0,   0, +9.231102331322441e-10, +1.734797275503914e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   1,   0,   0,   0,   0,   0, +1.863458619905717e-09, +7.655762270878609e-10 },
-} },
-{   7,   3,   4,  32, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   1,   0,   0,   0,   0,   0, +1.863458619905717e-09, +7.655762270878609e-10 }
+};
+
+static constexpr VSOP2013Term _k4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.658221643608844e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +6.490757763300872e-09, -6.776008908847751e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -6.331484032839243e-09, +6.901217982528634e-09 },
@@ -2300,9 +2339,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   4,   0,   0,   0,   0,   0, +4.569531467808660e-10, -3.301005326650172e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -4.848139619941375e-11, -7.356604644127358e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   2,   0,   0,   0,   0,   0, -4.591960944148837e-10, +3.241717685643074e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -5,   0,   0,   0,   0,   0, +1.271276600265680e-10, +6.138750728486599e-10 },
-} },
-{   7,   3,   5,  14, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -5,   0,   0,   0,   0,   0, +1.271276600265680e-10, +6.138750728486599e-10 }
+};
+
+static constexpr VSOP2013Term _k5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +3.697980261783923e-10, -9.659742809318088e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +4.503282558951307e-10, +6.711298854949596e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -4.679618832621272e-10, -6.503345541078072e-10 },
@@ -2316,21 +2356,33 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   2,   0,   0,   0,   0,   0, +1.208888518559434e-10, +1.841756938773722e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -2,   0,   0,   0,   0,   0, -1.134530538521469e-10, -1.541858405833060e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -10,   0,   0,   0,   0,   0,   0, +9.748047630155452e-11, +1.589325880748061e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   0,   0,   0,   0,   0,   0, -8.898544595112582e-11, -1.480959143041787e-10 },
-} },
-{   7,   3,   6,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   0,   0,   0,   0,   0,   0, -8.898544595112582e-11, -1.480959143041787e-10 }
+};
+
+static constexpr VSOP2013Term _k6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +9.925728272235316e-11, +5.911450253103409e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +5.513882912214014e-11, -2.288644342664990e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -5.717916067009759e-11, +2.083349933704619e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -3,   0,   0,   0,   0,   0, -9.958807340818316e-12, -3.713819816189564e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, +3.308186427386736e-11, -1.267488920760769e-11 },
-} },
-{   7,   3,   7,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -6.268851190616454e-12, +6.516334444809149e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, +3.308186427386736e-11, -1.267488920760769e-11 }
+};
+
+static constexpr VSOP2013Term _k7[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -6.268851190616454e-12, +6.516334444809149e-12 }
+};
+
+static constexpr VSOP2013Series _k[] = {
+{   7,   3,   0, 296, _k0 },
+{   7,   3,   1, 191, _k1 },
+{   7,   3,   2, 115, _k2 },
+{   7,   3,   3,  63, _k3 },
+{   7,   3,   4,  32, _k4 },
+{   7,   3,   5,  14, _k5 },
+{   7,   3,   6,   5, _k6 },
+{   7,   3,   7,   1, _k7 }
+};
 
-static vector<VSOP2013Series> _h = {
-{   7,   4,   0, 297, {
+static constexpr VSOP2013Term _h0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.648340159000001e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +2.746777656405986e-03, -4.041161998774458e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0, +2.093557029624033e-03, +5.554793824391823e-06 },
@@ -2627,9 +2679,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -6,   6,   0,   0,   0,   0, +8.965703857251153e-08, +6.917065499833140e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   0,   0, +1.381409976968747e-08, +1.446792401410018e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   1,   0,   0,   0,   0,   0, +1.328843696586609e-07, +2.285734231363154e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -3,  -2,   0,   0,   0,   0, -9.519456634595634e-08, +6.021802419861755e-08 },
-} },
-{   7,   4,   1, 192, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -3,  -2,   0,   0,   0,   0, -9.519456634595634e-08, +6.021802419861755e-08 }
+};
+
+static constexpr VSOP2013Term _h1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -7.487546096252627e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -2.547526487703378e-05, -1.543060675385435e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +3.088975038293310e-06, -5.962676105576002e-06 },
@@ -2821,9 +2874,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -4,   0,   0,   0,   0,   0, -3.384104688286186e-09, +2.818886069335713e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   6,  -6,   0,   0,   0,   0, +2.111759806239365e-08, -1.036678276631361e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   2,   0,   0,   0,   0, +2.265820319043147e-08, -8.251401980588695e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -6,   0,   0,   0,   0,   0, -1.710969588835096e-08, -1.356874742149113e-08 },
-} },
-{   7,   4,   2, 116, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -6,   0,   0,   0,   0,   0, -1.710969588835096e-08, -1.356874742149113e-08 }
+};
+
+static constexpr VSOP2013Term _h2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.210067446595088e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +1.344454725171758e-06, -1.537464915905670e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, -3.636680270335541e-07, -6.128656657894139e-07 },
@@ -2939,9 +2993,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   1,   0,   0,   0,   0,   0, -8.524229770812457e-09, +5.021758266608156e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -8,   6,   0,   0,   0,   0,   0, -6.102210969419006e-09, -2.843781147864951e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   3,   0,   0,   0,   0,   0, +2.791143023072063e-09, +6.119157080237567e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,  -5,   0,   0,   0,   0,   0, +8.802365532010711e-09, -2.629875873513082e-11 },
-} },
-{   7,   4,   3,  64, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,  -5,   0,   0,   0,   0,   0, +8.802365532010711e-09, -2.629875873513082e-11 }
+};
+
+static constexpr VSOP2013Term _h3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.222882836573553e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +7.199867721623716e-08, +6.543627489076868e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -4.818355540381266e-08, +7.551743005458274e-08 },
@@ -3005,9 +3060,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0, -9.879023702612353e-10, +2.052006726577034e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   4,  -2,   0,   0,   0,   0, -2.224775706548151e-09, +5.987738952574971e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -2,   0,   0,   0,   0,   0, +2.335060940014243e-09, +4.423856492973005e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, -6.652167171906317e-10, +2.059212454331608e-09 },
-} },
-{   7,   4,   4,  32, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, -6.652167171906317e-10, +2.059212454331608e-09 }
+};
+
+static constexpr VSOP2013Term _h4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -6.778857665641640e-09, -6.485798273872608e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -6.912541186906960e-09, -6.336713874530750e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.202707294747443e-08 },
@@ -3039,9 +3095,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +4.746536481506139e-10, +4.234437968965773e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0, -7.356956757185387e-10, +4.870931857404476e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   4,   0,   0,   0,   0,   0, -3.289507655427461e-10, -4.539702872551017e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -5,   0,   0,   0,   0,   0, -6.187748797190600e-10, +1.339631459832708e-10 },
-} },
-{   7,   4,   5,  14, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,  -5,   0,   0,   0,   0,   0, -6.187748797190600e-10, +1.339631459832708e-10 }
+};
+
+static constexpr VSOP2013Term _h5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, -9.642270500227791e-10, -3.728259133426597e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +6.708446525601873e-10, -4.506577985642928e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +6.508989752201434e-10, -4.692189034083600e-10 },
@@ -3055,21 +3112,33 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -2.175984047582659e-10, +1.302684760998212e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, -1.645798234505959e-10, +1.607588661777441e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   2,   0,   0,   0,   0,   0, +1.808867311872391e-10, -1.209864661340742e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -10,   0,   0,   0,   0,   0,   0, -1.590863195047013e-10, +9.758755541199899e-11 },
-} },
-{   7,   4,   6,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -10,   0,   0,   0,   0,   0,   0, -1.590863195047013e-10, +9.758755541199899e-11 }
+};
+
+static constexpr VSOP2013Term _h6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +5.918442884183786e-11, -1.003814325796348e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +2.300953804236363e-11, +5.519411832014151e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +2.085632337855578e-11, +5.716400503376647e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -3,   0,   0,   0,   0,   0, +3.767668052130912e-11, -1.049968993720431e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -1.265571201589392e-11, -3.296100540783204e-11 },
-} },
-{   7,   4,   7,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +6.781174017127959e-12, +5.851259805875763e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -1.265571201589392e-11, -3.296100540783204e-11 }
+};
 
-static vector<VSOP2013Series> _q = {
-{   7,   5,   0,  70, {
+static constexpr VSOP2013Term _h7[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +6.781174017127959e-12, +5.851259805875763e-12 }
+};
+
+static constexpr VSOP2013Series _h[] = {
+{   7,   4,   0, 297, _h0 },
+{   7,   4,   1, 192, _h1 },
+{   7,   4,   2, 116, _h2 },
+{   7,   4,   3,  64, _h3 },
+{   7,   4,   4,  32, _h4 },
+{   7,   4,   5,  14, _h5 },
+{   7,   4,   6,   5, _h6 },
+{   7,   4,   7,   1, _h7 }
+};
+
+static constexpr VSOP2013Term _q0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.859240754000000e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +5.181127895019563e-06, +4.154845776298198e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0,   0, +4.869842069740833e-06, -4.094760012508618e-06 },
@@ -3139,9 +3208,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0, -4.265307011020006e-08, -1.223100309995605e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   2,   0,   0,   0,   0, +2.974409931095747e-08, -2.418842460656831e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   2,  -2,   0,   0,   0,   0, -2.797030803554482e-08, +2.494993619422053e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -6,   0,   0,   0,   0,   0, -2.886706850016794e-08, -2.306073142244902e-08 },
-} },
-{   7,   5,   1,  40, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -6,   0,   0,   0,   0,   0, -2.886706850016794e-08, -2.306073142244902e-08 }
+};
+
+static constexpr VSOP2013Term _q1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.244781987771900e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +1.569839807918471e-07, -3.870977093093969e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0, +1.571416731245886e-07, +2.503988062599988e-07 },
@@ -3181,9 +3251,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0, +2.025767778684395e-09, +7.719029871634088e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   0, -2.510191679528217e-09, -6.594091852837616e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -1,   0,   0,   0,   0,   0, -2.467446047435151e-09, -6.088041275390948e-09 },
-{   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0, +1.474626493016664e-09, -6.803862472352956e-09 },
-} },
-{   7,   5,   2,  21, {
+{   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0, +1.474626493016664e-09, -6.803862472352956e-09 }
+};
+
+static constexpr VSOP2013Term _q2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.075139302624414e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0,   0, +1.780035324994154e-08, -1.596351623082121e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -1.482805222469484e-08, -1.566036259998393e-08 },
@@ -3204,9 +3275,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   1,   0,   0,   0,   0,   0, -4.209983418922485e-10, -1.649226358513022e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0, -1.161852352831668e-09, -7.293777475901486e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   1,   0,   0,   0,   0,   0, -1.415484146315789e-09, +4.137465742156160e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0,   0, -8.281742386410389e-10, -9.278129979882300e-10 },
-} },
-{   7,   5,   3,   9, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0,   0, -8.281742386410389e-10, -9.278129979882300e-10 }
+};
+
+static constexpr VSOP2013Term _q3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.893125035225320e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +1.892689741064820e-10, +1.719222169231903e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, -2.223619466069990e-11, -1.864739498207679e-09 },
@@ -3215,19 +3287,29 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   1,   0,   0,   0,   0,   0, +3.345247522998696e-10, +5.786111262608893e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0, +8.414581086040455e-10, -1.489410825284014e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0, +7.602429725170186e-10, +1.334942120421920e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, -1.189010402781238e-10, -5.031735310787760e-10 },
-} },
-{   7,   5,   4,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, -1.189010402781238e-10, -5.031735310787760e-10 }
+};
+
+static constexpr VSOP2013Term _q4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.627953619361115e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, +2.284336599925492e-10, +2.865078923914909e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +4.613250062007175e-11, +2.899761621214533e-11 },
-} },
-{   7,   5,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.547224927862907e-11 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   3,   0,   0,   0,   0,   0, +4.613250062007175e-11, +2.899761621214533e-11 }
+};
 
-static vector<VSOP2013Series> _p = {
-{   7,   6,   0,  69, {
+static constexpr VSOP2013Term _q5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.547224927862907e-11 }
+};
+
+static constexpr VSOP2013Series _q[] = {
+{   7,   5,   0,  70, _q0 },
+{   7,   5,   1,  40, _q1 },
+{   7,   5,   2,  21, _q2 },
+{   7,   5,   3,   9, _q3 },
+{   7,   5,   4,   3, _q4 },
+{   7,   5,   5,   1, _q5 }
+};
+
+static constexpr VSOP2013Term _p0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.486018467000000e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -3.818452538092568e-06, +5.329154735289679e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0,   0, +4.064826492314716e-06, +4.903604845103438e-06 },
@@ -3296,9 +3378,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   2,   0,   0,   0,   0, -2.418288698599681e-08, -2.972731778376170e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   2,  -2,   0,   0,   0,   0, +2.508376115029831e-08, +2.814497193797731e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0, +3.511275541073648e-08, -1.744548334540996e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0, +3.634198809051573e-08, +1.519763668961150e-08 },
-} },
-{   7,   6,   1,  41, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0, +3.634198809051573e-08, +1.519763668961150e-08 }
+};
+
+static constexpr VSOP2013Term _p1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.173702283669166e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +3.362671694420918e-07, +1.235055604850218e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0, -1.865197335966005e-07, +1.875663086664466e-07 },
@@ -3339,9 +3422,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, +2.974189273432013e-10, +9.697705741856921e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0, +7.565565266666752e-09, -1.694933450775895e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0, -3.527699441088731e-09, +5.065872644862114e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -1,   0,   0,   0,   0,   0, +6.119928149868032e-09, -2.421805613784942e-09 },
-} },
-{   7,   6,   2,  21, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -1,   0,   0,   0,   0,   0, +6.119928149868032e-09, -2.421805613784942e-09 }
+};
+
+static constexpr VSOP2013Term _p2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.178942780364286e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, +1.856088251983599e-08, -1.522622520070660e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0,   0, +1.585076180232442e-08, +1.791611981027195e-08 },
@@ -3362,9 +3446,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0, +6.321108662595059e-10, -1.364504947529681e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0, -1.191956926445300e-09, +6.685538303173843e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   1,   0,   0,   0,   0,   0, +4.228779597966599e-10, +1.383209273964754e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0,   0, +9.152228319437153e-10, -8.554424802578657e-10 },
-} },
-{   7,   6,   3,   9, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0,   0, +9.152228319437153e-10, -8.554424802578657e-10 }
+};
+
+static constexpr VSOP2013Term _p3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.156892334832169e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -1.719275337957951e-09, +4.636453265717187e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, -1.564559121509953e-09, +1.229554249355395e-10 },
@@ -3373,41 +3458,60 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0, +1.196854684306686e-10, +8.266706517808971e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   1,   0,   0,   0,   0,   0, +5.787252540222507e-10, -3.345917141790414e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0, +2.647548905398693e-10, -4.347921242816525e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, +5.073102638952413e-10, -5.221232249270951e-11 },
-} },
-{   7,   6,   4,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, +5.073102638952413e-10, -5.221232249270951e-11 }
+};
+
+static constexpr VSOP2013Term _p4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.989770146087177e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, +1.507499428234693e-11, -2.007411303756873e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -1.560802836130365e-11, -5.625197086472097e-11 },
-} },
-{   7,   6,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, +2.000851965515212e-11, +4.381562697994548e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0, -1.560802836130365e-11, -5.625197086472097e-11 }
+};
+
+static constexpr VSOP2013Term _p5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,   0,   0,   0,   0, +2.000851965515212e-11, +4.381562697994548e-12 }
+};
+
+static constexpr VSOP2013Series _p[] = {
+{   7,   6,   0,  69, _p0 },
+{   7,   6,   1,  41, _p1 },
+{   7,   6,   2,  21, _p2 },
+{   7,   6,   3,   9, _p3 },
+{   7,   6,   4,   3, _p4 },
+{   7,   6,   5,   1, _p5 }
+};
+
+vector<VSOP2013PackedSeries> VSOP2013::uranusPackedSeries ( void )
+{
+    return packSeries ( { _a, _l, _k, _h, _q, _p } );
+}
 
 SSOrbit VSOP2013::uranusOrbit ( double jed )
 {
+    if ( usePackedSeries() )
+        return getOrbit ( 7, jed, getPackedSeries ( 7 ) );
+    
     double a = 0.0, l = 0.0, k = 0.0, h = 0.0, q = 0.0, p = 0.0;
     double t = ( jed - 2451545.0 ) / 365250.0;
     double ll[17] = { 0 };
     
     evalLongitudes ( t, ll );
 
-    for ( VSOP2013Series &series : _a )
+    for ( const VSOP2013Series &series : _a )
         a += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _l )
+    for ( const VSOP2013Series &series : _l )
         l += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _k )
+    for ( const VSOP2013Series &series : _k )
         k += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _h )
+    for ( const VSOP2013Series &series : _h )
         h += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _q )
+    for ( const VSOP2013Series &series : _q )
         q += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _p )
+    for ( const VSOP2013Series &series : _p )
         p += evalSeries ( t, series, ll );
 
     double e = sqrt ( k * k + h * h );  // eccentricity
@@ -1,8 +1,7 @@
 #include "VSOP2013.hpp"
 #if VSOP2013_EMBED_SERIES
 
-static vector<VSOP2013Series> _a = {
-{   8,   1,   0, 327, {
+static constexpr VSOP2013Term _a0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.011041598701700e+01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, -3.166884538167269e-05, +1.481828355075092e-01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0, -7.596256660809162e-06, +3.597897749269386e-02 },
@@ -329,9 +328,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,   0,  -5,   0,   0,   0,   0, -6.426445137908882e-07, +6.043352906370639e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -1,   0,  -4,   0,   0,   0,   0, +9.277152551988327e-08, -6.013548092614342e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   6,  -6,   0,   0,   0,   0, +5.220250417094849e-07, -1.676493142583385e-07 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -9,   0,   4,   0,   0,   0,   0, -8.921101050923780e-08, +5.981666285791793e-07 },
-} },
-{   8,   1,   1, 231, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -9,   0,   4,   0,   0,   0,   0, -8.921101050923780e-08, +5.981666285791793e-07 }
+};
+
+static constexpr VSOP2013Term _a1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,  -1,   0,   0,   0,   0, +3.109224642376736e-04, +1.612136688441680e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0, -1.276285847424419e-04, -1.790204150263705e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, -1.630895715417067e-04, -4.753204579900835e-05 },
@@ -562,9 +562,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0, +8.628151707773370e-08, +3.752394634503978e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   1,   0,   0,   0,   0,   0, +9.792900223232500e-08, +2.547644922577347e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -2,   3,   0,   0,   0,   0, +1.226055299487404e-07, -2.630814672490901e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, -8.476617735469556e-08, -3.791460796338114e-08 },
-} },
-{   8,   1,   2, 150, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   0,   0,   0,   0,   0, -8.476617735469556e-08, -3.791460796338114e-08 }
+};
+
+static constexpr VSOP2013Term _a2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, -1.438887296353443e-05, +3.185193441259236e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, +1.419730959582273e-05, -3.204312992922654e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,  -1,   0,   0,   0,   0, +1.609975761323647e-05, -1.618664404833514e-05 },
@@ -714,9 +715,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0, +1.315811124532853e-08, -2.143165551300538e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,  -4,   0,   0,   0,   0, +3.303873399631614e-08, +1.285269159690180e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -10,   0,  -1,   0,   0,   0,   0, -3.307606046591032e-08, -1.219703902075826e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -9,   0,   1,   0,   0,   0,   0, +1.616503948344224e-08, -1.810273572726042e-08 },
-} },
-{   8,   1,   3,  89, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -9,   0,   1,   0,   0,   0,   0, +1.616503948344224e-08, -1.810273572726042e-08 }
+};
+
+static constexpr VSOP2013Term _a3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, -4.032314681203516e-06, -2.645503553796695e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, +4.070130228937628e-06, +2.595967791724274e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   1,   0,   0,   0,   0, -2.441432456429144e-06, -1.610309564706913e-06 },
@@ -805,9 +807,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -13,   0,   1,   0,   0,   0,   0, -4.129893183068341e-09, -7.636658041017221e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   3,   1,   0,   0,   0,   0, +2.680220149169315e-09, +8.843872994872973e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   3,  -1,   0,   0,   0,   0, -2.710497790030873e-09, -8.678958016756316e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -4,   0,  -2,   0,   0,   0,   0, +6.748519478351513e-09, +4.558200634519396e-09 },
-} },
-{   8,   1,   4,  50, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -4,   0,  -2,   0,   0,   0,   0, +6.748519478351513e-09, +4.558200634519396e-09 }
+};
+
+static constexpr VSOP2013Term _a4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, +3.504993320207476e-07, -3.658129250387847e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, -3.414443409052295e-07, +3.724883384086140e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   1,   0,   0,   0,   0, +2.152242236295664e-07, -2.204738800464466e-07 },
@@ -857,9 +860,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,  -5,   0,  -1,   0,   0,   0,   0, -1.294145169467448e-09, -2.001964630799103e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -9,   0,   1,   0,   0,   0,   0, -3.053166230019686e-10, -2.966564663651332e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   1,   0,   0,   0,   0, -2.437356417854823e-09, -8.190730058505257e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -1,   1,   0,   0,   0,   0, +1.785424318380757e-09, -1.456203177669800e-09 },
-} },
-{   8,   1,   5,  25, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,  -1,   1,   0,   0,   0,   0, +1.785424318380757e-09, -1.456203177669800e-09 }
+};
+
+static constexpr VSOP2013Term _a5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, +2.430567023505192e-08, +3.624174423454490e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, -2.527450051791740e-08, -3.507575858239338e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   1,   0,   0,   0,   0, +1.446807516059943e-08, +2.240287189663016e-08 },
@@ -884,9 +888,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -12,   3,   1,   0,   0,   0,   0, -2.608172296285396e-10, +1.269566795234614e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -10,   3,  -1,   0,   0,   0,   0, +2.251816534684385e-10, -1.206806162293155e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2, -10,   0,   1,   0,   0,   0,   0, +4.942584949883064e-10, +9.033171683555339e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, -9.550394002702170e-10, -4.168107451291881e-10 },
-} },
-{   8,   1,   6,  11, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, -9.550394002702170e-10, -4.168107451291881e-10 }
+};
+
+static constexpr VSOP2013Term _a6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, -3.087942562671667e-09, +1.124489418095204e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, +2.972568783077583e-09, -1.237471694817461e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   1,   0,   0,   0,   0, -1.919043199857388e-09, +6.450033654560080e-10 },
@@ -897,20 +902,33 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   1,   0,   0,   0,   0, -2.581151636858429e-11, -9.364956958020556e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,  -1,   0,   0,   0,   0, -3.791083142939901e-10, -4.378562296693170e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, +1.386054716200656e-10, +6.553353087420526e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,  -1,   0,   0,   0,   0, -5.562690348617461e-10, +2.227691560099303e-10 },
-} },
-{   8,   1,   7,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,  -1,   0,   0,   0,   0, -5.562690348617461e-10, +2.227691560099303e-10 }
+};
+
+static constexpr VSOP2013Term _a7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, +2.471565055636671e-10, +1.261545349181486e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,  -1,   0,   0,   0,   0, +4.162914855268083e-11, +2.278846867451689e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, +3.563740544509932e-11, +2.176960335361456e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, -2.497464577058058e-11, -2.271434203987476e-10 },
-} },
-{   8,   1,   8,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,  -1,   0,   0,   0,   0, -2.493602180968329e-11, -4.502781494662707e-13 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, -2.497464577058058e-11, -2.271434203987476e-10 }
+};
 
-static vector<VSOP2013Series> _l = {
-{   8,   2,   0, 244, {
+static constexpr VSOP2013Term _a8[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,  -1,   0,   0,   0,   0, -2.493602180968329e-11, -4.502781494662707e-13 }
+};
+
+static constexpr VSOP2013Series _a[] = {
+{   8,   1,   0, 327, _a0 },
+{   8,   1,   1, 231, _a1 },
+{   8,   1,   2, 150, _a2 },
+{   8,   1,   3,  89, _a3 },
+{   8,   1,   4,  50, _a4 },
+{   8,   1,   5,  25, _a5 },
+{   8,   1,   6,  11, _a6 },
+{   8,   1,   7,   4, _a7 },
+{   8,   1,   8,   1, _a8 }
+};
+
+static constexpr VSOP2013Term _l0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.311897933164000e+00 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0, +1.014690462797575e-02, -5.688041401364499e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, +4.417132164176055e-03, +7.045195911201201e-07 },
@@ -1154,9 +1172,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,  -1,   0,   0,   0,   0, +2.216089574129871e-08, -3.439173849357887e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   3,   0,   0,   0,   0, +3.011237422620665e-08, -2.524441392817825e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -2,   1,   0,   0,   0,   0, +5.369434748857388e-08, +1.163093163460022e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -12,  14,  -2,   0,   0,   0,   0, +8.962955442866327e-09, -4.519880491423941e-08 },
-} },
-{   8,   2,   1, 165, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -12,  14,  -2,   0,   0,   0,   0, +8.962955442866327e-09, -4.519880491423941e-08 }
+};
+
+static constexpr VSOP2013Term _l1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.813297222612500e+01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0, -4.565273078954130e-05, +1.584873111604001e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0, -4.162700606896971e-06, +1.218004048688237e-05 },
@@ -1321,9 +1340,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,  -1,   0,   0,   0,   0, +6.566681050810576e-09, +2.984770620014901e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,  -5,   0,   0,   0,   0, +6.341389976173555e-09, -3.208571442245336e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0, -3.421033367189426e-09, -5.761955749208428e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   0,   2,   0,   0,   0,   0, -4.330318966534566e-09, -4.842195587711579e-09 },
-} },
-{   8,   2,   2, 107, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   0,   2,   0,   0,   0,   0, -4.330318966534566e-09, -4.842195587711579e-09 }
+};
+
+static constexpr VSOP2013Term _l2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.941236375689926e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0, +5.631644350338552e-07, -2.932508877305411e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, +9.563580959271284e-07, +4.237877667699795e-07 },
@@ -1430,9 +1450,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   3,  -1,   0,   0,   0,   0, +1.349235658874017e-09, +2.103012264273155e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,  -1,   1,   0,   0,   0,   0, -2.223801799626069e-09, -1.214107326064950e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -7,   3,   1,   0,   0,   0,   0, +1.364877194825978e-09, +2.061414553452701e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   0,   6,   0,   0,   0,   0, +1.087186944065882e-09, -2.323866758377607e-09 },
-} },
-{   8,   2,   3,  64, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   0,   6,   0,   0,   0,   0, +1.087186944065882e-09, -2.323866758377607e-09 }
+};
+
+static constexpr VSOP2013Term _l3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.415492570837751e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0, +1.029595918750952e-07, +1.153001627639895e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, -7.748586139533886e-08, +1.214755329502370e-07 },
@@ -1496,9 +1517,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   1,  -3,   0,   0,   0,   0, +4.237862631549483e-10, -6.828389040459067e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0, -3.755957405488714e-10, -6.631505813987144e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -14,   4,   1,   0,   0,   0,   0, -6.175431201051893e-10, -4.065947128849702e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, -9.453321829051500e-10, +5.165689730936860e-11 },
-} },
-{   8,   2,   4,  37, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, -9.453321829051500e-10, +5.165689730936860e-11 }
+};
+
+static constexpr VSOP2013Term _l4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, -1.089110554289157e-08, -1.043413179719038e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, -1.111701153297808e-08, -1.019131307992108e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.887645208455415e-08 },
@@ -1535,9 +1557,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   4,  -2,   0,   0,   0,   0, -1.247106815561514e-10, -3.587348192832618e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   3,  -1,   0,   0,   0,   0, -5.879476204951370e-12, -4.340883966958976e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -11,   3,   1,   0,   0,   0,   0, -8.296555906121077e-12, -4.293990087965984e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.140180101358107e-10, -1.913857763548853e-10 },
-} },
-{   8,   2,   5,  19, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0, -2.140180101358107e-10, -1.913857763548853e-10 }
+};
+
+static constexpr VSOP2013Term _l5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.013369243698869e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -17,   7,  -2,   0,   0,   0,   0, -1.886158972317659e-09, -1.907172571875942e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -17,   6,   0,   0,   0,   0,   0, +1.574316583760837e-09, +6.732956776200087e-10 },
@@ -1556,9 +1579,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0, -1.084447310703986e-10, -1.397285845132295e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   6,  -6,   0,   0,   0,   0, -1.059144976002588e-10, +7.153199649035570e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,  -1,   0,   0,   0,   0, +9.380706872153531e-11, -5.694888144695938e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -23,  15,   2,   0,   0,   0,   0, +1.387004687247693e-11, +1.274900111805792e-10 },
-} },
-{   8,   2,   6,   9, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   7, -23,  15,   2,   0,   0,   0,   0, +1.387004687247693e-11, +1.274900111805792e-10 }
+};
+
+static constexpr VSOP2013Term _l6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.519783871454746e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   1,   4,   0,   0,   0,   0, +2.375885455110882e-10, +6.909088064980720e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   6, -17,   6,   0,   0,   0,   0,   0, +5.111852069241257e-10, -3.930792545988318e-10 },
@@ -1567,19 +1591,32 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,  -1,   0,   0,   0,   0, -2.037575930305407e-11, -5.312004687507072e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   1,   0,   0,   0,   0, -1.676288964910716e-11, -4.988193250907296e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,  -1,   0,   0,   0,   0, -1.992670667795620e-11, -4.356559800461753e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -10,   0,   1,   0,   0,   0,   0, -1.557780304405950e-11, -3.884055863509838e-11 },
-} },
-{   8,   2,   7,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -10,   0,   1,   0,   0,   0,   0, -1.557780304405950e-11, -3.884055863509838e-11 }
+};
+
+static constexpr VSOP2013Term _l7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.279217894249272e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,  -1,   0,   0,   0,   0, +6.774623081580926e-12, -1.237866088047180e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, -6.496274558914983e-12, +1.064083419763251e-12 },
-} },
-{   8,   2,   8,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.997439670922088e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, -6.496274558914983e-12, +1.064083419763251e-12 }
+};
+
+static constexpr VSOP2013Term _l8[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.997439670922088e-12 }
+};
 
-static vector<VSOP2013Series> _k = {
-{   8,   3,   0, 269, {
+static constexpr VSOP2013Series _l[] = {
+{   8,   2,   0, 244, _l0 },
+{   8,   2,   1, 165, _l1 },
+{   8,   2,   2, 107, _l2 },
+{   8,   2,   3,  64, _l3 },
+{   8,   2,   4,  37, _l4 },
+{   8,   2,   5,  19, _l5 },
+{   8,   2,   6,   9, _l6 },
+{   8,   2,   7,   3, _l7 },
+{   8,   2,   8,   1, _l8 }
+};
+
+static constexpr VSOP2013Term _k0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.998838194000000e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, -1.195908189204994e-06, +3.438127013876512e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0, -2.340140117574077e-08, +1.362288518758392e-03 },
@@ -1848,9 +1885,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   3,   0,   0,   0,   0,   0, +2.321435054059294e-08, -2.727187159188294e-08 },
 {   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0, -2.640085884250356e-08, -2.364575310549579e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -11,   3,   0,   0,   0,   0,   0, -2.302457300344743e-08, +2.696138285144529e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -4,   0,   0,   0,   0, -2.202908390146224e-09, +4.758518306472459e-08 },
-} },
-{   8,   3,   1, 178, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -4,   0,   0,   0,   0, -2.202908390146224e-09, +4.758518306472459e-08 }
+};
+
+static constexpr VSOP2013Term _k1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +7.460455402610619e-06, +3.871203481126349e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +8.830856821251260e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0, -2.915368834089489e-06, -4.087760970515545e-06 },
@@ -2028,9 +2066,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -6,   3,   2,   0,   0,   0,   0, +6.015270974299885e-09, +4.965617982002771e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,  -2,   0,   0,   0,   0, +6.390376872605749e-09, -4.500857409309287e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   1,   0,   0,   0,   0, -1.354602191664433e-09, -9.514488499250968e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0, -3.094839817979317e-09, +7.512069683834370e-09 },
-} },
-{   8,   3,   2, 112, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0, -3.094839817979317e-09, +7.512069683834370e-09 }
+};
+
+static constexpr VSOP2013Term _k2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.200377573953148e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +3.295828129404907e-07, -7.440385455622668e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -3.341162631942251e-07, +7.386585973919423e-07 },
@@ -2142,9 +2181,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0, +2.802831516601789e-09, +3.033527490526017e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -5,   0,   0,   0,   0, +4.100376075719569e-10, -2.575095541910197e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -12,   3,   2,   0,   0,   0,   0, -1.980770340325597e-09, +9.075790322156487e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   3,   0,   0,   0,   0,   0, -1.720034710908620e-09, +1.103819005276392e-09 },
-} },
-{   8,   3,   3,  66, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   3,   0,   0,   0,   0,   0, -1.720034710908620e-09, +1.103819005276392e-09 }
+};
+
+static constexpr VSOP2013Term _k3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -9.349871067038578e-08, -6.137900822420149e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +9.449446868516994e-08, +6.027153848516302e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, -5.191888010084514e-08, -3.429377108429618e-08 },
@@ -2210,9 +2250,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0, +1.800281561571441e-10, -5.658777292842402e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0, +4.207618402638791e-10, +3.202901914862091e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   5,   0,  -2,   0,   0,   0,   0, -4.632043278731942e-10, +2.708673419397666e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   3,   0,   0,   0,   0, +5.804719376118452e-10, -1.518061354743512e-10 },
-} },
-{   8,   3,   4,  38, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   3,   0,   0,   0,   0, +5.804719376118452e-10, -1.518061354743512e-10 }
+};
+
+static constexpr VSOP2013Term _k4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +8.128764625331662e-09, -8.481548614276938e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -7.928041721180587e-09, +8.645543475198143e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, +4.587846230649892e-09, -4.688475854240093e-09 },
@@ -2250,9 +2291,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   3,   0,   0,   0,   0,   0, +3.383659311635022e-10, -4.275711656689715e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -11,   3,   0,   0,   0,   0,   0, -3.342763682085776e-10, +6.320935563693205e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -2,   0,   0,   0,   0, -2.958880873074790e-10, -1.991228533472105e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,  -2,   0,   0,   0,   0, +1.441899683603283e-10, +1.653777019959075e-10 },
-} },
-{   8,   3,   5,  19, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,  -2,   0,   0,   0,   0, +1.441899683603283e-10, +1.653777019959075e-10 }
+};
+
+static constexpr VSOP2013Term _k5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -8,  -2,   7,   0,   0,   0,   0, +7.984356969183986e-10, -6.849037311452157e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +5.635481072814426e-10, +8.403106505071894e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -5.862960916964609e-10, -8.144389884389740e-10 },
@@ -2271,9 +2313,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,  -2,   0,   0,   0,   0, -6.224711683258773e-11, -1.043107650886053e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   1,   4,   0,   0,   0,   0, -5.161114842693395e-11, +9.821524645068665e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   0,   2,   0,   0,   0,   0, -4.894012058699289e-11, -8.122137542969261e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +4.727665501972188e-11, +7.727357542303774e-11 },
-} },
-{   8,   3,   6,   9, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +4.727665501972188e-11, +7.727357542303774e-11 }
+};
+
+static constexpr VSOP2013Term _k6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +6.901491640314880e-11, -2.866643053524826e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -7.158533397722388e-11, +2.607897226121552e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, +4.142638169638418e-11, -1.585492257562866e-11 },
@@ -2282,19 +2325,32 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -10,   0,   0,   0,   0,   0,   0, -3.019722783602976e-11, +1.211097360039816e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   0,   0,   0,   0,   0,   0, +2.804251273433404e-11, -1.073604150418713e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -2,   0,   0,   0,   0, -2.733169087991572e-11, +9.946759098621791e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   2,   0,   0,   0,   0, +2.626565119920902e-11, -1.093787004293258e-11 },
-} },
-{   8,   3,   7,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   2,   0,   0,   0,   0, +2.626565119920902e-11, -1.093787004293258e-11 }
+};
+
+static constexpr VSOP2013Term _k7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, +9.619473281102599e-13, +5.281710862555497e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +8.212276095593154e-13, +5.055893103108850e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -5.792647828911735e-13, -5.262851060272742e-12 },
-} },
-{   8,   3,   8,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -5.763640505971675e-13, -1.133661499721604e-14 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -5.792647828911735e-13, -5.262851060272742e-12 }
+};
+
+static constexpr VSOP2013Term _k8[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -5.763640505971675e-13, -1.133661499721604e-14 }
+};
 
-static vector<VSOP2013Series> _h = {
-{   8,   4,   0, 270, {
+static constexpr VSOP2013Series _k[] = {
+{   8,   3,   0, 269, _k0 },
+{   8,   3,   1, 178, _k1 },
+{   8,   3,   2, 112, _k2 },
+{   8,   3,   3,  66, _k3 },
+{   8,   3,   4,  38, _k4 },
+{   8,   3,   5,  19, _k5 },
+{   8,   3,   6,   9, _k6 },
+{   8,   3,   7,   3, _k7 },
+{   8,   3,   8,   1, _k8 }
+};
+
+static constexpr VSOP2013Term _h0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.691809982000000e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, +3.440371234102762e-03, +2.600370896891576e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0, +1.362745596816718e-03, -7.316836421432354e-08 },
@@ -2564,9 +2620,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,  -2,   0,   0,   0,   0, -3.799522935506414e-08, -1.290788646289873e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,  -2,   0,   0,   0,   0, +4.914299695568746e-08, -1.574063304465483e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   3,   0,   0,   0,   0,   0, -2.729036651740481e-08, -2.317778546334481e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0, +4.882072423669439e-08, +1.348501479361048e-09 },
-} },
-{   8,   4,   1, 179, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0, +4.882072423669439e-08, +1.348501479361048e-09 }
+};
+
+static constexpr VSOP2013Term _h1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.803136248402970e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, +3.870210886341811e-06, -7.469681144639923e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0, -4.083251260875028e-06, +2.910121439856303e-06 },
@@ -2745,9 +2802,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,  -2,   0,   0,   0,   0, +4.522370887722122e-09, +6.402369585321998e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0, +1.659058575137119e-09, -9.032431921997346e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -4,   0,   2,   0,   0,   0,   0, +4.078204998033885e-09, -6.556638709353958e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0, -1.023386265488166e-09, -9.312145926872068e-09 },
-} },
-{   8,   4,   2, 113, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0, -1.023386265488166e-09, -9.312145926872068e-09 }
+};
+
+static constexpr VSOP2013Term _h2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +7.446698092989028e-07, +3.300296577790795e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +7.386755172409827e-07, +3.332544047562984e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.982091068140214e-07 },
@@ -2860,9 +2918,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -5,   0,   0,   0,   0, +2.574641821078753e-09, +4.120205480974094e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   1,   0,   0,   0,   0,   0, +2.086232761205302e-09, +8.886251099953423e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -12,   3,   2,   0,   0,   0,   0, +9.078174097931119e-10, +1.980896091137208e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -7,   0,   0,   0,   0,   0,   0, +2.026840234872457e-09, +8.386078411903910e-10 },
-} },
-{   8,   4,   3,  67, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -7,   0,   0,   0,   0,   0,   0, +2.026840234872457e-09, +8.386078411903910e-10 }
+};
+
+static constexpr VSOP2013Term _h3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -6.034208663820704e-08, +9.459960260697537e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -6.131812572132497e-08, +9.352718082507590e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, +3.413532338367386e-08, -5.182633115667431e-08 },
@@ -2929,9 +2988,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   5,   0,  -2,   0,   0,   0,   0, -2.788070796156139e-10, -4.755092150592570e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0, -5.721302886793790e-10, -1.766609608983003e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   3,   0,   0,   0,   0, -1.519271096243781e-10, -5.805270661856583e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -2,   0,   0,   0,   0, -2.060912516963917e-10, -5.035044266446760e-10 },
-} },
-{   8,   4,   4,  39, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -2,   0,   0,   0,   0, -2.060912516963917e-10, -5.035044266446760e-10 }
+};
+
+static constexpr VSOP2013Term _h4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -8.486040818986252e-09, -8.126771089994670e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -8.659316639131991e-09, -7.936531966787539e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, +4.680024495575408e-09, +4.558229629199058e-09 },
@@ -2970,9 +3030,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -11,   3,   0,   0,   0,   0,   0, -4.416094937111458e-12, -3.384306102905196e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -11,   3,   0,   0,   0,   0,   0, -6.299958807938506e-12, -3.345987499199795e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,  -2,   0,   0,   0,   0, -1.781852222815438e-10, +1.505285084991277e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -2,   0,   0,   0,   0, +1.974928267011430e-11, -2.958281333659378e-10 },
-} },
-{   8,   4,   5,  19, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -2,   0,   0,   0,   0, +1.974928267011430e-11, -2.958281333659378e-10 }
+};
+
+static constexpr VSOP2013Term _h5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +8.404784579053956e-10, -5.639243811731773e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +8.152961834063427e-10, -5.877987717213558e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,   0, -4.739356647498731e-10, +3.072950261078463e-10 },
@@ -2991,9 +3052,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   0,   2,   0,   0,   0,   0, -8.133643969060613e-11, +4.894889896916886e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -9,   0,   0,   0,   0,   0,   0, +7.702875145683736e-11, -4.641510279505247e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -10,   0,   2,   0,   0,   0,   0, +7.564387743129412e-11, -4.642823346092352e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.141366628331863e-10 },
-} },
-{   8,   4,   6,   9, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.141366628331863e-10 }
+};
+
+static constexpr VSOP2013Term _h6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, +2.880765840179235e-11, +6.909313412542716e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, +2.609702185850964e-11, +7.161932672320085e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -1.590312980225934e-11, -4.137072790012106e-11 },
@@ -3002,19 +3064,32 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3, -10,   0,   0,   0,   0,   0,   0, -1.212744583884411e-11, -3.023247924783355e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   4, -11,   0,   0,   0,   0,   0,   0, +1.074813756294628e-11, +2.793836544603907e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -2,   0,   0,   0,   0, -9.946884621977255e-12, -2.733199092862492e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   2,   0,   0,   0,   0, -1.093709492642051e-11, -2.626625654222194e-11 },
-} },
-{   8,   4,   7,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   2,   0,   0,   0,   0, -1.093709492642051e-11, -2.626625654222194e-11 }
+};
+
+static constexpr VSOP2013Term _h7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, +5.277624286280957e-12, -9.678228364155081e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,   0,   0, -5.062530611553982e-12, +8.331937075573067e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -5.266250021324612e-12, +5.786617291454407e-13 },
-} },
-{   8,   4,   8,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -1.065941864177605e-14, +5.763739117987594e-13 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0, -5.266250021324612e-12, +5.786617291454407e-13 }
+};
+
+static constexpr VSOP2013Term _h8[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,   0, -1.065941864177605e-14, +5.763739117987594e-13 }
+};
+
+static constexpr VSOP2013Series _h[] = {
+{   8,   4,   0, 270, _h0 },
+{   8,   4,   1, 179, _h1 },
+{   8,   4,   2, 113, _h2 },
+{   8,   4,   3,  67, _h3 },
+{   8,   4,   4,  39, _h4 },
+{   8,   4,   5,  19, _h5 },
+{   8,   4,   6,   9, _h6 },
+{   8,   4,   7,   3, _h7 },
+{   8,   4,   8,   1, _h8 }
+};
 
-static vector<VSOP2013Series> _q = {
-{   8,   5,   0,  64, {
+static constexpr VSOP2013Term _q0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.029147513800000e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, -4.128223319791564e-07, +1.009228486085109e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   0,   0, -3.553409733337765e-07, +8.733964639121190e-06 },
@@ -3078,9 +3153,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0, -1.024851688699665e-09, -2.547402824428526e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,  -1,   0,   0,   0,   0, +2.123289717533032e-08, +3.611230211570120e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,  -6,   0,   0,   0,   0, +1.290017117903211e-08, -1.166624592889547e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   1,   0,   0,   0,   0, -3.325333414517074e-09, -2.044787735188950e-08 },
-} },
-{   8,   5,   1,  35, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   1,   0,   0,   0,   0, -3.325333414517074e-09, -2.044787735188950e-08 }
+};
+
+static constexpr VSOP2013Term _q1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -7.512680221293386e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, -3.190818615185414e-07, -3.844559440280018e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   0,   0, -2.764065823138730e-07, -3.326584901622394e-07 },
@@ -3115,9 +3191,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   1,   0,   0,   0,   0, -1.870231948008341e-09, -2.636570524552032e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0, +2.714821446635971e-09, -1.574678058301647e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0, -1.931788288975054e-09, -2.019944937431187e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   1,  -1,   0,   0,   0,   0, -2.108279726954440e-09, -1.841013652141255e-09 },
-} },
-{   8,   5,   2,  19, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   1,  -1,   0,   0,   0,   0, -2.108279726954440e-09, -1.841013652141255e-09 }
+};
+
+static constexpr VSOP2013Term _q2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.433503558816249e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, +2.691233506651419e-08, -2.029830443943537e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   0,   0, +2.328288044172272e-08, -1.757408031814264e-08 },
@@ -3136,9 +3213,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0, -3.318901819402967e-10, +1.037390878781762e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0, +8.908914681951398e-10, +4.504292584817485e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   1,   0,   0,   0,   0, -1.007554842185519e-09, +2.052182077775257e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   1,   0,   0,   0,   0, -2.829583900996026e-10, +9.040146684581995e-10 },
-} },
-{   8,   5,   3,   9, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   1,   0,   0,   0,   0, -2.829583900996026e-10, +9.040146684581995e-10 }
+};
+
+static constexpr VSOP2013Term _q3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +8.996979069624205e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, +5.770878880688116e-10, +1.018343584069806e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   0,   0, +5.011908373808447e-10, +8.806842455404468e-10 },
@@ -3147,19 +3225,29 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, -3.154253445938840e-10, -3.488303531797573e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   1,   0,   0,   0,   0, -2.725963976870913e-10, -3.013076365583196e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,  -1,   0,   0,   0,   0, +8.072928009995230e-11, -3.571238225448213e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, +2.076292577571284e-10, +1.993193507715810e-10 },
-} },
-{   8,   5,   4,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, +2.076292577571284e-10, +1.993193507715810e-10 }
+};
+
+static constexpr VSOP2013Term _q4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.579893046136791e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, -4.687078130706728e-11, +4.023315199688899e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, +5.070457219592513e-11, -2.820393929961927e-11 },
-} },
-{   8,   5,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, +1.599040415480314e-12, +5.711347463633943e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, +5.070457219592513e-11, -2.820393929961927e-11 }
+};
+
+static constexpr VSOP2013Term _q5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, +1.599040415480314e-12, +5.711347463633943e-12 }
+};
 
-static vector<VSOP2013Series> _p = {
-{   8,   6,   0,  63, {
+static constexpr VSOP2013Series _q[] = {
+{   8,   5,   0,  64, _q0 },
+{   8,   5,   1,  35, _q1 },
+{   8,   5,   2,  19, _q2 },
+{   8,   5,   3,   9, _q3 },
+{   8,   5,   4,   3, _q4 },
+{   8,   5,   5,   1, _q5 }
+};
+
+static constexpr VSOP2013Term _p0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.151676665900000e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, -1.008517921388559e-05, -4.104560528929437e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   0,   0, +8.733650507811760e-06, +3.575866946800602e-07 },
@@ -3222,9 +3310,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, +2.365015933832989e-08, -3.852112576289524e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0, -4.058501162361190e-09, +2.253025624995269e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0, +5.704836993222500e-09, -2.068995759147054e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,  -1,   0,   0,   0,   0, -3.592612630608915e-09, +2.153965742358822e-08 },
-} },
-{   8,   6,   1,  36, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,  -1,   0,   0,   0,   0, -3.592612630608915e-09, +2.153965742358822e-08 }
+};
+
+static constexpr VSOP2013Term _p1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.572175215148812e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, +3.841368510699330e-07, -3.193708967333400e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   0,   0, -3.327240936829727e-07, +2.763209165904597e-07 },
@@ -3260,9 +3349,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,  -2,   0,   0,   0,   0, -1.268265668810172e-09, -2.965521604720896e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0, +2.739108062832372e-09, -1.410335909331812e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   1,  -1,   0,   0,   0,   0, -1.838886225348360e-09, +2.106069733649251e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,  -1,   0,   0,   0,   0, +1.870976819001191e-09, +1.797565765523331e-09 },
-} },
-{   8,   6,   2,  19, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,  -1,   0,   0,   0,   0, +1.870976819001191e-09, +1.797565765523331e-09 }
+};
+
+static constexpr VSOP2013Term _p2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.958310393176235e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, +2.029314171405733e-08, +2.691979747724314e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   0,   0, -1.756776044144708e-08, -2.328728382196129e-08 },
@@ -3281,9 +3371,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0, -1.131852777748504e-09, -3.452629142477138e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0, -4.155738910868782e-10, +9.643953862596115e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   1,   0,   0,   0,   0, +1.995127824256429e-10, +1.036891331766015e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   1,   0,   0,   0,   0, +9.039223670878092e-10, +2.831880653437743e-10 },
-} },
-{   8,   6,   3,   9, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   1,   0,   0,   0,   0, +9.039223670878092e-10, +2.831880653437743e-10 }
+};
+
+static constexpr VSOP2013Term _p3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.511768108015240e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, -1.017551496058557e-09, +5.778320928794248e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   0,   0, +8.808039179891931e-10, -5.009564848911083e-10 },
@@ -3292,42 +3383,61 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, +3.486011720772337e-10, -3.153523737186753e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   1,   0,   0,   0,   0, -3.013720170437224e-10, +2.725111530379502e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,  -1,   0,   0,   0,   0, +3.591853342071998e-10, +7.977849730157052e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, +1.991701115152563e-10, -2.073832672159823e-10 },
-} },
-{   8,   6,   4,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   1,   0,   0,   0,   0, +1.991701115152563e-10, -2.073832672159823e-10 }
+};
+
+static constexpr VSOP2013Term _p4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.302794733805976e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0,   0, -4.021912226347698e-11, -4.687226568053222e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, +2.820407662060539e-11, +5.067723957979020e-11 },
-} },
-{   8,   6,   5,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, -5.709377905710401e-12, +1.599709999526006e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, +2.820407662060539e-11, +5.067723957979020e-11 }
+};
 
+static constexpr VSOP2013Term _p5[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,  -1,   0,   0,   0,   0, -5.709377905710401e-12, +1.599709999526006e-12 }
+};
+
+static constexpr VSOP2013Series _p[] = {
+{   8,   6,   0,  63, _p0 },
+{   8,   6,   1,  36, _p1 },
+{   8,   6,   2,  19, _p2 },
+{   8,   6,   3,   9, _p3 },
+{   8,   6,   4,   3, _p4 },
+{   8,   6,   5,   1, _p5 }
+};
+
+
+vector<VSOP2013PackedSeries> VSOP2013::neptunePackedSeries ( void )
+{
+    return packSeries ( { _a, _l, _k, _h, _q, _p } );
+}
 
 SSOrbit VSOP2013::neptuneOrbit ( double jed )
 {
+    if ( usePackedSeries() )
+        return getOrbit ( 8, jed, getPackedSeries ( 8 ) );
+    
     double a = 0.0, l = 0.0, k = 0.0, h = 0.0, q = 0.0, p = 0.0;
     double t = ( jed - 2451545.0 ) / 365250.0;
     double ll[17] = { 0 };
     
     evalLongitudes ( t, ll );
 
-    for ( VSOP2013Series &series : _a )
+    for ( const VSOP2013Series &series : _a )
         a += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _l )
+    for ( const VSOP2013Series &series : _l )
         l += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _k )
+    for ( const VSOP2013Series &series : _k )
         k += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _h )
+    for ( const VSOP2013Series &series : _h )
         h += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _q )
+    for ( const VSOP2013Series &series : _q )
         q += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _p )
+    for ( const VSOP2013Series &series : _p )
         p += evalSeries ( t, series, ll );
 
     double e = sqrt ( k * k + h * h );  // eccentricity
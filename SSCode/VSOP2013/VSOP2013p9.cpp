@@ -1,8 +1,7 @@
 #include "VSOP2013.hpp"
 #if VSOP2013_EMBED_SERIES
 
-static vector<VSOP2013Series> _a = {
-{   9,   1,   0, 777, {
+static constexpr VSOP2013Term _a0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.954461714403000e+01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, -8.525819763547007e-02, -1.889137353343409e-01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -3.338741527488626e-02, -4.149587783381234e-02 },
@@ -779,9 +778,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 719,   0,   0,   0, +3.920736922948325e-07, +2.264063066885868e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -13179,   0,   0,   0, +2.705145450806752e-07, -3.609946816045929e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2766,   0,   0,   0, -4.448652396819680e-07, +5.538448944962297e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1791,   0,   0,   0, -3.242609127060801e-07, -3.066381769564512e-07 },
-} },
-{   9,   1,   1, 647, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1791,   0,   0,   0, -3.242609127060801e-07, -3.066381769564512e-07 }
+};
+
+static constexpr VSOP2013Term _a1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +5.382252967565117e-02, -2.454100771085402e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.789000000000001e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +1.962357176525557e-02, -1.598173392936494e-02 },
@@ -1428,9 +1428,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  21,   0,   0,   0, -1.974344715566187e-07, -4.385536755175248e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2941,   0,   0,   0, +2.993979332253327e-07, +3.748815978119529e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 3825,   0,   0,   0, -4.559374866587210e-07, -1.352661643719917e-07 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 17413,   0,   0,   0, -2.802059981619077e-07, +3.830763982808416e-07 },
-} },
-{   9,   1,   2, 540, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 17413,   0,   0,   0, -2.802059981619077e-07, +3.830763982808416e-07 }
+};
+
+static constexpr VSOP2013Term _a2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +6.972754439870636e-03, +6.156473418398688e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +5.354745816274890e-03, +3.447371868699193e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.019905974440888e-03 },
@@ -1970,9 +1971,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1308,   0,   0,   0, +3.179232428728577e-07, -1.088556265080986e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 455,   0,   0,   0, +2.906075006393965e-07, +1.658073729986768e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 4564,   0,   0,   0, +3.065673784257045e-07, +1.324333907958019e-07 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 800,   0,   0,   0, -3.311023242107337e-07, +1.364911234991588e-08 },
-} },
-{   9,   1,   3, 411, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 800,   0,   0,   0, -3.311023242107337e-07, +1.364911234991588e-08 }
+};
+
+static constexpr VSOP2013Term _a3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, -6.606584488700741e-04, +1.478993724107789e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -3.175292881974644e-04, +1.451316209310307e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 522,   0,   0,   0, -2.441574085721237e-04, +3.030884768325527e-04 },
@@ -2383,9 +2385,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 754,   0,   0,   0, -2.808924548349415e-07, -1.011463877345609e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 109,   0,   0,   0, +1.499608848290751e-07, +2.580038995713217e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 101,   0,   0,   0, +2.646603280579285e-07, +1.332236437841172e-07 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2638,   0,   0,   0, +6.268506269034897e-08, +2.892690649305014e-07 },
-} },
-{   9,   1,   4, 327, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2638,   0,   0,   0, +6.268506269034897e-08, +2.892690649305014e-07 }
+};
+
+static constexpr VSOP2013Term _a4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -2.910479554689720e-04, +9.113804749281325e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, -2.147942316477144e-04, -5.477594368104335e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -1.796005369265730e-04, +1.130087867900628e-04 },
@@ -2712,9 +2715,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 416,   0,   0,   0, -1.048437393193873e-07, -1.128282725827432e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1150,   0,   0,   0, +8.912992295526432e-08, +1.244263835202900e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2851,   0,   0,   0, -1.255793485101798e-07, +8.505465320979584e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 369,   0,   0,   0, -1.347204454725663e-07, +6.597159262733544e-08 },
-} },
-{   9,   1,   5, 237, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 369,   0,   0,   0, -1.347204454725663e-07, +6.597159262733544e-08 }
+};
+
+static constexpr VSOP2013Term _a5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -1.421676697802081e-06, +8.045158633615661e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -1.423873022031200e-05, -4.675718874006545e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +4.617262464189690e-06, -2.976869680488803e-05 },
@@ -2951,9 +2955,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  22,   0,   0,   0, +1.065878300707451e-09, +9.826766995009470e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 766,   0,   0,   0, -9.711785351180218e-08, +1.299267291834925e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 113,   0,   0,   0, -7.355703567599943e-08, +6.454791485264691e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  38,   0,   0,   0, -3.485940926324342e-08, -9.064382323180594e-08 },
-} },
-{   9,   1,   6, 188, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  38,   0,   0,   0, -3.485940926324342e-08, -9.064382323180594e-08 }
+};
+
+static constexpr VSOP2013Term _a6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +7.276240553380732e-06, -3.644136145765238e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -4.100010891962110e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +3.472494879098000e-06, +6.569047503091048e-07 },
@@ -3141,9 +3146,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  95,   0,   0,   0, -5.404518595250855e-09, -3.899425623362701e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2116,   0,   0,   0, -2.399103553545572e-08, +3.118018922677856e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2258,   0,   0,   0, -1.904897373731163e-08, +3.398899463959070e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 974,   0,   0,   0, +1.874950390438854e-08, -3.390484741846855e-08 },
-} },
-{   9,   1,   7, 135, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 974,   0,   0,   0, +1.874950390438854e-08, -3.390484741846855e-08 }
+};
+
+static constexpr VSOP2013Term _a7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.200000000000000e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +6.971635751283039e-07, +7.022635649848954e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1119,   0,   0,   0, +4.114961610119027e-07, +7.072032488725975e-09 },
@@ -3278,9 +3284,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 161,   0,   0,   0, +2.406022551175476e-09, -1.182798188624618e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 812,   0,   0,   0, +1.179022536675596e-08, +1.290655167356229e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 271,   0,   0,   0, +9.038532277524372e-09, -7.640133961281180e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 816,   0,   0,   0, +7.562805088947754e-10, -1.173464018548890e-08 },
-} },
-{   9,   1,   8, 102, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 816,   0,   0,   0, +7.562805088947754e-10, -1.173464018548890e-08 }
+};
+
+static constexpr VSOP2013Term _a8[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.907347300000000e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -9.631226093784565e-08, +1.144787382311559e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, +6.286392683842956e-08, +3.673407872603661e-08 },
@@ -3382,9 +3389,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 177,   0,   0,   0, -4.070589129195945e-09, +2.538686620971606e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1284,   0,   0,   0, +1.045996639033061e-09, -3.882063963850714e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2521,   0,   0,   0, -7.911972798235208e-11, +4.017942100432792e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  94,   0,   0,   0, +1.810296392225176e-10, -3.996662716494960e-09 },
-} },
-{   9,   1,   9,  90, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  94,   0,   0,   0, +1.810296392225176e-10, -3.996662716494960e-09 }
+};
+
+static constexpr VSOP2013Term _a9[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.090447300000000e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -1.399052479277111e-08, +3.263819696595265e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, -4.284005344985317e-09, +1.049405785703320e-08 },
@@ -3474,9 +3482,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 325,   0,   0,   0, +5.824506259859359e-10, +3.618509295951679e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2804,   0,   0,   0, -4.010733782134633e-10, -5.327266521857728e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  44,   0,   0,   0, +3.569428542481374e-11, -6.533806401049242e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1244,   0,   0,   0, +6.473474229648175e-10, -5.644089982506179e-13 },
-} },
-{   9,   1,  10,  88, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1244,   0,   0,   0, +6.473474229648175e-10, -5.644089982506179e-13 }
+};
+
+static constexpr VSOP2013Term _a10[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.482514700000000e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +9.649050849374292e-11, -2.133939103623349e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, +1.603399994684541e-09, -4.038723318289340e-10 },
@@ -3564,9 +3573,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1339,   0,   0,   0, -5.330412385335428e-11, +1.130059462032893e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  26,   0,   0,   0, -1.061978700439777e-10, +6.470907915727996e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 620,   0,   0,   0, +9.376803085975883e-12, -1.239405025213469e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 463,   0,   0,   0, -1.217654278177312e-10, -9.991977783606379e-12 },
-} },
-{   9,   1,  11,  68, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 463,   0,   0,   0, -1.217654278177312e-10, -9.991977783606379e-12 }
+};
+
+static constexpr VSOP2013Term _a11[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, -3.395167514438002e-11, -2.242043473273591e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +1.749791141717003e-10, -9.170295696811379e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, +1.724725263466403e-10, -7.561368945913159e-11 },
@@ -3634,9 +3644,10 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 471,   0,   0,   0, +5.355858057078222e-12, -1.432518048367053e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  34,   0,   0,   0, -1.488544929022465e-11, +3.197817915291945e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40,   0,   0,   0, -1.368206151360845e-11, +6.255921380908427e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  26,   0,   0,   0, -1.250893109842323e-11, -8.287707340385417e-12 },
-} },
-{   9,   1,  12,  28, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  26,   0,   0,   0, -1.250893109842323e-11, -8.287707340385417e-12 }
+};
+
+static constexpr VSOP2013Term _a12[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, -2.400152800381801e-11, +9.468716819156175e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +8.699562686425066e-12, +2.046289912766621e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, +8.183339812665279e-12, +1.703851096279905e-11 },
@@ -3664,11 +3675,26 @@ static vector<VSOP2013Series> _a = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 239,   0,   0,   0, +2.144147085244520e-12, +3.594189579900761e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 129,   0,   0,   0, +1.848170217103253e-12, -3.259471688696703e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 154,   0,   0,   0, +3.458028847275262e-12, +5.783517299899525e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43,   0,   0,   0, -6.381011894270289e-13, -3.442650691737202e-12 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43,   0,   0,   0, -6.381011894270289e-13, -3.442650691737202e-12 }
+};
+
+static constexpr VSOP2013Series _a[] = {
+{   9,   1,   0, 777, _a0 },
+{   9,   1,   1, 647, _a1 },
+{   9,   1,   2, 540, _a2 },
+{   9,   1,   3, 411, _a3 },
+{   9,   1,   4, 327, _a4 },
+{   9,   1,   5, 237, _a5 },
+{   9,   1,   6, 188, _a6 },
+{   9,   1,   7, 135, _a7 },
+{   9,   1,   8, 102, _a8 },
+{   9,   1,   9,  90, _a9 },
+{   9,   1,  10,  88, _a10 },
+{   9,   1,  11,  68, _a11 },
+{   9,   1,  12,  28, _a12 }
+};
 
-static vector<VSOP2013Series> _l = {
-{   9,   2,   0, 400, {
+static constexpr VSOP2013Term _l0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +4.165471124826000e+00 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, -4.567216393743373e-03, +2.061051693497233e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, +2.221493128020853e-03, +3.490137065917968e-03 },
@@ -4068,9 +4094,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2836,   0,   0,   0, -8.946182845451381e-09, +4.525708918282229e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1434,   0,   0,   0, +4.489348945449943e-08, +4.132725056501835e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 122,   0,   0,   0, -2.684995218489692e-08, +3.620009099250881e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 7293,   0,   0,   0, -2.485469238829674e-08, -3.755690741294944e-08 },
-} },
-{   9,   2,   1, 353, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 7293,   0,   0,   0, -2.485469238829674e-08, -3.755690741294944e-08 }
+};
+
+static constexpr VSOP2013Term _l1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.533566020437000e+01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, +1.774195586429015e-03, -2.189791682444253e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, -5.898717141021054e-04, -1.302952706727716e-03 },
@@ -4423,9 +4450,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1091,   0,   0,   0, +5.856219620457809e-09, +3.732149683384182e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 529,   0,   0,   0, +3.533786835100041e-08, -1.326543457027112e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 737,   0,   0,   0, +1.587394676216054e-08, +3.412437262127981e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2883,   0,   0,   0, +3.167780236842420e-08, +1.936197957296310e-08 },
-} },
-{   9,   2,   2, 271, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2883,   0,   0,   0, +3.167780236842420e-08, +1.936197957296310e-08 }
+};
+
+static constexpr VSOP2013Term _l2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.827221883916392e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, +6.095122513962722e-05, -4.238220551453537e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, +1.355549886699970e-04, -2.421495016152030e-04 },
@@ -4696,9 +4724,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 287,   0,   0,   0, +3.359560929459337e-09, +2.925847707538718e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 737,   0,   0,   0, -1.845834888120441e-08, +2.290403681393217e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1111,   0,   0,   0, -1.768059597130111e-08, -2.334941737119106e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 13978,   0,   0,   0, +2.818001141451091e-08, -7.396304035373695e-09 },
-} },
-{   9,   2,   3, 192, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 13978,   0,   0,   0, +2.818001141451091e-08, -7.396304035373695e-09 }
+};
+
+static constexpr VSOP2013Term _l3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.940993166707158e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, -6.105543966139528e-05, -5.252817725916595e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, +3.538715555632108e-05, -6.073831660318774e-05 },
@@ -4890,9 +4919,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 113,   0,   0,   0, +9.407523813408132e-09, +2.519848783744781e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 432,   0,   0,   0, -1.314952715198205e-08, -2.312761212007422e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  67,   0,   0,   0, +2.593889730754303e-08, -5.371121721837206e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 460,   0,   0,   0, -2.625420740806750e-08, +3.508959041363519e-09 },
-} },
-{   9,   2,   4, 167, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 460,   0,   0,   0, -2.625420740806750e-08, +3.508959041363519e-09 }
+};
+
+static constexpr VSOP2013Term _l4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +8.609995915056679e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -3.207925178136485e-05, -5.354487203724191e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, -1.131432366268294e-05, +3.961594442524670e-06 },
@@ -5059,9 +5089,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 3923,   0,   0,   0, +9.969881142095080e-09, +1.794219035441153e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 321,   0,   0,   0, -9.067869623955397e-09, +4.404671275599207e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  19,   0,   0,   0, +9.127344835284597e-09, +4.176753241415455e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 737,   0,   0,   0, +3.617870216774481e-09, -9.252239963757261e-09 },
-} },
-{   9,   2,   5, 150, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 737,   0,   0,   0, +3.617870216774481e-09, -9.252239963757261e-09 }
+};
+
+static constexpr VSOP2013Term _l5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.279996740878934e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -8.232349616743976e-06, +1.019518360475307e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, +2.074169989516659e-06, +7.632519614812367e-08 },
@@ -5211,9 +5242,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  94,   0,   0,   0, +2.819414715082914e-09, -3.106410186528911e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1496,   0,   0,   0, -4.016634665590928e-09, +1.076374202603622e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  78,   0,   0,   0, -1.902058789119843e-09, -3.612882603548561e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 161,   0,   0,   0, -3.607427926044872e-09, -1.872878586115260e-09 },
-} },
-{   9,   2,   6, 129, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 161,   0,   0,   0, -3.607427926044872e-09, -1.872878586115260e-09 }
+};
+
+static constexpr VSOP2013Term _l6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.419959542661816e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, +1.106232064317550e-07, -4.854193242084329e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -2.216547704452634e-07, -5.536605914193796e-08 },
@@ -5342,9 +5374,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 600,   0,   0,   0, +1.301820099346243e-09, +3.609393755539807e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 392,   0,   0,   0, +7.649561240700822e-10, -1.101046450927824e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 354,   0,   0,   0, +1.099048665605435e-09, -7.394737526369761e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40,   0,   0,   0, -1.315686804239060e-09, +1.271344841146657e-10 },
-} },
-{   9,   2,   7,  85, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40,   0,   0,   0, -1.315686804239060e-09, +1.271344841146657e-10 }
+};
+
+static constexpr VSOP2013Term _l7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.350000000000000e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, -5.644130436339114e-08, -3.073758593784370e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0, -1.176999704291425e-08, +1.340443229778855e-08 },
@@ -5429,9 +5462,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 118,   0,   0,   0, -2.823933417892871e-10, +4.276897850581641e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33,   0,   0,   0, -2.463848371490472e-10, -4.197991910961110e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1425,   0,   0,   0, +3.238924001581848e-10, -3.420410526525079e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1386,   0,   0,   0, +2.947891048760854e-10, +3.628894240906126e-10 },
-} },
-{   9,   2,   8,  56, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1386,   0,   0,   0, +2.947891048760854e-10, +3.628894240906126e-10 }
+};
+
+static constexpr VSOP2013Term _l8[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.500000000000000e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, -6.978080137984634e-09, +1.080853906954379e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0, +5.601218969575727e-09, +4.629585223630497e-09 },
@@ -5487,9 +5521,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 400,   0,   0,   0, +8.019475666521499e-11, -1.729037627188945e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43,   0,   0,   0, +1.773759767261689e-10, +6.006208732879309e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 259,   0,   0,   0, +9.623270635722084e-11, -1.536124574830828e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 832,   0,   0,   0, -1.542329837018125e-10, -9.468795226083845e-11 },
-} },
-{   9,   2,   9,  41, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 832,   0,   0,   0, -1.542329837018125e-10, -9.468795226083845e-11 }
+};
+
+static constexpr VSOP2013Term _l9[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.088276300000000e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, -1.046147958243537e-09, +7.970296704894497e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0, -1.182361667587101e-11, +6.646114946606243e-10 },
@@ -5530,9 +5565,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 129,   0,   0,   0, -3.043371920892654e-11, +3.098733094614342e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  83,   0,   0,   0, -2.988593776783829e-11, +3.072875284359876e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  21,   0,   0,   0, +4.145741024272992e-11, -2.241468341758437e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 333,   0,   0,   0, +1.732565521818211e-11, -3.154156435168998e-11 },
-} },
-{   9,   2,  10,  39, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 333,   0,   0,   0, +1.732565521818211e-11, -3.154156435168998e-11 }
+};
+
+static constexpr VSOP2013Term _l10[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +2.324406300000000e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27,   0,   0,   0, -6.225839334770822e-11, -6.795202752975881e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23,   0,   0,   0, -6.625494849353949e-11, -6.310370079183212e-11 },
@@ -5571,9 +5607,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +4.400116106785223e-12, +7.446532341354225e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  36,   0,   0,   0, -7.987846599021501e-12, +1.253175112964120e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 117,   0,   0,   0, -6.729444205657288e-12, +4.283760106955230e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 333,   0,   0,   0, +6.425211237871529e-12, +2.805059126638902e-12 },
-} },
-{   9,   2,  11,  34, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 333,   0,   0,   0, +6.425211237871529e-12, +2.805059126638902e-12 }
+};
+
+static constexpr VSOP2013Term _l11[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +3.809481000000000e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23,   0,   0,   0, +1.121202579331091e-15, -9.272317995919647e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27,   0,   0,   0, +4.646193993698992e-12, -6.930023625413195e-12 },
@@ -5607,9 +5644,10 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  36,   0,   0,   0, -4.230276772002866e-13, -9.628659042089873e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  19,   0,   0,   0, +5.361480952304425e-13, -8.560875079117681e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 247,   0,   0,   0, +8.372753328334795e-13, +4.719596052498005e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 121,   0,   0,   0, -6.553073577958331e-13, +6.019968475772642e-13 },
-} },
-{   9,   2,  12,  18, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 121,   0,   0,   0, -6.553073577958331e-13, +6.019968475772642e-13 }
+};
+
+static constexpr VSOP2013Term _l12[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23,   0,   0,   0, +1.069512418342788e-12, +7.295966067188258e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27,   0,   0,   0, +8.571105021900933e-13, +7.148246632079032e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, +7.559118884289040e-13, -2.517241503743190e-14 },
@@ -5627,11 +5665,26 @@ static vector<VSOP2013Series> _l = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, +7.640745891778764e-14, -2.738327601605523e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,   0,   0,   0, -1.902159547108934e-14, +2.652280148397100e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43,   0,   0,   0, +2.425195463970962e-13, -3.912242909675535e-14 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24,   0,   0,   0, -1.658878890519275e-13, -1.078883222505657e-13 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24,   0,   0,   0, -1.658878890519275e-13, -1.078883222505657e-13 }
+};
+
+static constexpr VSOP2013Series _l[] = {
+{   9,   2,   0, 400, _l0 },
+{   9,   2,   1, 353, _l1 },
+{   9,   2,   2, 271, _l2 },
+{   9,   2,   3, 192, _l3 },
+{   9,   2,   4, 167, _l4 },
+{   9,   2,   5, 150, _l5 },
+{   9,   2,   6, 129, _l6 },
+{   9,   2,   7,  85, _l7 },
+{   9,   2,   8,  56, _l8 },
+{   9,   2,   9,  41, _l9 },
+{   9,   2,  10,  39, _l10 },
+{   9,   2,  11,  34, _l11 },
+{   9,   2,  12,  18, _l12 }
+};
 
-static vector<VSOP2013Series> _k = {
-{   9,   3,   0, 437, {
+static constexpr VSOP2013Term _k0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.787389594035000e-01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1473,   0,   0,   0, -2.098587029494208e-03, +3.162983274999299e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, +1.111351916394093e-03, -6.818035766386041e-04 },
@@ -6068,9 +6121,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1579,   0,   0,   0, +3.723610493200970e-08, +2.944866050628245e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 930,   0,   0,   0, -3.998074063727693e-09, +4.677014470911867e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2517,   0,   0,   0, +1.168907036816679e-08, -4.495105986025651e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 986,   0,   0,   0, -4.622601589500443e-08, +2.925341556077901e-09 },
-} },
-{   9,   3,   1, 372, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 986,   0,   0,   0, -4.622601589500443e-08, +2.925341556077901e-09 }
+};
+
+static constexpr VSOP2013Term _k1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.133966380200786e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -8.113312870171329e-05, +5.666411017231389e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1473,   0,   0,   0, -2.984312084406936e-04, -1.963280565417159e-04 },
@@ -6442,9 +6496,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 3825,   0,   0,   0, +3.797478918472639e-08, +2.261138722437273e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 899,   0,   0,   0, +3.848199628352026e-08, -2.172825092949518e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  19,   0,   0,   0, -4.367561556913122e-08, -2.117355083295535e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 6812,   0,   0,   0, +2.283883542756738e-08, -3.724498824276313e-08 },
-} },
-{   9,   3,   2, 288, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 6812,   0,   0,   0, +2.283883542756738e-08, -3.724498824276313e-08 }
+};
+
+static constexpr VSOP2013Term _k2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -1.411721704658303e-04, +2.382065795687565e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.716978431762315e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, -1.915312545581913e-05, +2.858465884370473e-05 },
@@ -6732,9 +6787,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2116,   0,   0,   0, +6.766903608114424e-09, -3.005114948627145e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 9291,   0,   0,   0, -2.954966488457255e-09, -3.065905776077462e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2643,   0,   0,   0, -1.682615405738459e-08, +2.561146902037262e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 162,   0,   0,   0, -2.984228489012627e-08, +5.962306616745779e-09 },
-} },
-{   9,   3,   3, 203, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 162,   0,   0,   0, -2.984228489012627e-08, +5.962306616745779e-09 }
+};
+
+static constexpr VSOP2013Term _k3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -1.670221441102829e-05, -2.874661643945582e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, -8.480516343040720e-06, -3.803477832595442e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1190,   0,   0,   0, -7.286488075790021e-06, -2.033719769859895e-06 },
@@ -6937,9 +6993,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 185,   0,   0,   0, +1.921640814665813e-08, -1.291646916913577e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 291,   0,   0,   0, +1.582399082012138e-08, -1.669341645416862e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 4348,   0,   0,   0, -4.949812185378624e-09, +2.239618701108800e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1280,   0,   0,   0, +2.063070325553530e-08, +9.118054969158972e-09 },
-} },
-{   9,   3,   4, 176, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1280,   0,   0,   0, +2.063070325553530e-08, +9.118054969158972e-09 }
+};
+
+static constexpr VSOP2013Term _k4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +4.646499728913186e-06, -4.538098944457739e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1190,   0,   0,   0, +1.905504854159212e-08, -1.665792521027051e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, +8.350054136004966e-07, -1.381329934234777e-06 },
@@ -7115,9 +7172,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 341,   0,   0,   0, -1.067297659377647e-08, -2.885822735939238e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1877,   0,   0,   0, +4.729002716493008e-09, -9.981228722336347e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2800,   0,   0,   0, +1.738421997508407e-10, -1.103081309599224e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 545,   0,   0,   0, +9.448250354379737e-09, -5.657354329736884e-09 },
-} },
-{   9,   3,   5, 159, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 545,   0,   0,   0, +9.448250354379737e-09, -5.657354329736884e-09 }
+};
+
+static constexpr VSOP2013Term _k5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +9.355643624071707e-07, +5.471167054787485e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, -2.896517923222750e-07, -2.665864579832488e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1190,   0,   0,   0, +3.576622015671125e-07, -1.410553617850020e-07 },
@@ -7276,9 +7334,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2238,   0,   0,   0, +2.121234910344437e-09, -3.207548551376585e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  47,   0,   0,   0, -3.370438107441689e-09, +1.799188569512463e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 377,   0,   0,   0, +2.692544338598484e-09, -2.697450610282960e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1523,   0,   0,   0, +3.703174448890220e-09, +3.840915411760693e-10 },
-} },
-{   9,   3,   6, 138, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1523,   0,   0,   0, +3.703174448890220e-09, +3.840915411760693e-10 }
+};
+
+static constexpr VSOP2013Term _k6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -6.268249774073898e-08, +1.694014617410006e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1119,   0,   0,   0, +4.594438169883999e-08, +6.246478467093921e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, -6.542643188651730e-08, +3.077290130133995e-08 },
@@ -7416,9 +7475,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1241,   0,   0,   0, -8.809647460901318e-10, +1.189074772684662e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1665,   0,   0,   0, +6.540597681531089e-10, +1.323546612497141e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  38,   0,   0,   0, +1.384110326088689e-09, +5.075456178167642e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  31,   0,   0,   0, -1.463152479756766e-09, +1.737969750644427e-10 },
-} },
-{   9,   3,   7,  93, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  31,   0,   0,   0, -1.463152479756766e-09, +1.737969750644427e-10 }
+};
+
+static constexpr VSOP2013Term _k7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -2.176921163223374e-08, -5.325126799824120e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1119,   0,   0,   0, -1.127214970623349e-08, +1.036513554105411e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, -9.739613478516342e-09, +1.068156310077636e-08 },
@@ -7511,9 +7571,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 177,   0,   0,   0, +3.421734253310079e-10, +2.982614671381686e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 741,   0,   0,   0, -3.648751573499879e-10, +2.562240886395343e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14,   0,   0,   0, -3.906837355262538e-10, -1.389358281448634e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 447,   0,   0,   0, -3.038290574434554e-10, +2.785733690596219e-10 },
-} },
-{   9,   3,   8,  58, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 447,   0,   0,   0, -3.038290574434554e-10, +2.785733690596219e-10 }
+};
+
+static constexpr VSOP2013Term _k8[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -2.780444715669367e-10, -3.349127100845908e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, -2.322497323620405e-09, -1.485244287517925e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, +1.668571958306532e-10, -2.745717742877556e-09 },
@@ -7571,9 +7632,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 620,   0,   0,   0, -1.299890097717845e-10, -1.673549658523409e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2592,   0,   0,   0, -1.393229318632639e-10, -1.587051504045754e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 400,   0,   0,   0, +1.719020370614553e-10, -9.805880643287203e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 337,   0,   0,   0, -1.875205404269500e-10, -5.424201607890445e-11 },
-} },
-{   9,   3,   9,  40, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 337,   0,   0,   0, -1.875205404269500e-10, -5.424201607890445e-11 }
+};
+
+static constexpr VSOP2013Term _k9[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, +2.193983437845387e-10, -3.808127304158351e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1119,   0,   0,   0, +2.228270805250781e-10, -3.039519261400385e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, -1.389459468746724e-10, -3.289956336673024e-10 },
@@ -7613,9 +7675,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 329,   0,   0,   0, +1.629674405158790e-11, +3.085875568802188e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11,   0,   0,   0, +3.225576264462394e-11, -1.168752228394435e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 354,   0,   0,   0, +1.797570799938985e-11, +2.811382959836029e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 129,   0,   0,   0, -3.100431408212844e-11, -1.030112689128875e-11 },
-} },
-{   9,   3,  10,  37, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 129,   0,   0,   0, -3.100431408212844e-11, -1.030112689128875e-11 }
+};
+
+static constexpr VSOP2013Term _k10[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, +5.689604347408685e-11, +2.666945662256998e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, -1.604902855265366e-11, +5.598156305079891e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, -2.620905965154162e-11, +4.625091148895958e-11 },
@@ -7652,9 +7715,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 333,   0,   0,   0, +3.625810943887196e-12, +5.972186117941182e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  63,   0,   0,   0, -2.374639859400183e-12, +6.559844405678794e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 192,   0,   0,   0, +3.223763679000116e-12, +6.098680746136746e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 836,   0,   0,   0, +6.811001725893508e-12, -6.342725155235903e-13 },
-} },
-{   9,   3,  11,  33, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 836,   0,   0,   0, +6.811001725893508e-12, -6.342725155235903e-13 }
+};
+
+static constexpr VSOP2013Term _k11[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, -2.860217372685952e-12, +6.705683420652048e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, +5.898208786269082e-12, +4.180220040149682e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -1.455289210505172e-12, +4.839685682432036e-12 },
@@ -7687,9 +7751,10 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, +3.658010690825921e-13, -6.871525799558368e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 121,   0,   0,   0, -7.406847574673586e-13, +2.388360999008224e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24,   0,   0,   0, +1.998149496034339e-13, -7.445963637863931e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 259,   0,   0,   0, +4.280768329955810e-13, +6.072887448873776e-13 },
-} },
-{   9,   3,  12,  18, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 259,   0,   0,   0, +4.280768329955810e-13, +6.072887448873776e-13 }
+};
+
+static constexpr VSOP2013Term _k12[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, +3.065049967476875e-13, -7.695391436047307e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, -6.812424571120241e-13, -2.653312003656161e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -5.489288318663534e-13, -1.995155578577254e-13 },
@@ -7707,11 +7772,26 @@ static vector<VSOP2013Series> _k = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  46,   0,   0,   0, +2.040421001002775e-13, +6.522364839092244e-14 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  20,   0,   0,   0, -1.240423269493366e-14, +1.960660696082638e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  27,   0,   0,   0, -5.537560271418976e-14, +1.845315399672409e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 239,   0,   0,   0, -1.171060341302193e-13, -7.550738186849974e-14 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 239,   0,   0,   0, -1.171060341302193e-13, -7.550738186849974e-14 }
+};
+
+static constexpr VSOP2013Series _k[] = {
+{   9,   3,   0, 437, _k0 },
+{   9,   3,   1, 372, _k1 },
+{   9,   3,   2, 288, _k2 },
+{   9,   3,   3, 203, _k3 },
+{   9,   3,   4, 176, _k4 },
+{   9,   3,   5, 159, _k5 },
+{   9,   3,   6, 138, _k6 },
+{   9,   3,   7,  93, _k7 },
+{   9,   3,   8,  58, _k8 },
+{   9,   3,   9,  40, _k9 },
+{   9,   3,  10,  37, _k10 },
+{   9,   3,  11,  33, _k11 },
+{   9,   3,  12,  18, _k12 }
+};
 
-static vector<VSOP2013Series> _h = {
-{   9,   4,   0, 438, {
+static constexpr VSOP2013Term _h0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.734047186423000e-01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1473,   0,   0,   0, +3.013005862133503e-03, +2.123481311507617e-03 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, -7.084964915268142e-04, -1.050549920035943e-03 },
@@ -8149,9 +8229,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, -8863,   0,   0,   0, +2.110899561900654e-08, -4.680613144845880e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 392,   0,   0,   0, +1.687436739509028e-08, -4.845523616058973e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 18878,   0,   0,   0, -1.340108183086739e-08, -4.904034298046474e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 3971,   0,   0,   0, +4.718492792764981e-08, +1.832592318734490e-08 },
-} },
-{   9,   4,   1, 374, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 3971,   0,   0,   0, +4.718492792764981e-08, +1.832592318734490e-08 }
+};
+
+static constexpr VSOP2013Term _h1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -5.684181411506680e-04, -6.004417493269490e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1473,   0,   0,   0, -1.989968311793417e-04, +2.829900111132881e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, -1.964554702960790e-04, +1.310984789234690e-04 },
@@ -8525,9 +8606,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 3825,   0,   0,   0, +2.274872433943364e-08, -3.684431795263444e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2187,   0,   0,   0, +2.330355892157752e-08, -3.624438167592846e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  95,   0,   0,   0, +1.012821019516576e-08, +4.174069691123192e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 162,   0,   0,   0, -3.501761570772513e-08, +2.477151559246408e-08 },
-} },
-{   9,   4,   2, 290, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 162,   0,   0,   0, -3.501761570772513e-08, +2.477151559246408e-08 }
+};
+
+static constexpr VSOP2013Term _h2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -2.900687987918155e-05, -1.399390080560118e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +6.782978361158025e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, -2.890887776673765e-05, -1.861244546671113e-05 },
@@ -8817,9 +8899,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 3782,   0,   0,   0, +2.323585527025846e-08, -2.110681218129270e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 162,   0,   0,   0, +5.794502822407191e-09, +3.084118076250064e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1138,   0,   0,   0, +3.004148102190701e-08, +8.937109668690169e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 879,   0,   0,   0, -1.492605547338281e-08, -2.740564366625508e-08 },
-} },
-{   9,   4,   3, 205, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 879,   0,   0,   0, -1.492605547338281e-08, -2.740564366625508e-08 }
+};
+
+static constexpr VSOP2013Term _h3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +2.805542033596687e-05, -1.773781603976750e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, +9.784118074917200e-06, -3.702807222111087e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, +3.646889836388085e-06, -8.542722062715846e-06 },
@@ -9024,9 +9107,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0,   0,   0, -1.822671265588924e-08, +1.862323742853110e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 216,   0,   0,   0, +2.555089195638047e-08, -1.871504683414431e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 463,   0,   0,   0, -2.396009078441605e-08, -8.084373971603786e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1335,   0,   0,   0, -1.042542405384006e-08, +2.298233679065168e-08 },
-} },
-{   9,   4,   4, 178, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1335,   0,   0,   0, -1.042542405384006e-08, +2.298233679065168e-08 }
+};
+
+static constexpr VSOP2013Term _h4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +4.702046343357606e-06, +4.465690302607280e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -2.747473700318895e-07, -2.868485598600014e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.250000000000000e-06 },
@@ -9204,9 +9288,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2238,   0,   0,   0, +6.042470259143883e-09, -1.027195913600739e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  31,   0,   0,   0, +3.481385897027798e-09, -1.137870262397085e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 808,   0,   0,   0, +8.755599116871702e-09, +7.971673417009221e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1877,   0,   0,   0, +1.137875085371036e-08, +1.783475150188298e-09 },
-} },
-{   9,   4,   5, 160, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1877,   0,   0,   0, +1.137875085371036e-08, +1.783475150188298e-09 }
+};
+
+static constexpr VSOP2013Term _h5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -5.106270373967709e-07, +9.542724510744843e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1190,   0,   0,   0, +1.452544406085824e-07, +3.559002708656619e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, -2.134734906076120e-07, +2.881476574307043e-07 },
@@ -9366,9 +9451,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1269,   0,   0,   0, -9.232948671191115e-10, -4.204397839237978e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 432,   0,   0,   0, +4.289189542289871e-09, +3.519657696901168e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 439,   0,   0,   0, -3.704580140194640e-09, +2.105004355680206e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 110,   0,   0,   0, -3.915048699337718e-09, -1.567224244309074e-09 },
-} },
-{   9,   4,   6, 142, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 110,   0,   0,   0, -3.915048699337718e-09, -1.567224244309074e-09 }
+};
+
+static constexpr VSOP2013Term _h6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -1.714643019249649e-07, -5.618157487923581e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1119,   0,   0,   0, -6.204199470961855e-08, +4.648434181002888e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1190,   0,   0,   0, -6.353249815797834e-08, +3.263993066923810e-08 },
@@ -9510,9 +9596,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 4206,   0,   0,   0, -1.204106993133618e-09, -1.016820192370508e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 930,   0,   0,   0, +1.386347840519030e-09, -7.485978347281316e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2309,   0,   0,   0, -4.277300463796820e-10, +1.473904594981944e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  38,   0,   0,   0, -8.540762332282209e-10, +1.271443841424414e-09 },
-} },
-{   9,   4,   7,  95, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  38,   0,   0,   0, -8.540762332282209e-10, +1.271443841424414e-09 }
+};
+
+static constexpr VSOP2013Term _h7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -2.979020341002848e-10, -2.176426702491188e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -1.910000000000000e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1119,   0,   0,   0, -1.045255649680627e-08, -1.117865568909355e-08 },
@@ -9607,9 +9694,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 325,   0,   0,   0, +1.029428262863454e-10, +4.993478647762458e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1178,   0,   0,   0, +4.869291507556261e-10, +1.139692949843384e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 745,   0,   0,   0, -3.353345354859288e-10, +3.693455547543953e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 196,   0,   0,   0, -4.516528192340381e-10, -1.832578521807718e-10 },
-} },
-{   9,   4,   8,  61, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 196,   0,   0,   0, -4.516528192340381e-10, -1.832578521807718e-10 }
+};
+
+static constexpr VSOP2013Term _h8[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -7.224327200000001e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +3.337825693995958e-09, -4.021504068376231e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, +1.467262589594536e-09, -2.332372148734596e-09 },
@@ -9670,9 +9758,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, +2.148158622947321e-10, +5.951593943128320e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  47,   0,   0,   0, +9.731355740758986e-11, +1.961059732364106e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 620,   0,   0,   0, +1.672416016936938e-10, -1.351427186449367e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 188,   0,   0,   0, +8.309811994191068e-11, +1.978997410026230e-10 },
-} },
-{   9,   4,   9,  44, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 188,   0,   0,   0, +8.309811994191068e-11, +1.978997410026230e-10 }
+};
+
+static constexpr VSOP2013Term _h9[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, +3.820586363565184e-10, +2.162202416806910e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1119,   0,   0,   0, +3.055052229716817e-10, +2.200997333187143e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, +3.266205110771509e-10, -1.444772026044796e-10 },
@@ -9716,9 +9805,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  52,   0,   0,   0, +1.076213866917477e-11, +3.689258177161950e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  67,   0,   0,   0, +3.388917570660342e-11, +1.780125970565114e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 154,   0,   0,   0, +8.849867096275690e-12, +3.655395538368860e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 329,   0,   0,   0, -3.060439134672743e-11, +2.003064965431544e-11 },
-} },
-{   9,   4,  10,  41, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 329,   0,   0,   0, -3.060439134672743e-11, +2.003064965431544e-11 }
+};
+
+static constexpr VSOP2013Term _h10[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.697158800000000e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, -2.620441372552067e-11, +5.707718322219242e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, -4.774647592652740e-11, +3.791502388021170e-11 },
@@ -9759,9 +9849,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 329,   0,   0,   0, -4.660262129743849e-12, -5.907045044239705e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 333,   0,   0,   0, -5.788582430988891e-12, +4.555307311762661e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 263,   0,   0,   0, -6.389940880381113e-12, +3.503360735782480e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 549,   0,   0,   0, -5.113051579953870e-12, +5.136910058134548e-12 },
-} },
-{   9,   4,  11,  36, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 549,   0,   0,   0, -5.113051579953870e-12, +5.136910058134548e-12 }
+};
+
+static constexpr VSOP2013Term _h11[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, -6.725411102898936e-12, -2.803370827378032e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, -4.080747912211266e-12, +5.968360520823629e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -4.885532590751592e-12, -1.306373128553607e-12 },
@@ -9797,9 +9888,10 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 549,   0,   0,   0, -6.442574933180715e-13, -5.839804361571385e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1248,   0,   0,   0, +1.241353685648894e-14, -7.988401771095773e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 263,   0,   0,   0, +3.746165288989320e-13, +6.963022775207896e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 259,   0,   0,   0, -6.490047035684770e-13, +4.441956557467526e-13 },
-} },
-{   9,   4,  12,  20, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 259,   0,   0,   0, -6.490047035684770e-13, +4.441956557467526e-13 }
+};
+
+static constexpr VSOP2013Term _h12[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, +7.749026277798695e-13, +2.935809082877855e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, +2.595550473411211e-13, -6.834205720083601e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, +5.126156509638166e-13, -3.332200735516616e-13 },
@@ -9819,11 +9911,26 @@ static vector<VSOP2013Series> _h = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  59,   0,   0,   0, -1.812218578482097e-13, -3.609240652025662e-15 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  63,   0,   0,   0, +1.640928679530585e-13, -5.262794524867083e-14 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  47,   0,   0,   0, +6.260644959373427e-14, +1.599105272328842e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23,   0,   0,   0, -7.255744811939863e-14, +1.528167091061871e-13 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23,   0,   0,   0, -7.255744811939863e-14, +1.528167091061871e-13 }
+};
+
+static constexpr VSOP2013Series _h[] = {
+{   9,   4,   0, 438, _h0 },
+{   9,   4,   1, 374, _h1 },
+{   9,   4,   2, 290, _h2 },
+{   9,   4,   3, 205, _h3 },
+{   9,   4,   4, 178, _h4 },
+{   9,   4,   5, 160, _h5 },
+{   9,   4,   6, 142, _h6 },
+{   9,   4,   7,  95, _h7 },
+{   9,   4,   8,  61, _h8 },
+{   9,   4,   9,  44, _h9 },
+{   9,   4,  10,  41, _h10 },
+{   9,   4,  11,  36, _h11 },
+{   9,   4,  12,  20, _h12 }
+};
 
-static vector<VSOP2013Series> _q = {
-{   9,   5,   0, 202, {
+static constexpr VSOP2013Term _q0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -5.170230782278001e-02 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +1.352378409982340e-04, -1.329678715738528e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, +5.592775542183944e-05, +1.630089964035264e-04 },
@@ -10025,9 +10132,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2710,   0,   0,   0, +1.372581327971716e-08, -3.340325681487794e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 758,   0,   0,   0, -1.851710238938581e-08, +3.073819273036743e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1465,   0,   0,   0, -4.085491524221964e-09, -3.488507920653055e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 432,   0,   0,   0, -2.883860917893558e-08, +1.963963730664173e-08 },
-} },
-{   9,   5,   1, 175, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 432,   0,   0,   0, -2.883860917893558e-08, +1.963963730664173e-08 }
+};
+
+static constexpr VSOP2013Term _q1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.916684404718321e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +3.867137881292379e-05, +3.901970138776549e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, -4.333249199258191e-05, +1.511920707996594e-05 },
@@ -10202,9 +10310,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 612,   0,   0,   0, -1.257862786361448e-08, +1.583270120205285e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 471,   0,   0,   0, -7.498620672484803e-09, +1.875270109597791e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 616,   0,   0,   0, -9.326973371560101e-09, +1.774610433433774e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1367,   0,   0,   0, +1.549332079631053e-08, +1.244062301066245e-08 },
-} },
-{   9,   5,   2, 135, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1367,   0,   0,   0, +1.549332079631053e-08, +1.244062301066245e-08 }
+};
+
+static constexpr VSOP2013Term _q2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, -3.241502639233553e-06, +8.107723975197160e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, +9.408295302429102e-07, -6.826175070633418e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -3.032000000000000e-06 },
@@ -10339,9 +10448,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 400,   0,   0,   0, -7.990880022044762e-09, +5.923621046400304e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1390,   0,   0,   0, -1.355024277547855e-09, +9.611253031770726e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 549,   0,   0,   0, +3.395552337398177e-09, +9.048244153546802e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2592,   0,   0,   0, +4.964389504655415e-09, +7.801303698531730e-09 },
-} },
-{   9,   5,   3,  84, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2592,   0,   0,   0, +4.964389504655415e-09, +7.801303698531730e-09 }
+};
+
+static constexpr VSOP2013Term _q3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, -1.515515499256919e-06, -1.132033830238533e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, +4.782562281020251e-07, +7.072251203267682e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -6.831173694305099e-07, +9.229811026279835e-08 },
@@ -10425,9 +10535,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1383,   0,   0,   0, -5.724445300606542e-09, -5.122466945429485e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 169,   0,   0,   0, -3.846049893686323e-10, -7.634299676437853e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 28478,   0,   0,   0, +7.390693733664390e-09, -1.476859883754379e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 271,   0,   0,   0, +4.713929664589512e-09, +5.359273211388363e-09 },
-} },
-{   9,   5,   4,  64, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 271,   0,   0,   0, +4.713929664589512e-09, +5.359273211388363e-09 }
+};
+
+static constexpr VSOP2013Term _q4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, -2.083866556849470e-08, -2.076797671328924e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, -1.443353976740160e-07, -3.371513314005818e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.460000000000000e-07 },
@@ -10491,9 +10602,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1756,   0,   0,   0, -2.404887705720251e-09, -1.016685758925357e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 452,   0,   0,   0, -2.419564155574890e-09, -9.386163171495085e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 137,   0,   0,   0, -2.519909417058276e-09, +3.510797031847962e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 17547,   0,   0,   0, -2.497974682380895e-09, -1.262304570660063e-10 },
-} },
-{   9,   5,   5,  51, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 17547,   0,   0,   0, -2.497974682380895e-09, -1.262304570660063e-10 }
+};
+
+static constexpr VSOP2013Term _q5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +2.789649233926744e-08, -5.830889232389956e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, +1.948645297441087e-08, -1.937260054351821e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -2.400000000000000e-08 },
@@ -10544,9 +10656,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 333,   0,   0,   0, +4.858179399098039e-10, -7.880293830629507e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 196,   0,   0,   0, -7.429356183692963e-10, -5.487241343850060e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  47,   0,   0,   0, -7.244921611674308e-10, -4.657501659439585e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 452,   0,   0,   0, +4.013480828385580e-10, -7.199786532429061e-10 },
-} },
-{   9,   5,   6,  40, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 452,   0,   0,   0, +4.013480828385580e-10, -7.199786532429061e-10 }
+};
+
+static constexpr VSOP2013Term _q6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, -2.344498718996893e-09, -4.097758637035172e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, -4.630411734377752e-09, -1.801685263625883e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, +2.775792540904584e-09, +2.603907952842714e-09 },
@@ -10586,9 +10699,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23,   0,   0,   0, -1.319979057096380e-10, -4.442157239910806e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1048,   0,   0,   0, +1.227822297442747e-10, +1.161472283496687e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 149,   0,   0,   0, +6.952732735590200e-11, +1.008825494965474e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 145,   0,   0,   0, -7.333285208652098e-11, +9.688468529048051e-11 },
-} },
-{   9,   5,   7,  23, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 145,   0,   0,   0, -7.333285208652098e-11, +9.688468529048051e-11 }
+};
+
+static constexpr VSOP2013Term _q7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, -6.206527883965693e-10, -5.958578455092320e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, -6.923387430933288e-10, +4.021375428749781e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.133549400000001e-10 },
@@ -10611,9 +10725,10 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1261,   0,   0,   0, +7.610017925238495e-11, +6.515010177427153e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11,   0,   0,   0, -8.733965936769547e-11, +1.771521705447576e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1190,   0,   0,   0, +3.066181420494889e-11, +8.116180975291450e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 106,   0,   0,   0, +9.309698418427972e-12, -8.483571417209483e-11 },
-} },
-{   9,   5,   8,  12, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 106,   0,   0,   0, +9.309698418427972e-12, -8.483571417209483e-11 }
+};
+
+static constexpr VSOP2013Term _q8[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, -1.717118064507344e-10, +6.871732506036133e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, +1.693037412087491e-10, +4.714057828541374e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0, +8.083062925944586e-11, -1.311044886132406e-10 },
@@ -10625,32 +10740,51 @@ static vector<VSOP2013Series> _q = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  55,   0,   0,   0, +2.912992895258120e-11, +6.592342861405271e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -6.613188993693456e-11, -2.369278803204494e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, -6.444830999999999e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,   0,   0,   0, -4.975486670151308e-11, +3.766521015416725e-11 },
-} },
-{   9,   5,   9,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,   0,   0,   0, -4.975486670151308e-11, +3.766521015416725e-11 }
+};
+
+static constexpr VSOP2013Term _q9[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, +5.675435712302135e-12, +3.109294456394986e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, -1.816108489379568e-11, -1.098245982022316e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, +8.725951434303717e-12, -6.157512738026673e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, -4.324068990423696e-12, -9.602700564295756e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, +9.090442343923767e-12, +4.994656959530863e-12 },
-} },
-{   9,   5,  10,   4, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, +9.090442343923767e-12, +4.994656959530863e-12 }
+};
+
+static constexpr VSOP2013Term _q10[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, +5.621351164033393e-12, -3.197144880059724e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, -4.451320269957853e-12, -7.755874406025035e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -2.258515093401510e-12, -2.667221621576157e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0, -1.992261377650395e-12, +2.740386741394909e-12 },
-} },
-{   9,   5,  11,   3, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0, -1.992261377650395e-12, +2.740386741394909e-12 }
+};
+
+static constexpr VSOP2013Term _q11[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, +4.239646615283239e-13, +5.380320835684567e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, +2.062889787088972e-13, -5.629591302740039e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, +1.736666526935563e-13, +2.420981086684564e-13 },
-} },
-{   9,   5,  12,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, -8.842052955936239e-14, +5.470570885624902e-14 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, +1.736666526935563e-13, +2.420981086684564e-13 }
+};
+
+static constexpr VSOP2013Term _q12[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, -8.842052955936239e-14, +5.470570885624902e-14 }
+};
+
+static constexpr VSOP2013Series _q[] = {
+{   9,   5,   0, 202, _q0 },
+{   9,   5,   1, 175, _q1 },
+{   9,   5,   2, 135, _q2 },
+{   9,   5,   3,  84, _q3 },
+{   9,   5,   4,  64, _q4 },
+{   9,   5,   5,  51, _q5 },
+{   9,   5,   6,  40, _q6 },
+{   9,   5,   7,  23, _q7 },
+{   9,   5,   8,  12, _q8 },
+{   9,   5,   9,   5, _q9 },
+{   9,   5,  10,   4, _q10 },
+{   9,   5,  11,   3, _q11 },
+{   9,   5,  12,   1, _q12 }
+};
 
-static vector<VSOP2013Series> _p = {
-{   9,   6,   0, 205, {
+static constexpr VSOP2013Term _p0[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +1.397799251564000e-01 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +1.347115643369476e-04, +1.288320057237236e-04 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, +1.618089604229282e-04, -4.997931009887912e-05 },
@@ -10855,9 +10989,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 3228,   0,   0,   0, +2.706748212623028e-08, +2.765384978006149e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1897,   0,   0,   0, +2.150107344605678e-08, +3.077775711275683e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2569,   0,   0,   0, -3.130626021993230e-09, -3.739354373822564e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2282,   0,   0,   0, -3.306926176958210e-08, -1.726792433622177e-08 },
-} },
-{   9,   6,   1, 183, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2282,   0,   0,   0, -3.306926176958210e-08, -1.726792433622177e-08 }
+};
+
+static constexpr VSOP2013Term _p1[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +7.799329701590763e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, -3.717248673647571e-05, +3.915268715031018e-05 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, +1.351790614126020e-05, +4.303113637575824e-05 },
@@ -11040,9 +11175,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 616,   0,   0,   0, -8.670682643274659e-09, +1.663780916009654e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 762,   0,   0,   0, +5.275683357466990e-09, +1.764857269139168e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1425,   0,   0,   0, +2.864632153925450e-09, -1.797599652992824e-08 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1469,   0,   0,   0, +1.796748681372132e-08, -2.253662871744134e-09 },
-} },
-{   9,   6,   2, 145, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1469,   0,   0,   0, +1.796748681372132e-08, -2.253662871744134e-09 }
+};
+
+static constexpr VSOP2013Term _p2[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, -8.059804913654822e-06, -2.941250048450964e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, -6.680043191370353e-06, -1.136997519833506e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -2.845611856658894e-06, -5.656496765527527e-07 },
@@ -11187,9 +11323,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  42,   0,   0,   0, +2.585041182401812e-11, -9.467356510955404e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1186,   0,   0,   0, +3.891334247979662e-09, +8.510144996638495e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 5820,   0,   0,   0, +3.371336046440448e-11, -9.164655664967406e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 158,   0,   0,   0, +6.444126160980673e-09, -6.454895101797450e-09 },
-} },
-{   9,   6,   3,  94, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 158,   0,   0,   0, +6.444126160980673e-09, -6.454895101797450e-09 }
+};
+
+static constexpr VSOP2013Term _p3[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +6.564129671319171e-08, -1.492021484458266e-06 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, +7.102278852698229e-07, -4.489118594738236e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1331,   0,   0,   0, -1.072310289783124e-07, -6.696255224305637e-07 },
@@ -11283,9 +11420,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 28478,   0,   0,   0, -1.226746302530638e-09, -7.303008718846811e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 117,   0,   0,   0, +6.173211102718881e-10, -7.223297628006763e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14,   0,   0,   0, -5.481639145892814e-09, -4.273217490523802e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 263,   0,   0,   0, -6.166022626287076e-09, -3.091210327298735e-09 },
-} },
-{   9,   6,   4,  74, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 263,   0,   0,   0, -6.166022626287076e-09, -3.091210327298735e-09 }
+};
+
+static constexpr VSOP2013Term _p4[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -9.990290688570181e-08, +2.108749987744002e-07 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +2.033964988819603e-07, -2.673969645707911e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, -3.744036873436665e-08, +1.409015351427665e-07 },
@@ -11359,9 +11497,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 17547,   0,   0,   0, -1.998371278972735e-10, +2.449494667820377e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1044,   0,   0,   0, +2.057817392021471e-09, -9.944412580364397e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 400,   0,   0,   0, +2.206063670326380e-09, -3.225407586031556e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 149,   0,   0,   0, +2.178924284083762e-09, -4.462137367400789e-10 },
-} },
-{   9,   6,   5,  61, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 149,   0,   0,   0, +2.178924284083762e-09, -4.462137367400789e-10 }
+};
+
+static constexpr VSOP2013Term _p5[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, +5.505850640890206e-08, +3.438571906234127e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1402,   0,   0,   0, +6.578281078114332e-09, +2.723007373390242e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0, -1.068956926796620e-08, -2.368825332660975e-08 },
@@ -11422,9 +11561,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  52,   0,   0,   0, -9.862357987736975e-10, +4.986275997593769e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1394,   0,   0,   0, +1.037363886040785e-09, -2.907817164347648e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 117,   0,   0,   0, +3.102218793007036e-10, +1.011105707281138e-09 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43,   0,   0,   0, -8.123866645716243e-10, -6.260640552963404e-10 },
-} },
-{   9,   6,   6,  48, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  43,   0,   0,   0, -8.123866645716243e-10, -6.260640552963404e-10 }
+};
+
+static constexpr VSOP2013Term _p6[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, +7.630482141578999e-09, -1.211607243189061e-08 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, -1.188203936255973e-09, +5.860868394150241e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, +0.000000000000000e+00, +5.447045299999999e-09 },
@@ -11472,9 +11612,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 154,   0,   0,   0, +1.091753780781080e-11, +1.537066751453199e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 149,   0,   0,   0, +1.376618361293677e-10, -5.914623643591829e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 2733,   0,   0,   0, -1.061714883068493e-10, +9.656836145895240e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 283,   0,   0,   0, +2.742417912813991e-11, -1.218210354953320e-10 },
-} },
-{   9,   6,   7,  27, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 283,   0,   0,   0, +2.742417912813991e-11, -1.218210354953320e-10 }
+};
+
+static constexpr VSOP2013Term _p7[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -2.193759779728754e-09, -1.758864086228889e-09 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, -6.020919864930200e-10, +5.916703446574237e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, +7.259709840374012e-10, +1.594786544081456e-10 },
@@ -11501,9 +11642,10 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14,   0,   0,   0, -1.349987147792687e-10, -7.967301073081054e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,   0,   0,   0, +1.594617575713558e-11, -1.509128332541878e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 212,   0,   0,   0, -2.724259846344214e-11, -1.444770801185242e-10 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  17,   0,   0,   0, +1.150790833374482e-10, -8.196369368031935e-11 },
-} },
-{   9,   6,   8,  14, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  17,   0,   0,   0, +1.150790833374482e-10, -8.196369368031935e-11 }
+};
+
+static constexpr VSOP2013Term _p8[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -1.710555042278888e-10, +3.714954453044622e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, +1.061117848252182e-10, -2.065508194380964e-10 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0, -1.131948432353032e-10, -9.894462823541677e-11 },
@@ -11517,61 +11659,89 @@ static vector<VSOP2013Series> _p = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11,   0,   0,   0, +6.303251986380268e-11, +4.015736983053639e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,   0,   0,   0, -5.226597095865151e-11, -2.626965596598455e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24,   0,   0,   0, +1.900584057483858e-11, +4.719785895834954e-11 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  55,   0,   0,   0, -4.315749954218881e-11, +2.560819713851861e-11 },
-} },
-{   9,   6,   9,   7, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  55,   0,   0,   0, -4.315749954218881e-11, +2.560819713851861e-11 }
+};
+
+static constexpr VSOP2013Term _p9[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, +4.239334879665201e-11, +3.567699951394289e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, +3.063920441623609e-11, -4.616884174090274e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, -2.477658606557658e-11, +1.384870801281760e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, -6.991390776149556e-12, -1.373092414113509e-11 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11,   0,   0,   0, +1.092940232333531e-11, -5.263105630332745e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0, +9.586173552107495e-12, +6.397998966141165e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  19,   0,   0,   0, -2.868161846375799e-12, +9.276854635064505e-12 },
-} },
-{   9,   6,  10,   6, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  19,   0,   0,   0, -2.868161846375799e-12, +9.276854635064505e-12 }
+};
+
+static constexpr VSOP2013Term _p10[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, +3.358006697131377e-13, -6.007532467410881e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, +4.419922808896802e-13, -5.061888784809272e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,   0,   0,   0, -2.665868972962513e-12, +3.571972835982285e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, -9.000700495239484e-13, +4.339952693070340e-12 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0, +1.407663278357751e-12, +2.629282644718352e-12 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  20,   0,   0,   0, +2.470703174905616e-12, -1.450802260396728e-12 },
-} },
-{   9,   6,  11,   5, {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  20,   0,   0,   0, +2.470703174905616e-12, -1.450802260396728e-12 }
+};
+
+static constexpr VSOP2013Term _p11[] = {
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, +6.358646433721144e-13, -5.251600735025837e-14 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 1543,   0,   0,   0, -5.455336407240302e-13, -2.203117792353767e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0, -3.034423789804905e-13, -2.780976149192621e-13 },
 {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  71,   0,   0,   0, +2.501654580807034e-13, +2.124859042941476e-13 },
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,   0,   0,   0, +8.007241730511695e-14, -2.052076037475169e-13 },
-} },
-{   9,   6,  12,   1, {
-{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, -1.483264636400123e-14, +8.254633018030792e-14 },
-} } };
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,   0,   0,   0, +8.007241730511695e-14, -2.052076037475169e-13 }
+};
+
+static constexpr VSOP2013Term _p12[] = {
+{   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,   0,   0,   0, -1.483264636400123e-14, +8.254633018030792e-14 }
+};
 
+static constexpr VSOP2013Series _p[] = {
+{   9,   6,   0, 205, _p0 },
+{   9,   6,   1, 183, _p1 },
+{   9,   6,   2, 145, _p2 },
+{   9,   6,   3,  94, _p3 },
+{   9,   6,   4,  74, _p4 },
+{   9,   6,   5,  61, _p5 },
+{   9,   6,   6,  48, _p6 },
+{   9,   6,   7,  27, _p7 },
+{   9,   6,   8,  14, _p8 },
+{   9,   6,   9,   7, _p9 },
+{   9,   6,  10,   6, _p10 },
+{   9,   6,  11,   5, _p11 },
+{   9,   6,  12,   1, _p12 }
+};
+
+
+vector<VSOP2013PackedSeries> VSOP2013::plutoPackedSeries ( void )
+{
+    return packSeries ( { _a, _l, _k, _h, _q, _p } );
+}
 
 SSOrbit VSOP2013::plutoOrbit ( double jed )
 {
+    if ( usePackedSeries() )
+        return getOrbit ( 9, jed, getPackedSeries ( 9 ) );
+    
     double a = 0.0, l = 0.0, k = 0.0, h = 0.0, q = 0.0, p = 0.0;
     double t = ( jed - 2451545.0 ) / 365250.0;
     double ll[17] = { 0 };
     
     evalLongitudes ( t, ll );
 
-    for ( VSOP2013Series &series : _a )
+    for ( const VSOP2013Series &series : _a )
         a += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _l )
+    for ( const VSOP2013Series &series : _l )
         l += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _k )
+    for ( const VSOP2013Series &series : _k )
         k += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _h )
+    for ( const VSOP2013Series &series : _h )
         h += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _q )
+    for ( const VSOP2013Series &series : _q )
         q += evalSeries ( t, series, ll );
     
-    for ( VSOP2013Series &series : _p )
+    for ( const VSOP2013Series &series : _p )
         p += evalSeries ( t, series, ll );
 
     double e = sqrt ( k * k + h * h );  // eccentricity
@@ -0,0 +1,29 @@
+package com.southernstars.sscore;
+
+import com.southernstars.sscore.JSSInstrumentStats;
+
+// This class reads SSCore's hot-path instrumentation: call counts, timings, and cache hit rates
+// of HTM region loading, SSCoordinates.setTime(), series evaluation, projection, and ephemeris caches.
+// Statistics are all zero unless the native library is compiled with USE_INSTRUMENTS=1.
+
+public class JSSInstrument
+{
+    public static final int kInstrumentHTMLoad = 0;
+    public static final int kInstrumentHTMRegion = 1;
+    public static final int kInstrumentSetTime = 2;
+    public static final int kInstrumentVSOP = 3;
+    public static final int kInstrumentELP = 4;
+    public static final int kInstrumentProject = 5;
+    public static final int kInstrumentJPLDERecord = 6;
+    public static final int kInstrumentChebyshev = 7;
+    public static final int kNumInstruments = 8;
+
+    // Returns true if instrumentation is compiled into the native library.
+
+    public static native boolean enabled();
+
+    // Returns current statistics of one subsystem, or null if id is invalid; zeroes statistics of all subsystems.
+
+    public static native JSSInstrumentStats snapshot ( int id );
+    public static native void reset();
+}
@@ -0,0 +1,13 @@
+package com.southernstars.sscore;
+
+// Statistics of one instrumented SSCore subsystem, from JSSInstrument.snapshot().
+
+public class JSSInstrumentStats
+{
+    public String name;         // subsystem name, e.g. "htm.load"
+    public long calls;          // number of timed calls
+    public double seconds;      // cumulative time of all calls
+    public double maxSeconds;   // time of slowest call
+    public long histogram[];    // calls taking < 1 us, < 10 us, < 100 us, < 1 ms, < 10 ms, < 100 ms, >= 100 ms
+    public long hits, misses;   // cache hits and misses
+}
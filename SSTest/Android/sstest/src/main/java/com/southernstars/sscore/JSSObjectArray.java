@@ -1,7 +1,11 @@
 package com.southernstars.sscore;
 
 import android.content.res.AssetManager;
+import java.nio.FloatBuffer;
+import java.nio.IntBuffer;
+import java.nio.LongBuffer;
 import com.southernstars.sscore.JSSObject;
+import com.southernstars.sscore.JSSCoordinates;
 
 public class JSSObjectArray
 {
@@ -26,5 +30,17 @@ public class JSSObjectArray
     public native int importFromTLE ( String path );
     public native int importMcNames ( String path );
 
+    // Computes apparent directions, distances, and magnitudes of all objects in the array at once, in parallel.
+
+    public native void computeEphemeris ( JSSCoordinates coords );
+
+    // Copies columns of (count) objects from index (start) into direct buffers in one native call, without creating
+    // a JSSObject per object: unit direction vectors (3 floats per object), magnitudes, object type codes, and
+    // identifiers in a catalog (0 = first identifier) as 64-bit SSIdentifier codes. Pass null for any column not
+    // wanted. Buffers must be direct, in native byte order, e.g. ByteBuffer.allocateDirect(n).order(ByteOrder.nativeOrder()).asFloatBuffer().
+    // Returns number of objects copied, which is limited by the array's size and each buffer's capacity.
+
+    public native int getColumns ( int start, int count, FloatBuffer directions, FloatBuffer magnitudes, IntBuffer types, LongBuffer idents, int catalog );
+
     public static native boolean initAssetManager ( AssetManager mgr );
 }
@@ -0,0 +1,59 @@
+#include "com_southernstars_sscore_JSSInstrument.h"
+#include "JNIUtilities.h"
+#include "SSInstrument.hpp"
+
+/*
+ * Class:     com_southernstars_sscore_JSSInstrument
+ * Method:    enabled
+ * Signature: ()Z
+ */
+
+JNIEXPORT jboolean JNICALL Java_com_southernstars_sscore_JSSInstrument_enabled ( JNIEnv *pEnv, jclass pClass )
+{
+    return SSInstrument::enabled();
+}
+
+/*
+ * Class:     com_southernstars_sscore_JSSInstrument
+ * Method:    snapshot
+ * Signature: (I)Lcom/southernstars/sscore/JSSInstrumentStats;
+ */
+
+JNIEXPORT jobject JNICALL Java_com_southernstars_sscore_JSSInstrument_snapshot ( JNIEnv *pEnv, jclass pClass, jint id )
+{
+    if ( id < 0 || id >= kNumInstruments )
+        return nullptr;
+
+    SSInstrumentStats stats = SSInstrument::snapshot ( (SSInstrumentID) id );
+    jobject pJStats = CreateJObject ( pEnv, "com/southernstars/sscore/JSSInstrumentStats" );
+    if ( pJStats == nullptr )
+        return nullptr;
+
+    jlong histogram[SSInstrumentStats::kNumBuckets];
+    for ( int i = 0; i < SSInstrumentStats::kNumBuckets; i++ )
+        histogram[i] = stats.histogram[i];
+
+    jlongArray pJHistogram = pEnv->NewLongArray ( SSInstrumentStats::kNumBuckets );
+    if ( pJHistogram != nullptr )
+        pEnv->SetLongArrayRegion ( pJHistogram, 0, SSInstrumentStats::kNumBuckets, histogram );
+
+    SetObjectField ( pEnv, pJStats, "name", "Ljava/lang/String;", pEnv->NewStringUTF ( stats.name.c_str() ) );
+    SetLongField ( pEnv, pJStats, "calls", stats.calls );
+    SetDoubleField ( pEnv, pJStats, "seconds", stats.seconds );
+    SetDoubleField ( pEnv, pJStats, "maxSeconds", stats.maxSeconds );
+    SetObjectField ( pEnv, pJStats, "histogram", "[J", pJHistogram );
+    SetLongField ( pEnv, pJStats, "hits", stats.hits );
+    SetLongField ( pEnv, pJStats, "misses", stats.misses );
+    return pJStats;
+}
+
+/*
+ * Class:     com_southernstars_sscore_JSSInstrument
+ * Method:    reset
+ * Signature: ()V
+ */
+
+JNIEXPORT void JNICALL Java_com_southernstars_sscore_JSSInstrument_reset ( JNIEnv *pEnv, jclass pClass )
+{
+    SSInstrument::reset();
+}
@@ -0,0 +1,55 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class com_southernstars_sscore_JSSInstrument */
+
+#ifndef _Included_com_southernstars_sscore_JSSInstrument
+#define _Included_com_southernstars_sscore_JSSInstrument
+#ifdef __cplusplus
+extern "C" {
+#endif
+#undef com_southernstars_sscore_JSSInstrument_kInstrumentHTMLoad
+#define com_southernstars_sscore_JSSInstrument_kInstrumentHTMLoad 0L
+#undef com_southernstars_sscore_JSSInstrument_kInstrumentHTMRegion
+#define com_southernstars_sscore_JSSInstrument_kInstrumentHTMRegion 1L
+#undef com_southernstars_sscore_JSSInstrument_kInstrumentSetTime
+#define com_southernstars_sscore_JSSInstrument_kInstrumentSetTime 2L
+#undef com_southernstars_sscore_JSSInstrument_kInstrumentVSOP
+#define com_southernstars_sscore_JSSInstrument_kInstrumentVSOP 3L
+#undef com_southernstars_sscore_JSSInstrument_kInstrumentELP
+#define com_southernstars_sscore_JSSInstrument_kInstrumentELP 4L
+#undef com_southernstars_sscore_JSSInstrument_kInstrumentProject
+#define com_southernstars_sscore_JSSInstrument_kInstrumentProject 5L
+#undef com_southernstars_sscore_JSSInstrument_kInstrumentJPLDERecord
+#define com_southernstars_sscore_JSSInstrument_kInstrumentJPLDERecord 6L
+#undef com_southernstars_sscore_JSSInstrument_kInstrumentChebyshev
+#define com_southernstars_sscore_JSSInstrument_kInstrumentChebyshev 7L
+#undef com_southernstars_sscore_JSSInstrument_kNumInstruments
+#define com_southernstars_sscore_JSSInstrument_kNumInstruments 8L
+/*
+ * Class:     com_southernstars_sscore_JSSInstrument
+ * Method:    enabled
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_southernstars_sscore_JSSInstrument_enabled
+  (JNIEnv *, jclass);
+
+/*
+ * Class:     com_southernstars_sscore_JSSInstrument
+ * Method:    snapshot
+ * Signature: (I)Lcom/southernstars/sscore/JSSInstrumentStats;
+ */
+JNIEXPORT jobject JNICALL Java_com_southernstars_sscore_JSSInstrument_snapshot
+  (JNIEnv *, jclass, jint);
+
+/*
+ * Class:     com_southernstars_sscore_JSSInstrument
+ * Method:    reset
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_southernstars_sscore_JSSInstrument_reset
+  (JNIEnv *, jclass);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -2,6 +2,7 @@
 #include "JNIUtilities.h"
 #include "SSObject.hpp"
 #include "SSPlanet.hpp"
+#include "SSCoordinates.hpp"
 
 /*
  * Class:     com_southernstars_sscore_JSSObjectArray
@@ -112,6 +113,84 @@ JNIEXPORT jint JNICALL Java_com_southernstars_sscore_JSSObjectArray_importMcName
     return n;
 }
 
+/*
+ * Class:     com_southernstars_sscore_JSSObjectArray
+ * Method:    computeEphemeris
+ * Signature: (Lcom/southernstars/sscore/JSSCoordinates;)V
+ */
+
+JNIEXPORT void JNICALL Java_com_southernstars_sscore_JSSObjectArray_computeEphemeris ( JNIEnv *pEnv, jobject pJObjectArray, jobject pJCoords )
+{
+    SSObjectVec *pObjectVec = (SSObjectVec *) GetLongField ( pEnv, pJObjectArray, "pObjectVec" );
+    SSCoordinates *pCoords = (SSCoordinates *) GetLongField ( pEnv, pJCoords, "pCoords" );
+    if ( pObjectVec && pCoords )
+        pObjectVec->computeEphemeris ( *pCoords );
+}
+
+// Returns address of a direct java.nio buffer (pJBuffer), and its capacity in elements in (capacity);
+// or nullptr if the buffer is null or not direct.
+
+static void *GetDirectBuffer ( JNIEnv *pEnv, jobject pJBuffer, jlong &capacity )
+{
+    void *pBuffer = pJBuffer ? pEnv->GetDirectBufferAddress ( pJBuffer ) : nullptr;
+    capacity = pBuffer ? pEnv->GetDirectBufferCapacity ( pJBuffer ) : 0;
+    return pBuffer;
+}
+
+/*
+ * Class:     com_southernstars_sscore_JSSObjectArray
+ * Method:    getColumns
+ * Signature: (IILjava/nio/FloatBuffer;Ljava/nio/FloatBuffer;Ljava/nio/IntBuffer;Ljava/nio/LongBuffer;I)I
+ */
+
+JNIEXPORT jint JNICALL Java_com_southernstars_sscore_JSSObjectArray_getColumns ( JNIEnv *pEnv, jobject pJObjectArray, jint start, jint count, jobject pJDirections, jobject pJMagnitudes, jobject pJTypes, jobject pJIdents, jint catalog )
+{
+    SSObjectVec *pObjectVec = (SSObjectVec *) GetLongField ( pEnv, pJObjectArray, "pObjectVec" );
+    if ( pObjectVec == nullptr || start < 0 || count < 0 || start >= pObjectVec->size() )
+        return 0;
+
+    jlong dirCap = 0, magCap = 0, typeCap = 0, identCap = 0;
+    jfloat *pDirs = (jfloat *) GetDirectBuffer ( pEnv, pJDirections, dirCap );
+    jfloat *pMags = (jfloat *) GetDirectBuffer ( pEnv, pJMagnitudes, magCap );
+    jint *pTypes = (jint *) GetDirectBuffer ( pEnv, pJTypes, typeCap );
+    jlong *pIdents = (jlong *) GetDirectBuffer ( pEnv, pJIdents, identCap );
+
+    // Copy no more objects than the array holds, or than fit in any buffer given.
+
+    jlong n = min ( (jlong) count, (jlong) pObjectVec->size() - start );
+    if ( pDirs )
+        n = min ( n, dirCap / 3 );
+    if ( pMags )
+        n = min ( n, magCap );
+    if ( pTypes )
+        n = min ( n, typeCap );
+    if ( pIdents )
+        n = min ( n, identCap );
+
+    for ( jlong i = 0; i < n; i++ )
+    {
+        SSObject *pObject = pObjectVec->get ( start + i );
+        if ( pDirs )
+        {
+            SSVector dir = pObject->getDirection();
+            pDirs[i * 3] = dir.x;
+            pDirs[i * 3 + 1] = dir.y;
+            pDirs[i * 3 + 2] = dir.z;
+        }
+
+        if ( pMags )
+            pMags[i] = pObject->getMagnitude();
+
+        if ( pTypes )
+            pTypes[i] = pObject->getType();
+
+        if ( pIdents )
+            pIdents[i] = catalog == kCatUnknown ? pObject->getIdentifier ( 0 ) : pObject->getIdentifier ( (SSCatalog) catalog );
+    }
+
+    return (jint) n;
+}
+
 /*
  * Class:     com_southernstars_sscore_JSSObjectArray
  * Method:    initAssetManager
@@ -71,6 +71,22 @@ JNIEXPORT jint JNICALL Java_com_southernstars_sscore_JSSObjectArray_importFromTL
 JNIEXPORT jint JNICALL Java_com_southernstars_sscore_JSSObjectArray_importMcNames
   (JNIEnv *, jobject, jstring);
 
+/*
+ * Class:     com_southernstars_sscore_JSSObjectArray
+ * Method:    computeEphemeris
+ * Signature: (Lcom/southernstars/sscore/JSSCoordinates;)V
+ */
+JNIEXPORT void JNICALL Java_com_southernstars_sscore_JSSObjectArray_computeEphemeris
+  (JNIEnv *, jobject, jobject);
+
+/*
+ * Class:     com_southernstars_sscore_JSSObjectArray
+ * Method:    getColumns
+ * Signature: (IILjava/nio/FloatBuffer;Ljava/nio/FloatBuffer;Ljava/nio/IntBuffer;Ljava/nio/LongBuffer;I)I
+ */
+JNIEXPORT jint JNICALL Java_com_southernstars_sscore_JSSObjectArray_getColumns
+  (JNIEnv *, jobject, jint, jint, jobject, jobject, jobject, jobject, jint);
+
 /*
  * Class:     com_southernstars_sscore_JSSObjectArray
  * Method:    initAssetManager
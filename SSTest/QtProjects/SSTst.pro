@@ -45,10 +45,30 @@ $$SSCoreDIR/SSTest/Android/sstest/src/main/cpp
 HEADERS += \
     $$SSCoreDIR/SSCode/VSOP2013/ELPMPP02.hpp \
     $$SSCoreDIR/SSCode/VSOP2013/VSOP2013.hpp \
+    $$SSCoreDIR/SSCode/SSAlmanac.hpp \
     $$SSCoreDIR/SSCode/SSAngle.hpp \
+    $$SSCoreDIR/SSCode/SSAsync.hpp \
+    $$SSCoreDIR/SSCode/SSBinaryCatalog.hpp \
+    $$SSCoreDIR/SSCode/SSCatalogBuild.hpp \
+    $$SSCoreDIR/SSCode/SSChebyshevCache.hpp \
+    $$SSCoreDIR/SSCode/SSChebyshevEphemeris.hpp \
+    $$SSCoreDIR/SSCode/SSCityIndex.hpp \
+    $$SSCoreDIR/SSCode/SSCompactStarTable.hpp \
     $$SSCoreDIR/SSCode/SSConstellation.hpp \
     $$SSCoreDIR/SSCode/SSCoordinates.hpp \
+    $$SSCoreDIR/SSCode/SSCrossMatch.hpp \
+    $$SSCoreDIR/SSCode/SSDeepSkyIndex.hpp \
+    $$SSCoreDIR/SSCode/SSEclipse.hpp \
+    $$SSCoreDIR/SSCode/SSEphemerisContext.hpp \
+    $$SSCoreDIR/SSCode/SSEphemerisPolicy.hpp \
+    $$SSCoreDIR/SSCode/SSEphemerisPrefetch.hpp \
+    $$SSCoreDIR/SSCode/SSEphemerisSnapshot.hpp \
+    $$SSCoreDIR/SSCode/SSEphemerisTable.hpp \
     $$SSCoreDIR/SSCode/SSEvent.hpp \
+    $$SSCoreDIR/SSCode/SSEventCache.hpp \
+    $$SSCoreDIR/SSCode/SSFlatMap.hpp \
+    $$SSCoreDIR/SSCode/SSGroundTrack.hpp \
+    $$SSCoreDIR/SSCode/SSGzip.hpp \
     $$SSCoreDIR/SSCode/SSHTM.hpp \
     $$SSCoreDIR/SSCode/SSIdentifier.hpp \
     $$SSCoreDIR/SSCode/SSImportGJ.hpp \
@@ -56,19 +76,30 @@ HEADERS += \
     $$SSCoreDIR/SSCode/SSImportMPC.hpp \
     $$SSCoreDIR/SSCode/SSImportNGCIC.hpp \
     $$SSCoreDIR/SSCode/SSImportSKY2000.hpp \
+    $$SSCoreDIR/SSCode/SSInstrument.hpp \
     $$SSCoreDIR/SSCode/SSJPLDEphemeris.hpp \
+    $$SSCoreDIR/SSCode/SSKeyframeEphemeris.hpp \
+    $$SSCoreDIR/SSCode/SSLazyEphemeris.hpp \
     $$SSCoreDIR/SSCode/SSMatrix.hpp \
+    $$SSCoreDIR/SSCode/SSMinorPlanetTable.hpp \
     $$SSCoreDIR/SSCode/SSMoonEphemeris.hpp \
     $$SSCoreDIR/SSCode/SSObject.hpp \
+    $$SSCoreDIR/SSCode/SSOccultation.hpp \
     $$SSCoreDIR/SSCode/SSOrbit.hpp \
     $$SSCoreDIR/SSCode/SSPSEphemeris.hpp \
     $$SSCoreDIR/SSCode/SSPlanet.hpp \
     $$SSCoreDIR/SSCode/SSStar.hpp \
+    $$SSCoreDIR/SSCode/SSStarPipeline.hpp \
+    $$SSCoreDIR/SSCode/SSStarTable.hpp \
+    $$SSCoreDIR/SSCode/SSStringPool.hpp \
+    $$SSCoreDIR/SSCode/SSThreadPool.hpp \
     $$SSCoreDIR/SSCode/SSTLE.hpp \
     $$SSCoreDIR/SSCode/SSTime.hpp \
+    $$SSCoreDIR/SSCode/SSTrig.hpp \
     $$SSCoreDIR/SSCode/SSUtilities.hpp \
     $$SSCoreDIR/SSCode/SSVPEphemeris.hpp \
     $$SSCoreDIR/SSCode/SSVector.hpp \
+    $$SSCoreDIR/SSCode/SSWarmStart.hpp \
     $$SSCoreDIR/SSCode/SSView.hpp
 
 android{
@@ -95,10 +126,29 @@ HEADERS += \
 }
 
 SOURCES += \
+        $$SSCoreDIR/SSCode/SSAlmanac.cpp \
         $$SSCoreDIR/SSCode/SSAngle.cpp \
+        $$SSCoreDIR/SSCode/SSAsync.cpp \
+        $$SSCoreDIR/SSCode/SSBinaryCatalog.cpp \
+        $$SSCoreDIR/SSCode/SSCatalogBuild.cpp \
+        $$SSCoreDIR/SSCode/SSChebyshevCache.cpp \
+        $$SSCoreDIR/SSCode/SSChebyshevEphemeris.cpp \
+        $$SSCoreDIR/SSCode/SSCityIndex.cpp \
+        $$SSCoreDIR/SSCode/SSCompactStarTable.cpp \
         $$SSCoreDIR/SSCode/SSConstellation.cpp \
         $$SSCoreDIR/SSCode/SSCoordinates.cpp \
+        $$SSCoreDIR/SSCode/SSCrossMatch.cpp \
+        $$SSCoreDIR/SSCode/SSDeepSkyIndex.cpp \
+        $$SSCoreDIR/SSCode/SSEclipse.cpp \
+        $$SSCoreDIR/SSCode/SSEphemerisContext.cpp \
+        $$SSCoreDIR/SSCode/SSEphemerisPolicy.cpp \
+        $$SSCoreDIR/SSCode/SSEphemerisPrefetch.cpp \
+        $$SSCoreDIR/SSCode/SSEphemerisSnapshot.cpp \
+        $$SSCoreDIR/SSCode/SSEphemerisTable.cpp \
         $$SSCoreDIR/SSCode/SSEvent.cpp \
+        $$SSCoreDIR/SSCode/SSEventCache.cpp \
+        $$SSCoreDIR/SSCode/SSGroundTrack.cpp \
+        $$SSCoreDIR/SSCode/SSGzip.cpp \
         $$SSCoreDIR/SSCode/SSHTM.cpp \
         $$SSCoreDIR/SSCode/SSIdentifier.cpp \
         $$SSCoreDIR/SSCode/SSImportGJ.cpp \
@@ -106,20 +156,31 @@ SOURCES += \
         $$SSCoreDIR/SSCode/SSImportMPC.cpp \
         $$SSCoreDIR/SSCode/SSImportNGCIC.cpp \
         $$SSCoreDIR/SSCode/SSImportSKY2000.cpp \
+        $$SSCoreDIR/SSCode/SSInstrument.cpp \
         $$SSCoreDIR/SSCode/SSJPLDEphemeris.cpp \
+        $$SSCoreDIR/SSCode/SSKeyframeEphemeris.cpp \
+        $$SSCoreDIR/SSCode/SSLazyEphemeris.cpp \
         $$SSCoreDIR/SSCode/SSMatrix.cpp \
+        $$SSCoreDIR/SSCode/SSMinorPlanetTable.cpp \
         $$SSCoreDIR/SSCode/SSMoonEphemeris.cpp \
         $$SSCoreDIR/SSCode/SSObject.cpp \
+        $$SSCoreDIR/SSCode/SSOccultation.cpp \
         $$SSCoreDIR/SSCode/SSOrbit.cpp \
         $$SSCoreDIR/SSCode/SSPSEphemeris.cpp \
         $$SSCoreDIR/SSCode/SSPlanet.cpp \
         $$SSCoreDIR/SSCode/SSStar.cpp \
+        $$SSCoreDIR/SSCode/SSStarPipeline.cpp \
+        $$SSCoreDIR/SSCode/SSStarTable.cpp \
+        $$SSCoreDIR/SSCode/SSStringPool.cpp \
+        $$SSCoreDIR/SSCode/SSThreadPool.cpp \
         $$SSCoreDIR/SSCode/SSTLE.cpp \
         $$SSCoreDIR/SSCode/SSTime.cpp \
+        $$SSCoreDIR/SSCode/SSTrig.cpp \
         $$SSCoreDIR/SSCode/SSUtilities.cpp \
         $$SSCoreDIR/SSCode/SSVPEphemeris.cpp \
         $$SSCoreDIR/SSCode/SSVector.cpp \
         $$SSCoreDIR/SSCode/SSView.cpp \
+        $$SSCoreDIR/SSCode/SSWarmStart.cpp \
         $$SSCoreDIR/SSCode/VSOP2013/ELPMPP02.cpp \
         $$SSCoreDIR/SSCode/VSOP2013/VSOP2013.cpp \
         $$SSCoreDIR/SSCode/VSOP2013/VSOP2013p1.cpp \
@@ -4,8 +4,11 @@
 //  Created by Tim DeBenedictis on 2/24/20.
 //  Copyright © 2020 Southern Stars. All rights reserved.
 
+#include <chrono>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <thread>
 
 #if defined __APPLE__
 #include <TargetConditionals.h>
@@ -18,19 +21,45 @@
 #include "../SSCode/SSCoordinates.hpp"
 #include "../SSCode/SSOrbit.hpp"
 #include "../SSCode/SSPlanet.hpp"
+#include "../SSCode/SSMinorPlanetTable.hpp"
 #include "../SSCode/SSFeature.hpp"
+#include "../SSCode/SSCityIndex.hpp"
 #include "../SSCode/SSStar.hpp"
+#include "../SSCode/SSStarTable.hpp"
+#include "../SSCode/SSThreadPool.hpp"
+#include "../SSCode/SSLazyEphemeris.hpp"
+#include "../SSCode/SSKeyframeEphemeris.hpp"
+#include "../SSCode/SSMoonEphemeris.hpp"
+#include "../SSCode/SSStarPipeline.hpp"
 #include "../SSCode/SSConstellation.hpp"
+#include "../SSCode/SSBinaryCatalog.hpp"
+#include "../SSCode/SSCrossMatch.hpp"
 #include "../SSCode/SSImportGCVS.hpp"
 #include "../SSCode/SSImportHIP.hpp"
 #include "../SSCode/SSImportSKY2000.hpp"
 #include "../SSCode/SSImportNGCIC.hpp"
+#include "../SSCode/SSDeepSkyIndex.hpp"
 #include "../SSCode/SSImportMPC.hpp"
 #include "../SSCode/SSImportGJ.hpp"
 #include "../SSCode/SSImportWDS.hpp"
 #include "../SSCode/SSJPLDEphemeris.hpp"
+#include "../SSCode/SSEphemerisPolicy.hpp"
+#include "../SSCode/SSInstrument.hpp"
 #include "../SSCode/SSTLE.hpp"
 #include "../SSCode/SSEvent.hpp"
+#include "../SSCode/SSAlmanac.hpp"
+#include "../SSCode/SSEventCache.hpp"
+#include "../SSCode/SSEclipse.hpp"
+#include "../SSCode/SSOccultation.hpp"
+#include "../SSCode/SSEphemerisSnapshot.hpp"
+#include "../SSCode/SSEphemerisPrefetch.hpp"
+#include "../SSCode/SSEphemerisTable.hpp"
+#include "../SSCode/SSGzip.hpp"
+#include "../SSCode/SSCatalogBuild.hpp"
+#include "../SSCode/SSAsync.hpp"
+#include "../SSCode/SSGroundTrack.hpp"
+#include "../SSCode/SSWarmStart.hpp"
+#include "../SSCode/SSTrig.hpp"
 #include "../SSCode/VSOP2013/VSOP2013.hpp"
 #include "../SSCode/VSOP2013/ELPMPP02.hpp"
 
@@ -91,6 +120,100 @@ void TestTime ( void )
               date2.min,
               date2.sec)
          << endl;
+
+    // Format and parse a hundred thousand times with a compiled format, and compare with SSDate::format() and parse().
+
+    int n = 100000;
+    vector<double> jds ( n ), jds2 ( n );
+    for ( int i = 0; i < n; i++ )
+        jds[i] = SSTime::kJ2000 + i * 1.37 - 50000.0;
+
+    SSDateFormat compiled ( "%Y-%m-%dT%H:%M:%S %a %b %z" );
+    vector<SSDate> dates ( n );
+    for ( int i = 0; i < n; i++ )
+        dates[i] = SSDate ( SSTime ( jds[i], date.zone ), kGregorian );
+
+    vector<string> slow ( n ), fast ( n );
+    auto start = chrono::steady_clock::now();
+    for ( int i = 0; i < n; i++ )
+        slow[i] = dates[i].format ( "%Y-%m-%dT%H:%M:%S %a %b %z" );
+    double slowMsec = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+
+    char buf[64];
+    start = chrono::steady_clock::now();
+    for ( int i = 0; i < n; i++ )
+        fast[i].assign ( buf, compiled.format ( dates[i], buf, sizeof ( buf ) ) );
+    double fastMsec = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+
+    int numDiff = 0, numParsed = 0;
+    for ( int i = 0; i < n; i++ )
+    {
+        numDiff += fast[i] != slow[i];
+        SSDate parsed;
+        numParsed += parsed.parseISO ( fast[i].substr ( 0, 19 ) ) && parsed.format ( "%Y-%m-%dT%H:%M:%S" ) == fast[i].substr ( 0, 19 );
+    }
+
+    cout << "Compiled date format: " << numDiff << " of " << n << " differ from strftime(); " << format ( "%.1f ms vs %.1f ms", fastMsec, slowMsec );
+    cout << "; " << numParsed << " parsed back as ISO 8601" << endl;
+
+    // Convert the same times to calendar dates and back in a batch, and compare with single conversions.
+
+    SSTime::toCalendarDates ( jds.data(), dates.data(), n, kGregorianJulian );
+    SSTime::fromCalendarDates ( dates.data(), jds2.data(), n );
+    double maxDiff = 0.0;
+    int numDays = 0;
+    for ( int i = 0; i < n; i++ )
+    {
+        SSDate single ( SSTime ( jds[i] ) );
+        numDays += single.year != dates[i].year || single.month != dates[i].month || single.day != dates[i].day;
+        maxDiff = max ( maxDiff, fabs ( jds2[i] - jds[i] ) * SSTime::kSecondsPerDay );
+    }
+
+    SSTime parsedJD, parsedMJD, parsedISO;
+    bool jdOK = parsedJD.parse ( "JD 2451545.0" ) && parsedMJD.parse ( "MJD 51544.5" ) && parsedISO.parse ( "2000-01-01T12:00:00Z" );
+    jdOK = jdOK && parsedJD.jd == SSTime::kJ2000 && parsedMJD.jd == SSTime::kJ2000 && parsedISO.jd == SSTime::kJ2000;
+    cout << "Batch calendar dates: " << numDays << " of " << n << " days differ from single conversions; round trip max error " << format ( "%.2e", maxDiff ) << " sec; ";
+    cout << "JD, MJD, ISO 8601 parsing " << ( jdOK ? "OK" : "FAILED" ) << endl;
+
+    // Compute Delta T, ephemeris dates, and sidereal times in batches, and compare with single computations.
+
+    SSAngle lon = SSAngle::fromDegrees ( -122.0 );
+    vector<double> dt ( n ), jed ( n ), gst ( n );
+    SSTime::getDeltaT ( jds.data(), dt.data(), n );
+    SSTime::getJulianEphemerisDate ( jds.data(), jed.data(), n );
+    SSTime::getSiderealTime ( jds.data(), lon, gst.data(), n );
+    int numBatchDiff = 0;
+    for ( int i = 0; i < n; i++ )
+    {
+        SSTime single ( jds[i] );
+        numBatchDiff += dt[i] != single.getDeltaT() || jed[i] != single.getJulianEphemerisDate() || gst[i] != single.getSiderealTime ( lon );
+    }
+
+    // Compute local sidereal times every minute for six hours around the current time in a batch, reusing its nutation,
+    // and compare with recomputing nutation at each time; allow 6 milliarcseconds of error per hour from the current time.
+
+    int m = 361;
+    vector<double> lstJDs ( m ), lst ( m );
+    SSCoordinates coords ( now, SSSpherical ( lon, SSAngle::fromDegrees ( 38.0 ), 0.0 ) );
+    for ( int i = 0; i < m; i++ )
+        lstJDs[i] = now.jd + ( i - m / 2 ) / 1440.0;
+    coords.getLST ( lstJDs.data(), lst.data(), m );
+
+    double maxMas = 0.0;
+    int numOver = 0;
+    SSCoordinates single ( now, coords.getLocation() );
+    single.setPrecessionTolerance ( 0.0 );
+    for ( int i = 0; i < m; i++ )
+    {
+        single.setTime ( SSTime ( lstJDs[i] ) );
+        double mas = fabs ( remainder ( lst[i] - single.getLST(), SSAngle::kTwoPi ) ) * SSAngle::kArcsecPerRad * 1000.0;
+        numOver += mas > 6.0 * fabs ( lstJDs[i] - now.jd ) * 24.0 + 0.01;
+        maxMas = max ( maxMas, mas );
+    }
+
+    cout << "Batch Delta T, JED, sidereal time: " << numBatchDiff << " of " << n << " differ from single computations; ";
+    cout << "batch LST over 6 hours: max error " << format ( "%.2f", maxMas ) << " mas, " << numOver << " over bound ";
+    cout << ( numBatchDiff == 0 && numOver == 0 ? "OK" : "FAILED" ) << endl << endl;
 };
 
 void TestCalendars ( void )
@@ -221,6 +344,22 @@ void TestSolarSystem ( string inputDir, string outputDir )
     int numCities = SSImportObjectsFromCSV ( inputDir + "/SolarSystem/Cities.csv", cities );
     cout << "Imported " << numCities << " cities" << endl;
 
+    // Find the cities nearest San Francisco, and those of at least a million people within 500 km, with a city index.
+
+    SSCityIndex cityIndex ( cities );
+    vector<SSCityIndex::Result> nearCities, bigCities;
+    SSAngle sfLon = SSAngle::fromDegrees ( -122.4194 ), sfLat = SSAngle::fromDegrees ( 37.7749 );
+    cityIndex.nearest ( sfLon, sfLat, 3, nearCities );
+    cityIndex.search ( sfLon, sfLat, SSAngle ( 500.0 / SSCoordinates::kKmPerEarthRadii ), bigCities, 1000000 );
+    if ( nearCities.size() > 0 )
+    {
+        cout << "Nearest city to San Francisco: " << nearCities[0].pCity->getName();
+        cout << format ( " (%.1f km); %d cities over 1 million within 500 km", nearCities[0].distance * SSCoordinates::kKmPerEarthRadii, (int) bigCities.size() ) << endl;
+        SSTime summer ( SSDate ( kGregorian, 0.0, 2026, 7, 1.0 ) ), winter ( SSDate ( kGregorian, 0.0, 2026, 1, 1.0 ) );
+        cout << "Daylight saving time there on 2026 Jul 1: " << ( cityIndex.isDST ( nearCities[0].pCity, summer ) ? "yes" : "no" );
+        cout << ", Jan 1: " << ( cityIndex.isDST ( nearCities[0].pCity, winter ) ? "yes" : "no" ) << endl;
+    }
+
     SSObjectVec comets;
     int numComets = SSImportMPCComets ( inputDir + "/SolarSystem/Comets.txt", comets );
     cout << "Imported " << numComets << " MPC comets" << endl;
@@ -229,6 +368,281 @@ void TestSolarSystem ( string inputDir, string outputDir )
     int numAsteroids = SSImportMPCAsteroids ( inputDir + "/SolarSystem/Asteroids.txt", asteroids );
     cout << "Imported " << numAsteroids << " MPC asteroids" << endl;
 
+    // Re-import asteroids on several threads, keeping only those with H < 10; they should arrive in file order.
+
+    SSObjectVec bright;
+    auto brightFilter = [] ( SSObjectPtr pObj, void *userData ) { return SSGetPlanetPtr ( pObj )->getHMagnitude() < 10.0; };
+    int numBright = SSImportMPCAsteroids ( inputDir + "/SolarSystem/Asteroids.txt", bright, brightFilter, nullptr, 4 );
+    int numOrdered = 0;
+    for ( int i = 0, j = 0; i < asteroids.size() && j < bright.size(); i++ )
+        if ( brightFilter ( asteroids[i], nullptr ) && SSGetPlanetPtr ( asteroids[i] )->getIdentifier() == SSGetPlanetPtr ( bright[j++] )->getIdentifier() )
+            numOrdered++;
+    cout << "Imported " << numBright << " MPC asteroids with H < 10 on 4 threads; " << numOrdered << " in file order" << endl;
+
+    // Compare batch Kepler solver against solving each comet and asteroid orbit individually.
+
+    SSOrbitArray orbits;
+    for ( SSObjectVec *pObjects : { &comets, &asteroids } )
+        for ( int i = 0; i < pObjects->size(); i++ )
+            orbits.push_back ( SSGetPlanetPtr ( pObjects->get ( i ) )->getOrbit() );
+
+    vector<SSVector> bpos, bvel;
+    double jed = SSTime::kJ2000 + 7305.0, maxpos = 0.0, maxvel = 0.0;
+    orbits.toPositionVelocity ( jed, bpos, bvel );
+    for ( int i = 0; i < orbits.size(); i++ )
+    {
+        SSVector pos, vel;
+        orbits.get ( i ).toPositionVelocity ( jed, pos, vel );
+        maxpos = max ( maxpos, pos.distance ( bpos[i] ) / pos.magnitude() );
+        maxvel = max ( maxvel, vel.distance ( bvel[i] ) / vel.magnitude() );
+    }
+
+    cout << format ( "Batch Kepler solver: %d orbits, max relative position difference %.1e, velocity %.1e", (int) orbits.size(), maxpos, maxvel ) << endl;
+
+    // Compare columnar minor planet table ephemeris against computing each comet and asteroid individually.
+
+    SSMinorPlanetTable table;
+    table.append ( comets );
+    table.append ( asteroids );
+
+    SSSpherical here = { SSAngle ( SSDegMinSec ( '-', 122, 25, 09.9 ) ), SSAngle ( SSDegMinSec ( '+', 37, 46, 29.7 ) ), 0.026 };
+    SSCoordinates coords ( SSTime ( jed ), here );
+    table.computeEphemeris ( coords );
+
+    double maxsep = 0.0, maxmag = 0.0;
+    for ( int i = 0; i < table.size(); i++ )
+    {
+        SSPlanetPtr pPlanet = table.materialize ( i );
+        pPlanet->computeEphemeris ( coords );
+        maxsep = max ( maxsep, (double) pPlanet->getDirection().angularSeparation ( table.direction[i] ) );
+        if ( ! ::isinf ( pPlanet->getMagnitude() ) )
+            maxmag = max ( maxmag, (double) fabs ( pPlanet->getMagnitude() - table.magnitude[i] ) );
+        delete pPlanet;
+    }
+
+    cout << format ( "Minor planet table: %d objects, max direction difference %.1e arcsec, magnitude %.1e", (int) table.size(), SSAngle ( maxsep ).toArcsec(), maxmag ) << endl;
+
+    // With a magnitude limit, the table should skip faint objects, but still find every one brighter than the limit,
+    // including after moving the time a few days forward (which reuses the cached magnitude bounds).
+
+    vector<float> fullmag = table.magnitude;
+    table.setMagnitudeLimit ( 12.0 );
+    table.computeEphemeris ( coords );
+    int numMissed = 0;
+    for ( int i = 0; i < table.size(); i++ )
+        if ( fullmag[i] <= 12.0 && table.magnitude[i] != fullmag[i] )
+            numMissed++;
+
+    coords.setTime ( SSTime ( jed + 10.0 ) );
+    int numCandidates = (int) table.getNumCandidates();
+    table.computeEphemeris ( coords );
+    for ( int i = 0; i < table.size(); i++ )
+    {
+        SSPlanetPtr pPlanet = table.materialize ( i );
+        pPlanet->computeEphemeris ( coords );
+        if ( pPlanet->getMagnitude() <= 12.0 && ::isinf ( table.magnitude[i] ) )
+            numMissed++;
+        delete pPlanet;
+    }
+
+    cout << format ( "Minor planet table with limiting magnitude 12: %d candidates, %d missed", numCandidates, numMissed ) << endl;
+
+    // Index minor planet paths over 30 days, then find objects within 5 degrees of the first asteroid
+    // half-way through the index, and compare with computing the ephemeris of every object.
+
+    SSMinorPlanetPathIndex pathIndex;
+    table.setMagnitudeLimit ( INFINITY );
+    size_t numEntries = pathIndex.build ( table, coords, jed, jed + 30.0 );
+
+    coords.setTime ( SSTime ( jed + 15.5 ) );
+    table.computeEphemeris ( coords );
+    SSVector center = table.direction[numComets];
+    SSAngle radius = SSAngle::fromDegrees ( 5.0 );
+    int numInField = 0;
+    for ( int i = 0; i < table.size(); i++ )
+        if ( center.angularSeparation ( table.direction[i] ) <= radius )
+            numInField++;
+
+    vector<size_t> found;
+    size_t numRefined = 0;
+    int numFound = pathIndex.search ( coords, center, radius, found, &numRefined );
+    cout << format ( "Minor planet path index: %d entries in %d buckets; %d of %d objects within 5 deg found, %d refined", (int) numEntries, (int) pathIndex.numBuckets(), numFound, numInField, (int) numRefined ) << endl;
+
+    // Compute the Moon's surface features in one batch, culling the far side, and compare with computing each individually.
+
+    SSPlanetPtr pMoon = SSGetPlanetPtr ( moons[0] );
+    pMoon->computeEphemeris ( coords );
+    int numNearSide = SSComputePlanetFeatureEphemerides ( pMoon, features, featureMap );
+    int numLunar = 0, numDiffer = 0;
+    for ( int i = 0; i < features.size(); i++ )
+    {
+        SSFeaturePtr pFeature = SSGetFeaturePtr ( features[i] );
+        if ( pFeature == nullptr || pFeature->getTarget() != "Moon" )
+            continue;
+
+        SSVector dir = pFeature->getDirection();
+        float mag = pFeature->getMagnitude();
+        pFeature->computeEphemeris ( pMoon );
+        if ( mag != pFeature->getMagnitude() || ( mag > 0.0 && dir != pFeature->getDirection() ) )
+            numDiffer++;
+        numLunar++;
+    }
+    cout << format ( "Lunar features: %d of %d on near side in batch, %d differ from individual ephemeris", numNearSide, numLunar, numDiffer ) << endl;
+
+    // Cast a 100 x 100 grid of rays across the Moon's disk in one batch, and compare with casting each individually.
+
+    SSVector observer = coords.getObserverPosition();
+    SSVector toMoon = ( pMoon->getPosition() - observer ).normalize();
+    SSVector east = SSVector ( 0.0, 0.0, 1.0 ).crossProduct ( toMoon ).normalize();
+    SSVector north = toMoon.crossProduct ( east );
+    double span = pMoon->angularRadius() * 1.2;
+    vector<double> ux ( 10000 ), uy ( 10000 ), uz ( 10000 ), dist ( 10000 ), lon ( 10000 ), lat ( 10000 );
+    vector<uint8_t> hit ( 10000 );
+    for ( int i = 0; i < 10000; i++ )
+    {
+        SSVector u = ( toMoon + east * ( span * ( i % 100 - 49.5 ) / 49.5 ) + north * ( span * ( i / 100 - 49.5 ) / 49.5 ) ).normalize();
+        ux[i] = u.x;
+        uy[i] = u.y;
+        uz[i] = u.z;
+    }
+
+    int numHits = (int) pMoon->rayIntersect ( observer, 10000, &ux[0], &uy[0], &uz[0], &hit[0], &dist[0], &lon[0], &lat[0] );
+    double maxDiff = 0.0;
+    numDiffer = 0;
+    for ( int i = 0; i < 10000; i++ )
+    {
+        double d = 0.0;
+        SSVector q;
+        if ( pMoon->rayIntersect ( observer, SSVector ( ux[i], uy[i], uz[i] ), d, q ) != (bool) hit[i] )
+            numDiffer++;
+        else if ( hit[i] )
+            maxDiff = max ( maxDiff, fabs ( d - dist[i] ) * SSCoordinates::kKmPerAU );
+    }
+    cout << format ( "Lunar disk rays: %d of 10000 hit in batch, %d differ from individual rays, max distance difference %.6f km", numHits, numDiffer, maxDiff ) << endl;
+
+    // Compute copies of the planets, moons, asteroids, and features serially and in parallel; results must be identical.
+
+    SSObjectArray serial, parallel;
+    for ( SSObjectVec *pArray : { &planets, &moons, &asteroids, &features } )
+    {
+        for ( int i = 0; i < pArray->size(); i++ )
+        {
+            serial.append ( SSCloneObject ( pArray->get ( i ) ) );
+            parallel.append ( SSCloneObject ( pArray->get ( i ) ) );
+        }
+    }
+
+    SSEphemerisOptions serialOptions;
+    serialOptions.parallel = false;
+    serial.computeEphemeris ( coords, serialOptions );
+    parallel.computeEphemeris ( coords );
+    numDiffer = 0;
+    for ( int i = 0; i < serial.size(); i++ )
+    {
+        SSVector dir1 = serial[i]->getDirection(), dir2 = parallel[i]->getDirection();
+        double dist1 = serial[i]->getDistance(), dist2 = parallel[i]->getDistance();
+        float mag1 = serial[i]->getMagnitude(), mag2 = parallel[i]->getMagnitude();
+        if ( memcmp ( &dir1, &dir2, sizeof ( dir1 ) ) || memcmp ( &dist1, &dist2, sizeof ( dist1 ) ) || memcmp ( &mag1, &mag2, sizeof ( mag1 ) ) )
+            numDiffer++;
+    }
+    cout << "Parallel array ephemeris: " << numDiffer << " of " << serial.size() << " objects differ from serial" << endl;
+
+    // Step the same objects through one hour in 1-minute steps, computing only those which may have moved by
+    // more than 1 arcsecond, then compare with computing every object at the last step.
+
+    SSLazyEphemeris lazy;
+    SSCoordinates lazyCoords = coords;
+    for ( int step = 0; step <= 60; step++ )
+    {
+        lazyCoords.setTime ( coords.getTime() + step / 1440.0 );
+        lazy.update ( serial, lazyCoords );
+    }
+
+    parallel.computeEphemeris ( lazyCoords );
+    double maxErr = 0.0;
+    for ( int i = 0; i < serial.size(); i++ )
+        if ( SSGetObjectFamily ( serial[i]->getType() ) == kFamilyPlanet )
+            maxErr = max ( maxErr, serial[i]->getDirection().angularSeparation ( parallel[i]->getDirection() ).toArcsec() );
+    cout << format ( "Lazy ephemeris: %d computed, %d skipped over 61 steps; max error %.3f arcsec", (int) lazy.getComputed(), (int) lazy.getSkipped(), maxErr ) << endl;
+
+    // Animate the planets and moons through one day in 1-minute frames, interpolating between keyframes,
+    // and compare with exact ephemerides every hour.
+
+    SSObjectArray animated, exact;
+    for ( SSObjectVec *pArray : { &planets, &moons } )
+    {
+        for ( int i = 0; i < pArray->size(); i++ )
+        {
+            animated.append ( SSCloneObject ( pArray->get ( i ) ) );
+            exact.append ( SSCloneObject ( pArray->get ( i ) ) );
+        }
+    }
+
+    SSKeyframeEphemeris keyframes ( animated );
+    SSCoordinates frameCoords = coords;
+    double maxBound = 0.0;
+    maxErr = 0.0;
+    for ( int frame = 0; frame <= 1440; frame++ )
+    {
+        frameCoords.setTime ( coords.getTime() + frame / 1440.0 );
+        keyframes.update ( frameCoords );
+        maxBound = max ( maxBound, keyframes.getMaxErrorBound() );
+        if ( frame % 60 == 0 )
+        {
+            exact.computeEphemeris ( frameCoords );
+            for ( int i = 0; i < exact.size(); i++ )
+                maxErr = max ( maxErr, animated[i]->getDirection().angularSeparation ( exact[i]->getDirection() ).toArcsec() );
+        }
+    }
+    cout << format ( "Keyframe ephemeris: %d keyframes, %d checks for %d objects over 1441 frames; max error %.3f arcsec, bound %.3f arcsec", (int) keyframes.getKeyframes(), (int) keyframes.getChecks(), (int) keyframes.size(), maxErr, SSAngle ( maxBound ).toArcsec() ) << endl;
+
+    // Correct light time to first order from velocity where that stays within 0.01 arcsec, and compare with
+    // re-evaluating every object's ephemeris antedated for light time.
+
+    vector<SSVector> dirs;
+    for ( int i = 0; i < serial.size(); i++ )
+    {
+        serial[i]->computeEphemeris ( coords );
+        dirs.push_back ( serial[i]->getDirection() );
+    }
+
+    SSPlanet::setLightTimeTolerance ( SSAngle::kRadPerArcsec / 100.0 );
+    SSPlanet::countLightTime ( true );
+    maxErr = 0.0;
+    for ( int i = 0; i < serial.size(); i++ )
+    {
+        serial[i]->computeEphemeris ( coords );
+        if ( SSGetObjectFamily ( serial[i]->getType() ) == kFamilyPlanet )
+            maxErr = max ( maxErr, serial[i]->getDirection().angularSeparation ( dirs[i] ).toArcsec() );
+    }
+
+    uint64_t numFirstOrder = 0, numEvaluated = 0;
+    for ( auto &stats : SSPlanet::getLightTimeStats() )
+    {
+        numFirstOrder += stats.second.firstOrder;
+        numEvaluated += stats.second.evaluations;
+    }
+    cout << format ( "Light time: %d first-order corrections, %d ephemeris evaluations; max difference %.4f arcsec", (int) numFirstOrder, (int) numEvaluated, maxErr ) << endl;
+    SSPlanet::countLightTime ( false );
+    SSPlanet::resetLightTimeStats();
+    SSPlanet::setLightTimeTolerance ( 0.0 );
+
+    // Compute all moons of Jupiter and Saturn at once, and compare with computing each moon separately.
+
+    SSVector jpos[SSMoonEphemeris::kNumJupiterMoons], jvel[SSMoonEphemeris::kNumJupiterMoons];
+    SSVector spos[SSMoonEphemeris::kNumSaturnMoons], svel[SSMoonEphemeris::kNumSaturnMoons];
+    SSVector mpos, mvel;
+    double maxKm = 0.0;
+    SSMoonEphemeris::jupiterMoonsPositionVelocity ( coords.getJED(), jpos, jvel );
+    for ( int i = 0; i < SSMoonEphemeris::kNumJupiterMoons; i++ )
+        if ( SSMoonEphemeris::jupiterMoonPositionVelocity ( kIo + i, coords.getJED(), mpos, mvel ) )
+            maxKm = max ( maxKm, ( mpos - jpos[i] ).magnitude() * SSCoordinates::kKmPerAU );
+    SSMoonEphemeris::saturnMoonsPositionVelocity ( coords.getJED(), spos, svel );
+    for ( int i = 0; i < SSMoonEphemeris::kNumSaturnMoons; i++ )
+        if ( SSMoonEphemeris::saturnMoonPositionVelocity ( kMimas + i, coords.getJED(), mpos, mvel ) )
+            maxKm = max ( maxKm, ( mpos - spos[i] ).magnitude() * SSCoordinates::kKmPerAU );
+    cout << format ( "Moon systems: %d Jupiter and %d Saturn moons computed at once; max difference from separately %.1e km", SSMoonEphemeris::kNumJupiterMoons, SSMoonEphemeris::kNumSaturnMoons, maxKm ) << endl;
+
     if ( ! outputDir.empty() )
     {
         numMoons = SSExportObjectsToCSV ( outputDir + "/ExportedMoons.csv", moons );
@@ -245,9 +659,78 @@ void TestSolarSystem ( string inputDir, string outputDir )
 
         numAsteroids = SSExportObjectsToCSV ( outputDir + "/ExportedAsteroids.csv", asteroids );
         cout << "Exported " << numAsteroids << " MPC asteroids to " << outputDir + "/ExportedAsteroids.csv" << endl;
+
+        // Compile planets, moons, and the first few asteroids into a Chebyshev ephemeris file for 32 days,
+        // then compare positions computed from the file with those from the original ephemerides.
+        
+        vector<SSPlanet *> bodies;
+        for ( int i = 0; i < planets.size(); i++ )
+            bodies.push_back ( SSGetPlanetPtr ( planets[i] ) );
+        for ( int i = 0; i < moons.size(); i++ )
+            bodies.push_back ( SSGetPlanetPtr ( moons[i] ) );
+        for ( int i = 0; i < asteroids.size() && i < 10; i++ )
+            bodies.push_back ( SSGetPlanetPtr ( asteroids[i] ) );
+
+        string ephemFile = outputDir + "/Compiled.ssc";
+        double jed0 = SSTime::kJ2000 + 7305.0, jed1 = jed0 + 32.0;
+        if ( SSPlanet::compileEphemerisFile ( ephemFile, bodies, jed0, jed1 ) )
+        {
+            vector<SSVector> positions;
+            SSVector pos, vel;
+            for ( double jed = jed0; jed <= jed1; jed += 0.37 )
+            {
+                for ( SSPlanet *pBody : bodies )
+                {
+                    pBody->computePositionVelocity ( jed, 0.0, pos, vel );
+                    positions.push_back ( pos );
+                }
+            }
+
+            double maxerr = 0.0;
+            int i = 0;
+            SSPlanet::openEphemerisFile ( ephemFile );
+            for ( double jed = jed0; jed <= jed1; jed += 0.37 )
+            {
+                for ( SSPlanet *pBody : bodies )
+                {
+                    pBody->computePositionVelocity ( jed, 0.0, pos, vel );
+                    if ( positions[i].magnitude() > 0.0 )
+                        maxerr = max ( maxerr, ( pos - positions[i] ).magnitude() / positions[i].magnitude() );
+                    i++;
+                }
+            }
+            
+            cout << "Compiled " << bodies.size() << " bodies to " << ephemFile << " (" << SSPlanet::getEphemerisFile().getBytes() << " bytes); max relative position error " << format ( "%.1e", maxerr ) << endl;
+            SSPlanet::closeEphemerisFile();
+        }
+        else
+        {
+            cout << "Failed to compile " << ephemFile << endl;
+        }
     }
 }
 
+// Writes objects to a binary catalog file (filename), reads them back, and returns the number
+// of objects read whose CSV form is identical to the original object's.
+
+int testBinaryCatalog ( const string &filename, SSObjectVec &objects )
+{
+    SSObjectVec copies;
+    
+    if ( SSExportObjectsToBinary ( filename, objects ) != objects.size() )
+        return 0;
+    
+    if ( SSImportObjectsFromBinary ( filename, copies ) != objects.size() )
+        return 0;
+    
+    int n = 0;
+    for ( int i = 0; i < objects.size(); i++ )
+        if ( objects[i]->toCSV() == copies[i]->toCSV() )
+            n++;
+    
+    return n;
+}
+
 void TestConstellations ( string inputDir, string outputDir )
 {
     SSObjectVec constellations;
@@ -261,31 +744,919 @@ void TestConstellations ( string inputDir, string outputDir )
     int numLines = SSImportConstellationShapes ( inputDir + "/Constellations/Shapes.csv", constellations );
     cout << "Imported " << numLines << " IAU constellation shape lines" << endl;
 
+    // Identify constellations at the centers of a one-degree B1875 RA/Dec grid in one batch, and compare with one at a time.
+
+    vector<double> ra, dec;
+    for ( int i = 0; i < 360 * 180; i++ )
+    {
+        ra.push_back ( SSAngle::fromDegrees ( i % 360 + 0.5 ) );
+        dec.push_back ( SSAngle::fromDegrees ( i / 360 - 89.5 ) );
+    }
+
+    vector<int> indices ( ra.size() );
+    SSConstellation::identify ( ra.size(), &ra[0], &dec[0], &indices[0] );
+    set<int> found ( indices.begin(), indices.end() );
+    int numDiffer = 0;
+    for ( int i = 0; i < ra.size(); i++ )
+        if ( SSConstellation::indexToAbbreviation ( indices[i] ) != SSConstellation::identify ( ra[i], dec[i] ) )
+            numDiffer++;
+    cout << format ( "Identified %d constellations at %d grid points in batch, %d differ from individual identification", (int) found.size(), (int) ra.size(), numDiffer ) << endl;
+
     if ( ! outputDir.empty() )
     {
         numCons = SSExportObjectsToCSV ( outputDir + "/ExportedConstellations.csv", constellations );
         cout << "Exported " << numCons << " constellations to " << outputDir + "/ExportedConstellations.csv" << endl;
     }
-}
-
-void TestStars ( string inputDir, string outputDir )
-{
-    SSObjectVec nearest, brightest;
+}
+
+void TestStars ( string inputDir, string outputDir )
+{
+    SSObjectVec nearest, brightest;
+    
+    int numStars = SSImportObjectsFromCSV ( inputDir + "/Stars/Nearest.csv", nearest );
+    cout << "Imported " << numStars << " nearby stars" << endl;
+    
+    numStars = SSImportObjectsFromCSV ( inputDir + "/Stars/Brightest.csv", brightest );
+    cout << "Imported " << numStars << " bright stars" << endl;
+
+    // Keep identifier columns while importing bright stars again, and compare lookups by identifier with object maps.
+
+    SSObjectVec lookup;
+    lookup.setIdentifierCatalogs();
+    SSImportObjectsFromCSV ( inputDir + "/Stars/Brightest.csv", lookup, nullptr, nullptr, 0 );
+
+    int numLookups = 0, numWrong = 0;
+    for ( SSCatalog cat : lookup.getIdentifierCatalogs() )
+    {
+        SSObjectMap map = SSMakeObjectMap ( lookup, cat );
+        for ( auto &entry : map )
+        {
+            numLookups++;
+            if ( lookup.find ( entry.first ) != SSIdentifierToObject ( entry.first, map, lookup ) )
+                numWrong++;
+        }
+    }
+
+    SSIdentifier hd = lookup.crossIdentify ( SSIdentifier ( kCatHIP, 32349 ), kCatHD );
+    cout << "Identifier columns: " << numLookups << " lookups in " << lookup.getIdentifierCatalogs().size() << " catalogs, " << numWrong << " differ from object maps; ";
+    cout << "HIP 32349 = " << hd.toString() << endl;
+    
+    // Compare columnar star table ephemeris against computing each star individually.
+    
+    SSStarTable table;
+    table.append ( brightest );
+    
+    SSSpherical here = { SSAngle ( SSDegMinSec ( '-', 122, 25, 09.9 ) ), SSAngle ( SSDegMinSec ( '+', 37, 46, 29.7 ) ), 0.026 };
+    SSCoordinates coords ( SSTime ( SSDate ( kGregorian, 0.0, 2050, 1, 1.0, 0, 0, 0.0 ) ), here );
+    table.computeEphemeris ( coords );
+    
+    int numDiff = 0;
+    for ( int i = 0; i < table.size(); i++ )
+    {
+        SSStarPtr pStar = SSGetStarPtr ( brightest[i] );
+        pStar->SSStar::computeEphemeris ( coords );
+        if ( pStar->getDirection() != table.direction[i] || pStar->getDistance() != table.distance[i] || pStar->getMagnitude() != table.magnitude[i] )
+            numDiff++;
+    }
+    
+    cout << "Star table: " << table.size() << " stars, " << numDiff << " differ from individual ephemeris" << endl;
+    
+    // Compare working epoch ephemeris, 3/4 day after the working epoch, against exact ephemeris.
+    
+    table.setEpochTolerance ( SSStarTable::kDefaultEpochTolerance );
+    table.computeEphemeris ( coords );
+    coords.setTime ( coords.getTime() + 0.75 );
+    table.computeEphemeris ( coords );
+    
+    double maxSep = 0.0, maxMag = 0.0;
+    for ( int i = 0; i < table.size(); i++ )
+    {
+        SSStarPtr pStar = SSGetStarPtr ( brightest[i] );
+        pStar->SSStar::computeEphemeris ( coords );
+        maxSep = max ( maxSep, pStar->getDirection().angularSeparation ( table.direction[i] ).toArcsec() );
+        maxMag = max ( maxMag, (double) fabs ( pStar->getMagnitude() - table.magnitude[i] ) );
+    }
+    
+    cout << "Star table working epoch: max error " << format ( "%.4f", maxSep ) << " arcsec, " << format ( "%.4f", maxMag ) << " mag" << endl;
+    
+    // Compute binary orbits of bright double stars in one batch, and compare with solving each star's orbit separately.
+
+    SSDoubleStarOrbits binaries;
+    binaries.setStars ( brightest );
+    binaries.computePositions ( coords.getJED() );
+    maxSep = 0.0;
+    for ( int i = 0; i < brightest.size(); i++ )
+    {
+        SSDoubleStarPtr pDouble = SSGetDoubleStarPtr ( brightest[i] );
+        if ( pDouble != nullptr && pDouble->hasOrbit() )
+        {
+            SSVector pos, vel;
+            pDouble->getOrbit().toPositionVelocity ( coords.getJED(), pos, vel );
+            maxSep = max ( maxSep, pos.distance ( pDouble->getOrbitPosition ( coords.getJED() ) ) );
+        }
+    }
+
+    cout << "Double star orbits: " << binaries.size() << " computed in batch, max difference from separately " << format ( "%.1e", maxSep ) << " arcsec" << endl;
+
+    // Draw bright stars in a 60-degree horizon view with the fused pipeline, and count the same stars drawn individually.
+    
+    SSStarTable drawTable;
+    drawTable.append ( brightest );
+    SSStarPipeline pipeline ( drawTable );
+    pipeline.index();
+    
+    SSView view ( kGnomonic, SSAngle::fromDegrees ( 60.0 ), 1024, 768, 512, 384 );
+    view.setCenter ( SSAngle::fromDegrees ( 180.0 ), SSAngle::fromDegrees ( 45.0 ), 0.0 );
+    SSStarPipeline::Style style;
+    vector<SSStarPipeline::Vertex> vertices;
+    pipeline.render ( coords, view, kHorizon, style, vertices );
+    
+    int numDrawn = 0;
+    for ( int i = 0; i < brightest.size(); i++ )
+    {
+        SSStarPtr pStar = SSGetStarPtr ( brightest[i] );
+        pStar->SSStar::computeEphemeris ( coords );
+        SSVector v = view.project ( coords.transform ( kFundamental, kHorizon, pStar->getDirection() ) );
+        if ( v.z > 0.0 && view.inBoundRect ( v.x, v.y ) && pStar->getMagnitude() <= style.magLimit )
+            numDrawn++;
+    }
+    
+    const SSStarPipeline::Stats &stats = pipeline.getStats();
+    cout << "Star pipeline: " << stats.drawn << " stars drawn (" << numDrawn << " individually) from " << stats.computed << " computed in ";
+    cout << stats.trixels << " triangles, " << format ( "%.3f", stats.frameSeconds * 1000.0 ) << " ms" << endl;
+
+    // Draw the same view with the single-precision path, and compare star positions with the double-precision ones.
+    
+    vector<SSStarPipeline::Vertex> vertices32;
+    pipeline.setFloat32 ( true );
+    pipeline.render ( coords, view, kHorizon, style, vertices32 );
+    pipeline.setFloat32 ( false );
+    
+    double maxPixels = 0.0;
+    for ( size_t i = 0, j = 0; i < vertices.size() && j < vertices32.size(); i++ )
+    {
+        while ( j < vertices32.size() && vertices32[j].index < vertices[i].index )
+            j++;
+        if ( j < vertices32.size() && vertices32[j].index == vertices[i].index )
+            maxPixels = max ( maxPixels, (double) hypot ( vertices32[j].x - vertices[i].x, vertices32[j].y - vertices[i].y ) );
+    }
+    
+    cout << "Star pipeline (float32): " << vertices32.size() << " stars drawn, max position difference " << format ( "%.1e", maxPixels ) << " pixels" << endl;
+
+    // Draw the same view from a compact star table, and compare star positions with the float32 path by identifier,
+    // skipping identifiers shared by components of double stars.
+
+    SSCompactStarTable compactTable;
+    size_t numCompact = compactTable.append ( brightest );
+    SSStarPipeline compactPipeline ( compactTable );
+    compactPipeline.index();
+    vector<SSStarPipeline::Vertex> compactVertices;
+    compactPipeline.render ( coords, view, kHorizon, style, compactVertices );
+
+    map<int64_t,int> identCount;
+    for ( size_t i = 0; i < compactTable.size(); i++ )
+        identCount[ compactTable.ident[i] ]++;
+
+    map<int64_t,SSStarPipeline::Vertex> byIdent;
+    for ( SSStarPipeline::Vertex &v : vertices32 )
+        if ( ! drawTable.idents[v.index].empty() && identCount[ drawTable.idents[v.index][0] ] == 1 )
+            byIdent[ drawTable.idents[v.index][0] ] = v;
+
+    double compactPixels = 0.0;
+    for ( SSStarPipeline::Vertex &v : compactVertices )
+    {
+        auto it = byIdent.find ( compactTable.ident[v.index] );
+        if ( it != byIdent.end() )
+            compactPixels = max ( compactPixels, (double) hypot ( it->second.x - v.x, it->second.y - v.y ) );
+    }
+
+    cout << format ( "Compact star table: %zu of %zu stars, %.1f bytes per star (objects %.1f); %zu drawn, max position difference %.1e pixels",
+                     numCompact, brightest.size(), (double) compactTable.memoryUsage() / numCompact, (double) brightest.memoryUsage() / brightest.size(),
+                     compactVertices.size(), compactPixels ) << endl;
+
+    // Draw the whole sky with and without horizon culling, and count stars above the horizon missing from the culled frame.
+    
+    SSView sky ( kMollweide, SSAngle::fromDegrees ( 360.0 ), 1024, 512, 512, 256 );
+    sky.setCenter ( SSAngle::fromDegrees ( 180.0 ), 0.0, 0.0 );
+    vector<SSStarPipeline::Vertex> allVertices, upVertices;
+    pipeline.render ( coords, sky, kHorizon, style, allVertices );
+    style.horizon = true;
+    pipeline.render ( coords, sky, kHorizon, style, upVertices );
+    style.horizon = false;
+    
+    int numMissing = 0;
+    for ( size_t i = 0, j = 0; i < allVertices.size(); i++ )
+    {
+        while ( j < upVertices.size() && upVertices[j].index < allVertices[i].index )
+            j++;
+        if ( j < upVertices.size() && upVertices[j].index == allVertices[i].index )
+            continue;
+        SSVector dir = coords.transform<kFundamental, kHorizon> ( drawTable.direction[ allVertices[i].index ] );
+        if ( SSCoordinates::applyRefraction ( asin ( dir.z ) ) >= 0.0 )
+            numMissing++;
+    }
+    
+    cout << "Star pipeline (horizon culling): " << upVertices.size() << " of " << allVertices.size() << " stars drawn, ";
+    cout << pipeline.getStats().culled << " culled before ephemeris, " << numMissing << " above the horizon missing" << endl;
+
+    // From an observer 1000 AU from the Sun, draw the view applying parallax only where it moves stars half a pixel or more,
+    // and compare star positions with applying it to every star.
+    
+    SSVector obsPos = coords.getObserverPosition();
+    coords.setObserverPosition ( obsPos * ( 1000.0 / obsPos.magnitude() ) );
+    vector<SSStarPipeline::Vertex> farVertices, fastVertices;
+    pipeline.render ( coords, view, kHorizon, style, farVertices );
+    style.parallaxPixels = 0.5;
+    pipeline.render ( coords, view, kHorizon, style, fastVertices );
+    float plxLimit = coords.starParallaxLimit ( style.parallaxPixels * fabs ( view.getScaleX() ) );
+    style.parallaxPixels = 0.0;
+    coords.setObserverPosition ( obsPos );
+    
+    maxPixels = 0.0;
+    int numSignificant = 0;
+    for ( size_t i = 0, j = 0; i < farVertices.size() && j < fastVertices.size(); i++ )
+    {
+        while ( j < fastVertices.size() && fastVertices[j].index < farVertices[i].index )
+            j++;
+        if ( j < fastVertices.size() && fastVertices[j].index == farVertices[i].index )
+            maxPixels = max ( maxPixels, (double) hypot ( fastVertices[j].x - farVertices[i].x, fastVertices[j].y - farVertices[i].y ) );
+    }
+    for ( float plx : drawTable.parallax )
+        numSignificant += plx >= plxLimit;
+
+    cout << "Star pipeline (parallax limit " << format ( "%.3f", plxLimit ) << " arcsec at 1000 AU): " << numSignificant << " of ";
+    cout << drawTable.size() << " stars get parallax, " << fastVertices.size() << " of " << farVertices.size() << " drawn, max position difference " << format ( "%.2f", maxPixels ) << " pixels" << endl;
+
+    // Compare compile-time frame transformation and projection with the runtime versions.
+    
+    SSView stereo = view, mollweide = view;
+    stereo.setProjection ( kStereographic );
+    mollweide.setProjection ( kMollweide );
+    numDiff = 0;
+    for ( int i = 0; i < brightest.size(); i++ )
+    {
+        SSVector dir = brightest[i]->getDirection();
+        SSVector hor = coords.transform<kFundamental, kHorizon> ( dir );
+        if ( hor != coords.transform ( kFundamental, kHorizon, dir ) || coords.transform<kEcliptic, kGalactic> ( dir ) != coords.transform ( kEcliptic, kGalactic, dir ) )
+            numDiff++;
+        
+        SSVector v0 = stereo.project ( hor ), v1 = stereo.project<kStereographic> ( hor );
+        SSVector v2 = mollweide.project ( hor ), v3 = mollweide.project<kMollweide> ( hor );
+        if ( v0 != v1 || v2 != v3 )
+            numDiff++;
+    }
+    
+    cout << "Compile-time transforms and projections: " << numDiff << " of " << brightest.size() << " bright stars differ from runtime versions" << endl;
+    
+    // Time a spatial search of a million objects, copied from the bright stars, with and without an index.
+    
+    SSObjectArray million ( SSObjectArena::kDefaultSlabSize );
+    {
+        SSObjectArena::Scope scope ( million.getArena() );
+        for ( int i = 0; i < 1000000; i++ )
+            million.append ( new SSStar ( *SSGetStarPtr ( brightest[ i % brightest.size() ] ) ) );
+    }
+
+    // Objects in an arena belong to the array which owns it; other arrays refuse them, but accept objects on the heap.
+
+    SSObjectArray other;
+    bool owned = SSObjectArena::getOwner ( million[0] ) == million.getArena() && SSObjectArena::getOwner ( brightest[0] ) == nullptr;
+    bool refused = ! other.append ( million[0] ) && other.append ( new SSStar ( *SSGetStarPtr ( brightest[0] ) ) );
+    cout << "Arena ownership: " << million.getArena()->getNumSlabs() << " slabs, owners " << ( owned ? "correct" : "WRONG" ) << ", other array's objects " << ( refused ? "refused" : "ACCEPTED" ) << endl;
+
+    vector<size_t> found;
+    auto start = chrono::steady_clock::now();
+    int numFound = million.search ( SSVector ( 1.0, 0.0, 0.0 ), SSAngle::fromDegrees ( 10.0 ), found );
+    double msec = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+    cout << "Spatial search: " << numFound << " of " << million.size() << " objects found in " << format ( "%.1f", msec ) << " ms" << endl;
+    
+    million.buildIndex();
+    vector<size_t> indexed;
+    start = chrono::steady_clock::now();
+    numFound = million.search ( SSVector ( 1.0, 0.0, 0.0 ), SSAngle::fromDegrees ( 10.0 ), indexed );
+    msec = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+    cout << "Indexed spatial search: " << numFound << " objects found in " << format ( "%.1f", msec ) << " ms, " << ( indexed == found ? "same as" : "DIFFERENT from" ) << " linear search" << endl;
+
+    // Identify constellations of the bright stars in one batch and compare with one at a time; then time a batch of a million.
+
+    vector<int> cons;
+    SSConstellation::identify ( table, cons );
+    numDiff = 0;
+    for ( int i = 0; i < brightest.size(); i++ )
+        if ( SSConstellation::indexToAbbreviation ( cons[i] ) != SSConstellation::identify ( SSGetStarPtr ( brightest[i] )->getFundamentalPosition() ) )
+            numDiff++;
+
+    start = chrono::steady_clock::now();
+    SSConstellation::identify ( million, cons );
+    msec = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+    cout << "Constellations: " << numDiff << " of " << brightest.size() << " bright stars differ from individual identification; " << cons.size() << " objects identified in " << format ( "%.1f", msec ) << " ms" << endl;
+
+    // Count stars brighter than magnitude 6 in the million-object array in parallel with the shared thread pool.
+
+    atomic<int> numBright ( 0 );
+    SSParallelFor ( million, [&million, &numBright] ( size_t begin, size_t end )
+    {
+        int n = 0;
+        for ( size_t i = begin; i < end; i++ )
+            n += million[i]->getMagnitude() < 6.0;
+        numBright += n;
+    } );
+
+    int numSerial = 0;
+    for ( int i = 0; i < million.size(); i++ )
+        numSerial += million[i]->getMagnitude() < 6.0;
+    cout << "Thread pool: " << SSThreadPool::shared().size() << " threads counted " << numBright << " stars brighter than mag 6 (" << numSerial << " serially)" << endl;
+
+    // Filter the million-object array in parallel and compare with a serial search; then sort it by magnitude
+    // with a capturing lambda, in parallel, and by key, and check both orders.
+
+    float magLimit = 6.0;
+    vector<SSObjectPtr> serialBright, parallelBright;
+    million.search ( [magLimit] ( const SSObjectPtr &pObj ) { return pObj->getMagnitude() < magLimit; }, serialBright );
+    million.filter ( [magLimit] ( const SSObjectPtr &pObj ) { return pObj->getMagnitude() < magLimit; }, parallelBright );
+
+    auto byMag = [] ( const SSObjectPtr &p1, const SSObjectPtr &p2 ) { return p1->getMagnitude() < p2->getMagnitude(); };
+    start = chrono::steady_clock::now();
+    million.parallelSort ( byMag );
+    double sortMsec = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+    bool sorted = true;
+    for ( size_t i = 1; i < million.size() && sorted; i++ )
+        sorted = ! byMag ( million[i], million[i - 1] );
+
+    start = chrono::steady_clock::now();
+    million.sortByKey ( [] ( const SSObjectPtr &pObj ) { return pObj->getMagnitude(); }, 0 );
+    double keyMsec = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+    bool keySorted = true;
+    for ( size_t i = 1; i < million.size() && keySorted; i++ )
+        keySorted = ! byMag ( million[i], million[i - 1] );
+
+    cout << "Parallel filter: " << parallelBright.size() << " stars brighter than mag 6, " << ( parallelBright == serialBright ? "same as" : "DIFFERENT from" ) << " serial search" << endl;
+    cout << "Parallel sort by magnitude: " << ( sorted ? "sorted" : "NOT SORTED" ) << " in " << format ( "%.1f", sortMsec ) << " ms; ";
+    cout << "by key: " << ( keySorted ? "sorted" : "NOT SORTED" ) << " in " << format ( "%.1f", keyMsec ) << " ms" << endl;
+    
+    vector<SSObjectArray::Match> matches;
+    int numMatches = brightest.crossMatch ( nearest, SSAngle::fromArcsec ( 60.0 ), matches );
+    cout << "Cross-match: " << numMatches << " nearby stars within 1 arcmin of bright stars" << endl;
+    
+    SSCrossMatchTable crossTable;
+    SSCrossMatchObjects ( brightest, nearest, kCatHIP, SSAngle::fromArcsec ( 60.0 ), 1.0, crossTable, 0 );
+    int numIdentified = (int) count_if ( crossTable.begin(), crossTable.end(), [] ( const SSCrossMatch &match ) { return match.identified; } );
+    cout << "Cross-identification: " << SSBestCrossMatches ( crossTable ) << " nearby stars matched bright stars, " << numIdentified << " by HIP number" << endl;
+    
+    // Time parsing a million identifier strings: the bright stars' identifiers and names, repeated.
+    
+    vector<string> identStrs;
+    for ( int i = 0; identStrs.size() < 1000000; i = ( i + 1 ) % brightest.size() )
+    {
+        for ( SSIdentifier ident : brightest[i]->getIdentifierSpan() )
+            identStrs.push_back ( ident.toString() );
+        for ( const SSIString &name : brightest[i]->getInternedNames() )
+            identStrs.push_back ( name );
+    }
+    
+    int numParsed = 0;
+    start = chrono::steady_clock::now();
+    for ( const string &str : identStrs )
+        numParsed += SSIdentifier::fromString ( str, kTypeStar, false ) ? 1 : 0;
+    msec = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+    cout << "Identifier parsing: " << numParsed << " of " << identStrs.size() << " strings parsed in " << format ( "%.1f", msec ) << " ms" << endl;
+    
+    // Find lunar occultations of bright stars in 2026, from an HTM holding copies of the bright stars.
+    
+    SSObjectVec solsys, copies;
+    SSImportObjectsFromCSV ( inputDir + "/SolarSystem/Planets.csv", solsys );
+    SSImportObjectsFromCSV ( inputDir + "/SolarSystem/Moons.csv", solsys );
+    for ( int i = 0; i < brightest.size(); i++ )
+        copies.append ( SSCloneObject ( brightest[i] ) );
+    
+    SSHTM htm ( { 2.0, 4.0, 6.0, INFINITY }, "" );
+    htm.store ( copies );
+    copies.clear();
+    
+    // Account for memory used by the bright stars, the HTM's regions at each magnitude level, and its name index.
+    
+    vector<size_t> levelBytes = htm.getLevelBytes();
+    size_t htmBytes = 0;
+    for ( size_t bytes : levelBytes )
+        htmBytes += bytes;
+    htm.makeObjectMap ( kCatUnknown );
+    cout << format ( "Memory: bright stars %.0f KB; HTM copies %.0f KB in %d levels (level 0 %.1f KB); name index %.0f KB; string pool %.0f KB",
+                     brightest.memoryUsage() / 1024.0, htmBytes / 1024.0, (int) levelBytes.size(), levelBytes.empty() ? 0.0 : levelBytes[0] / 1024.0,
+                     htm.getIndexBytes() / 1024.0, SSStringPool::global().memoryUsage() / 1024.0 ) << endl;
+    
+    // Save the HTM to an archive, then read it into memory, as a web build would fetch it, and open it from there.
+    
+    if ( ! outputDir.empty() )
+    {
+        string path = outputDir + "/BrightStars.htmarc";
+        int nSaved = htm.saveArchive ( path );
+        vector<char> bytes;
+        SSHTM fetched ( {}, "" );
+        int nLoaded = fetchfile ( path, bytes ) && fetched.openArchive ( move ( bytes ) ) ? fetched.loadRegions() : 0;
+        cout << "HTM archive in memory: " << nLoaded << " of " << nSaved << " regions loaded" << endl;
+
+        // Save the regions as files with their statistics; then estimate bright star counts and memory from those statistics
+        // in an HTM which has loaded no regions.
+
+        SSHTM saved ( { 2.0, 4.0, 6.0, INFINITY }, outputDir );
+        SSObjectVec starCopies;
+        for ( int i = 0; i < brightest.size(); i++ )
+            starCopies.append ( SSCloneObject ( brightest[i] ) );
+        saved.store ( starCopies );
+        starCopies.clear();
+        saved.saveRegions();
+
+        SSHTM planned ( { 2.0, 4.0, 6.0, INFINITY }, outputDir );
+        int numBright4 = 0;
+        for ( int i = 0; i < brightest.size(); i++ )
+            numBright4 += brightest[i]->getMagnitude() < 4.0;
+        cout << "HTM statistics: " << planned.countRegions() << " regions loaded; estimated " << planned.estimateStars ( 0, 4.0 ) << " stars brighter than mag 4 (";
+        cout << numBright4 << " counted), " << planned.estimateStars ( 0 ) << " in all, " << format ( "%.0f KB", planned.estimateBytes ( 0 ) / 1024.0 ) << endl;
+
+        SSAsync<int> regionTask = planned.loadRegionsAsync();
+        int numAsyncRegions = regionTask.get();
+        cout << "Async region load: " << numAsyncRegions << " regions, " << planned.countStars() << " stars loaded; progress " << regionTask.getDone() << " of " << regionTask.getTotal() << endl;
+    }
+    
+    vector<SSOccultation::Event> occultations;
+    start = chrono::steady_clock::now();
+    SSOccultation::findOccultations ( htm, solsys[10], SSTime ( SSDate ( kGregorian, 0.0, 2026, 1, 1.0, 0, 0, 0.0 ) ), SSTime ( SSDate ( kGregorian, 0.0, 2027, 1, 1.0, 0, 0, 0.0 ) ), 4.0, occultations, 0 );
+    msec = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+    cout << "Lunar occultations of stars brighter than mag 4 in 2026: " << occultations.size() << " found in " << format ( "%.1f", msec ) << " ms" << endl;
+    for ( SSOccultation::Event &event : occultations )
+    {
+        if ( event.magnitude > 1.5 )
+            continue;
+        
+        vector<SSOccultation::TrackPoint> track;
+        SSOccultation::groundTrack ( solsys[10], event, 10.0 / SSTime::kMinutesPerDay, track );
+        cout << "First occultation of " << event.pStar->getName ( 0 ) << ": " << SSDate ( event.time ).format ( "%Y-%m-%d %H:%M:%S" ) << format ( " gamma %+.4f, ", event.gamma ) << track.size() << " ground track points" << endl;
+        break;
+    }
+    
+    if ( ! outputDir.empty() )
+    {
+        numStars = SSExportObjectsToCSV ( outputDir + "/ExportedNearbyStars.csv", nearest );
+        cout << "Exported " << numStars << " nearby stars to " << outputDir + "/ExportedNearbyStars.csv" << endl;
+
+        numStars = SSExportObjectsToCSV ( outputDir + "/ExportedBrightStars.csv", brightest );
+        cout << "Exported " << numStars << " bright stars to " << outputDir + "/ExportedBrightStars.csv" << endl;
+
+        numStars = testBinaryCatalog ( outputDir + "/BrightStars.sscat", brightest );
+        cout << "Binary catalog round trip: " << numStars << " of " << brightest.size() << " bright stars match CSV" << endl;
+    }
+}
+
+// Returns IDs of all regions in an HTM's mesh, from the origin region (0) down to its faintest magnitude level.
+
+vector<uint64_t> htmRegionIDs ( SSHTM &htm )
+{
+    vector<uint64_t> ids = { 0 };
+    for ( size_t i = 0; i < ids.size(); i++ )
+    {
+        vector<uint64_t> subIDs = htm.subRegionIDs ( ids[i] );
+        ids.insert ( ids.end(), subIDs.begin(), subIDs.end() );
+    }
+    
+    return ids;
+}
+
+void TestHTM ( string inputDir, string outputDir )
+{
+    if ( outputDir.empty() )
+        return;
+    
+    // Save copies of the bright stars, with magnitudes computed for J2000, as region files of an HTM with four magnitude levels.
+    
+    SSObjectVec brightest, copies;
+    SSImportObjectsFromCSV ( inputDir + "/Stars/Brightest.csv", brightest );
+    SSCoordinates coords ( SSTime ( SSTime::kJ2000 ), SSSpherical ( 0.0, 0.0, 0.0 ) );
+    for ( int i = 0; i < brightest.size(); i++ )
+    {
+        brightest[i]->computeEphemeris ( coords );
+        copies.append ( SSCloneObject ( brightest[i] ) );
+    }
+    
+    vector<float> magLevels = { 2.0, 4.0, 6.0, INFINITY };
+    SSHTM saved ( magLevels, outputDir );
+    saved.store ( copies );
+    copies.clear();
+    saved.saveRegions();
+    vector<uint64_t> ids = htmRegionIDs ( saved );
+    
+    // Load every region under a budget of a third of the stars and memory, with the two brightest levels pinned.
+    // The totals must stay within budget after each load; afterwards, the pinned regions must all be in memory,
+    // and an evicted region must reload with as many stars as it had before.
+    
+    SSHTM budget ( magLevels, outputDir );
+    size_t maxObjects = budget.estimateStars ( 0 ) / 3, maxBytes = budget.estimateBytes ( 0 ) / 3;
+    budget.setMemoryBudget ( maxObjects, maxBytes );
+    budget.setPinnedLevels ( 2 );
+    
+    map<uint64_t,int> counts;
+    size_t peakObjects = 0, peakBytes = 0;
+    for ( uint64_t id : ids )
+    {
+        if ( budget.loadRegion ( id ) )
+            counts[id] = budget.countStars ( id );
+        peakObjects = max ( peakObjects, budget.getLoadedObjects() );
+        peakBytes = max ( peakBytes, budget.getLoadedBytes() );
+    }
+    
+    int numPinned = 0, numPinnedKept = 0, numEvicted = 0;
+    uint64_t evictedID = 0;
+    for ( auto &entry : counts )
+    {
+        bool loaded = budget.regionLoaded ( entry.first );
+        if ( budget.IDlevel ( entry.first ) < budget.getPinnedLevels() )
+        {
+            numPinned++;
+            numPinnedKept += loaded;
+        }
+        else if ( ! loaded )
+        {
+            numEvicted++;
+            evictedID = entry.first;
+        }
+    }
+    
+    int numReloaded = numEvicted > 0 && budget.loadRegion ( evictedID ) ? budget.countStars ( evictedID ) : 0;
+    bool withinBudget = peakObjects <= maxObjects && peakBytes <= maxBytes;
+    cout << format ( "HTM memory budget: %zu regions loaded, %d evicted; at most %zu of %zu stars, %.0f of %.0f KB in memory (%s); ",
+                     counts.size(), numEvicted, peakObjects, maxObjects, peakBytes / 1024.0, maxBytes / 1024.0, withinBudget ? "within budget" : "OVER BUDGET" );
+    cout << numPinnedKept << " of " << numPinned << " pinned regions kept; evicted region " << budget.ID2name ( evictedID ) << " reloaded with ";
+    cout << numReloaded << " of " << counts[evictedID] << " stars" << endl;
+    
+    // Queue background loads of the two faintest levels' regions on four worker threads, nearest Vega first, then cancel
+    // every other one. Only regions not yet loaded can be cancelled; once the queue drains, none of those must be loaded,
+    // and all the others must be.
+    
+    SSHTM pool ( magLevels, outputDir );
+    pool.setLoadThreadCount ( 4 );
+    pool.setLoadCenter ( SSSpherical ( SSAngle::fromDegrees ( 279.23 ), SSAngle::fromDegrees ( 38.78 ) ) );
+    
+    vector<uint64_t> queued;
+    for ( uint64_t id : ids )
+    {
+        if ( pool.IDlevel ( id ) >= 2 && saved.regionLoaded ( id ) )
+        {
+            pool.loadRegion ( id, false );
+            queued.push_back ( id );
+        }
+    }
+    
+    int numQueued = pool.pendingLoads(), numCancelled = 0, numWrong = 0;
+    vector<bool> cancelled ( queued.size(), false );
+    for ( size_t i = 0; i < queued.size(); i += 2 )
+    {
+        bool wasLoaded = pool.regionLoaded ( queued[i] );
+        cancelled[i] = pool.cancelLoad ( queued[i] );
+        numCancelled += cancelled[i];
+        numWrong += cancelled[i] && wasLoaded;
+    }
+    
+    auto start = chrono::steady_clock::now();
+    while ( pool.pendingLoads() > 0 && chrono::steady_clock::now() - start < chrono::seconds ( 60 ) )
+        this_thread::sleep_for ( chrono::milliseconds ( 1 ) );
+    
+    int numLoaded = 0;
+    for ( size_t i = 0; i < queued.size(); i++ )
+    {
+        bool loaded = pool.regionLoaded ( queued[i] );
+        numLoaded += loaded;
+        numWrong += cancelled[i] == loaded;
+    }
+    
+    cout << "HTM load workers: " << numQueued << " of " << queued.size() << " regions pending, " << numCancelled << " cancelled, " << numLoaded << " loaded; ";
+    cout << pool.pendingLoads() << " pending afterwards, " << numWrong << " wrong" << endl;
+    
+    // Search 10-degree circles around bright stars on four threads while another thread loads every region three times,
+    // evicting regions down to half the memory budget after each pass. Objects found stay valid until the next eviction,
+    // so searchers pause while regions are evicted. Every star found must be intact: inside its circle, with a magnitude
+    // no fainter than the limit of its mesh level.
+    
+    SSHTM shared ( magLevels, outputDir );
+    shared.setMemoryBudget ( maxObjects / 2, maxBytes / 2 );
+    shared.setPinnedLevels ( 2 );
+    shared.loadRegions ( 0 );
+    
+    atomic<bool> loading ( true ), evicting ( false );
+    atomic<int> numSearching ( 0 ), numSearches ( 0 ), numFound ( 0 ), numBad ( 0 ), numEvictions ( 0 ), numLoads ( 0 );
+    SSAngle rad = SSAngle::fromDegrees ( 10.0 );
+    
+    thread loader ( [&]
+    {
+        for ( int pass = 0; pass < 3; pass++ )
+        {
+            numLoads += shared.loadRegionsAsync().get();
+            evicting = true;
+            while ( numSearching > 0 )
+                this_thread::yield();
+            numEvictions += shared.evictRegions();
+            evicting = false;
+        }
+        loading = false;
+    } );
+    
+    vector<thread> searchers;
+    for ( int t = 0; t < 4; t++ )
+        searchers.push_back ( thread ( [&, t]
+        {
+            for ( size_t k = t; loading || k < t + 100; k += 4 )
+            {
+                numSearching++;
+                if ( evicting )
+                {
+                    numSearching--;
+                    this_thread::yield();
+                    continue;
+                }
+                
+                SSVector center = SSGetStarPtr ( brightest[ ( k * 101 ) % brightest.size() ] )->getFundamentalPosition();
+                vector<SSObjectPtr> results;
+                numFound += shared.search ( 0, center, rad, results );
+                numSearches++;
+                for ( SSObjectPtr pObj : results )
+                {
+                    SSStar *pStar = SSGetStarPtr ( pObj );
+                    float mag = pStar ? pStar->getVMagnitude() : NAN;
+                    if ( pStar && isinf ( mag ) )
+                        mag = pStar->getBMagnitude();
+                    int level = pStar && pStar->getParallax() > 0.1 ? 0 : shared.magLevel ( mag );
+                    if ( level < 0 || ( level > 0 && mag > magLevels[level] ) || center.angularSeparation ( pStar->getFundamentalPosition() ) > rad + 1.0e-9 )
+                        numBad++;
+                }
+                numSearching--;
+            }
+        } ) );
+    
+    loader.join();
+    for ( thread &searcher : searchers )
+        searcher.join();
+    
+    cout << "HTM concurrent search: " << numSearches << " searches on 4 threads found " << numFound << " stars while loading " << numLoads;
+    cout << " regions, " << numEvictions << " evicted by evictRegions(); " << numBad << " invalid" << endl;
+    
+    // Pan a 10-degree view three degrees per frame along the equator for 30 frames, prefetching the next 10 frames' regions
+    // every 10 frames. Once the prefetched regions have loaded, every region with a data file which each of those frames
+    // shows must be in memory before the view reaches it.
+    
+    SSHTM panned ( magLevels, outputDir );
+    panned.setLoadThreadCount ( 2 );
+    SSView panView ( kGnomonic, SSAngle::fromDegrees ( 10.0 ), 1024, 768, 512, 384 );
+    
+    vector<int> numPrefetched;
+    int numShown = 0, numMissing = 0;
+    for ( int frame = 0; frame < 30; frame++ )
+    {
+        panView.setCenter ( SSAngle::fromDegrees ( frame * 3.0 ), 0.0, 0.0 );
+        SSVector center = panView.getCenterVector();
+        if ( frame % 10 == 0 )
+        {
+            panView.setCenter ( SSAngle::fromDegrees ( frame * 3.0 + 3.0 ), 0.0, 0.0 );
+            SSVector motion = panView.getCenterVector() - center;
+            panView.setCenter ( SSAngle::fromDegrees ( frame * 3.0 ), 0.0, 0.0 );
+            
+            numPrefetched.push_back ( panned.prefetch ( panView, motion, 10, INFINITY ) );
+            
+            auto start = chrono::steady_clock::now();
+            while ( panned.pendingLoads() > 0 && chrono::steady_clock::now() - start < chrono::seconds ( 60 ) )
+                this_thread::sleep_for ( chrono::milliseconds ( 1 ) );
+        }
+        
+        for ( int level = 1; level < magLevels.size(); level++ )
+        {
+            SSHTM::Cover cover;
+            panned.coverCircle ( center, panView.getAngularDiagonal() / 2.0, level, cover );
+            for ( const vector<SSHTM::IDRange> *ranges : { &cover.full, &cover.partial } )
+                for ( const SSHTM::IDRange &range : *ranges )
+                    for ( uint64_t id = range.first; id <= range.last; id++ )
+                        if ( saved.regionLoaded ( id ) )
+                        {
+                            numShown++;
+                            numMissing += ! panned.regionLoaded ( id );
+                        }
+        }
+    }
+    
+    cout << "HTM prefetch: " << numPrefetched[0] << ", " << numPrefetched[1] << ", " << numPrefetched[2] << " regions queued at frames 0, 10, 20; ";
+    cout << numMissing << " of " << numShown << " regions shown in 30 panned frames not loaded in time" << endl;
+    
+    // Convert the saved regions to binary catalog files; then load those into a fresh HTM, and compare each region's
+    // stars and their identifiers with the CSV regions.
+    
+    SSHTM csv ( magLevels, outputDir );
+    int numCSVRegions = csv.loadRegions();
+    csv.setDataFileWriteFunc ( SSHTMWriteBinaryRegion );
+    int numWritten = csv.saveRegions();
+    
+    SSHTM binary ( magLevels, outputDir );
+    binary.setDataFileReadFunc ( SSHTMReadBinaryRegion );
+    int numBinaryRegions = binary.loadRegions();
+    
+    int numDiffs = 0;
+    for ( uint64_t id : ids )
+    {
+        SSObjectVec *pCSV = csv.getObjects ( id ), *pBinary = binary.getObjects ( id );
+        size_t n = pCSV ? pCSV->size() : 0;
+        if ( n != ( pBinary ? pBinary->size() : 0 ) )
+        {
+            numDiffs++;
+            continue;
+        }
+        
+        for ( size_t i = 0; i < n; i++ )
+            numDiffs += (*pCSV)[i]->getIdentifiers() != (*pBinary)[i]->getIdentifiers();
+    }
+    
+    cout << "HTM binary regions: " << numWritten << " stars written, " << numBinaryRegions << " of " << numCSVRegions << " regions read back with ";
+    cout << binary.countStars() << " of " << csv.countStars() << " stars; " << numDiffs << " differences" << endl;
+    
+    // Search a view straddling the corner of four root triangles on the equator, and a view containing the north pole,
+    // with their view polygons. Compare with testing every loaded star against each polygon, and check each polygon
+    // contains every star its view shows.
+    
+    vector<SSObjectPtr> allStars;
+    for ( uint64_t id : ids )
+        for ( size_t i = 0; csv.getObjects ( id ) && i < csv.getObjects ( id )->size(); i++ )
+            allStars.push_back ( (*csv.getObjects ( id ))[i] );
+    
+    auto inPolygon = [] ( const SSHTM::Polygon &polygon, SSVector p )
+    {
+        for ( const SSHTM::Halfspace &h : polygon )
+            if ( h.normal * p < h.offset )
+                return false;
+        return true;
+    };
+    
+    SSView cornerView ( kGnomonic, SSAngle::fromDegrees ( 20.0 ), 1024, 768, 512, 384 );
+    cornerView.setCenter ( 0.0, 0.0, 0.0 );
+    SSView polarView ( kGnomonic, SSAngle::fromDegrees ( 40.0 ), 1024, 768, 512, 384 );
+    polarView.setCenter ( 0.0, SSAngle::fromDegrees ( 80.0 ), 0.0 );
+    vector<SSView *> views = { &cornerView, &polarView };
+    
+    vector<size_t> numViewFound, numBrute;
+    int numShownOutside = 0;
+    numDiffs = 0;
+    for ( SSView *pView : views )
+    {
+        SSHTM::Polygon polygon = SSHTM::viewPolygon ( *pView );
+        vector<SSObjectPtr> found;
+        csv.search ( 0, polygon, found );
+        
+        set<SSObjectPtr> foundSet ( found.begin(), found.end() ), bruteSet;
+        for ( SSObjectPtr pObj : allStars )
+        {
+            SSVector pos = SSGetStarPtr ( pObj )->getFundamentalPosition();
+            if ( pos.isinf() )
+                continue;
+            
+            bool inside = inPolygon ( polygon, pos );
+            if ( inside )
+                bruteSet.insert ( pObj );
+            
+            SSVector v = pView->project ( pos );
+            numShownOutside += v.z > 0.0 && pView->inBoundRect ( v.x, v.y ) && ! inside;
+        }
+        
+        numViewFound.push_back ( found.size() );
+        numBrute.push_back ( bruteSet.size() );
+        numDiffs += found.size() != foundSet.size() || foundSet != bruteSet;
+    }
+    
+    cout << "HTM view polygons: corner view " << numViewFound[0] << " stars (" << numBrute[0] << " brute force), polar view " << numViewFound[1] << " stars (";
+    cout << numBrute[1] << " brute force); " << numDiffs << " differ, " << numShownOutside << " stars shown outside polygons" << endl;
+    
+    // Search the same views progressively, at most 10 stars or 1 millisecond per step, until finished. The stars found
+    // must be those of a one-shot search, and the magnitude limit reached must never decrease from step to step.
+    
+    int numSteps = 0, numDecreases = 0;
+    numDiffs = 0;
+    for ( SSView *pView : views )
+    {
+        SSHTM::Polygon polygon = SSHTM::viewPolygon ( *pView );
+        vector<SSObjectPtr> found, progressive;
+        csv.search ( 0, polygon, found );
+        
+        SSHTM::Query query;
+        csv.startQuery ( query, 0, polygon );
+        float magLimit = csv.queryMagLimit ( query );
+        for ( int step = 0; step < 10000 && ! csv.queryFinished ( query ); step++ )
+        {
+            csv.continueQuery ( query, progressive, 10, 0.001 );
+            numDecreases += csv.queryMagLimit ( query ) < magLimit;
+            magLimit = csv.queryMagLimit ( query );
+            numSteps++;
+        }
+        
+        numDiffs += ! csv.queryFinished ( query ) || progressive.size() != found.size() || set<SSObjectPtr> ( progressive.begin(), progressive.end() ) != set<SSObjectPtr> ( found.begin(), found.end() );
+    }
+    
+    cout << "HTM progressive queries: " << numSteps << " steps; " << numDiffs << " differ from one-shot searches; magnitude limit decreased " << numDecreases << " times" << endl;
+    
+    // Aggregate the stars of every region below the origin. Each aggregate's count and total flux must equal those
+    // of its region's own stars plus its sub-regions' aggregates. Then save the aggregates, load them into another HTM,
+    // and compare them, and the aggregates each finds in the polar view, with the originals.
+    
+    int numAggregates = csv.makeAggregates ( 1 ), numAggDiffs = 0;
+    double maxFluxErr = 0.0;
+    for ( uint64_t id : ids )
+    {
+        SSHTM::Aggregate agg;
+        if ( id == 0 || ! csv.getAggregate ( id, agg ) )
+            continue;
+        
+        size_t count = 0;
+        double flux = 0.0;
+        for ( size_t i = 0; csv.getObjects ( id ) && i < csv.getObjects ( id )->size(); i++ )
+        {
+            SSStar *pStar = SSGetStarPtr ( (*csv.getObjects ( id ))[i] );
+            float mag = isinf ( pStar->getVMagnitude() ) ? pStar->getBMagnitude() : pStar->getVMagnitude();
+            if ( ! isinf ( mag ) && ! pStar->getFundamentalPosition().isinf() )
+            {
+                count++;
+                flux += pow ( 10.0, -0.4 * mag );
+            }
+        }
+        
+        for ( uint64_t subID : csv.subRegionIDs ( id ) )
+        {
+            SSHTM::Aggregate subAgg;
+            if ( csv.getAggregate ( subID, subAgg ) )
+            {
+                count += subAgg.count;
+                flux += pow ( 10.0, -0.4 * subAgg.mag );
+            }
+        }
+        
+        numAggDiffs += count != agg.count;
+        maxFluxErr = max ( maxFluxErr, fabs ( pow ( 10.0, -0.4 * agg.mag ) / flux - 1.0 ) );
+    }
+    
+    int numAggSaved = csv.saveAggregates();
+    SSHTM aggHTM ( magLevels, outputDir );
+    int numAggLoaded = aggHTM.loadAggregates();
+    for ( uint64_t id : ids )
+    {
+        SSHTM::Aggregate agg, loaded;
+        if ( csv.getAggregate ( id, agg ) != aggHTM.getAggregate ( id, loaded ) )
+            numAggDiffs++;
+        else if ( csv.getAggregate ( id, agg ) )
+            numAggDiffs += agg.count != loaded.count || fabs ( agg.mag - loaded.mag ) > 0.001 || agg.centroid.angularSeparation ( loaded.centroid ).toArcsec() > 0.1;
+    }
     
-    int numStars = SSImportObjectsFromCSV ( inputDir + "/Stars/Nearest.csv", nearest );
-    cout << "Imported " << numStars << " nearby stars" << endl;
+    vector<SSHTM::Aggregate> polarAggs, loadedPolarAggs;
+    csv.searchAggregates ( 2, SSHTM::viewPolygon ( polarView ), polarAggs );
+    aggHTM.searchAggregates ( 2, SSHTM::viewPolygon ( polarView ), loadedPolarAggs );
+    numAggDiffs += polarAggs.size() != loadedPolarAggs.size();
     
-    numStars = SSImportObjectsFromCSV ( inputDir + "/Stars/Brightest.csv", brightest );
-    cout << "Imported " << numStars << " bright stars" << endl;
+    cout << "HTM aggregates: " << numAggregates << " made, " << numAggSaved << " saved, " << numAggLoaded << " loaded; " << polarAggs.size() << " in polar view (";
+    cout << loadedPolarAggs.size() << " loaded); " << numAggDiffs << " differences, " << format ( "max flux error %.1e", maxFluxErr ) << endl;
     
-    if ( ! outputDir.empty() )
+    // Cover circles around a root triangle corner, the north pole, and Vega at mesh levels 3 and 8. Every star inside
+    // each circle, found by testing all of them, must be in a covered triangle; no star in a full triangle may be outside.
+    
+    vector<pair<SSVector,SSAngle>> circles =
     {
-        numStars = SSExportObjectsToCSV ( outputDir + "/ExportedNearbyStars.csv", nearest );
-        cout << "Exported " << numStars << " nearby stars to " << outputDir + "/ExportedNearbyStars.csv" << endl;
-
-        numStars = SSExportObjectsToCSV ( outputDir + "/ExportedBrightStars.csv", brightest );
-        cout << "Exported " << numStars << " bright stars to " << outputDir + "/ExportedBrightStars.csv" << endl;
+        { SSVector ( 1.0, 0.0, 0.0 ), SSAngle::fromDegrees ( 15.0 ) },
+        { SSVector ( 0.0, 0.0, 1.0 ), SSAngle::fromDegrees ( 20.0 ) },
+        { SSSpherical ( SSAngle::fromDegrees ( 279.23 ), SSAngle::fromDegrees ( 38.78 ) ), SSAngle::fromDegrees ( 5.0 ) }
+    };
+    
+    int numInside = 0, numUncovered = 0, numFull = 0, numFullOutside = 0, numRanges = 0;
+    for ( auto &circle : circles )
+    {
+        for ( int level : { 3, 8 } )
+        {
+            SSHTM::Cover cover;
+            numRanges += csv.coverCircle ( circle.first, circle.second, level, cover );
+            auto covered = [] ( const vector<SSHTM::IDRange> &ranges, uint64_t id )
+            {
+                for ( const SSHTM::IDRange &range : ranges )
+                    if ( id >= range.first && id <= range.last )
+                        return true;
+                return false;
+            };
+            
+            for ( SSObjectPtr pObj : allStars )
+            {
+                SSVector pos = SSGetStarPtr ( pObj )->getFundamentalPosition();
+                if ( pos.isinf() )
+                    continue;
+                
+                uint64_t id = csv.vector2ID ( pos, level - 1 );
+                bool inside = circle.first.angularSeparation ( pos ) <= circle.second;
+                bool full = covered ( cover.full, id );
+                numInside += inside;
+                numUncovered += inside && ! full && ! covered ( cover.partial, id );
+                numFull += full;
+                numFullOutside += full && ! inside;
+            }
+        }
     }
+    
+    cout << "HTM circle covers: " << numRanges << " ranges in 6 covers; " << numInside << " stars inside circles, " << numUncovered << " not covered; ";
+    cout << numFull << " in full triangles, " << numFullOutside << " of those outside circles" << endl << endl;
 }
 
 void TestDeepSky ( string inputDir, string outputDir )
@@ -298,6 +1669,27 @@ void TestDeepSky ( string inputDir, string outputDir )
     numObjs = SSImportObjectsFromCSV ( inputDir + "/DeepSky/Caldwell.csv", caldwell );
     cout << "Imported " << numObjs << " Caldwell objects" << endl;
     
+    // Index Messier objects by size, and find those at least 10 arcminutes across overlapping a 30-degree circle
+    // around M31; compare with testing every object.
+    
+    SSDeepSkyIndex dsoIndex ( messier );
+    SSVector m31 = SSGetDeepSkyPtr ( messier[30] )->getFundamentalPosition();
+    SSAngle dsoRadius = SSAngle::fromDegrees ( 30.0 ), dsoMinSize = SSAngle::fromArcmin ( 10.0 );
+    vector<SSDeepSkyPtr> dsoFound;
+    dsoIndex.search ( m31, dsoRadius, dsoMinSize, dsoFound );
+    
+    int dsoLinear = 0;
+    for ( int i = 0; i < messier.size(); i++ )
+    {
+        SSDeepSkyPtr pDSO = SSGetDeepSkyPtr ( messier[i] );
+        if ( pDSO && pDSO->getMajorAxis() >= dsoMinSize && pDSO->getMajorAxis() < INFINITY
+            && m31.angularSeparation ( pDSO->getFundamentalPosition() ) <= dsoRadius + pDSO->getMajorAxis() / 2.0 )
+            dsoLinear++;
+    }
+    
+    cout << "Deep sky index: " << dsoIndex.size() << " Messier objects; " << dsoFound.size() << " at least 10' across within 30° of M31 (";
+    cout << dsoLinear << " by linear search)" << endl;
+    
     if ( ! outputDir.empty() )
     {
         numObjs = SSExportObjectsToCSV ( outputDir + "/ExportedMessier.csv", messier );
@@ -305,6 +1697,9 @@ void TestDeepSky ( string inputDir, string outputDir )
 
         numObjs = SSExportObjectsToCSV ( outputDir + "/ExportedCaldwell.csv", caldwell );
         cout << "Exported " << numObjs << " Caldwell objects to " << outputDir + "/ExportedCaldwell.csv" << endl;
+
+        numObjs = testBinaryCatalog ( outputDir + "/Messier.sscat", messier );
+        cout << "Binary catalog round trip: " << numObjs << " of " << messier.size() << " Messier objects match CSV" << endl;
     }
 }
 
@@ -326,19 +1721,81 @@ void TestJPLDEphemeris ( string inputDir )
     //    cout << jpldeph.getConstantName ( i ) << " = " << jpldeph.getConstantValue ( i ) << endl;
         
     double jed = SSTime ( SSDate ( kGregorian, 0.0, 2020, 1, 1.0, 0, 0, 0.0 ) ).getJulianEphemerisDate();
-    SSVector pos, vel;
+    SSVector pos, vel, allpos[SSJPLDEReader::kNumBodies], allvel[SSJPLDEReader::kNumBodies];
+    double maxdiff = 0.0;
     
+    jpldeph.compute ( 0x7FFu, jed, true, allpos, allvel );
     for ( int id = 0; id <= 10; id++ )
     {
         jpldeph.compute ( id, jed, true, pos, vel );
         cout << format ( "obj %2d  ", id );
         cout << format ( "pos %+12.8f %+12.8f %+12.8f  ", pos.x, pos.y, pos.z );
         cout << format ( "vel %+11.8f %+11.8f %+11.8f", vel.x, vel.y, vel.z ) << endl;
+        maxdiff = max ( maxdiff, ( allpos[id] - pos ).magnitude() + ( allvel[id] - vel ).magnitude() );
+    }
+    
+    cout << "Multi-body computation max difference: " << maxdiff << endl;
+    
+    // Measure every backend against DE438 in 25-year eras, and choose the fastest within 1 arcsecond,
+    // first with and then without JPL DE itself. Then check that a chosen backend is actually used.
+    
+    double jed0 = SSTime ( SSDate ( kGregorian, 0.0, 1950, 1, 1.0, 0, 0, 0.0 ) ).getJulianEphemerisDate();
+    vector<SSEphemerisPolicy::Measurement> measurements = SSEphemerisPolicy::measure ( jed0, jed0 + 100 * 365.25, 25 * 365.25, 20 );
+    for ( bool useJPLDE : { true, false } )
+    {
+        SSEphemerisPolicy policy = SSEphemerisPolicy::choose ( measurements, 1.0, useJPLDE );
+        int counts[5] = { 0 };
+        double maxerr = 0.0, ns = 0.0;
+        for ( SSEphemerisPolicy::Measurement &m : measurements )
+            if ( policy.select ( m.id, m.jed0 ) == m.backend )
+            {
+                counts[m.backend]++;
+                maxerr = max ( maxerr, m.maxError );
+                ns += m.nsPerCall;
+            }
+        
+        cout << format ( "Ephemeris policy %s JPL DE: %d measurements; chose JPL DE %d, VSOP/ELP %d, PS %d, VP %d; max error %.2f arcsec, %.0f ns per body",
+                        useJPLDE ? "with" : "without", (int) measurements.size(), counts[kBackendJPLDE], counts[kBackendVSOPELP], counts[kBackendPS], counts[kBackendVP],
+                        maxerr, ns / ( counts[1] + counts[2] + counts[3] + counts[4] ) ) << endl;
     }
     
+    SSEphemerisPolicy policy;
+    policy.set ( kMars, jed0, jed0 + 100 * 365.25, kBackendPS );
+    SSPlanet::setEphemerisPolicy ( policy );
+    SSPlanet mars ( kTypePlanet, kMars );
+    SSVector pspos, psvel;
+    mars.computePositionVelocity ( jed, 0.0, pos, vel );
+    SSPlanet::computeBackendPositionVelocity ( kBackendPS, kMars, jed, pspos, psvel );
+    SSPlanet::setEphemerisPolicy ( SSEphemerisPolicy() );
+    cout << "Mars with PS policy: difference from PS " << ( pos - pspos ).magnitude() << " AU" << endl;
+
+    // Open the long file below the short one, which it overlaps. The short file must compute dates it covers,
+    // the long file dates outside it; after closing the short file, the long one must compute all dates.
+
+    double jed1600 = SSTime ( SSDate ( kGregorian, 0.0, 1600, 1, 1.0, 0, 0, 0.0 ) ).getJulianEphemerisDate();
+    bool added = jpldeph.add ( inputDir + "/SolarSystem/DE438/1550_2650.438", -1 );
+    shared_ptr<SSJPLDEReader> shortFile = jpldeph.getReader ( 0 ), longFile = jpldeph.getReader ( 1 );
+    bool chosen = added && jpldeph.getFileCount() == 2 && longFile && longFile->getStartJED() < shortFile->getStartJED();
+    chosen = chosen && jpldeph.findReader ( jed ) == shortFile && jpldeph.findReader ( jed1600 ) == longFile;
+    chosen = chosen && jpldeph.compute ( kMars, jed1600, false, pos, vel );
+
+    SSVector shortpos, shortvel;
+    jpldeph.compute ( kMars, jed, false, shortpos, shortvel );
+    jpldeph.close ( shortFile );
+    bool fallback = jpldeph.getFileCount() == 1 && jpldeph.findReader ( jed ) == longFile && jpldeph.compute ( kMars, jed, false, pos, vel );
+    cout << format ( "Overlapping files: short file chosen %s; long file after closing it %s, Mars difference %.1e AU",
+                    chosen ? "OK" : "FAILED", fallback ? "OK" : "FAILED", ( pos - shortpos ).magnitude() ) << endl;
+
     jpldeph.close();
 }
 
+// Event function which returns an object's altitude above the horizon, in radians.
+
+double horizonAltitude ( SSCoordinates &coords, SSObjectPtr pObj1, SSObjectPtr pObj2 )
+{
+    return SSSpherical ( coords.transform<kFundamental, kHorizon> ( pObj1->getDirection() ) ).lat;
+}
+
 void TestEvents ( SSCoordinates coords, SSObjectVec &solsys )
 {
     SSTime now = coords.getTime();
@@ -377,6 +1834,17 @@ void TestEvents ( SSCoordinates coords, SSObjectVec &solsys )
         else
             cout << "Moonset:  " << date.format ( "%H:%M:%S" ) << format ( " @ %.1f°", moonpass.setting.azm * SSAngle::kDegPerRad ) << endl << endl;
 
+        // Compute the same circumstances for the Sun and Moon in a batch, with the planets, and check they agree.
+        
+        SSObjectVec sunMoonPlanets;
+        for ( int i = 0; i <= 10; i++ )
+            sunMoonPlanets.append ( SSCloneObject ( solsys[i] ) );
+        
+        vector<SSPass> passes;
+        int numpasses = SSEvent::riseTransitSet ( now, coords, sunMoonPlanets, SSEvent::kDefaultRiseSetAlt, SSEvent::kSunMoonRiseSetAlt, passes, 0 );
+        bool agrees = passes[0].rising.time == sunpass.rising.time && passes[10].setting.time == moonpass.setting.time;
+        cout << numpasses << " of " << passes.size() << " Sun, Moon, and planets rise, transit, or set today; batch " << ( agrees ? "agrees" : "DISAGREES" ) << endl << endl;
+
         SSTime time = SSEvent::nextMoonPhase ( now, pSun, pMoon, SSEvent::kNewMoon );
         date = SSDate ( time );
         cout << "New Moon:       " << date.format ( "%Y/%m/%d %H:%M:%S" ) << endl;
@@ -393,6 +1861,70 @@ void TestEvents ( SSCoordinates coords, SSObjectVec &solsys )
         date = SSDate ( time );
         cout << "Last Quarter:   " << date.format ( "%Y/%m/%d %H:%M:%S" ) << endl << endl;
         
+        // Precompute an almanac for the next 60 days here, and compare its full moon and next sunrise with the above.
+        
+        SSAlmanac almanac;
+        SSSpherical here = coords.getLocation();
+        almanac.build ( pSun, pMoon, now, now + 60.0, vector<SSSpherical> ( 1, SSSpherical ( here.lon, here.lat, here.rad ) ) );
+        double fulldiff = ( almanac.next ( SSAlmanac::kFullMoon, 0, now ) - SSEvent::nextMoonPhase ( now, pSun, pMoon, SSEvent::kFullMoon ) ) * SSTime::kSecondsPerDay;
+        SSPass tomorrow = SSEvent::riseTransitSet ( now + 1.0, coords, pSun, SSEvent::kSunMoonRiseSetAlt );
+        double risediff = ( almanac.next ( SSAlmanac::kSunrise, 0, tomorrow.rising.time - 0.5 ) - tomorrow.rising.time ) * SSTime::kSecondsPerDay;
+        cout << format ( "Almanac: %d events in 60 days; full moon differs by %.1f sec, tomorrow's sunrise by %.1f sec", (int) almanac.size(), fulldiff, risediff ) << endl << endl;
+
+        // Look up today's Sun and Moon passes through an event cache from a grid of 25 locations a few km apart
+        // around here, and compare them with passes computed directly.
+        
+        SSEventCache cache;
+        double cachediff = 0.0;
+        for ( int i = 0; i < 25; i++ )
+        {
+            SSCoordinates nearby ( now, SSSpherical ( here.lon + ( i % 5 - 2 ) * 0.0002, here.lat + ( i / 5 - 2 ) * 0.0002, here.rad ) );
+            for ( SSObjectPtr pObj : { pSun, pMoon } )
+            {
+                SSPass cached = cache.riseTransitSet ( now, nearby, pObj, SSEvent::kSunMoonRiseSetAlt );
+                SSPass direct = SSEvent::riseTransitSet ( now, nearby, pObj, SSEvent::kSunMoonRiseSetAlt );
+                for ( double diff : { cached.rising.time.jd - direct.rising.time.jd, cached.setting.time.jd - direct.setting.time.jd } )
+                    if ( ! isnan ( diff ) )
+                        cachediff = max ( cachediff, fabs ( diff ) * SSTime::kSecondsPerDay );
+            }
+        }
+        cout << format ( "Event cache: %d hits, %d misses from 25 nearby locations; max difference %.2f sec", (int) cache.getHits(), (int) cache.getMisses(), cachediff ) << endl << endl;
+
+        // Find solar and lunar eclipses in the next two years, the central line of each central solar eclipse,
+        // and the circumstances of the first solar eclipse seen here.
+
+        static const char *eclipseTypes[] = { "None", "Penumbral lunar", "Partial lunar", "Total lunar", "Partial solar", "Annular solar", "Total solar", "Hybrid solar" };
+        vector<SSEclipse::Global> eclipses;
+        double eclipseTime = clocksec();
+        SSEclipse::findEclipses ( pSun, pMoon, now, now + 730.5, true, true, eclipses, 100 );
+        eclipseTime = clocksec() - eclipseTime;
+        cout << format ( "%d eclipses in next two years, found in %.3f sec:", (int) eclipses.size(), eclipseTime ) << endl;
+
+        int localEclipse = -1;
+        SSEclipse::Local local;
+        for ( int i = 0; i < eclipses.size(); i++ )
+        {
+            SSEclipse::Global &e = eclipses[i];
+            date = SSDate ( SSTime ( e.greatest.jd, now.zone ) );
+            double magnitude = e.type == SSEclipse::kPenumbralLunar ? e.penumbral : e.magnitude;
+            cout << format ( "%-16s%s  magnitude %.4f  gamma %+.4f", eclipseTypes[e.type], date.format ( "%Y/%m/%d %H:%M:%S" ).c_str(), magnitude, e.gamma ) << endl;
+
+            vector<SSEclipse::PathPoint> path;
+            if ( SSEclipse::centralPath ( pSun, pMoon, e, 10.0 / SSTime::kMinutesPerDay, path ) > 0 )
+            {
+                SSEclipse::PathPoint &p = path[path.size() / 2];
+                cout << format ( "                central line has %d points; at middle, lon %+.2f lat %+.2f, width %.0f km", (int) path.size(), p.lon * SSAngle::kDegPerRad, p.lat * SSAngle::kDegPerRad, p.width ) << endl;
+            }
+
+            if ( localEclipse < 0 && SSEclipse::isSolar ( e.type ) && SSEclipse::localCircumstances ( pSun, pMoon, e, here, local ) )
+                localEclipse = i;
+        }
+
+        if ( localEclipse >= 0 )
+            cout << format ( "Solar eclipse here: maximum %s, magnitude %.3f, Sun altitude %.1f", SSDate ( SSTime ( local.max.jd, now.zone ) ).format ( "%Y/%m/%d %H:%M:%S" ).c_str(), local.magnitude, local.altitude.toDegrees() ) << endl << endl;
+        else
+            cout << "No solar eclipse is seen here." << endl << endl;
+
         // Find Jupiter-Saturn conjunctions in the next year
         
         SSObjectPtr pJup = solsys[5];
@@ -407,6 +1939,54 @@ void TestEvents ( SSCoordinates coords, SSObjectVec &solsys )
             SSDegMinSec sep = SSAngle ( conjunctions[i].value );
             cout << sep.format ( "%2hd° %2hd' %4.1f\"" ) << " on " << date.format ( "%Y/%m/%d %H:%M:%S" ) << endl;
         }
+        
+        // Find the same conjunctions by root finding, and check each is within a few seconds of one found above.
+        // Root finding reports one event per search step, where the recursive search may find several.
+        
+        vector<SSEventTime> refined;
+        SSEvent::useRootFinding ( true );
+        SSEvent::findConjunctions ( coords, pJup, pSat, now, now + 365.25, refined, 10 );
+        SSEvent::useRootFinding ( false );
+        double maxdiff = 0.0;
+        for ( SSEventTime &event : refined )
+        {
+            double diff = INFINITY;
+            for ( SSEventTime &conj : conjunctions )
+                diff = min ( diff, fabs ( event.time - conj.time ) * SSTime::kSecondsPerDay );
+            maxdiff = max ( maxdiff, diff );
+        }
+        cout << format ( "%d conjunctions found by root finding, within %.1f sec", (int) refined.size(), maxdiff ) << endl;
+        
+        // Find them again on all processor cores; this must give the same events as the single-threaded search.
+        
+        vector<SSEventTime> parallel;
+        SSEvent::findConjunctions ( coords, pJup, pSat, now, now + 365.25, parallel, 10, 0 );
+        bool same = parallel.size() == conjunctions.size();
+        for ( int i = 0; same && i < parallel.size(); i++ )
+            same = parallel[i].time.jd == conjunctions[i].time.jd && parallel[i].value == conjunctions[i].value;
+        cout << parallel.size() << " conjunctions found by parallel search, " << ( same ? "same as" : "DIFFERENT FROM" ) << " single-threaded search" << endl;
+
+        // Find all conjunctions within 5 degrees among the Sun, Moon, and planets in the next year in one group search,
+        // and check the Moon-Jupiter ones against the pairwise search.
+
+        vector<SSObjectConjunction> group;
+        SSEvent::findConjunctions ( coords, sunMoonPlanets, now, now + 365.25, 5.0 / SSAngle::kDegPerRad, group );
+        vector<SSEventTime> pairwise;
+        SSEvent::useRootFinding ( true );
+        SSEvent::findConjunctions ( coords, pJup, pMoon, now, now + 365.25, pairwise, 100 );
+        SSEvent::useRootFinding ( false );
+        int closeMoonJup = 0, matches = 0;
+        for ( SSEventTime &event : pairwise )
+        {
+            if ( event.value > 5.0 / SSAngle::kDegPerRad )
+                continue;
+            closeMoonJup++;
+            for ( SSObjectConjunction &conj : group )
+                if ( conj.obj1 == 5 && conj.obj2 == 10 && fabs ( conj.time - event.time ) < 1.0 / SSTime::kSecondsPerDay )
+                    matches++;
+        }
+        cout << group.size() << " conjunctions within 5° among Sun, Moon, and planets in the next year; ";
+        cout << closeMoonJup << " Moon-Jupiter " << ( matches == closeMoonJup ? "agree" : "DISAGREE" ) << " with pairwise search" << endl;
         cout << endl;
     }
 
@@ -428,6 +2008,37 @@ void TestEvents ( SSCoordinates coords, SSObjectVec &solsys )
     {
         vector<SSPass> passes;
         
+        // Pass screening only applies within 30 days of the TLE epoch.
+        
+        vector<SSTimeRange> windows;
+        SSTime epoch = SSGetSatellitePtr ( solsys[i] )->getTLE().jdepoch;
+        int numwindows = SSEvent::findSatellitePassWindows ( coords, solsys[i], epoch, epoch + 1.0, 0.0, windows );
+        double windowdays = 0.0;
+        for ( SSTimeRange &window : windows )
+            windowdays += window.stop - window.start;
+        cout << format ( "ISS pass search on TLE epoch day screened to %d windows, %.1f%% of the day", numwindows, windowdays * 100.0 ) << endl;
+        
+        // Screening must not drop passes: compare the screened passes' rising and setting times with those found by searching
+        // the whole day for the ISS's altitude crossing the horizon, without screening.
+        
+        vector<SSPass> screened;
+        vector<SSEventTime> risings, settings;
+        SSEvent::findSatellitePasses ( coords, solsys[i], epoch, epoch + 1.0, 0.0, screened, 100 );
+        SSEvent::findEqualityEvents ( coords, solsys[i], nullptr, epoch, epoch + 1.0, 1.0 / SSTime::kMinutesPerDay, true, 0.0, horizonAltitude, risings, 100 );
+        SSEvent::findEqualityEvents ( coords, solsys[i], nullptr, epoch, epoch + 1.1, 1.0 / SSTime::kMinutesPerDay, false, 0.0, horizonAltitude, settings, 100 );
+        
+        double maxRiseDiff = 0.0, maxSetDiff = 0.0;
+        for ( size_t k = 0; k < screened.size() && k < risings.size(); k++ )
+        {
+            maxRiseDiff = max ( maxRiseDiff, fabs ( screened[k].rising.time.jd - risings[k].time.jd ) * SSTime::kSecondsPerDay );
+            auto setting = find_if ( settings.begin(), settings.end(), [&] ( const SSEventTime &event ) { return event.time.jd > risings[k].time.jd; } );
+            maxSetDiff = setting == settings.end() ? INFINITY : max ( maxSetDiff, fabs ( screened[k].setting.time.jd - setting->time.jd ) * SSTime::kSecondsPerDay );
+        }
+        
+        cout << format ( "ISS passes on TLE epoch day: %zu screened, %zu risings unscreened; max rising difference %.2f sec, setting %.2f sec ",
+                         screened.size(), risings.size(), maxRiseDiff, maxSetDiff );
+        cout << ( screened.size() == risings.size() && maxRiseDiff <= 1.0 && maxSetDiff <= 1.0 ? "OK" : "FAILED" ) << endl;
+        
         int numpasses = SSEvent::findSatellitePasses ( coords, solsys[i], now, now + 1.0, 0.0, passes, 10 );
         cout << numpasses << " ISS passes in the next day:" << endl;
         for ( i = 0; i < numpasses; i++ )
@@ -441,6 +2052,41 @@ void TestEvents ( SSCoordinates coords, SSObjectVec &solsys )
             date = SSDate ( passes[i].setting.time );
             cout << format ( "Set:   %02hd:%02hd:%02.0f @ %.1f°", date.hour, date.min, date.sec, passes[i].setting.azm * SSAngle::kDegPerRad ) << endl << endl;
         }
+        
+        // Find passes of several satellites from several locations at once, and check them against single searches.
+        
+        SSObjectVec sats;
+        for ( i = 0; i < solsys.size() && sats.size() < 8; i++ )
+            if ( solsys[i]->getType() == kTypeSatellite )
+                sats.append ( solsys[i] );
+        
+        vector<SSSpherical> locs = { coords.getLocation(), SSSpherical ( SSAngle::fromDegrees ( 2.35 ), SSAngle::fromDegrees ( 48.86 ), 0.035 ), SSSpherical ( SSAngle::fromDegrees ( 151.21 ), SSAngle::fromDegrees ( -33.87 ), 0.0 ) };
+        vector<vector<SSPass>> allpasses;
+        int total = SSEvent::findSatellitePasses ( coords, sats, locs, epoch, epoch + 1.0, 0.0, allpasses, 100, 2 );
+        
+        int matched = 0;
+        for ( i = 0; i < allpasses.size(); i++ )
+        {
+            SSCoordinates loccoords ( coords );
+            loccoords.setLocation ( locs[ i % locs.size() ] );
+            passes.clear();
+            SSEvent::findSatellitePasses ( loccoords, sats[ i / locs.size() ], epoch, epoch + 1.0, 0.0, passes, 100 );
+            for ( int k = 0; k < passes.size() && k < allpasses[i].size(); k++ )
+                if ( fabs ( passes[k].rising.time - allpasses[i][k].rising.time ) < 1.0 / SSTime::kSecondsPerDay )
+                    matched++;
+        }
+        cout << format ( "Found %d passes of %d satellites from %d locations on TLE epoch day on 2 threads; %d match single searches", total, (int) sats.size(), (int) locs.size(), matched ) << endl;
+        
+        // Count the satellites' shadow entries and exits during those passes, and the passes visible after civil dusk.
+        
+        int changes = 0;
+        for ( vector<SSPass> &list : allpasses )
+            for ( SSPass &pass : list )
+                changes += (int) pass.shadows.size() - 1;
+        
+        int visible = SSEvent::findSatellitePasses ( coords, sats, locs, epoch, epoch + 1.0, 0.0, allpasses, 100, 2, SSEvent::kSunCivilDawnDuskAlt );
+        cout << format ( "Those passes have %d shadow entries and exits; %d passes are visible after civil dusk", changes, visible ) << endl << endl;
+        sats.clear();
     }
 }
 
@@ -462,6 +2108,87 @@ void TestEphemeris ( string inputDir, string outputDir )
     int nsat = SSImportSatellitesFromTLE ( inputDir + "/SolarSystem/Satellites/visual.txt", solsys );
     cout << "Imported " << nsat << " artificial satellites." << endl;
 
+    {
+        SSObjectVec refreshed;
+        SSTLEUpdate update;
+        SSImportSatellitesFromTLE ( inputDir + "/SolarSystem/Satellites/visual.txt", refreshed );
+        SSUpdateSatellitesFromTLE ( inputDir + "/SolarSystem/Satellites/visual.txt", refreshed, update );
+        cout << "Refreshed satellites from same TLEs: " << update.unchanged << " unchanged, " << update.changed.size() << " changed" << endl;
+        SSUpdateSatellitesFromTLE ( inputDir + "/SolarSystem/Satellites/all.txt", refreshed, update, true );
+        cout << format ( "Refreshed satellites from full catalog: %zu added, %zu changed, %zu removed, %d unchanged; %zu satellites",
+                         update.added.size(), update.changed.size(), update.removed.size(), update.unchanged, refreshed.size() ) << endl;
+    }
+
+    SSTLEArray tles;
+    for ( int i = 0; i < solsys.size(); i++ )
+    {
+        SSSatellitePtr pSat = SSGetSatellitePtr ( solsys.get ( i ) );
+        if ( pSat )
+            tles.push_back ( pSat->getTLE() );
+    }
+    
+    // Batch-propagate the visual satellites and deep-space satellites from the full catalog half a day after
+    // the first TLE's epoch, and compare with propagating each TLE separately.
+
+    SSTLEArray batch;
+    for ( size_t i = 0; i < tles.size(); i++ )
+        batch.push_back ( tles.get ( i ) );
+
+    SSObjectVec allSats;
+    SSImportSatellitesFromTLE ( inputDir + "/SolarSystem/Satellites/all.txt", allSats );
+    for ( int i = 0; i < allSats.size(); i++ )
+    {
+        SSSatellitePtr pSat = SSGetSatellitePtr ( allSats.get ( i ) );
+        if ( pSat && pSat->getTLE().deep )
+            batch.push_back ( pSat->getTLE() );
+    }
+
+    vector<SSVector> tlePos, tleVel;
+    double tleJD = tles.get ( 0 ).jdepoch + 0.5, maxNearDiff = 0.0, maxDeepDiff = 0.0;
+    batch.toPositionVelocity ( tleJD, tlePos, tleVel, 2 );
+    for ( size_t i = 0; i < batch.size(); i++ )
+    {
+        SSTLE tle = batch.get ( i );
+        SSVector pos, vel;
+        tle.toPositionVelocity ( tleJD, pos, vel );
+        if ( pos.isnan() && tlePos[i].isnan() )
+            continue;
+        double &maxDiff = tle.deep ? maxDeepDiff : maxNearDiff;
+        maxDiff = max ( maxDiff, pos.isnan() || tlePos[i].isnan() ? INFINITY : pos.distance ( tlePos[i] ) );
+    }
+    cout << format ( "Batch propagated %zu near-Earth and %zu deep-space satellites, max difference %.1e km and %.1e km ",
+                     batch.numNearEarth(), batch.numDeepSpace(), maxNearDiff, maxDeepDiff );
+    cout << ( maxNearDiff <= 1.0e-6 && maxDeepDiff == 0.0 ? "OK" : "FAILED" ) << endl;
+
+    vector<SSConjunction> conjunctions;
+    SSTime conjStart ( tles.get ( 0 ).jdepoch );
+    int nconj = SSEvent::findSatelliteConjunctions ( tles, conjStart, conjStart + 1.0, 50.0, conjunctions, 60.0, 2 );
+    SSConjunction closest = { 0, 0, conjStart, INFINITY, 0.0 };
+    for ( SSConjunction &conj : conjunctions )
+        if ( conj.distance < closest.distance )
+            closest = conj;
+    cout << format ( "Found %d satellite approaches within 50 km on first TLE's epoch day; closest %.1f km at %.1f km/s",
+                     nconj, closest.distance, closest.speed ) << endl;
+
+    SSGroundTrack groundTrack ( solsys );
+    vector<SSGroundTrack::Track> tracks;
+    size_t npoints = groundTrack.generate ( conjStart, conjStart + 0.25, tracks );
+    size_t nsegments = 0, nsplit = 0, nbad = 0;
+    for ( SSGroundTrack::Track &track : tracks )
+    {
+        nsegments += track.segments.size();
+        nsplit += track.segments.size() > 1;
+        for ( SSGroundTrack::Segment &segment : track.segments )
+            for ( size_t k = 1; k < segment.size(); k++ )
+                nbad += fabs ( segment[k].lon - segment[k - 1].lon ) > SSAngle::kPi || fabs ( segment[k].lon ) > SSAngle::kPi;
+    }
+    vector<SSGroundTrack::Footprint> footprints;
+    size_t nfoot = groundTrack.footprints ( conjStart, footprints ), npole = 0;
+    for ( SSGroundTrack::Footprint &fp : footprints )
+        npole += fp.pole != 0;
+    cout << format ( "Ground tracks of %zu satellites over 6 hours: %zu points in %zu segments, %zu split at antimeridian, %zu bad jumps; %zu footprints, %zu over a pole",
+                     tracks.size(), npoints, nsegments, nsplit, nbad, nfoot, npole ) << endl;
+
     int nnames = SSImportMcNames ( inputDir + "/SolarSystem/Satellites/mcnames.txt", solsys );
     cout << "Imported " << nnames << " McCants satellite names." << endl;
     
@@ -541,6 +2268,141 @@ void TestEphemeris ( string inputDir, string outputDir )
         cout << endl;
     }
 
+    // Compute all solar system objects at once with a snapshot, on one thread and on four,
+    // and verify the results match computing each object individually.
+
+    vector<SSVector> directions ( solsys.size() );
+    for ( int i = 0; i < solsys.size(); i++ )
+    {
+        solsys[i]->computeEphemeris ( coords );
+        directions[i] = solsys[i]->getDirection();
+    }
+    
+    SSEphemerisSnapshot snapshot ( solsys );
+    for ( int threads = 1; threads <= 4; threads *= 4 )
+    {
+        double maxdiff = 0.0;
+        snapshot.compute ( coords, threads );
+        for ( int i = 0; i < solsys.size(); i++ )
+            if ( ! directions[i].isinf() )
+                maxdiff = max ( maxdiff, ( solsys[i]->getDirection() - directions[i] ).magnitude() );
+        cout << format ( "Snapshot of %d objects on %d thread(s) max direction difference: %.1e", (int) snapshot.size(), threads, maxdiff ) << endl;
+    }
+
+    // Update ten frames a 60th of a second apart from a double buffer, each frame precomputed while the last was drawn;
+    // then jump a day ahead, which must be computed synchronously. Compare each frame with computing objects individually.
+
+    SSEphemerisPrefetch prefetch ( solsys );
+    SSCoordinates frameCoords = coords;
+    double frameJD = coords.getTime(), frameStep = 1.0 / 60.0 / SSTime::kSecondsPerDay, frameDiff = 0.0;
+    for ( int f = 0; f <= 10; f++ )
+    {
+        frameCoords.setTime ( SSTime ( f < 10 ? frameJD + f * frameStep : frameJD + 1.0 ) );
+        prefetch.update ( frameCoords, frameJD + ( f + 1 ) * frameStep );
+        for ( int i = 0; i < solsys.size(); i++ )
+        {
+            SSVector dir = solsys[i]->getDirection();
+            solsys[i]->computeEphemeris ( frameCoords );
+            if ( ! dir.isinf() )
+                frameDiff = max ( frameDiff, ( solsys[i]->getDirection() - dir ).magnitude() );
+        }
+    }
+    prefetch.invalidate();
+    cout << format ( "Double-buffered frames: %zu precomputed, %zu computed synchronously; max direction difference: %.1e",
+                     prefetch.getHits(), prefetch.getMisses(), frameDiff ) << endl;
+    cout << endl;
+
+    // Stream a table of all solar system objects at hourly times for two days, on four threads, and verify rows arrive
+    // in order and match computing each object individually at each time.
+
+    size_t ntimes = 48, nrows = 0;
+    double jd0 = coords.getTime(), maxdiff = 0.0;
+    SSCoordinates refCoords = coords;
+    vector<SSVector> refDirections ( ntimes * solsys.size() );
+    for ( size_t t = 0; t < ntimes; t++ )
+    {
+        refCoords.setTime ( SSTime ( jd0 + t / 24.0 ) );
+        for ( size_t i = 0; i < solsys.size(); i++ )
+        {
+            solsys[i]->computeEphemeris ( refCoords );
+            refDirections[t * solsys.size() + i] = refCoords.transform<kFundamental,kEquatorial> ( solsys[i]->getDirection() );
+        }
+    }
+
+    SSEphemerisTable table ( solsys, coords );
+    table.generate ( jd0, 1.0 / 24.0, ntimes, [&] ( const SSEphemerisTable::Row &row )
+    {
+        if ( row.timeIndex * solsys.size() + row.objectIndex != nrows++ )
+            maxdiff = INFINITY;
+        else if ( ! refDirections[nrows - 1].isinf() )
+            maxdiff = max ( maxdiff, ( SSSpherical ( row.equatorial.lon, row.equatorial.lat ).toVectorPosition() - refDirections[nrows - 1] ).magnitude() );
+    }, 4 );
+    cout << format ( "Ephemeris table of %d objects at %d times on 4 threads: %d rows, max direction difference: %.1e", (int) solsys.size(), (int) ntimes, (int) nrows, maxdiff ) << endl;
+
+    // Compute the planets' and Moon's positions and velocities every 0.37 days for ten years, without and with the Chebyshev
+    // ephemeris cache, and find their largest differences relative to heliocentric distance and speed; the Moon's relative
+    // to its geocentric distance and speed. Then find a year's new and full moons without and with the cache.
+    
+    double jed0 = SSTime ( SSDate ( kGregorian, 0.0, 2026, 1, 1.0, 0, 0, 0.0 ) ).getJulianEphemerisDate();
+    vector<SSVector> uncachedPos, uncachedVel;
+    double maxPlanetPosErr = 0.0, maxPlanetVelErr = 0.0, maxMoonPosErr = 0.0, maxMoonVelErr = 0.0;
+    for ( int cached = 0; cached < 2; cached++ )
+    {
+        SSPlanet::useEphemerisCache ( cached );
+        size_t i = 0;
+        for ( double jed = jed0; jed < jed0 + 3652.5; jed += 0.37 )
+        {
+            for ( int id = 1; id <= 10; id++, i++ )
+            {
+                SSVector pos, vel;
+                SSGetPlanetPtr ( solsys[id] )->computePositionVelocity ( jed, 0.0, pos, vel );
+                if ( ! cached )
+                {
+                    uncachedPos.push_back ( pos );
+                    uncachedVel.push_back ( vel );
+                    continue;
+                }
+                
+                SSVector refPos = uncachedPos[i], refVel = uncachedVel[i];
+                if ( id == 10 )
+                {
+                    refPos -= uncachedPos[i - 7];
+                    refVel -= uncachedVel[i - 7];
+                }
+                
+                double &maxPos = id == 10 ? maxMoonPosErr : maxPlanetPosErr, &maxVel = id == 10 ? maxMoonVelErr : maxPlanetVelErr;
+                maxPos = max ( maxPos, ( pos - uncachedPos[i] ).magnitude() / refPos.magnitude() );
+                maxVel = max ( maxVel, ( vel - uncachedVel[i] ).magnitude() / refVel.magnitude() );
+            }
+        }
+    }
+    
+    double phaseMS[2] = { 0.0, 0.0 }, maxPhaseDiff = 0.0;
+    vector<double> phaseTimes;
+    for ( int cached = 0; cached < 2; cached++ )
+    {
+        SSPlanet::useEphemerisCache ( cached );
+        auto start = chrono::steady_clock::now();
+        SSTime time ( jed0 );
+        for ( int i = 0; i < 25; i++ )
+        {
+            time = SSEvent::nextMoonPhase ( time + 1.0, solsys[0], solsys[10], i % 2 ? SSEvent::kFullMoon : SSEvent::kNewMoon );
+            if ( cached )
+                maxPhaseDiff = max ( maxPhaseDiff, fabs ( time.jd - phaseTimes[i] ) * SSTime::kSecondsPerDay );
+            else
+                phaseTimes.push_back ( time.jd );
+        }
+        phaseMS[cached] = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+    }
+    
+    SSPlanet::useEphemerisCache ( false );
+    cout << format ( "Ephemeris cache over ten years: planet position error %.1e, velocity error %.1e; Moon position error %.1e, velocity error %.1e ",
+                     maxPlanetPosErr, maxPlanetVelErr, maxMoonPosErr, maxMoonVelErr );
+    cout << ( maxPlanetPosErr <= 1.0e-9 && maxPlanetVelErr <= 3.6e-5 ? "OK" : "FAILED" ) << endl;
+    cout << format ( "Ephemeris cache moon phases: %d found in %.1f ms uncached, %.1f ms cached; max difference %.3f sec ",
+                     (int) phaseTimes.size(), phaseMS[0], phaseMS[1], maxPhaseDiff );
+    cout << ( maxPhaseDiff < 1.0 ? "OK" : "FAILED" ) << endl << endl;
+
     SSJPLDEphemeris::close();
 
     // Compute and print ephemeris information for the 10 nearest stars
@@ -611,6 +2473,20 @@ void TestELPMPP02 ( const string &datadir )
         cout << format ( "vel: %+13.5f  %+13.5f  %+13.5f km/day", vel.x, vel.y, vel.z ) << endl;
     }
     
+    // Compare a daily batch time series against computing each day individually.
+    
+    vector<SSVector> bpos, bvel;
+    double maxdiff = 0.0;
+    elp.computePositionVelocity ( testjd[0], 1.0, 1000, bpos, bvel );
+    for ( int i = 0; i < bpos.size(); i++ )
+    {
+        SSVector pos, vel;
+        elp.computePositionVelocity ( testjd[0] + i, pos, vel );
+        maxdiff = max ( maxdiff, pos.distance ( bpos[i] ) / pos.magnitude() );
+    }
+    
+    cout << format ( "Batch series max relative position difference: %.1e\n", maxdiff );
+    cout << format ( "Resident series size: %.0f KB\n", elp.getResidentSize() / 1024.0 );
     cout << endl;
 }
 
@@ -647,10 +2523,381 @@ void TestVSOP2013 ( const string &datadir )
             cout << format ( "vel: %+13.10f  %+13.10f  %+13.10f AU/day", vel.x, vel.y, vel.z ) << endl;
         }
     }
+
+    // Compare packed series evaluation against the original term-by-term evaluation.
+
+    double maxdiff = 0.0;
+    for ( double jed = 2411545.0; jed <= 2491545.0; jed += 40000.0 )
+    {
+        for ( int iplanet = 1; iplanet <= 9; iplanet++ )
+        {
+            SSVector pos0, vel0, pos1, vel1;
+
+            VSOP2013::usePackedSeries ( false );
+            vsop2013.computePositionVelocity ( iplanet, jed, pos0, vel0 );
+            VSOP2013::usePackedSeries ( true );
+            vsop2013.computePositionVelocity ( iplanet, jed, pos1, vel1 );
+            maxdiff = max ( maxdiff, pos0.distance ( pos1 ) / pos0.magnitude() );
+        }
+    }
+
+    cout << format ( "Packed series (%s) max relative position difference: %.1e\n", VSOP2013::simdAvailable() ? "SIMD" : "scalar", maxdiff );
+
+    // Compare shared batch trig kernels against libm.
+
+    vector<double> x ( 1001 ), y ( 1001 ), s ( 1001 ), c ( 1001 ), a ( 1001 ), b ( 1001 );
+    for ( size_t i = 0; i < x.size(); i++ )
+    {
+        x[i] = ( i - 500.0 ) * 0.937;
+        y[i] = ( i % 7 - 3.0 ) * 1.3;
+    }
+    
+    double sdiff = 0.0, adiff = 0.0, cdiff = 0.0;
+    vsincos ( x.data(), s.data(), c.data(), x.size() );
+    vatan2 ( y.data(), x.data(), a.data(), x.size() );
+    for ( size_t i = 0; i < x.size(); i++ )
+    {
+        sdiff = max ( sdiff, max ( fabs ( s[i] - sin ( x[i] ) ), fabs ( c[i] - cos ( x[i] ) ) ) );
+        adiff = max ( adiff, fabs ( a[i] - atan2 ( y[i], x[i] ) ) );
+        b[i] = x[i] / 468.6;
+    }
+    
+    vacos ( b.data(), a.data(), b.size() );
+    for ( size_t i = 0; i < b.size(); i++ )
+        cdiff = max ( cdiff, fabs ( a[i] - acos ( b[i] ) ) );
+    
+    cout << format ( "Trig kernels (%s) max difference from libm: sincos %.1e, atan2 %.1e, acos %.1e\n", trigSIMD(), sdiff, adiff, cdiff );
+
+    // Compare series-derivative velocities, and osculating orbit velocities, against numerical derivatives of position.
+
+    double maxdiff0 = 0.0;
+    maxdiff = 0.0;
+    for ( double jed = 2411545.0; jed <= 2491545.0; jed += 40000.0 )
+    {
+        for ( int iplanet = 1; iplanet <= 9; iplanet++ )
+        {
+            SSVector pos0, vel0, pos1, vel1, pos, vel;
+
+            vsop2013.computePositionVelocity ( iplanet, jed - 0.01, pos0, vel0 );
+            vsop2013.computePositionVelocity ( iplanet, jed + 0.01, pos1, vel1 );
+            SSVector dpdt = ( pos1 - pos0 ) / 0.02;
+            vsop2013.computePositionVelocity ( iplanet, jed, pos, vel );
+            maxdiff = max ( maxdiff, vel.distance ( dpdt ) / dpdt.magnitude() );
+            VSOP2013::usePackedSeries ( false );
+            vsop2013.computePositionVelocity ( iplanet, jed, pos, vel );
+            VSOP2013::usePackedSeries ( true );
+            maxdiff0 = max ( maxdiff0, vel.distance ( dpdt ) / dpdt.magnitude() );
+        }
+    }
+
+    cout << format ( "Velocity max relative difference from numerical derivative: %.1e series, %.1e osculating orbit\n", maxdiff, maxdiff0 );
+
+    // Compare daily batch time series against computing each day individually.
+    
+    maxdiff = 0.0;
+    for ( int iplanet = 1; iplanet <= 9; iplanet++ )
+    {
+        vector<SSVector> bpos, bvel;
+        vsop2013.computePositionVelocity ( iplanet, 2451545.0, 1.0, 1000, bpos, bvel );
+        for ( int i = 0; i < bpos.size(); i++ )
+        {
+            SSVector pos, vel;
+            vsop2013.computePositionVelocity ( iplanet, 2451545.0 + i, pos, vel );
+            maxdiff = max ( maxdiff, pos.distance ( bpos[i] ) / pos.magnitude() );
+        }
+    }
     
+    cout << format ( "Batch series max relative position difference: %.1e\n", maxdiff );
+
+    // Compute geocentric planet and Moon directions over 1950-2050 at each truncated precision tier, and compare with
+    // the full series; errors must stay within each tier's documented bound.
+
+    vector<double> jeds;
+    for ( double jed = 2433282.5; jed <= 2469807.5; jed += 73.1 )
+        jeds.push_back ( jed );
+
+    auto geocentric = [] ( int id, double jed, SSVector &dir )
+    {
+        SSVector pos, vel, epos, evel;
+        if ( ! SSPlanet::computeBackendPositionVelocity ( kBackendVSOPELP, id, jed, pos, vel ) )
+            return false;
+        if ( id != kLuna && ! SSPlanet::computeBackendPositionVelocity ( kBackendVSOPELP, kEarth, jed, epos, evel ) )
+            return false;
+        dir = ( id == kLuna ? pos : pos - epos ).normalize();
+        return true;
+    };
+
+    const int ids[] = { kMercury, kVenus, kMars, kJupiter, kSaturn, kUranus, kNeptune, kLuna };
+    vector<SSVector> full;
+    double prec = SSPlanet::getVSOPELPPrecision();
+    SSPlanet::setVSOPELPPrecision ( SSPlanet::kVSOPELPFull );
+    bool computed = true;
+    for ( double jed : jeds )
+        for ( int id : ids )
+        {
+            SSVector dir;
+            computed = computed && geocentric ( id, jed, dir );
+            full.push_back ( dir );
+        }
+
+    struct { double prec, bound; const char *name; } tiers[] = { { SSPlanet::kVSOPELPTenthArcsec, 0.1, "0.1\"" }, { SSPlanet::kVSOPELPArcsec, 1.0, "1\"" } };
+    for ( auto &tier : tiers )
+    {
+        double maxPlanet = 0.0, maxMoon = 0.0;
+        SSPlanet::setVSOPELPPrecision ( tier.prec );
+        for ( size_t i = 0, k = 0; i < jeds.size(); i++ )
+            for ( int id : ids )
+            {
+                SSVector dir;
+                computed = computed && geocentric ( id, jeds[i], dir );
+                double err = dir.angularSeparation ( full[k++] ).toArcsec();
+                double &maxErr = id == kLuna ? maxMoon : maxPlanet;
+                maxErr = max ( maxErr, err );
+            }
+
+        bool ok = computed && maxPlanet < tier.bound && maxMoon < tier.bound;
+        cout << format ( "Precision tier %s: max error vs. full series %.3f\" planets, %.3f\" Moon %s\n", tier.name, maxPlanet, maxMoon, ok ? "OK" : "FAILED" );
+    }
+    SSPlanet::setVSOPELPPrecision ( prec );
+
+    // Series are loaded on first use, and can be unloaded until used again.
+
+    size_t resident = 0;
+    for ( int iplanet = 1; iplanet <= 9; iplanet++ )
+        resident += vsop2013.getResidentSize ( iplanet );
+
+    vsop2013.unloadSeries ( 0 );
+    cout << format ( "Resident series size: %.0f KB; after unloading: %d KB\n", resident / 1024.0, (int) vsop2013.getResidentSize ( kPluto ) / 1024 );
     cout << endl;
 }
 
+void TestGzip ( string outputDir )
+{
+    // Twenty identical lines, gzip-compressed.
+
+    static const uint8_t fox[] =
+    {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x0b, 0xc9, 0x48, 0x55, 0x28, 0x2c,
+        0xcd, 0x4c, 0xce, 0x56, 0x48, 0x2a, 0xca, 0x2f, 0xcf, 0x53, 0x48, 0xcb, 0xaf, 0x50, 0xc8, 0x2a,
+        0xcd, 0x2d, 0x28, 0x56, 0xc8, 0x2f, 0x4b, 0x2d, 0x52, 0x28, 0x01, 0x4a, 0xe7, 0x24, 0x56, 0x55,
+        0x2a, 0xa4, 0xe4, 0xa7, 0xeb, 0x71, 0x85, 0x8c, 0x2a, 0x1e, 0x55, 0x3c, 0xaa, 0x98, 0xda, 0x8a,
+        0x01, 0xc5, 0x0d, 0xd0, 0x56, 0x84, 0x03, 0x00, 0x00
+    };
+
+    string text;
+    for ( int i = 0; i < 20; i++ )
+        text += "The quick brown fox jumps over the lazy dog.\n";
+
+    vector<char> bytes;
+    bool ok = SSGzipReader::gunzip ( fox, sizeof ( fox ), bytes ) && string ( bytes.begin(), bytes.end() ) == text;
+    bool truncated = ! SSGzipReader::gunzip ( fox, sizeof ( fox ) - 4, bytes );
+
+    // Write the compressed file, then read it back a line at a time; SSLineReader should decompress it.
+
+    string path = outputDir + "/Fox.txt.gz";
+    FILE *file = fopen ( path.c_str(), "wb" );
+    if ( file != nullptr )
+    {
+        fwrite ( fox, 1, sizeof ( fox ), file );
+        fclose ( file );
+    }
+
+    int lines = 0, matched = 0;
+    SSLineReader reader ( path );
+    string line;
+    while ( reader.getline ( line ) )
+    {
+        lines++;
+        matched += line == "The quick brown fox jumps over the lazy dog.";
+    }
+
+    cout << "Gzip: decompressed " << ( ok ? "correctly" : "INCORRECTLY" ) << ", truncated data " << ( truncated ? "rejected" : "NOT REJECTED" );
+    cout << "; read " << lines << " lines from " << path << ", " << matched << " matching" << endl << endl;
+}
+
+void TestCatalogBuild ( string inputDir, string outputDir )
+{
+    // Copy the nearby star catalog, so it can be changed; then start the build from scratch.
+
+    string nearestPath = outputDir + "/BuildNearest.csv", brightestPath = inputDir + "/Stars/Brightest.csv";
+    vector<string> lines;
+    SSLineReader reader ( inputDir + "/Stars/Nearest.csv" );
+    string line;
+    while ( reader.getline ( line ) )
+        lines.push_back ( line );
+
+    auto writeNearest = [&] ( size_t n )
+    {
+        FILE *file = fopen ( nearestPath.c_str(), "w" );
+        for ( size_t i = 0; file != nullptr && i < n && i < lines.size(); i++ )
+            fprintf ( file, "%s\n", lines[i].c_str() );
+        if ( file != nullptr )
+            fclose ( file );
+    };
+
+    writeNearest ( lines.size() );
+    remove ( ( outputDir + "/manifest.csv" ).c_str() );
+
+    // Two independent imports, then a stage which cross-matches them, adds nearby stars' identifiers to matching
+    // bright stars, and appends nearby stars which match none.
+
+    auto importCSV = [] ( const vector<string> &inputs, const vector<SSObjectArray *> &depends, SSObjectArray &objects )
+    {
+        return SSImportObjectsFromCSV ( inputs[0], objects ) > 0;
+    };
+
+    auto merge = [] ( const vector<string> &inputs, const vector<SSObjectArray *> &depends, SSObjectArray &objects )
+    {
+        SSObjectArray &brightest = *depends[0], &nearest = *depends[1];
+        SSCrossMatchTable matches;
+        SSCrossMatchObjects ( brightest, nearest, kCatHIP, SSAngle::fromArcsec ( 60.0 ), 1.0, matches );
+        SSBestCrossMatches ( matches );
+
+        vector<bool> matched ( nearest.size() );
+        for ( const SSCrossMatch &match : matches )
+            matched[ match.index2 ] = true;
+
+        for ( size_t i = 0; i < brightest.size(); i++ )
+            objects.append ( SSCloneObject ( brightest[i] ) );
+        SSAddCrossMatchIdentifiers ( matches, objects, nearest );
+        for ( size_t i = 0; i < nearest.size(); i++ )
+            if ( ! matched[i] )
+                objects.append ( SSCloneObject ( nearest[i] ) );
+        return true;
+    };
+
+    int runs[3] = { 0 };
+    size_t numStars = 0;
+    for ( int i = 0; i < 3; i++ )
+    {
+        if ( i == 2 )
+            writeNearest ( lines.size() - 1 );
+
+        SSCatalogBuild build ( outputDir );
+        build.addStage ( "BuildBrightest", { brightestPath }, {}, importCSV );
+        build.addStage ( "BuildNearest", { nearestPath }, {}, importCSV );
+        build.addStage ( "BuildStars", {}, { "BuildBrightest", "BuildNearest" }, merge );
+        runs[i] = build.run();
+
+        SSObjectArray *pStars = build.getObjects ( "BuildStars" );
+        numStars = pStars ? pStars->size() : 0;
+    }
+
+    cout << "Catalog build: " << runs[0] << " stages built, " << runs[1] << " rebuilt when unchanged, ";
+    cout << runs[2] << " rebuilt after changing nearby stars; " << numStars << " stars merged" << endl << endl;
+}
+
+void TestAsync ( string inputDir )
+{
+    // Import the bright stars asynchronously, with a completion callback; then start another import and cancel it at once.
+
+    atomic<int> numCallbacks ( 0 );
+    SSAsync<shared_ptr<SSObjectArray>> task = SSImportObjectsFromCSVAsync ( inputDir + "/Stars/Brightest.csv" );
+    task.onComplete ( [&numCallbacks] ( SSAsync<shared_ptr<SSObjectArray>> &task ) { numCallbacks++; } );
+    size_t numAsync = task.get()->size();
+
+    SSObjectArray stars;
+    int numSync = SSImportObjectsFromCSV ( inputDir + "/Stars/Brightest.csv", stars );
+
+    // A task which cancels itself part way through stops at its next check. On a pool of one thread, tasks run
+    // synchronously, so an import cancelled after it is started has already completed.
+
+    SSAsync<int> counter = SSRunAsync<int> ( [] ( SSTaskState &task )
+    {
+        int n = 0;
+        for ( ; n < 1000000 && ! task.isCancelled(); n++ )
+            if ( n == 100 )
+                task.cancel();
+        return n;
+    } );
+
+    SSAsync<shared_ptr<SSObjectArray>> cancelled = SSImportObjectsFromCSVAsync ( inputDir + "/Stars/Brightest.csv" );
+    cancelled.cancel();
+    size_t numCancelled = cancelled.get()->size();
+
+    cout << "Async import: " << numAsync << " stars (" << numSync << " synchronously), progress " << task.getDone() << ", " << numCallbacks << " callback; ";
+    cout << "self-cancelled task " << ( counter.getStatus() == SSTaskState::kCancelled ? "stopped" : "NOT STOPPED" ) << " at " << counter.get();
+    cout << "; import cancelled after start kept " << numCancelled << " of " << numSync << " stars" << endl << endl;
+}
+
+void TestWarmStart ( string inputDir, string outputDir )
+{
+    if ( outputDir.empty() )
+        return;
+
+    // Cold start: import catalogs, then build the maps and HTM indexes an app would build at every launch.
+
+    auto start = chrono::steady_clock::now();
+    SSObjectArray stars, features;
+    SSImportObjectsFromCSV ( inputDir + "/Stars/Brightest.csv", stars );
+    SSImportObjectsFromCSV ( inputDir + "/SolarSystem/Features.csv", features );
+    SSPlanetFeatureMap featureMap;
+    SSMakePlanetFeatureMap ( features, featureMap );
+    SSObjectMap hipMap = SSMakeObjectMap ( stars, kCatHIP );
+    SSIdentifierNameMap nameMap;
+    SSImportIdentifierNameMap ( inputDir + "/Stars/Names.csv", nameMap );
+
+    SSObjectArray copies;
+    for ( int i = 0; i < stars.size(); i++ )
+        copies.append ( SSCloneObject ( stars[i] ) );
+    SSHTM htm ( { 2.0, 4.0, 6.0, INFINITY }, "" );
+    htm.store ( copies );
+    copies.clear();
+    htm.makeObjectMap ( kCatUnknown );
+    htm.makeObjectMap ( kCatHIP );
+    double coldMS = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+
+    SSWarmStart image;
+    image.addObjects ( "stars", stars );
+    image.addObjects ( "features", features );
+    image.addPlanetFeatureMap ( "features", featureMap );
+    image.addObjectMap ( "hip", hipMap );
+    image.addIdentifierNameMap ( "names", nameMap );
+    image.addHTMIndexes ( "stars", htm );
+    string path = outputDir + "/WarmStart.ssimg";
+    bool saved = image.save ( path, 1 );
+
+    // Warm start: restore everything from the image; then check it matches, and that a different data version is rejected.
+
+    start = chrono::steady_clock::now();
+    SSWarmStart warm;
+    bool opened = warm.open ( path, 1 );
+    SSBinaryCatalog starCatalog;
+    warm.getCatalog ( "stars", starCatalog );
+    SSObjectArray warmFeatures;
+    warm.getObjects ( "features", warmFeatures );
+    SSPlanetFeatureMap warmFeatureMap;
+    warm.getPlanetFeatureMap ( "features", warmFeatureMap );
+    SSObjectMap warmHIPMap;
+    warm.getObjectMap ( "hip", warmHIPMap );
+    SSIdentifierNameMap warmNameMap;
+    warm.getIdentifierNameMap ( "names", warmNameMap );
+    SSHTM warmHTM ( { 2.0, 4.0, 6.0, INFINITY }, "" );
+    warm.getHTMIndexes ( "stars", warmHTM );
+    double warmMS = chrono::duration<double, milli> ( chrono::steady_clock::now() - start ).count();
+
+    int diffs = starCatalog.size() != stars.size() || warmFeatures.size() != features.size() || warmFeatureMap != featureMap;
+    diffs += warmHIPMap.size() != hipMap.size() || warmNameMap.size() != nameMap.size();
+    for ( auto &entry : hipMap )
+        diffs += warmHIPMap.find ( entry.first ) == warmHIPMap.end() || warmHIPMap.find ( entry.first )->second != entry.second;
+    for ( auto it = nameMap.begin(), warmIt = warmNameMap.begin(); it != nameMap.end() && warmIt != warmNameMap.end(); it++, warmIt++ )
+        diffs += it->first != warmIt->first || it->second != warmIt->second;
+    for ( size_t i = 0; i < starCatalog.size() && i < stars.size(); i++ )
+        diffs += starCatalog.getName ( i, 0 ) != stars[i]->getName ( 0 );
+
+    vector<SSHTM::ObjectLoc> locs, warmLocs;
+    htm.findObjectLocs ( "vega", locs, false );
+    warmHTM.findObjectLocs ( "vega", warmLocs, false );
+    diffs += locs.size() != warmLocs.size() || locs.empty() || warmLocs[0].region != locs[0].region || warmLocs[0].offset != locs[0].offset;
+    diffs += warmHTM.objectMapSize ( kCatHIP ) != htm.objectMapSize ( kCatHIP ) || warmHTM.objectMapSize ( kCatUnknown ) != htm.objectMapSize ( kCatUnknown );
+
+    SSWarmStart stale;
+    cout << format ( "Warm start image %s with %zu sections: %zu stars, %zu features, %zu HIP, %zu names, %zu HTM names; %d differences; ",
+                     saved ? "saved" : "NOT SAVED", opened ? warm.numSections() : 0, starCatalog.size(), warmFeatures.size(),
+                     warmHIPMap.size(), warmNameMap.size(), warmHTM.objectMapSize ( kCatUnknown ), diffs );
+    cout << format ( "other data version %s; cold start %.1f ms, warm start %.1f ms", stale.open ( path, 2 ) ? "NOT REJECTED" : "rejected", coldMS, warmMS ) << endl << endl;
+}
+
 void TestPrecession ( void )
 {
     SSMatrix p = SSCoordinates::getPrecessionMatrix ( 1219339.078000 );
@@ -658,6 +2905,49 @@ void TestPrecession ( void )
     printf ( "%+.12f %+.12f %+.12f\n", p.m00, p.m01, p.m02 );
     printf ( "%+.12f %+.12f %+.12f\n", p.m10, p.m11, p.m12 );
     printf ( "%+.12f %+.12f %+.12f\n", p.m20, p.m21, p.m22 );
+
+    // Precess a batch of B1950 positions to J2000 and to B1875 with cached matrices, and compare with
+    // precessing each position through J2000 with matrices computed for it.
+
+    size_t n = 100000;
+    double b1875 = SSTime::fromBesselianYear ( 1875.0 );
+    vector<SSVector> vecs ( n ), toJ2000 ( n ), toB1875 ( n );
+    for ( size_t i = 0; i < n; i++ )
+        vecs[i] = SSSpherical ( SSAngle::kTwoPi * i / n, asin ( 2.0 * ( i * 0.6180339887 - floor ( i * 0.6180339887 ) ) - 1.0 ), 1.0 ).toVectorPosition();
+
+    toJ2000 = toB1875 = vecs;
+    SSCoordinates::precess ( SSTime::kB1950, SSTime::kJ2000, toJ2000.data(), n );
+    SSCoordinates::precess ( SSTime::kB1950, b1875, toB1875.data(), n );
+
+    double maxdiff = 0.0;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        SSVector j2000 = SSCoordinates::getPrecessionMatrix ( SSTime::kB1950 ).transpose() * vecs[i];
+        SSVector b1875v = SSCoordinates::getPrecessionMatrix ( b1875 ) * j2000;
+        maxdiff = max ( maxdiff, max ( ( toJ2000[i] - j2000 ).magnitude(), ( toB1875[i] - b1875v ).magnitude() ) );
+    }
+    cout << format ( "Batch precession of %d B1950 positions to J2000 and B1875: max difference %.1e", (int) n, maxdiff ) << endl;
+
+    // Transform positions to the equatorial and ecliptic frames of date with a precession tolerance of 0.01 days,
+    // at the time precession was computed and half a tolerance later; compare with recomputing it every time.
+
+    double jd = 2461000.5, tolerance = 0.01, maxmas[2] = { 0.0, 0.0 };
+    SSCoordinates exact ( SSTime ( jd ), SSSpherical ( 0.0, 0.0, 0.0 ) );
+    SSCoordinates reused ( SSTime ( jd ), SSSpherical ( 0.0, 0.0, 0.0 ) );
+    exact.setPrecessionTolerance ( 0.0 );
+    reused.setPrecessionTolerance ( tolerance );
+    for ( int k = 0; k < 2; k++ )
+    {
+        exact.setTime ( SSTime ( jd + k * tolerance / 2.0 ) );
+        reused.setTime ( SSTime ( jd + k * tolerance / 2.0 ) );
+        for ( size_t i = 0; i < n; i += 100 )
+        {
+            double equ = exact.transform ( kFundamental, kEquatorial, vecs[i] ).angularSeparation ( reused.transform ( kFundamental, kEquatorial, vecs[i] ) ).toArcsec();
+            double ecl = exact.transform ( kFundamental, kEcliptic, vecs[i] ).angularSeparation ( reused.transform ( kFundamental, kEcliptic, vecs[i] ) ).toArcsec();
+            maxmas[k] = max ( maxmas[k], max ( equ, ecl ) * 1000.0 );
+        }
+    }
+    cout << format ( "Precession tolerance %.2f days: max error %.3f mas at JD %.1f, %.3f mas %.3f days later %s", tolerance, maxmas[0], jd, maxmas[1], tolerance / 2.0, maxmas[0] == 0.0 && maxmas[1] < 2.0 ? "OK" : "FAILED" ) << endl << endl;
 }
 
 // Android redirects stdout & stderr output to /dev/null. This uses Android logging functions to send
@@ -726,6 +3016,30 @@ int SSTestMain ( const char *inputpath, const char *outputpath )
 
 void ExportObjectsToHTM ( const string htmdir, SSObjectVec &objects, bool ngcic );
 
+// Prints hot-path instrumentation accumulated by all tests, if compiled in (USE_INSTRUMENTS = 1), then resets it.
+
+void TestInstruments ( void )
+{
+    if ( ! SSInstrument::enabled() )
+    {
+        cout << "Instrumentation disabled" << endl;
+        return;
+    }
+    
+    for ( SSInstrumentStats &stats : SSInstrument::snapshot() )
+    {
+        cout << format ( "%-20s", stats.name.c_str() );
+        if ( stats.calls > 0 )
+            cout << format ( " %9llu calls, mean %9.3f us, max %8.3f ms", (unsigned long long) stats.calls, stats.meanSeconds() * 1.0e6, stats.maxSeconds * 1.0e3 );
+        if ( stats.hits + stats.misses > 0 )
+            cout << format ( " %9llu lookups, hit rate %5.1f%%", (unsigned long long) ( stats.hits + stats.misses ), stats.hitRate() * 100.0 );
+        cout << endl;
+    }
+    
+    SSInstrument::reset();
+    cout << "Instrumentation reset: " << SSInstrument::snapshot ( kInstrumentSetTime ).calls << " setTime() calls" << endl;
+}
+
 int main ( int argc, const char *argv[] )
 {
 // This bit of magic makes UTF-8 output with degree characters appear correctly on the Windows console;
@@ -753,12 +3067,18 @@ int main ( int argc, const char *argv[] )
     TestVSOP2013 ( "/Users/timmyd/Projects/SouthernStars/Projects/Astro Code/VSOP2013/solution/" );
     TestEphemeris ( inpath, outpath );
     TestPrecession();
+    TestGzip ( outpath );
+    TestCatalogBuild ( inpath, outpath );
+    TestAsync ( inpath );
+    TestWarmStart ( inpath, outpath );
     TestSatellites ( inpath, outpath );
     TestJPLDEphemeris ( inpath );
     TestSolarSystem ( inpath, outpath );
     TestConstellations ( inpath, outpath );
     TestStars ( inpath, outpath );
+    TestHTM ( inpath, outpath );
     TestDeepSky ( inpath, outpath );
+    TestInstruments();
 
 #ifdef _WIN32
     SetConsoleOutputCP ( oldcp );
@@ -186,6 +186,22 @@ func test ( ) -> String
     var pObjArr = CSSObjectArrayCreate();
     var n = CSSImportObjectsFromCSV ( ( path as NSString ).utf8String, pObjArr )
     str.append ( String ( format: "Imported %d bright stars.\n", n ) )
+
+    // Compute all their positions, then project those above the horizon and brighter than mag 4
+    // into a 90-degree view centered on the zenith, straight into Swift arrays.
+
+    let view = CSSViewCreate ( kCSSStereographic, Double.pi / 2, 1000.0, 1000.0, 0.0, 0.0 )
+    CSSViewSetCenter ( view, 0.0, Double.pi / 2, 0.0 )
+    CSSObjectArrayComputeEphemeris ( pObjArr, coords )
+    let count = Int ( CSSObjectArraySize ( pObjArr ) )
+    var xs = [Float] ( repeating: 0, count: count ), ys = [Float] ( repeating: 0, count: count )
+    let nvis = xs.withUnsafeMutableBufferPointer { x in
+        ys.withUnsafeMutableBufferPointer { y in
+            CSSObjectArrayProject ( pObjArr, view, coords, kCSSHorizon, 0, count, 4.0, x.baseAddress, y.baseAddress, nil, nil, nil )
+        }
+    }
+    str.append ( String ( format: "Projected %d bright stars into zenith view.\n", nvis ) )
+    CSSViewDestroy ( view )
     CSSObjectArrayDestroy ( pObjArr )
 
     // Open and Messier and Caldwell csv data files into object array in memory.
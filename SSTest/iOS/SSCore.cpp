@@ -16,6 +16,8 @@
 #include "SSVector.hpp"
 #include "SSMatrix.hpp"
 #include "SSObject.hpp"
+#include "SSStar.hpp"
+#include "SSView.hpp"
 
 // C wrappers for C++ SSTime classes and methods
 
@@ -866,6 +868,93 @@ CSSObjectPtr CSSObjectGetFromArray ( CSSObjectArray *pObjArr, int i )
     return (CSSObject *) ( pObjVec ? pObjVec->at ( i ) : nullptr );
 }
 
+void CSSObjectArrayComputeEphemeris ( CSSObjectArray *pObjArr, CSSCoordinates *pCCoords )
+{
+    SSObjectVec *pObjVec = (SSObjectVec *) pObjArr;
+    SSCoordinates *pCoords = (SSCoordinates *) pCCoords;
+    if ( pObjVec && pCoords )
+        pObjVec->computeEphemeris ( *pCoords );
+}
+
+// C wrappers for C++ SSView classes and methods
+
+CSSView *CSSViewCreate ( int projection, CSSAngle widthAngle, double width, double height, double centerX, double centerY )
+{
+    return (CSSView *) new SSView ( (SSProjection) projection, SSAngle ( widthAngle ), width, height, centerX, centerY );
+}
+
+void CSSViewDestroy ( CSSView *pView )
+{
+    delete (SSView *) pView;
+}
+
+void CSSViewSetCenter ( CSSView *pView, CSSAngle lon, CSSAngle lat, CSSAngle rot )
+{
+    ( (SSView *) pView )->setCenter ( SSAngle ( lon ), SSAngle ( lat ), SSAngle ( rot ) );
+}
+
+CSSVector CSSViewProject ( CSSView *pView, CSSVector cvec )
+{
+    return CSSVectorFromSSVector ( ( (SSView *) pView )->project ( CSSVectorToSSVector ( cvec ) ) );
+}
+
+size_t CSSObjectArrayProject ( CSSObjectArray *pObjArr, CSSView *pCView, CSSCoordinates *pCCoords, int frame, size_t start, size_t count, float magLimit,
+                               float *x, float *y, float *mag, float *rgb, uint32_t *index )
+{
+    SSObjectVec *pObjVec = (SSObjectVec *) pObjArr;
+    SSView *pView = (SSView *) pCView;
+    SSCoordinates *pCoords = (SSCoordinates *) pCCoords;
+    if ( pObjVec == nullptr || pView == nullptr || pCoords == nullptr || start >= pObjVec->size() )
+        return 0;
+
+    // Gather directions of objects down to the magnitude limit, and project them with one matrix from fundamental frame to view.
+
+    size_t n = min ( count, pObjVec->size() - start );
+    vector<SSVector> dirs ( n );
+    vector<double> vx ( n ), vy ( n );
+    unique_ptr<bool[]> mask ( new bool[n] );
+    for ( size_t i = 0; i < n; i++ )
+    {
+        SSObject *pObject = pObjVec->get ( start + i );
+        dirs[i] = pObject->getDirection();
+        mask[i] = pObject->getMagnitude() <= magLimit || isinf ( magLimit );
+    }
+
+    SSView fview = *pView;
+    fview.setCenterMatrix ( pView->getCenterMatrix() * pCoords->getTransformMatrix ( kFundamental, (SSFrame) frame ) );
+    fview.projectBatch ( dirs.data(), vx.data(), vy.data(), n, mask.get() );
+
+    size_t k = 0;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        if ( vx[i] == INFINITY )
+            continue;
+
+        SSObject *pObject = pObjVec->get ( start + i );
+        if ( x )
+            x[k] = vx[i];
+        if ( y )
+            y[k] = vy[i];
+        if ( mag )
+            mag[k] = pObject->getMagnitude();
+        if ( rgb )
+        {
+            SSStarPtr pStar = SSGetStarPtr ( pObject );
+            float r = 1.0, g = 1.0, b = 1.0;
+            if ( pStar && pStar->getBMagnitude() < INFINITY && pStar->getVMagnitude() < INFINITY )
+                SSStar::bmv2rgb ( pStar->getBMagnitude() - pStar->getVMagnitude(), r, g, b );
+            rgb[k * 3] = r;
+            rgb[k * 3 + 1] = g;
+            rgb[k * 3 + 2] = b;
+        }
+        if ( index )
+            index[k] = (uint32_t) ( start + i );
+        k++;
+    }
+
+    return k;
+}
+
 // C wrappers for C++ SSEvent definitions, classes and methods
 
 CSSAngle CSSEventSemiDiurnalArc ( CSSAngle lat, CSSAngle dec, CSSAngle alt )
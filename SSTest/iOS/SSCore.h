@@ -11,6 +11,7 @@
 #define SSCore_h
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
@@ -373,6 +374,40 @@ int CSSImportObjectsFromCSV ( const char *filename, CSSObjectArray *pObjArr );
 size_t CSSObjectArraySize ( CSSObjectArray *pObjArr );
 CSSObjectPtr CSSObjectGetFromArray ( CSSObjectArray *pObjArr, int i );
 
+// Computes apparent directions, distances, and magnitudes of all objects in the array at once, in parallel.
+
+void CSSObjectArrayComputeEphemeris ( CSSObjectArray *pObjArr, CSSCoordinates *pCoords );
+
+// C wrappers for C++ SSView definitions, classes, and methods
+
+const int kCSSGnomonic = 1;
+const int kCSSOrthographic = 2;
+const int kCSSStereographic = 3;
+const int kCSSEquirectangular = 4;
+const int kCSSMercator = 5;
+const int kCSSMollweide = 6;
+const int kCSSSinusoidal = 7;
+
+typedef struct CSSView CSSView;
+
+CSSView *CSSViewCreate ( int projection, CSSAngle widthAngle, double width, double height, double centerX, double centerY );
+void CSSViewDestroy ( CSSView *pView );
+
+void CSSViewSetCenter ( CSSView *pView, CSSAngle lon, CSSAngle lat, CSSAngle rot );
+CSSVector CSSViewProject ( CSSView *pView, CSSVector cvec );
+
+// Projects objects (start) to (start + count - 1) of an object array, whose ephemerides are already computed, into
+// a view whose celestial frame is (frame), e.g. kCSSHorizon, in one call. Objects fainter than (magLimit) are culled
+// first, then the rest are projected with one matrix and culled against the view's bounding rectangle, as the star
+// pipeline does. Visible objects are written consecutively to caller-provided buffers: view coordinates (x, y),
+// magnitudes (mag), colors from B-V index (rgb, three floats per object; white if unknown), and indices in the array
+// (index). Each buffer must hold (count) entries (rgb 3 * count); any may be NULL. Returns number of objects written.
+// From Swift, pass arrays' storage directly, e.g. x.withUnsafeMutableBufferPointer { $0.baseAddress }, so nothing
+// crosses the bridge per object.
+
+size_t CSSObjectArrayProject ( CSSObjectArray *pObjArr, CSSView *pView, CSSCoordinates *pCoords, int frame, size_t start, size_t count, float magLimit,
+                               float *x, float *y, float *mag, float *rgb, uint32_t *index );
+
 // C wrappers for C++ SSEvent definitions, classes, and methods
 
 typedef struct CSSRTS   // Describes the circumstances of an object rise/transit/set event